@@ -0,0 +1,232 @@
+#ifndef UNIT_TEST
+#include <esp_log.h>
+#if defined(BOARD_HAS_PSRAM)
+#include <esp_heap_caps.h>
+#endif
+#else
+#define ESP_LOGE(args...)
+#define ESP_LOGI(args...)
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <SD.h>
+#include "BookCache.h"
+
+static const char *TAG = "CACHE";
+
+// 8.3-safe so the FAT implementation can always create the files
+#ifndef UNIT_TEST
+static const char *BOOK_CACHE_DIR = "/Books/CACHE";
+#else
+static const char *BOOK_CACHE_DIR = "fixtures/CACHE";
+#endif
+
+static uint32_t hash_path(const std::string &path)
+{
+  uint32_t hash = 2166136261u;
+  for (unsigned char c : path)
+  {
+    hash ^= c;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+BookCache::BookCache(const std::string &book_path) : m_book_path(book_path)
+{
+  m_path_hash = hash_path(book_path);
+  File fp = SD.open(book_path.c_str(), FILE_READ);
+  if (!fp)
+  {
+    return;
+  }
+  m_book_size = fp.size();
+  m_book_mtime = static_cast<uint32_t>(fp.getLastWrite());
+  fp.close();
+  m_valid = true;
+}
+
+BookCache::BookCache(const std::string &book_path, uint32_t book_size, uint32_t book_mtime)
+    : m_book_path(book_path), m_book_size(book_size), m_book_mtime(book_mtime)
+{
+  m_path_hash = hash_path(book_path);
+  m_valid = true;
+}
+
+void BookCache::fill_header(BookCacheHeader &header, uint32_t magic, uint16_t version, uint32_t payload_size)
+{
+  header.magic = magic;
+  header.version = version;
+  header.reserved = 0;
+  header.path_hash = m_path_hash;
+  header.book_size = m_book_size;
+  header.book_mtime = m_book_mtime;
+  header.payload_size = payload_size;
+}
+
+bool BookCache::check_header(File &fp, uint32_t magic, uint16_t version, BookCacheHeader &header)
+{
+  BookCacheHeader expected;
+  if (fp.read((uint8_t *)&header, sizeof(header)) != sizeof(header))
+  {
+    return false;
+  }
+  fill_header(expected, magic, version, header.payload_size);
+  return memcmp(&header, &expected, sizeof(header)) == 0;
+}
+
+std::string BookCache::get_path(const char *extension) const
+{
+  char name[32];
+  snprintf(name, sizeof(name), "/%08X.%s", static_cast<unsigned int>(m_path_hash), extension);
+  return std::string(BOOK_CACHE_DIR) + name;
+}
+
+uint8_t *BookCache::read(const char *extension, uint32_t magic, uint16_t version, size_t *size)
+{
+  if (!m_valid)
+  {
+    return nullptr;
+  }
+  std::string path = get_path(extension);
+  File fp = SD.open(path.c_str(), FILE_READ);
+  if (!fp)
+  {
+    return nullptr;
+  }
+  BookCacheHeader header;
+  if (!check_header(fp, magic, version, header) ||
+      fp.size() != sizeof(header) + header.payload_size)
+  {
+    ESP_LOGI(TAG, "Stale cache file %s", path.c_str());
+    fp.close();
+    return nullptr;
+  }
+  uint8_t *data;
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+  data = (uint8_t *)heap_caps_malloc(header.payload_size + 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+  data = (uint8_t *)malloc(header.payload_size + 1);
+#endif
+  if (!data)
+  {
+    ESP_LOGE(TAG, "Failed to allocate %u bytes for %s", header.payload_size, path.c_str());
+    fp.close();
+    return nullptr;
+  }
+  if (fp.read(data, header.payload_size) != header.payload_size)
+  {
+    free(data);
+    fp.close();
+    return nullptr;
+  }
+  fp.close();
+  if (size)
+  {
+    *size = header.payload_size;
+  }
+  return data;
+}
+
+bool BookCache::write(const char *extension, uint32_t magic, uint16_t version, const uint8_t *data, size_t size)
+{
+  if (!m_valid)
+  {
+    return false;
+  }
+  if (!SD.exists(BOOK_CACHE_DIR))
+  {
+    SD.mkdir(BOOK_CACHE_DIR);
+  }
+  std::string path = get_path(extension);
+  File fp = SD.open(path.c_str(), FILE_WRITE);
+  if (!fp)
+  {
+    ESP_LOGE(TAG, "Failed to open cache file %s for write", path.c_str());
+    return false;
+  }
+  // write a blank header first and only fill it in once the payload is on
+  // the card - that way a partially written file never validates
+  BookCacheHeader header;
+  memset(&header, 0, sizeof(header));
+  bool ok = fp.write((const uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            fp.write(data, size) == size;
+  if (ok)
+  {
+    fill_header(header, magic, version, size);
+    ok = fp.seek(0) && fp.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+  }
+  fp.close();
+  if (!ok)
+  {
+    ESP_LOGE(TAG, "Failed to write cache file %s", path.c_str());
+    SD.remove(path.c_str());
+  }
+  return ok;
+}
+
+void BookCache::remove(const char *extension)
+{
+  std::string path = get_path(extension);
+  if (SD.exists(path.c_str()))
+  {
+    SD.remove(path.c_str());
+  }
+}
+
+File BookCache::open_read(const char *extension, uint32_t magic, uint16_t version)
+{
+  if (!m_valid)
+  {
+    return File();
+  }
+  std::string path = get_path(extension);
+  File fp = SD.open(path.c_str(), FILE_READ);
+  if (!fp)
+  {
+    return fp;
+  }
+  BookCacheHeader header;
+  if (!check_header(fp, magic, version, header))
+  {
+    ESP_LOGI(TAG, "Stale cache file %s", path.c_str());
+    fp.close();
+  }
+  return fp;
+}
+
+File BookCache::open_append(const char *extension, uint32_t magic, uint16_t version)
+{
+  if (!m_valid)
+  {
+    return File();
+  }
+  File fp = open_read(extension, magic, version);
+  if (fp)
+  {
+    fp.close();
+    return SD.open(get_path(extension).c_str(), FILE_APPEND);
+  }
+  if (!SD.exists(BOOK_CACHE_DIR))
+  {
+    SD.mkdir(BOOK_CACHE_DIR);
+  }
+  std::string path = get_path(extension);
+  fp = SD.open(path.c_str(), FILE_WRITE);
+  if (!fp)
+  {
+    ESP_LOGE(TAG, "Failed to open cache file %s for write", path.c_str());
+    return fp;
+  }
+  // the size of a growing file isn't known so the payload size is left at 0
+  BookCacheHeader header;
+  fill_header(header, magic, version, 0);
+  if (fp.write((const uint8_t *)&header, sizeof(header)) != sizeof(header))
+  {
+    ESP_LOGE(TAG, "Failed to write cache file %s", path.c_str());
+    fp.close();
+    SD.remove(path.c_str());
+  }
+  return fp;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <string>
+#include <stdint.h>
+#include <stddef.h>
+#include <SD.h>
+
+// every sidecar file starts with this header - it ties the contents to the
+// exact version of the book file they were generated from
+struct BookCacheHeader
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t reserved;
+  uint32_t path_hash;
+  uint32_t book_size;
+  uint32_t book_mtime;
+  uint32_t payload_size;
+};
+
+// Sidecar files that cache things we've worked out about a book so we don't
+// have to work them out again next time it is opened. They all live in one
+// directory on the SD card, named after a hash of the book's path with a
+// different extension for each type of data.
+class BookCache
+{
+private:
+  std::string m_book_path;
+  uint32_t m_path_hash = 0;
+  uint32_t m_book_size = 0;
+  uint32_t m_book_mtime = 0;
+  bool m_valid = false;
+
+  void fill_header(BookCacheHeader &header, uint32_t magic, uint16_t version, uint32_t payload_size);
+  bool check_header(File &fp, uint32_t magic, uint16_t version, BookCacheHeader &header);
+
+public:
+  // looks up the size and modification time of the book on the SD card
+  BookCache(const std::string &book_path);
+  // for callers that already have the book open
+  BookCache(const std::string &book_path, uint32_t book_size, uint32_t book_mtime);
+  bool is_valid() const { return m_valid; }
+  // where the sidecar with the given extension lives
+  std::string get_path(const char *extension) const;
+  // read a sidecar, checking that it belongs to this version of the book -
+  // returns nullptr if it's missing or stale, the caller frees the data
+  uint8_t *read(const char *extension, uint32_t magic, uint16_t version, size_t *size);
+  // write a sidecar, replacing any existing one
+  bool write(const char *extension, uint32_t magic, uint16_t version, const uint8_t *data, size_t size);
+  void remove(const char *extension);
+  // for sidecars that are too big to load in one go or that grow over time -
+  // opens the file positioned just after the header, or returns a closed File
+  // if it's missing or stale
+  File open_read(const char *extension, uint32_t magic, uint16_t version);
+  // open a growing sidecar for appending, starting a new one if there isn't a valid one
+  File open_append(const char *extension, uint32_t magic, uint16_t version);
+};
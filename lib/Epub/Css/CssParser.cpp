@@ -0,0 +1,440 @@
+#include <string.h>
+#include <strings.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <ctype.h>
+#include "CssParser.h"
+#include "CssStyleTable.h"
+
+static bool is_css_space(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f';
+}
+
+static void trim(const char *&start, const char *&end)
+{
+  while (start < end && is_css_space(*start))
+  {
+    start++;
+  }
+  while (end > start && is_css_space(end[-1]))
+  {
+    end--;
+  }
+}
+
+// case insensitive compare of [start, end) with a lower case keyword
+static bool equals(const char *start, const char *end, const char *keyword)
+{
+  size_t length = strlen(keyword);
+  return static_cast<size_t>(end - start) == length && strncasecmp(start, keyword, length) == 0;
+}
+
+// find the next character c that isn't inside a quoted string
+static const char *find_unquoted(const char *start, const char *end, char c)
+{
+  char quote = 0;
+  for (const char *p = start; p < end; p++)
+  {
+    if (quote)
+    {
+      quote = *p == quote ? 0 : quote;
+    }
+    else if (*p == '"' || *p == '\'')
+    {
+      quote = *p;
+    }
+    else if (*p == c)
+    {
+      return p;
+    }
+  }
+  return end;
+}
+
+// read a length and convert it to hundredths of an em - returns false for
+// anything we can't convert (percentages, calc() and so on)
+static bool parse_length(const char *start, const char *end, css_length_t &length)
+{
+  if (equals(start, end, "auto"))
+  {
+    length = 0;
+    return true;
+  }
+  // strtof would run off the end of the value
+  char number[16];
+  size_t number_length = 0;
+  const char *p = start;
+  while (p < end && number_length < sizeof(number) - 1 && (isdigit(static_cast<unsigned char>(*p)) || *p == '.' || *p == '-' || *p == '+'))
+  {
+    number[number_length++] = *p++;
+  }
+  number[number_length] = '\0';
+  char *number_end;
+  float value = strtof(number, &number_end);
+  if (number_length == 0 || number_end != number + number_length)
+  {
+    return false;
+  }
+  // relative to a 16px / 12pt em
+  float scale;
+  if (p == end)
+  {
+    // only zero is allowed without a unit
+    if (value != 0)
+    {
+      return false;
+    }
+    scale = 0;
+  }
+  else if (equals(p, end, "em") || equals(p, end, "rem"))
+  {
+    scale = 100;
+  }
+  else if (equals(p, end, "ex") || equals(p, end, "ch"))
+  {
+    scale = 50;
+  }
+  else if (equals(p, end, "px"))
+  {
+    scale = 100.0f / 16;
+  }
+  else if (equals(p, end, "pt"))
+  {
+    scale = 100.0f / 12;
+  }
+  else if (equals(p, end, "pc"))
+  {
+    scale = 100;
+  }
+  else if (equals(p, end, "in"))
+  {
+    scale = 600;
+  }
+  else if (equals(p, end, "cm"))
+  {
+    scale = 600 / 2.54f;
+  }
+  else if (equals(p, end, "mm"))
+  {
+    scale = 60 / 2.54f;
+  }
+  else
+  {
+    return false;
+  }
+  value *= scale;
+  if (value > INT16_MAX)
+  {
+    value = INT16_MAX;
+  }
+  if (value < INT16_MIN)
+  {
+    value = INT16_MIN;
+  }
+  length = static_cast<css_length_t>(value);
+  return true;
+}
+
+static void set_length(CssStyle &style, CSS_PROPERTY property, css_length_t &field, const char *start, const char *end)
+{
+  css_length_t length;
+  if (parse_length(start, end, length))
+  {
+    field = length;
+    style.set |= property;
+  }
+}
+
+// margin: top [right [bottom [left]]]
+static void parse_margin_shorthand(const char *start, const char *end, CssStyle &style)
+{
+  css_length_t values[4];
+  int count = 0;
+  const char *p = start;
+  while (p < end && count < 4)
+  {
+    const char *value_end = p;
+    while (value_end < end && !is_css_space(*value_end))
+    {
+      value_end++;
+    }
+    if (!parse_length(p, value_end, values[count]))
+    {
+      // the whole declaration is invalid
+      return;
+    }
+    count++;
+    p = value_end;
+    while (p < end && is_css_space(*p))
+    {
+      p++;
+    }
+  }
+  if (count == 0 || p < end)
+  {
+    return;
+  }
+  style.margin_top = values[0];
+  style.margin_right = count > 1 ? values[1] : values[0];
+  style.margin_bottom = count > 2 ? values[2] : values[0];
+  style.margin_left = count > 3 ? values[3] : style.margin_right;
+  style.set |= CSS_MARGIN_TOP | CSS_MARGIN_RIGHT | CSS_MARGIN_BOTTOM | CSS_MARGIN_LEFT;
+}
+
+static void parse_declaration(const char *name, const char *name_end, const char *value, const char *value_end, CssStyle &style)
+{
+  // we don't do the cascade properly so !important is ignored
+  const char *bang = find_unquoted(value, value_end, '!');
+  if (bang < value_end)
+  {
+    value_end = bang;
+    trim(value, value_end);
+  }
+  if (equals(name, name_end, "text-align"))
+  {
+    if (equals(value, value_end, "left") || equals(value, value_end, "start"))
+    {
+      style.text_align = CSS_ALIGN_LEFT;
+    }
+    else if (equals(value, value_end, "right") || equals(value, value_end, "end"))
+    {
+      style.text_align = CSS_ALIGN_RIGHT;
+    }
+    else if (equals(value, value_end, "center"))
+    {
+      style.text_align = CSS_ALIGN_CENTER;
+    }
+    else if (equals(value, value_end, "justify"))
+    {
+      style.text_align = CSS_ALIGN_JUSTIFY;
+    }
+    else
+    {
+      return;
+    }
+    style.set |= CSS_TEXT_ALIGN;
+  }
+  else if (equals(name, name_end, "font-weight"))
+  {
+    if (equals(value, value_end, "bold") || equals(value, value_end, "bolder"))
+    {
+      style.bold = true;
+    }
+    else if (equals(value, value_end, "normal") || equals(value, value_end, "lighter"))
+    {
+      style.bold = false;
+    }
+    else if (value < value_end && isdigit(static_cast<unsigned char>(*value)))
+    {
+      style.bold = atoi(value) >= 600;
+    }
+    else
+    {
+      return;
+    }
+    style.set |= CSS_FONT_WEIGHT;
+  }
+  else if (equals(name, name_end, "font-style"))
+  {
+    if (equals(value, value_end, "italic") || equals(value, value_end, "oblique"))
+    {
+      style.italic = true;
+    }
+    else if (equals(value, value_end, "normal"))
+    {
+      style.italic = false;
+    }
+    else
+    {
+      return;
+    }
+    style.set |= CSS_FONT_STYLE;
+  }
+  else if (equals(name, name_end, "display"))
+  {
+    style.display_none = equals(value, value_end, "none");
+    style.set |= CSS_DISPLAY;
+  }
+  else if (equals(name, name_end, "margin"))
+  {
+    parse_margin_shorthand(value, value_end, style);
+  }
+  else if (equals(name, name_end, "margin-top"))
+  {
+    set_length(style, CSS_MARGIN_TOP, style.margin_top, value, value_end);
+  }
+  else if (equals(name, name_end, "margin-right"))
+  {
+    set_length(style, CSS_MARGIN_RIGHT, style.margin_right, value, value_end);
+  }
+  else if (equals(name, name_end, "margin-bottom"))
+  {
+    set_length(style, CSS_MARGIN_BOTTOM, style.margin_bottom, value, value_end);
+  }
+  else if (equals(name, name_end, "margin-left"))
+  {
+    set_length(style, CSS_MARGIN_LEFT, style.margin_left, value, value_end);
+  }
+  else if (equals(name, name_end, "text-indent"))
+  {
+    set_length(style, CSS_TEXT_INDENT, style.text_indent, value, value_end);
+  }
+}
+
+void parse_css_declarations(const char *text, size_t length, CssStyle &style)
+{
+  const char *end = text + length;
+  const char *p = text;
+  while (p < end)
+  {
+    const char *declaration_end = find_unquoted(p, end, ';');
+    const char *colon = static_cast<const char *>(memchr(p, ':', declaration_end - p));
+    if (colon)
+    {
+      const char *name = p;
+      const char *name_end = colon;
+      const char *value = colon + 1;
+      const char *value_end = declaration_end;
+      trim(name, name_end);
+      trim(value, value_end);
+      parse_declaration(name, name_end, value, value_end, style);
+    }
+    p = declaration_end + 1;
+  }
+}
+
+static bool is_name_char(char c)
+{
+  return isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || (c & 0x80);
+}
+
+// add the style for one selector from a selector list if it's one we can handle
+static void add_selector(const char *start, const char *end, const CssStyle &style, CssStyleTable &table)
+{
+  trim(start, end);
+  const char *element = start;
+  const char *p = start;
+  while (p < end && is_name_char(*p))
+  {
+    p++;
+  }
+  const char *element_end = p;
+  const char *class_name = nullptr;
+  const char *class_end = nullptr;
+  if (p < end && *p == '.')
+  {
+    class_name = ++p;
+    while (p < end && is_name_char(*p))
+    {
+      p++;
+    }
+    class_end = p;
+    if (class_name == class_end)
+    {
+      return;
+    }
+  }
+  // anything left over is a combinator, id, pseudo class... which we don't support
+  if (p != end || (element == element_end && !class_name))
+  {
+    return;
+  }
+  table.add(element, element_end - element, class_name, class_end - class_name, style);
+}
+
+// blank out comments so nothing else has to worry about them
+static void strip_comments(char *css, size_t length)
+{
+  char *end = css + length;
+  char *p = css;
+  while (p + 1 < end)
+  {
+    if (p[0] == '/' && p[1] == '*')
+    {
+      char *comment_end = p + 2;
+      while (comment_end + 1 < end && !(comment_end[0] == '*' && comment_end[1] == '/'))
+      {
+        comment_end++;
+      }
+      comment_end = comment_end + 1 < end ? comment_end + 2 : end;
+      memset(p, ' ', comment_end - p);
+      p = comment_end;
+    }
+    else
+    {
+      p++;
+    }
+  }
+}
+
+// skip a {} block - including any blocks nested inside it
+static const char *skip_block(const char *open, const char *end)
+{
+  int depth = 0;
+  char quote = 0;
+  for (const char *p = open; p < end; p++)
+  {
+    if (quote)
+    {
+      quote = *p == quote ? 0 : quote;
+    }
+    else if (*p == '"' || *p == '\'')
+    {
+      quote = *p;
+    }
+    else if (*p == '{')
+    {
+      depth++;
+    }
+    else if (*p == '}' && --depth == 0)
+    {
+      return p + 1;
+    }
+  }
+  return end;
+}
+
+void parse_css_stylesheet(char *css, size_t length, CssStyleTable &table)
+{
+  strip_comments(css, length);
+  const char *end = css + length;
+  const char *p = css;
+  while (p < end)
+  {
+    while (p < end && is_css_space(*p))
+    {
+      p++;
+    }
+    if (p == end)
+    {
+      break;
+    }
+    const char *block = find_unquoted(p, end, '{');
+    if (*p == '@')
+    {
+      // @import and @charset end at a semicolon, the rest have a block we skip
+      const char *semicolon = find_unquoted(p, end, ';');
+      p = semicolon < block ? semicolon + 1 : skip_block(block, end);
+      continue;
+    }
+    if (block == end)
+    {
+      break;
+    }
+    const char *block_end = find_unquoted(block + 1, end, '}');
+    CssStyle style;
+    parse_css_declarations(block + 1, block_end - block - 1, style);
+    if (style.set)
+    {
+      const char *selector = p;
+      while (selector < block)
+      {
+        const char *comma = find_unquoted(selector, block, ',');
+        add_selector(selector, comma, style, table);
+        selector = comma + 1;
+      }
+    }
+    p = block_end < end ? block_end + 1 : end;
+  }
+}
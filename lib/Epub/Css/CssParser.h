@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stddef.h>
+#include "CssStyle.h"
+
+class CssStyleTable;
+
+// A very small CSS parser - just enough to pull the properties we care about
+// out of publisher stylesheets and style attributes. It never allocates.
+
+// parse the declarations from a style attribute or the inside of a rule -
+// unknown properties and values are ignored
+void parse_css_declarations(const char *text, size_t length, CssStyle &style);
+
+// parse a whole stylesheet and add the rules with simple selectors to the
+// table - at-rules (@media, @font-face...) are skipped. Comments are blanked
+// out in place so the text gets modified.
+void parse_css_stylesheet(char *css, size_t length, CssStyleTable &table);
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// which of the properties in a CssStyle have been set
+typedef enum
+{
+  CSS_TEXT_ALIGN = 1,
+  CSS_FONT_WEIGHT = 2,
+  CSS_FONT_STYLE = 4,
+  CSS_DISPLAY = 8,
+  CSS_MARGIN_TOP = 16,
+  CSS_MARGIN_RIGHT = 32,
+  CSS_MARGIN_BOTTOM = 64,
+  CSS_MARGIN_LEFT = 128,
+  CSS_TEXT_INDENT = 256,
+} CSS_PROPERTY;
+
+typedef enum
+{
+  CSS_ALIGN_LEFT = 0,
+  CSS_ALIGN_RIGHT = 1,
+  CSS_ALIGN_CENTER = 2,
+  CSS_ALIGN_JUSTIFY = 3,
+} CSS_TEXT_ALIGN_VALUE;
+
+// lengths are kept in hundredths of an em - we don't know how big the
+// reading font is until the section is laid out
+typedef int16_t css_length_t;
+
+// The handful of properties we do anything with. Only the ones with their
+// bit set in `set` mean anything - everything else is left to the defaults
+// or whatever was inherited.
+struct CssStyle
+{
+  uint16_t set = 0;
+  uint8_t text_align = CSS_ALIGN_LEFT;
+  bool bold = false;
+  bool italic = false;
+  bool display_none = false;
+  css_length_t margin_top = 0;
+  css_length_t margin_right = 0;
+  css_length_t margin_bottom = 0;
+  css_length_t margin_left = 0;
+  css_length_t text_indent = 0;
+
+  bool has(CSS_PROPERTY property) const { return set & property; }
+  // copy across anything the other style sets - it wins over what we have
+  void merge(const CssStyle &other)
+  {
+    text_align = other.has(CSS_TEXT_ALIGN) ? other.text_align : text_align;
+    bold = other.has(CSS_FONT_WEIGHT) ? other.bold : bold;
+    italic = other.has(CSS_FONT_STYLE) ? other.italic : italic;
+    display_none = other.has(CSS_DISPLAY) ? other.display_none : display_none;
+    margin_top = other.has(CSS_MARGIN_TOP) ? other.margin_top : margin_top;
+    margin_right = other.has(CSS_MARGIN_RIGHT) ? other.margin_right : margin_right;
+    margin_bottom = other.has(CSS_MARGIN_BOTTOM) ? other.margin_bottom : margin_bottom;
+    margin_left = other.has(CSS_MARGIN_LEFT) ? other.margin_left : margin_left;
+    text_indent = other.has(CSS_TEXT_INDENT) ? other.text_indent : text_indent;
+    set |= other.set;
+  }
+};
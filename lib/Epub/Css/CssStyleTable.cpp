@@ -0,0 +1,307 @@
+#include <string.h>
+#include <strings.h>
+#include "CssStyleTable.h"
+
+static const uint16_t EMPTY_SLOT = 0xFFFF;
+// the rule indexes have to fit in the hash slots
+static const size_t MAX_RULES = 0x7FFF;
+
+static uint32_t hash_bytes(uint32_t hash, const char *text, size_t length, bool ignore_case)
+{
+  for (size_t i = 0; i < length; i++)
+  {
+    char c = text[i];
+    if (ignore_case && c >= 'A' && c <= 'Z')
+    {
+      c = c - 'A' + 'a';
+    }
+    hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return hash;
+}
+
+// element names are case insensitive, class names aren't
+static uint32_t selector_hash(const char *element, size_t element_length, const char *class_name, size_t class_length)
+{
+  uint32_t hash = hash_bytes(2166136261u, element, element_length, true);
+  if (class_name)
+  {
+    hash = hash_bytes(hash, ".", 1, false);
+    hash = hash_bytes(hash, class_name, class_length, false);
+  }
+  return hash;
+}
+
+int CssStyleTable::find(uint32_t hash, const char *element, size_t element_length, const char *class_name, size_t class_length) const
+{
+  if (m_index.empty())
+  {
+    return -1;
+  }
+  size_t selector_length = element_length + (class_name ? class_length + 1 : 0);
+  uint32_t mask = m_index.size() - 1;
+  for (uint32_t slot = hash & mask; m_index[slot] != EMPTY_SLOT; slot = (slot + 1) & mask)
+  {
+    const Rule &rule = m_rules[m_index[slot]];
+    if (rule.hash != hash || rule.selector_length != selector_length)
+    {
+      continue;
+    }
+    const char *selector = &m_selectors[rule.selector];
+    if (strncasecmp(selector, element, element_length) == 0 &&
+        (!class_name || (selector[element_length] == '.' && memcmp(selector + element_length + 1, class_name, class_length) == 0)))
+    {
+      return m_index[slot];
+    }
+  }
+  return -1;
+}
+
+void CssStyleTable::build_index()
+{
+  size_t size = 16;
+  while (size < m_rules.size() * 2)
+  {
+    size *= 2;
+  }
+  m_index.assign(size, EMPTY_SLOT);
+  uint32_t mask = size - 1;
+  for (size_t i = 0; i < m_rules.size(); i++)
+  {
+    uint32_t slot = m_rules[i].hash & mask;
+    while (m_index[slot] != EMPTY_SLOT)
+    {
+      slot = (slot + 1) & mask;
+    }
+    m_index[slot] = i;
+  }
+}
+
+void CssStyleTable::add(const char *element, size_t element_length, const char *class_name, size_t class_length, const CssStyle &style)
+{
+  uint32_t hash = selector_hash(element, element_length, class_name, class_length);
+  int existing = find(hash, element, element_length, class_name, class_length);
+  if (existing >= 0)
+  {
+    m_styles[m_rules[existing].style].merge(style);
+    return;
+  }
+  size_t selector_length = element_length + (class_name ? class_length + 1 : 0);
+  if (m_rules.size() >= MAX_RULES || selector_length > 0xFFFF)
+  {
+    return;
+  }
+  Rule rule;
+  rule.hash = hash;
+  rule.selector = m_selectors.size();
+  rule.selector_length = selector_length;
+  rule.style = m_styles.size();
+  for (size_t i = 0; i < element_length; i++)
+  {
+    char c = element[i];
+    m_selectors.push_back(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+  }
+  if (class_name)
+  {
+    m_selectors.push_back('.');
+    m_selectors.insert(m_selectors.end(), class_name, class_name + class_length);
+  }
+  m_rules.push_back(rule);
+  m_styles.push_back(style);
+  // keep the table at most half full
+  if (m_rules.size() * 2 > m_index.size())
+  {
+    build_index();
+  }
+  else
+  {
+    uint32_t mask = m_index.size() - 1;
+    uint32_t slot = hash & mask;
+    while (m_index[slot] != EMPTY_SLOT)
+    {
+      slot = (slot + 1) & mask;
+    }
+    m_index[slot] = m_rules.size() - 1;
+  }
+}
+
+void CssStyleTable::clear()
+{
+  m_rules.clear();
+  m_styles.clear();
+  m_selectors.clear();
+  m_index.clear();
+}
+
+const CssStyle *CssStyleTable::lookup(const char *element, const char *class_name) const
+{
+  element = element ? element : "";
+  size_t element_length = strlen(element);
+  size_t class_length = class_name ? strlen(class_name) : 0;
+  int rule = find(selector_hash(element, element_length, class_name, class_length), element, element_length, class_name, class_length);
+  return rule >= 0 ? &m_styles[m_rules[rule].style] : nullptr;
+}
+
+static bool is_class_separator(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f';
+}
+
+void CssStyleTable::resolve(const char *element, const char *class_attribute, CssStyle &style) const
+{
+  if (m_rules.empty())
+  {
+    return;
+  }
+  size_t element_length = strlen(element);
+  uint32_t element_hash = selector_hash(element, element_length, nullptr, 0);
+  int rule = find(element_hash, element, element_length, nullptr, 0);
+  if (rule >= 0)
+  {
+    style.merge(m_styles[m_rules[rule].style]);
+  }
+  if (!class_attribute || !class_attribute[0])
+  {
+    return;
+  }
+  // .class beats element, and element.class beats both
+  for (int pass = 0; pass < 2; pass++)
+  {
+    const char *p = class_attribute;
+    while (*p)
+    {
+      while (*p && is_class_separator(*p))
+      {
+        p++;
+      }
+      const char *class_name = p;
+      while (*p && !is_class_separator(*p))
+      {
+        p++;
+      }
+      size_t class_length = p - class_name;
+      if (class_length == 0)
+      {
+        continue;
+      }
+      const char *rule_element = pass == 0 ? "" : element;
+      size_t rule_element_length = pass == 0 ? 0 : element_length;
+      rule = find(selector_hash(rule_element, rule_element_length, class_name, class_length), rule_element, rule_element_length, class_name, class_length);
+      if (rule >= 0)
+      {
+        style.merge(m_styles[m_rules[rule].style]);
+      }
+    }
+  }
+}
+
+// the table is saved as the rule count then for each rule the selector and
+// its style - the hash index is rebuilt when it's loaded
+// styles are written a field at a time so whatever is in the struct's
+// padding never ends up in the cache
+static const size_t STYLE_BYTES = 14;
+static const uint8_t STYLE_BOLD = 1;
+static const uint8_t STYLE_ITALIC = 2;
+static const uint8_t STYLE_DISPLAY_NONE = 4;
+
+template <typename T>
+static void put_value(std::vector<uint8_t> &out, T value)
+{
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(value));
+}
+
+template <typename T>
+static T get_value(const uint8_t *&data)
+{
+  T value;
+  memcpy(&value, data, sizeof(value));
+  data += sizeof(value);
+  return value;
+}
+
+static void put_style(std::vector<uint8_t> &out, const CssStyle &style)
+{
+  put_value<uint16_t>(out, style.set);
+  put_value<uint8_t>(out, style.text_align);
+  put_value<uint8_t>(out, (style.bold ? STYLE_BOLD : 0) | (style.italic ? STYLE_ITALIC : 0) | (style.display_none ? STYLE_DISPLAY_NONE : 0));
+  put_value<css_length_t>(out, style.margin_top);
+  put_value<css_length_t>(out, style.margin_right);
+  put_value<css_length_t>(out, style.margin_bottom);
+  put_value<css_length_t>(out, style.margin_left);
+  put_value<css_length_t>(out, style.text_indent);
+}
+
+static CssStyle get_style(const uint8_t *data)
+{
+  CssStyle style;
+  style.set = get_value<uint16_t>(data);
+  style.text_align = get_value<uint8_t>(data);
+  uint8_t flags = get_value<uint8_t>(data);
+  style.bold = flags & STYLE_BOLD;
+  style.italic = flags & STYLE_ITALIC;
+  style.display_none = flags & STYLE_DISPLAY_NONE;
+  style.margin_top = get_value<css_length_t>(data);
+  style.margin_right = get_value<css_length_t>(data);
+  style.margin_bottom = get_value<css_length_t>(data);
+  style.margin_left = get_value<css_length_t>(data);
+  style.text_indent = get_value<css_length_t>(data);
+  return style;
+}
+
+void CssStyleTable::serialize(std::vector<uint8_t> &out) const
+{
+  put_value<uint32_t>(out, m_rules.size());
+  for (auto &rule : m_rules)
+  {
+    put_value<uint16_t>(out, rule.selector_length);
+    out.insert(out.end(), m_selectors.begin() + rule.selector, m_selectors.begin() + rule.selector + rule.selector_length);
+    put_style(out, m_styles[rule.style]);
+  }
+}
+
+bool CssStyleTable::deserialize(const uint8_t *data, size_t size)
+{
+  clear();
+  uint32_t count;
+  if (size < sizeof(count))
+  {
+    return false;
+  }
+  memcpy(&count, data, sizeof(count));
+  size_t pos = sizeof(count);
+  if (count > MAX_RULES)
+  {
+    return false;
+  }
+  for (uint32_t i = 0; i < count; i++)
+  {
+    uint16_t selector_length;
+    if (size - pos < sizeof(selector_length))
+    {
+      clear();
+      return false;
+    }
+    memcpy(&selector_length, data + pos, sizeof(selector_length));
+    pos += sizeof(selector_length);
+    if (size - pos < selector_length + STYLE_BYTES)
+    {
+      clear();
+      return false;
+    }
+    const char *selector = reinterpret_cast<const char *>(data + pos);
+    pos += selector_length;
+    CssStyle style = get_style(data + pos);
+    pos += STYLE_BYTES;
+    // split the selector back into element and class
+    const char *dot = static_cast<const char *>(memchr(selector, '.', selector_length));
+    size_t element_length = dot ? dot - selector : selector_length;
+    add(selector, element_length, dot ? dot + 1 : nullptr, dot ? selector_length - element_length - 1 : 0, style);
+  }
+  if (pos != size)
+  {
+    clear();
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "CssStyle.h"
+
+// The styles from a book's stylesheets, keyed by selector. Only simple
+// selectors are kept - "p", ".class" and "p.class" - anything else in the
+// stylesheet is dropped when it is parsed. Element names are lower case,
+// class names are case sensitive. The table is built once when the book is
+// opened and saved with the rest of the book's metadata.
+class CssStyleTable
+{
+private:
+  struct Rule
+  {
+    uint32_t hash;
+    // where the selector lives in m_selectors
+    uint32_t selector;
+    uint16_t selector_length;
+    uint16_t style;
+  };
+  std::vector<Rule> m_rules;
+  std::vector<CssStyle> m_styles;
+  // all the selectors one after the other
+  std::vector<char> m_selectors;
+  // open addressed hash table of indexes into m_rules - a power of two in size
+  std::vector<uint16_t> m_index;
+
+  int find(uint32_t hash, const char *element, size_t element_length, const char *class_name, size_t class_length) const;
+  void build_index();
+
+public:
+  // add the declarations for a selector - later declarations win over earlier ones
+  void add(const char *element, size_t element_length, const char *class_name, size_t class_length, const CssStyle &style);
+  void clear();
+  bool empty() const { return m_rules.empty(); }
+  size_t size() const { return m_rules.size(); }
+
+  // look up one selector - element or class_name can be nullptr
+  const CssStyle *lookup(const char *element, const char *class_name) const;
+  // work out the style for an element from its name and class attribute,
+  // in order of specificity: element, then .class, then element.class
+  void resolve(const char *element, const char *class_attribute, CssStyle &style) const;
+
+  // for the metadata cache
+  void serialize(std::vector<uint8_t> &out) const;
+  bool deserialize(const uint8_t *data, size_t size);
+};
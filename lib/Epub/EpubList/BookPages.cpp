@@ -0,0 +1,232 @@
+#ifndef UNIT_TEST
+#include <esp_log.h>
+#else
+#define ESP_LOGE(args...)
+#define ESP_LOGI(args...)
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "BookPages.h"
+
+static const char *TAG = "PAGES";
+
+static const uint32_t BOOK_PAGES_MAGIC = 0x43474150; // 'PAGC'
+static const uint16_t BOOK_PAGES_VERSION = 3;
+static const char *BOOK_PAGES_EXTENSION = "PGC";
+
+const uint16_t BookPages::UNKNOWN;
+
+BookPages::BookPages(const BookCache &cache, int section_count)
+    : m_cache(cache), m_counts(section_count, UNKNOWN), m_sizes(section_count, 0), m_unknown(section_count)
+{
+}
+
+// the sidecar is the settings key followed by a count for each section
+void BookPages::load()
+{
+  m_loaded = true;
+  std::fill(m_counts.begin(), m_counts.end(), UNKNOWN);
+  m_unknown = m_counts.size();
+  m_first_pages.clear();
+  size_t size = 0;
+  uint8_t *data = m_cache.read(BOOK_PAGES_EXTENSION, BOOK_PAGES_MAGIC, BOOK_PAGES_VERSION, &size);
+  if (!data)
+  {
+    return;
+  }
+  uint32_t key;
+  if (size == sizeof(key) + m_counts.size() * sizeof(uint16_t))
+  {
+    memcpy(&key, data, sizeof(key));
+    if (key == m_key)
+    {
+      memcpy(m_counts.data(), data + sizeof(key), m_counts.size() * sizeof(uint16_t));
+      m_unknown = std::count(m_counts.begin(), m_counts.end(), UNKNOWN);
+    }
+  }
+  free(data);
+  update_first_pages();
+}
+
+void BookPages::save()
+{
+  std::vector<uint8_t> data(sizeof(m_key) + m_counts.size() * sizeof(uint16_t));
+  memcpy(data.data(), &m_key, sizeof(m_key));
+  memcpy(data.data() + sizeof(m_key), m_counts.data(), m_counts.size() * sizeof(uint16_t));
+  if (!m_cache.write(BOOK_PAGES_EXTENSION, BOOK_PAGES_MAGIC, BOOK_PAGES_VERSION, data.data(), data.size()))
+  {
+    ESP_LOGE(TAG, "Failed to save page counts");
+  }
+}
+
+void BookPages::update_first_pages()
+{
+  if (m_unknown > 0)
+  {
+    return;
+  }
+  m_first_pages.resize(m_counts.size() + 1);
+  m_first_pages[0] = 0;
+  for (size_t i = 0; i < m_counts.size(); i++)
+  {
+    m_first_pages[i + 1] = m_first_pages[i] + m_counts[i];
+  }
+  ESP_LOGI(TAG, "Book has %u pages", m_first_pages.back());
+}
+
+void BookPages::set_layout_key(uint32_t key)
+{
+  if (!m_loaded || key != m_key)
+  {
+    m_key = key;
+    load();
+  }
+}
+
+void BookPages::set_section_pages(int section, int pages)
+{
+  if (!m_loaded || section < 0 || section >= static_cast<int>(m_counts.size()) || pages < 0 || pages >= UNKNOWN ||
+      m_counts[section] == pages)
+  {
+    return;
+  }
+  if (m_counts[section] == UNKNOWN)
+  {
+    m_unknown--;
+  }
+  m_counts[section] = pages;
+  m_first_pages.clear();
+  update_first_pages();
+  save();
+}
+
+int BookPages::get_section_pages(int section) const
+{
+  if (section < 0 || section >= static_cast<int>(m_counts.size()) || m_counts[section] == UNKNOWN)
+  {
+    return -1;
+  }
+  return m_counts[section];
+}
+
+int BookPages::get_next_unknown_section() const
+{
+  for (size_t i = 0; i < m_counts.size(); i++)
+  {
+    if (m_counts[i] == UNKNOWN)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int BookPages::get_total_pages() const
+{
+  return is_complete() ? m_first_pages.back() : -1;
+}
+
+int BookPages::get_page_number(int section, int page) const
+{
+  if (!is_complete() || section < 0 || section >= static_cast<int>(m_counts.size()))
+  {
+    return -1;
+  }
+  return m_first_pages[section] + page;
+}
+
+bool BookPages::find_page(int page_number, int &section, int &page) const
+{
+  if (!is_complete() || page_number < 0 || page_number >= get_total_pages())
+  {
+    return false;
+  }
+  // the last section starting at or before the page - empty sections start
+  // at the same page as the one after them so they're skipped over
+  auto next = std::upper_bound(m_first_pages.begin(), m_first_pages.end(), static_cast<uint32_t>(page_number));
+  section = (next - m_first_pages.begin()) - 1;
+  page = page_number - m_first_pages[section];
+  return true;
+}
+
+void BookPages::set_section_size(int section, uint32_t bytes)
+{
+  if (section >= 0 && section < static_cast<int>(m_sizes.size()))
+  {
+    m_sizes[section] = bytes;
+  }
+}
+
+uint32_t BookPages::get_bytes_per_page() const
+{
+  uint64_t bytes = 0;
+  uint32_t pages = 0;
+  for (size_t i = 0; i < m_counts.size(); i++)
+  {
+    if (m_counts[i] != UNKNOWN && m_sizes[i] > 0)
+    {
+      bytes += m_sizes[i];
+      pages += m_counts[i];
+    }
+  }
+  if (pages == 0)
+  {
+    return DEFAULT_BYTES_PER_PAGE;
+  }
+  return std::max<uint64_t>(1, bytes / pages);
+}
+
+int BookPages::estimate_pages(int section, uint32_t bytes_per_page) const
+{
+  if (m_counts[section] != UNKNOWN)
+  {
+    return m_counts[section];
+  }
+  if (m_sizes[section] == 0)
+  {
+    return 0;
+  }
+  // every section has at least one page
+  return std::max<uint32_t>(1, (m_sizes[section] + bytes_per_page / 2) / bytes_per_page);
+}
+
+int BookPages::estimate_section_pages(int section) const
+{
+  if (section < 0 || section >= static_cast<int>(m_counts.size()))
+  {
+    return 0;
+  }
+  return estimate_pages(section, get_bytes_per_page());
+}
+
+bool BookPages::estimate_position(int section, int page, int &page_number, int &total_pages) const
+{
+  if (section < 0 || section >= static_cast<int>(m_counts.size()))
+  {
+    return false;
+  }
+  if (is_complete())
+  {
+    page_number = get_page_number(section, page);
+    total_pages = get_total_pages();
+    return total_pages > 0;
+  }
+  uint32_t bytes_per_page = get_bytes_per_page();
+  bool have_sizes = false;
+  page_number = 0;
+  total_pages = 0;
+  for (size_t i = 0; i < m_counts.size(); i++)
+  {
+    int pages = estimate_pages(i, bytes_per_page);
+    have_sizes = have_sizes || m_sizes[i] > 0;
+    if (static_cast<int>(i) == section)
+    {
+      // the guess for this section might already be too small
+      pages = std::max(pages, page + 1);
+      page_number = total_pages + page;
+    }
+    total_pages += pages;
+  }
+  return have_sizes && total_pages > 0;
+}
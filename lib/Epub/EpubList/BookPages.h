@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "../BookCache/BookCache.h"
+
+// How many pages each section of a book has with the current layout
+// settings, so we can give page numbers for the whole book. The counts are
+// filled in a section at a time in the background and saved in a sidecar
+// with the settings they were worked out for. Until then the counts are
+// estimated from the size of each section's HTML.
+class BookPages
+{
+private:
+  static const uint16_t UNKNOWN = 0xFFFF;
+  // a guess at how much HTML fills a page until we've laid something out
+  static const uint32_t DEFAULT_BYTES_PER_PAGE = 2500;
+  BookCache m_cache;
+  uint32_t m_key = 0;
+  bool m_loaded = false;
+  std::vector<uint16_t> m_counts;
+  // uncompressed size of each section
+  std::vector<uint32_t> m_sizes;
+  // pages before each section - only filled in once every count is known
+  std::vector<uint32_t> m_first_pages;
+  int m_unknown = 0;
+
+  void load();
+  void save();
+  void update_first_pages();
+  int estimate_pages(int section, uint32_t bytes_per_page) const;
+
+public:
+  BookPages(const BookCache &cache, int section_count);
+  // the PageCache::layout_key for the current settings - changing it throws
+  // away all the counts unless the sidecar has some for the new settings
+  void set_layout_key(uint32_t key);
+  void set_section_pages(int section, int pages);
+  // -1 if we don't know yet
+  int get_section_pages(int section) const;
+  // the first section we don't have a count for, -1 if we have them all
+  int get_next_unknown_section() const;
+  bool is_complete() const { return m_loaded && m_unknown == 0; }
+
+  // these only work once is_complete is true
+  int get_total_pages() const;
+  // zero based page number in the whole book
+  int get_page_number(int section, int page) const;
+  bool find_page(int page_number, int &section, int &page) const;
+
+  // for estimating page counts before they're known
+  void set_section_size(int section, uint32_t bytes);
+  // how much HTML makes a page in the sections we've counted so far
+  uint32_t get_bytes_per_page() const;
+  // the real count if we know it, otherwise a guess from the section's size
+  int estimate_section_pages(int section) const;
+  // like get_page_number and get_total_pages but using estimates for the
+  // sections we haven't counted - false if we don't know any of the sizes
+  bool estimate_position(int section, int page, int &page_number, int &total_pages) const;
+};
@@ -1,5 +1,5 @@
 #include <cstring>
-#include <cstring>
+#include <cctype>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -19,10 +19,12 @@
   printf(args);                \
   printf("\n");
 #endif
-#include <map>
+#include <algorithm>
 #include <pugixml.hpp>
 #include "../ZipFile/ZipFile.h"
+#include "../BookCache/BookCache.h"
 #include "Epub.h"
+#include "../Css/CssParser.h"
 #ifndef UNIT_TEST
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
@@ -31,11 +33,200 @@
 
 static const char *TAG = "EPUB";
 
+// the parsed meta data is saved in this sidecar so that opening a book
+// we've seen before doesn't need any XML parsing or decompression
+static const uint32_t METADATA_CACHE_MAGIC = 0x4154454D; // 'META'
+static const uint16_t METADATA_CACHE_VERSION = 6;
+static const char *METADATA_CACHE_EXTENSION = "MET";
+
+static void put_u32(std::vector<uint8_t> &out, uint32_t value)
+{
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(value));
+}
+
+static void put_string(std::vector<uint8_t> &out, const char *value, size_t length)
+{
+  put_u32(out, length);
+  out.insert(out.end(), value, value + length);
+}
+
+static void put_string(std::vector<uint8_t> &out, const std::string &value)
+{
+  put_string(out, value.data(), value.size());
+}
+
+static void put_string(std::vector<uint8_t> &out, const char *value)
+{
+  put_string(out, value, strlen(value));
+}
+
+// bounds checked reads from a metadata cache payload
+class MetadataReader
+{
+private:
+  const uint8_t *m_data;
+  size_t m_size;
+  size_t m_pos = 0;
+
+public:
+  MetadataReader(const uint8_t *data, size_t size) : m_data(data), m_size(size) {}
+  bool at_end() const { return m_pos == m_size; }
+  bool get_u32(uint32_t &value)
+  {
+    if (m_size - m_pos < sizeof(value))
+    {
+      return false;
+    }
+    memcpy(&value, m_data + m_pos, sizeof(value));
+    m_pos += sizeof(value);
+    return true;
+  }
+  bool get_string(std::string &value)
+  {
+    uint32_t length;
+    if (!get_u32(length) || m_size - m_pos < length)
+    {
+      return false;
+    }
+    value.assign(reinterpret_cast<const char *>(m_data + m_pos), length);
+    m_pos += length;
+    return true;
+  }
+  // read a string straight into the arena
+  bool get_string(StringArena &strings, const char *&value)
+  {
+    uint32_t length;
+    if (!get_u32(length) || m_size - m_pos < length)
+    {
+      return false;
+    }
+    value = strings.intern(reinterpret_cast<const char *>(m_data + m_pos), length);
+    m_pos += length;
+    return value != nullptr;
+  }
+  // a length prefixed block of bytes - points into the payload
+  bool get_bytes(const uint8_t *&value, uint32_t &length)
+  {
+    if (!get_u32(length) || m_size - m_pos < length)
+    {
+      return false;
+    }
+    value = m_data + m_pos;
+    m_pos += length;
+    return true;
+  }
+};
+
+bool Epub::load_from_cache(BookCache &cache)
+{
+  size_t size = 0;
+  uint8_t *data = cache.read(METADATA_CACHE_EXTENSION, METADATA_CACHE_MAGIC, METADATA_CACHE_VERSION, &size);
+  if (!data)
+  {
+    return false;
+  }
+  MetadataReader reader(data, size);
+  uint32_t spine_count = 0;
+  bool ok = reader.get_string(m_title) &&
+            reader.get_string(m_language) &&
+            reader.get_string(m_cover_image_item) &&
+            reader.get_string(m_toc_ncx_item) &&
+            reader.get_string(m_base_path) &&
+            reader.get_u32(spine_count);
+  // each spine item is at least two string lengths and a size
+  ok = ok && spine_count <= size / 12;
+  if (ok)
+  {
+    m_spine.resize(spine_count);
+  }
+  for (uint32_t i = 0; ok && i < spine_count; i++)
+  {
+    ok = reader.get_string(m_strings, m_spine[i].id) &&
+         reader.get_string(m_strings, m_spine[i].href) &&
+         reader.get_u32(m_spine[i].size);
+  }
+  uint32_t toc_count = 0;
+  ok = ok && reader.get_u32(toc_count) && toc_count <= size / 16;
+  if (ok)
+  {
+    m_toc.resize(toc_count);
+  }
+  for (uint32_t i = 0; ok && i < toc_count; i++)
+  {
+    EpubTocRecord &entry = m_toc[i];
+    uint32_t level = 0;
+    ok = reader.get_string(m_strings, entry.title) &&
+         reader.get_string(m_strings, entry.href) &&
+         reader.get_string(m_strings, entry.anchor) &&
+         reader.get_u32(level);
+    entry.level = level;
+  }
+  const uint8_t *styles = nullptr;
+  uint32_t styles_size = 0;
+  ok = ok && reader.get_bytes(styles, styles_size) && m_styles.deserialize(styles, styles_size);
+  ok = ok && reader.at_end();
+  free(data);
+  if (!ok)
+  {
+    ESP_LOGE(TAG, "Metadata cache failed validation - reparsing");
+    cache.remove(METADATA_CACHE_EXTENSION);
+    m_title.clear();
+    m_language.clear();
+    m_cover_image_item.clear();
+    m_toc_ncx_item.clear();
+    m_base_path.clear();
+    m_spine.clear();
+    m_toc.clear();
+    m_strings.clear();
+    m_styles.clear();
+    return false;
+  }
+  resolve_toc_spine_indexes();
+  m_hyphenator.set_language(m_language.c_str());
+  return true;
+}
+
+bool Epub::save_to_cache(BookCache &cache)
+{
+  std::vector<uint8_t> out;
+  put_string(out, m_title);
+  put_string(out, m_language);
+  put_string(out, m_cover_image_item);
+  put_string(out, m_toc_ncx_item);
+  put_string(out, m_base_path);
+  put_u32(out, m_spine.size());
+  for (auto &item : m_spine)
+  {
+    put_string(out, item.id);
+    put_string(out, item.href);
+    put_u32(out, item.size);
+  }
+  put_u32(out, m_toc.size());
+  for (auto &entry : m_toc)
+  {
+    put_string(out, entry.title);
+    put_string(out, entry.href);
+    put_string(out, entry.anchor);
+    put_u32(out, static_cast<uint32_t>(entry.level));
+  }
+  std::vector<uint8_t> styles;
+  m_styles.serialize(styles);
+  put_u32(out, styles.size());
+  out.insert(out.end(), styles.begin(), styles.end());
+  return cache.write(METADATA_CACHE_EXTENSION, METADATA_CACHE_MAGIC, METADATA_CACHE_VERSION, out.data(), out.size());
+}
+
 bool Epub::load_internal()
 {
   ESP_LOGE(TAG, ">>> Epub::load() START: %s", m_path.c_str());
-  ZipFile zip(m_path.c_str());
-  ESP_LOGE(TAG, ">>> ZipFile created");
+  BookCache cache(m_path);
+  if (load_from_cache(cache))
+  {
+    ESP_LOGE(TAG, ">>> Epub::load() END (cached)");
+    return true;
+  }
+  ZipFile &zip = *m_zip;
   std::string content_opf_file;
   if (!find_content_opf_file(zip, content_opf_file))
   {
@@ -50,11 +241,19 @@ bool Epub::load_internal()
     return false;
   }
   ESP_LOGE(TAG, ">>> content.opf parsed");
+  // the zip index is already in memory so the sizes are free - they give
+  // us a rough idea of how long each section is before it's laid out
+  for (size_t i = 0; i < m_spine.size(); i++)
+  {
+    m_spine[i].size = get_item_uncompressed_size(get_spine_item(i));
+  }
   // The NCX table of contents is optional for our purposes.
   if (!parse_toc_ncx_file(zip))
   {
     ESP_LOGW(TAG, "Continuing without NCX table of contents for '%s'", m_path.c_str());
   }
+  resolve_toc_spine_indexes();
+  save_to_cache(cache);
   ESP_LOGE(TAG, ">>> Epub::load() END");
   return true;
 }
@@ -148,6 +347,10 @@ bool Epub::parse_content_opf(ZipFile &zip, std::string &content_opf_file)
     return false;
   }
   m_title = title.child_value();
+  // picks the hyphenation patterns
+  pugi::xml_node language = metadata.child("dc:language");
+  m_language = language && language.child_value() ? language.child_value() : "";
+  m_hyphenator.set_language(m_language.c_str());
 
   // find <meta name="cover" content="..."> if present
   pugi::xml_node cover = metadata.find_child_by_attribute("meta", "name", "cover");
@@ -165,7 +368,9 @@ bool Epub::parse_content_opf(ZipFile &zip, std::string &content_opf_file)
     return false;
   }
 
-  std::map<std::string, std::string> items;
+  // the manifest strings point into the document so we can look up the
+  // spine items without copying the whole manifest
+  std::vector<std::pair<const char *, const char *>> items;
   for (pugi::xml_node item = manifest.child("item"); item; item = item.next_sibling("item"))
   {
     const char *id_attr = item.attribute("id").value();
@@ -174,19 +379,27 @@ bool Epub::parse_content_opf(ZipFile &zip, std::string &content_opf_file)
     {
       continue;
     }
-    std::string item_id = id_attr;
-    std::string href = m_base_path + href_attr;
-
-    if (cover_item && item_id == cover_item)
+    if (cover_item && strcmp(id_attr, cover_item) == 0)
+    {
+      m_cover_image_item = m_base_path + href_attr;
+    }
+    if (strcmp(id_attr, "ncx") == 0)
     {
-      m_cover_image_item = href;
+      m_toc_ncx_item = m_base_path + href_attr;
     }
-    if (item_id == "ncx")
+    // the stylesheets are parsed once now rather than for every section
+    const char *media_type = item.attribute("media-type").value();
+    if (media_type && strcmp(media_type, "text/css") == 0)
     {
-      m_toc_ncx_item = href;
+      parse_stylesheet(zip, m_base_path + href_attr);
     }
-    items[item_id] = href;
+    items.push_back(std::make_pair(id_attr, href_attr));
   }
+  auto id_less = [](const std::pair<const char *, const char *> &a, const std::pair<const char *, const char *> &b) {
+    return strcmp(a.first, b.first) < 0;
+  };
+  // stable so that the last of any duplicate ids wins, as it did with a map
+  std::stable_sort(items.begin(), items.end(), id_less);
 
   pugi::xml_node spine = package.child("spine");
   if (!spine)
@@ -201,15 +414,153 @@ bool Epub::parse_content_opf(ZipFile &zip, std::string &content_opf_file)
     {
       continue;
     }
-    auto it = items.find(idref);
-    if (it != items.end())
+    auto it = std::upper_bound(items.begin(), items.end(), std::make_pair(idref, (const char *)nullptr), id_less);
+    if (it != items.begin() && strcmp((--it)->first, idref) == 0)
     {
-      m_spine.push_back(std::make_pair(std::string(idref), it->second));
+      EpubSpineRecord record;
+      record.id = m_strings.intern(it->first);
+      record.href = m_strings.intern(it->second);
+      record.size = 0;
+      if (!record.id || !record.href)
+      {
+        ESP_LOGE(TAG, "Out of memory for the spine");
+        return false;
+      }
+      m_spine.push_back(record);
     }
   }
   return true;
 }
 
+void Epub::parse_stylesheet(ZipFile &zip, const std::string &href)
+{
+  size_t size = 0;
+  char *css = (char *)zip.read_file_to_memory(href.c_str(), &size);
+  if (!css)
+  {
+    ESP_LOGW(TAG, "Could not read stylesheet '%s'", href.c_str());
+    return;
+  }
+  parse_css_stylesheet(css, size, m_styles);
+  free(css);
+}
+
+bool Epub::parse_content_opf_metadata(ZipFile &zip, std::string &content_opf_file)
+{
+  ZipEntryStream *stream = zip.open_stream(content_opf_file.c_str());
+  if (!stream)
+  {
+    ESP_LOGE(TAG, "Failed to read content.opf '%s'", content_opf_file.c_str());
+    return false;
+  }
+  std::string opf;
+  // append the next chunk of the file - false once we've run out
+  auto read_more = [&]() {
+    const size_t chunk_size = 1024;
+    size_t old_size = opf.size();
+    opf.resize(old_size + chunk_size);
+    size_t read = stream->read(reinterpret_cast<uint8_t *>(&opf[old_size]), chunk_size);
+    opf.resize(old_size + read);
+    return read > 0;
+  };
+  size_t metadata_end;
+  while ((metadata_end = opf.find("</metadata>")) == std::string::npos)
+  {
+    if (!read_more())
+    {
+      ESP_LOGE(TAG, "Missing metadata");
+      delete stream;
+      return false;
+    }
+  }
+  metadata_end += strlen("</metadata>");
+  size_t metadata_start = opf.rfind("<metadata", metadata_end);
+  if (metadata_start == std::string::npos)
+  {
+    ESP_LOGE(TAG, "Missing metadata");
+    delete stream;
+    return false;
+  }
+  pugi::xml_document doc;
+  pugi::xml_parse_result result = doc.load_buffer(opf.data() + metadata_start, metadata_end - metadata_start);
+  if (!result)
+  {
+    ESP_LOGE(TAG, "Error parsing content.opf metadata (pugixml): %s", result.description());
+    delete stream;
+    return false;
+  }
+  pugi::xml_node metadata = doc.child("metadata");
+  pugi::xml_node title = metadata.child("dc:title");
+  if (!title || !title.child_value())
+  {
+    ESP_LOGE(TAG, "Missing title");
+    delete stream;
+    return false;
+  }
+  m_title = title.child_value();
+  pugi::xml_node cover = metadata.find_child_by_attribute("meta", "name", "cover");
+  if (!cover)
+  {
+    ESP_LOGW(TAG, "Missing cover");
+    delete stream;
+    return true;
+  }
+  std::string cover_item = cover.attribute("content").value();
+  // look through the manifest items for the cover
+  opf.erase(0, metadata_end);
+  size_t pos = 0;
+  for (;;)
+  {
+    size_t item_start = opf.find("<item", pos);
+    size_t manifest_end = opf.find("</manifest>", pos);
+    if (manifest_end != std::string::npos && (item_start == std::string::npos || manifest_end < item_start))
+    {
+      break;
+    }
+    size_t item_end = item_start == std::string::npos ? std::string::npos : opf.find('>', item_start);
+    if (item_end == std::string::npos)
+    {
+      // keep anything that could be the start of a tag and read some more
+      size_t keep_from = item_start;
+      if (keep_from == std::string::npos)
+      {
+        keep_from = opf.size() > strlen("</manifest>") ? opf.size() - strlen("</manifest>") : 0;
+      }
+      opf.erase(0, keep_from);
+      pos = 0;
+      if (!read_more())
+      {
+        break;
+      }
+      continue;
+    }
+    pos = item_end + 1;
+    // skip <itemref> and anything else that just starts with "item"
+    if (!isspace(static_cast<unsigned char>(opf[item_start + 5])))
+    {
+      continue;
+    }
+    std::string tag = opf.substr(item_start, pos - item_start);
+    if (tag[tag.size() - 2] != '/')
+    {
+      tag.insert(tag.size() - 1, "/");
+    }
+    pugi::xml_document item_doc;
+    if (!item_doc.load_buffer(tag.data(), tag.size()))
+    {
+      continue;
+    }
+    pugi::xml_node item = item_doc.child("item");
+    if (cover_item == item.attribute("id").value())
+    {
+      m_cover_image_item = m_base_path + item.attribute("href").value();
+      break;
+    }
+  }
+  delete stream;
+  return true;
+}
+
 bool Epub::parse_toc_ncx_file(ZipFile &zip)
 {
   // the ncx file should have been specified in the content.opf file
@@ -258,30 +609,63 @@ bool Epub::parse_toc_ncx_file(ZipFile &zip)
     {
       continue;
     }
-    std::string title = title_text;
-
     pugi::xml_node content = navPoint.child("content");
     const char *src = content.attribute("src").value();
     if (!src)
     {
       continue;
     }
-    std::string href = m_base_path + src;
-
-    size_t pos = href.find('#');
-    std::string anchor;
-    if (pos != std::string::npos)
+    const char *hash = strchr(src, '#');
+    EpubTocRecord record;
+    record.title = m_strings.intern(title_text);
+    record.href = hash ? m_strings.intern(src, hash - src) : m_strings.intern(src);
+    record.anchor = m_strings.intern(hash ? hash + 1 : "");
+    record.level = 0;
+    record.spine_index = -1;
+    if (!record.title || !record.href || !record.anchor)
     {
-      anchor = href.substr(pos + 1);
-      href = href.substr(0, pos);
+      ESP_LOGE(TAG, "Out of memory for the toc");
+      return false;
     }
-    m_toc.push_back(EpubTocEntry(title, href, anchor, 0));
+    m_toc.push_back(record);
   }
   return true;
 }
 
+void Epub::resolve_toc_spine_indexes()
+{
+  // interned strings are equal if their pointers are
+  for (auto &entry : m_toc)
+  {
+    entry.spine_index = -1;
+    for (size_t i = 0; i < m_spine.size(); i++)
+    {
+      if (m_spine[i].href == entry.href)
+      {
+        entry.spine_index = i;
+        break;
+      }
+    }
+  }
+}
+
+// how often to save inflate checkpoints in large chapters
+static const size_t CHECKPOINT_INTERVAL = 256 * 1024;
+
 Epub::Epub(const std::string &path) : m_path(path)
 {
+  m_zip = new ZipFile(path.c_str());
+  m_zip->set_checkpoint_interval(CHECKPOINT_INTERVAL);
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+  // whole chapters and images are inflated into PSRAM, which has room for
+  // the compressed copy the fast engine wants
+  m_zip->set_inflate_engine(ZIP_INFLATE_FAST);
+#endif
+}
+
+Epub::~Epub()
+{
+  delete m_zip;
 }
 
 // load in the meta data for the epub file
@@ -290,11 +674,29 @@ bool Epub::load()
   return load_internal();
 }
 
+bool Epub::load_metadata()
+{
+  // a book we've opened before has everything in its sidecar already
+  BookCache cache(m_path);
+  if (load_from_cache(cache))
+  {
+    return true;
+  }
+  std::string content_opf_file;
+  if (!find_content_opf_file(*m_zip, content_opf_file))
+  {
+    ESP_LOGE(TAG, "Could not open ePub '%s'", m_path.c_str());
+    return false;
+  }
+  m_base_path = content_opf_file.substr(0, content_opf_file.find_last_of('/') + 1);
+  return parse_content_opf_metadata(*m_zip, content_opf_file);
+}
+
 bool Epub::load_with_task(size_t stack_size_bytes)
 {
 #ifdef UNIT_TEST
   (void)stack_size_bytes;
-  return epub_load_internal(this);
+  return load_internal();
 #else
   struct LoadContext
   {
@@ -391,11 +793,23 @@ std::string normalise_path(const std::string &path)
   return result;
 }
 
+// most hrefs are already in their normal form, so only rebuild the ones that need it
+static const std::string &zip_path(const std::string &href, std::string &scratch)
+{
+  if (href.empty() || href.front() == '/' || href.back() == '/' ||
+      href.find("..") != std::string::npos || href.find("//") != std::string::npos)
+  {
+    scratch = normalise_path(href);
+    return scratch;
+  }
+  return href;
+}
+
 uint8_t *Epub::get_item_contents(const std::string &item_href, size_t *size)
 {
-  ZipFile zip(m_path.c_str());
-  std::string path = normalise_path(item_href);
-  auto content = zip.read_file_to_memory(path.c_str(), size);
+  std::string scratch;
+  const std::string &path = zip_path(item_href, scratch);
+  auto content = m_zip->read_file_to_memory(path.c_str(), size);
   if (!content)
   {
     ESP_LOGE(TAG, "Failed to read item %s", path.c_str());
@@ -406,28 +820,55 @@ uint8_t *Epub::get_item_contents(const std::string &item_href, size_t *size)
 
 size_t Epub::get_item_uncompressed_size(const std::string &item_href)
 {
-  ZipFile zip(m_path.c_str());
-  std::string path = normalise_path(item_href);
+  std::string scratch;
+  const std::string &path = zip_path(item_href, scratch);
   size_t size = 0;
-  if (!zip.get_file_uncompressed_size(path.c_str(), &size))
+  if (!m_zip->get_file_uncompressed_size(path.c_str(), &size))
   {
     return 0;
   }
   return size;
 }
 
+bool Epub::get_item_info(const std::string &item_href, size_t *size, bool *stored)
+{
+  std::string scratch;
+  const std::string &path = zip_path(item_href, scratch);
+  return m_zip->get_file_info(path.c_str(), size, stored);
+}
+
+ZipEntryStream *Epub::open_item_stream(const std::string &item_href)
+{
+  std::string scratch;
+  const std::string &path = zip_path(item_href, scratch);
+  ZipEntryStream *stream = m_zip->open_stream(path.c_str());
+  if (!stream)
+  {
+    ESP_LOGE(TAG, "Failed to open item %s", path.c_str());
+  }
+  return stream;
+}
+
 int Epub::get_spine_items_count()
 {
   return m_spine.size();
 }
 
-std::string &Epub::get_spine_item(int spine_index)
+size_t Epub::get_spine_item_size(int spine_index)
+{
+  if (spine_index < 0 || spine_index >= static_cast<int>(m_spine.size()))
+  {
+    return 0;
+  }
+  return m_spine[spine_index].size;
+}
+
+std::string Epub::get_spine_item(int spine_index)
 {
-  static std::string empty_spine_item;
   if (m_spine.empty())
   {
     ESP_LOGI(TAG, "get_spine_item called with empty spine");
-    return empty_spine_item;
+    return std::string();
   }
 
   if (spine_index < 0 || spine_index >= static_cast<int>(m_spine.size()))
@@ -435,13 +876,18 @@ std::string &Epub::get_spine_item(int spine_index)
     ESP_LOGI(TAG, "get_spine_item index:%d is out_of_range", spine_index);
     spine_index = 0;
   }
-  // if exception is catched return last page
-  return m_spine[spine_index].second;
+  return m_base_path + m_spine[spine_index].href;
 }
 
-EpubTocEntry &Epub::get_toc_item(int toc_index)
+EpubTocEntry Epub::get_toc_item(int toc_index)
 {
-  return m_toc[toc_index];
+  if (toc_index < 0 || toc_index >= static_cast<int>(m_toc.size()))
+  {
+    ESP_LOGI(TAG, "get_toc_item index:%d is out_of_range", toc_index);
+    return EpubTocEntry("", "", "", 0);
+  }
+  const EpubTocRecord &entry = m_toc[toc_index];
+  return EpubTocEntry(entry.title, m_base_path + entry.href, entry.anchor, entry.level);
 }
 
 int Epub::get_toc_items_count()
@@ -466,14 +912,10 @@ int Epub::get_spine_index_for_toc_index(int toc_index)
     ESP_LOGI(TAG, "toc_index %d out of range (max %d), clamping", toc_index, static_cast<int>(m_toc.size()) - 1);
     toc_index = static_cast<int>(m_toc.size()) - 1;
   }
-  // the toc entry should have an href that matches the spine item
-  // so we can find the spine index by looking for the href
-  for (int i = 0; i < static_cast<int>(m_spine.size()); i++)
+  // worked out when the toc was loaded
+  if (m_toc[toc_index].spine_index >= 0)
   {
-    if (m_spine[i].second == m_toc[toc_index].href)
-    {
-      return i;
-    }
+    return m_toc[toc_index].spine_index;
   }
   ESP_LOGI(TAG, "Section not found");
   // not found - default to the start of the book
@@ -4,12 +4,17 @@
 #include <vector>
 #include <cstring>
 #include <unordered_map>
+#include "StringArena.h"
+#include "../Css/CssStyleTable.h"
+#include "../Hyphenation/Hyphenator.h"
 #ifndef UNIT_TEST
   #include <freertos/FreeRTOS.h>
   #include <freertos/task.h>
 #endif
 
 class ZipFile;
+class ZipEntryStream;
+class BookCache;
 
 class EpubTocEntry
 {
@@ -21,11 +26,35 @@ public:
   EpubTocEntry(std::string title, std::string href, std::string anchor, int level) : title(title), href(href), anchor(anchor), level(level) {}
 };
 
+// the spine and toc are stored as arrays of these - the strings live in the
+// book's string arena and hrefs are relative to the base path
+struct EpubSpineRecord
+{
+  const char *id;
+  const char *href;
+  // uncompressed size from the zip's central directory
+  uint32_t size;
+};
+
+struct EpubTocRecord
+{
+  const char *title;
+  const char *href;
+  const char *anchor;
+  int16_t level;
+  // the spine item with the same href, or -1 if there isn't one
+  int32_t spine_index;
+};
+
 class Epub
 {
 private:
   // the title read from the EPUB meta data
   std::string m_title;
+  // the dc:language from the EPUB meta data
+  std::string m_language;
+  // picked to match the language
+  Hyphenator m_hyphenator;
   // the cover image
   std::string m_cover_image_item;
   // the ncx file
@@ -33,36 +62,68 @@ private:
   // where is the EPUBfile?
   std::string m_path;
   // the spine of the EPUB file
-  std::vector<std::pair<std::string, std::string>> m_spine;
+  std::vector<EpubSpineRecord> m_spine;
   // the toc of the EPUB file
-  std::vector<EpubTocEntry> m_toc;
+  std::vector<EpubTocRecord> m_toc;
   // the base path for items in the EPUB file
   std::string m_base_path;
+  // where the spine and toc strings live
+  StringArena m_strings;
+  // the rules from the book's stylesheets
+  CssStyleTable m_styles;
+  // the zip archive - kept open for as long as the book is
+  ZipFile *m_zip = nullptr;
   bool load_internal();
+  // the parsed meta data is cached next to the book - see Epub.cpp
+  bool load_from_cache(BookCache &cache);
+  bool save_to_cache(BookCache &cache);
+  // point each toc entry at its spine item
+  void resolve_toc_spine_indexes();
   // find the path for the content.opf file
   bool find_content_opf_file(ZipFile &zip, std::string &content_opf_file);
   bool parse_content_opf(ZipFile &zip, std::string &content_opf_file);
+  bool parse_content_opf_metadata(ZipFile &zip, std::string &content_opf_file);
   bool parse_toc_ncx_file(ZipFile &zip);
+  void parse_stylesheet(ZipFile &zip, const std::string &href);
 
 public:
   Epub(const std::string &path);
-  ~Epub() {}
+  ~Epub();
   std::string &get_base_path() { return m_base_path; }
   bool load();
   bool load_with_task(size_t stack_size_bytes);
+  // just the title and cover image for the library - the spine and toc are
+  // left empty unless they were already in the metadata cache
+  bool load_metadata();
 
   const std::string &get_path() const { return m_path; }
+  // the archive session shared by everything reading from this book
+  ZipFile &get_zip() { return *m_zip; }
   const std::string &get_title();
+  const std::string &get_language() const { return m_language; }
+  // null if we can't hyphenate the book's language
+  const Hyphenator *get_hyphenator() const { return m_hyphenator.is_enabled() ? &m_hyphenator : nullptr; }
   const std::string &get_cover_image_item();
   uint8_t *get_item_contents(const std::string &item_href, size_t *size = nullptr);
   size_t get_item_uncompressed_size(const std::string &item_href);
+  // the size and whether the item is stored uncompressed, without opening it
+  bool get_item_info(const std::string &item_href, size_t *size, bool *stored);
+  // stream an item rather than reading it all into memory - caller deletes the stream
+  ZipEntryStream *open_item_stream(const std::string &item_href);
 
-  std::string &get_spine_item(int spine_index);
+  std::string get_spine_item(int spine_index);
   int get_spine_item_id(std::string spine_key);
   int get_spine_items_count();
+  // uncompressed size of a spine item - comes with the metadata so it
+  // doesn't touch the zip
+  size_t get_spine_item_size(int spine_index);
 
-  EpubTocEntry &get_toc_item(int toc_index);
+  EpubTocEntry get_toc_item(int toc_index);
   int get_toc_items_count();
   // work out the section index for a toc index
   int get_spine_index_for_toc_index(int toc_index);
+  // the styles from all the book's stylesheets
+  const CssStyleTable &get_styles() const { return m_styles; }
+  // memory used by the spine and toc strings
+  size_t get_string_bytes() const { return m_strings.get_bytes_allocated(); }
 };
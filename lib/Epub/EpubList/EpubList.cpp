@@ -65,36 +65,57 @@ static bool render_cover_image(Renderer *renderer, const EpubListItem &item, int
   auto task_fn = [](void *param) {
     CoverRenderContext *ctx = static_cast<CoverRenderContext *>(param);
     ZipFile zip(ctx->epub_path.c_str());
+    // stored covers are decoded straight from the SD card, anything else
+    // has to be inflated into memory first - without a stream open, so its
+    // inflate window isn't held while the cover is decoded
     size_t cover_size = 0;
-    if (zip.get_file_uncompressed_size(ctx->cover_path.c_str(), &cover_size) &&
-        cover_size > 0 && cover_size <= kMaxCoverBytes)
+    bool stored = false;
+    ZipEntryStream *stream = nullptr;
+    uint8_t *data = nullptr;
+    size_t data_size = 0;
+    if (zip.get_file_info(ctx->cover_path.c_str(), &cover_size, &stored))
     {
-      size_t data_size = 0;
-      uint8_t *data = zip.read_file_to_memory(ctx->cover_path.c_str(), &data_size);
-      if (data && data_size > 0)
+      if (stored)
       {
-        int img_w = 0;
-        int img_h = 0;
-        bool can_render = ctx->renderer->get_image_size(ctx->cover_path, data, data_size, &img_w, &img_h);
-        if (can_render && img_w > 0 && img_h > 0 && ctx->w > 0 && ctx->h > 0)
+        stream = zip.open_stream(ctx->cover_path.c_str());
+      }
+      else if (cover_size > 0 && cover_size <= kMaxCoverBytes)
+      {
+        data = zip.read_file_to_memory(ctx->cover_path.c_str(), &data_size);
+      }
+    }
+    if (stream || data)
+    {
+      int img_w = 0;
+      int img_h = 0;
+      bool can_render = data ? ctx->renderer->get_image_size(ctx->cover_path, data, data_size, &img_w, &img_h)
+                             : ctx->renderer->get_image_size(ctx->cover_path, stream, &img_w, &img_h);
+      if (can_render && img_w > 0 && img_h > 0 && ctx->w > 0 && ctx->h > 0)
+      {
+        float scale_w = static_cast<float>(ctx->w) / static_cast<float>(img_w);
+        float scale_h = static_cast<float>(ctx->h) / static_cast<float>(img_h);
+        float scale = std::min(scale_w, scale_h);
+        int draw_w = std::max(1, static_cast<int>(img_w * scale));
+        int draw_h = std::max(1, static_cast<int>(img_h * scale));
+        int draw_x = ctx->x + (ctx->w - draw_w) / 2;
+        int draw_y = ctx->y + (ctx->h - draw_h) / 2;
+        draw_x += ctx->renderer->get_margin_left();
+        draw_y += ctx->renderer->get_margin_top();
+        ctx->renderer->set_image_placeholder_enabled(false);
+        if (data)
         {
-          float scale_w = static_cast<float>(ctx->w) / static_cast<float>(img_w);
-          float scale_h = static_cast<float>(ctx->h) / static_cast<float>(img_h);
-          float scale = std::min(scale_w, scale_h);
-          int draw_w = std::max(1, static_cast<int>(img_w * scale));
-          int draw_h = std::max(1, static_cast<int>(img_h * scale));
-          int draw_x = ctx->x + (ctx->w - draw_w) / 2;
-          int draw_y = ctx->y + (ctx->h - draw_h) / 2;
-          draw_x += ctx->renderer->get_margin_left();
-          draw_y += ctx->renderer->get_margin_top();
-          ctx->renderer->set_image_placeholder_enabled(false);
           ctx->renderer->draw_image(ctx->cover_path, data, data_size, draw_x, draw_y, draw_w, draw_h);
-          ctx->renderer->set_image_placeholder_enabled(true);
-          ctx->ok = true;
         }
-        free(data);
+        else
+        {
+          ctx->renderer->draw_image(ctx->cover_path, stream, draw_x, draw_y, draw_w, draw_h);
+        }
+        ctx->renderer->set_image_placeholder_enabled(true);
+        ctx->ok = true;
       }
     }
+    free(data);
+    delete stream;
     xSemaphoreGive(ctx->done);
     vTaskDelete(nullptr);
   };
@@ -216,7 +237,7 @@ bool EpubList::load(const char *path)
       }
       vTaskDelay(5);
       Epub epub(state.epub_list[i].path);
-      if (!epub.load_with_task(64 * 1024))
+      if (!epub.load_metadata())
       {
         continue;
       }
@@ -304,8 +325,8 @@ bool EpubList::load(const char *path)
 
       ESP_LOGE(TAG, ">>> Creating Epub object");
       Epub *epub = new Epub(base_path + file.name());
-      ESP_LOGE(TAG, ">>> Calling epub->load_with_task()");
-      if (epub->load_with_task(64 * 1024))
+      ESP_LOGE(TAG, ">>> Calling epub->load_metadata()");
+      if (epub->load_metadata())
       {
         ESP_LOGE(TAG, "  EPUB loaded successfully: %s", file.name());
         strncpy(state.epub_list[state.num_epubs].path, epub->get_path().c_str(), MAX_PATH_SIZE);
@@ -570,11 +591,11 @@ void EpubList::render()
           m_title_blocks[i] = title_block;
         }
         // work out the height of the title
-        int title_height = title_block->line_breaks.size() * renderer->get_line_height();
+        int title_height = title_block->get_line_count() * renderer->get_line_height();
         // center the title in the cell
         int y_offset = title_height < text_height ? (text_height - title_height) / 2 : 0;
         // draw each line of the title making sure we don't run over the cell
-        for (int li = 0; li < title_block->line_breaks.size() && y_offset + renderer->get_line_height() < text_height; li++)
+        for (int li = 0; li < title_block->get_line_count() && y_offset + renderer->get_line_height() < text_height; li++)
         {
           title_block->render(renderer, li, text_xpos, text_ypos + y_offset);
           y_offset += renderer->get_line_height();
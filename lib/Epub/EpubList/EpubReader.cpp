@@ -1,4 +1,6 @@
 #include <string.h>
+#include <limits.h>
+#include <algorithm>
 #ifndef UNIT_TEST
 #include <esp_log.h>
 #include <esp_system.h>
@@ -15,10 +17,60 @@
 #include "EpubReader.h"
 #include "Epub.h"
 #include "../RubbishHtmlParser/RubbishHtmlParser.h"
+#include "../RubbishHtmlParser/PageCache.h"
+#include "BookPages.h"
+#include "../ZipFile/ZipFile.h"
 #include "../Renderer/Renderer.h"
 
 static const char *TAG = "EREADER";
 
+// pages laid out past the one being shown so turning the page doesn't wait
+static const int LAYOUT_LOOKAHEAD_PAGES = 1;
+// how many more pages each call to continue_layout adds
+static const int LAYOUT_CHUNK_PAGES = 4;
+// how many 1K chunks of a section paginate_book parses each time it's called
+static const int BACKGROUND_PARSE_CHUNKS = 8;
+
+// use the page table from the cache if we have one for these settings so
+// we can start laying out at the page we want
+static void load_page_table(Epub *epub, Renderer *renderer, RubbishHtmlParser *parser, int section, int page)
+{
+  PageCache page_cache(BookCache(epub->get_path()));
+  std::vector<PagePosition> pages;
+  if (page_cache.load(section, PageCache::layout_key(renderer), pages) && parser->set_page_table(pages))
+  {
+    ESP_LOGI(TAG, "Cached page table for section %d has %d pages", section, (int)pages.size());
+    parser->seek_layout(page);
+  }
+}
+
+// once a section has been laid out from start to end save where its pages are
+static void save_page_table(Epub *epub, Renderer *renderer, RubbishHtmlParser *parser, int section)
+{
+  std::vector<PagePosition> pages;
+  if (parser->has_page_table() || !parser->get_page_table(pages))
+  {
+    return;
+  }
+  PageCache page_cache(BookCache(epub->get_path()));
+  page_cache.save(section, PageCache::layout_key(renderer), pages);
+  parser->set_page_table(pages);
+}
+
+// the settings have changed - lay the section out again and return the
+// page that now has the text that was at the top of page
+static int relayout_section(Epub *epub, Renderer *renderer, RubbishHtmlParser *parser, int section, int page)
+{
+  // the line the page started with doesn't mean anything once the lines are
+  // broken again, but its first word does
+  TextPosition position;
+  bool have_position = parser->get_page_text_position(page, position);
+  parser->clear_page_table();
+  parser->start_layout();
+  load_page_table(epub, renderer, parser, section, 0);
+  return have_position ? parser->find_page(renderer, epub, position) : 0;
+}
+
 #ifndef UNIT_TEST
 struct FullLayoutContext
 {
@@ -26,6 +78,9 @@ struct FullLayoutContext
   Epub *epub;
   int section;
   bool justified;
+  // the page we want to show and how many pages to lay out
+  int page;
+  int pages;
   RubbishHtmlParser *parser;
   bool ok;
   SemaphoreHandle_t done;
@@ -65,25 +120,82 @@ static void full_layout_task(void *param)
   }
   std::string base_path = item.substr(0, item.find_last_of('/') + 1);
 
-  char *html = reinterpret_cast<char *>(ctx->epub->get_item_contents(item));
-  if (!html)
+  ZipEntryStream *stream = ctx->epub->open_item_stream(item);
+  if (!stream)
   {
     xSemaphoreGive(ctx->done);
     vTaskDelete(nullptr);
     return;
   }
 
-  ctx->parser = new RubbishHtmlParser(html, strlen(html), base_path, ctx->justified);
-  free(html);
+  ctx->parser = new RubbishHtmlParser(stream, base_path, ctx->justified, &ctx->epub->get_styles());
+  delete stream;
   if (ctx->parser)
   {
-    ctx->parser->layout(ctx->renderer, ctx->epub);
+    load_page_table(ctx->epub, ctx->renderer, ctx->parser, ctx->section, ctx->page);
+    ctx->parser->layout_pages(ctx->renderer, ctx->epub, ctx->pages);
     ctx->ok = true;
   }
   xSemaphoreGive(ctx->done);
   vTaskDelete(nullptr);
 }
 
+// carry on laying out a section that's already been parsed
+static void continue_layout_task(void *param)
+{
+  FullLayoutContext *ctx = static_cast<FullLayoutContext *>(param);
+  ctx->parser->layout_pages(ctx->renderer, ctx->epub, ctx->pages);
+  ctx->ok = true;
+  xSemaphoreGive(ctx->done);
+  vTaskDelete(nullptr);
+}
+
+// parse a bit more of a section that's being counted in the background
+static void parse_task(void *param)
+{
+  FullLayoutContext *ctx = static_cast<FullLayoutContext *>(param);
+  ctx->parser->parse_more(BACKGROUND_PARSE_CHUNKS);
+  ctx->ok = true;
+  xSemaphoreGive(ctx->done);
+  vTaskDelete(nullptr);
+}
+
+static void relayout_task(void *param)
+{
+  FullLayoutContext *ctx = static_cast<FullLayoutContext *>(param);
+  ctx->page = relayout_section(ctx->epub, ctx->renderer, ctx->parser, ctx->section, ctx->page);
+  ctx->ok = true;
+  xSemaphoreGive(ctx->done);
+  vTaskDelete(nullptr);
+}
+
+// run one of the layout tasks on its big stack and wait for it to finish
+static void run_layout_task(TaskFunction_t task, FullLayoutContext *ctx)
+{
+  esp_err_t wdt_err = esp_task_wdt_delete(xTaskGetCurrentTaskHandle());
+  bool was_subscribed = (wdt_err == ESP_OK);
+
+  ctx->done = xSemaphoreCreateBinary();
+  const uint32_t stack_words = static_cast<uint32_t>((96 * 1024) / sizeof(StackType_t));
+  if (!ctx->done || xTaskCreatePinnedToCore(task, "epub_layout", stack_words, ctx, 2, nullptr, 1) != pdPASS)
+  {
+    ESP_LOGE(TAG, "Failed to start layout task");
+  }
+  else
+  {
+    xSemaphoreTake(ctx->done, portMAX_DELAY);
+  }
+  if (ctx->done)
+  {
+    vSemaphoreDelete(ctx->done);
+  }
+
+  if (was_subscribed)
+  {
+    esp_task_wdt_add(xTaskGetCurrentTaskHandle());
+  }
+}
+
 static void render_task(void *param)
 {
   RenderTaskContext *ctx = static_cast<RenderTaskContext *>(param);
@@ -108,6 +220,8 @@ EpubReader::~EpubReader()
 {
   delete parser;
   delete next_parser;
+  delete background_parser;
+  delete book_pages;
   delete epub;
 }
 
@@ -131,11 +245,16 @@ bool EpubReader::load()
     renderer->show_busy();
     vTaskDelay(50); // Allow display update
 
-    delete epub;
+    // the parsers can still have streams from the epub open
     delete parser;
     delete next_parser;
+    delete background_parser;
+    delete book_pages;
+    delete epub;
     parser = nullptr;
     next_parser = nullptr;
+    background_parser = nullptr;
+    book_pages = nullptr;
     parser_section = -1;
     next_parser_section = -1;
     // make sure we have a valid path before trying to load
@@ -168,6 +287,12 @@ bool EpubReader::load()
 
     vTaskDelay(20);
 
+    book_pages = new BookPages(BookCache(epub->get_path()), epub->get_spine_items_count());
+    for (int i = 0; i < epub->get_spine_items_count(); i++)
+    {
+      book_pages->set_section_size(i, epub->get_spine_item_size(i));
+    }
+
     ESP_LOGI(TAG, "EPUB loaded successfully");
     ESP_LOGD(TAG, "After epub load: %d", esp_get_free_heap_size());
   }
@@ -234,6 +359,8 @@ void EpubReader::parse_and_layout_current_section()
   ctx->epub = epub;
   ctx->section = state.current_section;
   ctx->justified = use_justified;
+  ctx->page = state.current_page;
+  ctx->pages = state.current_page + 1 + LAYOUT_LOOKAHEAD_PAGES;
   ctx->parser = nullptr;
   ctx->ok = false;
   ctx->done = xSemaphoreCreateBinary();
@@ -274,25 +401,32 @@ void EpubReader::parse_and_layout_current_section()
   std::string base_path = item.substr(0, item.find_last_of('/') + 1);
 
   ESP_LOGI(TAG, "Reading HTML content");
-  char *html = reinterpret_cast<char *>(epub->get_item_contents(item));
-  if (!html)
+  ZipEntryStream *stream = epub->open_item_stream(item);
+  if (!stream)
   {
     ESP_LOGE(TAG, "Failed to read HTML for spine item '%s'", item.c_str());
     return;
   }
-  ESP_LOGI(TAG, "Parsing HTML (%zu bytes)", strlen(html));
+  ESP_LOGI(TAG, "Parsing HTML (%zu bytes)", stream->size());
   delete parser;
-  parser = new RubbishHtmlParser(html, strlen(html), base_path, use_justified);
+  parser = new RubbishHtmlParser(stream, base_path, use_justified, &epub->get_styles());
   parser_section = state.current_section;
-  free(html);
+  delete stream;
 
   ESP_LOGI(TAG, "Laying out page");
-  parser->layout(renderer, epub);
+  load_page_table(epub, renderer, parser, state.current_section, state.current_page);
+  parser->layout_pages(renderer, epub, state.current_page + 1 + LAYOUT_LOOKAHEAD_PAGES);
 #endif
 
-  ESP_LOGE(TAG, "<<< Layout complete, %d pages", parser->get_page_count());
-  ESP_LOGD(TAG, "After layout: %d", esp_get_free_heap_size());
-  state.pages_in_current_section = parser->get_page_count();
+  if (parser)
+  {
+    layout_key = PageCache::layout_key(renderer);
+    save_page_table(epub, renderer, parser, parser_section);
+    record_page_count(parser, parser_section);
+    ESP_LOGE(TAG, "<<< Layout %s, %d pages", parser->is_layout_complete() ? "complete" : "started", parser->get_page_count());
+    ESP_LOGD(TAG, "After layout: %d", esp_get_free_heap_size());
+    state.pages_in_current_section = parser->get_page_count();
+  }
   
 #ifndef UNIT_TEST
   // Re-add to watchdog after layout completes
@@ -304,6 +438,235 @@ void EpubReader::parse_and_layout_current_section()
 #endif
 }
 
+void EpubReader::check_layout_settings()
+{
+  uint32_t key = PageCache::layout_key(renderer);
+  if (key == layout_key)
+  {
+    return;
+  }
+  layout_key = key;
+  // the prefetched section was laid out for the old settings
+  delete next_parser;
+  next_parser = nullptr;
+  next_parser_section = -1;
+  if (!parser || parser_section != state.current_section)
+  {
+    return;
+  }
+  ESP_LOGI(TAG, "Layout settings changed, laying out section %d again", parser_section);
+#ifndef UNIT_TEST
+  FullLayoutContext ctx = {};
+  ctx.renderer = renderer;
+  ctx.epub = epub;
+  ctx.section = parser_section;
+  ctx.page = state.current_page;
+  ctx.parser = parser;
+  run_layout_task(relayout_task, &ctx);
+  state.current_page = ctx.page;
+#else
+  state.current_page = relayout_section(epub, renderer, parser, parser_section, state.current_page);
+#endif
+  state.pages_in_current_section = parser->get_page_count();
+}
+
+void EpubReader::layout_current_section(int page_count)
+{
+  if (!parser || parser_section != state.current_section)
+  {
+    return;
+  }
+  // with a page table from the cache we can jump straight to the page
+  parser->seek_layout(state.current_page);
+  if (parser->is_layout_complete() || parser->get_pages_laid_out() > page_count)
+  {
+    return;
+  }
+#ifndef UNIT_TEST
+  // same big stack as the initial layout
+  FullLayoutContext ctx = {};
+  ctx.renderer = renderer;
+  ctx.epub = epub;
+  ctx.section = parser_section;
+  ctx.pages = page_count;
+  ctx.parser = parser;
+  run_layout_task(continue_layout_task, &ctx);
+#else
+  parser->layout_pages(renderer, epub, page_count);
+#endif
+  state.pages_in_current_section = parser->get_page_count();
+  if (parser->is_layout_complete())
+  {
+    ESP_LOGI(TAG, "Layout complete, %d pages in section %d", parser->get_page_count(), parser_section);
+    save_page_table(epub, renderer, parser, parser_section);
+  }
+  record_page_count(parser, parser_section);
+}
+
+void EpubReader::record_page_count(RubbishHtmlParser *section_parser, int section)
+{
+  if (book_pages && section_parser->is_page_count_known())
+  {
+    book_pages->set_layout_key(layout_key);
+    book_pages->set_section_pages(section, section_parser->get_page_count());
+  }
+}
+
+bool EpubReader::paginate_book()
+{
+  if (!epub || !book_pages)
+  {
+    return false;
+  }
+  // this runs whenever the reader is idle so it has to be cheap once there's
+  // nothing to do - the key is only worked out again when we render
+  uint32_t key = layout_key;
+  if (key == 0)
+  {
+    return false;
+  }
+  book_pages->set_layout_key(key);
+  if (!background_parser && book_pages->is_complete())
+  {
+    return false;
+  }
+  if (background_parser && (background_key != key || book_pages->get_section_pages(background_section) >= 0))
+  {
+    // the settings have changed or the reader got there first
+    delete background_parser;
+    background_parser = nullptr;
+  }
+  if (!background_parser)
+  {
+    int section = book_pages->get_next_unknown_section();
+    if (section < 0)
+    {
+      return false;
+    }
+    // we might have laid out the section before
+    PageCache page_cache(BookCache(epub->get_path()));
+    std::vector<PagePosition> pages;
+    if (page_cache.load(section, key, pages))
+    {
+      book_pages->set_section_pages(section, pages.size());
+      return !book_pages->is_complete();
+    }
+    ESP_LOGI(TAG, "Paginating section %d in the background", section);
+    std::string item = epub->get_spine_item(section);
+    ZipEntryStream *stream = item.empty() ? nullptr : epub->open_item_stream(item);
+    if (!stream)
+    {
+      // don't keep trying a section we can't read
+      ESP_LOGE(TAG, "Failed to paginate section %d", section);
+      book_pages->set_section_pages(section, 0);
+      return !book_pages->is_complete();
+    }
+    background_section = section;
+    background_key = key;
+    background_parser = new RubbishHtmlParser(item.substr(0, item.find_last_of('/') + 1), use_justified, &epub->get_styles());
+    background_parser->start_parse(stream);
+    return true;
+  }
+  if (!background_parser->is_parsed())
+  {
+    // parse the section a few chunks at a time too - it's the slow part
+#ifndef UNIT_TEST
+    FullLayoutContext ctx = {};
+    ctx.renderer = renderer;
+    ctx.epub = epub;
+    ctx.section = background_section;
+    ctx.parser = background_parser;
+    run_layout_task(parse_task, &ctx);
+#else
+    background_parser->parse_more(BACKGROUND_PARSE_CHUNKS);
+#endif
+    return true;
+  }
+#ifndef UNIT_TEST
+  FullLayoutContext ctx = {};
+  ctx.renderer = renderer;
+  ctx.epub = epub;
+  ctx.section = background_section;
+  ctx.pages = background_parser->get_pages_laid_out() + LAYOUT_CHUNK_PAGES;
+  ctx.parser = background_parser;
+  run_layout_task(continue_layout_task, &ctx);
+#else
+  background_parser->layout_pages(renderer, epub, background_parser->get_pages_laid_out() + LAYOUT_CHUNK_PAGES);
+#endif
+  if (background_parser->is_layout_complete())
+  {
+    save_page_table(epub, renderer, background_parser, background_section);
+    record_page_count(background_parser, background_section);
+    delete background_parser;
+    background_parser = nullptr;
+  }
+  return !book_pages->is_complete();
+}
+
+bool EpubReader::get_book_position(int &page_number, int &total_pages)
+{
+  if (!book_pages || !book_pages->is_complete())
+  {
+    return false;
+  }
+  page_number = book_pages->get_page_number(state.current_section, state.current_page);
+  total_pages = book_pages->get_total_pages();
+  return page_number >= 0 && total_pages > 0;
+}
+
+bool EpubReader::get_progress_estimate(int &percent, int &pages_left_in_section)
+{
+  int page_number;
+  int total_pages;
+  if (!book_pages || !book_pages->estimate_position(state.current_section, state.current_page, page_number, total_pages))
+  {
+    return false;
+  }
+  percent = (page_number + 1) * 100 / total_pages;
+  int section_pages = book_pages->estimate_section_pages(state.current_section);
+  if (parser && parser_section == state.current_section)
+  {
+    section_pages = parser->is_page_count_known() ? parser->get_page_count() : std::max(section_pages, parser->get_pages_laid_out());
+  }
+  pages_left_in_section = std::max(0, section_pages - state.current_page - 1);
+  return true;
+}
+
+bool EpubReader::go_to_page(int page_number)
+{
+  int section;
+  int page;
+  if (!book_pages || !book_pages->find_page(page_number, section, page))
+  {
+    return false;
+  }
+  if (section != state.current_section)
+  {
+    delete parser;
+    parser = nullptr;
+    parser_section = -1;
+  }
+  state.current_section = section;
+  state.current_page = page;
+  // render lays out the page - straight from the page table if it's cached
+  return true;
+}
+
+bool EpubReader::continue_layout()
+{
+  if (!parser || parser_section != state.current_section || parser->is_layout_complete())
+  {
+    return false;
+  }
+  layout_current_section(parser->get_pages_laid_out() + LAYOUT_CHUNK_PAGES);
+  return !parser->is_layout_complete();
+}
+
+bool EpubReader::is_page_count_known()
+{
+  return !parser || parser->is_page_count_known();
+}
+
 void EpubReader::prefetch_next_section()
 {
   if (!epub)
@@ -333,15 +696,16 @@ void EpubReader::prefetch_next_section()
     return;
   }
   std::string base_path = item.substr(0, item.find_last_of('/') + 1);
-  char *html = reinterpret_cast<char *>(epub->get_item_contents(item));
-  if (!html)
+  ZipEntryStream *stream = epub->open_item_stream(item);
+  if (!stream)
   {
     return;
   }
 
-  RubbishHtmlParser *p = new RubbishHtmlParser(html, strlen(html), base_path, use_justified);
-  free(html);
+  RubbishHtmlParser *p = new RubbishHtmlParser(stream, base_path, use_justified, &epub->get_styles());
+  delete stream;
   p->layout(renderer, epub);
+  save_page_table(epub, renderer, p, next_section);
   next_parser = p;
   next_parser_section = next_section;
 }
@@ -349,6 +713,8 @@ void EpubReader::prefetch_next_section()
 void EpubReader::next()
 {
   state.current_page++;
+  // we can't tell if this is the end of the section until it's been laid out
+  layout_current_section(state.current_page + 1 + LAYOUT_LOOKAHEAD_PAGES);
   if (state.current_page >= state.pages_in_current_section)
   {
     state.current_section++;
@@ -369,6 +735,12 @@ void EpubReader::prev()
       state.current_section--;
       ESP_LOGD(TAG, "Going to previous section %d", state.current_section);
       parse_and_layout_current_section();
+      // we need to know how many pages there are to go to the last one -
+      // render lays out the page itself
+      if (parser && !parser->is_page_count_known())
+      {
+        layout_current_section(INT_MAX);
+      }
       state.current_page = state.pages_in_current_section - 1;
       return;
     }
@@ -449,6 +821,11 @@ void EpubReader::render()
     return;
   }
 
+  // margins, line spacing or the font might have changed since
+  check_layout_settings();
+  // make sure the page we want (and the one after) have been laid out
+  layout_current_section(state.current_page + 1 + LAYOUT_LOOKAHEAD_PAGES);
+
   ESP_LOGI(TAG, "Rendering page %d of %d", state.current_page, parser->get_page_count());
 
   vTaskDelay(10);
@@ -509,13 +886,18 @@ void EpubReader::set_justified(bool justified)
   if (use_justified != justified)
   {
     use_justified = justified;
-    // Force a re-layout of the current and prefetched sections so
-    // that the new alignment takes effect on the next render.
-    delete parser;
-    parser = nullptr;
-    parser_section = -1;
-    delete next_parser;
-    next_parser = nullptr;
-    next_parser_section = -1;
+    // the lines and pages don't change, the words just move along the lines
+    if (parser)
+    {
+      parser->set_justified(justified);
+    }
+    if (next_parser)
+    {
+      next_parser->set_justified(justified);
+    }
+    if (background_parser)
+    {
+      background_parser->set_justified(justified);
+    }
   }
 }
@@ -3,6 +3,7 @@
 class Epub;
 class Renderer;
 class RubbishHtmlParser;
+class BookPages;
 
 #include "./State.h"
 
@@ -16,10 +17,23 @@ private:
   RubbishHtmlParser *next_parser = nullptr;
   int16_t parser_section = -1;
   int16_t next_parser_section = -1;
+  // page counts for the whole book and the section being counted
+  BookPages *book_pages = nullptr;
+  RubbishHtmlParser *background_parser = nullptr;
+  int16_t background_section = -1;
+  uint32_t background_key = 0;
 
   bool use_justified = false;
+  // the PageCache::layout_key the parsers were laid out with
+  uint32_t layout_key = 0;
 
   void parse_and_layout_current_section();
+  // lay out the current section until it has at least page_count pages
+  void layout_current_section(int page_count);
+  // lay out again if the renderer's settings have changed
+  void check_layout_settings();
+  // let book_pages know how many pages a section has once we know
+  void record_page_count(RubbishHtmlParser *section_parser, int section);
   void prefetch_next_section();
 
 public:
@@ -33,4 +47,18 @@ public:
   void next_section();
   void prev_section();
   void set_justified(bool justified);
+  // lay out a few more pages of the current section while nothing else is
+  // happening - returns true while there's more to do
+  bool continue_layout();
+  // false until the current section has been completely laid out
+  bool is_page_count_known();
+  // once the current section is done, work out how many pages every other
+  // section has a bit at a time - returns true while there's more to do
+  bool paginate_book();
+  // page numbers for the whole book - only once every section is counted
+  bool get_book_position(int &page_number, int &total_pages);
+  // a rough idea of where we are before every section has been counted -
+  // worked out from the size of each section
+  bool get_progress_estimate(int &percent, int &pages_left_in_section);
+  bool go_to_page(int page_number);
 };
\ No newline at end of file
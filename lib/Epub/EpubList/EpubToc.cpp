@@ -194,12 +194,12 @@ void EpubToc::render()
       }
       // work out the height of the title
       int text_height = cell_height - PADDING;
-      int title_height = title_block->line_breaks.size() * renderer->get_line_height();
+      int title_height = title_block->get_line_count() * renderer->get_line_height();
       // center the title in the cell
       int y_offset = title_height < text_height ? (text_height - title_height) / 2 : 0;
       // draw each line of the index block making sure we don't run over the cell
       int height = 0;
-      for (int i = 0; i < title_block->line_breaks.size() && height < text_height; i++)
+      for (int i = 0; i < title_block->get_line_count() && height < text_height; i++)
       {
         title_block->render(renderer, i, 10, ypos + height + y_offset);
         height += renderer->get_line_height();
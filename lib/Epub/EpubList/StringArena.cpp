@@ -0,0 +1,120 @@
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+#include <esp_heap_caps.h>
+#endif
+#include <stdlib.h>
+#include "StringArena.h"
+
+static void *arena_malloc(size_t size)
+{
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+  return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+  return malloc(size);
+#endif
+}
+
+static uint32_t hash_string(const char *str, size_t length)
+{
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < length; i++)
+  {
+    hash ^= static_cast<unsigned char>(str[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+void StringArena::clear()
+{
+  while (m_chunks)
+  {
+    Chunk *next = m_chunks->next;
+    free(m_chunks);
+    m_chunks = next;
+  }
+  free(m_table);
+  m_table = nullptr;
+  m_table_size = 0;
+  m_count = 0;
+  m_bytes_allocated = 0;
+}
+
+char *StringArena::allocate(size_t size)
+{
+  if (!m_chunks || m_chunks->size - m_chunks->used < size)
+  {
+    // anything too big for a normal chunk gets one of its own
+    size_t chunk_size = size > CHUNK_SIZE ? size : CHUNK_SIZE;
+    Chunk *chunk = static_cast<Chunk *>(arena_malloc(sizeof(Chunk) + chunk_size));
+    if (!chunk)
+    {
+      return nullptr;
+    }
+    chunk->size = chunk_size;
+    chunk->used = 0;
+    chunk->next = m_chunks;
+    m_chunks = chunk;
+    m_bytes_allocated += sizeof(Chunk) + chunk_size;
+  }
+  char *result = m_chunks->data() + m_chunks->used;
+  m_chunks->used += size;
+  return result;
+}
+
+bool StringArena::grow_table()
+{
+  uint32_t new_size = m_table_size ? m_table_size * 2 : 256;
+  const char **table = static_cast<const char **>(arena_malloc(new_size * sizeof(const char *)));
+  if (!table)
+  {
+    return false;
+  }
+  memset(table, 0, new_size * sizeof(const char *));
+  for (uint32_t i = 0; i < m_table_size; i++)
+  {
+    const char *str = m_table[i];
+    if (str)
+    {
+      uint32_t slot = hash_string(str, strlen(str)) & (new_size - 1);
+      while (table[slot])
+      {
+        slot = (slot + 1) & (new_size - 1);
+      }
+      table[slot] = str;
+    }
+  }
+  free(m_table);
+  m_bytes_allocated += (new_size - m_table_size) * sizeof(const char *);
+  m_table = table;
+  m_table_size = new_size;
+  return true;
+}
+
+const char *StringArena::intern(const char *str, size_t length)
+{
+  // keep the table at most half full
+  if ((m_count + 1) * 2 > m_table_size && !grow_table())
+  {
+    return nullptr;
+  }
+  uint32_t slot = hash_string(str, length) & (m_table_size - 1);
+  while (m_table[slot])
+  {
+    const char *existing = m_table[slot];
+    if (strncmp(existing, str, length) == 0 && existing[length] == '\0')
+    {
+      return existing;
+    }
+    slot = (slot + 1) & (m_table_size - 1);
+  }
+  char *copy = allocate(length + 1);
+  if (!copy)
+  {
+    return nullptr;
+  }
+  memcpy(copy, str, length);
+  copy[length] = '\0';
+  m_table[slot] = copy;
+  m_count++;
+  return copy;
+}
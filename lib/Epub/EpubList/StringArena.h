@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Storage for the strings that live as long as a book is open (spine and
+// toc hrefs, toc titles and so on). Strings are copied into large chunks
+// rather than each getting their own heap allocation, and identical strings
+// are only stored once - so two interned strings are equal if and only if
+// their pointers are. Nothing is freed until the arena is cleared.
+class StringArena
+{
+private:
+  struct Chunk
+  {
+    Chunk *next;
+    size_t size;
+    size_t used;
+    char *data() { return reinterpret_cast<char *>(this + 1); }
+  };
+  static const size_t CHUNK_SIZE = 4096;
+
+  Chunk *m_chunks = nullptr;
+  // open addressed hash table of everything interned so far
+  const char **m_table = nullptr;
+  uint32_t m_table_size = 0;
+  uint32_t m_count = 0;
+  size_t m_bytes_allocated = 0;
+
+  char *allocate(size_t size);
+  bool grow_table();
+
+  StringArena(const StringArena &) = delete;
+  StringArena &operator=(const StringArena &) = delete;
+
+public:
+  StringArena() {}
+  ~StringArena() { clear(); }
+  void clear();
+  // returns the stored copy of the string - the same pointer every time for
+  // the same contents. Returns nullptr if we've run out of memory.
+  const char *intern(const char *str, size_t length);
+  const char *intern(const char *str) { return intern(str, strlen(str)); }
+  // number of distinct strings
+  uint32_t get_count() const { return m_count; }
+  // memory used by the chunks and the hash table
+  size_t get_bytes_allocated() const { return m_bytes_allocated; }
+};
@@ -0,0 +1,211 @@
+#include <string.h>
+#include <ctype.h>
+#include "Hyphenator.h"
+#include "hyphenationTries.h"
+
+static const int LANGUAGE_COUNT = sizeof(HYPHENATION_PATTERNS) / sizeof(HYPHENATION_PATTERNS[0]);
+
+// decode the next UTF-8 code point and advance the pointer - returns 0 for
+// anything we can't make sense of
+static uint32_t next_codepoint(const uint8_t *&p)
+{
+  uint8_t c = *p++;
+  if (c < 0x80)
+  {
+    return c;
+  }
+  int extra = (c & 0xE0) == 0xC0 ? 1 : (c & 0xF0) == 0xE0 ? 2 : (c & 0xF8) == 0xF0 ? 3 : -1;
+  if (extra < 0)
+  {
+    return 0;
+  }
+  uint32_t codepoint = c & (0x3F >> extra);
+  for (int i = 0; i < extra; i++)
+  {
+    if ((*p & 0xC0) != 0x80)
+    {
+      return 0;
+    }
+    codepoint = codepoint << 6 | (*p++ & 0x3F);
+  }
+  return codepoint;
+}
+
+// the patterns are all lower case - this covers the latin alphabets they're for
+static uint32_t to_lower(uint32_t c)
+{
+  if ((c >= 'A' && c <= 'Z') || (c >= 0xC0 && c <= 0xDE && c != 0xD7))
+  {
+    return c + 0x20;
+  }
+  if (((c >= 0x100 && c <= 0x137) || (c >= 0x14A && c <= 0x177)) && (c & 1) == 0)
+  {
+    return c + 1;
+  }
+  return c;
+}
+
+// compare the language tags ignoring case and treating _ like -, up to the
+// end of the tag or its first subtag
+static bool language_matches(const char *a, const char *b, bool primary_only)
+{
+  for (; *a && *b; a++, b++)
+  {
+    char ca = *a == '_' ? '-' : tolower(*a);
+    char cb = *b == '_' ? '-' : tolower(*b);
+    if (ca != cb)
+    {
+      return false;
+    }
+    if (primary_only && ca == '-')
+    {
+      return true;
+    }
+  }
+  return (*a == 0 || (primary_only && *a == '-')) && (*b == 0 || (primary_only && *b == '-'));
+}
+
+bool Hyphenator::set_language(const char *language)
+{
+  m_patterns = nullptr;
+  for (int i = 0; i < LANGUAGE_COUNT && !m_patterns; i++)
+  {
+    if (language_matches(language, HYPHENATION_PATTERNS[i].language, false))
+    {
+      m_patterns = &HYPHENATION_PATTERNS[i];
+    }
+  }
+  // fall back to any patterns for the same language - "en-GB" gets "en-us"
+  for (int i = 0; i < LANGUAGE_COUNT && !m_patterns; i++)
+  {
+    if (language_matches(language, HYPHENATION_PATTERNS[i].language, true))
+    {
+      m_patterns = &HYPHENATION_PATTERNS[i];
+    }
+  }
+  return m_patterns != nullptr;
+}
+
+int Hyphenator::find_letter(uint32_t codepoint) const
+{
+  int low = 0;
+  int high = m_patterns->alphabet_size - 1;
+  while (low <= high)
+  {
+    int middle = (low + high) / 2;
+    if (m_patterns->alphabet[middle] < codepoint)
+    {
+      low = middle + 1;
+    }
+    else if (m_patterns->alphabet[middle] > codepoint)
+    {
+      high = middle - 1;
+    }
+    else
+    {
+      return middle + 1;
+    }
+  }
+  return 0;
+}
+
+int Hyphenator::hyphenate(const char *word, uint8_t *offsets, int max_offsets) const
+{
+  if (!m_patterns)
+  {
+    return 0;
+  }
+  const HyphenationPatterns &patterns = *m_patterns;
+  // the letter codes with the edges of the word either side
+  uint16_t codes[MAX_WORD_LETTERS + 2];
+  // where each letter starts in the word
+  uint8_t starts[MAX_WORD_LETTERS];
+  int letters = 0;
+  bool finished = false;
+  const uint8_t *start = reinterpret_cast<const uint8_t *>(word);
+  const uint8_t *p = start;
+  while (*p)
+  {
+    if (p - start > 255)
+    {
+      return 0;
+    }
+    uint8_t offset = p - start;
+    uint32_t codepoint = next_codepoint(p);
+    int code = codepoint ? find_letter(to_lower(codepoint)) : 0;
+    if (code)
+    {
+      if (finished || letters == MAX_WORD_LETTERS)
+      {
+        return 0;
+      }
+      starts[letters] = offset;
+      codes[++letters] = code;
+    }
+    else if (codepoint < 0x80 && isalnum(codepoint))
+    {
+      // numbers, or letters the language doesn't have
+      return 0;
+    }
+    else if (letters > 0)
+    {
+      finished = true;
+    }
+  }
+  if (letters < patterns.left_min + patterns.right_min)
+  {
+    return 0;
+  }
+  codes[0] = 0;
+  codes[letters + 1] = 0;
+  int code_count = letters + 2;
+  // the highest value from any pattern for the gap before each code - odd
+  // means we can hyphenate there
+  uint8_t points[MAX_WORD_LETTERS + 3];
+  memset(points, 0, code_count + 1);
+  const uint32_t char_mask = (1u << patterns.char_bits) - 1;
+  const uint32_t link_mask = (1u << patterns.link_bits) - 1;
+  const int value_shift = patterns.char_bits + patterns.link_bits;
+  // follow the trie from every letter - a code of 0 at the root is the start
+  // of the word, so there's no starting from the end
+  for (int i = 0; i < code_count - 1; i++)
+  {
+    uint32_t node = 0;
+    for (int j = i; j < code_count; j++)
+    {
+      uint32_t code = codes[j];
+      uint32_t entry = patterns.trie[node + code];
+      if ((entry & char_mask) != code || entry == 0)
+      {
+        break;
+      }
+      uint32_t value_index = entry >> value_shift;
+      if (value_index)
+      {
+        const uint8_t *values = patterns.values + patterns.value_offsets[value_index];
+        uint8_t *point = points + i + values[0];
+        for (int k = 0; k < values[1]; k++)
+        {
+          if (values[k + 2] > point[k])
+          {
+            point[k] = values[k + 2];
+          }
+        }
+      }
+      node = (entry >> patterns.char_bits) & link_mask;
+      if (!node)
+      {
+        break;
+      }
+    }
+  }
+  int count = 0;
+  for (int letter = patterns.left_min; letter <= letters - patterns.right_min && count < max_offsets; letter++)
+  {
+    if (points[letter + 1] & 1)
+    {
+      offsets[count++] = starts[letter];
+    }
+  }
+  return count;
+}
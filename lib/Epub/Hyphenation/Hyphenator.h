@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+// The compiled patterns for one language - see scripts/generate_hyphenation.py.
+// Each trie entry is the letter it's for, the base of the node it leads to
+// and the values of the pattern that ends there.
+struct HyphenationPatterns
+{
+  const char *language;
+  // the letters the patterns use in codepoint order - a letter's code is its
+  // index plus one, code zero is the edge of the word
+  const uint16_t *alphabet;
+  uint16_t alphabet_size;
+  const uint32_t *trie;
+  uint32_t trie_size;
+  uint8_t char_bits;
+  uint8_t link_bits;
+  // the first slot, count and values of each pattern
+  const uint8_t *values;
+  const uint16_t *value_offsets;
+  // the fewest letters that can be left before and after a hyphen
+  uint8_t left_min;
+  uint8_t right_min;
+};
+
+// Finds where words can be hyphenated using Liang's algorithm and the TeX
+// patterns for the book's language
+class Hyphenator
+{
+public:
+  // longer words are left alone
+  static const int MAX_WORD_LETTERS = 48;
+
+private:
+  const HyphenationPatterns *m_patterns = nullptr;
+
+  int find_letter(uint32_t codepoint) const;
+
+public:
+  // picks the patterns for a language tag like "en-GB" or "de" - returns
+  // false and turns hyphenation off if we haven't got any
+  bool set_language(const char *language);
+  bool is_enabled() const { return m_patterns != nullptr; }
+  const char *get_language() const { return m_patterns ? m_patterns->language : ""; }
+  // the fewest bytes a word needs before it's worth looking up
+  int get_min_word_length() const { return m_patterns ? m_patterns->left_min + m_patterns->right_min : 0; }
+  // fills in the byte offsets in the word where a hyphen can go and returns
+  // how many there are. Punctuation around the word is skipped, anything
+  // else that isn't a letter means the word isn't hyphenated.
+  int hyphenate(const char *word, uint8_t *offsets, int max_offsets) const;
+};
@@ -0,0 +1,7985 @@
+#pragma once
+
+// generated by scripts/generate_hyphenation.py - do not edit
+
+#include <stdint.h>
+#include "Hyphenator.h"
+
+// de-1996: 23390 patterns, 0 exceptions
+//
+// Copyright (c) 2013-2017
+// Stephan Hennig, Werner Lemberg, Guenter Milde, Sander van Geloven,
+// Georg Pfeiffer, Gisbert W. Selke, Tobias Wendorf
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+static const uint16_t HYPH_DE_1996_ALPHABET[] = {
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+    0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xdf, 0xe0, 0xe1, 0xe2, 0xe4, 0xe7, 0xe8, 0xe9, 0xea, 0xeb,
+    0xed, 0xf1, 0xf3, 0xf4, 0xf6, 0xfc,
+};
+static const uint32_t HYPH_DE_1996_TRIE[] = {
+    0xa80, 0x1501, 0x1f82, 0x2a03, 0x3404, 0x3e85, 0x4906, 0x5387,
+    0x5e08, 0x6889, 0x6e8a, 0x740b, 0x7e8c, 0x890d, 0x938e, 0x9e0f,
+    0xa890, 0x1d1, 0xb312, 0xbd93, 0xc814, 0xd295, 0xdd16, 0xe797,
+    0xf218, 0xfc59, 0x1041a, 0x10e9b, 0x280a455, 0x49d, 0x51e, 0x1191f,
+    0x40000e, 0xe21, 0x11fa2, 0xde3, 0xea4, 0x1025, 0xfa6, 0xf27,
+    0x400014, 0x125e9, 0x12c6a, 0x132c1, 0x13802, 0x1bc3, 0xe2c4, 0x13bc5,
+    0xf6c6, 0x14107, 0x2548, 0x142c9, 0x104a, 0x136cb, 0x1434c, 0x147cd,
+    0x1490e, 0x14d0f, 0x14a50, 0x400003, 0x14f12, 0x153d3, 0x15614, 0x15995,
+    0x1b16, 0x15c17, 0x1298, 0x1419, 0x15eda, 0x40000d, 0x40000e, 0x400010,
+    0x200000e, 0x1a1f, 0x400012, 0xcc00014, 0x40000c, 0x140000f, 0x15152, 0xd000005,
+    0x23f8f, 0x26081, 0x38f49, 0x25e9, 0x18ea, 0x16201, 0x416742, 0x17003,
+    0x4174c4, 0xc17a05, 0x17e06, 0x418447, 0x189c8, 0x190c9, 0x401c4a, 0x1968b,
+    0x19d8c, 0x1a34d, 0x1ad8e, 0x1c0388f, 0x41b710, 0x27182, 0x1bd12, 0x1c453,
+    0x101ca94, 0x81d555, 0x4120d6, 0x1001257, 0x402fd8, 0x1416f59, 0x1012e5a, 0x401cdb,
+    0x19f81, 0x23f05, 0x30101, 0x40001f, 0x400020, 0xd00000d, 0xd430405, 0xd81c3c8,
+    0xd839d85, 0x3db81, 0x26ad2, 0x2838f, 0x27d14, 0x1800029, 0x100002a, 0x1dc41,
+    0x3802e42, 0x1000003, 0x3002f84, 0x1e2c5, 0x3001e06, 0x24026c7, 0x1801e88, 0x201e909,
+    0x380268a, 0x300000b, 0x281ed0c, 0x100000d, 0x3c03bce, 0x1f24f, 0x2402810, 0x1000011,
+    0x2c1f7d2, 0x101f993, 0x381a894, 0x1d015, 0x1000016, 0x4000017, 0x1f381, 0x3402499,
+    0x240285a, 0x11c0001f, 0xd4297c5, 0xd400004, 0x11c00001, 0x1ff9f, 0x23849, 0x3f3c5,
+    0xd048f85, 0x41c01, 0x11800010, 0x26d0c, 0x25f8f, 0xd800013, 0x11c43385, 0x3ae9,
+    0x452a, 0x4420481, 0x400002, 0x1c03043, 0x4c029c4, 0x20905, 0x400006, 0x400007,
+    0x820e88, 0x21689, 0x40000a, 0x821bcb, 0x4c0584c, 0x4c04dcd, 0x7c0000f, 0x442244f,
+    0x1c00010, 0x1000011, 0x4814f52, 0x1c0eb93, 0x3804d94, 0x4415d95, 0x7c3c745, 0x400017,
+    0x3b081, 0x2000019, 0x40001a, 0x3a7c5, 0x8c00005, 0x3f1cc, 0x400005, 0x5002f1f,
+    0x40789, 0x13046748, 0x2000022, 0x3f192, 0x8c00013, 0x3af0f, 0xdc00015, 0xd400013,
+    0x2800028, 0x22981, 0x24062c2, 0x1c03903, 0x5c14304, 0x2022f85, 0x5400006, 0x18045c7,
+    0x180e108, 0x2023509, 0x100000a, 0x240000b, 0x5c1c58c, 0x580000d, 0x600454e, 0x23a8f,
+    0x5806fd0, 0x1000011, 0x2c23fd2, 0x1024413, 0x1024ad4, 0x2025015, 0x1800016, 0x3804717,
+    0xd800006, 0x4404d19, 0x600001a, 0x5000009, 0x7c00008, 0xec00002, 0x8c6a70e, 0x254df,
+    0x3ef81, 0x1c00006, 0x434b90, 0xd400013, 0x400012, 0x10834893, 0x3e954, 0x104438c,
+    0xd43fd09, 0x407969, 0x59ea, 0x1025a81, 0x426002, 0x263c3, 0x4268c4, 0x1c27045,
+    0x427586, 0x427bc7, 0x28108, 0x28909, 0x640000a, 0x428e0b, 0x293cc, 0x429b8d,
+    0x2a2ce, 0x702aa8f, 0x42afd0, 0x6c00011, 0x2b512, 0x2bf93, 0x42c654, 0x2ce55,
+    0x4079d6, 0x40a517, 0x2d518, 0x6803819, 0x42391a, 0x100469b, 0x1c00002, 0x1400003,
+    0x4d2c1, 0x780001f, 0x11c00005, 0x45247, 0x5bac5, 0xd4549c1, 0xd450209, 0x82645,
+    0x400026, 0x55ec5, 0x6c6c9, 0x7400029, 0x7c0002a, 0x202db01, 0x5c05002, 0x1004f03,
+    0x8004644, 0x202e145, 0x382e746, 0x60050c7, 0x6000008, 0x202ecc9, 0x1004e8a, 0x840524b,
+    0x4c2f0cc, 0x6005a8d, 0x58058ce, 0x202f2cf, 0x8800010, 0x1000011, 0x4c2f552, 0x382fb53,
+    0x3830094, 0x20305d5, 0x1000016, 0x3800017, 0x7c00005, 0x5b59, 0x381765a, 0x14c4b509,
+    0x700000c, 0x6bec1, 0xa00000e, 0x203095f, 0x7c00008, 0x6c445, 0x2000022, 0x56393,
+    0x70605, 0x1140000f, 0x6e2c1, 0x4b8d5, 0x7c00015, 0x20083e9, 0x2008eaa, 0x30fc1,
+    0x2415e02, 0x1000003, 0x1c31504, 0x31cc5, 0x3005986, 0x3821647, 0x1025748, 0x32249,
+    0x100000a, 0x940000b, 0x8c327cc, 0x180000d, 0x43328e, 0x33a4f, 0x8000010, 0x1000011,
+    0x2c2f992, 0x9033f93, 0x1026a14, 0x315d5, 0x1000016, 0x1000017, 0x4da45, 0x5919,
+    0x5805b1a, 0x1c58242, 0x4c849, 0x75f41, 0x6fc89, 0x60df, 0x400001, 0x78989,
+    0xdc4908f, 0x81f45, 0x500000e, 0x82b81, 0x81dd0, 0x5834e, 0x2049c15, 0x9829,
+    0x16a2a, 0x34701, 0x8006542, 0x1000003, 0x8005c84, 0x34dc5, 0x8007046, 0x8006687,
+    0x1806148, 0x35449, 0x100000a, 0x24085cb, 0x70359cc, 0x1035c0d, 0x1c360ce, 0x3688f,
+    0x8000010, 0x400011, 0x7036f52, 0x7037693, 0x38378d4, 0x37e15, 0x10064d6, 0x9809017,
+    0x4c485, 0x9899, 0x100e9da, 0x1000010, 0x85d4f, 0x83692, 0x82c81, 0x1fe5f,
+    0x2800015, 0x2000021, 0x836c5, 0x85441, 0x8d9c9, 0x4400013, 0xa1b85, 0x85285,
+    0x4ca55, 0x44181a9, 0x81b42a, 0x438341, 0x10388c2, 0x1c32903, 0x438c84, 0x39445,
+    0x1c39986, 0x1039f47, 0x103a248, 0x8c27649, 0x40628a, 0x103a60b, 0x3adcc, 0x3b4cd,
+    0x3bace, 0x103c0cf, 0x3c790, 0x1000011, 0x3ccd2, 0x3d2d3, 0x3d914, 0x580a1d5,
+    0x102d356, 0x1000017, 0x10129d8, 0x83e141, 0x383deda, 0x40665b, 0xa80cf, 0x32c05,
+    0x51701, 0x1c0acdf, 0x87881, 0x13a89, 0x7c00015, 0xa86c1, 0x84645, 0x70a96c1,
+    0x400026, 0x3e68f, 0x84c49, 0xabe9, 0x9c0002a, 0x8520c, 0x5188f, 0x83e9d5,
+    0x1000016, 0x203eec1, 0x880b682, 0x6400003, 0x8000004, 0x3f405, 0x8800006, 0x5807b47,
+    0x2406bc8, 0x3fa49, 0x640000a, 0x240710b, 0x283fc4c, 0x100718d, 0x4c26a8e, 0x204044f,
+    0x1800010, 0x6400011, 0x4c40992, 0x7040bd3, 0x3840e14, 0x41615, 0x6400016, 0x1007b17,
+    0x83381, 0x8c00004, 0x5807bda, 0x8c00006, 0x9868fc5, 0x7c00001, 0xa7cc1, 0x200c11f,
+    0x69ac9, 0x1605800c, 0xa7d05, 0x80000e, 0xadd45, 0xc43c5, 0x69a4f, 0x11400012,
+    0x58293, 0x2008469, 0x200c2ea, 0x41b41, 0x3842182, 0x1011483, 0x3842544, 0x2042d05,
+    0x383ff06, 0x1043287, 0x5808648, 0x20437c9, 0x6c0000a, 0x1043d4b, 0x384424c, 0x1044a0d,
+    0x701eece, 0x2044f4f, 0x1019310, 0x1000011, 0x580da52, 0x3845453, 0x3845a54, 0x46215,
+    0x1816b56, 0x6c00017, 0x1c00018, 0x2038ed9, 0x104661a, 0x9800006, 0x200001c, 0x800006,
+    0x87601, 0x46c9f, 0x100000b, 0x380000c, 0x87e45, 0x40000c, 0x7000005, 0xc2e09,
+    0x7c00008, 0x74b92, 0xb3649, 0x2047269, 0xcfaa, 0x2047941, 0x181b082, 0x1c08603,
+    0x1045884, 0x2048005, 0x2408586, 0x1800007, 0x2400008, 0x2048609, 0x100000a, 0x8408c4b,
+    0x5c2b9cc, 0x1048b0d, 0x5807c0e, 0x204930f, 0x3849850, 0x1000011, 0x5800012, 0x3849a53,
+    0x1049c94, 0x204a315, 0x1008d56, 0x1813157, 0x1c00002, 0xa013cd9, 0x180001a, 0x7c0000e,
+    0x7c00029, 0x8db01, 0x756c8, 0x204a55f, 0xc83cf, 0x8fd05, 0x2000022, 0xcc881,
+    0xd40000e, 0x8e649, 0xd9305, 0x11cccb85, 0x8c00012, 0x2035b29, 0x202a56a, 0x204abc1,
+    0x8811d82, 0x1024983, 0x384b144, 0x204b905, 0x104bfc6, 0x384c507, 0x6009188, 0x204ccc9,
+    0x100000a, 0x384d0cb, 0x580a68c, 0x181e8cd, 0x384b30e, 0x204db8f, 0x8818390, 0x1000011,
+    0xa427d52, 0x384e113, 0x384e7d4, 0x204efd5, 0x180ae96, 0x6400017, 0x8c00006, 0x1ce19,
+    0x384f55a, 0xd800001, 0xe27d2, 0xd400015, 0x40000c, 0x204fa1f, 0x8d48c, 0xa00000d,
+    0xa000022, 0x40000f, 0xa08e9d0, 0xe6681, 0xa000014, 0x5000014, 0x9800014, 0x39a69,
+    0x1a72a, 0x584ff41, 0x4504c2, 0x1c50b03, 0x450544, 0x1810905, 0x50e46, 0x104d607,
+    0x51388, 0x1c423c9, 0x100914a, 0x1048bcb, 0x1c5194c, 0x1c51f0d, 0x5244e, 0x472cf,
+    0x52b10, 0x1000011, 0x53192, 0x53a53, 0x1054114, 0x54515, 0x40e316, 0x1011357,
+    0x435358, 0xa359, 0x5818a1a, 0x1c0badb, 0x194a8e4d, 0xd40000e, 0xe82c5, 0x40001f,
+    0x400020, 0x6b785, 0x9eb53, 0xcf301, 0x40000f, 0x74f09, 0x400026, 0xd0f05,
+    0x12c00013, 0x1800029, 0x100002a, 0x54bc1, 0x1000002, 0x6400003, 0x1809a04, 0x552c5,
+    0x55806, 0x5809607, 0x2055dc8, 0x56589, 0x100000a, 0x180958b, 0x482bc0c, 0x580000d,
+    0x180000e, 0x4456a4f, 0x1056f90, 0x69b9f, 0x4c574d2, 0x1029b13, 0x1057594, 0x2057d95,
+    0x1000016, 0x1009c97, 0x740000b, 0xa809859, 0x180001a, 0x40000e, 0xf5705, 0xd3745,
+    0x740000d, 0x202c89f, 0xa4913, 0x400010, 0x2000022, 0xd4a6452, 0x7c0000c, 0x4b0614,
+    0x780000f, 0xd3b0f, 0xf5a81, 0xc469, 0xccaa, 0x58441, 0x3858b42, 0x700f803,
+    0x3858f04, 0x2059985, 0x385a086, 0x385a647, 0x9c5aa48, 0x205b289, 0x100000a, 0x385b68b,
+    0x105bccc, 0x385c28d, 0x705c7ce, 0x5d20f, 0x5c5cad0, 0x1000011, 0x105d752, 0x385dd53,
+    0x385e294, 0x205e7d5, 0x100ae56, 0x1013757, 0x3800018, 0x2012119, 0x105ed5a, 0x40001b,
+    0xfbb4f, 0xa6b8f, 0xd800006, 0x5f25f, 0x400020, 0x102389, 0x2000022, 0xa6a95,
+    0xe13c5, 0x2000025, 0x7d0640f, 0xd800019, 0xdf589, 0x5f7a9, 0x200d92a, 0x205fd01,
+    0x880c642, 0x2060383, 0x601f844, 0x20608c5, 0x880b246, 0x880d087, 0x1060e48, 0x2061609,
+    0x640000a, 0x1861bcb, 0x1846bcc, 0x580ee8d, 0x5818a4e, 0x206268f, 0xb062d90, 0x1000011,
+    0x880e5d2, 0xb4632d3, 0x463ad4, 0x2064555, 0x600b656, 0x100cfd7, 0x1400003, 0xac10819,
+    0x186495a, 0xade8d, 0xae48e, 0xe6d02, 0x8c00003, 0x206501f, 0xd4ae652, 0xaf6d3,
+    0x2000022, 0xae70e, 0xf6081, 0x2000025, 0x113245, 0xa0ae752, 0xf3585, 0x20467e9,
+    0x205916a, 0x2065581, 0x881b382, 0x3822103, 0x9412044, 0x2065c45, 0xc000006, 0x5c1c407,
+    0x466288, 0x2066a89, 0x100000a, 0x880000b, 0x602604c, 0x8815f4d, 0x880da8e, 0x206714f,
+    0x800b910, 0x1000011, 0xb867752, 0x1c68013, 0x3868554, 0x2068d55, 0x5c0b8d6, 0x6c0cf17,
+    0x2000006, 0xbc17d59, 0x1060eda, 0x400001, 0x200001c, 0x21000001, 0x1ce720c, 0x206921f,
+    0x1cbf602, 0xbf583, 0x17400004, 0xf7d01, 0x6cfbe45, 0x1077c9, 0x1cc1548, 0xf64c5,
+    0x104049, 0x2064b69, 0x1c5ab6a, 0x1c697c1, 0x104f4c2, 0x70280c3, 0x1043304, 0x1069c85,
+    0x6a186, 0x106a6c7, 0x467888, 0x1c620c9, 0x40000a, 0x6aa8b, 0x46b30c, 0x6ba0d,
+    0x146bfce, 0x1c3704f, 0x6c590, 0x400011, 0x6cad2, 0x1c6d213, 0x106d954, 0x800e255,
+    0x240c5d6, 0x400017, 0x1014ed8, 0xce99, 0x1015f9a, 0x100d4db, 0x1cf28c2, 0xf5983,
+    0x10400015, 0x1501f, 0xb9d41, 0x11c00001, 0xf4cc8, 0x8c00005, 0xbc405, 0x101045,
+    0x8c00003, 0xf308d, 0xf2e4e, 0xf8a9, 0x740002a, 0x6e141, 0x1000002, 0x1000003,
+    0x1800004, 0xb06e685, 0x2400006, 0x1000007, 0x1000008, 0x6ec89, 0xba695, 0x100000b,
+    0x181010c, 0x100da0d, 0x180000e, 0x203a04f, 0x1000010, 0x4dc01, 0x8c1a912, 0x1c2e453,
+    0x1000014, 0x114d5, 0x1000016, 0x1000017, 0x24801, 0x8c00001, 0x100001a, 0x111e06,
+    0x70945, 0xe01c5, 0xd400029, 0x700000f, 0x1a8c9, 0x1cdf4c9, 0xdd12a8d, 0xd400015,
+    0xf9ec1, 0x7c00015, 0x41f0f, 0x1c0000f, 0xfedc5, 0xdb69, 0x100002a, 0x86f201,
+    0x180e082, 0x1000003, 0x1000004, 0x6f6c5, 0x1a799, 0x1000007, 0x14188, 0x86fb49,
+    0x8c00001, 0x100000b, 0x100000c, 0x100000d, 0x1c0e98e, 0x341cf, 0x1000010, 0x8c00001,
+    0x80ead2, 0x38197d3, 0x100eed4, 0x3a895, 0x2800006, 0x1000017, 0x780000f, 0x800009,
+    0x100001a, 0x118f13, 0x7c0000f, 0xfb041, 0x8ee95, 0x83fd9f, 0x7800017, 0xf8145,
+    0xfa3a9, 0xfa46a, 0x4fed4, 0xf8209, 0xd400009, 0xd800001, 0x11ab81, 0x1dbe9,
+    0x202aa, 0x470101, 0x2400002, 0x1c16e03, 0x380f104, 0x206d5c5, 0x3800006, 0x1000007,
+    0x1000008, 0x70449, 0x100000a, 0x180f14b, 0xc412a8c, 0x100000d, 0x100000e, 0x185cf,
+    0x380f510, 0x400011, 0x1000012, 0x6000013, 0x38709d4, 0x2023e15, 0x1c00016, 0x1000017,
+    0x1cd85, 0x1c13559, 0x100001a, 0x11a88f, 0x29509, 0x4e7b85, 0x8c00004, 0x1cecc,
+    0xec7c8, 0x400009, 0x1cfcf, 0x80000b, 0x40000c, 0x40000b, 0xd800013, 0x11bec8,
+    0x1d6d5, 0x1800029, 0x70ec1, 0x400002, 0x40f9c3, 0x9c0fe84, 0x4687c5, 0x7400006,
+    0x416b07, 0x40ff08, 0xc800009, 0x40000a, 0x7414acb, 0x43b58c, 0x18a8d, 0x1ed8e,
+    0x4c74f, 0x10712d0, 0x400011, 0x453c92, 0x71813, 0x74334d4, 0xff55, 0x400016,
+    0x400017, 0x22000005, 0x400019, 0x741099a, 0x7d1bd12, 0x114849, 0xd400012, 0x7400012,
+    0x1071f, 0x71d41, 0x8813842, 0x6400003, 0x5819d44, 0x722c5, 0x8810bc6, 0x8010c07,
+    0x1811588, 0x72849, 0x100000a, 0x840000b, 0x181574c, 0x18115cd, 0x580000e, 0x72dcf,
+    0x8800010, 0x1000011, 0x6000012, 0x8438a53, 0x1045594, 0x1473315, 0x1000016, 0x8c73717,
+    0xd78c4, 0x14999, 0x382579a, 0x11e1c5, 0xe40000c, 0xd00000d, 0xecfbd8e, 0x8c6ae9f,
+    0x400014, 0x280000d, 0xd7b4e, 0x1f800013, 0x11edc5, 0x11ed85, 0x7c00012, 0x1b4d7f13,
+    0xf8d9d14, 0x285a9, 0x19baa, 0x8000001, 0x2400002, 0x1000003, 0x1800004, 0x2073985,
+    0x2400006, 0x5811e07, 0x1000008, 0x2028d09, 0x100000a, 0x800000b, 0x101218c, 0x100000d,
+    0x180000e, 0x581110f, 0x1800010, 0x400011, 0x5811812, 0x8015b53, 0x1016914, 0x18f95,
+    0x1000016, 0x1000017, 0xdff05, 0x7c00001, 0x180001a, 0x800008, 0x7c00009, 0xd400013,
+    0xd1162c5, 0x100001f, 0xc0e08, 0x11f305, 0x11fb45, 0x80000b, 0x7c0000c, 0x11eec9,
+    0x11710d, 0x7c0000f, 0x800015, 0x1800029, 0x240002a, 0x400001, 0x416502, 0x1ca43,
+    0x424104, 0x1012245, 0x50f86, 0x473ec7, 0x74288, 0x1c15709, 0x40000a, 0x41fecb,
+    0x7484c, 0x747cd, 0x74dce, 0x1768f, 0x2e690, 0x2000011, 0x75452, 0x3c553,
+    0x44814, 0x75c15, 0x400016, 0xce205, 0x2000018, 0x121b45, 0x40001a, 0x412edb,
+    0x400002, 0x400003, 0xfe901, 0x200001f, 0x8c44881, 0x414047, 0x400008, 0x8c00003,
+    0x38c45, 0xd400029, 0x41444c, 0x121a85, 0x1c00009, 0x40000f, 0x400010, 0xd800019,
+    0x400012, 0x400013, 0x7400014, 0x7400015, 0x400016, 0x800012, 0xfea55, 0xf1113,
+    0x740001a, 0x425142, 0x418203, 0x421344, 0x400005, 0x2016086, 0x41b847, 0x30448,
+    0x1a7c9, 0x8c00018, 0x277cb, 0x8761cc, 0x414b0d, 0x2ffce, 0x14160cf, 0x1c1e090,
+    0x800001, 0x76852, 0x75693, 0x429d54, 0x9fd05, 0x7400016, 0x400017, 0x7c00005,
+    0x7c00009, 0x416b9a, 0x41939b, 0x2059442, 0x1c19a83, 0x31744, 0x8c17e85, 0x76c86,
+    0x42c447, 0x771c8, 0xc83d881, 0xd400014, 0x740000b, 0x5008c, 0x2a98d, 0x1c5eece,
+    0x124905, 0x1f9d0, 0x8c00009, 0x77712, 0x36653, 0x1c48d54, 0xd4c7841, 0x400016,
+    0xec0000f, 0x7c0001f, 0xc9945, 0x40001a, 0x100001b, 0x4a082, 0x7800015, 0x17204,
+    0xd000005, 0x17346, 0x2ad07, 0x3f89a, 0x17709, 0xa000000, 0x1868b, 0x3d70c,
+    0x18b4d, 0x77c0e, 0xdc00015, 0x1bf10, 0x32c41, 0x3dc92, 0x1d913, 0x2d654,
+    0x64255, 0x1a3c1, 0xf6945, 0xd400018, 0x1ea09, 0x21ec5, 0x11e405, 0x1f14c,
+    0xa000013, 0x19e09, 0x24d4f, 0x8c00001, 0xf50cf, 0x1f192, 0xd800013, 0x1cb8f,
+    0x1ed55, 0x1b302, 0xf1095, 0x1b104, 0xc84c1, 0x18b15, 0x1b3c7, 0x1b908,
+    0x4bf09, 0x19119, 0x20a4b, 0x4150c, 0x1b94d, 0xdc2bd0e, 0xd000014, 0x1180000c,
+    0x8c00016, 0x6b7d2, 0x24a13, 0x1bc94, 0xdc2a515, 0x29dc1, 0xec00013, 0x1c4d8,
+    0xd400004, 0x58945, 0xd400009, 0x11e8ea, 0xd800001, 0x7c00001, 0x27dc1, 0xd800009,
+    0x1dd4c, 0x7c00005, 0x2e9c5, 0x1dd0f, 0x7c00008, 0x7c0000f, 0x2d809, 0xd800013,
+    0x1eb4d, 0xdc4e1ce, 0x1e38f, 0x11c0000f, 0x2ae8f, 0x1df52, 0x20813, 0x1e894,
+    0x51bc1, 0xd41e716, 0x21595, 0xd400004, 0x2f085, 0x203c1, 0xd400015, 0x121181,
+    0x30a09, 0x25a05, 0x22641, 0x7c0001f, 0xd40000d, 0x2cb09, 0x25345, 0xd800006,
+    0x11c405, 0xd800008, 0x12164c, 0x1f90f, 0x1f095, 0x20641, 0x24702, 0x280000c,
+    0x2648f, 0x1fc15, 0x20b06, 0x21492, 0xd400013, 0x372c1, 0x11800013, 0x8c00013,
+    0x8c00005, 0x3e785, 0x1204e745, 0x2021f, 0x21190, 0x227c9, 0x2f952, 0x21dd3,
+    0xdc00014, 0xd400004, 0x8c0000f, 0x3b18f, 0x4af0f, 0x40000d, 0x2121a, 0x11800014,
+    0x436c1, 0x2dd55, 0x22243, 0x8c00013, 0x53645, 0x400015, 0xd400019, 0x22bc8,
+    0x26b49, 0x36341, 0x22b0b, 0x2101f, 0x7c0001f, 0x76dc5, 0x229cf, 0x26950,
+    0xd800008, 0x39749, 0x11f805, 0xd825d14, 0x23155, 0x219a9, 0x236aa, 0x4070f,
+    0xd400002, 0x40000d, 0x27512, 0xd8266d3, 0x23646, 0x22f55, 0x121a41, 0x123293,
+    0x121e43, 0x241c1, 0x23ccc, 0xd03230d, 0x6c80e, 0x57685, 0x7c00019, 0x1c00001,
+    0x5bc92, 0x24849, 0x27d94, 0x8c00005, 0x26141, 0x76145, 0x100bc1, 0x2490f,
+    0x28e45, 0xd400009, 0x1010c5, 0x113ac5, 0x290c9, 0x25295, 0xec00010, 0x7648f,
+    0x124e06, 0x4bc13, 0x427a82, 0x1428403, 0x10184f, 0x1150cf, 0x500000c, 0x288c7,
+    0x2f315, 0x77419, 0x26e17, 0x28bcb, 0x28d8c, 0x1132d7, 0x74294ce, 0x125a94,
+    0x1180001a, 0x400011, 0xe077ed2, 0x2000013, 0x3be94, 0x6400015, 0x1c3d581, 0x2bcc2,
+    0xf80000c, 0x2000004, 0x78105, 0x2000006, 0x2029a47, 0x2000008, 0x1c33689, 0x8c00013,
+    0x200000b, 0x147840c, 0x1c00002, 0x200000e, 0x1c4974f, 0x121d49, 0xd000001, 0x504d592,
+    0x457d3, 0x2c1d4, 0x1c2cf55, 0xd125e45, 0x2000017, 0xd51c2c9, 0x1c29fd9, 0xa00001a,
+    0x8c0000c, 0x7c0000c, 0x18800012, 0xd000013, 0x142ad5f, 0x400005, 0x103b441, 0x5000012,
+    0x400008, 0x6400001, 0x38e05, 0x1400003, 0x40000c, 0x2eb05, 0x1c00029, 0x1c0002a,
+    0x78a08, 0x1000009, 0x3980d, 0x67a0b, 0x100000c, 0x127cc5, 0x7c0002a, 0x2a38f,
+    0xd43a2d3, 0x5000014, 0x8c00015, 0x1c00000, 0x79181, 0x1c00015, 0x1400003, 0x2000004,
+    0x6f945, 0x1c00006, 0x8c00001, 0x7000008, 0x702c5c9, 0xa00000a, 0x73645, 0x2b0cc,
+    0x2f70d, 0x25000014, 0x2d8cf, 0x1c00010, 0x1c00011, 0x2ab92, 0xe82c3d3, 0xe42e1d4,
+    0x40000e, 0x2000016, 0x8c00002, 0x82b4c3, 0x8c00004, 0x11800013, 0x73cd5, 0xd400013,
+    0x8c00017, 0x8c00009, 0x440001f, 0x80000b, 0x6d0cc, 0x8c0000d, 0x1800001, 0xec0000f,
+    0x8c00010, 0x1c42741, 0x2d6d2, 0x345d3, 0xd000002, 0x1c37c45, 0x2f9c6, 0x800017,
+    0x8c00018, 0x1c30a89, 0x8c00029, 0x400009, 0xf02b40c, 0xa106910, 0x1c00000, 0x1c3110f,
+    0xd400013, 0x8c907c3, 0x5ea52, 0x64d53, 0x79294, 0x2b755, 0xcc8fe48, 0xd1441,
+    0x124fc8, 0x1c00000, 0x1c55601, 0x124e4b, 0xd800006, 0xdc56284, 0x5adc5, 0x1c2c19f,
+    0x2cf87, 0x14090053, 0x308c9, 0x1c00004, 0x23400005, 0xf43844c, 0x1c0000d, 0x8c3e84e,
+    0xd0b92, 0xd1393, 0x1c2c9ea, 0x43dd2, 0x1c4e2d3, 0x1c2da94, 0x1c2df55, 0x1c00000,
+    0x42ea01, 0x400012, 0xf8541, 0x2800001, 0x10400c5, 0xe16c5, 0x128054, 0x2800005,
+    0x742e589, 0x70df1c9, 0xfb189, 0x5a78c, 0x3210d, 0x4e80e, 0x2f38f, 0xdf64f,
+    0xf82cf, 0x7032852, 0xd91d610, 0x3ce14, 0x400015, 0x1280d0, 0x1400017, 0x128a53,
+    0x400019, 0x127d94, 0x500001a, 0x1c00000, 0xfc2ef41, 0x1c2e6c2, 0x40001f, 0x2edc4,
+    0x1002f185, 0xd82fdc6, 0xfc00007, 0x100000d, 0x12284e, 0xb9dc1, 0x3038b, 0x6040c,
+    0xf800029, 0x703a78e, 0x8c00006, 0x126045, 0xd8c4708, 0x2fd52, 0x38993, 0xd800014,
+    0xd800014, 0x34d56, 0x1c00000, 0x79781, 0x1c00002, 0x1c00003, 0x1c00004, 0x104ea85,
+    0xd800014, 0x7c00015, 0x126094, 0x3830ec9, 0x8c00005, 0x302cb, 0xf03160c, 0x7800008,
+    0x311ce, 0x1c0000f, 0x780000b, 0xba79f, 0x1032452, 0x1c31953, 0x79914, 0x445d15,
+    0x1b000002, 0xa000003, 0x1264c8, 0x8c00014, 0x2031a5a, 0x12660b, 0x11e6c1, 0x479f01,
+    0x7a442, 0x700001f, 0x54304, 0x1c7a645, 0x31c86, 0x53fc7, 0x11e709, 0x1c32d09,
+    0x1217d2, 0x5e20b, 0x6110c, 0x33e4d, 0x6c0002a, 0x6decf, 0x39b90, 0x12848f,
+    0x32492, 0x59f93, 0x7ab94, 0x47b0d5, 0xd528994, 0x1c00000, 0x8c78581, 0x7000019,
+    0x3ab9a, 0x128713, 0x7aa05, 0x1c00006, 0xdc0001f, 0x43b81f, 0x4a689, 0x128588,
+    0x1c0000b, 0x1c0000c, 0x62e0d, 0x3288e, 0xa000000, 0x77690, 0x1b000002, 0x10432429,
+    0x987b5d3, 0x7b814, 0x1c32cd5, 0x41f81, 0x128415, 0x400001, 0x125647, 0x11c00005,
+    0x128cc5, 0x114d45, 0xf800008, 0x7c42949, 0x1c0001f, 0x11400009, 0xd4c92, 0xa000013,
+    0x2000014, 0x26000013, 0x1255d3, 0x40000f, 0x2843112, 0xd400013, 0x800029, 0x7bdc1,
+    0x2033fc2, 0x33303, 0x729c4, 0x1c7c345, 0x207c506, 0x7cb07, 0x2000008, 0x587cf49,
+    0x1c0000a, 0x7d34b, 0x2032ecc, 0x3478d, 0x7038e, 0x7d44f, 0x33790, 0xc1a85,
+    0x2033352, 0x7b393, 0x7d954, 0x1c33c55, 0x1280002a, 0x2034357, 0x28c038c, 0xfe301,
+    0x7dd9a, 0x128d45, 0x9b6c2, 0xfe1c5, 0xc800012, 0x3425f, 0xd400006, 0xc1d55,
+    0x90f08, 0x128d95, 0xfe5cc, 0xc0499, 0x7000000, 0x1c00001, 0xd40000f, 0x1000029,
+    0x40002a, 0x37c05, 0x839ec6, 0xd000013, 0x34fc8, 0x1c00009, 0x125285, 0xfe4d9,
+    0xf04780c, 0xd528ec5, 0x8c0000e, 0x3518f, 0x35550, 0xf80000c, 0x1c35312, 0x35a53,
+    0x10c00014, 0x6400015, 0x2540000d, 0xf800012, 0x1c00000, 0x47e581, 0x207e782, 0xbc35e83,
+    0x5b544, 0x7ecc5, 0x365c6, 0x5c247, 0x1c00008, 0x1c7f089, 0x800022, 0x716cb,
+    0x3614c, 0x5754d, 0x433ce, 0x47f54f, 0x1c361d0, 0xd400013, 0x1c413d2, 0x52b93,
+    0x7fa14, 0x1c36ad5, 0x1c00016, 0x36497, 0x128150, 0x1c00019, 0x7fa9a, 0x25000013,
+    0x1287c1, 0xff601, 0x1c80101, 0x40001f, 0x37643, 0x7d01205, 0x6c80605, 0x7c556c1,
+    0x128b49, 0x36308, 0x558c9, 0x7c4fe85, 0x367cb, 0x10400029, 0x80002a, 0x50689,
+    0x8008f, 0x1044c110, 0x2800012, 0x500000d, 0x80793, 0x80b94, 0x1c386d5, 0x26c00014,
+    0x36d97, 0x5000013, 0x39419, 0x7080fc1, 0x7000002, 0x8c00003, 0x400005, 0x814c5,
+    0x836c5f, 0x122988, 0x7f288, 0x6c63e09, 0x40000b, 0x1289c7, 0x3cb8c, 0xa043f0d,
+    0x2000000, 0x3c3cf, 0x800029, 0x80002a, 0x7d992, 0x7fcd3, 0x81a14, 0x3b415,
+    0x2000008, 0x128893, 0x12990c, 0x43a43, 0x6a8da, 0xec00005, 0x8c00006, 0x40000f,
+    0x129612, 0x3795f, 0x2000012, 0x2000013, 0x4318c, 0x535cd, 0x5710e, 0x2000017,
+    0x129895, 0x129752, 0x85c52, 0x7c9d3, 0x7c0002a, 0x1c00000, 0x11000001, 0x1c3e282,
+    0x7000003, 0x38ac4, 0x1c46585, 0x81c06, 0x1c7bf07, 0x5000008, 0x683cd89, 0x1c0000a,
+    0x36dcb, 0x4814c, 0x708200d, 0x708214e, 0x140000f, 0xe837cd0, 0x128602, 0xe83e052,
+    0x82753, 0x82cd4, 0x1c00015, 0x1c38116, 0x1c00017, 0x1c00018, 0x129b53, 0x1c3f71a,
+    0x3885b, 0xa000000, 0x2000003, 0x79b82, 0x42143, 0x59344, 0x129d01, 0x1000006,
+    0x128754, 0x3a288, 0x39909, 0x118c8c, 0x86a10b, 0x6a48c, 0x1042b0d, 0x8320e,
+    0x129e0c, 0x118dd2, 0x27400005, 0x83652, 0xa057c93, 0x3d294, 0x83915, 0x400005,
+    0x125906, 0x7400018, 0x3a699, 0x2000000, 0xa0435c1, 0xa03ba02, 0xbc3bbc3, 0x43d84,
+    0x49f85, 0xd83bf46, 0x1183cac7, 0x3dbc8, 0x83cc9, 0x125693, 0xa00000b, 0xa0840cc,
+    0x204084d, 0x208430e, 0x140000f, 0x3da50, 0x12a40e, 0x84a52, 0x3485013, 0xa041414,
+    0x44495, 0xa000016, 0x11400017, 0x5800018, 0x7c00001, 0x1140001a, 0x1203e3c2, 0x8c00003,
+    0xcf2c5, 0x4ea05, 0xd400008, 0x2740000f, 0x11c00009, 0xd800005, 0xd52a381, 0x4b2cb,
+    0xa0781cc, 0x3e90d, 0x80cce, 0xec0000f, 0x1c00000, 0x83b81, 0x3ef12, 0xa05cc93,
+    0x74414, 0x885505, 0x27c0000d, 0x11c785, 0xb6301, 0x85709, 0x1180001a, 0xd400004,
+    0x78b66c5, 0x1180000b, 0x7c0001f, 0x84568f, 0xb6a89, 0x1051da8f, 0x12a4c1, 0x12a681,
+    0x25000013, 0x4d015, 0x283fe81, 0x7441042, 0x8c40303, 0x11800004, 0xdc40fc5, 0x1041706,
+    0xb6e15, 0x42788, 0x41589, 0x4d55f, 0x400019, 0x44b4c, 0x12acd4, 0x6834e,
+    0x4268f, 0x400010, 0x129a4c, 0x85b52, 0x4b193, 0xa051054, 0xa00002a, 0x1c00000,
+    0x85cc1, 0x114418d8, 0xf4081, 0x129cd5, 0x86285, 0x40002a, 0xf4485, 0x5d801,
+    0x76289, 0x7c49803, 0xf4b49, 0x849c5, 0x400005, 0x126f86, 0x61fcf, 0x43c49,
+    0x400009, 0x4444b, 0xcc0000c, 0x2800012, 0x82f55, 0x5f74f, 0x4f510, 0x127010,
+    0x12b054, 0xd400013, 0x8c86694, 0x42255, 0x122d81, 0x8f1c4, 0xa04715f, 0x8f606,
+    0x45e9a, 0x3400003, 0x11400004, 0x26c00013, 0x8f5cb, 0x469df, 0x1000008, 0x51231cc,
+    0x12400029, 0xa0420ea, 0x80000c, 0x8f392, 0x8fc13, 0xf800012, 0x95055, 0x800029,
+    0x43e52, 0x800013, 0x2000008, 0x44e95, 0xd8446c2, 0x8c00003, 0xd40000c, 0xec00005,
+    0xd00000e, 0x11800007, 0x1400008, 0x12b1d3, 0x119b92, 0x12abce, 0x5178c, 0xa00000d,
+    0x1c45ace, 0xd400001, 0x46010, 0xd12ac14, 0x619d2, 0x46293, 0x465d4, 0x1c00003,
+    0x2046844, 0x46a45, 0x1c00006, 0x12c00019, 0xd000013, 0x1447089, 0x25000005, 0x1c0000b,
+    0x46a8c, 0xd400005, 0x48e0e, 0xd40000f, 0xd000014, 0x12910c, 0xbc47392, 0x47613,
+    0x2047854, 0x1400015, 0x7000000, 0x86a01, 0x1c00002, 0x1c00003, 0x1c00004, 0x870c5,
+    0x1c00006, 0x1c00007, 0x1c00008, 0x7a149, 0x1c0000a, 0x1c0000b, 0x13447d8c, 0x13c0000d,
+    0x13447c0e, 0xcc7b00f, 0x1c00010, 0x12aec5, 0x13874f92, 0x704c453, 0x1c47a94, 0x87315,
+    0x1c00016, 0x7000017, 0x125085, 0x2000019, 0x1c0001a, 0x12b815, 0xd1251c9, 0x26c0000f,
+    0x200001e, 0x483df, 0x78e01, 0x47c81, 0x2000022, 0x1400003, 0x11c794c5, 0x480c5,
+    0x124b93, 0x25c0000f, 0x2000015, 0x4cfa9, 0x700002a, 0x8c7f74c, 0x4898c, 0xf80000e,
+    0x4c64e, 0x12a793, 0x12a994, 0x2800012, 0xd400013, 0x14000013, 0x2000014, 0x7000000,
+    0x14877c1, 0x1c00002, 0x1c00003, 0x1c00004, 0x2087b05, 0x1c00006, 0x1c00007, 0x1c00008,
+    0x2052549, 0xd400013, 0x1c0000b, 0xf00000c, 0x1c0000d, 0xf00000e, 0x14448c0f, 0x1c00010,
+    0x128645, 0xf000012, 0x7066453, 0x1c4fb94, 0x2054715, 0x1c00016, 0x1c00017, 0x12880c,
+    0x2000019, 0x1c0001a, 0xd000013, 0x12b354, 0x107948, 0x128852, 0x140001f, 0xcc0000b,
+    0x7c0000c, 0x26d2bd88, 0xa000001, 0xfe80f, 0x8c49e03, 0x14851dc4, 0x7c00012, 0x4a0c6,
+    0x11800029, 0x1c0002a, 0xd84a349, 0x26c00002, 0x4a44b, 0x5414c, 0xa04a38d, 0x4a74e,
+    0x12b6c1, 0x4ad10, 0x12b743, 0x6e452, 0x4acd3, 0x52654, 0xa000000, 0x1400001,
+    0x107d9c2, 0x44f6c3, 0x450b84, 0x12b292, 0x450a86, 0x44fcc7, 0x51288, 0x69709,
+    0x25000001, 0x4bd0b, 0x74e0c, 0xa06eb4d, 0x8814e, 0x12be89, 0x1051f90, 0x7000011,
+    0x887d2, 0x12c63253, 0x84cd4, 0x88d95, 0x12bbd5, 0xa000017, 0x400018, 0x5ec41,
+    0x1544cc02, 0x1457383, 0x52d04, 0x15000005, 0x56306, 0xd44d407, 0x82b48, 0x4890c9,
+    0x12bf43, 0x4c88b, 0x8948c, 0x896cd, 0x89b8e, 0x551cf, 0x648d0, 0x12c792,
+    0x8a152, 0x8a713, 0xd460f94, 0x6fc15, 0x4dbd6, 0x8c52c01, 0x537d8, 0xa064103,
+    0x5ca84, 0x8c81805, 0xa000006, 0xa054e47, 0xdc00002, 0x12b9c3, 0x2512c405, 0x4ed0b,
+    0x4ef4c, 0x54d8d, 0x8ae0e, 0x75dcf, 0x1004f790, 0x7800001, 0x86b12, 0x8ad53,
+    0x8b314, 0x6a985, 0x10c00016, 0x15800001, 0x450802, 0x7c6a889, 0x1180001a, 0x129d4e,
+    0x450c46, 0x129ed0, 0x1000008, 0x8c6af8f, 0xd800013, 0x26000002, 0x53b8c, 0x5818d,
+    0x5248e, 0x1400001, 0x55890, 0x8c00017, 0x8b7d2, 0x8b913, 0x56cd4, 0x50b55,
+    0x8bb81, 0x512d7, 0xd400018, 0x8c0001f, 0x8bfc5, 0x800001, 0x180000e, 0x6400008,
+    0x7c8c689, 0x121cc5, 0x12c80e, 0xed1b613, 0x12a44e, 0x1227c9, 0x8cb4f, 0x12c8c8,
+    0x27400012, 0x73d41, 0x7000002, 0x58ec3, 0x5c395, 0x8d0c5, 0x800012, 0x8c00013,
+    0x55e48, 0x589c9, 0xd400013, 0x56b8b, 0x705260c, 0xdc00001, 0x5b75f, 0x59e8f,
+    0x8d550, 0x2512ae85, 0x26c00002, 0xd800013, 0xd48d4d4, 0x561d5, 0xd800005, 0xcaf01,
+    0x51d69, 0x5d9aa, 0x5291a, 0xcba05, 0x885c1, 0x129705, 0xcc688, 0x59e1f,
+    0x52b45, 0x80000b, 0x26928a92, 0x86ef88, 0x128bd4, 0xca5cf, 0x2512c952, 0xd000002,
+    0xd000010, 0x800029, 0x15c58b8f, 0x11c00015, 0x129b94, 0x50533d2, 0xd456993, 0xd800014,
+    0x577d5, 0x55d41, 0x53682, 0x53343, 0x7c00019, 0x12a610, 0x8c53ec6, 0x12a6d2,
+    0x1000008, 0x1400009, 0x124b45, 0x544cb, 0x54c0c, 0x8da8d, 0x8c8dece, 0x5484f,
+    0xd400003, 0x8d24d8c, 0xd48e212, 0x55853, 0x7c00029, 0x7c0002a, 0xa000003, 0xf800012,
+    0xec00013, 0x12b40c, 0x1000007, 0x1000008, 0x12cb12, 0x7000000, 0x8c79801, 0x7922341,
+    0x5704d, 0x5968e, 0x8c7a845, 0x1000010, 0x1c00011, 0x57192, 0x7afc9, 0x121bc9,
+    0x18578d5, 0x140000c, 0x12ad02, 0x1c00018, 0x7c7e082, 0x8c00003, 0x5a3c4, 0x18400012,
+    0xd47b213, 0x8c5a0c7, 0x800015, 0x121615, 0x1400017, 0x5850b, 0x7ed4c, 0xd05e04d,
+    0x6d00e, 0x12bec5, 0x12ae52, 0xd400013, 0x706d2, 0x6dcd3, 0x820d4, 0x66f15,
+    0x800016, 0x1c5aac1, 0x1fd00441, 0x12bd4f, 0x12a0c6, 0x8e705, 0x2908045, 0x8c00029,
+    0x1c00008, 0x1c00009, 0x1fd01d49, 0x12a30d, 0x1c7724c, 0x12c988, 0xd80000c, 0x1c5ac8f,
+    0x6400001, 0x12a093, 0x1c58a12, 0xe489913, 0x6400005, 0x1c5a495, 0x100515, 0x8ea08,
+    0x459d89, 0x58c19, 0x285c88b, 0x100000c, 0x27400001, 0x12b48b, 0x1c0000f, 0x58f9f,
+    0x27400005, 0x7c00012, 0x1400013, 0x1c00014, 0x8c00001, 0x12b013, 0x12bd01, 0x5a184,
+    0x8c87a45, 0x59269, 0x11c00029, 0xb9e01, 0x8c71489, 0x7c81985, 0x12bf89, 0x7cbaa05,
+    0x507fd08, 0x7880bc9, 0x780000f, 0xa9ac9, 0x12bc87, 0x5a512, 0x8efd3, 0x7c0000f,
+    0x5a455, 0xb640f, 0x2800012, 0x8c00013, 0x1285a999, 0x2512cd05, 0x12ced3, 0x7cb1115,
+    0xd00000c, 0x12bad4, 0xfc00001, 0x5af42, 0x1461303, 0x85cfc4, 0x11800005, 0x5ba86,
+    0xd800007, 0xaa1df, 0x45df89, 0x26c00005, 0x8c00029, 0x5ed8c, 0x7eb4d, 0x48f20e,
+    0x500000f, 0x85b450, 0x7c0002a, 0x8f6d2, 0x16478613, 0x8e414, 0x12c00015, 0x67d81,
+    0x85bfd7, 0x7400018, 0xfc00001, 0x1c8f7c5, 0x72fc6, 0x12c609, 0x400005, 0x1c67bc9,
+    0x7c00007, 0x5000008, 0x1c62b8c, 0x12c1cf, 0x400005, 0x580000f, 0x40000d, 0x7c0000e,
+    0x1c6ab12, 0xd45cb13, 0x5de94, 0x1c5c1d5, 0x9c96bd3, 0x5096e54, 0x2400000f, 0x8c00005,
+    0x5ee41, 0x5000012, 0x8c00013, 0xd800004, 0x7c84f05, 0x1c5c31f, 0xd13c1, 0xd400001,
+    0x1c00009, 0x12a742, 0xd3805, 0x1c5f64c, 0xd400008, 0x85e44e, 0x5cdcf, 0x12a508,
+    0x1c0002a, 0x5f0d2, 0x8fc53, 0x5d454, 0x5fc15, 0x108a601, 0x1400003, 0xd400013,
+    0xd000012, 0x48b285, 0x12a7d3, 0x113148, 0x400009, 0x105d689, 0x10fa4b, 0x40000c,
+    0x6eccc, 0x1c6060d, 0x1c5dc8e, 0x106058f, 0xd1d9f, 0x7400005, 0x8fe92, 0xd45e8d3,
+    0xe863454, 0x1060bd5, 0x12c88c, 0x1400017, 0x9800006, 0x400019, 0xd18a9, 0xd242a,
+    0xd800012, 0x100000b, 0x52188c, 0x40001f, 0x1c0000e, 0x11000001, 0x64f82, 0xcc61b83,
+    0x8843c4, 0x148c545, 0x69486, 0x90287, 0x705f488, 0x5d729, 0x45e5aa, 0x6c00b,
+    0x89080c, 0x8808d, 0x90b4e, 0x1180000f, 0x145fb50, 0x8c00012, 0x1c64352, 0x910d3,
+    0x891314, 0x7800001, 0xd460196, 0x122447, 0x2000004, 0x8c79545, 0x617da, 0x580000b,
+    0x100000c, 0x100000d, 0x100000e, 0x400014, 0x780000c, 0x12c9cc, 0x280000e, 0x785ff8f,
+    0xd52cac5, 0x12cb53, 0x6400012, 0x60093, 0x1c7ca94, 0x6460255, 0x12cbd5, 0x7800017,
+    0x491841, 0x12cc0e, 0x200001a, 0x1c6e604, 0x91dc5, 0x73c06, 0x61cc7, 0x1c0001f,
+    0x88f89, 0x129505, 0x1c602cb, 0x921cc, 0x6144d, 0x1c0000e, 0x1c8f10f, 0xfc00010,
+    0x12994c, 0x129f82, 0x81253, 0x73894, 0x10888d5, 0x129fc6, 0x800013, 0xd400013,
+    0x1c61819, 0x70fda, 0xa000001, 0x12a04c, 0x7000000, 0xe5441, 0x100001f, 0x8ddc1,
+    0x6a082, 0x12a2d2, 0x62304, 0x1c923c5, 0xe5508, 0xe5749, 0x1b400001, 0x92809,
+    0x1c61b69, 0x40002a, 0x126005, 0x6390d, 0xe5690, 0x78c8f, 0x62190, 0xd800013,
+    0x8e8114, 0x7b693, 0xfc00014, 0x62d15, 0x129bcd, 0x114e4e19, 0xe5cda, 0xf800012,
+    0xd525bd3, 0x125e14, 0x27929c13, 0xd800014, 0x892d41, 0x1c65e9f, 0x63383, 0x932c4,
+    0x93585, 0x5065986, 0x93b87, 0xd800014, 0x1c93fc9, 0x800029, 0x6990b, 0x1c00002,
+    0x1c0002a, 0x78ece, 0x945cf, 0x25800007, 0x12d8ce, 0xa0cab08, 0x94753, 0x94bd4,
+    0x10468715, 0xc988c, 0x61e97, 0xa00000e, 0x16800019, 0x7e35a, 0x25800012, 0x800001,
+    0xd000014, 0xa0c9ad4, 0x10461ddf, 0x126dc5, 0x16c66582, 0x1463803, 0x63d84, 0x126e89,
+    0x400006, 0x11800007, 0x400008, 0x12e105, 0x10638a9, 0x4629ea, 0x6634c, 0xd40000d,
+    0x94fce, 0x140000f, 0x642d0, 0x10400015, 0x48ced2, 0x12c67593, 0x64a14, 0x64a55,
+    0x9869301, 0x12a907, 0xd80000e, 0x12de15, 0x64d05, 0x17000006, 0xd800012, 0x8c00012,
+    0x953c9, 0xd400015, 0x8c00015, 0x6518c, 0x1c00009, 0x12aa13, 0x6fe8f, 0x7cc50,
+    0x12a9d6, 0x1c00012, 0x65613, 0x65b14, 0x7c65715, 0x1495841, 0x6d342, 0x1466243,
+    0x95f04, 0x96105, 0x7a3c6, 0x94ec7, 0xcc6e3c8, 0x1c96689, 0x8c0000b, 0x9698b,
+    0x71c4c, 0xd47bbcd, 0x7e48e, 0x96d4f, 0x5000010, 0x400015, 0x76692, 0x97353,
+    0x93cd4, 0x1c97615, 0x5000003, 0x667d7, 0x7c00005, 0x5000006, 0x6689a, 0xf800012,
+    0x1c00000, 0xa0e6241, 0x500000b, 0x49231f, 0x12cdc1, 0xe6545, 0x7c0000f, 0x5000010,
+    0x1293c4, 0xe6149, 0x5000013, 0x129387, 0x12ce09, 0x82d69, 0x66a2a, 0x97a81,
+    0x1c67602, 0x6aec3, 0x2500000e, 0x97f85, 0x1c00006, 0x64e39d5, 0x1c6f508, 0x1c75b09,
+    0x27529694, 0x980cb, 0x500000c, 0x1c0000d, 0x12d485, 0x70e4f, 0x98490, 0xa00001f,
+    0x1c00012, 0x98753, 0x98c54, 0x89c95, 0x1040000e, 0xf000017, 0x8d26845, 0x7c00019,
+    0x50677da, 0xa000012, 0x98fc1, 0x1c00002, 0x12ddc5, 0xf80000c, 0x6498945, 0x80000e,
+    0x1c00007, 0x8c991c8, 0x72209, 0x5000014, 0x11926453, 0x184e61c3, 0xa0e6dc4, 0x7800029,
+    0x1c7290f, 0x500001a, 0x12db13, 0x1c7f7d2, 0x8a393, 0x995d4, 0x688d5, 0x12ad43,
+    0x1c67dd7, 0xd800005, 0x678d9, 0x1c679da, 0xa000012, 0xa000013, 0xe8a94, 0x12ad8b,
+    0x684df, 0x27400012, 0x12c00001, 0xfc00002, 0x1c68783, 0x1c71504, 0x72bc5, 0x7074946,
+    0x97407, 0x5000008, 0x69249, 0x7c0002a, 0xac6894b, 0x7c38c, 0x109984d, 0x901ce,
+    0x12c0000f, 0x1469010, 0x80000d, 0x80e52, 0x80513, 0x91294, 0xb3b41, 0x1400012,
+    0xa000012, 0x1c00018, 0xb65c5, 0x7759a, 0x1c00000, 0x7aac1, 0x9fc89, 0x1c00003,
+    0x1c00004, 0x85645, 0x25c00001, 0x7c00000, 0x9e80f, 0x492789, 0x25000005, 0x800012,
+    0x500000c, 0xd800008, 0xa8715, 0x12a883, 0xa000010, 0x8c00002, 0xd400006, 0x1c00013,
+    0x99a94, 0x1c69bd5, 0x2980000f, 0xd800012, 0x1040001f, 0x6400019, 0xd899f02, 0x6b0c3,
+    0x78f84, 0x6b685, 0x8c00008, 0x4400010, 0x6cc08, 0x6bf09, 0x12a8d6, 0x85d0b,
+    0x998cc, 0x6b58d, 0x9a40e, 0x12b706, 0x1800010, 0x12b7c8, 0x89a892, 0x7fe13,
+    0x7c75654, 0x769d5, 0x12400016, 0x12b90e, 0x6c398, 0xa000000, 0x6c841, 0x8c0001b,
+    0x8c6cfc3, 0x6cf84, 0x77085, 0x12ea4e, 0x29400005, 0x74908, 0x77949, 0xd000008,
+    0x1740000b, 0x8724c, 0x795cd, 0x9ab0e, 0x8c00003, 0xa06d410, 0x8c00005, 0x9af52,
+    0x6f893, 0x86714, 0x6dc15, 0x400001, 0xa000017, 0x1000018, 0x9a741, 0xa00001a,
+    0x123706, 0x8c00010, 0x9b405, 0xd800006, 0x2740000e, 0x116c14, 0x7c5c9, 0x8c0000c,
+    0x12a541, 0x9a10c, 0x123890, 0x780001a, 0x6d24f, 0x123853, 0x12a947, 0x7d4d2,
+    0x83e93, 0xd400014, 0x6d815, 0xa000000, 0x715c1, 0x12a80e, 0x8c0000e, 0xd46db04,
+    0x78645, 0x40000d, 0x40000e, 0x80000f, 0x2800014, 0x400000, 0x9b68b, 0x89b98c,
+    0x6db8d, 0x9bc0e, 0x8c6df8f, 0x1c00000, 0x8c001, 0x8c7f352, 0x930d3, 0x89414,
+    0x289bf05, 0x6ea96, 0xd400013, 0x6f398, 0x852c9, 0x476982, 0x12ac8c, 0x12cc83,
+    0x12ac4e, 0x1800006, 0x9be0f, 0x12ccc7, 0x2b00000e, 0x12aa53, 0x9c941, 0x7280c,
+    0x8c915, 0x9c30e, 0x9ce05, 0x1000010, 0x12cd90, 0x9c3d2, 0x9d2c9, 0x701d4,
+    0x4400012, 0x1400013, 0x8135f, 0x8c00018, 0x9524f, 0xa000009, 0xd400001, 0xa2a41,
+    0xd800001, 0x12b184, 0x7c70815, 0xa2f45, 0x7c71e29, 0xcc6f4aa, 0x9cd01, 0xa33c9,
+    0x7c8dd83, 0x7000015, 0x985c5, 0xed2df0c, 0x7381f, 0xa358f, 0x71049, 0xa000002,
+    0x70c4b, 0x2512b214, 0xd400013, 0xa37d5, 0x16479c4f, 0x90150, 0x70b29, 0x7c0002a,
+    0xfc00013, 0x8c9d414, 0x7be55, 0x9d681, 0x8c00005, 0x8b11f, 0x7c00019, 0x9dbc5,
+    0x7d25349, 0x1400012, 0xf871b88, 0x7c7bc89, 0x7135f, 0x12580e, 0x7c00000, 0x7eea9,
+    0x81fea, 0xd48824f, 0x8d25993, 0x5000005, 0x899d2, 0x1409df53, 0x525045, 0x7a815,
+    0x800014, 0x720d7, 0xa000003, 0x12ed8b, 0x1187229a, 0x1252cc, 0xa000007, 0x800008,
+    0x2000015, 0x7219f, 0x7230b, 0x125392, 0x40000d, 0x9e14e, 0x400015, 0x10400004,
+    0x1400003, 0x886f12, 0x72a13, 0xa000014, 0x7c0002a, 0x73e88, 0xd400006, 0x12e1c5,
+    0x80000d, 0x73f8c, 0x7345b, 0x26c0000b, 0x12ab0c, 0x12e44b, 0x1c00011, 0x7ae92,
+    0x74213, 0x74354, 0x74c55, 0x12ab53, 0x27800014, 0x1c00018, 0xd400014, 0xa000000,
+    0x7511b, 0x9e3c2, 0x1400003, 0x8d044, 0xd400005, 0x75746, 0x76187, 0xf800003,
+    0x400001, 0x12ee0e, 0x1477e4b, 0x9e78c, 0x9674d, 0x9ecce, 0xdc00013, 0x76f50,
+    0x1400011, 0x9f392, 0x8c9f4d3, 0x8ec54, 0x9f995, 0x49c701, 0x12e3d2, 0xdc00013,
+    0x9e8c1, 0x9e045, 0x1400003, 0x81b84, 0x8c83445, 0x1800006, 0x24400001, 0x1000008,
+    0x87589, 0x2800009, 0x126745, 0x47b84f, 0x82c4d, 0xa468e, 0x17800012, 0x11800013,
+    0xd800014, 0x8e492, 0x8c9f193, 0x8c9ac94, 0xfc0000f, 0x5000008, 0xa000005, 0x5000012,
+    0x11800013, 0xfc00014, 0xd400015, 0x17c0001f, 0x11800001, 0x8aa02, 0x1477e83, 0xd800004,
+    0x12c80c45, 0x9f646, 0x79fc7, 0x783c8, 0x9fdc9, 0x400029, 0x7878b, 0xa008c,
+    0xd48f50d, 0xa03ce, 0x7f80f, 0x18000010, 0xd800012, 0xa0912, 0x12ca0f13, 0x9a0d4,
+    0x7ced5, 0x12ebc5, 0x78817, 0x5c00018, 0x7b703, 0x25000001, 0xa1305, 0x7ba06,
+    0x7b587, 0x25000005, 0x7000001, 0x130941, 0x7ca4b, 0x7c40c, 0x7cd8d, 0xa10ce,
+    0x7f6cf, 0x5000015, 0x2800009, 0x2500000f, 0x7d013, 0x815d4, 0x7d595, 0x7000000,
+    0xa17c1, 0x5000002, 0xdc00001, 0x8c00013, 0x2ca1d45, 0x7c00001, 0x1192eb85, 0x1400003,
+    0xa2209, 0x929c5, 0x5000009, 0x25c00009, 0xadf48, 0x492c09, 0xa270f, 0x9ad0b,
+    0x49350c, 0x8ca2901, 0x1c00013, 0x12a3c2, 0x49ca55, 0x12f0d4, 0x1c00017, 0x8c00007,
+    0x11400019, 0x11c00015, 0xd400009, 0xa348b, 0x132cc1, 0x12a5cc, 0x7d71f, 0x1140000c,
+    0x8c00010, 0x13028d, 0x13050e, 0xa3693, 0xb6ad4, 0x12a714, 0x5000016, 0x5000017,
+    0x86469, 0xa07db2a, 0x1c00000, 0x4ca0781, 0x1c00002, 0x1c00003, 0x1c00004, 0x8c91505,
+    0x1c00006, 0x1c00007, 0x1c00008, 0x9b7c9, 0x5000008, 0x1c0000b, 0x1c0000c, 0x1c0000d,
+    0x11e5c5, 0x88a04f, 0x1c00010, 0x291e248, 0x1c00012, 0x1c00013, 0x1c00014, 0x1c7dcd5,
+    0x1c00016, 0x1c00017, 0x1291e14f, 0x800019, 0x1c0001a, 0x1b400012, 0x700000c, 0x5000014,
+    0x12cc4e, 0x1140001f, 0x287e3c1, 0x4866c2, 0x1400012, 0x12cf93, 0xa800014, 0x1800006,
+    0x1c00007, 0x1687e4c8, 0x147ea49, 0x1c00015, 0x80002a, 0x822cc, 0x1c00029, 0x848ce,
+    0xd40000f, 0x8fcd0, 0x130781, 0x8ac52, 0x1408d3d3, 0x82514, 0xa000015, 0xa3c81,
+    0x1318c1, 0x789d883, 0x1400019, 0xd4a1705, 0x7f106, 0x2800014, 0xd880148, 0xa3b49,
+    0x1306cf, 0x805cb, 0xbd16983, 0xcc0000d, 0xcc0000e, 0xd497e4f, 0xa4110, 0x2116f08,
+    0x80c12, 0xfc00013, 0xa4254, 0x11a00c, 0x1c00015, 0xcc00017, 0x1c00009, 0x7c00019,
+    0xd400001, 0x11d392, 0x8c00003, 0xd400014, 0xbc00013, 0x8035f, 0xa4502, 0x861c3,
+    0x90ac4, 0x1c00005, 0x97586, 0x82487, 0x482208, 0x882a89, 0x80000a, 0x835cb,
+    0xa4bcc, 0x85dcd, 0xa510e, 0x29c00014, 0x10a2510, 0x1c0000f, 0xa55d2, 0x8a1f93,
+    0x9f8d4, 0xa5715, 0x82616, 0x2000015, 0x26c00006, 0x7c00000, 0x25000014, 0x740001b,
+    0x7000001, 0x92a82, 0x87d43, 0x84484, 0x93f05, 0xa5b46, 0x83a07, 0x84188,
+    0xa5d89, 0x7c0000c, 0x8440b, 0xa618c, 0xa05cd, 0xa658e, 0x13c86c8f, 0x99450,
+    0x7c00013, 0xa6b12, 0xa63d3, 0xa3114, 0x898a15, 0x1c00000, 0x8c00001, 0x5087998,
+    0x12c00019, 0x7000000, 0x7093881, 0x800014, 0x7089d83, 0x1c85f84, 0x8c8b645, 0x86806,
+    0x1c0000b, 0x500000c, 0x800014, 0x700000f, 0x8704b, 0x9098c, 0x8a6d4d, 0x8ca70ce,
+    0x1c91acf, 0xec90c90, 0x800015, 0x8ca73d2, 0x94593, 0xa4d14, 0x2000019, 0x868d6,
+    0xa7481, 0xd800002, 0x5000015, 0xfc00004, 0xa7a05, 0xd800006, 0xc9442, 0x8c00003,
+    0xa7bc9, 0xa7e81, 0x9800006, 0x1180000c, 0xd40000d, 0x8ca8245, 0x89dc8f, 0x700000b,
+    0x100000c, 0xa6509, 0xa7fd3, 0x11800014, 0x8d815, 0x133414, 0xc9112, 0x88874f,
+    0x11800010, 0xd40001a, 0x133808, 0x8c88f53, 0x8a84c1, 0x888715, 0x9575f, 0xfc00004,
+    0x8ca8745, 0xfc89086, 0x1341c5, 0x892c8, 0xa8b89, 0x1349c6, 0xd80000b, 0x7c922df,
+    0x8c87ba9, 0x8886a, 0x8944f, 0x25000001, 0x12c047, 0x7934f09, 0xa7793, 0x893d4,
+    0x8b795, 0x7888d29, 0x8c00001, 0x12c00e, 0x1276c3, 0x1180001a, 0x8d278c5, 0x12c212,
+    0x134c81, 0x12c114, 0x88a11f, 0x8a541, 0x8af82, 0x95e83, 0x1c00004, 0x9800005,
+    0xa8cc6, 0xdd33f52, 0x133bd3, 0x1c00009, 0x127a53, 0x127bd4, 0xa908c, 0x8a8cd,
+    0x8a93ce, 0x8cb0f, 0x8b050, 0x10400008, 0xa9712, 0x9d1d3, 0xa8914, 0x135241,
+    0x1534b0d, 0xe400017, 0x7400018, 0x12c00019, 0x700001a, 0x8bbdb, 0xa9a81, 0xd800002,
+    0x1400003, 0x5000004, 0xa9cc5, 0x7400002, 0xd400007, 0x5000014, 0x8a2949, 0x7c00006,
+    0xd80000b, 0x500000c, 0xd40000d, 0xd000014, 0xaa0cf, 0x12b442, 0x12b3c3, 0xd800012,
+    0xaa453, 0xaa694, 0x93955, 0x116952, 0xd50f093, 0x10ea54, 0xcc00019, 0xd40001a,
+    0x12b4cd, 0x7400018, 0x2dc00001, 0xaa901, 0x8a95f, 0x8ec03, 0x12b613, 0xaadc5,
+    0x12b515, 0x134f48, 0x8bf48, 0x9b189, 0x14ab5c1, 0x8c5cb, 0x8b8a9, 0x7c8beea,
+    0xabc05, 0x91b0f, 0xab150, 0x18c8e548, 0xa82c9, 0xd800013, 0xab1d4, 0x1048c595,
+    0x800000, 0x8c8ce, 0xd4ac14f, 0x140000e, 0x10400003, 0xa8ed2, 0xccac2d3, 0xd88ca54,
+    0x99315, 0x904df, 0xac5c2, 0x1400003, 0x7c0000c, 0x1180001a, 0x8d186, 0x12dece,
+    0xa23c8, 0x2a000010, 0x148c85f, 0xa52cb, 0xac60c, 0x98f0d, 0x8caca4e, 0x137354,
+    0x8d350, 0x26c00005, 0x1c931d2, 0x99e13, 0xacc14, 0x7c0002a, 0x800001, 0x800002,
+    0x91203, 0x95404, 0x12e481, 0x891746, 0x891c87, 0x16400008, 0x5000005, 0x80000a,
+    0x9468b, 0xad2cc, 0x89260d, 0xad88e, 0x140000f, 0x891d50, 0x10400011, 0x9eed2,
+    0xaccd3, 0xada14, 0x7c91e15, 0x800016, 0x92fc1, 0x92482, 0x25000005, 0x8c00001,
+    0x9d6c5, 0x12e9c3, 0x7d200c1, 0x11800005, 0x94b09, 0x8c00012, 0x7c00013, 0x967cc,
+    0x136485, 0x7c00008, 0x8c0000f, 0xae141, 0x7c0000b, 0xadb92, 0x95993, 0xae585,
+    0x95ed5, 0x120190, 0xcc00029, 0x9c749, 0x1400001, 0x8c00012, 0x5000003, 0x13798e,
+    0x9378e, 0x8c96e8f, 0xd000005, 0x7c0001a, 0x19093712, 0x99b53, 0xd800014, 0x1c00015,
+    0xbc68d, 0xa0bcc4e, 0x14bd08f, 0x4400019, 0x800029, 0x400015, 0xa000013, 0x5000014,
+    0x1c00000, 0xdc0001f, 0x11800001, 0xaa882, 0x1497a43, 0x9e6c4, 0x12c00005, 0xae946,
+    0xa0a07, 0x97088, 0x493b09, 0x800029, 0xa00000c, 0xaed0c, 0x9408d, 0x10af14e,
+    0x1000000f, 0x26c00001, 0xd400005, 0xaf852, 0xafd53, 0xaff14, 0x993d5, 0x98001,
+    0x94317, 0x7400018, 0x12c34d, 0xab3c5, 0xae306, 0x1c00004, 0xa000000, 0x13c00006,
+    0xd52c453, 0x12c494, 0x509e64c, 0x130b05, 0x380000b, 0x380000c, 0x2130908, 0x25000013,
+    0x50943d2, 0x8caab93, 0xb0094, 0x800012, 0x8c00001, 0x4400014, 0xa1241, 0x400019,
+    0x133385, 0xd800004, 0xb0585, 0x1115202, 0x2740000e, 0x9561f, 0x95c89, 0x7c0000c,
+    0x117d47, 0x89bdcc, 0x95b81, 0xa994e, 0x789578f, 0x1177cc, 0xb0885, 0x9f6d2,
+    0xb0753, 0x1000010, 0x964d5, 0x1411b692, 0x25c00009, 0x114994, 0x500000d, 0x500000e,
+    0x137bce, 0xb0ac1, 0xdc00019, 0x5000012, 0xd400013, 0x70b1005, 0x96595, 0xd400001,
+    0x1400017, 0xab689, 0x400004, 0x20c00005, 0xf8a714c, 0x2117fc3, 0x9738e, 0xaeb0f,
+    0x7400006, 0x140000f, 0xb1092, 0xd49b813, 0x9fb54, 0xa0c15, 0xd51744c, 0x130e81,
+    0x11a44e, 0xd12edd3, 0xdc00013, 0x130e05, 0x11b812, 0xd517e13, 0x22800014, 0x975df,
+    0x4b1341, 0x1c96cc2, 0x8c97483, 0xb1504, 0x1cb16c5, 0xd4ad7c6, 0x978c7, 0x1c00008,
+    0x1cb19c9, 0x96ca9, 0x80002a, 0xa36cc, 0xaf70d, 0x8c00017, 0x1cb1b8f, 0xd800001,
+    0x12b782, 0x1387cd, 0x9a553, 0xd497ad4, 0x4adc95, 0x13400016, 0xd400008, 0x8c0000d,
+    0x13768e, 0x9e99a, 0x7c00002, 0x12b94d, 0xb1d81, 0x97e82, 0x17c979df, 0x11dbc1,
+    0xb2145, 0x5000003, 0x12b694, 0xd51dd05, 0xa1dc9, 0x8c0000c, 0xd40000e, 0x11c5c9,
+    0x9be8d, 0xd80002a, 0x1c9becf, 0x209f090, 0x8c00013, 0x11ddcf, 0x97f53, 0x1ca6e94,
+    0x1c99a15, 0x11800013, 0x400002, 0x1c00000, 0xb26c1, 0x1040000d, 0x140000e, 0xb2844,
+    0x1cb3005, 0xfc9a506, 0x1cb3547, 0xa0308, 0xb29c9, 0x1400015, 0xa104b, 0x138448,
+    0x9834d, 0xae9ce, 0x1cb32cf, 0x25000001, 0x800029, 0x98692, 0xb3893, 0xb3854,
+    0x1049a795, 0xa4196, 0x8c00008, 0x1000006, 0x13000019, 0xb3a5a, 0x1400003, 0x8c00004,
+    0xfc00005, 0x898f46, 0x1ca4b9f, 0x800008, 0x28000012, 0x26400013, 0x99a4b, 0x9a18c,
+    0xa2d4d, 0xd4b404e, 0x80000f, 0x1049cc10, 0x4988a9, 0x8b4252, 0xb42d3, 0x50a45d4,
+    0x800015, 0x800016, 0x59242c5, 0x7800018, 0x1361cd, 0x9ae1a, 0x1c00000, 0x49af81,
+    0x123d0b, 0x135fd2, 0xd000013, 0x49af05, 0xe89b5c6, 0x10400010, 0xd400008, 0x109bf49,
+    0x1244d3, 0x1b524594, 0x7c00015, 0x2653830e, 0x138641, 0xd800010, 0xb4750, 0xa000001,
+    0x400012, 0x1cafb13, 0x9c454, 0x1c00015, 0x9cb2041, 0x9c2c2, 0x149c483, 0x7000009,
+    0x28a51c5, 0x8c00001, 0x9c607, 0x9d008, 0x8ca5cc9, 0x12ec45, 0x1ca308b, 0x9d04c,
+    0xb494d, 0x1c9f3ce, 0x7c9d18f, 0x9d450, 0x500000e, 0x9fad2, 0xabc93, 0x9d8d4,
+    0x1ca5ed5, 0x8c00013, 0x2a800012, 0x2ac00013, 0xb4841, 0x1c00002, 0xa3643, 0x137f05,
+    0x1cb4dc5, 0x1c00006, 0x49dddf, 0x7000008, 0xb0e89, 0x7c00022, 0xa3b8b, 0x9e1cc,
+    0xa058d, 0xd40000f, 0xb504f, 0x1cb53d0, 0x400029, 0x780002a, 0xb2d13, 0xb5454,
+    0xa56d5, 0xd400005, 0x12cb8c, 0x8c0000d, 0x12cd4e, 0xb5641, 0xd000004, 0xd00000b,
+    0x127f8c, 0xb5985, 0xa5e1f, 0x1400015, 0xa5948, 0xb5e49, 0x1240000c, 0x127fd3,
+    0x128194, 0x9e60d, 0x1000009, 0x70b60cf, 0x138b45, 0x80002a, 0x1cb3e12, 0xa8f13,
+    0x1cb6154, 0xb6355, 0x25139c8c, 0x128389, 0xb6741, 0x1284cb, 0xa689a, 0x12854d,
+    0xacb05, 0x138992, 0x5000001, 0x70a92df, 0x9fe89, 0x128513, 0x1285d4, 0xd800002,
+    0x1400003, 0x1400008, 0xa0bcf, 0x136a01, 0x2500001a, 0xa1f48, 0x7c0002a, 0x136685,
+    0xa1195, 0xa264c, 0x104a1217, 0xac64e, 0x25139e05, 0xa1c9a, 0x1368cc, 0xa2412,
+    0xaa3d3, 0xd400014, 0xa1d1f, 0xd000001, 0x140a3a82, 0x136393, 0xa42c4, 0x12b381,
+    0x12b242, 0x12b543, 0x12e4c1, 0x8c00009, 0x800029, 0x7c00000, 0x12e8c5, 0x12b589,
+    0xa434e, 0xa5142, 0x12b5cc, 0x2740002a, 0xa4d92, 0xa4653, 0xa5907, 0xa0a4ed5,
+    0x1400009, 0x12b653, 0x8c0000b, 0x1180000c, 0x1c00010, 0xa7c0e, 0x2800015, 0xd800012,
+    0x11800013, 0xa7812, 0xa5213, 0xa59d4, 0xa58c1, 0xb6fc2, 0x1400003, 0xb7284,
+    0xcc0001f, 0xb01c6, 0xd4ad107, 0xa0a6648, 0xa65c9, 0x25c00009, 0xafc8b, 0xb764c,
+    0xa680d, 0xb7b8e, 0x1400000f, 0x138785, 0x138385, 0xb8352, 0xb7493, 0xb7dd4,
+    0xafe55, 0x26c00013, 0xa7382, 0xc00003, 0xa79c4, 0x1c0001a, 0x4ac106, 0xaa7c7,
+    0xa9c08, 0xb8709, 0x13a38b, 0x7d38815, 0xb8c0c, 0xaab4d, 0xb8e4e, 0x1440000f,
+    0x1ca7b10, 0x5000005, 0xb9692, 0xb4ad3, 0xb6d14, 0xabfd5, 0xa7696, 0x137805,
+    0x1800018, 0xd000019, 0x50a9f01, 0x137889, 0x1400003, 0xb0844, 0xb4545, 0xa9746,
+    0x8c00029, 0x7000000, 0xb8641, 0xd400017, 0xfc0000b, 0xb288c, 0x8b9fc5, 0xb9bce,
+    0xabb4f, 0x8c00017, 0xba209, 0xa000012, 0xb1a53, 0xb3201, 0x2000008, 0xd4a8316,
+    0xba50f, 0xc05c5, 0x200000c, 0x1c0001a, 0x1184ce, 0x7c00009, 0x4ba715, 0x25c00013,
+    0xbcb4c, 0x211aa13, 0x1c00019, 0x6400015, 0x12e909, 0x15800013, 0xbfcd2, 0xb7853,
+    0xab71f, 0xb7095, 0xaf981, 0xb1242, 0x2f400008, 0x12e992, 0xdc00013, 0xac806,
+    0xdc00015, 0xad1c8, 0xb90e9, 0xa956a, 0xaa2cb, 0xb4d8c, 0xa0ae00d, 0x8ba8ce,
+    0x12c4c4, 0xbae50, 0x7c00004, 0xbb052, 0x8b7c13, 0xbb094, 0x4aa715, 0xbb4c1,
+    0xa0aad97, 0x1800018, 0xd52c54e, 0xbb745, 0x12c3d0, 0x80000f, 0x6400008, 0xbbb09,
+    0xbc041, 0x1000010, 0xab243, 0xd400017, 0xbc1c5, 0xbbc8f, 0x138f95, 0xab488,
+    0xb3c49, 0xbc8c1, 0xab90b, 0xad995, 0xcc0000d, 0xbcac5, 0x14b5c4f, 0xbc310,
+    0xf800008, 0xbcdc9, 0xfc00013, 0x130bc5d4, 0x104abd55, 0xbbcdf, 0x13a985, 0xac88f,
+    0xec00009, 0xac3da, 0xbce52, 0x50bd213, 0xd400014, 0xbd355, 0xac99f, 0xaafe9,
+    0x134a41, 0x139a41, 0x500001a, 0xd000012, 0x134845, 0xd400001, 0x129142, 0xae69f,
+    0x800029, 0xaca01, 0x129346, 0x1400003, 0xacb84, 0xd400009, 0x13480f, 0xa000007,
+    0x8cad288, 0x5000005, 0x7c0002a, 0x139b53, 0xbd40c, 0xb714d, 0xbd90e, 0x129053,
+    0xada50, 0x1400013, 0xbda92, 0xb2193, 0xade14, 0xa000000, 0xaebc1, 0x4bdfc2,
+    0xb4343, 0x20be584, 0x8c0000f, 0x1cbe706, 0xbec47, 0xaecc8, 0xa000009, 0xd400007,
+    0xbee4b, 0x10b558c, 0xbee8d, 0xbf3ce, 0xa00000f, 0xbb290, 0xd000002, 0xbfa92,
+    0xbff13, 0xc0154, 0xc0715, 0xb2dd6, 0x20af557, 0x6c00002, 0x800019, 0xb8241,
+    0xd8af402, 0x128c4d, 0x128f4e, 0xb8905, 0x128f90, 0x137788, 0x128f12, 0xb1b49,
+    0x137b0b, 0xd53b953, 0xc08cc, 0x74d94c4, 0x7c00005, 0xafc0f, 0xc1441, 0x1040000e,
+    0xb0352, 0x8cc0b13, 0xc1785, 0xb7755, 0x40000d, 0x4d940e, 0xb2e89, 0x1400002,
+    0xb055a, 0x8c00012, 0xdb553, 0xdb614, 0xba7cf, 0xb041f, 0xd40000c, 0x50bd952,
+    0xb1593, 0xd8bcfd4, 0xb2615, 0x1640000e, 0xb0a97, 0x800001, 0x13ad94, 0x7c00012,
+    0x13ab92, 0x8c00005, 0x10400015, 0xd400015, 0xb541f, 0xb6901, 0xb6d82, 0x1cb0b43,
+    0xd400013, 0xb0bc5, 0xb2306, 0xc1a07, 0xa0be4c8, 0xc1dc9, 0x19800029, 0xb4b8b,
+    0xb93cc, 0xc204d, 0xc25ce, 0xb588f, 0x1cc2790, 0x13bcc1, 0xc2b92, 0xc3193,
+    0xbf454, 0x8cc36d5, 0xb2b96, 0xb5f41, 0x1cb1718, 0x7800001, 0xd800004, 0xb9705,
+    0x134541, 0x8d10285, 0x13c24c, 0x7800009, 0x1346c5, 0x10aa09, 0xb258c, 0x13c109,
+    0x5134709, 0x7c0000f, 0x2800010, 0x10c3cf, 0xb36d2, 0x12b882, 0x10a652, 0xb30d5,
+    0xbd8c1, 0x19cb3482, 0x14b9183, 0xbf9c4, 0xc3885, 0x500000e, 0xa0be947, 0x12b84c,
+    0x12bb0d, 0x5000012, 0xc39cb, 0x50b3acc, 0xba0cd, 0xc3f0e, 0x8cb3d8f, 0xb8050,
+    0x12bcd5, 0x13bfc8, 0xc4513, 0xc2394, 0xa000015, 0xc0116, 0xc4341, 0xb47d8,
+    0x12e501, 0xc099a, 0xb46c5, 0x138705, 0xf800005, 0x7000001, 0x80000d, 0x26c00009,
+    0xf800009, 0x8cbf5cc, 0xb550d, 0xb55ce, 0xb4d0f, 0xd800014, 0x280000f, 0xb5712,
+    0x140bd653, 0xd400014, 0xc47c1, 0xd800002, 0xb5bc3, 0xd800004, 0xc4cc5, 0xd800006,
+    0xd400007, 0x135e15, 0xb9909, 0x1c0001a, 0xfc0000b, 0x1180000c, 0x10c0000d, 0x1180000e,
+    0xc4e0f, 0x2740000b, 0xcc00009, 0x700001f, 0xbe153, 0x50bc554, 0xb84d5, 0x8c0002a,
+    0x140000e, 0x18c00001, 0x7c00019, 0x1180001a, 0x1400012, 0x6524805, 0x8c00015, 0x500000c,
+    0xb955f, 0xc5141, 0xb5cc2, 0x1400003, 0xd400004, 0xc5405, 0x13ac01, 0x1240cf,
+    0x13784e, 0xb68c9, 0xf800012, 0x124853, 0x124514, 0x26c00013, 0x25400014, 0xba4cf,
+    0x118b6210, 0x13ad0c, 0x12425a, 0xbc653, 0xfc00014, 0xb8f55, 0xb7781, 0xc5682,
+    0xb7d83, 0x1c00007, 0x1c00005, 0x4b8386, 0xc1987, 0xbab88, 0xb7d09, 0xb5e1f,
+    0xa0c0f8b, 0xbac0c, 0xb96cd, 0xb8c8e, 0x8c0000f, 0xc2250, 0x13c3c5, 0xc5992,
+    0xc5b53, 0xc32d4, 0xc5f01, 0x10b8b96, 0xbac83, 0x1c00018, 0xc6105, 0x120641,
+    0x700001b, 0xbb5c8, 0xbb609, 0x120c05, 0xbea0b, 0x12400003, 0x120b88, 0x120989,
+    0xbd88f, 0xc62d0, 0x28800003, 0xc5281, 0xfc00013, 0xc6594, 0xc2f15, 0xc8a05,
+    0x1209d2, 0x11800013, 0xc6881, 0xbbac2, 0x27400001, 0x7c00013, 0xc6c05, 0x28400010,
+    0xbe7df, 0xf8c0e48, 0xc6dc9, 0x25000014, 0xc1312, 0xc0c53, 0xd800014, 0xc1155,
+    0xc34cf, 0x500001a, 0xbb5a9, 0xc7152, 0xccc3e53, 0x5000014, 0xc67d5, 0x13b9c5,
+    0x7c0002a, 0xc125f, 0x1c0000e, 0x8c00009, 0x800010, 0x8c00005, 0x1c00012, 0xd400013,
+    0xbba9f, 0xbbc01, 0x1a4bbe02, 0x2fc00001, 0xbb984, 0xbc3c5, 0x1a0c7086, 0xc7387,
+    0x1000008, 0xc0d49, 0xc37e9, 0x7c0002a, 0xbb70c, 0xc790d, 0xb0c7e4e, 0x700000f,
+    0xd400002, 0xc80c1, 0x1cc8012, 0xc5813, 0xc8454, 0xc4305, 0x13c2d4, 0x11800008,
+    0xa000018, 0xbe3c9, 0x8c00003, 0x7400004, 0x500000c, 0x9800006, 0x25c00009, 0xbd5cf,
+    0x136b12, 0xd400013, 0x100000b, 0x100000c, 0x11800014, 0xc03d5, 0xbd116, 0x14bddd7,
+    0x28fb801, 0x5000002, 0x1000013, 0x8c00012, 0x6cf6785, 0x1400003, 0xa000004, 0xc2b5f,
+    0x7cf6dc9, 0x1b400012, 0xbd4c8, 0x1400012, 0x7800015, 0xa000013, 0xfea0f, 0xbdb8d,
+    0xbd48e, 0x800029, 0xbe0d0, 0x1c00011, 0xbfa12, 0xbed93, 0x1c00014, 0xc85d5,
+    0x7c00019, 0x7000004, 0x1c00018, 0xec00002, 0xbf043, 0x1c00004, 0x7c0001f, 0x8cbedc6,
+    0x500000e, 0xbefc8, 0x2000007, 0x25d3c445, 0x1c0000b, 0x1a80000c, 0xdcf8b, 0x11800009,
+    0xdbfcd, 0x1c00010, 0xd800015, 0x400010, 0xc14d3, 0x4dba92, 0xded93, 0xdf254,
+    0xfc00008, 0x2800001, 0x2513c4c1, 0x700001a, 0x700001b, 0xa000000, 0xd400001, 0x4c8802,
+    0xc49c3, 0xc8a44, 0xd800005, 0x10000006, 0xc8f47, 0xbf6c8, 0xbf7c9, 0x280000f,
+    0xc290b, 0xc924c, 0xc0d8d, 0xc97ce, 0xbfa4f, 0x13cf45, 0x1400011, 0xc9e52,
+    0xa0c7213, 0xca094, 0xca315, 0x8d3cf05, 0x13d2d2, 0x8c0000b, 0xccc0919, 0x280001f,
+    0xa00001b, 0x5000001, 0xd8c1b82, 0x1400003, 0xc20c4, 0xc3c45, 0xc21c6, 0xd8c35c7,
+    0xa0c2688, 0xc9a49, 0x136ac5, 0x8c00015, 0xca84c, 0xc5c8d, 0xcac8e, 0x14c200f,
+    0xc3c10, 0x136fcc, 0xcb092, 0xa0cafd3, 0xc8fd4, 0xdc00015, 0x1400013, 0x1400008,
+    0x10c2e58, 0xc3401, 0xc3682, 0xc7fc3, 0xcb2c4, 0xcb4c5, 0x10000006, 0xc3a47,
+    0x5000008, 0x13d552, 0x1400013, 0xcb9cb, 0xcb5cc, 0xc504d, 0xcbe4e, 0xc3a8f,
+    0x1400010, 0x1c00029, 0xc7792, 0xcc113, 0xa0cc294, 0xcc7c1, 0x11800016, 0x500002a,
+    0x8cdc9c1, 0xcca85, 0x2500000c, 0xc4247, 0x8cd9cc5, 0xcb909, 0x127181, 0x140001f,
+    0xd9c89, 0xd000001, 0x127b05, 0xdaf8c, 0x118c4190, 0xf800008, 0x8cd9e4f, 0x8cca6d3,
+    0xd4c4394, 0xc8ad5, 0xdbc13, 0x10c00014, 0x5000014, 0x13db83, 0xa000017, 0xf800012,
+    0x14000013, 0x127b54, 0x13a08c, 0xc455f, 0x29c0000e, 0x5000015, 0xc9cc2, 0x12791a,
+    0x114c5a84, 0x26c00013, 0x4c4906, 0xa0c60c7, 0x114c4d88, 0xc4ac9, 0xc40aa, 0xc4d0b,
+    0xc574c, 0xa0c5d0d, 0x114ccd4e, 0x1ac0000f, 0xc9550, 0x11400000, 0xcc3d2, 0xa0c58d3,
+    0xc70d4, 0xc5e15, 0xc6041, 0x8c00006, 0x1800018, 0x1400019, 0xc6cc5, 0x8c88c6,
+    0x2513ba48, 0xc6508, 0xccdc1, 0x1140000e, 0x7cc6283, 0xc664c, 0x7ccd245, 0xcc0000f,
+    0xc660f, 0x7000014, 0xd800002, 0xcd841, 0xc7453, 0x8c00015, 0x7c00015, 0xcd6c5,
+    0xc66cf, 0xcd050, 0xf800008, 0xcd9c9, 0xfc00013, 0xcd4d4, 0xc7495, 0xc72cd,
+    0x5000008, 0xc8d4f, 0x7c00019, 0xdc00001, 0xc9052, 0xcccded3, 0x12c00008, 0xc9295,
+    0x7cc77df, 0x25400006, 0xd538a0c, 0x127a09, 0x500001a, 0x1400001, 0xd00000c, 0xc79c3,
+    0x138952, 0x25127d0f, 0x138a94, 0x80002a, 0x1000008, 0x25400013, 0x8c00005, 0xd000015,
+    0xcdf8c, 0xcb84d, 0xa0ce1ce, 0xc7c29, 0x7c0002a, 0xca2c8, 0xc7a12, 0x124ce113,
+    0xca214, 0x1400014, 0x13de14, 0xc92ce, 0x1c0000f, 0x1000010, 0x1c00011, 0xdcc9e92,
+    0x1312ce, 0xc8bd4, 0xc8c15, 0x13de4e, 0x1c00012, 0x1c00013, 0x1c00014, 0xa000000,
+    0xa00001b, 0x10ce5c2, 0xa0ca803, 0xce8c4, 0xa000005, 0x10c9e06, 0xcecc7, 0x114cc308,
+    0xa0ccc09, 0x8c00005, 0x10ceb0b, 0xcf20c, 0xcf54d, 0x4cfa8e, 0xc9f0f, 0xcff50,
+    0x400011, 0x4d0452, 0xa0d0613, 0xa0d0b54, 0x4cc715, 0xa0caa56, 0xd0ec1, 0xd000014,
+    0x1400003, 0x8c00003, 0xd1345, 0x5000005, 0xd400001, 0xd5fc1, 0xcd409, 0x26c00013,
+    0x13a2c5, 0xd6145, 0x5000006, 0xd800007, 0xd180f, 0x78cf689, 0x28000010, 0xcfd92,
+    0xcb753, 0xcdbd4, 0xcab95, 0xd64cf, 0xcae57, 0x13a292, 0xd000019, 0xd62d3,
+    0xd1114, 0xd5b15, 0xcf956, 0x2500000f, 0xa000000, 0xcdd01, 0xce942, 0x1ccef03,
+    0xcad84, 0x1cd0145, 0x4cf0c6, 0xd06c7, 0xce408, 0x10d1a09, 0x8caee9, 0xd070b,
+    0x8cd1d4c, 0xd154d, 0xa0d254e, 0xd1e8f, 0xd2b10, 0x31000012, 0xd2f52, 0xa0d3553,
+    0xd3894, 0x8cd2015, 0xccc96, 0x800017, 0x1000018, 0x17400019, 0xa00001a, 0xa00001b,
+    0xcf501, 0x25400005, 0x129006, 0x13df13, 0xd0985, 0xd800006, 0x13dfd2, 0xd00000b,
+    0x7ccb149, 0x135085, 0x12918e, 0xcb98c, 0x8c00008, 0x7935189, 0x8ccb6cf, 0x1290d3,
+    0x128e94, 0x2800012, 0x11800013, 0xd0d54, 0x10400015, 0xd3b41, 0x135392, 0xd400005,
+    0xfc00004, 0xd3d05, 0x30000001, 0xcb887, 0xcbb88, 0xcc089, 0x780001f, 0xd400002,
+    0xd1c0c, 0x13d310, 0x8d3f0e, 0xcf00f, 0x11ca87, 0x13d754, 0xce592, 0xd2cd3,
+    0xcccbdd4, 0xcd315, 0xd80000d, 0x11e04e, 0xd400003, 0x400014, 0xcc91a, 0x13dace,
+    0x2391c613, 0x2693dc90, 0x400015, 0xcc15f, 0x114cd7c1, 0xcd902, 0xce443, 0x4d4104,
+    0x8d4185, 0xce986, 0xd4387, 0xcde88, 0x1c0001a, 0x800029, 0xd474b, 0x114cf58c,
+    0xce78d, 0x17cd48ce, 0xd334f, 0x800010, 0xd5381, 0xcfe12, 0x114d4e93, 0x1cd4cd4,
+    0xd5705, 0x11800016, 0x500000c, 0xa000018, 0xd5289, 0x1240000d, 0x1c0000e, 0xd50cc,
+    0xa000012, 0xd598e, 0xd4b8f, 0x800013, 0xa13ab14, 0xd5a12, 0xd5c13, 0xd5cd4,
+    0xd39d5, 0xda3c1, 0xa00002a, 0x800005, 0x500000c, 0xdb985, 0x140193, 0xd6ec7,
+    0x7c00008, 0xda549, 0xd0adf, 0x100000e, 0x14daf0c, 0x1d2d04f, 0xc80000e, 0xda8cf,
+    0x13aad3, 0xa000014, 0xd800001, 0xdafd3, 0xceea9, 0xcef6a, 0xa000000, 0xcfb01,
+    0xd5442, 0x14cff83, 0x98cfec4, 0xd0105, 0x4d20c6, 0xcc0001f, 0x10d07c8, 0xd0949,
+    0x140549, 0xd268b, 0xd684c, 0xd204d, 0xd664e, 0x26c00014, 0xd6990, 0x1c00029,
+    0xd6c12, 0xd6d93, 0xd7114, 0x2f000013, 0xa000016, 0xd74c1, 0x1800018, 0xd2a03,
+    0xa00001a, 0xd7a05, 0xd1d06, 0x26c00004, 0x12e641, 0xd7d49, 0x12a187, 0xd7c8b,
+    0x12e805, 0xd280d, 0x2500000b, 0xd800f, 0xd8390, 0x12a48e, 0xd1f52, 0xfc00013,
+    0xd8414, 0xd7395, 0x12a353, 0x12e710, 0x25c00015, 0x7c00019, 0xd2a5a, 0x12ead4,
+    0xd8601, 0x28000001, 0x7000005, 0xd401f, 0xd8bc5, 0x12ed05, 0xd2b87, 0xd8648,
+    0x78d7849, 0x12eb09, 0x13decd, 0xd2c8c, 0xd4f0d, 0xd2c0e, 0xd6f8f, 0x8c0000f,
+    0x800006, 0xd8c12, 0xccd8113, 0xd400014, 0xd5055, 0xd400001, 0x139e4e, 0x1040000d,
+    0x12ee4e, 0x500001a, 0x13a0d2, 0xd400013, 0x139ed4, 0x800013, 0xd429f, 0x800015,
+    0xa8d33c1, 0xd3102, 0x6800003, 0xa0d2dc4, 0xa0d2ec5, 0xd4d35c6, 0xa000007, 0x10d5dc8,
+    0xa000009, 0x7c0002a, 0xd8d3f8b, 0xd384c, 0xd918d, 0x28d968e, 0xa00000f, 0x1c00010,
+    0x26000013, 0x1cd9552, 0x184d8ed3, 0xa0d98d4, 0xa000015, 0x1079c2, 0xd9c01, 0xa000018,
+    0x112e85, 0xa00001a, 0xd9e85, 0x800000, 0x108349, 0x7800009, 0xd5bc9, 0x8d0bd4c,
+    0x8c0000c, 0xd41cc, 0x10b08f, 0x13e148, 0xd640f, 0x10a592, 0x10f313, 0x108014,
+    0x5000013, 0x8c00015, 0x7000002, 0x12400003, 0xd9857, 0xa000005, 0x400006, 0xa000007,
+    0xda2c8, 0xa000009, 0x5000014, 0x5000005, 0xd86df, 0x180000d, 0x380000e, 0xd400009,
+    0xd4890, 0x1c00011, 0xd4692, 0xa0d9993, 0x26c00009, 0x1cd7095, 0xd39a9, 0xd5742,
+    0xccd5903, 0xccd81c4, 0xd40000f, 0x1400001, 0x7400009, 0x8c00003, 0xd5ac9, 0x7926c85,
+    0xd674b, 0xd5e8c, 0xd618d, 0x280000e, 0x140f92, 0x9c00012, 0x12708c, 0x2c00012,
+    0x8d6253, 0xcc00014, 0x11c00015, 0x1c00000, 0xda241, 0x1c00002, 0x58d6d41, 0x400015,
+    0x8cda845, 0xd7184, 0xdb2c5, 0x25c00013, 0x58d6509, 0xa00000a, 0xdb3c9, 0xda58c,
+    0xd800006, 0x11400001, 0x1cd670f, 0x1c0000e, 0xd9a8f, 0xd70d2, 0xda793, 0x1cd7352,
+    0x64d8f15, 0xd800014, 0x6400015, 0x800029, 0x1cd6ad9, 0x7c00001, 0x7c00019, 0x1400003,
+    0x1c00006, 0x400005, 0x580001f, 0x8c00005, 0xdac48, 0x400009, 0x8c00005, 0x4db20b,
+    0x40000c, 0x13df4f, 0x1cdb881, 0x500000e, 0x1c00029, 0x64d702a, 0xdba05, 0xdbf46,
+    0xd800012, 0x7c00015, 0x1cd8f89, 0x122605, 0x122706, 0x10d988c, 0x13af45, 0x1228c9,
+    0x1c0000f, 0x5000008, 0x500000c, 0x10d7f52, 0x140dc013, 0x1cdab14, 0x1cd7e15, 0x10d7ec1,
+    0x5122752, 0x8c00013, 0x122ad4, 0x4dc285, 0x13ad53, 0xd000014, 0xd00000c, 0x1000009,
+    0x1c0001f, 0x12c0000f, 0x1cdc18c, 0xd4d8a8d, 0xdc54e, 0x10dba4f, 0xd400013, 0xd400001,
+    0xdc892, 0x1400013, 0x1c00029, 0x400015, 0x26000006, 0x1400017, 0x4dcc81, 0x1000019,
+    0x70da803, 0xdcd04, 0xdd1c5, 0xdcf46, 0xdd187, 0x40001f, 0x8cdd409, 0x140ed3,
+    0xdd44b, 0xdd74c, 0xd000014, 0xd000004, 0x70dd6cf, 0x140e53, 0x12aa87, 0x1cd8569,
+    0xda953, 0xdad14, 0x4dab95, 0x12aacc, 0x13de85, 0xdd941, 0x8c00019, 0xddb5a,
+    0x5000009, 0xdde45, 0x12a853, 0x12ab94, 0x38dad9f, 0xde0c9, 0x800008, 0x400022,
+    0x141d93, 0xdc0cd, 0xccdb0ce, 0x70dc80f, 0xdb410, 0x13e30f, 0x7000010, 0xd4db513,
+    0xfc00014, 0xdc7d5, 0x1cde2c1, 0x10d40e81, 0x1c00003, 0xddf04, 0x1cde785, 0x11800006,
+    0x1cde707, 0x6800004, 0x64dec09, 0x141009, 0x118dbb8b, 0xdc5cc, 0x2800005, 0x1cdcd8e,
+    0xdcded0f, 0xcc00009, 0x25000009, 0x140000e, 0xde653, 0xdeed4, 0xde055, 0x5000016,
+    0x30800013, 0x142845, 0x2000019, 0x118dc21a, 0x1c00000, 0x4df281, 0x11c00001, 0x1c00001,
+    0x1cdb7df, 0x20df7c5, 0xdfb86, 0x5000005, 0x1bcdca48, 0x74df489, 0x11800008, 0x11000009,
+    0x1cde3cc, 0x13e8c5, 0x780000e, 0x64dc8cf, 0xdfbd0, 0x13e749, 0x1000012, 0xdd2d3,
+    0x1b800014, 0xdcbd5, 0x5000012, 0x25800013, 0x26d40754, 0x1c00019, 0x1c00000, 0x14e0101,
+    0xdcd42, 0x14df3c3, 0xe0704, 0x1ce0cc5, 0x1cdda06, 0xe1047, 0x1c00008, 0xe12c9,
+    0x142c81, 0x1cdf8cb, 0x1400005, 0x1ce140d, 0xdfcce, 0x10e160f, 0x1c00010, 0x1c00011,
+    0x1ce0792, 0xe8e1a93, 0xe1cd4, 0x64e0695, 0x12bb83, 0x1c00006, 0x12bc45, 0xdd359,
+    0xdd49a, 0x12ba88, 0x640000b, 0x1c0000c, 0x140245, 0x7cde21f, 0xd142e0c, 0x12bdce,
+    0x1402c9, 0x6400012, 0x58dd701, 0x12be52, 0x1cdfc43, 0x26800014, 0x1ce1c45, 0x1000029,
+    0x80002a, 0x1ce0b88, 0x1c00009, 0x11ce01, 0x7ce214b, 0xddbcc, 0x20ddc4d, 0x7800005,
+    0x1cdddcf, 0x68e22d0, 0x2500000c, 0x7d1e309, 0x1ce2693, 0xe2754, 0x134de755, 0x1c00000,
+    0x1000005, 0x7d1cf4f, 0x6400019, 0xdec5a, 0xd400012, 0xe2a41, 0x2b000001, 0x7800019,
+    0xa000009, 0xe2d85, 0x13d9c5, 0x12fd8c, 0xe2188, 0x70e3049, 0x212fa8f, 0x142f94,
+    0xdeb8c, 0x12f745, 0x800029, 0x8ce314f, 0x10c0000f, 0x12f989, 0xe32d2, 0xe3613,
+    0xe3854, 0xde9d5, 0xdf306, 0xdf547, 0x400008, 0xdebc9, 0x8c00012, 0x25000013,
+    0xdefcc, 0x100000d, 0x1c0def8e, 0x140001f, 0x6800008, 0x8c00012, 0x1c4e3a12, 0xdf193,
+    0xdfdd4, 0x30c0000d, 0x13d6ce, 0x8c0001f, 0x6800010, 0x10400029, 0x7c0002a, 0x2000000,
+    0x2000001, 0x142cc1, 0x2000003, 0x8e0a04, 0x1400013, 0xdf686, 0x1c8e0047, 0xe0548,
+    0x1000002, 0xd800012, 0x20e18cb, 0xe3ccc, 0xe0acd, 0xe3f4e, 0x140645, 0x20e1dd0,
+    0x1400011, 0xe45d2, 0xe2513, 0xe49d4, 0x20e1ad5, 0x2000016, 0x1c00010, 0xd80000e,
+    0xd400019, 0x8c00002, 0x1c0001b, 0x2000000, 0x198e20c1, 0x7400002, 0xe0a83, 0xe0f44,
+    0xe1185, 0x1ce0ec6, 0x2000007, 0x1c0000c, 0xdce2f89, 0x140000e, 0xe138b, 0xace4c8c,
+    0x200000d, 0xe4ece, 0x12c00002, 0x20e1090, 0x12c00004, 0xe51d2, 0xe3453, 0xa0e0c94,
+    0x1c00000, 0xe5781, 0xd000007, 0x1c00018, 0x1432c3, 0xe5b85, 0xfc00006, 0x1c00005,
+    0x1000006, 0xe3dc9, 0x1400012, 0x26c00010, 0xe4ccc, 0x10400015, 0x18c0000b, 0xe200f,
+    0x1c0000d, 0x13514e, 0x50e2c92, 0xe8e54d3, 0x15000014, 0xe17d5, 0x1c00013, 0x1c00000,
+    0x8ce4041, 0x1c00002, 0x329421c1, 0x1c00004, 0xe5b45, 0x1c00006, 0x1c00007, 0x20e26df,
+    0xe2d49, 0x142b0c, 0x1c0000b, 0x8c0000c, 0x1c0000d, 0x1c0000e, 0xe2ecf, 0x1400012,
+    0x7d41fcf, 0x28e1c92, 0x1c00013, 0xfce2654, 0xe36d5, 0x13ec01, 0x25143053, 0x12e345,
+    0xa000019, 0x1c0001a, 0x1000006, 0x8c00009, 0x1429cd, 0x80000e, 0xdce3adf, 0x140e5dc1,
+    0xd80000c, 0xe3383, 0xd400004, 0xe4dc5, 0x8c00012, 0xe3487, 0x8c00010, 0x8c00015,
+    0x1c00029, 0x100002a, 0x20e58cc, 0x80000d, 0xe620e, 0x8ce570f, 0xa0e3690, 0x5000001,
+    0xe3892, 0x20e38d3, 0xe60d4, 0xd400002, 0x14e3583, 0xa000004, 0xa0e4085, 0x142341,
+    0xe3b9a, 0x1c00008, 0x8ce4449, 0x142385, 0x5000001, 0xa0e680c, 0xe3bcd, 0xe43ce,
+    0xe478f, 0xe6950, 0x15800014, 0xe67d2, 0xe4693, 0xe6bd4, 0xe44d5, 0xe6cc1,
+    0x13800017, 0x5000018, 0xec0000f, 0xe6f45, 0x154e48c6, 0x141192, 0x10400008, 0xe4e49,
+    0x13bd84, 0x400005, 0x50e558c, 0x26d3bf47, 0x1000008, 0xe4f8f, 0xfc00010, 0x13e941,
+    0xe7112, 0xcce6f13, 0xd8e5094, 0xe5015, 0xe5ec1, 0x1000014, 0x134641, 0x14e76c1,
+    0xe75c5, 0x13eacb, 0x1347c5, 0x7ce8205, 0xe7689, 0x2740000f, 0xf800008, 0x7ce6009,
+    0x1c0001a, 0x12c5c7, 0x20e7bcf, 0x12c709, 0x13434f, 0xe838f, 0x12c74c, 0x16400029,
+    0x5000012, 0x118e6893, 0x1344d5, 0xe8695, 0x12c852, 0x8c0000e, 0x12c914, 0x11400019,
+    0x1180001a, 0x7800012, 0xcce7c5f, 0x5000001, 0x1180001f, 0x8c00003, 0x5000013, 0x1400001,
+    0xd800002, 0x1c00003, 0xe6084, 0xd400009, 0x1c00029, 0xe72aa, 0x1000008, 0x700002a,
+    0xd80002a, 0x1ce670b, 0xe874c, 0xe674d, 0xa0e79ce, 0x138493, 0x8c00014, 0x140dc1,
+    0x1ce6e92, 0xe6d93, 0xa0e7ed4, 0xd540cc5, 0x2500000c, 0x14000003, 0x142e85, 0x140e09,
+    0xe641a, 0x2000000, 0x4e8cc1, 0x4e9182, 0xe9583, 0x44e9884, 0xe7845, 0x8e9486,
+    0xe9b87, 0xe9dc8, 0x8e8b89, 0x8c00015, 0xe9f0b, 0x8ea60c, 0xeab4d, 0xeb04e,
+    0x27400013, 0x8e8010, 0x1000011, 0x4eb652, 0x8eb813, 0x20eba54, 0xebe95, 0x129c82,
+    0x25143454, 0x8e80d8, 0x26c00005, 0x800004, 0x1c0001b, 0x143c85, 0xec341, 0xd400002,
+    0x32c00002, 0x129d8c, 0xec545, 0x129e8e, 0x1040000d, 0x14244e, 0xe8d49, 0x12a012,
+    0x129c53, 0xea58c, 0xd000015, 0x200002a, 0xe750f, 0xecc41, 0x8c00010, 0xe8c92,
+    0xec453, 0xece05, 0x8c00015, 0x1420c8, 0xd800014, 0xe96c9, 0xe74d9, 0x1b000002,
+    0xa000003, 0x140fd044, 0x780000f, 0xea70f, 0x7c0000e, 0x800012, 0xea2d2, 0xe8d93,
+    0xd8e9994, 0xe7d15, 0x11937a85, 0xa00000e, 0x1c00003, 0x1c00004, 0x1d126405, 0xe7caa,
+    0x11400013, 0x100000c, 0x100000d, 0xe849f, 0xd400013, 0x500000c, 0x1000004, 0x7400012,
+    0xa00001b, 0x1000007, 0x8c00015, 0x5000012, 0x1260d3, 0x800029, 0xa000000, 0xed141,
+    0xebd82, 0xe8c03, 0xed4c4, 0x1400005, 0xed246, 0xa0e9e47, 0x1ced688, 0xeda89,
+    0x140001f, 0xa0e8e4b, 0xede8c, 0xee40d, 0xee98e, 0xeb8cf, 0xedf10, 0xd800001,
+    0xeef52, 0xef553, 0xec0d4, 0x8cef995, 0xe94d6, 0xeabd7, 0x1cc00018, 0x130a41,
+    0xe881a, 0x130c03, 0x7c00008, 0xe8781, 0x33400001, 0x1c0001f, 0x140000e, 0xe9fc5,
+    0xd4e8946, 0x130e4b, 0x800010, 0xe9809, 0xd5424d2, 0x8c00015, 0xee48c, 0xfc0000c,
+    0x1c0002a, 0xeb6cf, 0x130d94, 0x130bd5, 0xea252, 0xec6d3, 0xea494, 0x8c00015,
+    0x8c00012, 0x144285, 0xed481, 0x14334c, 0xe98da, 0xd400004, 0xefb85, 0x2a400001,
+    0x14398e, 0x8c00012, 0xeae09, 0x12eb45, 0xd400013, 0xefd0c, 0x26800014, 0xee54e,
+    0xef30f, 0x1c00000, 0x1cecb41, 0xef792, 0xefed3, 0x2700000f, 0xf0305, 0x7107482,
+    0x10a183, 0x12e753, 0x1c00009, 0xa000006, 0x800002, 0x7000008, 0x7c0000b, 0x7000000,
+    0xf02cf, 0x26c00013, 0xa00000d, 0xd400010, 0x1c00013, 0x1400001f, 0xe9d95, 0x112192,
+    0xdd2e389, 0x10d794, 0xd4e9b29, 0x12e60c, 0x8c0000d, 0x12e7ce, 0x25000014, 0x8c00029,
+    0x1c0001f, 0xd40000c, 0x1d2e853, 0xeb601, 0xea342, 0xee683, 0xed984, 0x8f05c5,
+    0xf0846, 0xa0f0b07, 0xe9ce9, 0x1c0002a, 0x700000a, 0xee9cb, 0x132ec1, 0xf0a8d,
+    0xf0f8e, 0xea4cf, 0x133745, 0xf1641, 0x3800012, 0x8f1293, 0x8f1354, 0xf1845,
+    0x500000f, 0x1c00004, 0xdc00018, 0xea689, 0x133a0f, 0xcc00008, 0xf19cc, 0xec00012,
+    0x28ea50e, 0xf1bcf, 0x8c00015, 0x800000, 0xede52, 0xf1e93, 0xf2094, 0xec715,
+    0x400006, 0x6400014, 0x6400015, 0x12c7c1, 0xf22c1, 0xdc00003, 0xd80000c, 0xdc00005,
+    0xf2485, 0xeac5f, 0xd800007, 0x12c589, 0x78ead89, 0xd140612, 0xd1406d3, 0x1407d4,
+    0x1447c1, 0x12c64f, 0x78eaf4f, 0x8c00029, 0xeaeaa, 0x25400013, 0xefd93, 0x5000014,
+    0x7800015, 0x7000000, 0x133d81, 0xf27c1, 0x7c00019, 0xd40001a, 0x11800004, 0xf2b85,
+    0x11c00002, 0x12400003, 0x6400004, 0xec3c9, 0x80000d, 0x8c0000c, 0x6400008, 0x8c0000e,
+    0x1340000f, 0xece8f, 0x11800010, 0xfc00012, 0x8ceb129, 0xee593, 0x11800014, 0xeb2d5,
+    0xf2dc1, 0x800015, 0x4000014, 0xd8ecc04, 0xf31c5, 0x5000006, 0x11800007, 0x143e85,
+    0xf1989, 0xebb1f, 0xd40000b, 0x800001, 0x7c00001, 0xd40000e, 0xf364f, 0x1000005,
+    0x7ced885, 0xd800006, 0xf23d3, 0xef614, 0xebcd5, 0x143e53, 0x1d43894, 0xef5cc,
+    0x400019, 0xd40001a, 0xedd0f, 0x500000f, 0x5000010, 0xeded2, 0xef353, 0xcc00014,
+    0x7c00015, 0x40000f, 0x8c00010, 0x1c00019, 0x27544405, 0x13a553, 0x2c53a714, 0xdc00010,
+    0x14ec0a9, 0x40002a, 0xf3502, 0x14ec303, 0xeca44, 0xfc00005, 0xed9c6, 0xeff87,
+    0xf0b48, 0xa0f0289, 0x25400013, 0xecd0b, 0xf20cc, 0xf3b0d, 0x8f3b8e, 0xed60f,
+    0xf1c90, 0x8c00008, 0x4f40d2, 0xf4053, 0xf45d4, 0xf0355, 0xf2cc1, 0xd400002,
+    0x1400003, 0x7000019, 0xf49c5, 0x70eda5b, 0x10400004, 0xf07c8, 0x8cee449, 0x500000d,
+    0xdc00002, 0x141bc3, 0xd40000d, 0xee70e, 0x8cf310f, 0x8d3b98d, 0x145a52, 0xd400012,
+    0xed853, 0xeebd4, 0x7800015, 0x5000001, 0x25000014, 0x13b5d5, 0xf4e81, 0xd40001a,
+    0xef4c3, 0x12400013, 0xf5205, 0x144c81, 0xeee9f, 0xf3848, 0xef589, 0x144cc5,
+    0xf548b, 0x500000f, 0xef7cd, 0xef9ce, 0x7cf258f, 0x8cf3d90, 0x15400005, 0x780002a,
+    0xd400013, 0xf5794, 0xf0415, 0xf5d41, 0x14450e, 0x12fe85, 0x7c00019, 0xf6185,
+    0xdc0000f, 0x144453, 0xf4b08, 0xf5c49, 0x12f9cc, 0x25000014, 0x13004e, 0x13018f,
+    0x5000002, 0xf438f, 0x5000009, 0xd130093, 0xf4612, 0xccf5013, 0xfc00014, 0xf6355,
+    0x14efd41, 0xf3242, 0xf0743, 0xf2544, 0x1180001a, 0xa0f6406, 0xf0807, 0xf1cc8,
+    0xf2c49, 0xf2a1f, 0x1d2dfc1, 0x5000008, 0x1cf684d, 0xf6e0e, 0x5000005, 0xf3c50,
+    0x500001f, 0x60f4552, 0xf6893, 0xf7214, 0x7c0002a, 0xd400004, 0xf3fc1, 0x25145914,
+    0x1c0000f, 0x70f095a, 0xf70c5, 0xd5444c5, 0x24800001, 0x13e70c, 0xf7289, 0x127144,
+    0x1269c5, 0xdd26786, 0x126b87, 0x5000012, 0xf480f, 0x11800014, 0x12c0000d, 0x143f4e,
+    0x500001f, 0xf5914, 0xf1715, 0x7000002, 0xf3bd7, 0x11400004, 0x8d27293, 0x70f15c6,
+    0x7000007, 0x1c00008, 0x5000029, 0x280002a, 0xf469f, 0x126fda, 0x700000d, 0xf680e,
+    0x144d55, 0x1c00010, 0x1c00011, 0x10f7752, 0xf6f53, 0xf4fd4, 0x8cf7355, 0xd400029,
+    0xf1b42, 0x1c00018, 0xf1744, 0x10400006, 0x9800006, 0x7800008, 0xa000008, 0x145d95,
+    0x80000f, 0x100000b, 0x20f77cc, 0xf270d, 0x2800029, 0xcc00010, 0x800015, 0xd400012,
+    0x400012, 0xf7893, 0xf2194, 0xd400006, 0xa000000, 0x11400001, 0x10f7b02, 0xf7bc3,
+    0xf71c4, 0x700001b, 0xf7ec6, 0xf80c7, 0xf3148, 0x114f5e89, 0x14520e, 0x10f834b,
+    0xf864c, 0xa0f888d, 0x4f8dce, 0x27400013, 0x10f7910, 0x1000011, 0x10f94d2, 0xf9693,
+    0xf9a14, 0x4f9e15, 0x4f37d6, 0x26c00005, 0xf3a98, 0x8c00019, 0x1c00000, 0xfa101,
+    0x147612, 0x12ecc1, 0x19400010, 0x10f3d05, 0x25800004, 0x12ed45, 0x28fa5c8, 0xd000007,
+    0x1c0000a, 0x145681, 0x6c0000c, 0x147812, 0xd400006, 0x1cf44cf, 0x148713, 0x8c0000f,
+    0x800012, 0x1c00013, 0xd54508c, 0x1c00015, 0xf7c41, 0xd4f7782, 0xf7f83, 0xf4984,
+    0xa0fa985, 0xf6586, 0x114f87c7, 0xa0fac88, 0xfb289, 0x5000015, 0xa0f560b, 0xfb7cc,
+    0xf894d, 0xfbbce, 0xf540f, 0xf6210, 0xa000011, 0xfc152, 0xfc713, 0xfb014,
+    0xfa015, 0x7000000, 0x8cfc5c1, 0x4fca18, 0x21509501, 0x145b0e, 0x8c00005, 0x5000001,
+    0x111c45, 0x7c00012, 0xf8f49, 0x140205, 0x107d09, 0x130601, 0x140288, 0x500000e,
+    0xfcccf, 0x130745, 0x10670f, 0x1d000012, 0x7000013, 0x1307c9, 0x7c00015, 0x1084d4,
+    0x1068d5, 0x2800005, 0x10ab97, 0x1309cf, 0x1442c8, 0x6400017, 0xd548885, 0x740000b,
+    0x7c0001f, 0xf8401, 0x10506b5f, 0x1d4f69c3, 0xd4f99c4, 0x124fce45, 0x10000006, 0x124fd0c7,
+    0x147041, 0x800001, 0x6c00029, 0xfd2cb, 0xfd7cc, 0xf930d, 0xfdace, 0xa0f6b0f,
+    0x1471c9, 0xd000002, 0xf7612, 0xfdfd3, 0x114f8cd4, 0x1305a9, 0xf9a96, 0x7000000,
+    0x28fde41, 0x7000002, 0xd40001a, 0x1400005, 0xfd5c5, 0x29c0000e, 0x145c08, 0x7c00008,
+    0xfe289, 0x13c412, 0xd400013, 0x28f93cc, 0x1481c9, 0x1e00000e, 0xfe48f, 0x1180000c,
+    0xd400013, 0xfa0d2, 0x1d800013, 0x1dcf8054, 0xfc0d5, 0x7000016, 0x10ae83, 0x6400008,
+    0x509605, 0xcc00012, 0x7d09007, 0x640000c, 0x34949486, 0xcc0000e, 0x700001f, 0x109c4c,
+    0x40000d, 0x109c0e, 0x13b313, 0x13b4d4, 0x6400015, 0x51493cf, 0x113093, 0x10a014,
+    0x7000029, 0x700002a, 0xa000000, 0xf8581, 0x18fcac2, 0x1400003, 0xdd49292, 0xf8c05,
+    0xf9b46, 0xa0f9007, 0xfc508, 0xa000009, 0x700002a, 0x640000b, 0xfebcc, 0xf910d,
+    0xa0fba0e, 0x500000f, 0xfd250, 0x8c0001f, 0xfef52, 0xa0fef13, 0xfa054, 0xfab95,
+    0xa000016, 0xa000017, 0x1000018, 0x2800005, 0xa0f935a, 0x1e40001b, 0x1c00000, 0xff481,
+    0x1c00000, 0x131201, 0x14b9d3, 0xff845, 0x1ec00006, 0x131385, 0xfec08, 0xffb49,
+    0x440000c, 0x1315c9, 0x1b0ffd4c, 0xc800015, 0x640000e, 0xfff4f, 0x7c00012, 0x1311cf,
+    0x100492, 0x6c00013, 0x1e800014, 0x100295, 0x100841, 0x25000015, 0xfda03, 0x7000019,
+    0x100d45, 0x5000008, 0x5000001, 0x149985, 0x100fc9, 0x8fd15f, 0xfabcb, 0x500000c,
+    0x7c0002a, 0x2ec00010, 0x10080f, 0x101190, 0xfa811, 0xd800014, 0xfcfaf13, 0x101494,
+    0xfe115, 0x8c00029, 0x400019, 0xd800012, 0x7c00019, 0x149101, 0x12c00004, 0x2000019,
+    0x25000008, 0x1494c5, 0x780001f, 0x7000000, 0x901c81, 0x1c00002, 0xf000003, 0x1c00004,
+    0x1022c5, 0x1c00006, 0x1c00007, 0x1cff148, 0x1028c9, 0x1c0000a, 0x1c0000b, 0x700000c,
+    0x1c0000d, 0x1c0000e, 0x902e0f, 0x1c00010, 0x1c00011, 0x9033d2, 0x1f0faad3, 0x15000014,
+    0x8d03bd5, 0x1c00016, 0x1cfaf57, 0x13600b, 0x1d01419, 0x1100001a, 0x135f8e, 0x135d4f,
+    0x5000012, 0x1400005, 0x45016df, 0x8d36153, 0x140688, 0xd000004, 0x25000005, 0x26528306,
+    0xd400003, 0x400006, 0x5000005, 0x600000f, 0x45032e9, 0x1015aa, 0xfb101, 0x1f4fe682,
+    0xa8fb1c3, 0xa000004, 0xfb445, 0x18fb686, 0x26128353, 0x1000008, 0xa0fb4c9, 0x400012,
+    0x8c0000b, 0xfbd0c, 0x103fcd, 0x8d0464e, 0x2500001b, 0x114fbb10, 0x6c00001, 0x1036d2,
+    0x140fba53, 0x78fc654, 0x104945, 0xa000016, 0x25000009, 0xd400005, 0xfcb49, 0xd80000c,
+    0x109903, 0x1800004, 0x13f74f, 0x9800006, 0x6c0000f, 0x140000c, 0x11800001, 0x29c00014,
+    0x380000b, 0x1072cc, 0x6c00015, 0xa00000e, 0x6c00017, 0x11800008, 0x8c00009, 0x145941,
+    0x106f13, 0xa000014, 0x11400002, 0x11400003, 0x700001f, 0x8c00010, 0x1c00012, 0x11400007,
+    0x4fc948, 0xd800014, 0x145bcc, 0x5000005, 0xa0fc80c, 0x100000d, 0xfce8e, 0x6c0002a,
+    0x6c00010, 0x1c00011, 0x10fcd92, 0x145995, 0x11400014, 0xfd1d5, 0xa000000, 0x70fcc41,
+    0x104f42, 0x10fdb83, 0x105444, 0xfd005, 0x1048c6, 0xa105687, 0xd4fd688, 0x105709,
+    0x5000008, 0x105acb, 0x105dcc, 0x1d0354d, 0x10630e, 0xd4fd8cf, 0x106610, 0xd400001,
+    0x106ad2, 0x107053, 0x1071d4, 0x107695, 0xa0fddd6, 0x14be41, 0xa0fe0d8, 0xd400013,
+    0xa00001a, 0xa000000, 0x19907c81, 0xff582, 0x100543, 0xfed04, 0x100c85, 0xffa06,
+    0xff547, 0x1d07888, 0x1080c9, 0xd400015, 0xff80b, 0x10878c, 0x108ccd, 0xa10924e,
+    0xff74f, 0x1041d0, 0x8c00008, 0x109cd2, 0xa106e93, 0xd503f94, 0x1081d5, 0xffd96,
+    0x101a17, 0x109418, 0x7000000, 0x990a101, 0x1c00002, 0x7c00013, 0x5000001, 0x4d0a545,
+    0x1c00006, 0x14bf88, 0x13d7c1, 0x450a989, 0x5000003, 0x1c0000b, 0xf00000c, 0x1dcff6cd,
+    0xf00000e, 0x450accf, 0x1c00010, 0x14bb85, 0x1a000012, 0x1c00013, 0xe800014, 0x105155,
+    0x1c00016, 0x13d910, 0x500000c, 0x800019, 0x14ed05, 0x13d694, 0x7800019, 0x14e985,
+    0x5000012, 0x1cffddf, 0xd800002, 0x108c81, 0xa000002, 0x1d00083, 0x502444, 0x10b205,
+    0x102546, 0xa104987, 0xd400008, 0x6c00029, 0x1c0002a, 0x10954b, 0x10b48c, 0x10978d,
+    0x10b90e, 0xa102a8f, 0xa100350, 0x100411, 0x105c92, 0xa10bc53, 0x10c194, 0x100b15,
+    0xa10aad6, 0x7c00005, 0x7d43846, 0xd000007, 0x10195a, 0xa000000, 0x102601, 0x10c2c2,
+    0x1503943, 0x12502f04, 0xd00000e, 0x101986, 0xa000007, 0x101bc8, 0xa103249, 0xa00000a,
+    0x19c0000b, 0xa102bcc, 0x10c44d, 0xa10c80e, 0xa00000f, 0x10c890, 0x7c00000, 0xa10cdd2,
+    0x10cfd3, 0x10ae54, 0x201044d5, 0x5000005, 0xa000017, 0x1c00000, 0x10d441, 0xa00001a,
+    0x7101e1b, 0x14f009, 0x10d9c5, 0x8c00001, 0x14f7c5, 0x6400008, 0xa10e009, 0x2190a5c5,
+    0x7000000, 0x12d741, 0x14bc14, 0x1c00009, 0x10e48f, 0x12d445, 0x1d1170c, 0x1c0000d,
+    0x200000d, 0x12d609, 0x10e9d5, 0x1400004, 0x115192, 0xd800013, 0xdc00019, 0x800015,
+    0x1505c1, 0x1400017, 0x10400004, 0x12dbd3, 0x10ed5f, 0x14494e, 0x8c00017, 0x20400022,
+    0x7000000, 0x10f441, 0xd400013, 0x104b03, 0x144a4e, 0x10f8c5, 0x10efa9, 0x10caea,
+    0x1544712, 0x107789, 0x800014, 0x7104c4b, 0x1c0002a, 0xa000000, 0x13abc1, 0x10fc8f,
+    0x110010, 0x13aec4, 0x8c00005, 0x20c00013, 0x20910154, 0x10505295, 0x110781, 0xcd02b17,
+    0x100000b, 0x7c00019, 0x110a45, 0x1400008, 0x7c00000, 0x1054c8, 0x7d06d49, 0x10729f,
+    0xa000013, 0x102ecc, 0x800003, 0x8c00004, 0x10364f, 0x800006, 0x150608, 0x103e92,
+    0x10cbd3, 0x800029, 0x103415, 0x80000c, 0x11400009, 0x11be0e, 0xcc00012, 0x1180001a,
+    0x1354b754, 0x11c8d2, 0x91cc93, 0x11c154, 0x103cdf, 0x7c00012, 0xa104141, 0xe904282,
+    0xa104743, 0x1d05504, 0xa104f05, 0x1d05bc6, 0x105a87, 0x7105948, 0x105d09, 0x7c0002a,
+    0x105c0b, 0x105fcc, 0x110f4d, 0x11154e, 0x8c0001f, 0x106250, 0x11800006, 0x111a52,
+    0xa10eb93, 0x106814, 0x7000002, 0x1400003, 0x7000004, 0x1400004, 0x800006, 0xa107cc7,
+    0x1c00008, 0x151352, 0x7000000, 0xd400007, 0x10870c, 0x13d06a8d, 0x10844e, 0x35c0000e,
+    0x3800010, 0x1c00011, 0x10b6d2, 0x8c00013, 0x908994, 0x108c15, 0x145c4c, 0x14b8d3,
+    0x1c00018, 0x7800002, 0x7400003, 0x107584, 0x2000012, 0x14a281, 0x8c00007, 0x1c0001f,
+    0x3140000c, 0x14aac5, 0x140000e, 0x11284c, 0x40000d, 0x10c60e, 0x1000012, 0x1400013,
+    0x1512c5, 0x10f112, 0x10a713, 0x10ddd4, 0x7c00015, 0x1086c3, 0x800004, 0x108b45,
+    0x400019, 0x800007, 0x800008, 0x1c00012, 0x80000d, 0x8c0000b, 0x11224c, 0x108e0d,
+    0xdd1378e, 0xd400013, 0x800010, 0x2000001, 0x113c12, 0x8c00001, 0x10e214, 0x114241,
+    0x800016, 0x1378c5, 0x14000018, 0x112285, 0x1d0e1c6, 0x14000009, 0x1180002a, 0x10bec9,
+    0xdc0000c, 0x200000f, 0x500000c, 0x137dc1, 0x148d92, 0x10a7cf, 0xd137d92, 0x137a05,
+    0x5000012, 0x10cc53, 0x1d11154, 0x108fd5, 0x114741, 0x137ecb, 0x137ccc, 0xfc00004,
+    0x114945, 0x2800005, 0xd511ec7, 0x108f88, 0x10ec89, 0x10d8df, 0x137d14, 0x91384c,
+    0x1360c5, 0x1b40000e, 0xd114c8f, 0x8c00001, 0x1362c9, 0x1149d2, 0x10e713, 0x750b1c5,
+    0x110995, 0x144c05, 0x8c0000f, 0x400009, 0x15148e, 0xd400013, 0x190b68c, 0x25800014,
+    0x280000e, 0x10b54f, 0x14000017, 0x144c4f, 0x400012, 0x1000003, 0x1151d4, 0x50b795,
+    0x7800005, 0x2800015, 0x9215c8, 0x2514f108, 0x800029, 0x80002a, 0x7c00008, 0x100000d,
+    0x40000e, 0xd50be1f, 0x400010, 0x1517c8, 0x400012, 0x10ff81, 0x10bd82, 0x121555,
+    0x112684, 0x1d14bc5, 0x15000006, 0x8c00029, 0x8c0002a, 0x10d5c9, 0x280002a, 0x10e38b,
+    0x11570c, 0x10c38d, 0x10c34e, 0x11400f, 0x10c7d0, 0x5000003, 0x800000, 0x110b13,
+    0x1145d4, 0x129642, 0x10c756, 0x1296c4, 0xdd29305, 0x26c00006, 0x10c71a, 0x151149,
+    0xdc00009, 0x115981, 0x400014, 0x10ca1f, 0x21c00004, 0x115cc5, 0x2000006, 0x2000007,
+    0x151192, 0x10f209, 0x25129253, 0x200000b, 0x200000c, 0x1d0d0cd, 0x80002a, 0x10ce4f,
+    0x10e090, 0x1297da, 0x2000012, 0x115f93, 0xfc00014, 0x10f755, 0xd000002, 0x7000000,
+    0x116201, 0x145fc1, 0x200001a, 0x116744, 0x7d16c85, 0xd50f806, 0x117047, 0x10d59f,
+    0x1172c9, 0xd400009, 0x1d1750b, 0x10d24c, 0xd54630c, 0x11088e, 0x111bcf, 0x8c00001,
+    0x25c00015, 0x2000012, 0xd517a53, 0x2117b14, 0xe10e815, 0x10e556, 0x2110d17, 0x400001,
+    0x800019, 0x1d1119a, 0xa000004, 0x1310f405, 0x115246, 0xa000007, 0x10e51f, 0xc800009,
+    0x151b45, 0x25400001, 0x10f60c, 0x25000012, 0xd000004, 0x25000005, 0x10eed0, 0xd000007,
+    0x50fe52, 0x12c309, 0x117dd4, 0x7000000, 0x518081, 0x10ff02, 0x1d0fe03, 0xd511784,
+    0x118485, 0x1d15686, 0x118707, 0xd12c513, 0x118989, 0x151714, 0x10fb8b, 0x500000c,
+    0x1123cd, 0x11050e, 0x391054f, 0xfc00010, 0x15158c, 0x1d10e52, 0x115f53, 0xd518b14,
+    0x7d111d5, 0x2943481, 0x1514d2, 0x7c00000, 0x800001, 0x118c5a, 0x7c00006, 0x951a88,
+    0x800005, 0x119001, 0x111559f, 0x111283, 0x800009, 0x119505, 0x14c5c1, 0x80000f,
+    0x8c00012, 0x1175c9, 0xd400005, 0x11150b, 0x1000029, 0xd40002a, 0x7c00013, 0x11924f,
+    0x119810, 0x8c00009, 0x111752, 0x118393, 0x119a54, 0x111815, 0x2400007, 0x280001f,
+    0x14bf13, 0x1400018, 0x1c0000b, 0x8d195cc, 0x51b3cd, 0x91940e, 0x119a81, 0x111d1f,
+    0x5000003, 0x11d312, 0x119f05, 0x1120c6, 0x1000015, 0x11a208, 0x112b89, 0x1000018,
+    0x1c00000, 0x11220c, 0x80002a, 0x152e93, 0xd11a24f, 0x152805, 0x7800003, 0x7113712,
+    0x711a753, 0x1139d4, 0x112b15, 0x8c0000f, 0x143549, 0x10400002, 0x1c00010, 0xcd15eda,
+    0xa000005, 0x800006, 0x7130807, 0x2800010, 0x112bdf, 0xa000000, 0xd000013, 0x11130c2,
+    0x1400003, 0x13084e, 0x500000c, 0x10000006, 0x1137c7, 0x130892, 0x1123a9, 0x7c0002a,
+    0x14dbc1, 0x11434c, 0x1400001, 0x11418e, 0x14dc45, 0x13df84, 0x2800005, 0x1136d2,
+    0x12d13a13, 0xcd1a794, 0x1000015, 0x116b01, 0xfc00002, 0x147885, 0x5000004, 0x26400014,
+    0x114486, 0x5000007, 0x11800008, 0x118d49, 0x5000015, 0xd000014, 0x11aa4c, 0x116a0d,
+    0x11ad0e, 0x113ecf, 0x147b52, 0x25400013, 0xdd1af92, 0xdd18d93, 0x5114554, 0x26c00005,
+    0x5000016, 0x5000017, 0x5000018, 0x1158c1, 0x145541, 0x8c00003, 0x115e04, 0x11b085,
+    0x145745, 0xd400007, 0x13e1cd, 0x1c00009, 0x2740000f, 0x93e250, 0x917c8c, 0x19147cd,
+    0x11860e, 0x3800014, 0x251453cf, 0x142d45, 0x1c0002a, 0x11b553, 0x145613, 0x5000009,
+    0xd400016, 0x2000001, 0x114f02, 0x118003, 0x511479a, 0x500000f, 0x115346, 0x2119d07,
+    0x2115308, 0x8c0001f, 0x140001f, 0x153445, 0x211bacc, 0x14f041, 0x11bd4e, 0x2800019,
+    0x8c00010, 0x5000005, 0x116f92, 0x211bfd3, 0x8c00001, 0x11c1c2, 0x115503, 0x11c0000d,
+    0x19915945, 0x116106, 0x211c247, 0x2115388, 0x11c6c9, 0x1c00000, 0x12da01, 0x11930c,
+    0x7c00003, 0x11ca4e, 0x7c00005, 0x12dc06, 0x1c00007, 0x11cd52, 0x11a553, 0x2117714,
+    0x118a03, 0x2000004, 0x8d1b245, 0x700000e, 0x6400019, 0x152753, 0x8d52d14, 0x12de92,
+    0x1612dc53, 0x11614c, 0x1164cd, 0x11d00e, 0x100000c, 0x4400003, 0x140000e, 0x22516892,
+    0x11ce93, 0x1194d4, 0x140312, 0x5000013, 0x2000000, 0xd400013, 0x9800002, 0xd40001a,
+    0x4400004, 0x2000005, 0x1190c6, 0x22c00007, 0x14ba92, 0x14c013, 0x1c00000, 0x132c01,
+    0x1d1938c, 0x8c0000d, 0x11d04e, 0x5132d85, 0x15198c3, 0x1d1d544, 0x115199c5, 0x4400013,
+    0x5000007, 0xd800012, 0x25000002, 0x7c00000, 0x8c00001, 0x11bf0c, 0xd40000d, 0x11a64e,
+    0x9437c5, 0x1d32b53, 0x1c00014, 0xcc00003, 0x2311d993, 0x119f94, 0x128b01, 0x11aa96,
+    0x151acc1, 0x11ac82, 0x8c0000f, 0xd000013, 0x11d845, 0x11ab46, 0xdd28a09, 0xf800008,
+    0x11b309, 0x128acc, 0x128d0d, 0x128c0e, 0x2700000f, 0x7c0001a, 0x12d1b28f, 0x128dd2,
+    0xdd28c93, 0x11bc12, 0x11800013, 0x5000002, 0x11c595, 0x1c00002, 0xb11ba83, 0x25000013,
+    0x148f81, 0x8c00008, 0x800007, 0x1400008, 0x148d45, 0x16400004, 0x1051b51f, 0x11bdcc,
+    0x740000d, 0x11d94e, 0x7800019, 0xd54f412, 0xd51df41, 0x11be52, 0xec00013, 0xd400014,
+    0x19800005, 0x800006, 0x7c00000, 0x144101, 0x11e089, 0x500001a, 0x149157, 0xf80000c,
+    0x1c00019, 0x150905, 0xd00000f, 0x8c0000e, 0x134101, 0x150a89, 0x1b400013, 0x5000014,
+    0xd51cad5, 0x11d2c1, 0x1c00010, 0x8c00003, 0x134189, 0x1411d505, 0x144314, 0x28d3448c,
+    0x7800008, 0x8c00012, 0x13408f, 0x5000014, 0x1b40000c, 0x11db0d, 0x134753, 0x1340d4,
+    0x11e010, 0x1c00000, 0x14e0c1, 0x154d85, 0x11e394, 0xd51de95, 0x14e285, 0x191e202,
+    0x1400003, 0x1800004, 0x780001a, 0x1000006, 0x11e287, 0x1151e4c8, 0x7000006, 0xcc00007,
+    0x651e3cb, 0x111e48c, 0x180000d, 0x751eace, 0x26c00001, 0x11e610, 0x400011, 0x51e992,
+    0x111e813, 0x7d1e7d4, 0x11ed55, 0xa000000, 0x800004, 0x11ecc2, 0x151ec43, 0x155385,
+    0x12d1eb05, 0x11ee86, 0x11f047, 0x11efc8, 0x11f109, 0xd40000d, 0x25d5048e, 0x11f40c,
+    0x11f0cd, 0x11f98e, 0x11ed0f, 0x10400015, 0x150554, 0x11fd92, 0x120253, 0x11f394,
+    0x11ffd5, 0x27400015, 0x11f241, 0x1cc00018, 0x11f583, 0x11f704, 0x11f785, 0x1c00000,
+    0x131d01, 0x37000009, 0x16400006, 0x2600000b, 0x131c45, 0x92028c, 0x11f50d, 0x12070e,
+    0xec0000f, 0x8c00002, 0x8d506ce, 0x11f8d2, 0x120113, 0x120b14, 0x150652, 0xd400016,
+    0x11f941, 0x1000002, 0x131e13, 0x1555d3, 0x2cd31995, 0x400006, 0x120207, 0x1000008,
+    0x25c00019, 0x150cd2, 0x150dd3, 0x11fdcc, 0x144b05, 0x12088e, 0x8c0000f, 0x120010,
+    0x2000009, 0x1920552, 0x11fe13, 0x8c0000c, 0x1000015, 0x5000001, 0xd800002, 0xa120c83,
+    0xd920d84, 0x120e05, 0xfc00006, 0x121007, 0x120d08, 0xd400009, 0x1551c5, 0x500000b,
+    0xd40000c, 0x12144d, 0x12190e, 0xd40000f, 0x121090, 0x121e01, 0x121992, 0xfd21213,
+    0x119211d4, 0x122145, 0x1552c9, 0x148b01, 0x1c00004, 0x122089, 0xd40001a, 0x148c85,
+    0x1800002, 0x1000003, 0x148dc8, 0x100000f, 0x1000006, 0x1800007, 0xac0000e, 0x1000009,
+    0x2000000, 0x120ed5, 0x12264c, 0x12170d, 0x12268e, 0x147d85, 0x1800010, 0x5000002,
+    0x122812, 0x122253, 0x155687, 0x120f5f, 0x10400001, 0x200000d, 0x1000018, 0xd400004,
+    0x122b45, 0x141d4c, 0x141acd, 0x941f4e, 0x2000014, 0x121269, 0x100002a, 0xf80000c,
+    0x141cd3, 0x8c0000e, 0x25141c55, 0x1400001, 0x155552, 0xf922c12, 0x122a13, 0x6522d05,
+    0x11400000, 0x93a481, 0x1556d4, 0x522cc9, 0x4400019, 0x800005, 0x12308c, 0x1c0000d,
+    0x1230ce, 0x5000009, 0x440001f, 0x155713, 0x1d23012, 0x1c00013, 0x1c00014, 0x400015,
+    0x1c00001, 0x1400017, 0x400001, 0x123182, 0x7d23105, 0x8c00015, 0xd400001, 0x100001a,
+    0x123489, 0x1800005, 0x150ac5, 0x1c0000c, 0xd122ecb, 0x12340c, 0x1232cf, 0x1d23510,
+    0x151e0c, 0xec00010, 0x8c00013, 0x1234d4, 0x123453, 0x123394, 0x400015, 0x1c00000,
+    0x1c00007, 0xd53dd41, 0x25400002, 0x123584, 0x99233c5, 0x23d23206, 0x123687, 0x1d3d441,
+    0x5800009, 0x37800013, 0x12378b, 0x1c00005, 0x380000c, 0x12364e, 0x5000008, 0x13d009,
+    0x1000010, 0x155405, 0x1d23993, 0x1236d4, 0x3193e114, 0x13d24f, 0x7c00012, 0xd400013,
+    0x7c00014, 0x1c0001a, 0x18123a41, 0x1239c2, 0x1400003, 0x1d23b44, 0x1d23b85, 0x1238c6,
+    0x123cc7, 0xcc00000, 0x123ac9, 0x800001, 0x123e0b, 0x1d25f43, 0x123f4d, 0x125f85,
+    0x12404f, 0x5000029, 0x140002a, 0x123e92, 0x123fd3, 0x1d24114, 0x1c0000c, 0x15544c,
+    0x8c0000f, 0x140000c, 0x800010, 0x212415a, 0xcc00013, 0x126153, 0x926214, 0x7c00015,
+    0x140001f, 0x14f085, 0x1d24982, 0x1400003, 0x5124204, 0x1247c5, 0xe000006, 0x21249c7,
+    0x1040000c, 0xec00002, 0x400029, 0x80002a, 0x1c0000c, 0x1d24ccd, 0xe124c8e, 0x14eed3,
+    0x153803, 0xd400004, 0x11124412, 0x124e93, 0x124dd4, 0x14090e, 0x17400000, 0xa000000,
+    0x12c00001, 0x140c12, 0x27d40a13, 0x200001b, 0x125485, 0x125606, 0x13b404, 0x13b445,
+    0x125409, 0x13b2c7, 0x12570b, 0x12584c, 0xa00000d, 0x1256ce, 0xd40000f, 0x25000012,
+    0x13b64e, 0xcc0000f, 0xd525893, 0x1253d4, 0x2000015, 0x13b613, 0x13b214, 0x14e405,
+    0x2500000e, 0x1254da, 0x11800001, 0x125942, 0x1400003, 0x1258c4, 0x125c45, 0x125ac6,
+    0x125b07, 0x14e34f, 0x1257c9, 0x8d53605, 0x125b4b, 0x1000006, 0x7c00007, 0x125a0e,
+    0x12c0000f, 0x125d90, 0xd40000c, 0x10400001, 0x125ed3, 0x125f14, 0xd925d15, 0x126685,
+    0x126246, 0x500001f, 0x151dd3, 0xf800009, 0xd400005, 0xd400006, 0x500000c, 0x12c248,
+    0x12bc09, 0x80000f, 0x5000005, 0xd00000c, 0x1c0002a, 0x12c08e, 0x1263d4, 0x126395,
+    0x11800001, 0x12c392, 0xd52bf13, 0x14151b89, 0x526945, 0x1000010, 0x143bc5, 0x140000d,
+    0x10000009, 0x1040001f, 0x1439c9, 0x126bcc, 0x1261cd, 0x126b0e, 0x12c0000f, 0x8c00001,
+    0x500000f, 0x126b52, 0x1526993, 0x119268d4, 0x400015, 0x1400001, 0x1400017, 0x131745,
+    0x2931786, 0x1271c5, 0x127346, 0x126d87, 0xd800014, 0x8c0000f, 0x13164c, 0x12758b,
+    0x7c0001f, 0x1c0000f, 0x800005, 0x24d273cf, 0x5000012, 0x14000017, 0xd400012, 0x8d27753,
+    0x1277d4, 0x1281c1, 0x8c00029, 0x151f0e, 0x25528204, 0x127e85, 0x12771a, 0x25128087,
+    0x400013, 0x127f09, 0x8c00001, 0x2580000b, 0xec00001, 0xd000002, 0x1283ce, 0xd000004,
+    0x12cfc5, 0x26c00006, 0x25400007, 0x25528253, 0x6c00000, 0x500000b, 0x2580000b, 0x6c00003,
+    0x513a181, 0xdc00005, 0x2540001a, 0x13a344, 0x13a305, 0x12d249, 0x8c00015, 0x25800014,
+    0x13d2d18c, 0x452d301, 0x12ce8e, 0x13a14c, 0x156205, 0x12d405, 0x1d2d352, 0x712d2d3,
+    0x9800014, 0x512d389, 0x25400004, 0x1c00017, 0x8c00015, 0xd000007, 0x1c00000, 0x1c0000f,
+    0x5000008, 0x5000001, 0x13104c, 0xd00000b, 0x800000e, 0x1c00015, 0xf800010, 0x2740000e,
+    0x5000010, 0xdd2d5c1, 0x1c00002, 0x153112, 0xfc00014, 0x52d945, 0x1c00006, 0x440001f,
+    0x1140001a, 0x112cf49, 0xd40000c, 0x800001, 0xd00000c, 0x28c0000d, 0xd00000e, 0x52dacf,
+    0x800006, 0x4400029, 0x28c00012, 0x12db53, 0xcd2de54, 0x52d515, 0x1c00016, 0x16000017,
+    0x14ae05, 0x800019, 0x800010, 0x151645, 0x14ae49, 0xd000013, 0x1c00000, 0x8c00009,
+    0x7000002, 0x800003, 0x800004, 0x14000001, 0xd800014, 0x8c00007, 0x2514ab93, 0x12e305,
+    0x8c00012, 0xd000029, 0xd00002a, 0x12dc8d, 0x1040000e, 0x7c00000, 0xa000010, 0x800000,
+    0x29000012, 0x1400000f, 0x1c00014, 0x1052add5, 0xd12e552, 0x12e0d3, 0x7c00000, 0x12e255,
+    0x2b400002, 0x1577ce, 0x2b800004, 0x14c0000e, 0xd80000d, 0x12f301, 0x1c00002, 0x1000010,
+    0x7c00013, 0x12f105, 0x1c0000c, 0x640000d, 0x1578cc, 0x12f189, 0x7c00019, 0x7800001,
+    0x1c00012, 0x1c0000d, 0x292f094, 0x8c00029, 0x1c00006, 0x1c00007, 0xed2f252, 0x12f293,
+    0x200001a, 0x7c00008, 0x8c0000c, 0x1c00017, 0x1c00000, 0x7c0000c, 0x12f342, 0x8c0000e,
+    0x8c00012, 0x1000013, 0x1400006, 0x12f487, 0x156085, 0x1c00009, 0x2000001, 0x12ef4b,
+    0x7000003, 0x140000d, 0x12f70e, 0x1180000c, 0x12f2d0, 0x8c00029, 0x12f852, 0xd52f653,
+    0x12f914, 0x152f815, 0x12f501, 0x13d18e, 0xd400005, 0x13cf90, 0x12f5c5, 0x13ce12,
+    0x13ce93, 0x6c00000, 0x12f941, 0x152fb42, 0x1400003, 0x1400000c, 0x14cf4f, 0x1b400006,
+    0x12f88f, 0xd800012, 0x1052fd49, 0x12f592, 0xd000013, 0x1040000c, 0x12fe0d, 0x25d2ff4e,
+    0x7000000, 0xd52fad0, 0x800002, 0x1301d2, 0x712fdd3, 0x80000d, 0x10400015, 0x130c81,
+    0x12f6df, 0x12fc98, 0x155152, 0x130c45, 0x1c0000c, 0x11400014, 0x2bd30ece, 0x130cc9,
+    0x80000d, 0x14cfea, 0x1313d2, 0xdd31253, 0x7c00014, 0x130d0f, 0x1c00013, 0x5000014,
+    0x131112, 0x130b93, 0x1c00002, 0x1c00015, 0x11400005, 0x25800002, 0xd53d286, 0x100000d,
+    0x1400008, 0xec00006, 0xd000007, 0x5000003, 0x13d40c, 0x200001f, 0x12c0000b, 0x132b81,
+    0x93114d, 0x132dc3, 0x13d3d2, 0x8c00013, 0x1c0001a, 0x1400012, 0x7c00013, 0x8c00029,
+    0x5000001, 0x132bcb, 0x7131603, 0x8c00001, 0xa000005, 0x149603, 0x133090, 0x11800008,
+    0x2000000, 0x2c131301, 0x2132d14, 0x149509, 0x25157588, 0x131685, 0x500000f, 0x5000010,
+    0x1180001a, 0x131509, 0x149550, 0x8c00015, 0x5000015, 0x2840001f, 0x8c00014, 0x2c53134f,
+    0x14e101, 0x800010, 0xed31952, 0x8c00012, 0x514e045, 0x14000015, 0xcc00004, 0x1c00000,
+    0x5000009, 0x1c00002, 0xd000003, 0x7131804, 0x157814, 0x136a41, 0x8c00007, 0x1400001f,
+    0x1554d4e, 0x137045, 0x640000b, 0x131a0c, 0x131bcd, 0x1d31c0e, 0x15474d, 0x1040000e,
+    0x700000c, 0x8c00029, 0x2c800013, 0x131cd4, 0x131b95, 0x7000000, 0x7000012, 0x150d81,
+    0x11800003, 0x5000015, 0x7c00005, 0x11800005, 0x1c00000, 0x131e81, 0x132289, 0xd400009,
+    0x2d00000b, 0x5000005, 0x131d4d, 0x700000e, 0x100000c, 0x1c00009, 0x280000a, 0x132312,
+    0x131f4c, 0x131e54, 0xd00000b, 0x131acf, 0x80000d, 0x152c8e, 0x1322d2, 0x1c00013,
+    0x8c00001, 0x11800015, 0x8d3c303, 0x147441, 0x1c00000, 0x132341, 0x157945, 0x147505,
+    0x13c089, 0x132705, 0x14000001, 0xa00001f, 0x1c00008, 0x132189, 0x14be05, 0x14000010,
+    0xdd3248c, 0xd5476cf, 0xd00000e, 0x157bc5, 0x8d3c1d5, 0x280000c, 0xdd325d2, 0x132393,
+    0x26c00014, 0xd000004, 0x132545, 0x8c00012, 0x25400007, 0x157b05, 0x1c00010, 0xc0000c,
+    0x13240b, 0x8c0001f, 0x1240000d, 0x13278e, 0xd53220f, 0x1c00000, 0x1329c1, 0xfc00014,
+    0x132513, 0x1c00000, 0x132845, 0xd000002, 0x152f81, 0x1400004, 0x1c00009, 0x1c00006,
+    0x1c00007, 0x13210c, 0x27400009, 0x13264e, 0x13290f, 0x7d32f4c, 0x4532b0d, 0xdd32a92,
+    0x1d32ad3, 0x1c00014, 0x500000f, 0x10400012, 0x6400013, 0x1c00000, 0x132d41, 0x136181,
+    0x13dd81, 0x2800013, 0x132f05, 0x5000005, 0x93dd05, 0x1331c8, 0x133149, 0x7135e49,
+    0x7800009, 0x158115, 0xc80001f, 0x400007, 0x1d32f8f, 0x1363cf, 0x780000f, 0x2133112,
+    0x1c00002, 0x13e0d2, 0x1c00004, 0x133245, 0x2000017, 0x1c00007, 0x1c00008, 0x1332c9,
+    0x1584cd, 0x1c0000b, 0x200001d, 0x1c0000d, 0x1180001f, 0xf80001f, 0x80001f, 0x8c00005,
+    0x1c00012, 0x1c00013, 0x1c00014, 0xcc00009, 0x1c00016, 0x1d33297, 0xec0000c, 0x1c00019,
+    0x500002a, 0x8c0000f, 0x14b845, 0x14e201, 0x2800012, 0x8c0001f, 0x7c00000, 0x514e1c5,
+    0x8d33642, 0x14bbcc, 0x25533304, 0x1582cc, 0x14ba0f, 0x133447, 0x1c00000, 0x1d33681,
+    0x213302a, 0x14decf, 0xf9335cc, 0x133ac5, 0x1d3358e, 0x158412, 0x1d33490, 0x7000009,
+    0x1c00012, 0x7d333d3, 0x980000c, 0x10400015, 0x14b89f, 0x1c0000f, 0x18c00001, 0x400002,
+    0x2c9337d2, 0x2d533713, 0x2b400014, 0x1c00015, 0x9339c1, 0x2d800002, 0x8c00001, 0x500000e,
+    0x25000005, 0x133886, 0x1433c5, 0x1338c8, 0x133cc9, 0x400010, 0x143309, 0x133d4c,
+    0x700000d, 0x133f0e, 0x1c00008, 0x8c00001, 0x80000f, 0x134052, 0x800004, 0x133e45,
+    0xd000015, 0x143414, 0x2a400015, 0x135dc1, 0x500001f, 0x159289, 0x5000001, 0x135f45,
+    0x13420e, 0x7c0000f, 0x2800005, 0x135d09, 0x8c00012, 0x2933b93, 0xa00000c, 0x7c00015,
+    0x7134783, 0x12c00004, 0x15318d, 0x1534986, 0xcc00012, 0x8c00002, 0x7c00001, 0x8c00015,
+    0x150301, 0x7c0000c, 0xd00000d, 0x2500000e, 0x1507c5, 0x16400010, 0x1c0000b, 0x800012,
+    0x27400013, 0x134881, 0x1c00002, 0x1348c1, 0x7c0000f, 0x11934ac5, 0x15040f, 0x1c00005,
+    0x134c08, 0x11800009, 0x1568d2, 0x1c00009, 0x8c00001, 0x1400015, 0x136243, 0x1c0000f,
+    0x8c00005, 0xfc00001, 0xd134b92, 0x1d34953, 0x8c00009, 0x134cd5, 0x2134d54, 0x1c00015,
+    0x5000008, 0x14000017, 0x1400000f, 0x14000010, 0x5000002, 0x1b400001, 0x5000001, 0x136054,
+    0x1400006, 0x8c0001f, 0xf800006, 0x7c00007, 0x8d51994, 0x2800019, 0x11c0000c, 0x11c0000d,
+    0x8c0000c, 0x140000d, 0x12c00010, 0x8c00029, 0x1400012, 0x150e01, 0x134a92, 0xd400013,
+    0x5000014, 0x134e95, 0xcc00002, 0xcc00003, 0xcc0001a, 0x150fc9, 0x2a000006, 0xf135481,
+    0x159509, 0x134f89, 0x7c00015, 0xd535345, 0x5000010, 0x134ecd, 0x13520e, 0x11800009,
+    0x26d51294, 0x1351cb, 0x8d35012, 0x2800013, 0xd800014, 0x500000f, 0x1352d0, 0xf135441,
+    0xcc00018, 0x1593c1, 0x8d35694, 0x5135585, 0x5000003, 0x1000002, 0x2e000008, 0x135949,
+    0xd400005, 0x400006, 0x151081, 0x1000008, 0xd40000d, 0x51356cf, 0x951045, 0x25800006,
+    0x535992, 0x135ac2, 0x13a44f, 0x135715, 0x155fd3, 0x14000006, 0x2e400007, 0x1000014,
+    0x200000f, 0x1000016, 0x13530b, 0xd00000c, 0x7c0000d, 0x7c0001f, 0x148a85, 0x135b10,
+    0x12400003, 0x7000004, 0x135c13, 0x135814, 0x10535d95, 0x800002, 0x7c00003, 0x8c00018,
+    0xd400001, 0x148b50, 0x1597aa, 0x7c0000e, 0x135c89, 0x148d14, 0x148b95, 0x135bcc,
+    0x135ccd, 0x8d35e8e, 0x7c00015, 0x800010, 0xfc00004, 0x135ed2, 0x7135b53, 0x7c00014,
+    0x8c00015, 0x51366c1, 0x800017, 0x8c00018, 0x5000015, 0x136885, 0x14098e, 0x159989,
+    0x136088, 0x8d36941, 0x140512, 0x1409d3, 0x140854, 0x136e45, 0x26c00006, 0x700000f,
+    0xd400001, 0x1369c9, 0x136212, 0x25800013, 0x1364cc, 0x11800015, 0x200000e, 0x1c0000f,
+    0x28000012, 0x136c01, 0x6400003, 0x136bd3, 0x25936dd4, 0x136e05, 0x11800001, 0x8c0001f,
+    0x251434c5, 0x137109, 0xd537185, 0x7c00008, 0xd400001, 0xcc0000e, 0x137089, 0xdd36ccf,
+    0x25400010, 0x158206, 0x15a195, 0x2ac00013, 0x8c0000f, 0x136f95, 0x25400013, 0x33800014,
+    0x27400015, 0x800007, 0x5000015, 0x800013, 0x11800008, 0x15b485, 0x137301, 0xcc0001a,
+    0x1d37383, 0x2000004, 0x1375c5, 0x2000006, 0x2000007, 0x1040000c, 0x137289, 0x15138e,
+    0x158454, 0x200000c, 0xa000000, 0x151692, 0x8d371cf, 0x137250, 0xd400001, 0x2000012,
+    0x1376d3, 0x137754, 0x25000005, 0x1c00000, 0x2000017, 0x1c00002, 0xd400005, 0x200001a,
+    0x1d37605, 0xd400004, 0x1c00007, 0xa00000e, 0x2500000e, 0x1c00008, 0xa15988d, 0x1000012,
+    0xcc00003, 0xd80000c, 0x200000f, 0x1c00006, 0x15b4d2, 0x136e92, 0x2d400013, 0xa00002a,
+    0x1400013, 0xd400001, 0xcc0000d, 0x13b74e, 0x11538004, 0x11800005, 0x1c00006, 0x537c87,
+    0x26d3b393, 0x13b794, 0x13749f, 0x1380cb, 0x1c0000c, 0x1c00004, 0x13814e, 0xd40000f,
+    0x1c00001, 0x80000b, 0x1381c1, 0x2e800013, 0x2ec00014, 0x138084, 0x1382c5, 0x1c00017,
+    0x7c00012, 0xd400013, 0x40001a, 0x1000000c, 0xa000000, 0x26c00014, 0xd000002, 0xd00000e,
+    0x80000f, 0x138105, 0x138406, 0x25400007, 0x12138293, 0x15b392, 0x15a2d4, 0x80000b,
+    0x25800002, 0x1000003, 0x7c00004, 0x537e5a, 0x1c0001a, 0xd000002, 0xd000012, 0xdd384d3,
+    0x138845, 0x2f000006, 0x138a47, 0x152fc1, 0x13a78e, 0x5000015, 0x2580000b, 0x138bcc,
+    0x138c0d, 0x138b8e, 0x13a694, 0x13a8d5, 0x138d01, 0x6400017, 0x138d53, 0x138914,
+    0x138c45, 0xd000006, 0x14000010, 0x15b885, 0x11938e09, 0x139241, 0x1531d4, 0x138f4c,
+    0x14000001, 0x9390c5, 0x138ccf, 0xa000007, 0x5145d45, 0x138e89, 0x1389d3, 0xd000014,
+    0x138d95, 0xd400007, 0xd00000e, 0x15b349, 0x17400010, 0x1c0000e, 0x500000f, 0x938fd3,
+    0x139714, 0x139015, 0x2800013, 0xa000000, 0x15bc94, 0x15ca8c, 0x2540001a, 0x7c00000,
+    0xd400005, 0xd400002, 0x1539601, 0x25000002, 0x1390a9, 0xd000004, 0xcd399c5, 0x26c00006,
+    0x139b07, 0x1393c8, 0x139109, 0x13bacc, 0x13920b, 0x2693bb0e, 0xa000013, 0x1394ce,
+    0x31d3e545, 0x13ba92, 0x7800013, 0x7c00014, 0x1398d3, 0x139cd4, 0xcc00015, 0x6c0000c,
+    0x700000d, 0x11939bc1, 0x13e5cf, 0x13969a, 0xd400013, 0x139585, 0x13e393, 0x13e814,
+    0x144e8c, 0x139b89, 0x8d4500e, 0x7c00000, 0x139c4c, 0x15cb05, 0x144e52, 0x144d13,
+    0x139d50, 0xdc00015, 0x8c00029, 0x139f53, 0x13a114, 0x12000001, 0x7c00002, 0xa000003,
+    0x1240000d, 0x15388e, 0x139d9a, 0x7c00007, 0x1c00008, 0x13a909, 0x26c00014, 0x13a7c3,
+    0xd00000c, 0x93a945, 0x13a6ce, 0x1c00007, 0x25c00013, 0x80000c, 0x80000d, 0x13a813,
+    0xcc00014, 0x7c00015, 0x13a88e, 0x1400012, 0x1c00013, 0xa000000, 0x13acc1, 0x93ab53,
+    0x93aa94, 0x13b044, 0x13ae85, 0xcc00000, 0xdc00003, 0x7400001, 0x13b009, 0x6400004,
+    0x93c347, 0x8c00005, 0x11800009, 0x1e800008, 0x800005, 0x25000008, 0x2f80000b, 0x1c0000e,
+    0xd400013, 0x53b0d4, 0x13b095, 0x11800005, 0x13c393, 0x13c014, 0x13ae13, 0x13b354,
+    0x151754, 0x11400015, 0x1c00000, 0x1000014, 0x280001f, 0x13b183, 0x6400004, 0x15a3c8,
+    0x6400006, 0x1c00007, 0x159f4b, 0x13b249, 0x158143, 0x1c0000b, 0x13b1cc, 0x1240000d,
+    0x13b10e, 0x1c0000f, 0x6400010, 0x13bd01, 0xcc00012, 0x1952b01, 0x13b154, 0x13b6c5,
+    0x5000005, 0xa000005, 0xd000008, 0x13bd49, 0x1c00013, 0x1c0000a, 0x15cd06, 0xd40000c,
+    0x1c00017, 0x7d3be8f, 0x1d3c502, 0x13c583, 0x13c212, 0x7400001, 0x1c00006, 0x14400007,
+    0x152dd4, 0x140d05, 0x1400000f, 0x680000b, 0x13c48c, 0x140a89, 0x13c88e, 0xa00000f,
+    0x100000c, 0x7d3b81f, 0x13cad2, 0x13c653, 0x13c794, 0x13c755, 0x1000012, 0x155343,
+    0x500000e, 0x155585, 0x5000010, 0x7c00029, 0x7d3bb6a, 0x2593c7c2, 0x13c6c3, 0x13c844,
+    0x640000c, 0x213ccc6, 0x14151c01, 0x1c00008, 0x1d3c9c9, 0x1521c4, 0x1520c5, 0x13cc0c,
+    0x13cb4d, 0x13cd0e, 0x1c00006, 0xec00012, 0x1c00008, 0x13ce52, 0x13cb93, 0x13cd94,
+    0x1400000f, 0x1c0000d, 0x13d64e, 0x15000018, 0x151f93, 0x25151e94, 0x1d3d392, 0x2000000,
+    0x1d3d4d4, 0xe800002, 0xe800003, 0x8c00004, 0x159a8e, 0x15d0cd, 0xb000007, 0x12c00001,
+    0x1400001f, 0x1400013, 0x143fc1, 0x1c0000c, 0xd40000d, 0x1c0000e, 0x15ca0c, 0x1c00010,
+    0x2500000e, 0x27800012, 0x1d3d786, 0x2000014, 0x6800008, 0x30400009, 0x1c00010, 0x14424e,
+    0x2500000f, 0x13d60d, 0x13d88e, 0xd544392, 0x143f13, 0x15b508, 0x13da52, 0x13d813,
+    0x15b54b, 0x800013, 0x1c00000, 0x146581, 0x7000018, 0x11400000, 0x53e081, 0x1c00002,
+    0x13e203, 0x3193e404, 0xa13e045, 0x1c00006, 0x400007, 0x1c00008, 0x800015, 0x10400006,
+    0x93e2cb, 0x145f8f, 0x1d46390, 0x13e44e, 0x740000f, 0x1466d3, 0x500000d, 0x146455,
+    0x1000013, 0x142d82, 0x7942dc3, 0xd400004, 0x1c00017, 0xf800014, 0x8c00007, 0x13e4da,
+    0x14000001, 0x2d400002, 0x6400003, 0x13e504, 0x2513e345, 0xd40000e, 0xd000007, 0x400006,
+    0x7c0000c, 0x1400006, 0x7800013, 0xa00000c, 0x13e78d, 0x7c00010, 0xec0000f, 0x8c00018,
+    0x1040000d, 0x7c00014, 0xa000013, 0x113e614, 0x8c00015, 0x1400012, 0x148e13, 0xd548cd4,
+    0xa000002, 0x40001a, 0x1c00004, 0x2553e585, 0x32400006, 0x6400007, 0x5000001, 0x147ec1,
+    0xcc0000c, 0x1c0000b, 0x10400004, 0x6548205, 0x13e68e, 0x1c00007, 0x11400003, 0x1d3eb44,
+    0x7000005, 0x32000013, 0x1c00007, 0x80000d, 0x1484ce, 0xdc00010, 0x15e2cc, 0x500000c,
+    0x1153ebcd, 0x13ecce, 0x1483d4, 0x13edc1, 0x25400002, 0x25000005, 0x13ec53, 0x13f005,
+    0x13ee06, 0x153389, 0x15e34f, 0x13eb89, 0x13ed41, 0x1000002, 0x13eecc, 0x2715324f,
+    0x13ee85, 0x13ef4f, 0x25000013, 0x800012, 0x13f049, 0x13f313, 0x25800014, 0x143b43,
+    0x154d01, 0x25000005, 0x13ef0f, 0x1000010, 0x154dc5, 0x143a09, 0x800000, 0x13f181,
+    0x154f49, 0x13ed9f, 0x25000004, 0x13f405, 0x143d90, 0x13f447, 0x500000f, 0x8c00009,
+    0x143dd4, 0x13f24b, 0x7c00008, 0x1400005, 0x154ed5, 0x13f10f, 0x15c988, 0x154f64d,
+    0x14fa8e, 0x13f713, 0x13f814, 0x5000015, 0x1400012, 0xcc00000, 0x13f8c1, 0x13f7c2,
+    0x13f51a, 0x13fa04, 0x13fc85, 0x26d3f846, 0x1400008, 0x12a288, 0x13f789, 0xcc0000e,
+    0x2553fb0b, 0xd550703, 0x80000d, 0xdc00012, 0x153fa4f, 0x7c00014, 0x2800008, 0xd000012,
+    0x13f6d3, 0x13fdd4, 0x1e53fd55, 0x145183, 0x800000, 0x8d3fe41, 0xdd50810, 0x13ff9a,
+    0x7800008, 0x1400c5, 0x150854, 0x5150695, 0x8d44f4c, 0x13fc49, 0x14538e, 0x2800012,
+    0xd55e9c5, 0xd400001, 0x145252, 0xdd3fd8f, 0x14140150, 0x1450d5, 0x25000029, 0x2513fbd3,
+    0x140354, 0x8d3ffd5, 0xd400001, 0xa000017, 0x15604c, 0x1c00004, 0x2c000001, 0x155f8f,
+    0x1000007, 0xd800001, 0x7c00015, 0x1401df, 0x1000004, 0x11800005, 0x1000006, 0xa000007,
+    0x1000008, 0x140709, 0x100000a, 0x15e305, 0x1c0000f, 0x8d40b50, 0x1c00005, 0x1000012,
+    0x1c00004, 0x25140d54, 0xec0000c, 0x1000013, 0x6400014, 0x8c00001, 0x1000016, 0x280001a,
+    0x145346, 0x140c85, 0xa00002a, 0x145289, 0x140d88, 0x140b89, 0x1454cc, 0x158a53,
+    0x1452ce, 0x7c00015, 0x4400010, 0x140f0f, 0x1d45512, 0x145413, 0x28000012, 0xd000013,
+    0x10000001, 0x14000015, 0x1000003, 0x1000004, 0x800000, 0x141246, 0x1000007, 0x15cb8e,
+    0x25c00009, 0x26c00005, 0x80000c, 0x15cc92, 0x15e40e, 0x80000e, 0x12400000, 0x10c0000b,
+    0x12400002, 0x1c0000d, 0x6400004, 0x1d411d4, 0x15e945, 0x15c00013, 0x1410c8, 0xd000013,
+    0x25d416d4, 0x640000b, 0x1240000c, 0x14104d, 0x1413ce, 0xcc00002, 0x15fc81, 0x7000000,
+    0x6541501, 0x141093, 0x141303, 0x1417d5, 0x7c00004, 0x6400006, 0x1c00007, 0x12541708,
+    0x141989, 0xcc0000a, 0x1c0000b, 0x14158c, 0x700000d, 0x6c0000e, 0x15368e, 0x6c00010,
+    0x7c00010, 0x6c00012, 0x141b93, 0x153713, 0x153414, 0x153555, 0xcc00017, 0xd400002,
+    0x15ff41, 0x640001a, 0xcc00000, 0x12400001, 0xcc00002, 0x21800003, 0xcc00004, 0xcd418c5,
+    0xa141806, 0x1180000c, 0xd40000d, 0x1dd45c8e, 0x1604ce, 0xcc0000b, 0xcc0000c, 0xac00003,
+    0x141c8e, 0xd400014, 0x1c00010, 0xad537c7, 0x25000009, 0x141d13, 0x12541394, 0x6400002,
+    0x7c00003, 0x7c00004, 0x25000009, 0x800012, 0xcc00007, 0x141a48, 0xcc00009, 0x153653,
+    0xcd53594, 0x141b0c, 0x140000e, 0x7c00000, 0x1400001, 0x7c00002, 0xd400012, 0x7c00004,
+    0x141c13, 0x6400014, 0x6400015, 0x6400016, 0x7c00017, 0x16400002, 0x155785, 0x8c00001,
+    0xd400005, 0x10400006, 0x51558c9, 0x1542108, 0x142189, 0x1c0000c, 0x7c00013, 0x25000014,
+    0x14220d, 0x14224e, 0x7c00017, 0x9800012, 0x142801, 0x142412, 0x142301, 0xd942294,
+    0x942ac5, 0x10400016, 0x142785, 0x800018, 0x8d42749, 0xf800008, 0x7800009, 0xd000010,
+    0x400013, 0x161f8f, 0x14294f, 0x25000014, 0x14250f, 0x142b52, 0x7c00006, 0x142712,
+    0x142695, 0x100001a, 0x8c00015, 0x7c0000b, 0x1000002, 0x15d98d, 0x1c00004, 0x1cc00005,
+    0x1c00006, 0x1c00007, 0x141edf, 0x2500000c, 0x80001f, 0x6c0000b, 0x1c0000c, 0xcc00001,
+    0x161bcc, 0x18c00002, 0x800010, 0xcc00005, 0x1c00012, 0x1143113, 0x154488, 0x33143144,
+    0x1000016, 0x1000006, 0x26d42ec7, 0x148f0c, 0x1000009, 0x14908e, 0x1430cb, 0x148e50,
+    0xcc00012, 0x142e41, 0x148e93, 0x143243, 0x148ed5, 0x1c00012, 0xd543013, 0x1c00014,
+    0x800000, 0xd544781, 0x1c00017, 0x100000b, 0x100000c, 0x640001a, 0x100000e, 0x26c00005,
+    0x8c00008, 0xd400009, 0x161585, 0x143293, 0x1a800014, 0x1c00001, 0x100000c, 0x1c00003,
+    0x1c00004, 0x1435c5, 0xd800012, 0x1c00007, 0xcc0000f, 0x8c00015, 0x159e54, 0x25c00015,
+    0x8d4394c, 0x143b01, 0x14358e, 0x161f52, 0x162385, 0x1143d05, 0x1d43a92, 0x7143653,
+    0x1d436d4, 0x400009, 0x11800001, 0x1c00017, 0xd00000c, 0xd00000d, 0xd00000e, 0x1440cf,
+    0x15fac8, 0xd400008, 0xd143392, 0x144153, 0x144094, 0x400015, 0x1c0000d, 0xdc00017,
+    0x144201, 0x26c00007, 0x2800012, 0xd800012, 0x144345, 0xf800001, 0x148a42, 0xdc0001f,
+    0x8c00009, 0x144581, 0x800006, 0x800003, 0x25000005, 0xf9445c5, 0x1400000f, 0x14000010,
+    0x80000c, 0x25400029, 0x14898e, 0x144194, 0x14000015, 0x156941, 0x10548bd2, 0x80000f,
+    0x7c00014, 0x37c00005, 0x7800016, 0xd000013, 0x144481, 0x144602, 0x400006, 0x400004,
+    0x5144745, 0x16400002, 0xd40001a, 0x8c0000c, 0x3800010, 0x7c00006, 0xd00000b, 0xf80001f,
+    0x1c0001a, 0x5000015, 0x140000f, 0x144a8c, 0x1544acd, 0x26944b8e, 0x144653, 0x25000014,
+    0x144695, 0x144bd2, 0x144fc1, 0x162483, 0x144b55, 0x40001a, 0x5144ec5, 0xdc00003,
+    0x1c00005, 0x26c00006, 0x144f09, 0x2c000001, 0x280000b, 0x162649, 0x17400005, 0x145a85,
+    0x280000f, 0x1451d0, 0x15828f, 0x1455c9, 0x33d446e9, 0x25145054, 0x154301, 0x1c00014,
+    0x1c00001, 0x145b8f, 0x1c00000, 0x1d45d01, 0xd550f85, 0x800008, 0x15c00007, 0x146005,
+    0x150e89, 0x780000c, 0x251511cb, 0x1c00009, 0x15424f, 0x7c00014, 0x5145e8c, 0x1545d2,
+    0x3400000e, 0xdc0001f, 0x154455, 0x800008, 0x146292, 0x1c00013, 0x1c00014, 0x1c00015,
+    0x1c00000, 0x1461c1, 0x1c00002, 0x1400029, 0x25800004, 0x146345, 0x25800006, 0x38800001,
+    0x160855, 0x1c0001f, 0x500000b, 0x15cd45, 0x15cd86, 0x2500000d, 0x34546881, 0x145e4f,
+    0x15a345, 0x145f04, 0x146705, 0x146786, 0x255469c7, 0x146048, 0x146909, 0x15a24c,
+    0x259468cb, 0x80000c, 0x2500000f, 0x25546a8e, 0x2c00000f, 0x7400012, 0x280000c, 0x146a52,
+    0x146e53, 0x146c94, 0x2000015, 0xcc00000, 0x8d46a01, 0x25000013, 0x146d43, 0x2800015,
+    0x146b05, 0xd400029, 0x16280e, 0x146c08, 0x2800001f, 0x147181, 0x146acb, 0xd400005,
+    0x162908, 0x146e05, 0xd551408, 0x146ed0, 0xec00008, 0x147009, 0x946f93, 0x146d94,
+    0x146e95, 0x10c0000f, 0x146dd7, 0x146f4f, 0x7c00008, 0x151453, 0x147212, 0x1473d3,
+    0x26c00014, 0x7147315, 0x157f4e, 0x147542, 0x1475c3, 0x147784, 0x2540001a, 0x1400006,
+    0x157f94, 0xd80000c, 0x1c00009, 0x1d470df, 0x1040000b, 0x5000002, 0x12d477cd, 0x147b0e,
+    0x1c0000f, 0x10400010, 0x155fec6, 0x10547a52, 0xd5478d3, 0x1c00014, 0x147955, 0x6c00000,
+    0x7d47481, 0x280000e, 0xd547bc3, 0x5000006, 0x800010, 0x5000012, 0x15ffd2, 0x7147d48,
+    0x1d47dc9, 0xcc0000f, 0x200000b, 0x1040000c, 0x454804d, 0x14810e, 0x500000e, 0x7c00010,
+    0x148001, 0x1d48552, 0x25147a93, 0x148294, 0x148905, 0x147e16, 0xcc00003, 0x1547f98,
+    0x148609, 0x16400002, 0x1400006, 0xcc00008, 0x1400008, 0x800006, 0x14850f, 0xcc0000c,
+    0x7c00000, 0x12c0000d, 0x148653, 0x1491cc, 0x1400010, 0x794918e, 0x162f0c, 0x10400013,
+    0x14e894, 0x149212, 0x148f53, 0x149354, 0x16400004, 0x1d49385, 0x14875f, 0x800007,
+    0x7d62b10, 0x1c0000b, 0x80000c, 0x2540000b, 0x1040000e, 0x140000d, 0x1d495ce, 0x515b3c5,
+    0xd400029, 0x2000013, 0x4400012, 0x149413, 0x1492d4, 0x7000000, 0xec0000c, 0x24800002,
+    0x1bd49643, 0x6549704, 0xdc00013, 0xcc00006, 0x5000012, 0x7000008, 0x140000e, 0x5000015,
+    0x500000b, 0x15499cc, 0x3040000d, 0xd949d0e, 0x11800001, 0x24800010, 0x1533c3, 0x149c12,
+    0x1549a93, 0x1d49c54, 0x149ed5, 0x11800008, 0x149941, 0x12c00018, 0x25400007, 0x1180001a,
+    0x149f45, 0x162712, 0x180000f, 0xd400010, 0x163015, 0x5000001, 0x1c00000, 0xec00014,
+    0x149f82, 0x12c00003, 0x14974f, 0x161794, 0x149e86, 0x1496d2, 0x14a193, 0x14a4c9,
+    0x149bd5, 0x149fcb, 0x1054a14c, 0xe94a0cd, 0x1d4a00e, 0x8c00003, 0x10400010, 0x27400009,
+    0x14a8d2, 0x1d4a653, 0x14a694, 0x14a355, 0x10400016, 0x7c00008, 0x34c00018, 0x14ad41,
+    0x15cc4e, 0x2800015, 0x15f50d, 0x14a2c5, 0x14e9c1, 0x1180002a, 0x400014, 0x11800009,
+    0x14e705, 0x7c00014, 0x163ece, 0x14e748, 0x500000e, 0xd40000f, 0x2000010, 0x7c00000,
+    0x14a412, 0x14a813, 0x7c00003, 0x800004, 0x6d4a305, 0x14e7d2, 0x14e953, 0xd400005,
+    0x8d5b7cc, 0x1000000d, 0x14a78b, 0x14a9cc, 0xd94ae8d, 0x80000e, 0x7c0000f, 0xd400013,
+    0x12c00014, 0x800012, 0x14a953, 0x32800014, 0x565305, 0x7c00016, 0x1c00000, 0xd400001,
+    0xf800001, 0x1054b002, 0xf800003, 0x8c00005, 0x7000029, 0x800006, 0x14b241, 0x162585,
+    0x14afc3, 0x14000015, 0x14b2c5, 0x500000c, 0x14af8d, 0x740000f, 0x14b149, 0x10400010,
+    0xd400029, 0x1654b1d2, 0x14ac93, 0x6c00014, 0x8c00012, 0x14b090, 0xd400017, 0x800015,
+    0x14b381, 0x14b654, 0x14b055, 0x2000004, 0x14b5c5, 0x214b106, 0x14b687, 0x14b348,
+    0x14b809, 0x80000d, 0x1040000e, 0x14b94c, 0x14d081, 0x200000e, 0x14b50f, 0x400000,
+    0x14da05, 0x14b6d2, 0x14bad3, 0x400004, 0x14d209, 0x400006, 0x214b997, 0x400008,
+    0x1c00007, 0x200001a, 0x14d18f, 0x40000c, 0x6400003, 0x14d5d2, 0xd14d793, 0x400010,
+    0x7c00000, 0x400012, 0x400013, 0x4400004, 0x162693, 0x1c0000c, 0x800007, 0x3755414e,
+    0x1c00029, 0xcc00010, 0x80000b, 0x14bd0c, 0xd400013, 0x7c00014, 0x7c0000f, 0x500000f,
+    0x15dc03, 0x7c00000, 0x214ba53, 0x4400014, 0x14be83, 0x14c184, 0x140000e, 0x14c1c6,
+    0xd400007, 0x400008, 0x54c209, 0x162f85, 0x94c10b, 0x14c40c, 0xdc00010, 0x14c58e,
+    0x400013, 0x54c650, 0x400015, 0x94c6d2, 0x14c8d3, 0x14c794, 0x14cb95, 0x21400016,
+    0x400017, 0xf800018, 0x163454, 0x40001a, 0xd40001b, 0x14c141, 0x2000002, 0x80000d,
+    0x800012, 0x514cb05, 0x3915e4c8, 0x2000007, 0x7000000, 0x15e6cb, 0x154c502, 0x14cc43,
+    0x14c7c4, 0x8d6318e, 0x14c706, 0x14c3cf, 0x12c00008, 0xd94cec9, 0x25c00013, 0x14c353,
+    0x12d4d04c, 0x654d0cd, 0x1d4d2ce, 0x7000019, 0x14ca50, 0x1c00019, 0x14d552, 0x1d4cb53,
+    0x14d454, 0x14ca95, 0x14cf96, 0x14d381, 0x7c00002, 0x6d4d803, 0x1054d844, 0x6d4d9c5,
+    0x1631c1, 0x165f8e, 0x155a85, 0x16618d, 0x162dc5, 0x2214dacb, 0x1c00000, 0x14de81,
+    0x14df4e, 0x7c0000f, 0x155c0d, 0x14dcc5, 0x2040000f, 0x714db13, 0x14db94, 0x800000,
+    0x7c00016, 0x1000014, 0x14d68c, 0x1c0000d, 0x7c00015, 0x1000000, 0x400001, 0x154e2c2,
+    0x14e092, 0x400000, 0x35000014, 0x16400006, 0x400007, 0x400008, 0x80000c, 0xd80000c,
+    0x380000b, 0x54dd0c, 0x54e38d, 0x654e3ce, 0x80000f, 0x12c00010, 0x80000c, 0x32d4e552,
+    0x54e493, 0x1c0000f, 0x400015, 0x163d09, 0x400017, 0x1400018, 0x1194e4c1, 0x40001a,
+    0x14e603, 0x14000001, 0x14e685, 0x800005, 0x25800012, 0x150c45, 0x10c00009, 0x15a141,
+    0x500000b, 0x150c89, 0x166c48, 0xd400005, 0x15a386, 0x5000010, 0x14e806, 0x1400008,
+    0x14e908, 0x14e794, 0x150f52, 0x26d50753, 0x14e6d7, 0x3540000d, 0x14eace, 0x500001a,
+    0xa000010, 0x800012, 0x95a414, 0x14eb13, 0x514ed42, 0x7d4ec43, 0x16400004, 0x8c0000c,
+    0x7c00006, 0x1638c8, 0xf80001a, 0xfc00008, 0x8c0000b, 0x500000b, 0x14ec8c, 0x14eb4d,
+    0x14ed8e, 0x800012, 0x7d4ee50, 0xd800002, 0x14efd2, 0x15d4eb93, 0x14ee14, 0x14edd5,
+    0xd400016, 0xf800003, 0x1400018, 0x2000009, 0x14f141, 0x7c0000c, 0x14ee88, 0x14ef49,
+    0x1b400005, 0x1b400010, 0x8c0000c, 0x1594d2, 0x14f34e, 0x167c90, 0x168741, 0x1b40000c,
+    0x14f0d2, 0x14f193, 0x1565192, 0x14f3c1, 0x2800014, 0x10400015, 0x18c00018, 0x14f4c5,
+    0x5000015, 0x16400002, 0x800008, 0x7800009, 0xcc00019, 0x1c00000, 0x14f6c1, 0x153f88,
+    0xf000003, 0x14f20f, 0x514f445, 0x1c00009, 0x14f552, 0xd5544ce, 0x12c00004, 0x7c00015,
+    0x1c0000b, 0x10400012, 0xd400005, 0xd954614, 0x1d4f80f, 0x1d4f590, 0x14ffc9, 0xd000007,
+    0x15024b, 0x14f9d4, 0x14fbc1, 0x8d5034e, 0xd40000f, 0x8c0000d, 0x14ff45, 0x1502d2,
+    0xd400013, 0x8c00008, 0x14fac9, 0x15cc13, 0x1c0001f, 0x11800001, 0x14f68d, 0x14f84e,
+    0x15014f, 0x26d4f882, 0xd400003, 0x29501d2, 0x400008, 0x6400006, 0x54f995, 0x1c00000,
+    0x7d50201, 0xd80000c, 0x7c00019, 0x1c0000c, 0x14fb0d, 0x15028e, 0x7c00002, 0x1000013,
+    0x22550389, 0xd400005, 0x5000001, 0x294fcd4, 0xd400005, 0x200000e, 0x15004f, 0x8c00018,
+    0xdd50981, 0x5000008, 0x7400009, 0x3580002a, 0x150885, 0x1040000e, 0x161812, 0xec00008,
+    0x150a09, 0x7c00000, 0x5000001, 0x7c00002, 0x5000001, 0x25000014, 0x500001f, 0x7c00006,
+    0x5000005, 0xec00012, 0x1c00000, 0x9800001, 0x150a55, 0x7c0000c, 0x15178b, 0x15190c,
+    0x7c00003, 0x500002a, 0x163705, 0x1513c9, 0x15d50f13, 0x8c0000d, 0x1516d3, 0x151854,
+    0x7c00017, 0x5000001, 0x167d52, 0x3c000012, 0x2000012, 0x14000010, 0x36400002, 0x1c00015,
+    0x1c00016, 0x151545, 0x1c00006, 0x1c00007, 0x119574c1, 0x152f41, 0x7c00000, 0x8c0000f,
+    0x3600000c, 0x5000005, 0x1c0000e, 0x162513, 0x5000009, 0x5000009, 0x11400012, 0x36400013,
+    0x11400000, 0x151881, 0x1c00002, 0x1c00017, 0x151b04, 0x157792, 0xd000013, 0x1518c7,
+    0x20c00015, 0x7c00015, 0x1673c5, 0x1a80000b, 0x1c0000c, 0x1680c9, 0x700000e, 0x152a02,
+    0x400010, 0x12c00004, 0x1c00012, 0x200000f, 0x151d42, 0x7c00003, 0xcc00008, 0x1c00017,
+    0x780000b, 0x167354, 0x1a80001a, 0x36800009, 0x168cce, 0xdd51c41, 0x7c0002a, 0x5000012,
+    0x7c00013, 0x151fc5, 0x1400015, 0xdc00001, 0x151bd2, 0x8c00009, 0x6400014, 0x159cc5,
+    0x7c00000, 0x7c00005, 0xd000008, 0x8c0000f, 0x640001a, 0x800000, 0x15526c1, 0x1525d3,
+    0x552554, 0x152944, 0x952ac5, 0x152206, 0x26d52087, 0x15a213, 0x152489, 0xdc00013,
+    0x25000014, 0x15268c, 0x16400004, 0x1528ce, 0x8c0000e, 0x152c10, 0x7c00012, 0x152e52,
+    0x152713, 0x952394, 0x16400002, 0x8c0000d, 0x15fdce, 0xd400005, 0x10400006, 0x80001a,
+    0x1693c1, 0x10552c49, 0x15fe94, 0x152f01, 0x1400001f, 0xd552e0d, 0x8c0000e, 0x153085,
+    0x26d62405, 0x5000001, 0x152ed2, 0x1530c9, 0x800005, 0x800006, 0x8c00029, 0x153141,
+    0x8c0000e, 0x36c0000f, 0xd000004, 0x153045, 0xec00012, 0xcd581ce, 0xcc00013, 0x5153209,
+    0x7c00015, 0x11400001, 0x38158253, 0x15350d, 0x1668d4, 0x8c0000f, 0x1000006, 0x25153347,
+    0x165d01, 0x5000009, 0x500001a, 0x80000b, 0x11c00000, 0x10400002, 0x6400002, 0x167ac5,
+    0x165b09, 0xcc00005, 0x1694c5, 0xd5535d3, 0x1000014, 0x1534c9, 0x2180000e, 0x2755348b,
+    0xac00010, 0x200000f, 0xcc00012, 0x21400010, 0xac00014, 0x8d53841, 0x7c00012, 0xd400017,
+    0x153784, 0x153945, 0xd400001, 0x200001b, 0xcc00018, 0x153909, 0x6c00007, 0xec0000c,
+    0x153989, 0x8c0001f, 0x1695c8, 0x153a0f, 0xa153e0d, 0x153c4e, 0x1c00001, 0x26c00013,
+    0x8d55f04, 0x8c00015, 0x153ad3, 0x153d94, 0xd400015, 0x7c00000, 0xd400015, 0x80000b,
+    0x153d03, 0x6400004, 0x80000e, 0xd800013, 0x440000f, 0x6400008, 0x800012, 0x6400006,
+    0xdc00013, 0x800015, 0xd80000d, 0x153f0e, 0x1c0000b, 0x11c00010, 0xc800006, 0x6c0000e,
+    0x1c00000, 0x7c00014, 0x154055, 0x7c00003, 0x7c00004, 0x800014, 0x1c00006, 0x1c00007,
+    0x1040000c, 0x1541c9, 0x2155428e, 0x1c0000b, 0x7c00014, 0x8c00005, 0x5000012, 0x16400013,
+    0x6400010, 0x153f55, 0x169709, 0x153b93, 0x2515ea45, 0x12400015, 0x6553ec3, 0xd000004,
+    0xd400005, 0x154541, 0x1c00007, 0x515e64c, 0x200000e, 0x154645, 0x2f80000b, 0x8d5e910,
+    0x5000008, 0x154389, 0xcc00000, 0x7c00010, 0x154942, 0x169c4c, 0x2154093, 0x15458f,
+    0x1400006, 0x8c00007, 0xd954712, 0xcc00001, 0x163089, 0x1543d5, 0x154acc, 0x1b400005,
+    0x140000e, 0x2780000e, 0x26d58f08, 0x10400010, 0x12c00012, 0x1630d2, 0x7d54794, 0x15469f,
+    0x7000029, 0x1b40000f, 0xd554883, 0x154a84, 0x1400002, 0x7c00003, 0x169853, 0x1554bc8,
+    0x154b89, 0x7c00007, 0x1546ea, 0x154b4c, 0x154c0d, 0x1548ce, 0x154e01, 0x1400008,
+    0x11954f03, 0x154c92, 0x25154fc5, 0x154c54, 0x15d652, 0x15da93, 0xd000009, 0x10400018,
+    0x516a1c1, 0x155104, 0x2d800009, 0x1000006, 0x26d55087, 0x155e0c, 0x1800009, 0x8d55bce,
+    0x15520b, 0x5155294, 0x100000d, 0x800012, 0x8c00013, 0x1c00006, 0x1c00007, 0x1c00012,
+    0xcc00009, 0x1c00014, 0x165601, 0xec0000c, 0x163a01, 0x16b185, 0xd40000f, 0xd555981,
+    0x5000005, 0x555752, 0x155813, 0x1554d4, 0x5000015, 0x1000007, 0x1c00017, 0x167301,
+    0x26d6528f, 0x1c0001a, 0x1557cc, 0x167085, 0x7c0000c, 0x8c00012, 0x1000010, 0x159c8c,
+    0x500000d, 0x159ece, 0x155b94, 0x7400015, 0x400001, 0x1c00002, 0x1400013, 0x25400004,
+    0x9c0001f, 0x1c00006, 0x155c87, 0x7c00000, 0x4c00001, 0x167857, 0x100000b, 0x1c0000c,
+    0x15590d, 0xd000014, 0x1140000f, 0x40002a, 0xcc00009, 0x1c00012, 0x25155d13, 0xd000001,
+    0x167c06, 0x5159e83, 0x1c00017, 0x5000005, 0x1400019, 0x40001a, 0xa000000, 0x800001,
+    0xed69601, 0x1c00003, 0x11400004, 0x800000, 0x155cc1, 0xd567cd3, 0x155d83, 0x11800009,
+    0x25156005, 0x15a093, 0x295a0d4, 0x100000d, 0x165e81, 0x1180000f, 0x8c0000f, 0x3800006,
+    0x5165c45, 0xd400013, 0x155b14, 0x5000015, 0x8c00001, 0xd80000c, 0x25555d53, 0x155f54,
+    0x100001a, 0xdc00003, 0x165acf, 0xd800012, 0x1000006, 0x6400007, 0x5000015, 0x7c0000c,
+    0x1699c5, 0x80000b, 0x166705, 0x8c00008, 0x155dce, 0xec00012, 0x1c00013, 0x2515ae14,
+    0xa00001f, 0x1000013, 0x1000014, 0x1000004, 0x29400005, 0x1000006, 0x2800007, 0x166952,
+    0x16b88e, 0x8c0000d, 0xd400015, 0x80000c, 0x156102, 0x25d562ce, 0x156544, 0x156705,
+    0xd000006, 0x1400012, 0x8d56413, 0x156389, 0x1400012, 0x168841, 0x1567cc, 0xcc00000,
+    0x5156b41, 0x1c00005, 0x800003, 0x156cc4, 0x156905, 0x1566d3, 0x156854, 0x1c00001,
+    0x156dc9, 0x1000002, 0x2580000b, 0xa000004, 0x2540001a, 0xd00000e, 0xcc00000, 0x1c00009,
+    0x515be89, 0x1c00003, 0x156ed3, 0x157054, 0xa00000d, 0x1556f01, 0x21800008, 0x6400010,
+    0x156a84, 0x156f45, 0x295808c, 0xd400029, 0x15818e, 0x156bc9, 0x515645f, 0x15700b,
+    0x15708c, 0x15720d, 0x1570ce, 0x155738f, 0x8d63bcc, 0x21400006, 0xfc0000e, 0x157553,
+    0x10400008, 0x11800015, 0xd163f12, 0x164013, 0x800000, 0x156fc1, 0x156c9a, 0xa157443,
+    0x800010, 0x157645, 0x168a01, 0x7c00013, 0x1576c8, 0x5000009, 0x168a85, 0x1c00004,
+    0x5000005, 0x1000006, 0x157cc7, 0x1c00008, 0x157510, 0x12c00029, 0x8c00002, 0x1572d3,
+    0x25157854, 0x7800009, 0xdc00009, 0xd000007, 0x16c04e, 0x14000009, 0x1000013, 0x1000014,
+    0xed57acc, 0x1c00016, 0xd157a0e, 0x165992, 0x25800013, 0x165594, 0x157a52, 0x157713,
+    0x25000014, 0x3800002, 0x1000003, 0x157904, 0xec00008, 0x158f49, 0x1000007, 0x158f8b,
+    0x15944c, 0x500000d, 0x25d58e8e, 0x1180002a, 0x100000d, 0x157c4e, 0xcd59492, 0x32c00013,
+    0xd800014, 0xcc00015, 0x157e13, 0xd800001, 0x157e95, 0x6400000, 0xa000001, 0x6400002,
+    0x7c00003, 0x6c00004, 0x7c00005, 0x16400004, 0x6400007, 0x1c00008, 0x157ec9, 0x1d800001,
+    0x16bc12, 0xd800003, 0x80000e, 0x7d57c8e, 0x80000d, 0x167c4e, 0x26000008, 0x6d57d52,
+    0x1d57fd3, 0x800001, 0x1c00002, 0x7c00016, 0x11400004, 0x9580c5, 0x1c00006, 0x16c092,
+    0xec00001, 0x15b0d3, 0xd15ad54, 0x80000b, 0x700000c, 0x80000d, 0x700000e, 0x80000f,
+    0x14000009, 0x11400005, 0x11800001, 0x1c00013, 0x11557f14, 0x800001, 0x800002, 0x958003,
+    0x8c0000c, 0x400012, 0x95805a, 0x8c0000f, 0x400015, 0x15800015, 0x8c00012, 0x80000b,
+    0x7d5ec43, 0x80000d, 0xd95eb45, 0xcd58582, 0x800010, 0x158304, 0x800012, 0x1c00013,
+    0x800014, 0x6400008, 0x16bf0e, 0x7d5ee4e, 0x640000b, 0x7c00000, 0x25d583cd, 0x15854e,
+    0x15ee93, 0x15ef14, 0x5000005, 0xe958652, 0x1587d3, 0x21800000, 0x1588d5, 0xcc00002,
+    0x6400003, 0x158704, 0x34c00005, 0x6400006, 0x158787, 0x15c241, 0x158bc9, 0x169685,
+    0x7c00013, 0x15c345, 0xcc0000d, 0x158a8e, 0x5000008, 0xd400009, 0xec0000c, 0xcc00012,
+    0x1585d3, 0x7c00014, 0x6400003, 0x7c00016, 0xd5586c5, 0xcc00006, 0x1c00007, 0xfc00013,
+    0x158e42, 0x1c00003, 0x800001, 0x15860c, 0x166dc1, 0x15898e, 0x1c00008, 0xcc00010,
+    0x1670c5, 0x169f08, 0x640000c, 0x500001f, 0x26c0000e, 0x158ec6, 0x16c254, 0x6400008,
+    0x7c00009, 0x158b13, 0xcc00014, 0x800012, 0x640000d, 0x15890e, 0xd000014, 0x12400010,
+    0x2000015, 0xd400004, 0xa000013, 0x6400014, 0x24800002, 0x158c43, 0x34c00004, 0xcc00009,
+    0x1180000b, 0x7c0000c, 0xa00001b, 0x500000e, 0xd000012, 0x2480000b, 0x7d5900c, 0x8d5914d,
+    0x15848e, 0x1595d4, 0xd800010, 0xcc00015, 0x11800012, 0x159641, 0x7c00014, 0x159055,
+    0xd400016, 0x159545, 0x5159581, 0x169085, 0x2800001, 0x7959609, 0x159745, 0x1691c9,
+    0x1b40000c, 0x159688, 0x159a09, 0x15930f, 0x25000007, 0xd400001, 0x159352, 0x7c00000,
+    0x7d59b4f, 0xd400005, 0x7c00006, 0x5159dd2, 0x8c00003, 0xd400009, 0x1597d5, 0xd400005,
+    0x1000006, 0x159f87, 0x1c0000e, 0x1800009, 0x400000, 0x640000b, 0x7400012, 0x400013,
+    0x500001f, 0xd800012, 0x7c00013, 0x1c00017, 0x1c00012, 0xd400013, 0x1c00014, 0xe000000,
+    0x15a481, 0x15a702, 0x5159929, 0x500002a, 0x1c00005, 0x15d381, 0x10400008, 0x12c00001,
+    0x400014, 0x15d085, 0x25000004, 0x15a5cc, 0x1400008, 0xd400009, 0x500000f, 0x7000010,
+    0x8c00012, 0x1400013, 0x15a913, 0x15a954, 0x800000, 0x1d5a9c1, 0x1d5a8c2, 0xd40000c,
+    0x95aa84, 0x15a7c5, 0x26800006, 0x15aac7, 0x7c00005, 0x1c00009, 0x15d3da, 0x15a80b,
+    0x1c0000c, 0xec0000c, 0x1c0000b, 0x1c0000f, 0x14000009, 0x16998e, 0x1c00012, 0x15acd3,
+    0xf95adc1, 0x1c00002, 0x25c0000f, 0x800004, 0xd000014, 0x15aa06, 0x1c0001a, 0x25800014,
+    0x15b004, 0x7c00006, 0x15b246, 0x22000007, 0x15af8d, 0x15ad8e, 0x15ad0f, 0x15ae4b,
+    0x16a90d, 0x16c0c5, 0x8c0001f, 0x15af54, 0x3d000005, 0x800000, 0x15b5c1, 0x15b2d3,
+    0x15b414, 0x15afda, 0x15b745, 0x1c00006, 0xd000001, 0x5000012, 0x15b909, 0x11c00012,
+    0xcc00002, 0x3840000c, 0x21800007, 0x400005, 0x400006, 0x400007, 0x800019, 0x1d5ba12,
+    0x800008, 0xa000014, 0x8c00015, 0x8d5bbcd, 0x1d5b98e, 0x700000f, 0x1040000e, 0x15b9c1,
+    0x12c0000d, 0x15ba53, 0x15b794, 0x15bd45, 0x800006, 0x400017, 0x26800013, 0x5000009,
+    0xfc00001, 0x400000, 0x15bd8c, 0x15bd0d, 0x7000005, 0x515be0f, 0x800000, 0x2555bcc1,
+    0x5000009, 0xd400005, 0x1c00014, 0x15c0c5, 0x15c006, 0x15c1c7, 0xd00000d, 0x11800010,
+    0x7c0000c, 0x15c20b, 0x15e04e, 0x15c7d4, 0x400013, 0x140000e, 0x15dd12, 0x16b785,
+    0x140000f, 0x15bdd3, 0x15c2d4, 0x28000015, 0x800000, 0x15c501, 0x25000002, 0x8c00029,
+    0x2540001a, 0x95c785, 0x15bfc6, 0x15c287, 0x800014, 0x15c309, 0x1c00001, 0x15c5cb,
+    0x15c48c, 0x14000017, 0x80000e, 0x515ca4f, 0xd80000e, 0xd400013, 0x15cac9, 0xd400005,
+    0x26d5c954, 0x15c395, 0xcc0000d, 0x11800009, 0x15cf01, 0x15cdd0, 0x15cb5a, 0x15cec4,
+    0x15cfc5, 0x400006, 0x166385, 0x400008, 0x11000009, 0x25400013, 0x166589, 0x25000015,
+    0x5000001, 0x2540000e, 0x500000f, 0x16cec5, 0xf000005, 0x15c0a9, 0x25400013, 0x15d054,
+    0x5000009, 0x8d5d107, 0x7c00015, 0x1800001, 0x15d24d, 0x25d5d2ce, 0xd40000c, 0x5000001,
+    0x15d44e, 0xfc00001, 0xd400013, 0x2000014, 0x1665df, 0x400013, 0x400014, 0x15d155,
+    0x7c00000, 0xd000001, 0x7c00002, 0x400019, 0x7c00004, 0x25800005, 0x11800010, 0xd40000f,
+    0x8c00009, 0x15d289, 0x15e194, 0x15e395, 0x95d4c5, 0x800006, 0x15d68e, 0x16c007,
+    0x8c0000c, 0x5000009, 0x7d5d892, 0x7d5d613, 0x80000d, 0x15d70e, 0x7c00004, 0x800010,
+    0x15d401, 0x7c00007, 0x800013, 0x38c00014, 0x15d745, 0x7c0000b, 0x27800013, 0x25800013,
+    0x7d5d9ce, 0x7c00000, 0x15d90b, 0x15d8cc, 0x7d5ddd2, 0x7c00004, 0x2f15db45, 0x21400004,
+    0xd00000d, 0x26c00005, 0x15dc89, 0x15db14, 0x8c00015, 0x15df4c, 0xd400003, 0x7d5dc4e,
+    0x1040000d, 0x39d6114e, 0x7c00007, 0x15e092, 0x15dcd3, 0x26c00002, 0x161013, 0xd000002,
+    0x7c0000d, 0x7c00018, 0x26000005, 0xf800006, 0x1c00000, 0xcc00012, 0x15e109, 0x15dd54,
+    0x15e215, 0x80000c, 0x80000e, 0x2795e14e, 0x5000008, 0x15e1d0, 0x10400012, 0x7d5e292,
+    0x2800013, 0x800003, 0x800004, 0x800005, 0x2c000001, 0x5000018, 0x7000012, 0x39400013,
+    0x15e3c5, 0x15e586, 0x25000001, 0x140000d, 0x161841, 0x8d6b541, 0x800010, 0xec0000c,
+    0x161d05, 0x1416b4c5, 0x1400000f, 0x2c15e441, 0x29617c9, 0xec00012, 0x15e244, 0xa15e605,
+    0x8c00015, 0x25800007, 0x16194f, 0x1400000f, 0x16b753, 0xd00000b, 0x2500000c, 0x7000000,
+    0x5000015, 0x15e54f, 0x8c0001f, 0x26c00004, 0x715e5c5, 0xd000013, 0x7000007, 0x7000008,
+    0x1000003, 0x16bb8e, 0x700000b, 0x1d5e499, 0xa15e85a, 0x155e881, 0x10400013, 0x25000014,
+    0x2ec00004, 0x1d5e685, 0x7000013, 0x1000007, 0x1614e9, 0xf80002a, 0x2800001, 0x16ed8c,
+    0x7000019, 0x1000000c, 0x165a05, 0x2515e70f, 0xd400002, 0x11800003, 0x5000004, 0x10000012,
+    0x15ec14, 0x12c00007, 0x9c00008, 0x400009, 0x280000f, 0x16d205, 0x95ec83, 0x7c00004,
+    0x15ecce, 0x7c00006, 0x5000010, 0x1400008, 0x15eec9, 0x15e993, 0x7c00014, 0x15ed8c,
+    0x2800004, 0x21800016, 0x16cdd2, 0x7c00010, 0xcc0001f, 0x15efd2, 0x3995ed13, 0xd95f094,
+    0x10400015, 0x800016, 0x7c00007, 0x7c00008, 0x27400001, 0x7c0001a, 0xd400012, 0x1300000c,
+    0x15f4cd, 0xcc0000e, 0x15f481, 0x15f0d0, 0x15f243, 0xd800012, 0x15f345, 0x6400010,
+    0x7c00015, 0x2800008, 0x15f309, 0x15f841, 0xd00000b, 0xd00000c, 0xd40000f, 0x15f605,
+    0x15f44f, 0x15f710, 0x8c00008, 0x1400014, 0x25000005, 0x25000014, 0x8c00015, 0x15f803,
+    0x16400004, 0x15f38f, 0x500000e, 0x8c0000c, 0x15f752, 0x15f913, 0x8c0000c, 0x5000001,
+    0x15f7cc, 0x15f68d, 0x80000e, 0x5000005, 0x163b12, 0x163813, 0x8c00009, 0x10400013,
+    0x15fa14, 0x15fb55, 0xf800003, 0x8c00005, 0xd400005, 0x1000010, 0x5000010, 0x15f8c8,
+    0x15fb89, 0x8c0001f, 0x1656d4, 0x15fc4c, 0x15fa4d, 0x15fcce, 0x160241, 0x1c00008,
+    0x560581, 0x15ff12, 0x160305, 0x15fc14, 0x160785, 0x800008, 0x160209, 0x95f958,
+    0x75603c9, 0x26d6f748, 0x800003, 0x5000001, 0x16014f, 0x10400006, 0x56034f, 0x160052,
+    0x1651c9, 0x560a12, 0x7c00000, 0x21400004, 0x160115, 0x1380000e, 0x8c00007, 0x7c00005,
+    0x1c00004, 0x1653d2, 0x16060b, 0x16098c, 0x34c0000d, 0x21560a4e, 0x16045f, 0x800010,
+    0x156630e, 0x21560752, 0x19960b53, 0x18d60cd4, 0x800015, 0xdc00013, 0x800012, 0xcc00018,
+    0x500000c, 0x40002a, 0x160d02, 0x12d60d43, 0x16400004, 0x169b03, 0x160d86, 0x2b000005,
+    0x160e48, 0x160ec9, 0x11800008, 0x160e8b, 0x16128c, 0xd960f0d, 0x160f4e, 0x5000012,
+    0xd800013, 0x7c0000c, 0x161412, 0x161213, 0x7d60e14, 0x10400015, 0x8c00014, 0x10400002,
+    0x1609d8, 0x25c00004, 0x1c00006, 0x10400006, 0x161d81, 0x25000009, 0x1613c3, 0x1400010,
+    0x161dc5, 0x16104c, 0x16e513, 0x161908, 0x16fe85, 0x161510, 0xd161b4b, 0x1561652,
+    0x14000001, 0x2a400001, 0x1400000f, 0x8c00010, 0x161fc5, 0x25162285, 0x5000005, 0x1619d4,
+    0x8c00009, 0x162189, 0x25d6bd49, 0xec0000c, 0x2500000c, 0x1800005, 0x25400006, 0x8c0000f,
+    0x10400006, 0x2a800012, 0x400001, 0x25800013, 0x8c00015, 0x161f04, 0x800008, 0x1c00006,
+    0x25162347, 0x161c01, 0x400009, 0x7c00000, 0x8c0000c, 0x16bdc9, 0x40000d, 0x8c0001f,
+    0x16bd8c, 0x8c00009, 0xd56be0e, 0x5000008, 0x800009, 0x1c00014, 0x16be92, 0x36c0000f,
+    0xd800012, 0x8c00029, 0xec00012, 0x11800010, 0xd400014, 0x27400001, 0xd000013, 0x26c00014,
+    0xd800001, 0x1000005, 0x16245a, 0x7c00000, 0x3a1626c1, 0x3a400002, 0x7c00003, 0x3a400004,
+    0x162a45, 0x7c00006, 0x7c00007, 0x16ee8c, 0x162ac9, 0x7c0000a, 0x7c0000b, 0x3ad62d4c,
+    0x7c0000d, 0x7c0000e, 0x162b8f, 0xd000010, 0x1000012, 0x7c00012, 0x7c00013, 0x3a400014,
+    0x38800015, 0x7c00016, 0x7c00000, 0xd562cc1, 0x166b05, 0x3a80001a, 0x32800004, 0x162c45,
+    0x7c00000, 0x1000000, 0x8c0001f, 0xec0000c, 0x1c00006, 0xcc00005, 0x7c0000c, 0x162e01,
+    0x15d62fc8, 0x166ed2, 0x26400013, 0x162e45, 0x640000e, 0x7d62c93, 0x7c00014, 0x1632c9,
+    0x1c00000, 0x7c00017, 0x2000012, 0x7c00013, 0x7c0001a, 0x16330f, 0xdd63141, 0x80000d,
+    0x1674ce, 0xd00000c, 0x5633c5, 0x400009, 0x1400012, 0x7c00013, 0x400009, 0x8c00002,
+    0x7800003, 0xdd6350c, 0x29c0000d, 0xd00000e, 0x56324f, 0x165201, 0x6c0000e, 0x3b000012,
+    0x1635d3, 0x163754, 0x400015, 0x12d6348e, 0xdc00017, 0x2800015, 0x1000004, 0x800001,
+    0xec0000c, 0x7c00014, 0x1400015, 0x2000005, 0xdc0001f, 0x8c00018, 0x165252, 0xd5652d3,
+    0x1000007, 0xa000005, 0x1d6328c, 0x16334d, 0x16354e, 0x16360f, 0x163ac1, 0x7000000,
+    0x7d63a92, 0x163793, 0x163c45, 0x25800006, 0x168bc5, 0xd000013, 0xd400009, 0x1400015,
+    0xd800013, 0xec0000c, 0x166546, 0x700000c, 0x163b4f, 0x3b400001, 0x16878f, 0xdd63412,
+    0x25800004, 0x9641c5, 0x26c00006, 0x168d14, 0x27000010, 0x164089, 0x1666d2, 0xdc00013,
+    0x3180000c, 0x5000012, 0x680000f, 0x16414f, 0x16391f, 0x7c00000, 0x7d64441, 0x3b963b93,
+    0x251640d4, 0x7c00004, 0x964685, 0x7c00006, 0x3bd64187, 0x7c00008, 0x163fc9, 0x7c0000a,
+    0x7c0000b, 0x16478c, 0x7c0000d, 0x7c0000e, 0x780000f, 0x7c00010, 0x26c00001, 0x7c00012,
+    0xd564993, 0x164814, 0x5164055, 0x7c00016, 0x7c00017, 0x1672c1, 0x14000003, 0x7c0001a,
+    0x27400005, 0x167245, 0x255642c1, 0x164342, 0x7c0001f, 0x167049, 0x964a85, 0x26c00006,
+    0x26d64207, 0x26c00019, 0x15800004, 0x166c8f, 0x2500000b, 0x8c00001, 0x7c00029, 0x564b8e,
+    0x140000f, 0x169645, 0x8c0000c, 0x1646d2, 0x164ad3, 0x164954, 0x1649c1, 0x16c305,
+    0x800003, 0x6400013, 0x964b45, 0x2540001a, 0x8c00010, 0xdd64ec1, 0x1000000c, 0x16cf86,
+    0xd169894, 0x164d45, 0x172cd2, 0x28000001, 0x165148, 0x164cd0, 0x16c5d4, 0x165745,
+    0x164e13, 0x164f14, 0x8c00029, 0x16508f, 0x16d193, 0x2556ce14, 0x165112, 0x165013,
+    0x400014, 0x16540f, 0x172d05, 0x1000000c, 0xdd658d2, 0x1655d3, 0x164e9a, 0x1654d5,
+    0x165702, 0x1400012, 0x172b85, 0x25400014, 0x165c86, 0x16bec5, 0x5165ec1, 0x1659c9,
+    0x165e43, 0x8c00009, 0x172ad2, 0x11c00001, 0x165cce, 0x164fe9, 0x9800005, 0xdc00005,
+    0x165d52, 0x165913, 0x2800012, 0x25800013, 0x1180000f, 0x5166090, 0x165d8c, 0x173405,
+    0xd80000e, 0x165fd4, 0x166107, 0xfc00012, 0x800013, 0x173a48, 0x156620b, 0xdc00015,
+    0x165dcd, 0x16624e, 0x1c00019, 0xd400001, 0x500001f, 0x166012, 0x16400004, 0x166054,
+    0x10400015, 0x8c00012, 0x966342, 0xd400003, 0x10400004, 0x7c0001a, 0x800006, 0x1664c5,
+    0x16a00e, 0x10400009, 0x16ed01, 0x166649, 0x2780000c, 0xdc00013, 0x269660ce, 0x966782,
+    0x10400003, 0x1c0000d, 0x166492, 0x1c0000a, 0x166614, 0x8c00001, 0x2dc00012, 0x51732c1,
+    0x1040000b, 0x166d45, 0x166a8d, 0x16680e, 0xd800013, 0x25000009, 0x12c00003, 0x166c12,
+    0x166913, 0x500001f, 0x10566cd5, 0xdd6698f, 0x166b49, 0x175749, 0x8c00012, 0x140000c,
+    0x166e8d, 0x166a4e, 0x5000014, 0x800029, 0x166d05, 0x167152, 0x167007, 0x166d94,
+    0x1400002, 0x10400004, 0x26c0000b, 0x1400018, 0x8c00006, 0x16728e, 0x8c00008, 0x10567190,
+    0x180000f, 0xd400010, 0x25000004, 0x1726ce, 0xd000013, 0x2516e614, 0x8c00010, 0xd000009,
+    0x10400012, 0x7c00000, 0x8c0000c, 0x7c00015, 0x1676ce, 0x6400004, 0x1400018, 0x170b81,
+    0x167892, 0x170e43, 0x2967454, 0x167555, 0x800007, 0x11800001, 0x167709, 0x80000a,
+    0x80000b, 0x16798c, 0x1000006, 0x8c0000e, 0x7c00013, 0x25000014, 0x8c00010, 0x1679d2,
+    0x167a13, 0x167a54, 0xec00014, 0x8c00015, 0x800017, 0x5167d82, 0x12c00003, 0x1400004,
+    0x1b400005, 0x1c00000, 0x25168081, 0x11000001, 0x1040000c, 0x1040000d, 0x5168185, 0x167e0c,
+    0x140000d, 0x8d67f4e, 0xd567f09, 0xec00004, 0x1c00005, 0x168012, 0x1c00007, 0x167bd4,
+    0xf800015, 0x500000f, 0x16854b, 0x1d68052, 0x168113, 0x516a5c1, 0x167e55, 0x16a543,
+    0x5000001, 0x16a305, 0x1d688d3, 0x251684d4, 0x172245, 0x17560f, 0x1400004, 0x8c00029,
+    0x1c0001f, 0x1c0001f, 0x168302, 0x12c00003, 0x16a410, 0x7c00005, 0x1683c6, 0x1730cd,
+    0x8d6a6d4, 0x16a4d5, 0x5000029, 0x1180002a, 0x16834c, 0x8c0000d, 0x16840e, 0x1400004,
+    0x7c00008, 0x175d4e, 0x168692, 0x1682d3, 0x8c00014, 0x1568455, 0x7168941, 0x168acc,
+    0xd400018, 0xa000000, 0x168485, 0x25c00009, 0xc800001, 0x1400012, 0xdd68b13, 0x22000014,
+    0x10400015, 0x8d6880c, 0x1c00001, 0x168d41, 0x16824f, 0x168ec3, 0x5169245, 0x169105,
+    0x168913, 0x1d69048, 0xc80000f, 0xd400009, 0xd400001, 0x1c0000b, 0x11800005, 0x280000d,
+    0xd40000f, 0x10400004, 0xd400009, 0x15169152, 0xd000013, 0x16400004, 0x169194, 0x168fd5,
+    0x1040000b, 0x16b441, 0x1040000d, 0x140000e, 0x1180001a, 0x516b505, 0xd400015, 0x1040000e,
+    0x168dd7, 0x7c00000, 0x1692c1, 0x280000d, 0x10400013, 0x25400004, 0x169485, 0x16b58f,
+    0x7c00007, 0x7c00000, 0x1c00029, 0x7c00000, 0x7c00003, 0x16b215, 0xd569345, 0x7c0000e,
+    0x16920f, 0x12c00008, 0x1571205, 0x5000008, 0x3c400013, 0x171148, 0x1696cb, 0x16b11f,
+    0x170d8b, 0x7c00010, 0x800019, 0xd400010, 0x7c00013, 0x7c00014, 0x169401, 0x10400014,
+    0xd400015, 0x8d6e54c, 0x5000005, 0xdc00006, 0x7c00003, 0xf80001a, 0x169901, 0x16e212,
+    0x7000009, 0x280000c, 0x169805, 0x2dc00000, 0x8c00001, 0x176d52, 0x169a0d, 0xd40001a,
+    0x56dd45, 0x8c00010, 0x5000015, 0xd569c92, 0x2c00000f, 0x7c00014, 0x969d15, 0x11800001,
+    0xd000001, 0x169954, 0x1698d5, 0x5000005, 0xdc00005, 0xa00000f, 0x16d913, 0x169d48,
+    0x169d89, 0x2600000b, 0x173994, 0x169dcc, 0x8c0001f, 0x26969f8e, 0x176fd2, 0x10400006,
+    0x1c0001a, 0x16a212, 0x169c13, 0x8d6a154, 0x7800015, 0x440000c, 0xa00000d, 0x3c96a34e,
+    0x156a181, 0x800010, 0x16a941, 0x16a3d2, 0x1400005, 0x11400014, 0xd96a585, 0x1714c1,
+    0x16a509, 0x176c45, 0x16a989, 0x16ad82, 0x2976b85, 0x7c0000d, 0x16a24f, 0xa000009,
+    0x3c16a78f, 0x16a292, 0x1400012, 0x516ac12, 0x1400014, 0x16adcc, 0x12c0000d, 0x156ac8e,
+    0xd400006, 0x16aad0, 0x7000014, 0x16ae12, 0x16a7c6, 0x7c00014, 0x156ae55, 0x1056aec9,
+    0x16a65f, 0xf800015, 0x1d6b04c, 0x16ac4d, 0xd56ad0e, 0x1400013, 0x16afd0, 0x26c00008,
+    0x16af92, 0x16ad53, 0x16a769, 0x40002a, 0x11c00003, 0x800004, 0x1056af18, 0x8c0000e,
+    0x11c00007, 0x800010, 0x2000009, 0x21400012, 0x16b14b, 0x156b402, 0x11c00003, 0x35c0000e,
+    0x25000015, 0x10400006, 0x16b6c5, 0x177c93, 0x16b0d3, 0x16b008, 0x26c00006, 0x16b396,
+    0x7c00013, 0xd000014, 0x16ec42, 0x12c00010, 0x16b70f, 0x1400008, 0x8c00013, 0x16b812,
+    0x16ba13, 0x800002, 0x16b34d, 0x16b8ce, 0xcc0000c, 0x10400006, 0xd5780d2, 0x16bb52,
+    0x1400009, 0x26c00014, 0x16eb12, 0x16b7cc, 0x10400007, 0xd96bb0e, 0x1c00016, 0x10400004,
+    0x8c00004, 0x16be52, 0xd000013, 0x80000e, 0x14000001, 0x10400010, 0x177d93, 0x3cc00018,
+    0x7800013, 0x177fce, 0x156b995, 0x28000008, 0x16bfc9, 0x1956e281, 0x5000012, 0x8c00013,
+    0x80000e, 0x26d6e445, 0x16bf8f, 0x1734c5, 0x296e4c8, 0xec00012, 0x25400013, 0xd000014,
+    0x2c000015, 0x116c202, 0x8c0000c, 0x1c00004, 0x16c2c5, 0x1c00006, 0x1c00007, 0x1c00008,
+    0x1738d2, 0x8c00015, 0xd400005, 0x25000013, 0x1c00007, 0x1c0000e, 0x580000f, 0x16c105,
+    0x2500000e, 0x640000c, 0x1000013, 0x1000014, 0x25c00012, 0x11400003, 0x1c00017, 0x100000d,
+    0x26800013, 0x1c0001a, 0x16c701, 0x25c00009, 0x5800012, 0xd000004, 0x16c6c5, 0xa000015,
+    0x1c00016, 0xd40000f, 0x2800010, 0x10400006, 0x1156c7cb, 0x16c60c, 0xed6ce94, 0xa000015,
+    0x16c3cf, 0x280000b, 0x7c0000d, 0xd80000e, 0x500001a, 0x16c814, 0x8c00015, 0x16c881,
+    0x1c00002, 0x175c10, 0x2596c8c4, 0xd400005, 0x1c00006, 0x175b54, 0x8c00015, 0x16c649,
+    0x16cc01, 0x26c0000b, 0x1c0000c, 0x280000b, 0x16ce45, 0x16c90f, 0x1781c8, 0x11800008,
+    0x8c00010, 0x116c9d3, 0x16ccd4, 0x5000015, 0xa16ea94, 0x7000017, 0xd800012, 0xa800006,
+    0x16c69a, 0x28000012, 0x7c0001a, 0x3d400014, 0x7c00003, 0xa00001f, 0xa000001, 0x16cac2,
+    0x1c00003, 0x96cc44, 0x16cc85, 0x8c00005, 0x800007, 0xa000014, 0x1196cd09, 0x1723ce,
+    0x80000b, 0x7000000, 0x100000d, 0x172512, 0x1000003, 0x16cd90, 0x1728d5, 0x1000003,
+    0x800013, 0x16cf14, 0x25000015, 0x1000007, 0x800017, 0x1400012, 0x1778d3, 0x2516e7ce,
+    0x16d08c, 0x8c0000d, 0x116d28e, 0xcc00012, 0x16e493, 0x172649, 0x16e895, 0x17d6d2d3,
+    0x25000014, 0x8d6d441, 0x25800002, 0x8c00005, 0x26c00004, 0x16d585, 0x172a12, 0x3e400013,
+    0x1729d4, 0x800000, 0xdd6d001, 0x178189, 0x16d38c, 0x26d6d244, 0x16d785, 0x2c00000f,
+    0x16d887, 0x1400000f, 0x16d709, 0x16d1d3, 0xcc00014, 0x16d64c, 0x1c00003, 0x16da8e,
+    0x8c0000f, 0x1c00006, 0x80000d, 0x177c0e, 0x16da13, 0x16de14, 0x175ac8, 0x8c0001f,
+    0x11400001, 0x7175fcb, 0x8c0000c, 0x2540001a, 0x8d73fc5, 0x173ec6, 0x16e993, 0xcc00014,
+    0x800009, 0x8c00029, 0x800000, 0x156d801, 0x16d402, 0x800003, 0x1c00004, 0x16dc05,
+    0x16dd86, 0x29d6dc47, 0x140000d, 0x16d509, 0x178149, 0x16df8b, 0x96e1cc, 0x800012,
+    0x16e24e, 0x56e14f, 0x175d8e, 0x177687, 0x16dbd2, 0x16de93, 0x1756d2, 0xa000000,
+    0x175c94, 0x17770d, 0x17774e, 0x16e5c4, 0x2516e41a, 0x1000006, 0x16e2c7, 0x1c00008,
+    0x96e589, 0x1400001f, 0x2740001f, 0x16ec03, 0x6400004, 0x80000e, 0x3d96e30f, 0x6c00000,
+    0x1c00008, 0x16e642, 0xd16e753, 0x1000014, 0x3d1760c1, 0x2180000d, 0x7c00007, 0x1c00008,
+    0x16e689, 0x8c00012, 0x178455, 0x1c00003, 0x16e94d, 0x16e905, 0x800006, 0x1c00007,
+    0x1c0000d, 0x656ea52, 0xa00000f, 0x1c00010, 0x656e715, 0x1140000d, 0x96ecce, 0x6400003,
+    0x800010, 0x800006, 0x800012, 0x16eb53, 0x16e8d4, 0x26000009, 0xd800002, 0x1c0000b,
+    0x800004, 0x800002, 0x640001a, 0x800007, 0x12400010, 0x177f12, 0x7c00012, 0x16ea13,
+    0x16ed45, 0x80000d, 0x16eb8e, 0xcc00003, 0xd400009, 0xdc00005, 0x26c00014, 0x800010,
+    0x2a000012, 0xd5733d2, 0x8c00013, 0xd400005, 0x1c00018, 0xcc00005, 0x25800013, 0x16ef94,
+    0x8c00015, 0x1c00000, 0x1787c8, 0x1c00013, 0x16e854, 0x21800015, 0x6800005, 0x16f0c6,
+    0x3800012, 0x1c00019, 0x11800001, 0x16f142, 0x1000003, 0x16f084, 0x16ef45, 0x16ee45,
+    0x1000007, 0x5800019, 0x5000009, 0x5000009, 0x28c00013, 0x16f014, 0xd00000d, 0x16f24e,
+    0x1000006, 0x16f110, 0x8c00008, 0x1c0001a, 0xd800012, 0x25400013, 0x16f2d4, 0x6400004,
+    0x5000001, 0x740000f, 0x171550, 0x6400008, 0x10400004, 0x21800000, 0x16f281, 0xcc0000c,
+    0x6400003, 0x16f644, 0x780000c, 0x6400006, 0x7000007, 0x17840d, 0x16f5c9, 0x16eed4,
+    0x16f195, 0x16f1cc, 0xcc00017, 0x7c0000e, 0x179401, 0xcc0001a, 0x1c00002, 0x6400003,
+    0x7d6f313, 0x16efc5, 0x1400008, 0x7c00016, 0x26c00002, 0x16f603, 0xcc00003, 0x1c00004,
+    0x8c00012, 0x25000001, 0x6c00008, 0xcc00009, 0x1c00010, 0xcc0000b, 0x140000e, 0x16f493,
+    0xcc0000e, 0xcc0000e, 0xcc00010, 0x11800002, 0x7c00003, 0xd400029, 0x1d6f694, 0x7c00015,
+    0x16f595, 0x16400002, 0x10400003, 0x25000013, 0xd40000b, 0x156f841, 0x16f44d, 0x80000e,
+    0x156f949, 0x7d6fb05, 0x178482, 0x11800012, 0x800008, 0x16fa0e, 0x800015, 0x800016,
+    0x16fbc1, 0x156fad2, 0xd400005, 0x16f88f, 0x16fd05, 0x16400016, 0xd5779c9, 0x800018,
+    0x16fd49, 0x16fb55, 0x8c00013, 0xdc00013, 0x1180000b, 0x16fe42, 0x16fccf, 0x10400004,
+    0x25000013, 0x16fc92, 0x1c00010, 0x80001f, 0x1700d5, 0x37d78014, 0x16ff4b, 0x7c0000c,
+    0x140000d, 0x157024e, 0x1758c5, 0x1180001a, 0x170109, 0x16570292, 0x16fedf, 0x1704cc,
+    0x105701d5, 0x2797014e, 0x1706c1, 0x21400004, 0x500000f, 0x170552, 0x170805, 0x170594,
+    0x500000f, 0x16fdaa, 0xc800015, 0x800018, 0x17064d, 0x17068e, 0x17048f, 0x5000008,
+    0x297050f, 0xd800001, 0x8d70753, 0x1707d4, 0xc80001f, 0x1708c5, 0x1705d5, 0x7c00002,
+    0x17a54e, 0x5000001, 0x29c00013, 0x17ab0f, 0x5000015, 0x11800005, 0x2000004, 0xdd7084f,
+    0x170a90, 0x11800009, 0x17088d, 0x17090e, 0xd970a54, 0x21400006, 0x25000005, 0x1709d2,
+    0x7000010, 0x100000e, 0x12c0001a, 0x500002a, 0x170ad4, 0x18c00001, 0x173641, 0x8c00004,
+    0x170cc4, 0x176f50, 0x173505, 0x26c00007, 0x170bc2, 0xd000014, 0x173589, 0x170b45,
+    0x175e4d, 0x175dce, 0x800010, 0x170dc9, 0x1789d2, 0x100000b, 0x175a53, 0x3dd70953,
+    0x1c00014, 0x8c0000f, 0xc800015, 0x1c00017, 0x17ac85, 0x170f13, 0x1000014, 0x11400000,
+    0x11800001, 0x1d70c02, 0x1c00014, 0x1c00004, 0x170d45, 0x7000006, 0x7000007, 0x1c00008,
+    0x170e89, 0x1000006, 0x1773c5, 0x3e00000c, 0x800015, 0x1c0000e, 0x1217110f, 0x1736aa,
+    0x177acb, 0x171192, 0x1c00013, 0x10400004, 0x170c95, 0x1777d0, 0x1c00017, 0x1000001,
+    0x173045, 0x1c0001a, 0x1c00004, 0x170f45, 0xd97a80d, 0x8c00001, 0x80001f, 0x11800009,
+    0x1c0000a, 0x171245, 0x100000c, 0x1c0000d, 0x17779f, 0x1739d2, 0x7000013, 0x7000014,
+    0x1800012, 0x178ac1, 0x175e05, 0x11400015, 0x780000d, 0x178b05, 0xdc00012, 0xd000013,
+    0x25800014, 0x8c00015, 0x14000001, 0xd80000e, 0x179515, 0xd000004, 0x170ec5, 0x176292,
+    0x7000007, 0x14000003, 0x171009, 0x800001, 0x6400005, 0xd00000c, 0x25000005, 0x2800000e,
+    0x26d713cf, 0x8c00019, 0x1711c9, 0x171089, 0x80000b, 0x1000000c, 0xa00002a, 0x17158d,
+    0x1c0000e, 0x1712cf, 0x800010, 0x171292, 0x1c0000b, 0xd000014, 0x1171054, 0x171315,
+    0x8d71501, 0x1000012, 0x175381, 0x11571684, 0x171645, 0x1c00006, 0x1716c7, 0x171b08,
+    0x176cc1, 0x174a88, 0xd400009, 0x1c0000c, 0xa000004, 0x100000e, 0x57160f, 0x1000010,
+    0x176ec9, 0x17ad8b, 0x2d571793, 0x171354, 0x175153, 0x175694, 0x1c00017, 0x17ae0c,
+    0x11800001, 0x17171a, 0x140000f, 0x171841, 0xc800015, 0x1c00003, 0x1b00001f, 0x171b85,
+    0x26c00006, 0xd000007, 0x17b113, 0x171909, 0x175941, 0x17ae4d, 0x100000f, 0x171a8d,
+    0x175805, 0x8d719cf, 0x2800013, 0x8c00012, 0x800000, 0x171ac1, 0x2ed71b54, 0xa000015,
+    0x7000004, 0x171dc5, 0x1c0001a, 0x800007, 0x1c00008, 0x171bc9, 0x171cc1, 0x1c0000b,
+    0x2800015, 0xd576a85, 0x11971e05, 0x8c0000f, 0x1b000010, 0x1769c9, 0x20c00009, 0x171d93,
+    0x4d72014, 0x640000c, 0x1c0000d, 0x17c205, 0xd40000f, 0x17ab46, 0x5000012, 0x171f92,
+    0xd571c93, 0x1721d4, 0x10400003, 0x280001f, 0xdc00005, 0x280002a, 0x172382, 0x17211a,
+    0x175849, 0x10400012, 0x172086, 0x2172047, 0x172701, 0x8c0000e, 0xd800014, 0x176801,
+    0x5172bc5, 0x175b12, 0x17258e, 0x176985, 0x800009, 0x5000001, 0x8c00029, 0x2972613,
+    0x1724d4, 0x5000005, 0x7c0000f, 0x140000f, 0x2800008, 0x5000009, 0x11800005, 0x280000b,
+    0x7800015, 0x1400004, 0x179881, 0x500000f, 0x5000010, 0x7d72c05, 0x179c05, 0x17afc9,
+    0xd972d54, 0x7c00009, 0x7c0001f, 0xd00000d, 0x172d8c, 0xec0001f, 0xd00000e, 0x172e8f,
+    0x17a4d3, 0x6c0000b, 0xd000012, 0x25400013, 0x7800029, 0x17c181, 0xc800015, 0xdc00017,
+    0xec00012, 0x17400013, 0x1040000d, 0x3d000002, 0x8d72c83, 0x800004, 0xa000003, 0x800006,
+    0xd400007, 0x10400008, 0x17ac05, 0x1400012, 0x1040000b, 0x1040000c, 0x7c00000, 0x3cd72ece,
+    0x172f82, 0xdc0000c, 0xd00002a, 0xd572e52, 0x172c53, 0x7d72e14, 0x10572f15, 0x172f49,
+    0xa000015, 0x173741, 0x17308c, 0x17300d, 0x17330e, 0x173885, 0x2800008, 0xd400005,
+    0x173392, 0x173453, 0x8c0000c, 0x17c305, 0x8c0000c, 0x177f4f, 0x800018, 0x2740000f,
+    0x178212, 0x173842, 0xd800012, 0x800004, 0x17c3d2, 0x173b86, 0x1000007, 0xa000008,
+    0xa000012, 0x800000, 0x173a81, 0x2540000c, 0x17378d, 0x173c4e, 0x174005, 0x8c0001f,
+    0x17c413, 0x25000014, 0x2973f53, 0x973e14, 0x17c4c9, 0x1000006, 0x1c00005, 0xd976741,
+    0x27173b0f, 0x1c00010, 0x173bdb, 0x18c00005, 0xd000013, 0x1c00015, 0x8d74055, 0xcc00000,
+    0xdd74281, 0x178350, 0x173f03, 0x174444, 0x1744c5, 0x1c00014, 0x174607, 0xa000001,
+    0x28000012, 0x27176853, 0x1746cb, 0x5176895, 0xa000006, 0x17448e, 0x17c5cc, 0x5c00009,
+    0x1768da, 0x17b345, 0x174553, 0x174794, 0x17c652, 0x1180001f, 0x800000, 0x10574901,
+    0xa000012, 0x17411a, 0x29c00014, 0x174e05, 0x174b46, 0x575087, 0x174408, 0x174509,
+    0x1000014, 0x25174f4b, 0xd174a0c, 0x1745cd, 0x17530e, 0x800010, 0x8c00005, 0x800012,
+    0x174f12, 0x175493, 0x7c00006, 0x174855, 0x17d64c, 0x175517, 0xcc00000, 0x174581,
+    0x11752da, 0x140000d, 0x1057958e, 0xd9753c5, 0x8c00001, 0x1400001f, 0xfc00008, 0x25c00009,
+    0xd800005, 0x517534b, 0x11800002, 0xd578648, 0x178389, 0x3cc00002, 0x1748d0, 0x1000029,
+    0x27400001, 0x16400006, 0x31175714, 0xa000015, 0x17c445, 0x7000017, 0xd40000e, 0x1c00019,
+    0x7000005, 0x3e800006, 0xa000000, 0x25c00009, 0x175f02, 0x179e92, 0x80000b, 0x100000c,
+    0x176046, 0x174b0e, 0xd400017, 0x140000c, 0x175f85, 0x175452, 0xa000005, 0x11400014,
+    0x17608e, 0x1c00001, 0x1400013, 0x2a000014, 0x176012, 0x176153, 0xd575d0f, 0x1400006,
+    0x17dc4e, 0x1800009, 0x176113, 0x176254, 0xd400015, 0xd5761c1, 0x179f85, 0x3f40000e,
+    0x175f44, 0x176505, 0x1000006, 0x17c592, 0x1000008, 0x176309, 0x100000a, 0x17668b,
+    0x179ecf, 0x17a110, 0x17dfc1, 0x17644f, 0x26c00006, 0x17a094, 0x2517e48c, 0x176793,
+    0x1000014, 0x5000015, 0x1000016, 0x5000005, 0xa000000, 0x11800001, 0x1c0001a, 0x176643,
+    0xd57a88c, 0x176b0c, 0x17a48e, 0x780000e, 0x1bd76708, 0x7c00010, 0x17aa52, 0x176d92,
+    0x100000c, 0x176e02, 0x17e453, 0x17658f, 0x8c00010, 0x1783c9, 0x177087, 0x26c00013,
+    0xa000014, 0x8c00005, 0x1400015, 0x140000f, 0x105770cd, 0x17734e, 0x7c00012, 0x17b008,
+    0x8c00009, 0x176f12, 0x17abcb, 0x177114, 0x177295, 0x177002, 0x7d772c3, 0xd400001,
+    0x176e45, 0x10400006, 0x15775c2, 0x7c0001f, 0x177489, 0xd000012, 0x800006, 0x1774cc,
+    0x1400000c, 0x17758e, 0x21400001, 0x7c00010, 0x500000c, 0x177a12, 0x8c00013, 0x18c00002,
+    0x177810, 0x10400004, 0x1577a52, 0x177518, 0x177cc7, 0x10400015, 0x100000d, 0x7c00017,
+    0x177e0b, 0x1c00010, 0x1640000d, 0x177e4e, 0x177d04, 0x177d50, 0x10400006, 0x177a92,
+    0x80000e, 0x177b14, 0xa000000, 0x800001, 0xa000002, 0x16400013, 0x17c1d4, 0x177dc5,
+    0x16400010, 0xd000004, 0x25177ed2, 0x177bd3, 0x1c0000a, 0x1c00005, 0x740000c, 0x178241,
+    0xa000002, 0x1000003, 0x1000004, 0x178285, 0x978092, 0x3ec00007, 0x2800001, 0x517e305,
+    0x8c00010, 0x700000b, 0xa000005, 0x17a7d3, 0xb17a594, 0x14000015, 0x7000010, 0x17ec94,
+    0x1782cb, 0xd400005, 0x2d400014, 0x17c609, 0x8c00012, 0x178310, 0x11800002, 0x7c00003,
+    0x16400004, 0x178514, 0x1000010, 0x1c00000, 0x17e601, 0x280001f, 0x16400002, 0x1800015,
+    0x8c0000c, 0x17868d, 0x97858e, 0x25000013, 0x178e41, 0x1784c9, 0x178892, 0x17ec4e,
+    0x178a8c, 0x25178795, 0x25000008, 0xf800008, 0x178c09, 0x17ed81, 0x1578b92, 0xd579041,
+    0xd578854, 0xcc0000f, 0x8c0000f, 0x979145, 0x178758, 0x178d12, 0x17ed45, 0x178ec9,
+    0x8d78c95, 0x7c00002, 0x17ea89, 0x17e98f, 0x979282, 0x17934f, 0x7c0000e, 0x1400008,
+    0x1790d2, 0x26c00007, 0x17ec12, 0x8c00015, 0x1040000d, 0xd57f052, 0x178e0c, 0x157964d,
+    0x17970e, 0x17a392, 0x10400010, 0xd400003, 0x179792, 0x178d9f, 0x1794d4, 0x105793d5,
+    0x1579448, 0x179749, 0x7c00003, 0x21400004, 0x17960c, 0x1797cd, 0x8d798ce, 0x17e5cc,
+    0x17926a, 0x2697ecce, 0x179b52, 0x179993, 0x17980d, 0x179dce, 0x179cc1, 0x1000005,
+    0x1c00006, 0xfc00001, 0x179fc5, 0xd000014, 0x5000009, 0xd400005, 0x179c49, 0x14000001,
+    0x17f405, 0x500000f, 0x1580000f, 0x17a3c5, 0x179e4f, 0xd800012, 0x17a354, 0xec00009,
+    0x11800010, 0x5000008, 0xd00000c, 0x17bc53, 0x17be94, 0x8c0000f, 0xa000000, 0x17f18d,
+    0xec00012, 0x17a013, 0x2800001a, 0x8c00015, 0x179c9f, 0x17ed14, 0x17a2c2, 0xa000009,
+    0x1c00004, 0x26c00005, 0x1c00006, 0x1c00007, 0x1000008, 0x2a00000e, 0xf800029, 0x1c0000b,
+    0x1c0000c, 0xa000013, 0x17fa0b, 0xd800012, 0x97a510, 0xa000017, 0x1c00012, 0x1000013,
+    0xa00001a, 0x5000015, 0x1000001, 0x1000017, 0x1040000c, 0x2517fc15, 0x1c0001a, 0x1000006,
+    0x17a1c7, 0x97a401, 0x1000009, 0x1400013, 0xdc00005, 0x17a305, 0x10400003, 0x1400008,
+    0x8c00009, 0x8c00009, 0x10400007, 0x1c00012, 0x1000013, 0x1c00014, 0x40000e, 0x8c0000f,
+    0x1c00017, 0x80000e, 0xed7a5c1, 0x10400010, 0x400014, 0x2800015, 0x17a905, 0x800014,
+    0x17a855, 0x1c00002, 0x1c00003, 0x17fc8c, 0x1c00005, 0x2000006, 0x1c00007, 0x140000c,
+    0x1d7a9cf, 0x17aac1, 0x1c00002, 0x28000012, 0x17a793, 0x800005, 0x6400006, 0x1c00007,
+    0x17eb85, 0xd400001, 0x17b041, 0x1c0000b, 0x17adcc, 0x1c0000d, 0x17ae85, 0xd00000c,
+    0x8c0001f, 0x800009, 0x17af92, 0x1c00013, 0x1c00014, 0x8c00012, 0x100000d, 0x1400002,
+    0x80000d, 0x8c0000e, 0x2517c2d2, 0x3f000012, 0x1d000013, 0xd000012, 0xd400001, 0x80001f,
+    0x517d1c1, 0xfc00012, 0x17b285, 0x180013, 0x1000007, 0x1400010, 0x17b0c9, 0x5000008,
+    0x80001f, 0x500000c, 0x17b441, 0xfc0000e, 0x100000f, 0x17b384, 0x1197b2c5, 0x1000004,
+    0xf80000f, 0x17d492, 0x17b509, 0x17d614, 0x5000015, 0x17b1cc, 0x25000005, 0x140000d,
+    0x400014, 0x800010, 0x697e6c5, 0x1000006, 0x17f5d2, 0xd000014, 0x26d7aed5, 0xa000016,
+    0x17b581, 0x1c00002, 0x17b7c3, 0x25800004, 0x17b545, 0x17b686, 0x2557ba07, 0x800008,
+    0x17b089, 0x1c00014, 0x800029, 0x1d7ba4c, 0x17fb87, 0x2000000e, 0x17ffcc, 0x1000006,
+    0x1000007, 0x26d7fb0c, 0x17bb93, 0x17ba94, 0x27400015, 0x2b80000c, 0x1c00017, 0x17c6ce,
+    0x8c00005, 0x1d7bbda, 0x17bc01, 0x1c00002, 0x17c353, 0x1c0000a, 0x100001f, 0x180054,
+    0x25400007, 0xa800008, 0x11800009, 0x17bd81, 0x97b84b, 0x17fd8b, 0x1000013, 0x17bd05,
+    0x1bd7bb4f, 0x17f901, 0x180292, 0x7000012, 0x17bc93, 0x17bcd4, 0x11800015, 0x17c0cd,
+    0x5000014, 0x17b9cf, 0x16800006, 0x40001a, 0xd57fdda, 0x17c153, 0x17bad4, 0x17be55,
+    0xa00000c, 0x100000e, 0x1e40000e, 0x17f993, 0x5000001, 0xdc00012, 0xd000012, 0x17c293,
+    0x17c394, 0x8c0001f, 0x17c501, 0x25000002, 0x11800009, 0x2557c7c4, 0x17c685, 0x17c986,
+    0x401800c8, 0x25000012, 0x500000f, 0x11800010, 0xa17c8cb, 0x2500000c, 0x26c00005, 0x17e694,
+    0xa17ca0f, 0x17fcc5, 0x181189, 0x17cac1, 0x17ca93, 0x2597cb14, 0x17c844, 0x17c945,
+    0x17fe8c, 0x17ccc7, 0x181e01, 0x17ca49, 0x181d4e, 0x2580000b, 0xf800002, 0x181e49,
+    0x17d001, 0x17c9cf, 0x12400000, 0x157cbc1, 0x17cf05, 0x17cc93, 0x17ce94, 0x17d045,
+    0xd000006, 0x17c747, 0x7c0000e, 0x17d0c9, 0x5000001, 0x17ce4b, 0x8c00013, 0x17d150,
+    0x17cd8e, 0x1840cc, 0x17d453, 0x17d254, 0x17d7c9, 0x17d213, 0x17ce14, 0x17d404,
+    0x11800001, 0x17d51a, 0x17d903, 0x17d684, 0x17d19a, 0x5000012, 0x280001f, 0x17d78c,
+    0x11800009, 0x17d54e, 0x181d85, 0xcc00002, 0x1c00019, 0x17d852, 0xdc00013, 0x17d814,
+    0x17d701, 0x17e205, 0xa000009, 0x2800005, 0x17d6c5, 0x181d10, 0xdc00013, 0xd00000b,
+    0x17d749, 0x700001a, 0x17e50e, 0xfc0000c, 0x57f7d3, 0xd000013, 0x40c0000e, 0x17e553,
+    0x17e094, 0x5000012, 0x17db81, 0x1810d3, 0x8c00015, 0x17dbc4, 0x17db45, 0x17d986,
+    0x17dd47, 0x1c00008, 0x517db09, 0x5000015, 0xa000000, 0x8d7da01, 0x10400004, 0x17dcc3,
+    0x1197dc8f, 0x25c00005, 0x5000013, 0x8c00001, 0x17dd13, 0x14000001, 0x5000015, 0x25000005,
+    0x157e8c1, 0x1040000c, 0xec00008, 0x17ebc4, 0xd400010, 0x26c00006, 0xd17eb47, 0x17e013,
+    0x17ded4, 0x8c0000f, 0x6c0000e, 0x6c0000f, 0x8c00012, 0x2557df53, 0x17df94, 0x14000015,
+    0xd000001, 0x800002, 0x7181106, 0x25400014, 0x700001a, 0x17400009, 0x7c0000c, 0xd00000d,
+    0x1140000c, 0x184a45, 0x1040000b, 0x1040000c, 0x16400002, 0x17dd8e, 0x18490c, 0x181353,
+    0x10400006, 0x17ddd2, 0x17de13, 0x17de49, 0x10400015, 0xd400005, 0x17e14c, 0x400007,
+    0x17e38e, 0x17e804, 0x17e645, 0x11400009, 0x17e412, 0xd57e0d3, 0xd400009, 0x10400015,
+    0xd400012, 0x183ccf, 0x39802d2, 0x800013, 0x80000d, 0x80000e, 0x17f205, 0xcc00010,
+    0x2617e953, 0x17ead4, 0x1400013, 0x7c00014, 0x97ee95, 0x3f800004, 0x1400019, 0x2a000006,
+    0x8d7ee4f, 0x27400001, 0x17edc9, 0x17efd2, 0x8c0001f, 0x17f08c, 0x8c00015, 0xd57f10e,
+    0x17f1c5, 0x80000d, 0x1849ce, 0x17f0d2, 0x8d7ef49, 0x18150d, 0x2a000015, 0x16400004,
+    0x80001f, 0xcc00018, 0xc80000f, 0x1400002, 0x17f309, 0xc97ee12, 0x26c00002, 0x17f24c,
+    0x7800015, 0x17f38e, 0x500000b, 0x21400004, 0x140000b, 0x17f792, 0xd40000d, 0x17f554,
+    0x10400015, 0x10400016, 0x7c0001f, 0x157f012, 0x80000d, 0x1040000e, 0x17f355, 0x5000008,
+    0x5000009, 0x16400012, 0xd400013, 0x17f694, 0x8c00001, 0x280002a, 0x17f483, 0x5000001,
+    0x1417f605, 0xd800012, 0xa000004, 0x27400009, 0x8c00010, 0x19400001, 0x17f9cb, 0xa000013,
+    0x5000014, 0x5000015, 0x17fb4c, 0x17fac4, 0x17f845, 0x3800006, 0x17fbc7, 0x17f594,
+    0x517fa49, 0x1811c9, 0xa000014, 0x1400000f, 0x8c00010, 0x75822c5, 0x1400005, 0x184841,
+    0xed7fe14, 0x8c00015, 0x181252, 0x25000013, 0x17fe45, 0xa00000d, 0x7000017, 0x7c00008,
+    0xa000009, 0x700001a, 0x6c00012, 0xec0000c, 0x1801c1, 0x184a0f, 0x17fecf, 0x7000004,
+    0x180085, 0x8d7f812, 0x3fc00013, 0x184b45, 0xec00015, 0x8c00001, 0x6c00010, 0x380000c,
+    0x380000d, 0x8c0000c, 0x140000c, 0x100000e, 0xd400001, 0x5c00012, 0x8c0001f, 0xd800012,
+    0x180105, 0x7000016, 0x3800007, 0xa00000f, 0x757ff89, 0xa000001, 0x180192, 0x800002,
+    0x7000014, 0xa000005, 0x8c00002, 0x800000, 0x18c00001, 0xfc00012, 0x80000c, 0x158218b,
+    0xcc00000, 0x2c180301, 0x180202, 0xa00001f, 0x980384, 0xcd80585, 0x26c00006, 0x251803c7,
+    0x1848d0, 0x180609, 0x1400012, 0x1865c7, 0x18044c, 0x1c00012, 0x180341, 0x11800001,
+    0x180550, 0x1862ce, 0xa180885, 0x180813, 0x255804d4, 0x8c00015, 0x1807c9, 0x11800009,
+    0x7983e8c, 0x1c00019, 0x18428e, 0xfc0000e, 0x1140000f, 0x400010, 0x2800012, 0x8c0001f,
+    0x1805d3, 0x1180694, 0x6400000, 0x13d80481, 0x6c00002, 0x186993, 0x32800004, 0x180705,
+    0x6c00006, 0x6c00007, 0x7000008, 0x1c00009, 0x1869cf, 0x6c0000b, 0x6c0000c, 0x181b41,
+    0x11580b8e, 0x700000f, 0x6c00010, 0xf800005, 0x1c00012, 0x40400013, 0x180854, 0x181c49,
+    0x15800014, 0x1c00017, 0x1808c5, 0x180c46, 0x180c9a, 0x181e8f, 0x186ec8, 0x18504f,
+    0x8c00004, 0xc80001f, 0x400012, 0x181dd5, 0x18094f, 0x5000012, 0x25181ec9, 0x8c00012,
+    0x180c13, 0xa000000, 0x14000001, 0x2500000e, 0x1c00003, 0x800004, 0x800005, 0x27000012,
+    0xcc00000, 0xd000014, 0x12000009, 0x180d83, 0x80000b, 0x180d4c, 0x800006, 0xf800029,
+    0x980bcf, 0x8c00005, 0x1000007, 0x180cd2, 0x800005, 0x1d80f14, 0x11800015, 0xd80000c,
+    0x8400010, 0x187044, 0x740000f, 0x180f53, 0x180f94, 0xd800012, 0x180b01, 0x1000013,
+    0x25400014, 0x7180ed9, 0x181005, 0x10400008, 0x780000e, 0x8c00008, 0x184101, 0x500001f,
+    0x7800012, 0x8c00013, 0x700000d, 0x10400010, 0xd580e0f, 0x25c0000f, 0xcc00018, 0x21400004,
+    0x40981053, 0xdc00006, 0x8c00007, 0x186707, 0x7c00009, 0x10c00001, 0x1058128b, 0xec00012,
+    0x184093, 0x18168e, 0x5000015, 0x7c00010, 0x8c00008, 0x180e92, 0x1812c1, 0x7d81394,
+    0x1581455, 0x1814c4, 0x7c00005, 0x800018, 0xd000018, 0x800000, 0x981489, 0x3800002,
+    0x187647, 0x1818cc, 0x1816cd, 0x18160e, 0xd00000f, 0x2500000e, 0x400009, 0x181c12,
+    0x41181a13, 0x181554, 0x800002, 0xdc00003, 0xd400013, 0x6c00010, 0x800006, 0x27400019,
+    0x1000013, 0xa000001, 0x7000015, 0x7000003, 0x1821c4, 0x181f45, 0x18164e, 0x181f07,
+    0x181750, 0x1846c1, 0x1581952, 0x181793, 0x1817d4, 0xd400013, 0x18238e, 0xd000002,
+    0x7000010, 0x184749, 0x582445, 0x181fd3, 0xec00002, 0x187dc9, 0x119824c9, 0x1844cf,
+    0xa00000b, 0x98248c, 0x8c00008, 0xdc00003, 0x3e80000f, 0x183ec5, 0x41c00005, 0x25800007,
+    0x8c00005, 0x1c00006, 0xa000015, 0x187415, 0x8c00012, 0x26c00013, 0x80000e, 0x18441f,
+    0x1000010, 0xa000010, 0x25000012, 0x187703, 0x1e40001f, 0xcc00000, 0x41582601, 0x800002,
+    0x800003, 0x182a04, 0x182905, 0x800006, 0x182d47, 0x800008, 0x28000009, 0x80000a,
+    0x2d80000b, 0x188281, 0x80000d, 0x18280e, 0x2c40000f, 0x640000b, 0xd40000c, 0x2500002a,
+    0x182c13, 0x183294, 0x28000015, 0x800016, 0x800017, 0xa000001, 0x1889c5, 0x1823da,
+    0x187ac8, 0x182505, 0x1c00006, 0x1893c5, 0x184781, 0x8c00009, 0x1847c3, 0x189805,
+    0x184b85, 0x25189889, 0x2800012, 0x18240f, 0x25000005, 0xcc00000, 0x1583701, 0x182f02,
+    0x26c00014, 0x182884, 0x25183105, 0x582f46, 0x2b582647, 0x582348, 0xa000009, 0x80000a,
+    0x4198308b, 0x18270c, 0x182e4d, 0x1836ce, 0x182c4f, 0x25c00009, 0x8c00013, 0x8c00002,
+    0x183453, 0x26d83514, 0x183155, 0x800016, 0x183597, 0x800000, 0x183981, 0x118361a,
+    0x500000b, 0x500000c, 0x183945, 0x189f4c, 0x8c00005, 0xf000008, 0x25c00009, 0x185352,
+    0x18364b, 0x2fc00012, 0x1876c2, 0x183f01, 0x1839cf, 0x183d10, 0x183829, 0x183c45,
+    0x183b53, 0x183dd4, 0x8d84008, 0x5183d89, 0x18760c, 0x18a44c, 0x183a59, 0x7c00012,
+    0x16400003, 0x1400004, 0x80000c, 0x1872d3, 0x98620d, 0xd40000e, 0xcd84054, 0x1800015,
+    0x1040000b, 0x185912, 0x1843cd, 0xd58444e, 0x18419a, 0x184249, 0x18a5d2, 0x184152,
+    0x1845cc, 0x5000005, 0xc98454e, 0x16400016, 0x11400000, 0x1b400009, 0x184692, 0xc984713,
+    0xd000002, 0x8d84e85, 0x500000c, 0x18464f, 0x5000005, 0x800009, 0x1040000e, 0x2c000001,
+    0x8c00012, 0x8c00015, 0x1584bcc, 0x184d45, 0x26584c8e, 0x189155, 0xfc00012, 0x140000d,
+    0x184e12, 0x184f53, 0x184e4c, 0x8c00015, 0x8c0000e, 0x6400019, 0x184cc1, 0x10400015,
+    0x184f92, 0x1850d3, 0xa184ec5, 0xa000000, 0x985201, 0x11400002, 0x8d84f09, 0x1c00004,
+    0x18a9c6, 0x1c00006, 0xa184fc7, 0x1c00008, 0x184d8f, 0x18a813, 0x2cc0000b, 0xec00012,
+    0x185d42, 0x25800014, 0xa18510f, 0x11400010, 0xa000001, 0xdc00003, 0x1d85313, 0x6c00014,
+    0xf800015, 0x6c00016, 0x11400017, 0x185281, 0x8c00009, 0x185243, 0x185b90, 0x14185405,
+    0xd585ed2, 0x189905, 0xd40000f, 0x7c00002, 0x185b01, 0xa000012, 0x25800013, 0x185514,
+    0x185ac5, 0x18538f, 0x8d85450, 0x26c0000f, 0x185a89, 0x25800013, 0x1400004, 0x14000015,
+    0x1852c2, 0x10400003, 0x8c0000f, 0x189d92, 0xdc00013, 0x1855c7, 0x186c45, 0x80000d,
+    0x185a4e, 0x8c0001f, 0x7d8560c, 0x1c0000a, 0x18564e, 0x186f4c, 0x1856d0, 0xd400003,
+    0x1853d2, 0x185853, 0x185714, 0x185695, 0x16800013, 0x185789, 0x1b400009, 0x185c81,
+    0x18580c, 0x186041, 0x1859ce, 0x185a05, 0x18ab08, 0x185f45, 0x8d858d2, 0x185b49,
+    0xd585894, 0x185e81, 0x10400006, 0x1400004, 0x1860c1, 0x8d85f05, 0x18a907, 0x5185e4f,
+    0x186085, 0x500000e, 0x186d4e, 0x1b400001, 0x185f89, 0x18a78e, 0x1400012, 0x8c0000f,
+    0xa000009, 0x186682, 0x18624f, 0x186804, 0x185fd4, 0xdd86452, 0x186393, 0x185cdf,
+    0x7c00003, 0x7000012, 0x1180001a, 0x1866cc, 0x186b01, 0x80000e, 0x186909, 0x1b400009,
+    0x5000005, 0x1868cc, 0x1863d3, 0x18658e, 0x800015, 0xd586a82, 0x800006, 0x186952,
+    0x186a53, 0x800006, 0x8c00015, 0x11800010, 0x11c00013, 0x8c00018, 0xd400005, 0x26d86a14,
+    0x10400010, 0xcc00000, 0x11800005, 0x800010, 0x40000b, 0xd586b52, 0x7d86b85, 0x11400001,
+    0xd98ad54, 0xdc0000c, 0x186f89, 0x186c85, 0x26c00013, 0x400014, 0x1400012, 0x8c00009,
+    0xa000000, 0xd587101, 0x1c00019, 0x1c00003, 0x187144, 0x11800005, 0x11400000, 0x1000007,
+    0xa000008, 0x400013, 0x9800019, 0x26800005, 0x1140000c, 0x1758720d, 0x5000008, 0xd800014,
+    0x500000b, 0x1580000b, 0xcc00002, 0xa000013, 0x1000014, 0x1871c1, 0xec00010, 0x8c0000c,
+    0x18ae45, 0x187285, 0x187254, 0xd400015, 0xd186f08, 0x187309, 0x189c50, 0xa80000d,
+    0x189cd2, 0xdc00013, 0x800005, 0x18734f, 0x7c00006, 0x187542, 0x8c00012, 0x16400004,
+    0x8c00012, 0xa000029, 0x1877c7, 0x8c0000d, 0x1588f0e, 0x700001b, 0x1180000b, 0x18774c,
+    0x188592, 0x187a4e, 0x800014, 0x8c0001f, 0xd000003, 0xd587912, 0xd400013, 0x187994,
+    0x187815, 0x8c00016, 0x1400002, 0x8c00018, 0x5000009, 0x1c0002a, 0x18948d, 0x18a00e,
+    0x8d87d08, 0x187789, 0xdc00005, 0x188241, 0x187ccc, 0x187e8d, 0x187d8e, 0x1882c5,
+    0x187b50, 0x1587f04, 0x187fd2, 0x187c49, 0x187d54, 0x10400015, 0x1884cc, 0x2800003,
+    0x187a98, 0x7c0000c, 0x187e0d, 0x18818e, 0x16400004, 0x189e01, 0x1588546, 0x18bb8c,
+    0x7d88053, 0x188314, 0x5000012, 0x7800019, 0x5000005, 0x280000d, 0x18834e, 0x188701,
+    0x10400010, 0x188b41, 0x188692, 0x7d88645, 0x518a410, 0x188d05, 0x800008, 0x79886c9,
+    0xd400014, 0x8d89089, 0x18a893, 0x42000003, 0x500001f, 0x80000f, 0x189545, 0x18880f,
+    0x188752, 0x500000c, 0x188852, 0x1888cb, 0x1892cc, 0x8d887d5, 0x18930e, 0x280002a,
+    0x518944f, 0x80000e, 0x189692, 0x7c00012, 0x188c94, 0x800012, 0x2989795, 0x188f5f,
+    0x188a41, 0x189d41, 0x2800019, 0x2000009, 0xdc00005, 0x18a285, 0x2ac00007, 0x1589208,
+    0x189709, 0x18a249, 0x18892a, 0x1891cc, 0x1890cd, 0x298950e, 0x5000003, 0x18a30f,
+    0x5000005, 0x189ad2, 0x189c13, 0x189614, 0x27589655, 0xd000016, 0x800000, 0x8c00001,
+    0x6400002, 0x18b64b, 0x18abce, 0x189b90, 0x7000006, 0x7000007, 0x18a493, 0xd400013,
+    0x26000014, 0x25800013, 0x1c0000c, 0xa00000d, 0x2800001, 0xcc00005, 0x8c00001, 0x18bd0b,
+    0x1c00012, 0x1000013, 0xf80002a, 0x7000001, 0x1000016, 0x7000017, 0x1d000009, 0x3800005,
+    0x640001a, 0x42589ec7, 0x1400001, 0x3800009, 0x14000001, 0x7c0000b, 0x18a585, 0x5000005,
+    0xd000013, 0x8c00003, 0x18a649, 0x5000009, 0x1c00012, 0xd000013, 0x7000014, 0xd40001a,
+    0x7000016, 0x7000017, 0x7c0000f, 0x18a4c3, 0x7c00000, 0x28000012, 0x10400015, 0x16400007,
+    0x80000e, 0x800013, 0x7000014, 0xd40000b, 0xd800008, 0xd800013, 0x98a50e, 0x1140000c,
+    0x1040001f, 0xd80000f, 0x800012, 0xd400013, 0x800014, 0x10400015, 0x18a74c, 0x7c00013,
+    0x18a68e, 0x18c1d0, 0x800029, 0x2800029, 0x18a712, 0x798a553, 0xd58a854, 0x18a3d5,
+    0xa000005, 0x10400002, 0x10400003, 0xd000004, 0x8c00009, 0x780000c, 0x8c0000d, 0x1400001,
+    0xa00000d, 0x380000e, 0x18b6c5, 0x18ad85, 0x8c00013, 0x18b8ce, 0x18a8d5, 0x42800009,
+    0x8c00015, 0x1c00000, 0x1c00001, 0x25d8b9ce, 0x6400003, 0x2d40000f, 0x11800008, 0x1c00006,
+    0x18c388, 0x500000b, 0x18aa89, 0x8c00015, 0xd800009, 0xd400001, 0xd400010, 0x1d8ae0e,
+    0x1180000b, 0x18b785, 0xdd8af01, 0x98aed2, 0x5000008, 0x18ba92, 0x58b0c5, 0x1c00016,
+    0x500001a, 0x18cdd4, 0x18b109, 0x1c0001a, 0xfc00008, 0xd00000c, 0xd00000d, 0x9800029,
+    0xdc0000f, 0x5000005, 0x18ce94, 0xd000012, 0xdc00013, 0x26c00014, 0x58b1d5, 0x8c00009,
+    0xdc00017, 0x18afc1, 0x1400014, 0x8c0000f, 0xa000009, 0x7d8adc5, 0x7c00003, 0x11800010,
+    0x6400001, 0x7d8b149, 0xd000003, 0x18bbd4, 0x4218b209, 0x1c00006, 0x5000006, 0x18b44c,
+    0x98c043, 0x2680000e, 0x25400029, 0x18ab53, 0x18b254, 0x140001f, 0x18b493, 0x500000b,
+    0x1400008, 0x6400012, 0x40000d, 0x7c00018, 0x18b2d5, 0xd400003, 0x12c00004, 0x1400008,
+    0x25000013, 0x12c00007, 0x16400002, 0x10400003, 0x16400004, 0x9c00015, 0xd000004, 0x10400009,
+    0x18b4ce, 0x10400009, 0x18ba0c, 0x218dd85, 0x18ba4e, 0x18bfcc, 0x18b28e, 0x1400015,
+    0x18b412, 0x16400010, 0x658b5d2, 0x5800013, 0x16400014, 0x18b395, 0x14000001, 0x8c0000f,
+    0x14000010, 0x18b581, 0x18b345, 0x18b703, 0x5000001, 0x18b745, 0x18b3c9, 0xdd8be01,
+    0xd400005, 0xec0000c, 0x7c00000, 0x18bf05, 0x8c0000f, 0x18e2c5, 0x8c0000f, 0xec00012,
+    0x2518b613, 0x25800014, 0x8c00015, 0x18b889, 0x18b954, 0x518bacf, 0x18c001, 0x7c0000d,
+    0x18be8e, 0x18be53, 0x18bf45, 0x8c00015, 0x18bed2, 0x7c00013, 0x8c00009, 0x500001f,
+    0x26c00009, 0xf800001, 0x200000d, 0x2558bc81, 0x1400000f, 0x8c0001f, 0x18e08f, 0x18c145,
+    0x18bd93, 0x25400002, 0x5000003, 0x18c189, 0x80000d, 0x18d04e, 0x7c00005, 0x18ea0c,
+    0xd000009, 0x18bf8f, 0x18d592, 0x18c54c, 0x18c202, 0x18c3c1, 0x18bd54, 0x18de81,
+    0x26c00006, 0x18c785, 0x18c113, 0x11800005, 0x80000d, 0x18c589, 0x8c00001, 0x8c00001,
+    0x18c28e, 0xd40000c, 0x18c6c5, 0xec0000f, 0x8d8c312, 0x798c353, 0x2800012, 0x7000000,
+    0x12c00016, 0xec0000c, 0xec0000c, 0x18c745, 0x8c0000e, 0x10400006, 0x800001, 0xdd8ca12,
+    0x18c7c9, 0x26c00014, 0x8c0000c, 0x8c0001f, 0x12400009, 0x18c985, 0x5000005, 0x11800005,
+    0xec00012, 0x2518c452, 0xdd8c493, 0x2580000b, 0x2a400015, 0x8c0000c, 0x18ccc1, 0x18c418,
+    0x5000004, 0x8c00006, 0x18ce05, 0x18cc12, 0x18c654, 0x500001a, 0xa000016, 0x98ce42,
+    0x2500000c, 0x18eec1, 0x18ca9a, 0xdc00010, 0x18d087, 0x18c952, 0x2c18cc41, 0xdc00013,
+    0x18cf13, 0x18d18c, 0x18cd05, 0x18d10e, 0x18f14c, 0x10400010, 0x18cd89, 0x18ced2,
+    0x18cf53, 0x7c00014, 0x10400015, 0x98d2c2, 0x8c0000f, 0x18d601, 0x8c0000f, 0x10400006,
+    0x19000f, 0x18d705, 0x10400009, 0x25c0000c, 0x8c00017, 0x98d34c, 0x26000003, 0x18d50e,
+    0x18cfc5, 0xcc00010, 0x7c00007, 0x18d492, 0x1c0000b, 0x11800002, 0xdd8da12, 0x18d653,
+    0x18e841, 0x18d5ce, 0xd000007, 0x7c00012, 0xf800005, 0x1c00014, 0x18fe8e, 0x7d8d6cc,
+    0x5000009, 0x18d38e, 0xdd8e001, 0x1400010, 0x1400014, 0x18d7d2, 0x18e1c5, 0x18d694,
+    0x8d8d755, 0x12c00003, 0x18e289, 0x7c00005, 0x800006, 0x2800000c, 0xd000008, 0x18d849,
+    0x18dc8c, 0xdc00010, 0x140000d, 0xd58dbcd, 0x2698db8e, 0x18e3d4, 0xd800012, 0x25400013,
+    0x18dd12, 0x18de15, 0x18d8d4, 0x8c00015, 0xec00004, 0x18ddc5, 0xc800005, 0x26c00009,
+    0x7c00004, 0x191212, 0x800006, 0x18d9cb, 0x5000001, 0xcc0000d, 0x18df0e, 0x18e04b,
+    0x18e405, 0x280000b, 0x1915d3, 0x8c00008, 0x191645, 0x191547, 0x18e212, 0xd000013,
+    0x26c00014, 0x25800013, 0x14000001, 0x8c00015, 0x26c00002, 0x18e492, 0x18e345, 0x11800009,
+    0x1c00001, 0x28000008, 0x31000006, 0x35000001, 0x8c00005, 0x18e18b, 0x18e50c, 0x18e545,
+    0x1000000c, 0x27400012, 0x2800005, 0x8c00012, 0x18df53, 0x42d8e313, 0x18e155, 0x1c00000,
+    0x2500000e, 0x500000c, 0x400003, 0x1000004, 0x1198f241, 0x1400006, 0x191593, 0x19198e,
+    0x1000009, 0x1400013, 0x40000b, 0x1d8e78c, 0x1400012, 0x100000e, 0x1c00000, 0xed8e701,
+    0x18e741, 0x18e892, 0xf800001, 0x800005, 0x18f8c1, 0xd800012, 0xd400013, 0x18e5c9,
+    0x18fa05, 0x18ffc8, 0x18e94c, 0x280000c, 0x518f6c9, 0x8c0000f, 0x200000f, 0x7c00003,
+    0x8c0000f, 0xec00012, 0x4340000f, 0x1c00014, 0x1c00000, 0x400001, 0x1118ea82, 0xa000010,
+    0x18ea44, 0x5000008, 0x25400013, 0x7400007, 0x33400015, 0x8c0001f, 0x26800012, 0x18eacb,
+    0x58e98c, 0x8d8eb0d, 0x18ec0e, 0x1c0000c, 0x5000010, 0x7c0000e, 0x1d8e7d2, 0x400013,
+    0x18e694, 0x1d8eb55, 0x25800013, 0x1000017, 0x1c00000, 0x718ebc1, 0x1c00002, 0xd800001,
+    0x8c00006, 0x18ed05, 0x1400008, 0x11800005, 0x140000f, 0x18ec49, 0x5000008, 0x18fb0d,
+    0x1b40000e, 0x5000001, 0x200000e, 0x3000000f, 0xec00001, 0x11c00013, 0x1c00012, 0x18e6d3,
+    0xd000014, 0x1c00015, 0x25c00008, 0x1c00017, 0xd400001, 0x16400002, 0x18eb83, 0x7800009,
+    0x11c00005, 0x18ec86, 0x5800012, 0xd400008, 0x18edc9, 0x8c0000f, 0x2000001, 0x18ef4c,
+    0x18ed4d, 0x3800006, 0xfc00001, 0x2800015, 0xd800012, 0x1058f1d2, 0x18ef85, 0x18f0d4,
+    0x10400015, 0x18f208, 0x18f489, 0x5000009, 0x1c00001, 0x8d8f4cc, 0x1c00003, 0x8c0000e,
+    0x18f545, 0x18f3c1, 0x200000c, 0x1c00012, 0x8c0000e, 0x18f705, 0x25000014, 0x700000c,
+    0x18f60d, 0x4318f58e, 0x10400002, 0x1040000c, 0x12400001, 0x19174e, 0x1c00013, 0x18f34f,
+    0x1c00015, 0x25191a12, 0x192254, 0x1c00015, 0x18f44c, 0x18f5d5, 0x18fa8e, 0x18f7d7,
+    0x18f9d0, 0x19148e, 0x21400012, 0xfc00001, 0x80000d, 0x7c00015, 0x1912d3, 0x1000000c,
+    0x10400018, 0x1000006, 0x5000008, 0x5000009, 0x18f941, 0x500000b, 0xdc00005, 0x191714,
+    0x18fac5, 0x19220e, 0x18fd49, 0x18fb48, 0x18f989, 0x8c0000c, 0x191d93, 0xd40000e,
+    0x25191e49, 0x1c0000f, 0x18fc0f, 0x18fed2, 0x500001a, 0x18fdd2, 0xcd8fe41, 0x191b50,
+    0x18fb95, 0x8c00018, 0xd800013, 0x7d90605, 0x190141, 0xf80000d, 0xcc00009, 0xf800009,
+    0x8d90185, 0x980000c, 0x800012, 0x18fbc8, 0x980000f, 0xd800012, 0xd800013, 0xcc00012,
+    0x800012, 0xd400005, 0x798fd8f, 0x190301, 0x8c00029, 0x1902d2, 0xdd903c1, 0x1901c5,
+    0x25000001, 0x193588, 0x190585, 0x190409, 0x11800010, 0xec00008, 0x190689, 0x1921d3,
+    0x2800014, 0x2c1900cf, 0x8d90450, 0x190ac2, 0x190a8f, 0x800012, 0xed8ff94, 0x190b92,
+    0x10400015, 0x10400008, 0x190355, 0x1400001, 0x1040000b, 0x7c0000c, 0x7c0000d, 0x1904ce,
+    0x800002, 0x280001f, 0x1933c5, 0x800000, 0xd590753, 0x800002, 0x10590815, 0xdd90cc9,
+    0x19364b, 0x1c00003, 0x190a4c, 0x7d90bcd, 0x190d8e, 0x8c00004, 0x800029, 0x26c00002,
+    0x190dd2, 0xd400013, 0x200000c, 0x80000d, 0x190d01, 0x80000c, 0x1640000d, 0x8d90c8e,
+    0x5000005, 0x1c00013, 0x11800001, 0x1400005, 0x190f49, 0x190d50, 0x192c05, 0x190e52,
+    0xdc00013, 0x190c41, 0x19104f, 0x190fc3, 0x280002a, 0x190f85, 0x500000c, 0x8c00005,
+    0x190b55, 0xa00000b, 0xdd910c1, 0x193401, 0x43c00013, 0x8d92fd4, 0x191405, 0xdc0000f,
+    0xdd91290, 0xec00008, 0x191189, 0x5193709, 0x1913d4, 0x251911c5, 0xd800013, 0xd000014,
+    0xd40000f, 0x26d91689, 0x1c0000f, 0xed91512, 0xa191781, 0x1916cd, 0x1917ce, 0x193849,
+    0x12000005, 0xa00000e, 0xd400013, 0x16400004, 0x11800009, 0x7000012, 0x191841, 0x193b90,
+    0x2191b8d, 0xd1918c4, 0x191905, 0x26c00006, 0x26c00007, 0x192f8e, 0x191949, 0x1d91bd4,
+    0x26c0000b, 0x1c0000c, 0xd400013, 0x1d91b0e, 0xb00000f, 0x192dcc, 0x8c0000c, 0x19344e,
+    0x191c13, 0x191cd4, 0xa00001f, 0x1c00004, 0x44000013, 0x5000004, 0x400015, 0x25191d5a,
+    0x2191f41, 0x1c00002, 0x4400003, 0xd000004, 0x191c85, 0x2191806, 0x1d91ec7, 0xa00000e,
+    0x1400002, 0x500000e, 0x19218b, 0x25000014, 0x2540000d, 0x19214e, 0xb00000f, 0x3d400010,
+    0xdc00001, 0x1c00012, 0xd800003, 0x192354, 0x439920c5, 0x25000013, 0x193e94, 0x1c800008,
+    0x2000009, 0xd00001a, 0xa000000, 0x2c192281, 0x193141, 0x1400012, 0x26c00004, 0xa192305,
+    0x193345, 0x1c800012, 0x44800001, 0x192449, 0x192641, 0xd00000b, 0x19288c, 0x192704,
+    0x192585, 0x19260f, 0x500000f, 0x8d9378c, 0x192509, 0xa192493, 0x5000008, 0x15800005,
+    0x1592741, 0xa193812, 0x1400000f, 0x7000013, 0x192b45, 0x2a00000d, 0x192a13, 0x192b14,
+    0x192a89, 0x1400001f, 0x500001f, 0x192b8c, 0x5000001, 0x1400004, 0xa00000f, 0x194081,
+    0x5000005, 0x192cd2, 0x2192c53, 0x800005, 0x251929d5, 0x8c00009, 0x192e97, 0x500000c,
+    0x10400002, 0x1400004, 0x800004, 0x2800009, 0x800006, 0x2fc00009, 0x1400001f, 0x1400009,
+    0x5000005, 0x1040000b, 0x19350e, 0x140000d, 0x192d0e, 0x500001a, 0x7000000, 0x5000013,
+    0x21593052, 0x200002a, 0xa00000f, 0x10400015, 0x800006, 0x140001f, 0x1000009, 0x992ec9,
+    0x8c00005, 0x26c00002, 0xd40000c, 0x1934ce, 0x19328e, 0x19375a, 0x2a000010, 0x193192,
+    0x193312, 0x2800013, 0x2580000b, 0x1935cc, 0xd400001, 0xd00000e, 0x200000b, 0x25000010,
+    0xa000000, 0x1937c1, 0x26c00013, 0x11800008, 0x1c00007, 0x6c00004, 0x4599470e, 0xa193887,
+    0x1240000b, 0x400008, 0x194b4b, 0x2000018, 0x8c00012, 0x6400000, 0xd400013, 0x193ace,
+    0xdc00003, 0x27400009, 0xd400005, 0x193a13, 0xcc00007, 0x19399a, 0xcc00015, 0xcc0001a,
+    0x1939c1, 0x193901, 0xd400019, 0x2540000e, 0x193a44, 0x26c00006, 0x193941, 0x6400012,
+    0x8c0000c, 0x5000009, 0x1400005, 0x1400000f, 0xd800012, 0x1947d0, 0x280000c, 0x1938cf,
+    0x8d93b01, 0x8c0000c, 0xd000013, 0x193e54, 0xa000005, 0x10400002, 0xd800014, 0xd400008,
+    0x193bc9, 0x5000014, 0x2540001a, 0x8c00001, 0x25194905, 0xfc00001, 0xd594ac8, 0x1948c5,
+    0x8c0000c, 0x193b4e, 0xd000005, 0x193c54, 0x14000015, 0xf800001, 0x1400009, 0x800014,
+    0x1400015, 0x193ecc, 0xec00014, 0x44593c0e, 0xd400010, 0x800009, 0xa00001f, 0x193cd2,
+    0x2000006, 0x2000007, 0x1c00008, 0x193f4f, 0x2540000c, 0x5000019, 0x8c00002, 0x1c00000,
+    0x1c0000e, 0xf800015, 0x1c00003, 0xa000004, 0x45193f85, 0x8c00002, 0x1c00007, 0xd800005,
+    0x2193f09, 0x1c00007, 0xd400007, 0x44c0001f, 0x200000d, 0x193fce, 0x2680000c, 0xd800014,
+    0x1942ce, 0x6400012, 0x2193dd3, 0x7000004, 0xd400005, 0x8c0000c, 0x26994494, 0xfc00014,
+    0x2000016, 0xa1943c2, 0x1c00003, 0x45400004, 0xd800002, 0x2000004, 0x12400007, 0x2000006,
+    0x2000007, 0xa00000a, 0xd400013, 0x7000014, 0xd80000e, 0x200000c, 0xa00000d, 0x1040000b,
+    0x10c00005, 0x2000010, 0x1941d3, 0x194414, 0xa000013, 0x7d940c1, 0x1c00006, 0x2000016,
+    0x27400005, 0x1946c5, 0x3f800002, 0x1b400003, 0x8c00008, 0x7800009, 0xd400013, 0x1d962cf,
+    0x196010, 0x2a000009, 0x196392, 0x280000f, 0x19460c, 0x19438d, 0x719468e, 0x7c00014,
+    0x2a000010, 0x8c00015, 0x194752, 0x19464d, 0x1945d4, 0x194b92, 0xd400010, 0x194d54,
+    0x2000015, 0xcc00013, 0x1400008, 0x7c0001f, 0x25000012, 0xd400017, 0x194849, 0x140000d,
+    0x19488e, 0x1c00009, 0x5000005, 0x7c0000d, 0x194792, 0x7c00029, 0x7c0002a, 0x194c05,
+    0x194953, 0x1c00003, 0xec00008, 0x197181, 0x1c00017, 0x8c00002, 0x1c00003, 0x197645,
+    0x198408, 0x8c0000f, 0x19524c, 0x1984cb, 0x2800012, 0x25800013, 0x13c00005, 0x1c0000c,
+    0x6400012, 0x1180000b, 0x80000d, 0x19738e, 0x700000b, 0x5000012, 0x10400013, 0x194a41,
+    0x194e02, 0x197514, 0x1d94c44, 0x194d05, 0x1c00006, 0x1c00007, 0x1c00008, 0xac00009,
+    0x1180001a, 0x1c0000b, 0x19500c, 0x195181, 0x6c00001, 0x197e1f, 0x800000, 0x25194f85,
+    0x9800012, 0x3d400013, 0x1c00014, 0x8d94585, 0x19a949, 0x6400017, 0x195088, 0x2000019,
+    0x1c0001a, 0x80000b, 0xcc00000, 0x25194ec1, 0xd000012, 0x80001f, 0x194fd4, 0x194d85,
+    0xa000006, 0x197c4e, 0xa000008, 0x194f49, 0x19a9cc, 0x197d52, 0x5000008, 0x198014,
+    0x10400004, 0xa00000f, 0xa000010, 0x1951c5, 0x19595052, 0x1c00007, 0x35000014, 0x2000000,
+    0x27400015, 0xd400013, 0x19538c, 0x700000d, 0x8c0000e, 0x80000f, 0x198285, 0x1c0000c,
+    0x3800007, 0x5000005, 0x5000009, 0x1953cc, 0x2040000d, 0x40000e, 0x680000f, 0x1c0000b,
+    0x45c0000c, 0xd400013, 0x19a741, 0x7000014, 0x197e81, 0x19a6ce, 0x195512, 0x19b342,
+    0x195494, 0x195295, 0x7800013, 0x8c00001, 0x2997bc9, 0x8c00002, 0x1c0001a, 0x1975c1,
+    0xcc00000, 0x30195681, 0x25800002, 0x1977c5, 0x12400004, 0x195405, 0x2800015, 0x197249,
+    0x5000029, 0xcd956c9, 0x800006, 0x19584b, 0xd800012, 0x19590d, 0xa00002a, 0x1040000d,
+    0x195990, 0x15800015, 0x7c0000e, 0xcd957d3, 0x7d959d4, 0xec00015, 0x195641, 0x1597e53,
+    0x19a601, 0xa000019, 0x195945, 0x280002a, 0x2800029, 0xc80002a, 0x800009, 0x8c0001f,
+    0x8c00009, 0x10400008, 0x995c0d, 0x1c0000e, 0x800002, 0x46000005, 0x1c0000f, 0x8c00029,
+    0x195b53, 0x1195814, 0x195b81, 0x1d95c42, 0x19d20e, 0x195e04, 0x195a45, 0x1c00006,
+    0x195f47, 0xd400013, 0x195cc9, 0x19add3, 0x1960cb, 0x700000c, 0x1195f8d, 0x1961ce,
+    0x19604f, 0x1000010, 0x25c00015, 0x1c00012, 0x1d96313, 0x196254, 0x2000015, 0x19cf13,
+    0x1c00017, 0xd59dace, 0x23000001, 0x19635a, 0x1c00003, 0x21400002, 0x9963c5, 0x2d800006,
+    0xcc00000, 0xd400001, 0x196509, 0x196603, 0x80000b, 0x8c00002, 0x19b3ce, 0x19aa8c,
+    0x2519648f, 0xcc00000, 0xdd96801, 0xdd9b053, 0x519b154, 0x1c00014, 0x196985, 0x7c00014,
+    0x196090, 0x140000e, 0x196589, 0x1d9629a, 0x196914, 0x5000012, 0x1c0000d, 0x14000001,
+    0xd5968cf, 0x1965d9, 0x7000000, 0xd800012, 0x196a82, 0x196954, 0x8c00012, 0x196a05,
+    0x1d96546, 0x39400007, 0x1400000c, 0x71967da, 0x19a581, 0x1400012, 0xd400004, 0xa196c0d,
+    0xdd98252, 0x198053, 0xa000010, 0x19a388, 0x7000012, 0x196e13, 0x196cd4, 0x10400002,
+    0x7c00003, 0x196f04, 0x197401, 0x19d444, 0x19e088, 0x19a552, 0x197545, 0x19e14b,
+    0x196fc3, 0x8c0000c, 0x196dc5, 0x196d8e, 0x19a981, 0x19d90e, 0x197209, 0x196f92,
+    0x1400000f, 0x19704c, 0x196c95, 0x19734e, 0x197905, 0x1970d4, 0x8c00015, 0x197312,
+    0x13000009, 0x8c0000d, 0xd40000e, 0xd19780c, 0xd00000d, 0x800000, 0xf800005, 0x19d0d3,
+    0x8c00015, 0xd000012, 0x2f1974d3, 0x197c94, 0x8c00003, 0x5000005, 0xdc00017, 0x800006,
+    0x7c00000, 0x19ac8c, 0x1400001f, 0x7c0000e, 0x1040000b, 0x1640000c, 0x1976cd, 0x159774e,
+    0xd40000c, 0x997c09, 0x5000012, 0x197b52, 0x197ccc, 0x3100000d, 0x197d8e, 0x197d0f,
+    0x19d4ce, 0xd400004, 0x197dd2, 0x7d97ad3, 0x19d892, 0xdc00013, 0xa000005, 0x7198486,
+    0x2a000018, 0x197fcc, 0x13c0000d, 0xa000000, 0x5000001, 0xa00000c, 0x16400004, 0x7000004,
+    0xa00000f, 0x198214, 0x10400008, 0x198501, 0x1d97f89, 0x1040000b, 0x12c00006, 0x198185,
+    0x19abce, 0xa00000e, 0x10400010, 0x8c00009, 0x19acd2, 0x19aad3, 0x2f00000c, 0x19b201,
+    0xa000015, 0x1419830f, 0x800000, 0x19b7c5, 0x998542, 0x1c00006, 0x1c00004, 0x9980c5,
+    0x198606, 0x1d98647, 0x8c00009, 0x500000c, 0x19e892, 0x8d9eb54, 0x1987cc, 0xa1983cd,
+    0x598a0e, 0x2800013, 0x800000, 0x198141, 0x1c00002, 0x198bd3, 0x198714, 0xd598f05,
+    0x1c00006, 0xa199185, 0x7d9c749, 0x198b09, 0x8c0002a, 0x1d99349, 0x9991cc, 0x19e693,
+    0x19ca0f, 0x500000f, 0x25c0000f, 0x1995cf, 0x7000010, 0x800013, 0x1c00014, 0x25000015,
+    0xcc00000, 0xa000015, 0x7000002, 0x19a7c1, 0x1988c4, 0x198a45, 0xf800001, 0x5000001,
+    0x19c51f, 0x998ec9, 0x800005, 0x19ab49, 0x2540000b, 0x19e901, 0xf800009, 0x1400005,
+    0x198cd0, 0x1180000b, 0x19b648, 0x199213, 0xf80000f, 0xe800015, 0xcc00000, 0x999281,
+    0x19b601, 0x19b38f, 0x199304, 0x198a85, 0x17400006, 0x1993c7, 0xa000008, 0x8c00009,
+    0x19ba49, 0xc80001f, 0xa00000c, 0xa00000d, 0x19958e, 0x8c0000e, 0x19ba8f, 0x8c00008,
+    0x1989d2, 0x199513, 0x1997d4, 0x2800029, 0x7c0002a, 0x12400000, 0x25000001, 0x11998c2,
+    0x99961a, 0x1000004, 0x25199a05, 0x1199bc6, 0x599d87, 0x198e48, 0x8c0001f, 0x140000d,
+    0x599ecb, 0x599f4c, 0x100000d, 0xd599f8e, 0x1599b0f, 0xf800001, 0x15400002, 0x19a112,
+    0x19a2d3, 0x4199a294, 0x5000005, 0x7c00007, 0x59a497, 0x12400000, 0x8d996c1, 0x119979a,
+    0x19a303, 0x11800001, 0xa19a345, 0x19f048, 0x5000010, 0x11800005, 0x10400012, 0x19ae01,
+    0x800009, 0xd000014, 0x8c0000c, 0x19af85, 0x19a50f, 0x19a1d0, 0x16800029, 0x19aec9,
+    0x1d9a4d3, 0x19a654, 0xa000015, 0x19a445, 0x2800015, 0x25400007, 0x19f30f, 0x19aa41,
+    0x19ab02, 0x16400003, 0x1c0000c, 0x19af15, 0x19a70e, 0x19ac01, 0xc80000f, 0xd400001,
+    0x1000012, 0x19ab85, 0x799ad0c, 0x7000015, 0x19aa0e, 0x19ad89, 0x7000000, 0xd400001,
+    0x519b085, 0x1a0dcc, 0x19ae54, 0x19ae8f, 0xfc00009, 0xa000007, 0x19ce10, 0x2fc00012,
+    0x19af6a, 0x8c00015, 0x19d254, 0x519b1d0, 0x800000, 0x11c00001, 0x1c00002, 0x19b194,
+    0x5000015, 0x1c00006, 0x1c00006, 0x19f783, 0x26000009, 0x19afc9, 0x7c00006, 0x1c0000c,
+    0x500000e, 0xa00000c, 0x500001f, 0x19e64e, 0x1400012, 0x19b846, 0x1c00012, 0x1c00014,
+    0x1419b489, 0x17400014, 0x14000001, 0x159b88c, 0x19ea45, 0x19b70e, 0x19b805, 0x19b8c6,
+    0x1a0e4b, 0x19b9d2, 0x19b953, 0x1d9bc81, 0x1400015, 0x7000001, 0x19e94f, 0x19bf45,
+    0x1400000f, 0x19ba05, 0xec00012, 0x8c00012, 0xd000013, 0x19bad4, 0x1740000a, 0x1c0000d,
+    0xdc0000c, 0xdc0000c, 0x1c00010, 0x700000e, 0x14000017, 0xd59bed3, 0x7000012, 0xa000012,
+    0x8c0001f, 0xd400003, 0x59bf04, 0x1199bd85, 0x119bc46, 0x19c047, 0x1000008, 0x19bc09,
+    0x700000a, 0x719be8b, 0x1c0000c, 0xd59c001, 0x19c0ce, 0x19c283, 0xd59c481, 0x1000011,
+    0x1a12ce, 0x119c2d3, 0x1d9c154, 0x19c249, 0x1000016, 0x19c1cb, 0x8c00029, 0x19c10d,
+    0x1a1654, 0x7d9c40f, 0x28000010, 0x19c542, 0x7c00012, 0xa000013, 0x2819c614, 0x15000012,
+    0x25000013, 0x19c794, 0x17400015, 0x1a16c7, 0x1040000b, 0x19c58c, 0x8c0000d, 0x800006,
+    0x19c701, 0x1400012, 0x800004, 0x19c812, 0x19c5d3, 0x7d9c84c, 0x19c895, 0x2699c64e,
+    0x19c989, 0x800002, 0x8c00015, 0x19c6d2, 0x80000e, 0x7c00014, 0x8c0000f, 0x1400005,
+    0x1c00006, 0xec0000c, 0x7c00014, 0x7c0000c, 0x8c00015, 0x7c0000e, 0x200000c, 0x19cb85,
+    0xa00000d, 0x19cad2, 0x19cb48, 0x8c00001, 0x800015, 0x1000012, 0x1c00014, 0x19ccc5,
+    0x5000005, 0x8c0000f, 0x8c00010, 0x19cc09, 0x19dc49, 0x8c00002, 0x19cdd4, 0x19e1cc,
+    0x11800001, 0x4659ce4f, 0x7c00007, 0xd400001, 0xed9ce92, 0x7c00003, 0xd000013, 0x19cd55,
+    0xcc00002, 0x19d10e, 0x1a0f85, 0xa000015, 0x1c00019, 0x10400012, 0x19d193, 0xfc00010,
+    0x19d155, 0x800002, 0x7c00010, 0x10400004, 0xd400015, 0xa000009, 0x2a000010, 0x8c00012,
+    0x19f612, 0x1180001a, 0x7c00018, 0x19d3cc, 0x19d08d, 0x19d1ce, 0x1180001f, 0x19d310,
+    0x5000008, 0x19d392, 0x19d293, 0x19d354, 0x1400006, 0x8c00002, 0x1a0d8e, 0x19d2c9,
+    0x7000015, 0xd400002, 0x1a0b92, 0x7d9d484, 0x19d74e, 0x80000f, 0x19d607, 0xa1a0cce,
+    0x19d5d2, 0x8d9d413, 0x19d514, 0x19d84c, 0x1400013, 0xd99da8e, 0x19eac2, 0x19e794,
+    0x19ea95, 0xd59db52, 0x19d6d3, 0x19d714, 0x99d655, 0xcc00006, 0x26da0bc5, 0x700000d,
+    0x19dcc9, 0xd00000d, 0xd400009, 0xd00001a, 0x19dd0d, 0xd59dd4e, 0x19ed92, 0x10400010,
+    0x800013, 0x19dd92, 0x11c00013, 0x1999de94, 0x8d9dc95, 0x7c00004, 0x1c0000a, 0xcc00018,
+    0xd40000c, 0x8c00008, 0x19ef81, 0x219da4f, 0x8c00005, 0x19d9cc, 0x19df12, 0x1c00013,
+    0x1a2c52, 0x10400010, 0x19f0c9, 0x10400012, 0x7000000, 0x19e281, 0x1c00002, 0x19e3c1,
+    0x7d9f18f, 0x19df45, 0xa000004, 0x8c00009, 0x1a15c5, 0x1c00004, 0xcc00015, 0x19f441,
+    0x1a1709, 0x700000b, 0x1c0000e, 0x7c00005, 0xa00000e, 0x6c00009, 0x1b400008, 0xd000013,
+    0x7000014, 0x25000013, 0x19e494, 0x5000012, 0x19e201, 0x19f4cf, 0x1c00003, 0x1400019,
+    0x19e185, 0x5000008, 0x11800009, 0x19f2d5, 0x10c0000b, 0x1a140e, 0x80001f, 0x1a2f8d,
+    0x3cc00002, 0x800012, 0x8c0000f, 0x800014, 0x19e613, 0x19e754, 0x19e515, 0x19e354,
+    0x19e541, 0x1a0601, 0xdc00005, 0x6c0001a, 0x519e585, 0x1a0745, 0x1a0790, 0x19e4c8,
+    0x15a0292, 0x1a00c9, 0x1a17c8, 0x11400010, 0x4680000f, 0x27000013, 0x8c00006, 0x1a084f,
+    0x8c0000e, 0x19e412, 0xd19e5d3, 0x19ea14, 0x5000015, 0xd40002a, 0x19ec47, 0x1a3789,
+    0x8c00009, 0x5000005, 0x1a31c5, 0x19eb8c, 0xf800014, 0xf800009, 0x8c0001f, 0x19ecd0,
+    0x1a1a85, 0x8d9e8d2, 0x7c00013, 0x1a000f, 0x19ec82, 0x19ec16, 0x16400004, 0xdc0000c,
+    0x1a2993, 0x19ff95, 0x1a042a, 0x800000, 0x1a1785, 0x1a07c5, 0x8c0000c, 0x19eb0d,
+    0x8d9ef4e, 0x1a0109, 0x19ee02, 0x7c00008, 0x519ee92, 0xd400005, 0x10400006, 0x1400000f,
+    0x1a09d0, 0x19eec9, 0x1a1b53, 0x8c00001, 0x1a0a54, 0x1a1212, 0xd59f1ce, 0x19f385,
+    0x19efd0, 0x700001a, 0x19f292, 0x8c00009, 0xd59f354, 0x1a4085, 0x8c0000c, 0x19f701,
+    0x19ef18, 0x19f24f, 0xd400012, 0x19f805, 0x19f412, 0x1a1241, 0xec00008, 0x8d9fa49,
+    0x8c0000c, 0x5000005, 0x1a130e, 0xcc00019, 0x8c00008, 0x7d9f7cf, 0x1400008, 0xd000013,
+    0x299f852, 0x1a1bcb, 0x700001a, 0x8d9f755, 0x7c00003, 0x800004, 0x1a590c, 0x19f942,
+    0x19fa83, 0x10400004, 0xf800005, 0x7c00006, 0x2500000b, 0x7c0001f, 0x1a030d, 0x1a024e,
+    0x19f54b, 0x19fe4c, 0x159fd4d, 0x19fe8e, 0x8c00013, 0x3d00000b, 0x2500000c, 0x10400012,
+    0xc80002a, 0x19fad4, 0x19ff15, 0x27000005, 0xd800012, 0x1a4445, 0x7c00008, 0x19fd89,
+    0x1a2b0e, 0x8c00001, 0x19ff4c, 0x19fc4d, 0x269a014e, 0x2500000f, 0x26c00006, 0x1a2955,
+    0x1a03d2, 0x19ffd3, 0x1a0b4d, 0x1a0c8e, 0x6c00006, 0x10400010, 0x1a0198, 0x1a0812,
+    0xa000000, 0xd9a0c14, 0xd80000c, 0xd5a0c53, 0x1a0ed4, 0x6c00004, 0x1a5c13, 0x6c00006,
+    0x6c00007, 0xa000009, 0x8c00009, 0x8c00009, 0x1a1387, 0x6c0000c, 0x7c00009, 0x1a5d88,
+    0x1a6592, 0x1a110c, 0xd400010, 0xa000013, 0x1a1053, 0x1a1013, 0x8c00014, 0x1a11d2,
+    0x6c00017, 0x1000001, 0x26c0000e, 0x700001a, 0x1da1084, 0xd5a0f05, 0x3800006, 0x1a10c7,
+    0x8c00003, 0x5da0e89, 0x25000005, 0x1a0e0b, 0x380000c, 0x100000d, 0x700000e, 0x12400010,
+    0x1000001, 0x1a1281, 0x7000012, 0x1a1193, 0x6c00014, 0x26da1345, 0x1400004, 0x7000017,
+    0xd000008, 0x1a160e, 0x7000005, 0xd400010, 0x100000d, 0x1a1912, 0x1a14d3, 0x46c0000f,
+    0x1a154e, 0x1800012, 0xec00012, 0x1a1153, 0x27400012, 0x800000, 0x5000001, 0x1c00000,
+    0xd5a1c13, 0x7000014, 0x800000, 0x1a38c5, 0x5000005, 0xdc00003, 0x26c0000e, 0x800005,
+    0x1c0001b, 0x8c00005, 0x1c00012, 0xd40000c, 0x140000f, 0xa000015, 0x200000c, 0x400010,
+    0x7000004, 0x8da1845, 0x3800003, 0x8c0000f, 0xd000010, 0x7da18c9, 0xa000012, 0x1a1d48,
+    0x8c0000c, 0x700000d, 0x80000b, 0x1a198f, 0xa000001, 0x1740001f, 0x8c00012, 0x6c00013,
+    0x2800005, 0x6c00006, 0x1a59ce, 0x5000012, 0xa000001, 0x1a36d4, 0x1a3a88, 0x1a58d3,
+    0xd5a1c45, 0x5c0000b, 0x1000007, 0xd40001f, 0x1a1c89, 0x10000012, 0x8c00001, 0x9a19d4,
+    0x2500000f, 0xd80000e, 0xd400005, 0x1a690e, 0x8c00004, 0x7400012, 0xa000009, 0x26c00002,
+    0x700000b, 0x11400000, 0x215a1e41, 0xa1a1d02, 0xd400014, 0xa000004, 0x1a1ac5, 0x4000014,
+    0x1a3ac1, 0x7000014, 0xa1a1e89, 0x1a1e01, 0x1c00014, 0x5a200c, 0xd400001, 0x1a2145,
+    0xa00000f, 0x6400013, 0xd400005, 0x8c0000c, 0x1a20d3, 0x5a2094, 0x1a4489, 0x175a238d,
+    0x380000e, 0xd800012, 0x471a2210, 0xa00001a, 0x1a6141, 0x6c00010, 0x1a2414, 0x800000,
+    0x5800001, 0x6400002, 0x21400003, 0x115a2484, 0x1a2105, 0xa000000, 0x1a2507, 0x6400008,
+    0xa000009, 0xa000004, 0x1a234b, 0x640000c, 0x5000014, 0x1a6492, 0x980000f, 0x6400010,
+    0xd400015, 0xd400005, 0x65a2593, 0x1a2554, 0xd80000c, 0x800010, 0x6c00017, 0xd800012,
+    0x1a6381, 0x1c0001a, 0xc800005, 0x12400000, 0xa000001, 0x6c00002, 0x280001f, 0x11400004,
+    0x9a25c5, 0x100000d, 0x1a2607, 0xd400001, 0x1a21c9, 0x1000003, 0x80000b, 0x1a5e93,
+    0x1a270d, 0xa000015, 0x1a244f, 0x2400009, 0x6c00015, 0x7c00012, 0x800013, 0x7000014,
+    0x46400015, 0xd5a23c1, 0x2400010, 0x8c00001, 0x1a5e45, 0x1a27c5, 0x1a22d4, 0x275a6105,
+    0x7c00008, 0x12000009, 0x7400005, 0x3800019, 0x640000c, 0x1c0000d, 0xf80000f, 0xd5a274f,
+    0xa000000, 0x2f1a624f, 0x8c00012, 0xa000003, 0x1a2854, 0x12000005, 0x1da2ac6, 0x1a2887,
+    0x1c00019, 0xa000014, 0xa1a2a9a, 0xa000003, 0x6c00001, 0xa00000d, 0x1c00002, 0x1c00003,
+    0x7c00005, 0x1a6b08, 0x1a29d2, 0x1da2d53, 0x380000c, 0x1a564d, 0x12c0000e, 0x1a76d4,
+    0x1c0000c, 0x1c0000d, 0x6c0000f, 0x1c0001b, 0x1a7b43, 0xa000014, 0x1c00012, 0x7000000,
+    0x1a2c81, 0x7000002, 0x7000003, 0x1c00004, 0xd5a3105, 0x1c00006, 0x1c00007, 0x1c00008,
+    0x1a3389, 0xd400013, 0x1c0000b, 0xcda304c, 0x1a328d, 0x1a360e, 0x1a330f, 0x7000010,
+    0x1c00011, 0x1a3992, 0x71a3693, 0x475a3654, 0xcda2bd5, 0x1c00016, 0x1a39d7, 0x2f1a37c9,
+    0x1a8801, 0x1c0001a, 0x8da3b4c, 0xdda3c41, 0x1a3d8e, 0x1a8bd5, 0x9a2a1f, 0x1a3d45,
+    0x1a3fd2, 0x25800013, 0xd000014, 0x1a3b09, 0x251a6d0e, 0x1a8881, 0xd00000c, 0xd800014,
+    0x1a2b69, 0xd5a5581, 0x400014, 0x25800002, 0x1a3f52, 0xdc00013, 0xd000014, 0xd800001,
+    0x7400008, 0x1a5789, 0x1c00000, 0x1a6645, 0x1ab04f, 0x1000003, 0x1a4244, 0x1ac748,
+    0x1a4006, 0x3800007, 0x140000e, 0x8c00002, 0x1a69d3, 0x1a5755, 0x1a418c, 0x80000d,
+    0x5a43ce, 0x8c00019, 0xa00001a, 0xec00029, 0x1a406a, 0x1000013, 0x115a3e54, 0x800000,
+    0x141a4301, 0x11400002, 0x7c00002, 0x5000009, 0x1a4845, 0x1a4346, 0x1400013, 0x1abc94,
+    0x1a4209, 0xd400001, 0x11800001, 0x80000c, 0xa00000c, 0x26c00005, 0x1a45cf, 0xcc00000,
+    0xa1a4981, 0x800002, 0x9a4113, 0x1a47c4, 0x1a4885, 0x800006, 0x1a6856, 0x800017,
+    0x125a4809, 0x2500001a, 0x1140000b, 0x1a67d3, 0x25800010, 0x11800009, 0x8da48cf, 0x1acc52,
+    0x1ac587, 0x25000008, 0xa1a4d53, 0x1a4fd4, 0x28000015, 0xcc00000, 0x1a4ec1, 0x251a49c2,
+    0xd1abe94, 0x1a4a9a, 0x1a5185, 0x1a5146, 0x255a4c07, 0x5a44c8, 0xa1a4cc9, 0x1a64cc,
+    0x2580000b, 0x700000e, 0x1a50cd, 0x1a540e, 0x1a51cf, 0x280001f, 0x26800013, 0x11400000,
+    0x1a5713, 0x7400005, 0x51a5615, 0x47800016, 0x20400000, 0xfc00001, 0x2800005, 0x40001a,
+    0xa1a6a0c, 0x1a54c5, 0x1a694e, 0x1a5a4c, 0x1a4f9f, 0x700000e, 0x1000012, 0x500000b,
+    0x17400000, 0x1c00001, 0x1a5cd3, 0x5000012, 0x47c00001, 0x1a57c5, 0x5a54a9, 0x1a5853,
+    0x1a5894, 0x800009, 0x6c00005, 0x6c0000e, 0x3800014, 0x700000a, 0x6c00003, 0x80000f,
+    0x7000010, 0x6c00006, 0x6c0000f, 0x1a5942, 0x1a5814, 0x11400007, 0x6c00004, 0x1740000e,
+    0x700000d, 0x1a5dc8, 0x700001a, 0x11400010, 0x2c000001, 0x1a5c52, 0x1ac985, 0x2fc0000e,
+    0x1a5c85, 0x1c00004, 0x12400017, 0x1a5b12, 0x1a5f81, 0xa000008, 0x1c00005, 0x1000006,
+    0x1a5e05, 0xd80000e, 0x8c00012, 0xa00000c, 0xeda5d09, 0xec00012, 0x1a5ad3, 0x1c00012,
+    0x1c00013, 0xec0000e, 0x2740000f, 0xa000012, 0xd000013, 0xec00012, 0xd000013, 0x25800014,
+    0x8c00015, 0x1a5bc2, 0x700001b, 0x1a654c, 0xd400005, 0x700000e, 0x1acd4c, 0xa000010,
+    0xa000009, 0x7000012, 0x1400001f, 0x40000c, 0xfc00001, 0xcc00005, 0xa00000f, 0x1000004,
+    0x251a7e48, 0x11a5f06, 0x1a6187, 0x1000008, 0x17da6009, 0x5000012, 0x1acc08, 0xcc0000f,
+    0x71ae9c1, 0x1a620e, 0x800012, 0x6c00002, 0x1000011, 0x7c00004, 0x11a60d3, 0x1000014,
+    0x8da5ec1, 0x1000016, 0x115a61c3, 0xa000015, 0x2c000005, 0x1a628c, 0x6c0000d, 0x1a66ce,
+    0x1a6049, 0x6c00010, 0x11400000, 0x6c00012, 0x6c00013, 0x1a6614, 0x740000f, 0xec00010,
+    0x11400006, 0x1a8ecd, 0x25800013, 0x12400014, 0x8c00015, 0x1140000b, 0x8c00012, 0x3800014,
+    0x7c0000e, 0x1aecd2, 0x7000008, 0x29400001, 0x7000012, 0xdda6813, 0x700000c, 0x700000d,
+    0x6c0000e, 0x1aebd5, 0x1a6890, 0x7000009, 0xa00001a, 0x7000013, 0x1aea4f, 0xd800014,
+    0x7c00000, 0x7000017, 0x1a68c2, 0x7c00003, 0x2800012, 0x7c00005, 0x7c00006, 0xa000000,
+    0x51a6681, 0x1c00001, 0x25000012, 0xa000004, 0xa1a6a45, 0x7c00005, 0x1aeb12, 0x2500000e,
+    0x5000009, 0x1a6d89, 0x1a7903, 0x1a6c0c, 0x800000, 0x1aea09, 0x1180000f, 0x11400017,
+    0x400003, 0x6400004, 0x251a6a85, 0x1a79cc, 0x1a6bc7, 0x1400008, 0x1a6c89, 0x1e00000b,
+    0x6000019, 0x700000d, 0x1a99c5, 0x1a7b14, 0x8c0000f, 0xa000010, 0xf800009, 0x9a6ddf,
+    0x3800014, 0x1a6cd4, 0x2800015, 0x7000001, 0x500000f, 0x1a6e03, 0x380001a, 0xa000001,
+    0xcc00002, 0x1c00007, 0x800015, 0x1aec05, 0x1000007, 0x1c0000b, 0x1a6f8c, 0xd40000d,
+    0x1a6e4e, 0x6400000, 0x1c00010, 0xd400006, 0x1a7012, 0x1af285, 0x1a7154, 0x1c00015,
+    0x1c00007, 0xa000001, 0x1a70c9, 0x1b1153, 0x1140001a, 0xa00001b, 0x1c00006, 0x1a6b4e,
+    0x25000015, 0x25800010, 0x481a6e85, 0x1a73d2, 0x26c00014, 0x7000014, 0x7000001, 0x8c00001,
+    0x15c0000b, 0x6c0000c, 0x71a7085, 0x1240001a, 0xa00000f, 0x1c00010, 0x11400009, 0x8c00009,
+    0x6c00013, 0x1c00004, 0x7000005, 0x700000c, 0x1c00007, 0xa000003, 0x800009, 0x1400005,
+    0x6c0000b, 0x700000c, 0x6c00015, 0x1a718e, 0x1c00002, 0x1c00010, 0x1c00004, 0x1a7552,
+    0x6c00013, 0x1a7414, 0x7000000, 0x1a7641, 0x700001f, 0xa00000b, 0x1a784c, 0x1a7705,
+    0x1da6fce, 0xfc0000c, 0x1c00010, 0x1a7a09, 0x125a78d2, 0x9af088, 0x1c00014, 0x1b35ce,
+    0x1daefcb, 0x1a7acf, 0x1b384e, 0x1a7dc2, 0x1a7bc3, 0x1b3055, 0x1a89c6, 0x11400015,
+    0x1a7a87, 0x26c00009, 0x1000015, 0x1040000a, 0x7c0000c, 0x1a7f4c, 0x1a7c0d, 0x1a810e,
+    0xcc00010, 0x1a7d1f, 0x1a8ad2, 0x1a8312, 0xdc00013, 0x1a7e14, 0x1a8255, 0x1a8282,
+    0x1400003, 0x1b324d, 0xdc00005, 0xa000029, 0x1a7eaa, 0x1a8408, 0x1a8189, 0x140000d,
+    0x25c0000e, 0x7da7c4c, 0x1b3553, 0x1a854e, 0x1af052, 0x1a8450, 0xd000014, 0x1a8712,
+    0x1a8353, 0x1a86d4, 0x1a858b, 0x1a868c, 0x1a85cd, 0x1a88ce, 0x1a8a48, 0x7c00009,
+    0x7000000, 0x1b360e, 0x1a8653, 0xd5a8c81, 0x251b3693, 0x1a884f, 0x1b124e, 0xd5a8b85,
+    0x1a8b52, 0x21abc43, 0x1b1c52, 0x8c00009, 0x440000c, 0xa000002, 0xa000008, 0xa000004,
+    0x7000010, 0x7c0000f, 0x7000007, 0x7000013, 0x1a8e92, 0x1b3944, 0x8c00001, 0x1a8795,
+    0x1abad2, 0x1b0781, 0x21ab994, 0x7000010, 0x1b3c86, 0x20400012, 0x1b32c9, 0x1ab494,
+    0x1ab1d5, 0x7c0001f, 0x1c00000, 0xa000001, 0x1a9182, 0x8c00003, 0x125a8d04, 0xa00000f,
+    0x1a8f86, 0x1da9107, 0x12400008, 0x1a89a9, 0x7c0002a, 0x1da8dcb, 0x1a958c, 0x1a920d,
+    0x21a98ce, 0x6400012, 0x1a92d0, 0x1b37ce, 0x1a9c92, 0x1a9653, 0x1a9a94, 0x1a9f15,
+    0x1a9096, 0x25c00014, 0x7000018, 0x7000000, 0x1a91c1, 0x1400015, 0x1a9503, 0x215a9284,
+    0x1c00005, 0x800000, 0x115a9387, 0x2000008, 0x9a9f49, 0xa000000, 0x1b2445, 0x9aa1cc,
+    0x1daa44d, 0x1daa5ce, 0x5000005, 0x1a9550, 0xd40000e, 0x1daa7d2, 0x485aa813, 0x65aa4d4,
+    0x115aaa55, 0x1400016, 0x800017, 0x71a9b58, 0x1c00001, 0x1c00002, 0x1a9c03, 0x10000012,
+    0x1aac85, 0x4400006, 0x1da9b07, 0x2800013, 0x15800014, 0x1b6e41, 0x640000b, 0x4c0000c,
+    0x45aa64d, 0x1aabce, 0x1c0000f, 0x1aad90, 0x5000005, 0x215aa412, 0x71a9f93, 0x1ab014,
+    0x1c00000, 0x1c00016, 0x1aa582, 0x1aa003, 0x1daa744, 0x1b2f53, 0x21aaa86, 0x7000010,
+    0x1b7405, 0x1b3805, 0x1b3018, 0x1c0000b, 0x1aad4c, 0x1aaccd, 0x71aae8e, 0x700000f,
+    0x1aae10, 0x700001a, 0x1ab212, 0x1aac13, 0x1ab114, 0x7000015, 0x1ab303, 0x1c00017,
+    0x1ab701, 0x1b3995, 0x1c0001a, 0x200001b, 0x1abb45, 0xa000000, 0x12c00006, 0x640000c,
+    0x1abcc9, 0x1c0000e, 0xa1ad605, 0xd800012, 0x8c00001, 0xa000012, 0x1abf0f, 0x1c00014,
+    0x26dac645, 0xa000006, 0x1ad98d, 0x700001a, 0x21ac255, 0x1ad650, 0x100000b, 0x40000c,
+    0xa000013, 0x400014, 0x1400000f, 0x1b74d2, 0xdc00013, 0x1b36c8, 0x1ab25f, 0x400014,
+    0x1b3acb, 0x2000002, 0x1ab183, 0x12400004, 0x1c00005, 0xa000006, 0x1dab447, 0xa000008,
+    0x21aaee9, 0x200002a, 0xf80000b, 0x1400008, 0x1ab28d, 0x1ac44e, 0x11400000, 0x1b1ac1,
+    0x14000001, 0x1ac6d2, 0x1c00013, 0x4400014, 0x9ac685, 0x1dac706, 0x7000005, 0x1c00000,
+    0x1abe49, 0x1b72cf, 0x700000c, 0x1b7b41, 0xa00000d, 0x700000c, 0x271ab88f, 0x11400010,
+    0x1800009, 0x1b7a4c, 0x1aca53, 0x500000e, 0x7000013, 0x7000014, 0x1abfd7, 0x1afd50,
+    0x1c00029, 0xa000000, 0x1000001, 0x25000014, 0x1b4189, 0x1aca04, 0x2800005, 0x3800006,
+    0x1acb07, 0x500000e, 0x3800009, 0xa000000, 0x500002a, 0x1b7a08, 0x100000d, 0x1b2481,
+    0xa1accc5, 0x7000006, 0x400007, 0x1b2685, 0x11ac393, 0x1c00014, 0x6c00009, 0x1b2409,
+    0x1dac497, 0x700000c, 0x1b6381, 0x1acc8e, 0x1b6148, 0x400012, 0x1b6545, 0x6c00012,
+    0x800013, 0x7000014, 0x7000015, 0x1b5e8f, 0x11400017, 0x7000000, 0x1acb81, 0x1000002,
+    0x1b40000f, 0x1c00004, 0x1acd05, 0x7000006, 0x1c00007, 0x7000008, 0x1ac889, 0x1c00002,
+    0x1c0000b, 0x1ace4c, 0x700000d, 0x640000e, 0x1b7002, 0x1c00008, 0x1b7bd2, 0x1b000012,
+    0x71aca93, 0x6400014, 0x400001, 0x400000e, 0x7000017, 0x1c00004, 0x1acbc5, 0x700001a,
+    0x500000e, 0x1c00014, 0x27400009, 0x8c00001, 0x5000009, 0x1b7ac9, 0x40000d, 0x1acf05,
+    0x1ace0f, 0x3800007, 0xf80000f, 0x7400012, 0x11800013, 0x48800014, 0x1d80000c, 0x1180000b,
+    0x2680000c, 0x5c0000f, 0x1ace8e, 0x1b79c1, 0x1800001, 0x1ad213, 0xd9ad312, 0x12c00013,
+    0x1acec5, 0x1b7d8c, 0x1b6fdf, 0x1b3181, 0xd5b7b05, 0xa000006, 0x100000b, 0x11400000,
+    0x8dad281, 0x1ad482, 0x1400008, 0x25800004, 0xa1ad145, 0x1ad012, 0x1ad4c7, 0x1ad054,
+    0x1ad409, 0x1b2f8f, 0x8c00012, 0x1ad7cc, 0x1ad68d, 0x1c0001a, 0xa1ad44f, 0x1b7b93,
+    0xd400009, 0x1000000, 0x1ad593, 0x1ad854, 0x8c00015, 0x19ada81, 0x1c00002, 0xa000003,
+    0x1ad9c4, 0x1ad6c5, 0x7000006, 0x1ada47, 0x1dad808, 0xcc00009, 0xa00000a, 0x1ad90b,
+    0x6c0000c, 0x40000d, 0x1adc0e, 0x40000f, 0x1c00010, 0xcdadb85, 0x1c00006, 0x5add13,
+    0x1addd4, 0x5000001, 0x1b8612, 0x1add97, 0x8c0000c, 0x8c00001, 0x1adfda, 0x1ade8f,
+    0x1adf50, 0xf80000d, 0x1b8547, 0x240001f, 0x8dae301, 0x1dae182, 0x1dadec3, 0x800004,
+    0x1ae045, 0x1b888e, 0xd000007, 0x12c00008, 0xa000009, 0x7c00008, 0x1ae38b, 0x80000c,
+    0x11adb4d, 0xcc00004, 0x1ae0cf, 0x1b13c1, 0x1b7547, 0xd400003, 0x400014, 0x1dae794,
+    0x8c00015, 0x11400000, 0x5000001, 0x1b77ce, 0xa000003, 0x11adf1a, 0x15800005, 0xcc00000,
+    0x1ae701, 0xa000002, 0x1b1950, 0x1c00000, 0xcdae945, 0x1b1a93, 0x1b1bd4, 0x8c00015,
+    0x400014, 0x3800010, 0x800008, 0x7c0000c, 0x1ae3d3, 0xa1ae594, 0x1ae4cf, 0x1b88c5,
+    0x140000e, 0x8c00012, 0x1ae8d3, 0x1c00014, 0x1aeb82, 0x1ae803, 0x7000004, 0x1b6ed5,
+    0x11aed86, 0xa1ae987, 0x16400004, 0xa1aef01, 0xd800005, 0x40000b, 0x7c00001, 0xa00000d,
+    0xd800012, 0x215b628b, 0x7c00005, 0xa1aedc9, 0x1b63ce, 0x1af213, 0xd400009, 0x7000015,
+    0x1400012, 0xd00000c, 0x1b8293, 0xd40000c, 0x400012, 0xd000003, 0x5000004, 0x7c00012,
+    0x16400004, 0x5000007, 0x23000015, 0x1b8487, 0xdc00017, 0x1c0000b, 0x500000c, 0xa00000d,
+    0x500000e, 0xa00001f, 0x1b84ce, 0xa000000, 0x5000012, 0xd800013, 0xa000003, 0x800006,
+    0xfc00008, 0x1aee86, 0x1b3709, 0xa000029, 0x7000019, 0xa000006, 0x2500000b, 0x115af40c,
+    0x2500000d, 0x1daf64e, 0x700001f, 0x1b38d2, 0xa00000d, 0x495b024e, 0x8daf8d3, 0x1000010,
+    0x1b86c7, 0x1b0b92, 0x400017, 0x8c00008, 0x1b8689, 0xd00001a, 0xa000000, 0x185af681,
+    0x48c00002, 0x7c00014, 0x48c00004, 0x1af905, 0x1af0c6, 0xa000007, 0x8c0000b, 0x1af709,
+    0x700000c, 0xa00000b, 0x1afccc, 0xa00001a, 0xa00000e, 0x1af9cf, 0xa000010, 0x1b8a49,
+    0x1000014, 0xa1af553, 0x48dafa94, 0xa000000, 0xa1af781, 0x800002, 0x8c00004, 0x1c00007,
+    0x1afb05, 0x5000007, 0x7000014, 0x2c40000e, 0x8dafc89, 0x8c0001f, 0x1b21cc, 0x1180000d,
+    0x1c0000d, 0x8c00009, 0x1af6cf, 0x1aff10, 0x1b2312, 0xcc00005, 0xd000013, 0x14000029,
+    0x8dafb55, 0x2dc00000, 0x271afe41, 0x1c0001b, 0x80000d, 0x1b00c4, 0x1b0385, 0x26c00006,
+    0x1b0147, 0x49800001, 0x8db0309, 0x5000015, 0x26c0000b, 0x19b0ec5, 0x1b26c1, 0x2540000e,
+    0x1afdcf, 0x1800009, 0x1b2705, 0x1400007, 0x1b0613, 0x1b0854, 0x1b2649, 0x1b2a01,
+    0x7000010, 0x1b278c, 0x8c00019, 0x8c0000e, 0x1b0c54, 0x140000d, 0x5000012, 0xddb2c12,
+    0xd00001f, 0x1400015, 0x100001a, 0x71b2e0d, 0xa000008, 0xa00000f, 0x1c00010, 0x700000b,
+    0x7c00000, 0xd400013, 0x5000029, 0x12400000, 0xcdb0cc1, 0x1b0a82, 0xa000003, 0xd1b0744,
+    0x1b1085, 0x1b0346, 0x251b11c7, 0x1b1208, 0x1b15c9, 0x1bafcc, 0xd1affcb, 0x1b06cc,
+    0xa00000d, 0x1b16ce, 0x1b0a4f, 0xcc00010, 0x12400000, 0x1b17d2, 0x1b1853, 0x26db0994,
+    0x491b08d5, 0xcc00016, 0x1b02d7, 0x11400007, 0x7000019, 0x1b19da, 0xa000008, 0x700000b,
+    0x1b1e4c, 0x1b890b, 0x1b1e0e, 0xd000013, 0x7c00010, 0x2000000, 0xa000001, 0x6400002,
+    0x25400001, 0x6c00015, 0x5000001, 0x6400006, 0x16c00029, 0x5000001, 0x65b1449, 0x1b90c9,
+    0xcc0000b, 0x800002, 0x1b1fcd, 0x21b204e, 0xa00000f, 0x25c00009, 0xa000000, 0x1b20d2,
+    0x1b1713, 0x1b1c83, 0xdc00013, 0x1b1f05, 0x1b3341, 0x1b96c5, 0x7c00015, 0x1b8941,
+    0x1b34c5, 0xd5ba312, 0x640000c, 0x640000d, 0x7db1c0e, 0x6400002, 0x7db2143, 0x15b89c9,
+    0x6400012, 0x7c00006, 0x1400000f, 0x6400008, 0x1b9854, 0x28000012, 0xa000005, 0x1b22cc,
+    0x280002a, 0x1b4008, 0x15baec8, 0x1400015, 0x800002, 0x1baf8b, 0xdc00013, 0x65b1f54,
+    0x3d400015, 0x7c00016, 0x1b2082, 0xa000012, 0x25000013, 0x140001f, 0x1b25c6, 0x26c00007,
+    0x1c00008, 0x14000009, 0x800010, 0x1b2901, 0x15b260c, 0x2680000e, 0x3f5b220e, 0x1b2ac5,
+    0x8c0001f, 0xa000007, 0x1b2752, 0x1b2353, 0xf80001a, 0x1400015, 0x1b28cc, 0x1bb185,
+    0x1b8985, 0x500000f, 0x2680000d, 0x700001b, 0xa000000, 0x1b2d01, 0x26c00014, 0x8c00015,
+    0x6c00004, 0x10db2c85, 0x1000006, 0x1b2ec7, 0x400008, 0x1b2c49, 0x700000a, 0x1b2fcb,
+    0x8c00015, 0xd400013, 0x80000e, 0x1b2b0f, 0x1b3203, 0x1c0001a, 0x1b3305, 0x5b3493,
+    0x400014, 0x51b2d95, 0x3800016, 0x8c00029, 0x500000b, 0x100000c, 0x1b9009, 0x10400004,
+    0x1400008, 0x8c00010, 0xd80000c, 0x1000012, 0x26c00013, 0x1b3454, 0x8c00015, 0xd5b3281,
+    0x80000d, 0x1ba00e, 0x51b8c55, 0x1e400005, 0x800001, 0x7c00015, 0x1400008, 0x5000009,
+    0x5000005, 0x8c00002, 0x1b3901, 0xd400005, 0x1b8f1f, 0x1c0000a, 0x25000009, 0xd40000c,
+    0x1c00007, 0xd400001, 0x1b39c9, 0xf000015, 0x1c0000b, 0x80000e, 0x400013, 0xa000014,
+    0xa00000f, 0x1b3b01, 0xa000000, 0x1b3cc1, 0x25000004, 0x1b3c45, 0x141b3a95, 0xddbb748,
+    0x1b3e06, 0x1b3d49, 0x1b3d88, 0x400013, 0x251b8b14, 0x1b5d82, 0x65b5c43, 0x8c00012,
+    0x1b7301, 0xa00000f, 0xcc00007, 0xd400017, 0x1b7705, 0x140000d, 0x1b000014, 0xcc00000,
+    0x1b5c0d, 0x5000019, 0x7000003, 0x5b3ec4, 0xcdb3fc5, 0x1b4046, 0x2edb4147, 0xddb7990,
+    0x1b4249, 0x1ba150, 0x1740000b, 0x1b7394, 0xd400005, 0x1ba614, 0x1b3c0f, 0x11800008,
+    0x1bbcc5, 0x1180001a, 0xcc00013, 0x1b4414, 0x2800015, 0xf800014, 0x800017, 0xd400010,
+    0x1580001f, 0x17400000, 0x7000013, 0xa000014, 0xa1b42c3, 0x1b4504, 0x1b3f1f, 0x1b4546,
+    0x12400007, 0x1b44c8, 0x20400009, 0x1400004, 0xa1b458b, 0x175b470c, 0x10400008, 0x1b488e,
+    0x8c00029, 0xa000003, 0xd40000b, 0xa000005, 0x1b4453, 0x1bb30e, 0x1b4a55, 0x4000000,
+    0x1db4281, 0x71b4202, 0x71b4ac3, 0x6400004, 0x1fc0001b, 0xa1b4b06, 0x7000007, 0x6400008,
+    0x1b4e89, 0x1040000e, 0x25000029, 0x6c0000c, 0xcc0000d, 0x1b50ce, 0x10400013, 0x1b5190,
+    0x700001a, 0xcc00012, 0x1b49d3, 0x1b52d4, 0x1b4955, 0x6c00016, 0x1640001b, 0x8c00008,
+    0xd400009, 0x640001a, 0xcc00002, 0x1b4cc3, 0x49000004, 0x1b5605, 0xd40000f, 0x1b56c7,
+    0x1bc006, 0x8c00001, 0x1bbd48, 0xcdb510b, 0x5000005, 0x1b9bc5, 0x1b590e, 0x5000001,
+    0xcdb4810, 0x8c00009, 0xa000000, 0xd80000c, 0x25800002, 0x1b4d03, 0x4000016, 0xa000005,
+    0xd400018, 0x1ba092, 0x1b4b9a, 0xcc00009, 0x8c0000e, 0x1b4fcb, 0x1b4f8c, 0x1b5b8d,
+    0xa1b514e, 0x1baa45, 0xcdb5250, 0x7c00003, 0x1bcd0f, 0x1b53d3, 0x8c00012, 0x1b5355,
+    0xa000001, 0xa000002, 0x6400003, 0x17400019, 0x1bad90, 0x7000006, 0x25000005, 0x8c00001,
+    0x1badd4, 0x1b82c3, 0x700000b, 0x8c00005, 0x251b548d, 0x1b538e, 0x16400004, 0x20400010,
+    0x17400003, 0x1c00004, 0x1b5453, 0x65b5854, 0xa000007, 0x8c0000f, 0x7000017, 0x80000d,
+    0x140000e, 0x6c00003, 0x400000, 0x1b5bce, 0x7c00000, 0x1b8e01, 0x1c00008, 0x8c0000c,
+    0x7000013, 0x1b5654, 0x1b5c95, 0x1fc0000d, 0x1bbb84, 0x1b9041, 0xa000010, 0x1b9103,
+    0x700001b, 0xa1b5953, 0xa000014, 0x5000002, 0x7db5dc3, 0x16400004, 0x1bbe8e, 0x400013,
+    0x1b8ed4, 0x1b5d48, 0x1400012, 0x1400000f, 0x8c00010, 0x1b5f0c, 0x1b5fcd, 0x9b5ece,
+    0x25000014, 0x5000001, 0x25dbcfd2, 0x11800012, 0x49c00013, 0x16400002, 0x800015, 0x8c00016,
+    0xd400005, 0x800006, 0xf80000d, 0x15b6088, 0x1b5f49, 0x2800015, 0x1b9485, 0x16400012,
+    0x1b624d, 0x1b62ce, 0x3b000009, 0x10400010, 0x1bc214, 0x10400012, 0x1b6053, 0xd5b6514,
+    0x1b6686, 0x16400016, 0x275bcc81, 0x9b61d8, 0x1b9253, 0x11800001, 0x7c0000c, 0x7c0000d,
+    0x25dbd088, 0x1b6801, 0x10400010, 0x5000015, 0xd5b6492, 0x1b6945, 0x1b6d01, 0x1b6315,
+    0x800008, 0x79b69c9, 0x1b6e05, 0x140000d, 0x1bb34e, 0x4a000008, 0x1b6c49, 0x9b658f,
+    0x8c00012, 0xd400013, 0x1b6612, 0x259b9089, 0x1b6e8f, 0x1b6655, 0x1b938c, 0x1b6cd2,
+    0x269b980e, 0x11800005, 0x8db6a55, 0x1bdbc6, 0x1b9512, 0x25000013, 0xcc00019, 0x80001f,
+    0x1400002, 0x8db70c3, 0x1400004, 0x251bc641, 0x1b675f, 0x8db7207, 0x2a000008, 0x4b1bcb85,
+    0x2f1bda53, 0x1b728b, 0x8c0000c, 0x1b7342, 0xd9b73ce, 0x8dbb5c1, 0x2a000010, 0x1b6dea,
+    0x1b6f52, 0x1bb885, 0x1b7449, 0x80000d, 0x1bad0e, 0x7db760c, 0x1b6f8d, 0x1b750e,
+    0x80000f, 0xa000005, 0x1bad54, 0x1b7752, 0x401b7693, 0xa000000, 0x5000005, 0x1b7c02,
+    0x1bb614, 0x1bb695, 0xa000005, 0x6c00006, 0x6400007, 0x1000008, 0x1ba541, 0x11800001,
+    0x640000b, 0x1c0000c, 0x1ba645, 0xd400005, 0x1140000f, 0x26c00006, 0x1ba389, 0x6400012,
+    0x1b8013, 0x6400014, 0x1be408, 0x700001f, 0x1000017, 0xa000000, 0x1000001, 0x640001a,
+    0x25400013, 0x11b7e04, 0xa1b7c85, 0x6400006, 0x1b81c7, 0x15baa81, 0x1b7fc9, 0x5000001,
+    0x500000c, 0x1bac05, 0x100000d, 0xa00000e, 0x740000f, 0x8c00009, 0x1be5c9, 0x5000009,
+    0x7db8113, 0x6c00014, 0x1b80c1, 0x1000016, 0xdc00003, 0x1bed0d, 0x1b8245, 0x25800006,
+    0x25000007, 0x800002, 0x1b8509, 0xa000013, 0x1400003, 0x16400004, 0x1b7ecd, 0xa00000e,
+    0xedb7f4f, 0x1b8388, 0x1b8709, 0x140001f, 0x800008, 0x25000005, 0x2800015, 0x279b878e,
+    0x1ba405, 0xd800012, 0x8c00013, 0x1b87d2, 0x39800013, 0xd5b8814, 0xa000000, 0x8c0000c,
+    0x8c0001f, 0xdc00003, 0xcc00001, 0xa000005, 0x25000009, 0xa000007, 0x8c00005, 0xfc00014,
+    0x1bd941, 0x1bf149, 0x26c00009, 0x10400009, 0x1bdb45, 0x1b930c, 0x1b9c8c, 0x1040000d,
+    0x1ba2ce, 0x18800013, 0x80000c, 0x1bb241, 0x1ba292, 0xa000017, 0x10400014, 0x1bb2c5,
+    0x700001a, 0x400000, 0x16c00001, 0x400002, 0x1bda95, 0x400004, 0x251b8d85, 0x400006,
+    0x400007, 0x400008, 0x1b8dc9, 0x26c00001, 0x8c00012, 0x1bb4d3, 0xd400002, 0x40000e,
+    0x8c0000f, 0x400010, 0x800004, 0x400012, 0x400013, 0x4a400014, 0x8c00015, 0x1400008,
+    0x400017, 0x80000d, 0xd9bf70e, 0x40001a, 0x1b8e42, 0x1b8c83, 0x1bf792, 0xd400005,
+    0x16c0001f, 0x800012, 0x1b8e88, 0x1b8cc9, 0x1bf256, 0x1bb143, 0xddb91c1, 0xd400005,
+    0x1b8fce, 0x800000, 0x5b9405, 0x1bb009, 0x8db8f92, 0x2800013, 0x5b9349, 0x1b8f55,
+    0x1400005, 0xd00000c, 0xd00000d, 0xd00000e, 0x1b914f, 0xd800012, 0x2a800014, 0x3b000012,
+    0x1b95d3, 0x1b9194, 0x400015, 0x1bf452, 0xdc00017, 0x1c00002, 0x7c00000, 0x4a800001,
+    0xd400001, 0x1bf605, 0x7c00004, 0x251b9685, 0xdc0001f, 0x1b9b07, 0x1ba805, 0x7800009,
+    0x40000d, 0x26c0000b, 0x1ba8c9, 0x1bf1cf, 0x5000005, 0x8c0000f, 0x10400003, 0xd00002a,
+    0x1b40000f, 0x2a5b9701, 0x251b9b82, 0x10dbf64c, 0x25400004, 0x251b9d05, 0xcc00015, 0x25400007,
+    0x1b9a5a, 0x1b9909, 0x25000013, 0x1000013, 0x1b9d4c, 0x8c00012, 0x7db9e8e, 0x3880000f,
+    0x2a00001f, 0x5000006, 0x1b9292, 0x1b9d93, 0x25800014, 0x1ba055, 0x500002a, 0x1b9b57,
+    0x1c00002, 0xd400009, 0x2540001a, 0x1400002, 0x7db9c43, 0x1c00007, 0x8c00001, 0x1400001f,
+    0x800010, 0x7c00008, 0x10400012, 0x5000001, 0x140000b, 0x7db9dcc, 0x7c0000d, 0xd5b9fce,
+    0x1bdbb581, 0xd400029, 0x25dbfe05, 0x18c00012, 0x7c00013, 0xd400014, 0x1400015, 0x1ba6c2,
+    0x25000001, 0x16400004, 0x1c00015, 0x25c00005, 0x140001b, 0x7c00000, 0x800005, 0xd400001,
+    0x1040000b, 0x1bb812, 0xd000013, 0x1ba50e, 0x1bab05, 0x10400010, 0x15ba5c9, 0x1400012,
+    0x1ba9c9, 0x1ba4cc, 0x1400015, 0x1ba1ce, 0xd800002, 0x5000003, 0x51ba70f, 0x1ba792,
+    0x1ba753, 0x8c00014, 0x800005, 0x1040000c, 0x1bb64d, 0xd80000e, 0x1c0502, 0x500000d,
+    0x7c0000e, 0x1bb512, 0xd800010, 0xd5bb714, 0x1400012, 0x7c00013, 0xf80001f, 0xdc00001,
+    0x8c00001, 0xd400006, 0x8c00001, 0x1bae05, 0x1bb1c5, 0x8c00005, 0x800005, 0xf1baac9,
+    0x1bb089, 0x1ba6aa, 0x23000009, 0x1c0706, 0xd80000c, 0xec0000f, 0x1bb20f, 0x5000014,
+    0x1c074c, 0x28000012, 0x25000013, 0x8c00015, 0x1bb115, 0x1bb381, 0x8c00015, 0x1c0d8b,
+    0x1c0e92, 0x51bb405, 0x140000c, 0x12c0000d, 0x140000e, 0x11800009, 0xec0000c, 0x8c00004,
+    0x800002, 0x27400004, 0x10400004, 0x8c0000f, 0x1bd2d2, 0x1bd313, 0xd000014, 0x25400013,
+    0x280002a, 0x1640000b, 0x1bb78c, 0x7c00000, 0x1bb7ce, 0x5000012, 0x10400010, 0x28000014,
+    0x12dbba52, 0x10400006, 0x7dbb854, 0x1bb915, 0x1bb8c9, 0x5000005, 0x1bde01, 0x1bbe41,
+    0x1bf805, 0x1bbace, 0x1bdb85, 0x1bbc45, 0x1bf6c9, 0x1bbd12, 0x1bb6d3, 0x1bbe09,
+    0x1c00000, 0x2000004, 0x21bbf02, 0x1bfe93, 0x1bdd8f, 0x1be050, 0x1bc0d0, 0x8c00007,
+    0x8c0000c, 0x1bdc54, 0x14000017, 0x1bbf55, 0x8c0000c, 0x780000d, 0xf80000e, 0x1bdfda,
+    0x800010, 0x1c020e, 0x1bc352, 0x4ac00013, 0x5000014, 0x1c00000, 0x8dbc381, 0x8c00014,
+    0x1c1c0d, 0x2000004, 0x1dbc445, 0x2000006, 0x1c00007, 0x7c00000, 0x1bc149, 0x27400005,
+    0x2ec00003, 0x5000001, 0x26dbcac5, 0x200000e, 0x1bc48f, 0x5000005, 0x1c21c8, 0x1a400012,
+    0x1bc5d3, 0x400001, 0x1bc195, 0x2000016, 0xd400002, 0x1c0105, 0xd400004, 0x200001a,
+    0x7c00013, 0x400014, 0x500000e, 0x1bc709, 0x400017, 0x1c00015, 0x5000012, 0x1bc30d,
+    0x279bc08e, 0x1bf4d5, 0x1bc601, 0x21dc0b05, 0x1bc512, 0x2c400013, 0x1bc7c5, 0x26c0002a,
+    0x1c214c, 0x29c00008, 0x1c00006, 0x1c00007, 0x200000e, 0x1bc4cc, 0x7c00003, 0x1c0000b,
+    0x8c0000f, 0x11400006, 0x1c0d14, 0x8dbc3d2, 0x275bc813, 0x2c000001, 0x2580000b, 0x7c00000,
+    0x8c0000d, 0x1bc945, 0x200000f, 0x800004, 0x1be285, 0x8dbc852, 0x1bc413, 0x7800014,
+    0xd400001, 0x4400016, 0x1bcb4e, 0x1bc58f, 0x1c24d3, 0x1be50e, 0x1bc992, 0x25400013,
+    0x1bcc54, 0x1c00000, 0x1be793, 0x1c048c, 0x1bccc3, 0x5000001, 0x5000005, 0x1c00013,
+    0x1c1454, 0x51bcbc5, 0x42800009, 0x14000001, 0x500000b, 0x7000009, 0x5000001, 0x1c0345,
+    0x4a800001, 0x5000010, 0x1c0185, 0x1c0049, 0x1bce05, 0x1bcf54, 0x5000012, 0xd000013,
+    0x1bd0c9, 0x1c00015, 0x7000019, 0x700001a, 0x9bd1c2, 0xa000019, 0x1940000f, 0x1c2008,
+    0x1c0648, 0x2800012, 0x8c00015, 0x200000b, 0x1c26d4, 0x1bcd4b, 0x1bcdcc, 0x1640000d,
+    0x1bd34e, 0x8c0001f, 0x5000010, 0x1beb85, 0xf9bd112, 0x1bd3d3, 0x1bd394, 0x10400015,
+    0x1bd446, 0x2800001, 0x1c00007, 0x1bd489, 0x1a800004, 0x1be8cf, 0x1bd4cc, 0x31400007,
+    0xd5bd68e, 0x1bd405, 0x10400010, 0x1be895, 0x1bd752, 0x1bd609, 0x1bd8d4, 0xd000015,
+    0xddbda0c, 0xd400003, 0x1bd9c4, 0x1bd905, 0x1000014, 0x1dbdf01, 0x1bd852, 0x25800013,
+    0x1c1288, 0x1bdf85, 0x2c000001, 0x1c188b, 0x1bdace, 0x5000009, 0x1be1c5, 0x5000001,
+    0x1c2586, 0x11000003, 0x8c00009, 0x11000005, 0x1c00007, 0xd400001, 0x1bde52, 0x1be193,
+    0x1bdecf, 0x80000c, 0x11800002, 0x1c0000e, 0x5000008, 0x26c00014, 0x1b400006, 0x1be0c7,
+    0x14000017, 0x251bf514, 0x1c0014, 0x1c2814, 0x5000003, 0x1be30d, 0x1be20e, 0x140000c,
+    0x8c0001f, 0x1400008, 0x1be152, 0x49c00013, 0x7c00000, 0x7c0000c, 0x42000002, 0x10400003,
+    0x1c120c, 0x800010, 0xd40000c, 0x5000008, 0x400005, 0x105be389, 0x1400015, 0x1c12d3,
+    0x269c1394, 0x1be801, 0x1be00e, 0x25400013, 0x7c00010, 0x15be845, 0x1be692, 0x1be4d3,
+    0x800008, 0x1be949, 0x1be7c1, 0x25000008, 0x800018, 0x1c1f5a, 0x1bee45, 0x9be3cf,
+    0x7c00006, 0x8dbea08, 0x1bea49, 0xd00000c, 0x2000006, 0x800015, 0x1bec0c, 0x3f80000d,
+    0x1bea8e, 0x159c0545, 0x10400010, 0x51beb52, 0x10400012, 0xd400013, 0x5bed55, 0x1bec95,
+    0x12c00004, 0x1c2393, 0xec0000e, 0x500000f, 0x7c00008, 0x1bf289, 0x21c1f06, 0x7c0000b,
+    0x1bf20c, 0x7c0000d, 0x269bf2ce, 0x1bf3c2, 0x1c244c, 0x1bf105, 0x1bf312, 0x8c00013,
+    0x7800014, 0xf800009, 0x4c00016, 0x9c00015, 0x10400018, 0x1c2544, 0x7c0000d, 0xf80000f,
+    0x1c2247, 0x1bf0d0, 0x21c00005, 0x1bf592, 0x26c00013, 0x800015, 0x1bf341, 0x2c000001,
+    0x1bf543, 0x800019, 0x1bf385, 0x1bf8c5, 0xd5c2693, 0x14000010, 0xec00008, 0x1bfc49,
+    0x1180000b, 0x29c2094, 0x51bfb01, 0xd400003, 0x25400013, 0x1bf48f, 0x5bf845, 0x26c00005,
+    0x28000012, 0x25800013, 0x5000009, 0x14000015, 0x1c25d2, 0x1bfbc1, 0x25000009, 0xd400003,
+    0x500000f, 0x5000005, 0x2500000c, 0x1c2713, 0x1bf41f, 0x51bf749, 0x1c288c, 0xd1bfe41,
+    0x1bfdc2, 0x7dc278e, 0x25400004, 0x251bfec5, 0x26dbfd86, 0x25800007, 0x7c00013, 0x51bfac9,
+    0x1bfb94, 0xd00000b, 0x1c0288, 0x1c00002, 0x2500000e, 0x2000004, 0x8dc030c, 0x11400000,
+    0x800004, 0x1bffd3, 0x26dc00d4, 0x25800015, 0x8dc02d2, 0xd00000c, 0x5000001, 0x1c198e,
+    0x1c2a0c, 0x26800017, 0x26c00005, 0xd1c0381, 0xcc00012, 0x5000029, 0x11800009, 0x25000005,
+    0x7000000, 0xd000007, 0x800013, 0x51c04c9, 0x1180000f, 0x8c00010, 0x1c2746, 0x251c03cd,
+    0x7c00014, 0xd00000f, 0xd400015, 0x26c00013, 0x1c0841, 0x1c00002, 0x26c00014, 0x1c0984,
+    0x1c0585, 0x1c2cc1, 0x800008, 0xd5c22d3, 0x5000009, 0x1c2d45, 0x5000001, 0x400000,
+    0x2680000d, 0x1c0bc4, 0xf800001, 0x7c00006, 0x1dc08c7, 0x26dc2c89, 0x25000013, 0x1c0a54,
+    0x5000001, 0x1c2485, 0xd5c0a83, 0x200000e, 0x9c2989, 0xa00001a, 0xd80000e, 0x5000008,
+    0x14000001, 0xd00000e, 0x14000001, 0x8c0000f, 0x1c0885, 0x8c00008, 0x1c0dc5, 0x1c081a,
+    0x31400005, 0x14000015, 0xd1c0c93, 0xec0000c, 0x5000015, 0x2800000c, 0x8c0000f, 0x280000e,
+    0x2c00000f, 0xec00012, 0x1c0b93, 0xec00012, 0xd1c0f13, 0x1c0e02, 0xd00000e, 0x1c0c04,
+    0x1c00005, 0x1c0f86, 0x1c0cc7, 0x1040000d, 0x1040000e, 0xd80000e, 0x2580000b, 0xa00000c,
+    0x800005, 0x1c108e, 0x25400001, 0x27400001, 0x800014, 0x1c1304, 0x1c1153, 0x1c0e54,
+    0x1c1187, 0x2680000e, 0x11800009, 0x8c00015, 0x1c14cb, 0x1c11da, 0x2a400001, 0x1c1542,
+    0x1040000d, 0x251c1504, 0x1c1245, 0x1c1406, 0x1dc1747, 0x1c1c83, 0x1c1609, 0x10c00005,
+    0x1c1b4b, 0xd400001, 0xd400010, 0xd00000b, 0x1c1b84, 0x26c00004, 0x7c00014, 0x1dc18c7,
+    0xd400013, 0x1c1bd4, 0x8c00010, 0x1c1b0b, 0x800000, 0x21c1cd3, 0x1c204e, 0xd000001,
+    0x1c2ad3, 0x800005, 0xd000004, 0xd000013, 0x25000014, 0x2b800014, 0x1c27c1, 0xec00009,
+    0x1c0000c, 0x8c0000e, 0x251c2845, 0x80001a, 0x2500000e, 0x1c2dc9, 0x8c00029, 0x25000013,
+    0x1c2f48, 0x25c00009, 0x1c2514, 0x28000015, 0x740000f, 0x16400004, 0x800001, 0x8c00001,
+    0x2800013, 0xd400003, 0x1c2949, 0x8c00005, 0xd400007, 0x1040000c, 0xd800004, 0x1c28ce,
+    0x40000b, 0x27400005, 0x12c00003, 0x1c2a92, 0x800000, 0x3000000f, 0x8c00010, 0x10400016,
+    0xd00002a, 0x25400013, 0xd1c2114, 0x8c00015, 0x1640000d, 0xd5c2d8e, 0xd800014, 0x4b400002,
+    0x26dc2e09, 0x140000d, 0xd400001, 0x7c00014, 0x25000015, 0x1c2c4e, 0x16400004, 0x10400013,
+    0x10400014, 0x1c2f12, 0xd800009, 0x140000e, 0x10400012, 0xd400001, 0x25c00005, 0x280000f,
+    0x1040000e, 0xddc2d05, 0x1400012, 0xd400005, 0xd00000c, 0x400014, 0xd9c2ec8, 0x800000,
+    0x25000013, 0x25400012, 0x700000b, 0xa000009, 0x5000012, 0x500000f, 0x2800006, 0x1c2fcc,
+    0x51c3092, 0x1c304e, 0x1c3212, 0x8c00003, 0xd400005, 0xddc3242, 0xa000000, 0x7800019,
+    0x1c00002, 0x2500000e, 0x800013, 0x800000, 0x1e000001, 0x1c00002, 0x8c0000f, 0x1c30d3,
+    0x5000005, 0x1c00006, 0x1c2e47, 0x1c0000d, 0x26c00014, 0x1140000f, 0x115c318b, 0xa000002,
+    0x1c3105, 0x1c3148, 0x1c2f94, 0x13000006, 0x6400007, 0x1c00012, 0x26c00013, 0x1c3014,
+    0x1000006, 0x27400015, 0x7400001, 0xa00000e, 0x26dc31c5, 0x1c3982, 0xd800012, 0x7c00012,
+    0x1c4952, 0x1000014, 0x4b800006, 0xd40000c, 0x1c47d5, 0x27400012, 0x500000f, 0x1c00001,
+    0x251c328c, 0x141c33c1, 0x11c358e, 0x1000010, 0xd000004, 0x1c3445, 0x1800008, 0x36dc3353,
+    0xa1c3614, 0x1c3489, 0x80000e, 0x5000012, 0x1c38cc, 0x26c0000d, 0x1c4648, 0x1400000f,
+    0x8c00012, 0x1c4805, 0x1c4514, 0x251c3853, 0x1c00010, 0x25000015, 0x17400000, 0x1c3a41,
+    0x26400014, 0x1c4a89, 0x1c49cc, 0x1c3805, 0x1c45ce, 0x1c3b47, 0x251c4a4b, 0x1400001f,
+    0x1c48d2, 0x15c4693, 0xd400005, 0xdc00013, 0xd00000e, 0xedc36cf, 0x11400000, 0x1c3fc1,
+    0x7c00013, 0x1c3bd3, 0x1c3c94, 0x1c3c45, 0x1c3b06, 0x1c4047, 0x1c3c08, 0x1c3a89,
+    0x1c3ada, 0x1c3a0b, 0x1c438c, 0x1c4f8c, 0x115c40ce, 0x1c00005, 0x1c43c7, 0x1000011,
+    0x1c3f12, 0x251c4453, 0x1c44d4, 0x100000c, 0x1c4343, 0x1c4097, 0xdc00005, 0xd400005,
+    0x11c449a, 0x1400012, 0x100001a, 0x180000f, 0x8c0000c, 0x1c4c0f, 0x2500000c, 0x1c4c53,
+    0x25000015, 0x8dc42d0, 0x5000005, 0x26400013, 0x1c4793, 0x1c4754, 0x1180001a, 0x11c4129,
+    0x1000004, 0xd5c4a05, 0x1000006, 0x115c4f0e, 0x400008, 0x1c4989, 0x100000a, 0xd5c4fce,
+    0x8c0001f, 0x7c00003, 0x1c4c8e, 0xd80000f, 0x1c5145, 0x1c4b41, 0x10400015, 0x1c4d13,
+    0x1c00014, 0x26c00005, 0x1000016, 0x51c5045, 0x15c4e08, 0x25800013, 0x1c4ed4, 0x5000009,
+    0x1c5008, 0x1c4e49, 0x1c51c8, 0x46c0000f, 0x8c0000c, 0x500000f, 0x1c4d8e, 0x26c00009,
+    0x7c00012, 0x1c4f41, 0x1c4b12, 0x1c4dd3, 0x8c0000c, 0x1c5085, 0x1000012, 0x7c00019,
+    0x1c5386, 0x5000015, 0x3d000012, 0x1c54c3, 0x4bdc530c, 0x400012, 0x500000c, 0x8c0000f,
+    0x1c00013, 0x1000000, 0xd400001, 0x1000002, 0x1c564e, 0x1c50d5, 0x1c5105, 0x1c00006,
+    0x1c00007, 0xd800012, 0xd400009, 0x400012, 0xd800015, 0x1c0000c, 0x8c00005, 0x1c53c7,
+    0x5000009, 0xd00001a, 0xdc00003, 0x1c00012, 0x1000013, 0x1c5481, 0xd400015, 0xfc00001,
+    0x1000013, 0xd5c5205, 0x26c00006, 0x26dc5447, 0x1000010, 0x5c5249, 0x1140000c, 0x1c5842,
+    0x1c0001b, 0x100000b, 0x100000c, 0x10400004, 0x100000e, 0x1c00013, 0x1c00012, 0x1000013,
+    0x1c00014, 0x1000013, 0x1000014, 0x400003, 0x27400012, 0x25dc568e, 0x26c00015, 0x1c00007,
+    0x1c00008, 0x25000008, 0x2f000013, 0x140000e, 0x1c0000c, 0x800003, 0x27000013, 0xd800005,
+    0x1c00010, 0x1000004, 0x400012, 0xe800013, 0x1c00007, 0x1c00008, 0x1c5549, 0x25800002,
+    0x1c55ce, 0x100000c, 0x2c000001, 0x100000e, 0x1c5192, 0x1c5753, 0x800014, 0x1000012,
+    0x1000013, 0x1b40000c, 0x8c00001, 0x4a800001, 0x16800013, 0x1c57d4, 0x8dc56c5, 0x1c5585,
+    0x10400001, 0x2800014, 0xd000002, 0x8c00009, 0xd800013, 0x1c5705, 0xd80000e, 0x400006,
+    0x8c0000c, 0x8c0000f, 0x275c5807, 0x5c5985, 0x280000f, 0x1c5413, 0x1c5794, 0x400009,
+    0x11800005, 0x2800001, 0xd00000c, 0x1c59d3, 0xd000014, 0x1c00014, 0xdc00009, 0x400017,
+    0x800012, 0x1c5b53, 0x1c5a94, 0x400015, 0x1c5d54, 0x2a000009, 0x26400013, 0x1c5c52,
+    0xd000013, 0x140000e, 0x1c5f4c, 0xdc00001, 0x5000001, 0x1c5b85, 0x1c5c12, 0x119c5dc5,
+    0x5000005, 0x5000009, 0x400000, 0x25000005, 0x800005, 0x1c5cc3, 0x26c00013, 0x200000c,
+    0x2800009, 0x14000001, 0x8c0000c, 0x5000005, 0x1c5e03, 0x40000b, 0x1c5b12, 0x1c5d05,
+    0xd400005, 0x1c5e8e, 0x1c6006, 0xd400005, 0x25000014, 0x2680000e, 0x4c000005, 0x111c5d85,
+    0x1c5f85, 0x1c5fc5, 0xdc00013, 0x11800005, 0x14000003, 0x8c00014, 0x3e00000c, 0x19400001,
+    0x8c00012, 0x14000003, 0xec0000c, 0xd400005, 0x8c00012, 0x1c6053, 0x8c0000c, 0x2800006,
+    0x8c00012, 0xd400013, 0x1c5ec5, 0x1c61cc, 0x8c00012, 0x2800014, 0xd400013, 0x10400009,
+    0x5000005, 0x1c62ce, 0x1640000c, 0x8c0000d, 0xd5c620e, 0x5000005, 0x1c6081, 0x5000005,
+    0x8c00012, 0x8c00013, 0x1c6305, 0x1400002, 0x251c6385, 0x1400002, 0x7800012, 0x1400006,
+    0x8c00009, 0xd800005, 0x5000005, 0xd400013, 0x8c00008, 0x275c6445, 0x1c6485, 0x1c60d0,
+    0xd400013, 0xd400010, 0xd000007, 0x8dc6154, 0x2f000009, 0x25c00005, 0xe400003, 0x26000013,
+    0xd5c6245, 0x1c6505, 0x8c00015, 0xd400005, 0x8c00017, 0x1c6412, 0x2000008, 0xd000014,
+    0x8c00017, 0xd000001, 0xec00001, 0x8c00010, 0x1c6283, 0xdc00005, 0x2800012, 0xec00014,
+    0x2800012, 0xdc00009, 0x2c000009, 0x500000c, 0x2540000c, 0xd00000c, 0xd40000e, 0x2500000f,
+    0x1c63cf, 0x14000010, 0xec0000c, 0xd00000c, 0x8c00001, 0xec00014, 0x1c66d2, 0xd400005,
+    0x8c00012, 0x1c678c, 0x6400000, 0xf800005, 0xd400005, 0x1dc6703, 0x7c00005, 0x119c64c5,
+    0x8c0001f, 0x7c00007, 0x8c00014, 0xd1c6350, 0x8c0000c, 0x7c0000b, 0x37800013, 0x5000015,
+    0x7c0000e, 0x8c00012, 0x8c00010, 0xdc0000c, 0x1c6685, 0x1c6893, 0x1c67cc, 0x2780000e,
+    0x4c400005, 0x800012, 0xd5c6553, 0x26c00005, 0xdc00012, 0x2740000e, 0x1c694c, 0x5000009,
+    0x1c664e, 0x7c00000, 0x1c69c3, 0x1400009, 0x1c6801, 0x1c6905, 0x140000e, 0x140000d,
+    0x280000e, 0xd800005, 0xdc00001, 0x5000001, 0x5000015, 0xd400005, 0x5000005, 0x1c6a1a,
+    0xec0000c, 0x5000003, 0xd400017, 0x8c00001, 0x80000d, 0xd5c68c5, 0x28000014, 0x26c00013,
+    0xd00000c, 0xec0000c, 0x8c00003, 0x25c00009, 0x10400003, 0x8dc6bd2, 0x5000010, 0xec0000c,
+    0x8c0000c, 0x8c0000c, 0x10400009, 0x25000005, 0x500001a, 0x1640000c, 0x1040000d, 0x269c6b8e,
+    0xd400005, 0xd400005, 0x1c6d4e, 0x1c6c92, 0x1c6a53, 0x1c6e88, 0x500000b, 0x15c6cc9,
+    0x14000003, 0x27000001, 0x8c00012, 0x8c00009, 0x26c00013, 0x5000005, 0x2780000e, 0x2740000e,
+    0x8c00008, 0x1c6b13, 0x7c00014, 0xd000003, 0x1c70c5, 0x8c0000c, 0x500000f, 0xec00014,
+    0x400005, 0x8c00014, 0x5000012, 0x80000d, 0x1c6e0c, 0x1c7045, 0x1c724e, 0xd00000c,
+    0xd400003, 0x1c6fc9, 0x27400012, 0x10400009, 0xcc00014, 0x28000014, 0x1c7093, 0x1c7194,
+    0x1c6f8e, 0xd40000c, 0x1c790c, 0x1c740e, 0x251c7352, 0x1c754c, 0x10400009, 0x1c714e,
+    0x25000001, 0x5000005, 0x119c75c5, 0x1c748e, 0x1c72c5, 0xd800012, 0xd400010, 0x15c7592,
+    0x1b400006, 0x1c7992, 0xec0000c, 0x1c7845, 0x140000f, 0x800018, 0x10400004, 0xd400013,
+    0x8c00001, 0x1c7754, 0x1c71d3, 0x2c000001, 0x1c7792, 0x1c750e, 0x8c00001, 0x1c7645,
+    0x1040000e, 0x1c7a12, 0xd00000c, 0x1c78c9, 0x8c0000c, 0x5000003, 0x140001f, 0x5000005,
+    0x10400009, 0x8c0000f, 0x1040000c, 0x1640000c, 0x251c7815, 0x25000013, 0x8c00017, 0x8c00012,
+    0xd000013, 0x8c0000c, 0x5000010, 0xd400005, 0x2500000d, 0xd400001, 0x1c79d4, 0x8c00012,
+    0x5000003, 0x25000012, 0x5000005, 0x1c7a88, 0x1c7945, 0x1c7a49, 0x5000009, 0xd800008,
+    0x27000005, 0x11800005, 0xec00001, 0x8c00029, 0x14000003, 0x5000010, 0xd400005, 0x2540000c,
+    0x25400001, 0xd80000e, 0x1c7b45, 0x14000017, 0x1c7b05, 0x2f000012, 0xdc00013, 0xd000014,
+    0x1940000f, 0xd00000d, 0xd9c7ace, 0x8c00017, 0x26c00014, 0x8c00014, 0x1c7ed2, 0x8c00012,
+    0xd00000c, 0x2740000e, 0x25000001, 0x1c7bc5, 0xd000005, 0x8c00029, 0xdc00012, 0x1c7cc1,
+    0x4cc00005, 0x4d1c7c93, 0x25c00003, 0x1c7e45, 0xdc00012, 0x1c7d45, 0x1c7f8c, 0x25000013,
+    0xd000001, 0x1c81cc, 0x1c8289, 0x25c00005, 0x25400001, 0x4cdc7d13, 0x1c82c1, 0xd400003,
+    0x1c8041, 0x4c800013, 0x1c7f52, 0xd400015, 0x1c8205, 0x4d400005, 0xd800001, 0x4cc00013,
+    0x4d400013, 0x25000001, 0x25800001, 0x4cc00013, 0x4d9c834e, 0xd800013, 0x25400005, 0x25c00001,
+    0x1c83c7, 0xd400012, 0x1c7fd5, 0x1c7c12, 0x4d5c8145, 0x2640000b, 0x1c8105, 0xd000012,
+    0x26000014, 0x1c8312, 0x1c8185, 0x1c8249, 0x1c86c5, 0x1c80d4, 0x4d40000e, 0x4dc0000d,
+    0xd40000c, 0x1c8385, 0xd00000f, 0x1c870b, 0x1c8405, 0xd00000b, 0x26c00001, 0xd00000c,
+    0xd40000f, 0xd9c868e, 0x4d000006, 0xdc00005, 0x25c00009, 0x25400005, 0x25000014, 0x4d000012,
+    0x4cc00005, 0x27400013, 0x27400004, 0x4d5c8785, 0xd800012, 0xd000009, 0xd400009, 0x27400003,
+    0xd800001, 0xd40000c, 0x1c8645, 0xd400010, 0x1c8445, 0x37c00014, 0x4c800013, 0x26000014,
+    0x27400013, 0xd40000c, 0xd40000c, 0xd400001, 0x1c8841, 0x1c8954, 0x1c8805, 0x1c8745,
+    0x1c88c5, 0x26000012, 0x27400013, 0x1c8549, 0x1c8985, 0xd000001, 0x1c8a4e, 0x1c89d3,
+    0x1c8c4c, 0x4dc00007, 0x1c8e45, 0x1c8892, 0x279c8592, 0x4cc00013, 0xd400015, 0xd000001,
+    0xd400003, 0x25000014, 0x25800001, 0x31000005, 0xd400005, 0x27400005, 0xd000008, 0x1c8ec5,
+    0x1c8a02, 0xd80002a, 0x4d000004, 0x1c8ac1, 0x1c8f44, 0x1c8f94, 0x2500000c, 0x259c8f05,
+    0x4e000012, 0x25800001, 0x4d40000e, 0x1c8d45, 0xd000005, 0x25400005, 0xd000005, 0x4d000014,
+    0x25dc8e85, 0x2540000f, 0x27400015, 0xd000015, 0x1c8c81, 0x1c8bc2, 0x4cc00013, 0xd00000f,
+    0x1c8cc5, 0x1c8dc5, 0xd00000c, 0x26c00013, 0xd1c8d89, 0x1c9107, 0xd800014, 0x25400005,
+    0xd00000b, 0x4dc00009, 0x4dc00009, 0x2600000c, 0xd000005, 0xd000001, 0x4dc00006, 0x1c92c4,
+    0x4d400006, 0x1c90ce, 0xd000005, 0xd00000f, 0x4d400005, 0x1c8fc9, 0x1c9001, 0xd800012,
+    0x1c9345, 0x25400009, 0x1c9048, 0xd400003, 0x1c9145, 0x1c9089, 0x26c00008, 0xd000005,
+    0x26c00005, 0x26c00003, 0x1c9294, 0x25400001, 0x80002a, 0xd400014, 0xd000005, 0x7c00000,
+    0x25000008, 0x1c9305, 0x2740001a, 0x4c800013, 0x1c9193, 0x4d5c91c8, 0xd00000f, 0x25000006,
+    0xd00000f, 0xd400014, 0x2580000c, 0x4d800015, 0x1c9393, 0x4cc00014, 0x2500001a, 0x1c93d4,
+    0xdc0000f, 0xd800008, 0x25c00003, 0x26c00005, 0x1c94d2, 0x4cc00012, 0x1c9441, 0x26800005,
+    0x26c00008, 0xd000001, 0x4d5c9485, 0x4d400001, 0xd800014, 0xd000005, 0x4cc00005, 0x1c9708,
+    0xd000005, 0xd000001, 0x1c978c, 0x1c9513, 0x4e400013, 0x1c9908, 0x1c95d4, 0x26400012,
+    0x4dc00009, 0x2500000d, 0xd400015, 0xd000005, 0x1c954e, 0x1c9648, 0x25800001, 0x1c97d3,
+    0x1c9884, 0x1c9853, 0x1c9a49, 0xd400001, 0xd400012, 0x1c9614, 0xd800013, 0x27400013,
+    0xd800005, 0x4d000012, 0x1c99cb, 0x1c9993, 0xd000012, 0x4dc00009, 0x25c00003, 0x1c9941,
+    0x1c9745, 0xd00000b, 0xd400009, 0x1c9245, 0x1c9d0c, 0x26c00006, 0xd000005, 0x25c00005,
+    0xd00000e, 0x4d400012, 0x1c9a0e, 0x1c9ac5, 0x251c9a89, 0x1c9bc8, 0x1c98c5, 0x1c9b92,
+    0xdc0000f, 0xd000001, 0x27400013, 0x1c9d8b, 0x26000008, 0x4d400013, 0x4d800005, 0xdc00001,
+    0xd9c9d54, 0xd00000f, 0xd5c9b45, 0xd5c9b0f, 0x1c9cc3, 0x27400013, 0x1c9c81, 0x4cc00005,
+    0x4cdc9c45, 0x26800015, 0x25000013, 0xd80000c, 0x27400014, 0x1c9e05, 0x1c9dc9, 0xd000001,
+    0x26c00014, 0xd400012, 0x4dc00012, 0x25400004, 0x1ca08e, 0x27c00005, 0x2580000d, 0xd000009,
+    0x26c00014, 0x27000010, 0x31400013, 0x4ddc9ecd, 0x1ca14b, 0x1c9e4e, 0x4dc0000c, 0x26c0000c,
+    0x1c9f14, 0x1ca114, 0x4d000006, 0x1ca38c, 0x4d80000e, 0x1c9e94, 0x1ca1c7, 0x1c96cc,
+    0x1ca214, 0x1ca254, 0x4d5c9f48, 0x1ca00b, 0xd400006, 0x1ca449, 0x1ca343, 0x2740000c,
+    0x5000001, 0x25000014, 0x1400014, 0x1ca3d3, 0x1400013, 0x1ca4d2, 0x1c0000e, 0x4e800001,
+    0x8c00009, 0x8c00014, 0x80000d, 0x1c00014, 0x1400003, 0x25800004, 0x2000014, 0x1ca2c9,
+    0x26800005, 0x800004, 0x25800014, 0xcc00007, 0x2800013, 0x140000c, 0x7c00009, 0x140000e,
+    0x33c0000b, 0x1e400009, 0x27000006, 0x2000009, 0x80000e, 0x7c0000c, 0x1ca553, 0x33c00012,
+    0x7c00014, 0xcc00015, 0x2800014, 0x40000c, 0x1c00014, 0x25000013, 0x80000e, 0x33c0001a,
+    0x4b800003, 0x1ca492, 0xd000013, 0x7c00000, 0xd000015, 0xdc00002, 0xddca589, 0x400012,
+    0x1c00003, 0x26c0000e, 0x1ca405, 0x1400001, 0xd40000c, 0x800010, 0x25800009, 0x1ca652,
+    0x1ca50b, 0x4d400009, 0x1ca701, 0xdc00001, 0x1ca5cf, 0x3b800012, 0x1ca605, 0xd400010,
+    0xd800014, 0x25400010, 0xd000015, 0x1ca8d4, 0x26c00013, 0xd00000e, 0x500000e, 0xf000003,
+    0x2780000f, 0x1ca752, 0x1caa53, 0x1ca7d2, 0x1ca853, 0x5000009, 0x1ca795, 0x1ca894,
+    0x26800009, 0x2800015, 0x1ca901, 0x800004, 0x5000015, 0x8c00009, 0x8c00001, 0x1ca694,
+    0x3000000c, 0x8c0000c, 0x2a800005, 0x8c00012, 0x1ca80e, 0x1ca6c5, 0x1ca992, 0x6c00000,
+    0x280000e, 0x11800008, 0x1ca9c1, 0x2800000, 0x1cab45, 0x2800013, 0x280000d, 0x2800014,
+    0x5000014, 0x1cac89, 0x26400009, 0x1caa0f, 0x1cabc1, 0x800004, 0x4ec00008, 0x1cb208,
+    0x1400005, 0x26000010, 0xdc0000e, 0x800014, 0x1cac13, 0x1cab94, 0x19400009, 0xd00001a,
+    0x25c00009, 0x5000005, 0x8c0000e, 0x1cae8e, 0x1cab0e, 0x3000000c, 0x8c00009, 0x1cae12,
+    0xd00000c, 0x26c00013, 0x27400013, 0x1cb0c1, 0x1caf81, 0x8c00012, 0x1cafd2, 0x25000010,
+    0x1cacc5, 0x14000018, 0x1caed4, 0x1400013, 0xd400009, 0x10400014, 0x2c000002, 0x5000012,
+    0x8c0000c, 0x1c0000b, 0xd800009, 0x1c00009, 0x5000029, 0x1caf52, 0xd400012, 0x1400005,
+    0x1cae55, 0x1c00013, 0x1c00010, 0x1400010, 0x700000f, 0x1400001, 0x1c00014, 0x8c00012,
+    0x7000004, 0x7c00000, 0x1400009, 0x800007, 0x5000003, 0x26800001, 0x7c00005, 0x5000007,
+    0xa000014, 0x1cb292, 0x8c00008, 0xd000015, 0x1400013, 0x8c00012, 0x8c0000d, 0x1cb152,
+    0x25000013, 0x280000d, 0xd400005, 0xf000012, 0x1cb08e, 0x800014, 0x140001a, 0xd800012,
+    0x7800003, 0x11400001, 0x140000f, 0x5000009, 0xa000012, 0x6c00000, 0x2740001a, 0x8c00009,
+    0xa000003, 0x1cb104, 0x3cc0000b, 0x1b40000e, 0x800007, 0x500000f, 0x8c00005, 0x7000000,
+    0x4dc0000e, 0x10400002, 0x800013, 0x8c0000e, 0x8c00002, 0x10400006, 0x2000008, 0x10400008,
+    0x8c00029, 0x1cb394, 0x1cb24b, 0xf80000c, 0x15cb3cd, 0x1cb341, 0x26c00014, 0x140000d,
+    0x1400004, 0x4f000012, 0x8c00002, 0x10400014, 0x8c00006, 0x5000000, 0x1caf17, 0x1cb644,
+    0x2800003, 0xd400001, 0xa000005, 0x8c00004, 0x1cb2c5, 0x10400011, 0x1400000e, 0x1400013,
+    0x14000010, 0x8c00002, 0x2c000012, 0x1cb58e, 0xa000000, 0x14000015, 0x8c00010, 0x1cb452,
+    0x5000013, 0x1cb313, 0xd400012, 0x8c0000f, 0x500000b, 0x1400014, 0x1400014, 0x8c00010,
+    0x1cb748, 0x4cc00014, 0x5000001, 0x1cb485, 0x8c0000d, 0x1400000b, 0x1cb40d, 0x500000d,
+    0xdc0000e, 0x8c0000e, 0x1cb014, 0x1cb812, 0xdc00010, 0x1cb4c1, 0x8c00015, 0x1400002,
+    0x800007, 0x8c00005, 0x1cb612, 0x8c00015, 0x8c00012, 0x28000009, 0x1cb6d3, 0x8c00015,
+    0x25400001, 0xcc00008, 0x2800007, 0xec0000f, 0x1c0000c, 0x10400006, 0x1cb50e, 0x8c00009,
+    0x800009, 0x8c00012, 0x8c00012, 0x8c00004, 0x25000005, 0x1c00000, 0x9800005, 0x4f400001,
+    0x1cb848, 0x2800015, 0x4f800015, 0x8dcb889, 0x27c00015, 0x8c0000e, 0x280000c, 0x2800013,
+    0x8c00014, 0x4dc00009, 0x4f800005, 0x1c0000e, 0x1cb792, 0x25c0000f, 0x2800009, 0x1400007,
+    0x28000001, 0x1cb8c9, 0x14000018, 0x11c00000, 0x2800004, 0x5000007, 0x1c00013, 0x3e800003,
+    0x14000012, 0x1cb701, 0xd000009, 0xd800008, 0x1c00002, 0x1cb992, 0xd400009, 0x1cb9ce,
+    0x4fc0000d, 0x1400008, 0xd000005, 0x1cb912, 0x25000013, 0xd800012, 0x1cb952, 0xd40000f,
+    0x1cbcd0, 0x14000018, 0x8c00000, 0x1c00005, 0x1cba01, 0xd400015, 0x1c00000, 0x2000002,
+    0x5000006, 0xa000007, 0x1cbd06, 0x8c00001, 0x8c00008, 0xd000005, 0xfc0000e, 0x1cbc4b,
+    0xd000001, 0x8c00015, 0x700000e, 0x8c0000e, 0x1c00000, 0xcc00013, 0x2000002, 0x14000012,
+    0x42800009, 0x1cbacc, 0x1b400004, 0xcc0000f, 0x2000008, 0x14000009, 0x1cbdda, 0x1cbb12,
+    0xd00000f, 0x8c00002, 0x8c00009, 0xd1cbbc1, 0x7c00000, 0x8c00029, 0x1cbc92, 0x1c0000e,
+    0xd000005, 0x1b400013, 0x1400000b, 0x1cbe92, 0x1cbed0, 0x8c0000e, 0x2c400012, 0x1c00004,
+    0x2000008, 0x8c0000f, 0xa000007, 0x25000010, 0x2800006, 0x26400010, 0xd400001, 0x1cbd48,
+    0x5000012, 0x5000012, 0x8c00012, 0xdc00001, 0x1cbc0e, 0xa000009, 0xd800012, 0xedcc012,
+    0x5000001, 0xd00001f, 0x1c00005, 0x8c00001, 0x4d40000e, 0x1cbf09, 0xa00000e, 0x8c00004,
+    0x8c00015, 0x1cbd8f, 0x2000009, 0x8c00009, 0x2000012, 0x1cbe45, 0xd000005, 0x26c0000e,
+    0x1cc053, 0x36c0000e, 0x200000c, 0xf000002, 0xc800005, 0x10400007, 0x5000012, 0x5000006,
+    0x7c00009, 0x1c00013, 0xf800010, 0xd400014, 0xec00005, 0x8c0000b, 0x7c0000f, 0xd00000b,
+    0x1400006, 0x2500000c, 0x8c00002, 0xd00000f, 0x1c0000c, 0x5000014, 0xec00014, 0x8c00015,
+    0x1040001a, 0x7000006, 0x1c00012, 0x1cc0cc, 0x1cbfc9, 0x1400012, 0x1c0000b, 0x1400004,
+    0x8c00010, 0x1c0000e, 0x800005, 0x7c00008, 0x4000000, 0x1dcbb92, 0xd000001, 0xd400010,
+    0x4d80000d, 0x9cc30e, 0x25400001, 0xd400015, 0x500000e, 0x11c00009, 0x251cc1c5, 0x2540000e,
+    0x800007, 0x50000008, 0x800009, 0x1cc352, 0x80000b, 0x80000c, 0x5000006, 0x1cc293,
+    0x8c0000c, 0x1cbf89, 0x8c0000c, 0x1cc3c1, 0x8c00012, 0x1cc492, 0x14000012, 0x8c00005,
+    0x8c00017, 0x1cc395, 0x8c00013, 0x4c800013, 0x1400014, 0x5000004, 0x25800001, 0xd400012,
+    0x8c0000d, 0x8c0000f, 0xd400005, 0x8c0000e, 0xa000005, 0x1cc408, 0x14000007, 0xd40000c,
+    0x14000009, 0x1cc4cb, 0x280000e, 0xd400005, 0xd000005, 0x14000004, 0x14000015, 0x5040000e,
+    0x1cc58b, 0x1cc452, 0xec00012, 0x1cc185, 0x1c00009, 0x8c00005, 0x1c00003, 0x8c00015,
+    0x8c00015, 0x7c0000d, 0x1cc645, 0xd800029, 0xec00013, 0x1cc552, 0x5000014, 0xd00000f,
+    0x26c00006, 0xf800007, 0x1cc845, 0x1400005, 0x1400009, 0x27400013, 0xc800009, 0x26000012,
+    0x11c00000, 0xd800001, 0x80000d, 0x1cc78b, 0x25000007, 0x1cc24b, 0x5000012, 0x8c00001,
+    0x5000009, 0x1c00014, 0x7dcc615, 0x140000e, 0xd400002, 0x500000f, 0x1cc689, 0x2640000f,
+    0xcc00012, 0x1cc90c, 0x8c0000f, 0x5000001, 0x25000013, 0x8c00012, 0x5000002, 0x1cc885,
+    0x1400014, 0x2800006, 0xd40000c, 0x5000009, 0x400013, 0x1cc8d4, 0x2800015, 0x1cc2d5,
+    0xd400012, 0x1cca13, 0x5000005, 0xd1cc805, 0x5000012, 0x1cc5d2, 0x2800018, 0x5000015,
+    0x1400005, 0x500000c, 0x1400006, 0x8c00003, 0x5000014, 0x1cc94f, 0x7c00000, 0x1cc985,
+    0x11400009, 0x1400007, 0x11400007, 0xd800001, 0x1cca41, 0x1400012, 0x5000007, 0xc800002,
+    0x1ccc53, 0xd1ccd01, 0x3b00000e, 0x4cc0000e, 0xcc00006, 0x1cc9c5, 0xd400001, 0x500000e,
+    0x1ccb01, 0x4d40000e, 0xd400005, 0x7000013, 0x1ccb45, 0x1cca93, 0x1cc713, 0x26dccdcc,
+    0xd400015, 0x1ccb88, 0xa00000b, 0x1400014, 0x2000001, 0x141cce52, 0xd40000f, 0xd400009,
+    0x27400013, 0x1400000e, 0x26c00014, 0x800015, 0xf80000d, 0x280000e, 0xa000003, 0x2800004,
+    0x1ccadf, 0x500001f, 0x7000000, 0x5000014, 0x1cce12, 0xec00003, 0x1940000b, 0xec0001f,
+    0x26c0000e, 0x1ccd8e, 0x8c00002, 0x8c00009, 0x8c00009, 0x2800012, 0xd40000c, 0x8c00015,
+    0x2800015, 0x8dcce85, 0x8c0000f, 0xdc0000e, 0x15800012, 0x1ccf8e, 0x8c0000e, 0x1c00000,
+    0x8c00015, 0x1c00000, 0x1ccf0b, 0xd400012, 0x8c0000c, 0x8c00015, 0x25000013, 0x1ccc13,
+    0x5000014, 0x1c00008, 0x8c0001f, 0x7000002, 0x1ccd45, 0x8c00012, 0x1cccce, 0x1cd00e,
+    0x8c00004, 0x7000008, 0x509cd052, 0xddcced2, 0x280000e, 0x700000c, 0x8c00015, 0x2800009,
+    0x8c0000c, 0x8c0000f, 0x1ccf45, 0xd400012, 0x14000008, 0x27400029, 0x1cd0c8, 0x1c00000,
+    0x8c0000e, 0xdc00012, 0x1ccfce, 0x8c00012, 0x1cd081, 0x8c00013, 0x25000001, 0x19400008,
+    0x1cd445, 0x8c00015, 0x1dcd285, 0x2800029, 0x4640000c, 0x1c0000e, 0x1cd14e, 0x14000015,
+    0x7c00007, 0x1cd312, 0x1cd352, 0x1cd105, 0x2500000f, 0x800013, 0x8c0000e, 0x25800014,
+    0x1400000e, 0x1cd1c5, 0x1cd4d4, 0x25c00009, 0x1cd3c5, 0x14000012, 0x100000c, 0x8c00001,
+    0x1cd585, 0x8c00002, 0x1cd412, 0x8c00005, 0x26c00001, 0xd000009, 0xd00000c, 0x4c800013,
+    0x4cc00005, 0x25dcd501, 0x1400000b, 0x500000c, 0x27800001, 0x1cd5c5, 0x400001, 0xd000005,
+    0x1cd205, 0xec00002, 0x1cd60e, 0x8c00004, 0x8c00015, 0xd000003, 0x5000000, 0xd40000c,
+    0xd000017, 0xd40000e, 0xd400012, 0xd800001, 0x8c00009, 0xd400012, 0x1cd792, 0x1cd6c5,
+    0xd400015, 0x1180000e, 0x1cd553, 0xec00014, 0xdc0000c, 0x1cd712, 0x2540000b, 0x4d400013,
+    0x5000012, 0x7c00003, 0xdc00012, 0x25000003, 0x4cc00005, 0x1c00014, 0xd800014, 0x26c00014,
+    0x180000c, 0x1400001, 0x1cd885, 0x1400001, 0x4dc00013, 0x8c00000, 0x1cd9c5, 0x29c00009,
+    0x25400001, 0x140000c, 0x1400004, 0x1000012, 0x5000003, 0x1000005, 0x15cdb08, 0x25000013,
+    0xd000003, 0x1400014, 0x25000005, 0x5000007, 0x13c0000b, 0x26c00005, 0xd000001, 0x1400000e,
+    0xec0000d, 0xd00001a, 0x1cd845, 0x1cda52, 0xd80000e, 0x8c00014, 0xd000009, 0x5000013,
+    0x8c00006, 0x2f000014, 0x1c0000c, 0x1cdac2, 0x5000009, 0x2800013, 0xd00000e, 0x1cdcd0,
+    0x1cdf41, 0x1cdb8e, 0x1ce00e, 0x4cc00014, 0x25400001, 0x1cd812, 0x1cd8d3, 0x1cdbd3,
+    0xd400015, 0xa00001a, 0xd000012, 0xd000012, 0x2800013, 0x2800014, 0x1000002, 0xd000005,
+    0x1c00004, 0x1cd905, 0x1c00006, 0xa000000, 0xd1cdc88, 0xec0000d, 0x8c0000e, 0x400014,
+    0x14000012, 0x30000002, 0xd5cdb43, 0x25400013, 0xa000000, 0x1cddc1, 0x26c00012, 0x1000013,
+    0x1cde89, 0x1cdfc2, 0x14000004, 0x6400017, 0x25000001, 0x1cdd8e, 0x500000d, 0x1ce0d4,
+    0x25000005, 0x1cdd52, 0x1cded3, 0xfc00005, 0x25000009, 0xd400010, 0xd000001, 0x2800010,
+    0xfc0000f, 0x2800012, 0x26c00005, 0xd400029, 0xd40000f, 0x1ce141, 0x27400014, 0x25000005,
+    0x1ce205, 0x4d5ce085, 0x4dc00012, 0x8c00000, 0x27400013, 0x251ce049, 0x25000013, 0xec00005,
+    0xa000015, 0x1ce194, 0x1ce2c5, 0x1ce10f, 0xd5ce24e, 0x8c00009, 0x26dcda92, 0xd00001a,
+    0x26800003, 0x1ce1d5, 0x7000015, 0x2800015, 0x8c0000b, 0x5000001, 0x8c00013, 0x7c00005,
+    0xd40000e, 0x800003, 0x1cde54, 0x800000, 0xcc00000, 0x7c00005, 0x640000b, 0x1c00008,
+    0x6400004, 0x4cc00007, 0xa00000b, 0x1c00006, 0x1c00008, 0x1c00000, 0x800014, 0x7c00005,
+    0x800005, 0x1ce345, 0x7c0000e, 0xd1ce305, 0x500000e, 0x1c00015, 0x50c00013, 0x1ce3d3,
+    0x1c00014, 0x29c00005, 0x2580001a, 0x25c0000f, 0xd400001, 0xd40000e, 0x8c0000e, 0xd400009,
+    0x26800005, 0x12c0000e, 0xd400001, 0x8c00009, 0xa00001a, 0x8c00015, 0xec00013, 0x2800007,
+    0x1ce385, 0xd400014, 0x2800008, 0x1ce60e, 0x4cc00014, 0x6400000, 0x1ce288, 0x7c00006,
+    0x4dc00009, 0xd400001, 0x1ce405, 0x26000012, 0x6400007, 0x1ce5d2, 0x1c0000b, 0x1ce806,
+    0x6400014, 0x1ce694, 0xcc00001, 0xcc00003, 0x7c00014, 0x6400004, 0x640000d, 0xcc0000e,
+    0x6400014, 0x6400004, 0x4d800014, 0xd400012, 0x7c00013, 0xd800012, 0xd400008, 0x4c800014,
+    0x5000002, 0x25000012, 0x1ce541, 0x7c00000, 0x7c00000, 0xdc00012, 0x1ce785, 0xcc00002,
+    0x1400006, 0x1400007, 0x8c00009, 0x1ce649, 0x5000014, 0x140000b, 0x27000002, 0x8c00010,
+    0x7c00003, 0x1ce714, 0x1b400014, 0x1ce845, 0xcc00002, 0x1400013, 0xcc00004, 0xdc0000b,
+    0x10400014, 0x4d40000e, 0x1ce6ce, 0x1ce74e, 0x4cdce9c5, 0x800010, 0x280000c, 0x19400013,
+    0x8c00009, 0x1ce881, 0x26000001, 0x2200000e, 0xcc00012, 0x1ce505, 0x25dce8c1, 0x7c00001,
+    0x8c0000e, 0x2800009, 0x1ce7d3, 0x4d800013, 0x1ceac8, 0xdc0000e, 0x1ce909, 0xd00000f,
+    0x4dc00014, 0x4dc00009, 0x29c0000f, 0x1ce98c, 0xd400003, 0x2fc00009, 0x1cea0c, 0xd400012,
+    0xdc0000d, 0xd40000b, 0x4dc00009, 0x1ceb08, 0x1cea85, 0xa000003, 0x27400015, 0xf80001f,
+    0x27400006, 0x1400007, 0x1400009, 0x7000000, 0xa000001, 0x200000f, 0x700000c, 0xa000004,
+    0x1cea53, 0x27400014, 0x1c00014, 0xa000000, 0x140000d, 0x1ceb45, 0xa000009, 0x51000001,
+    0x1ce945, 0x1cee45, 0x27400001, 0x1cec02, 0x700001a, 0x1c00010, 0x2000000, 0x1ced54,
+    0x1cedc7, 0x33400013, 0x31400014, 0xd40000f, 0x1cefcb, 0x25000009, 0xa000013, 0xd000001,
+    0x1ceb94, 0x1c0000f, 0x7000004, 0x1ced05, 0x1c00006, 0x2000015, 0x1c00008, 0x1cf0d2,
+    0x1400006, 0x25400001, 0x1400003, 0x1cef5a, 0x7000014, 0x5000004, 0x1cebcd, 0xa00000e,
+    0x1400009, 0x6800013, 0x6800014, 0x8c0000f, 0x6800016, 0x26c00013, 0x1cef81, 0x6800006,
+    0x8c00015, 0x1400013, 0x140000d, 0xd800001, 0x7000006, 0x7000005, 0x1c0000d, 0x26c00014,
+    0x1c00010, 0x1cf005, 0xd400001, 0xd40000c, 0x1cf192, 0x1c00014, 0x8c00005, 0x1c00014,
+    0x1cf1c7, 0x1cec48, 0x25000007, 0x27400001, 0x4cc0000b, 0x1cf113, 0x1cf154, 0x8c0000e,
+    0xe80000f, 0xd40000b, 0x2800000, 0x1400012, 0x8c00015, 0x1cf405, 0xd400005, 0xd400001,
+    0x1cf045, 0x780000b, 0x780000e, 0x1cf21a, 0xd800001, 0x4cc00009, 0x27400001, 0x1800012,
+    0x400001, 0x1c00005, 0x6c00009, 0x26c0000e, 0x8dcf309, 0x1cf545, 0x8c0000f, 0x1cf386,
+    0x8c0000e, 0x1c00001, 0x1c00001, 0x800000, 0x8c0000f, 0xd400001, 0x2800014, 0xd40000c,
+    0x1cf353, 0x26800005, 0x2680000f, 0x4dc0000e, 0x1c00009, 0xd400012, 0x8c00012, 0x26800001,
+    0xd400008, 0x6400001, 0xd400014, 0x26c0000e, 0x8c0000d, 0x2800000, 0x380001f, 0x26800009,
+    0x1cf452, 0x800019, 0xd400012, 0x500000f, 0x8c00001, 0x1540002a, 0x5000014, 0x8c0000c,
+    0x8c00000, 0x8c00014, 0x1cf245, 0xd800015, 0x7000005, 0x7000002, 0x1c00005, 0x25000004,
+    0x1c00000, 0xa00000b, 0x14000003, 0x1cf504, 0xd5cf281, 0x1c0002a, 0x2a00000d, 0x14000002,
+    0x4d5cf645, 0xd400010, 0x500000b, 0xdc00003, 0x1cf70e, 0x1c0000d, 0x1cf4d3, 0xd400012,
+    0x1cf48e, 0x1cf5c9, 0x7000017, 0x1c0000b, 0x1cf595, 0x1c0000d, 0x8c0000e, 0x500000e,
+    0x1000014, 0xd400005, 0x4d5cf3d2, 0xd40000d, 0x2c000004, 0x1cf8cc, 0x1cfa45, 0x8c00013,
+    0x4cc0000f, 0x1cf785, 0x2680001f, 0xd40000f, 0x26800010, 0x1cf741, 0x1cf80e, 0x1cf943,
+    0x1c00003, 0x1cf885, 0x1cf852, 0xd400013, 0x1c00004, 0x25000002, 0x7000006, 0x1000007,
+    0xd000008, 0xd000006, 0x1c00002, 0xd40000c, 0x1cfc8e, 0xcc0000c, 0x1c0000e, 0x4d5cfe94,
+    0x1cfb54, 0x251cfb8e, 0x3800013, 0xec00010, 0x30000002, 0x1cfa83, 0x515cfa13, 0x1c00017,
+    0x1cf68c, 0x8c00010, 0x1c0001a, 0x1cf909, 0x1cfc05, 0x2800008, 0x1000000, 0x280000e,
+    0xcdcfbce, 0xdc00008, 0x280000d, 0x26c00014, 0x1cfd12, 0x8c00002, 0x280000d, 0x14000015,
+    0x8c00012, 0x1cfed2, 0x5000005, 0x29400008, 0x8c00009, 0xdc0000e, 0x1cfc41, 0x11cfacc,
+    0x500000d, 0x1d000e, 0x1cff45, 0x8c00009, 0x1000016, 0x1400000e, 0x1cfcce, 0x8c00014,
+    0x140000c, 0x1800004, 0x1cff94, 0x8c00012, 0x140000f, 0x25000005, 0x8c00013, 0x1d0292,
+    0x26000001, 0x4d40000c, 0x1cffd5, 0x800008, 0x27800005, 0x2800008, 0x500000c, 0x1d0453,
+    0x5000002, 0x11800008, 0x25c00003, 0x1d02c5, 0x25000013, 0x26400009, 0x1cff14, 0x11800009,
+    0x51800014, 0x5000001, 0x1d0145, 0x8c0000b, 0x2800000, 0x25c00003, 0x10000001, 0x4c800013,
+    0x8c0000e, 0x1d0093, 0xec00005, 0x1400005, 0x8c0000e, 0x8c00013, 0x8c00002, 0xd400001,
+    0x2740001a, 0x4dc0000e, 0x8c0000e, 0x8c0000c, 0x1d0312, 0x25c00005, 0x1d050e, 0x1d04d2,
+    0x500000e, 0x8c00012, 0x26800001, 0x8c00005, 0x1d0205, 0xd400014, 0x4d800013, 0x4dc00015,
+    0x1c0000d, 0x7c00010, 0x26800009, 0x7c00004, 0xcc00000, 0xd40000c, 0x6400014, 0x1240000b,
+    0xd40000f, 0xd800012, 0x2740000b, 0xd400012, 0x26400001, 0xd400001, 0x26000015, 0x4dc00009,
+    0x1d0645, 0x1c00002, 0x6400003, 0x7000015, 0xd800009, 0xcc00006, 0x7000006, 0xcc00013,
+    0xd40001f, 0x6400003, 0x11c00007, 0x12400005, 0x1c0000d, 0xd800012, 0x7000000, 0x1c00010,
+    0x1d000015, 0xcc00003, 0xcc00000, 0x1c00005, 0xcc00014, 0x6400005, 0x21800004, 0x12400003,
+    0x640000c, 0xd400003, 0x1d06cb, 0x1c00012, 0xcc00016, 0x1c00009, 0x12400015, 0x2a000014,
+    0x1040000b, 0x1d0353, 0x5000005, 0xcc00013, 0x6400014, 0x800014, 0x1d0553, 0x1c00013,
+    0x1d0705, 0xcc00005, 0x10400002, 0x10400001, 0x1d0589, 0x1d0607, 0x1d03c5, 0x1d0a94,
+    0x10400007, 0xcc00012, 0x8c0000b, 0xcc0000c, 0x80000e, 0x26c00012, 0x10400006, 0x7800006,
+    0x800008, 0x780000c, 0x780000c, 0x1040000b, 0x1400009, 0x10400014, 0x1d05d2, 0x1400013,
+    0x10400014, 0x10400003, 0x1400012, 0x10400013, 0x10400014, 0x7c00009, 0x8dd0752, 0xcc00007,
+    0x1d09c3, 0x280000c, 0x80001a, 0x80000f, 0x8c00012, 0x2800010, 0x7c00003, 0x8c0000e,
+    0x1d0692, 0x280000c, 0x1d0a45, 0x800013, 0x7dd0789, 0x1d0895, 0x2800009, 0x1d084c,
+    0xcc0000d, 0xcc0000e, 0x1400013, 0xd400005, 0xc80000f, 0x1d0812, 0xcc00009, 0x4d800008,
+    0x4d40000e, 0x8c00009, 0x1400016, 0x1d08c5, 0x800000, 0x1d0912, 0x25000001, 0x100000c,
+    0xd000005, 0x1c00009, 0xd800005, 0x1000001, 0x7c00012, 0xd80000f, 0xd000015, 0xd40000c,
+    0xd400012, 0x4d800008, 0x800001, 0x1d0a08, 0x1d0954, 0x4dc00014, 0x4cc00009, 0xd800009,
+    0x7c00009, 0x51c00009, 0x780000e, 0x1d0b85, 0xcc0000d, 0x1d0b0e, 0x4d5d0cc5, 0xcc00000,
+    0x7c0000f, 0x4d5d0b52, 0xd000012, 0x4cc0000e, 0x25400012, 0x4dc00012, 0xd400005, 0x7c00018,
+    0x14000009, 0xdc00012, 0x1d0c05, 0x1d0981, 0x7c00005, 0x1d0ace, 0x26c00013, 0x5000000,
+    0xcc0000f, 0xcc00012, 0xcc00013, 0x2800001, 0xd40000f, 0x1d0e08, 0xd00000e, 0xd000001,
+    0x1d0bc1, 0xdc0000d, 0x800014, 0xa000019, 0x1d0c45, 0xdc00009, 0x4cc00014, 0x25800008,
+    0xd000009, 0x5000012, 0x5200000e, 0x800000, 0x2800015, 0xdc00002, 0x1d0d12, 0x1d0fc5,
+    0x5040000e, 0x5000012, 0x1d0dc5, 0xd40000c, 0x1d0e52, 0x1d1114, 0x1d0e85, 0x275d1041,
+    0x25000014, 0x1d1085, 0xd00000e, 0x7c00009, 0x8c0000c, 0x2800008, 0x1d0c9f, 0x8c0001a,
+    0xec00012, 0x1d0d54, 0x8c0000f, 0x5000007, 0x4ddd1153, 0x25000007, 0x780000b, 0x800003,
+    0x14000013, 0x26c0000e, 0x4e400014, 0x25c00013, 0x27400013, 0xd000013, 0xdc00009, 0x1d1213,
+    0x1180000e, 0xdc00012, 0x1400001, 0x1d12ce, 0x400014, 0x4cc00014, 0xd400013, 0x1d1285,
+    0x4b000013, 0x26c00012, 0x8c00014, 0x3400005, 0x800009, 0x31400006, 0x1d1309, 0xa00000b,
+    0x10400013, 0x1d1389, 0xd400001, 0x1d1181, 0x8c00009, 0x500000c, 0x500000d, 0x1d1405,
+    0x8c0000e, 0x27800001, 0x800014, 0x280000e, 0x2800009, 0x1d1345, 0xd400007, 0x2600000c,
+    0x1d13d4, 0xd40000f, 0x280000e, 0x280000c, 0xd400005, 0x2800000e, 0x1400008, 0x4cc00007,
+    0x280000f, 0x1d1254, 0x7c00004, 0x1400006, 0x1d14d5, 0xdc00001, 0x140000d, 0x7c00014,
+    0x140000e, 0x7c00006, 0x10400006, 0x5000019, 0x8c00002, 0xd400005, 0x1d1493, 0x1d1614,
+    0x4ec0000c, 0xdc00012, 0x140000d, 0x80001a, 0x1d1454, 0x280000e, 0x1d1589, 0x1400014,
+    0x1d150e, 0x1400005, 0xec00015, 0x1d100e, 0x25000014, 0x27000003, 0x1d15c5, 0x10c00012,
+    0xdc00002, 0x1400003, 0x1400006, 0x8c00009, 0xdc00006, 0x800009, 0x8c0000c, 0x8c00012,
+    0x8c00009, 0x1d1847, 0x26dd16d4, 0x8c00002, 0x1d1652, 0x27400013, 0x1d1749, 0x8c0000f,
+    0x140000f, 0x1d18c5, 0x1c00002, 0x8c0000d, 0x2800015, 0x27400013, 0xd400012, 0x1d1692,
+    0x1c00008, 0x280000f, 0x8c0000b, 0x1d17c1, 0xd80000d, 0xfc00001, 0x1d178e, 0x1c00005,
+    0x14000012, 0xd400012, 0xe800012, 0x1c00013, 0x8c0000d, 0x251d1a4e, 0x1d1909, 0x1c00017,
+    0x8c00002, 0x8c00012, 0x4c40000c, 0x4d00000e, 0xd000001, 0x14000007, 0x1d1a82, 0x1c00015,
+    0x80001f, 0x8c00014, 0x1d1a0c, 0x8c00012, 0x1d1b41, 0x2800003, 0x25000004, 0x1d1809,
+    0x8c0000c, 0xec00005, 0x1d1bce, 0x500001f, 0x1d1b05, 0x1dd1e4f, 0x1d1d52, 0x1d1b85,
+    0x2800000e, 0x8c00015, 0x1d1f89, 0x1c00029, 0x1c0002a, 0x52400013, 0x28000014, 0x1d1dc5,
+    0x400014, 0xcc00012, 0xcdd1c01, 0x5000013, 0x9d1f43, 0x1d0488, 0x1d20d2, 0x200000f,
+    0xd400005, 0x1d1ecf, 0xa00001f, 0x1d1f05, 0x11800019, 0x15d1fcf, 0x200000f, 0x8c0000d,
+    0x2c000002, 0x1d2081, 0x1d2312, 0x1d2013, 0x8c00012, 0x1d2154, 0x8c0000e, 0x8c00012,
+    0x1d2241, 0x8c0000e, 0x8c0000c, 0x8c00012, 0x8c0000e, 0xdc0000e, 0x8c00010, 0x280000f,
+    0x8c00012, 0x1940000d, 0x2800014, 0xa000029, 0x1d2404, 0x38800002, 0x14000012, 0x8dd204e,
+    0x3000000c, 0x25000001, 0xd40000b, 0x1d2185, 0x25000012, 0xec00014, 0x1d2392, 0xd400012,
+    0xec00009, 0x8c00014, 0x5000015, 0x1d11c6, 0x10000009, 0x1400001, 0xd400005, 0x7c00010,
+    0x1d2444, 0x18c00005, 0x11800009, 0x1400010, 0x1d2592, 0x5000013, 0x5000009, 0x1d21c8,
+    0xd000015, 0x80000d, 0x1d2745, 0x5000012, 0x1d2345, 0x10400013, 0x7c00000, 0x2a000013,
+    0x10400014, 0x6400000, 0x7c00001, 0xcc00017, 0x6400000, 0x105d264e, 0x1040001a, 0x140000f,
+    0xd400012, 0x25c00005, 0xd400009, 0x3cc00001, 0x1d24c5, 0x1d2992, 0x1d2b06, 0x1d250b,
+    0x1400001, 0x6800010, 0x1d2ad2, 0xd400009, 0x27400001, 0x7c00000, 0x25000001, 0x1d2713,
+    0x10400014, 0x1400004, 0x1d2685, 0x15d2846, 0x800007, 0x1400008, 0x1d28d4, 0x25400003,
+    0x140000b, 0x1040000c, 0xd00000f, 0x1d220e, 0x15800000, 0x8c0000d, 0x8c00012, 0x10400012,
+    0x2000010, 0xd000010, 0x1400015, 0x1d2889, 0x1400017, 0x1d2809, 0x1400005, 0x5000012,
+    0x280000c, 0x80000b, 0x1d2b4e, 0x1d29c9, 0x7c00005, 0xd400008, 0xd400012, 0x5000013,
+    0xd400009, 0x1d2905, 0x1d294e, 0x8c0000d, 0x5000005, 0x5000005, 0x25000029, 0x26c0000d,
+    0x1d2bce, 0x11800003, 0x500000f, 0x1d2c8e, 0x1d2e12, 0x251d2c53, 0x8c00001, 0x140000b,
+    0x800006, 0x1400010, 0x52800010, 0x8c00001, 0x800005, 0x1d2d07, 0x1400013, 0xa000019,
+    0x8c00012, 0x1040000f, 0xcc00015, 0x7c00003, 0x1040000c, 0x10400013, 0x11400009, 0xd400009,
+    0x25400001, 0x27400015, 0x1d2e94, 0x7c00004, 0x14000009, 0xd000012, 0x500000c, 0x1400017,
+    0x1d2ec8, 0x8c0000d, 0x25c00013, 0x2000013, 0x1b40000b, 0x4cc00009, 0x8c00000, 0x8c00012,
+    0xd400003, 0xcc00002, 0x1d2f4f, 0x1400014, 0x7c00005, 0xd400003, 0x8c00007, 0x1d2d52,
+    0x25400009, 0x8c0000c, 0xcc0000b, 0x1d2d8e, 0xcc0000d, 0x11800005, 0xcc0000f, 0x27400010,
+    0xcc00004, 0x5000005, 0x4000009, 0x500000b, 0x1180000d, 0xcc0000c, 0xcc00014, 0x500000f,
+    0x800006, 0x25000006, 0x5000007, 0x1d2f85, 0x26c00013, 0x1b400014, 0x7000015, 0x1d2c01,
+    0xcc00014, 0x1dd2a0c, 0xd800005, 0x1000000c, 0x800009, 0x1b400012, 0xcc0001a, 0xcc00014,
+    0x1d2b93, 0xd800001, 0x2540000c, 0x1d3253, 0x2a1d3014, 0x8c00018, 0x25400010, 0x8c00004,
+    0x1d2fc5, 0x140000c, 0x1d30c7, 0x1400001, 0x3f800003, 0x1d3592, 0x1d3652, 0x1d3215,
+    0xd00001a, 0xcc0000e, 0x800008, 0x6c00000, 0x8c00001, 0xd000005, 0xcc00013, 0x10400004,
+    0x1d3185, 0x9d3046, 0x2000007, 0x800008, 0x10400013, 0x1180000f, 0x80000b, 0x1040000c,
+    0x1d31cd, 0x71d330e, 0xd40000f, 0x500000c, 0x1b40000f, 0x10400012, 0x15d3513, 0x105d3554,
+    0x10400015, 0x2000004, 0x10400017, 0x1400001, 0x2000007, 0x1d34d2, 0x8c00006, 0xd400001,
+    0x1d35c7, 0x1180000c, 0x1d3614, 0x1400009, 0x8c0000c, 0x1d36c5, 0x1400014, 0x1d3788,
+    0x8c00001, 0x8c00004, 0x1d3692, 0x1d3742, 0x5000003, 0x8c00002, 0x1d390d, 0x1c00016,
+    0xd800009, 0x51d340f, 0xd400012, 0x1c0000f, 0x700000d, 0x10c00007, 0x8c00009, 0x8c0000e,
+    0x200000d, 0x1d37ce, 0x1d3701, 0x2000001, 0x1d38ce, 0x1d3812, 0x1d3845, 0x1d3a05,
+    0x1d3992, 0xd400008, 0x2000015, 0x1180000c, 0x2800004, 0x2500000e, 0x2000001, 0x14000013,
+    0x1340000f, 0x1d3a52, 0x1d39cf, 0x1d3a85, 0xcc0000f, 0x1c00029, 0x2000003, 0x1d3bc9,
+    0x1d3ac1, 0x2000010, 0xd400010, 0x1d3c12, 0x2500000c, 0x400005, 0x1d3cd3, 0x200002a,
+    0x1d389f, 0x4400005, 0x200000f, 0xdc00014, 0x500000e, 0x1c00014, 0x4cc00014, 0x1d3954,
+    0x4400000, 0x8c00009, 0x800008, 0x2500002a, 0x2740000c, 0x8c0000c, 0x7c00000, 0xd40000e,
+    0x26c00001, 0x7c00005, 0x500000c, 0x5000003, 0xd400010, 0x2500000f, 0x8c00015, 0x7c00009,
+    0x80000a, 0x8c00002, 0x1d400d, 0x9d3b0d, 0x400004, 0x1d3f45, 0x8c00000, 0xd800001,
+    0x1b400012, 0x1d3e45, 0x4c9d4044, 0x1d3ecb, 0xf80000c, 0x1d3c87, 0x800008, 0x5000006,
+    0x5000005, 0xd000014, 0x1400006, 0x7c00000, 0x7c00009, 0x80000f, 0x5000003, 0x7c00009,
+    0x15d3e89, 0x1d3d52, 0x80000c, 0x5000012, 0xd400015, 0x5000012, 0x1400005, 0x1c00003,
+    0x400002, 0x400003, 0x5000014, 0x5000005, 0x25000006, 0x5000007, 0xa80000c, 0x400014,
+    0x1c0000c, 0x79d3e08, 0x1d3fce, 0x52c00000, 0x12c0000b, 0x52c00002, 0x1d3c52, 0x1d3d93,
+    0x15d4513, 0x4d400015, 0x1400007, 0x7000008, 0x2a000001, 0x1400002, 0x9d3dc5, 0x1d4709,
+    0x1d410d, 0x80000e, 0x4dc00009, 0x7c00000, 0x7c00001, 0x1d4845, 0x1d43d3, 0x5000012,
+    0x25c00005, 0x7000012, 0x10000001, 0x800010, 0x1d4592, 0x1c00000, 0x8c00010, 0x1c00002,
+    0xcc00015, 0xd400008, 0x3f800009, 0x51d44c6, 0x1d47c5, 0x10400008, 0x1d41d3, 0x1d4154,
+    0x9d428b, 0x80000c, 0x800014, 0x1d45ce, 0x3b80000f, 0x7dd435a, 0xd400005, 0x1d4412,
+    0x15d4693, 0x800014, 0x1d46c2, 0x1c00016, 0x1c00017, 0x2500000f, 0x25000010, 0x1b40000f,
+    0x1d4748, 0x2000002, 0x26c00014, 0x1d4602, 0x1d448c, 0x5300000e, 0x1d478e, 0x26c0000c,
+    0x1c00009, 0x200001f, 0x5000009, 0x1d454c, 0x1c0000d, 0x6c00000, 0x800012, 0x1400002,
+    0xa000012, 0x800004, 0x1c00013, 0x1c00012, 0x1c0000a, 0x5000012, 0x10400009, 0x1c00005,
+    0x140000b, 0x140000c, 0x1c00007, 0x5000007, 0x1d4802, 0x5000019, 0xdc00013, 0x1d488e,
+    0x5000002, 0x1400014, 0x7000008, 0x1d48d2, 0x1d490c, 0x1d498e, 0x25000001, 0xd40000c,
+    0x1d4a15, 0x1d4a52, 0x500000b, 0x21d4949, 0x1d4ad5, 0xd400012, 0x1c0000e, 0x5000012,
+    0x4cc00008, 0x1d4c0e, 0x1d4a88, 0x1d4b85, 0x5000009, 0x1d4d09, 0xd40000c, 0x1d49c9,
+    0x500000e, 0xdc00002, 0x25000005, 0x25000004, 0x8c0000f, 0x1d4ccf, 0x1d4ed2, 0x15d4bc4,
+    0x37c00012, 0x5000005, 0x4cc00007, 0x53400013, 0x7000015, 0x25400010, 0x1b400012, 0x1d4c83,
+    0x1d4f12, 0x8c00008, 0xcc00005, 0x5000014, 0x140001a, 0x1d4f50, 0xf80000c, 0x5000006,
+    0x11800001, 0x8c0000b, 0x8c00014, 0x8c0000d, 0x1d5041, 0x1d4b05, 0x7c00007, 0x500000f,
+    0x8c00012, 0x1d4f85, 0x5000013, 0xf9d4d4e, 0x1400012, 0x2800009, 0x1d5001, 0xd400014,
+    0x500001a, 0x2500000b, 0x1d4e05, 0x8c00012, 0x1d5412, 0xd000005, 0x7c00001, 0x14000001,
+    0x53800015, 0x8c00014, 0x7800012, 0x7c0000c, 0x2740000f, 0xc80000e, 0x8c0000b, 0x80000c,
+    0x8dd4fd3, 0x1d5192, 0x14000007, 0x1d5492, 0x8c00014, 0x1d50d2, 0x8c00006, 0x1d524c,
+    0x1d5441, 0x1d57cf, 0x2000009, 0x8c00015, 0xf800013, 0x1d59ce, 0x8c0000c, 0x8c00004,
+    0x1d5115, 0x1d5642, 0xcc00007, 0x1d560d, 0x2000019, 0x12c00009, 0x1d53c7, 0x40000c,
+    0x8c00012, 0x5000012, 0xdc0000b, 0x800010, 0x5000015, 0x1d568e, 0x5000014, 0x400010,
+    0x8c00003, 0x5d56d2, 0x4b800013, 0x400014, 0x1d54d5, 0x27400012, 0x1d5509, 0xdc00002,
+    0x1d5881, 0x40000c, 0x2800000, 0xcdd55ce, 0x1d5945, 0x2a00000e, 0xd000005, 0x1d5712,
+    0x1d5313, 0x4e400004, 0xf80000d, 0x1d51c8, 0x1b40000c, 0xcc00014, 0xd400001, 0x1d5812,
+    0xcc00006, 0x80000b, 0x800008, 0x1400009, 0x1d5781, 0xd400008, 0x1400014, 0x1d5754,
+    0xcc00007, 0x1d5915, 0x5000003, 0x2800013, 0x1d5a08, 0x8c00005, 0x8c00005, 0x280000d,
+    0x30000002, 0x26c00012, 0x8c00004, 0x8c00009, 0x1d5c94, 0xd000010, 0x4cc00013, 0x26c00005,
+    0x5040000e, 0xec0000b, 0xf800013, 0x2500000d, 0x1d5ace, 0x280000d, 0x1400000d, 0x25c00013,
+    0x1d5b85, 0xd400013, 0x8c00003, 0x8c00015, 0x5000009, 0x8c00012, 0x500000b, 0x1d584e,
+    0x1d5c4e, 0xd800005, 0x8c00005, 0x11800012, 0x4d5d5d4e, 0x5000012, 0x8c00009, 0x2800009,
+    0xd000001, 0x8c0000f, 0x7c00012, 0x1400001, 0x27800010, 0x2800013, 0x8c0000c, 0x4d5d5a8e,
+    0x1940000e, 0x42800001, 0x8c00013, 0xd800012, 0x1d5b43, 0x1d5993, 0x29c00009, 0x1d5d8c,
+    0x1d5f93, 0x140000f, 0x4cc00014, 0x1d5e05, 0x10000012, 0x8c0000e, 0x1d5fc3, 0xd000005,
+    0x1040000e, 0x4ec00007, 0x800014, 0x8c0000e, 0x1d6005, 0x8c0000c, 0x1d5e49, 0x17400014,
+    0x39000009, 0x1d5ec5, 0xd40000c, 0x400012, 0x80000f, 0x25000001, 0x8c0000f, 0x5000005,
+    0x26800001, 0x4cc00015, 0x1d5cd3, 0xd400012, 0x8c00012, 0xd400012, 0x26800001, 0xd400008,
+    0x1000012, 0x400002, 0x1d6085, 0x4d40000e, 0x53c0000e, 0x1d61c5, 0x1d5f09, 0x1d6045,
+    0x800004, 0x25c0000c, 0x27400013, 0x1000007, 0xd40000f, 0xd000015, 0xd000015, 0x26000012,
+    0xd400001, 0x1d6581, 0x26000015, 0x1d5f54, 0x1d6105, 0x1d634f, 0x980000b, 0x1d62d3,
+    0x1c0000d, 0x1d6412, 0x25000014, 0x1000017, 0xcc00012, 0x14000012, 0x8c00013, 0x1d63c5,
+    0x25400001, 0xd5d6252, 0x27c00003, 0x6400006, 0x800000, 0x8c00002, 0x800009, 0x1d6745,
+    0x26c00012, 0x1d65cc, 0x25000005, 0x800000, 0x80000f, 0x1c00000, 0xd000001, 0x8c0000c,
+    0x1d6605, 0x1d648e, 0x54000005, 0x4d400014, 0x6400017, 0x30000002, 0x8c00003, 0x640001a,
+    0x8c00015, 0xcc00001, 0x1d6192, 0x2800007, 0xa1d6509, 0x1d6801, 0xcc00006, 0xcdd638c,
+    0x26400001, 0x1d6685, 0xcc00001, 0x31000013, 0xcc0000c, 0x1d6552, 0x1d6645, 0x1d694e,
+    0x1d6449, 0x10400009, 0x4d400009, 0x2780000f, 0x1400007, 0x27400013, 0x27400012, 0x1d68cc,
+    0x1d66c1, 0x140000b, 0x33c00006, 0xd000005, 0xd40000d, 0x27400013, 0x8c0000c, 0x14000013,
+    0xd000009, 0x8c0000e, 0x26c00005, 0x1400000e, 0x8c00013, 0xd400001, 0x280000e, 0x1d6c08,
+    0xd400010, 0x1d69c5, 0xd000003, 0x2800012, 0x8c0000e, 0x8c0000c, 0x11c00004, 0xcc00003,
+    0x54400013, 0x2180000e, 0x1d6c4d, 0x7c00013, 0x1d6985, 0x25c0000f, 0x4d400014, 0xd800005,
+    0x1d6b88, 0x7c00007, 0x1c00012, 0x1d6854, 0xac00013, 0xcc00013, 0x1d6bc3, 0x280000e,
+    0xd000012, 0x500002a, 0x280000e, 0xd40001f, 0x500000e, 0x1c00013, 0xd000015, 0x11800012,
+    0x8c00010, 0x1d6c81, 0x1d6d49, 0x1d6d05, 0x1d6a88, 0x1d6b45, 0xd400008, 0xd800014,
+    0x7c00004, 0x2000000, 0x1c00014, 0x1d6b08, 0x7c00003, 0xcc00003, 0x27800001, 0xcc00000,
+    0x26000012, 0x4e400013, 0x7c00003, 0xd000015, 0xcc00005, 0x25c00006, 0xcc00007, 0x5000005,
+    0x2a000012, 0x800014, 0x4e40000b, 0x1d6cc1, 0x1c0000d, 0x1c0000e, 0xcc00014, 0x1d6f45,
+    0x35c00005, 0x10400001, 0x1d6d8e, 0x7800012, 0x800005, 0x8c0000c, 0x800010, 0x10400013,
+    0x500000b, 0x1d6a05, 0x280000c, 0x5000014, 0x1d6e52, 0x7c0000c, 0x80000f, 0x10400014,
+    0x800013, 0x7c00014, 0x12c00005, 0x1d6ed2, 0x1400001, 0x140000b, 0x51d7054, 0x1d7194,
+    0x1400013, 0x140000c, 0x5000014, 0x1400009, 0xd400005, 0x1400007, 0x1400009, 0x2a000014,
+    0x1d6886, 0x1400009, 0x16400009, 0xcc00006, 0x140000e, 0x140000b, 0x1040000c, 0x4a000009,
+    0xcc00003, 0x1400013, 0xc80000e, 0x5000008, 0x1d7208, 0x280000d, 0x500002a, 0x2800008,
+    0xcc00013, 0x1d7085, 0x5000013, 0x1d7241, 0x1040001a, 0x4dc0000e, 0x100000c, 0x1d7145,
+    0x140000b, 0x140000c, 0x27400004, 0x1d72c9, 0xd40000c, 0x4d400008, 0x2800000, 0xd40000f,
+    0xd400001, 0x14000012, 0x26000012, 0xd400001, 0x1d7312, 0xd400015, 0x1d7289, 0x1d7414,
+    0x400005, 0x1d7105, 0x8c00012, 0x1c00003, 0x1d7513, 0x1c00012, 0xd800009, 0x26800010,
+    0x26c00005, 0x1d6fdf, 0x26800015, 0xd400014, 0x5000006, 0x8c00003, 0xd00000f, 0x1000001,
+    0x25000012, 0xd000001, 0x1000004, 0x26800001, 0x800000, 0x1000009, 0x500000c, 0x1d75c5,
+    0x8c00012, 0x1c00015, 0x1d7685, 0x1000015, 0x29c00005, 0x1000009, 0x1d71c8, 0xd00000c,
+    0x15800000, 0xd000005, 0x1d7485, 0xf800014, 0xd400012, 0x1d7353, 0x5000005, 0x26800015,
+    0x1c00014, 0x2800009, 0x1d7549, 0x31000013, 0x280000c, 0x5240000d, 0x1d738e, 0x1d7012,
+    0x4ddd744e, 0x5000009, 0x4cc00014, 0x4d800014, 0x1400009, 0x1000005, 0x25dd7912, 0x27400013,
+    0xd000008, 0x140000e, 0x1d7605, 0x2f00000d, 0xd000001, 0x1000012, 0x1d74d3, 0x51d76c3,
+    0xd000001, 0x25000016, 0xd000001, 0x1d7753, 0xd400014, 0x2800000, 0x2800015, 0x980000b,
+    0x25000009, 0x1c0000d, 0x1d798e, 0x25000010, 0xd400009, 0x1d7b49, 0x1d79d2, 0x251d7a54,
+    0x19400003, 0x1c00007, 0x8c00016, 0x26c00012, 0x1d7bc1, 0xd00001a, 0x1d7b92, 0x1d7813,
+    0x280000b, 0x2800000c, 0x280000d, 0x5000004, 0x1d7a81, 0x1d7c0e, 0x30000002, 0x2800012,
+    0x1d784d, 0x2800014, 0x1d7895, 0x1d7cc1, 0x8c0000d, 0xd400012, 0xd00000b, 0x1c00006,
+    0xec0000c, 0x25800008, 0x1d7ace, 0x1d7d8e, 0x1d764c, 0x29c00005, 0x4a800012, 0xd400012,
+    0x8c00002, 0x40001f, 0xd00000f, 0x29c00012, 0x1d7f15, 0xd00001a, 0x1d7b01, 0x1000014,
+    0x1c00017, 0x4cdd7f88, 0x1d7e45, 0xec00002, 0x5000001, 0xd800009, 0x8c00010, 0x25800014,
+    0xd00001f, 0x1d820e, 0x26dd8001, 0x400010, 0xd400005, 0x1d81cc, 0x549d7e85, 0xd800009,
+    0xa000005, 0xd000008, 0x4dc00014, 0xec00012, 0x25000001, 0x25000005, 0xd000005, 0x8c00000,
+    0xdc00014, 0x8c0000c, 0xd400012, 0x31400013, 0xd400001, 0x1c00004, 0x1d7ed5, 0x280000f,
+    0x640000c, 0x1c00015, 0x1d8145, 0x26800003, 0x11400002, 0x700000b, 0xcc00003, 0xa000000,
+    0x1000006, 0x7c00005, 0x2800013, 0x8c00014, 0x7c00005, 0x6400002, 0x7c00005, 0x1d8045,
+    0x6400008, 0x6c0000e, 0x1c00006, 0x54c0001a, 0x4c800014, 0x1c00008, 0x4d400005, 0x1d8314,
+    0xd400012, 0xf000014, 0x1c0000c, 0x11400000, 0xd000009, 0x1d8105, 0x1d8085, 0xd400001,
+    0x640000c, 0x1d8584, 0xd400012, 0x1c00014, 0x1d840d, 0x2800013, 0x25c00005, 0xd400009,
+    0x26000001, 0x7c00005, 0xd80000c, 0x1c00005, 0x1d878c, 0x6400002, 0xcc00014, 0xd800008,
+    0x640000d, 0x27400006, 0x1d8513, 0x25000007, 0x25c00003, 0x6c00007, 0x1d8553, 0xd800010,
+    0x1c0000d, 0x6400005, 0x6400003, 0xd400014, 0x6c0000e, 0x1d82c6, 0x1d8353, 0x6400008,
+    0x640000e, 0xd00000f, 0xd400001, 0x1c00000, 0x7c0000b, 0x7c0000e, 0x1d8385, 0xcdd8713,
+    0x6400014, 0x1d8745, 0xcc00002, 0x7c00014, 0x1d849a, 0xd40000c, 0x1b400001, 0x5000002,
+    0x25000007, 0x780000c, 0xd80000c, 0x26000012, 0xcc0000c, 0xcc0000d, 0xcc00014, 0xcc00014,
+    0x7800013, 0x7c00000, 0xcc00001, 0x3bc00012, 0xcc00014, 0x1b400010, 0x2500000c, 0x7c00005,
+    0x1b400001, 0x40000005, 0x1d87c7, 0x43400009, 0x8c00003, 0x4fc00005, 0x7dd84d2, 0x7c0000e,
+    0x780000b, 0x25000003, 0x1b400015, 0x4cc00014, 0x7dd85ce, 0x7c00008, 0x1d8609, 0x1d844e,
+    0x7c00012, 0x7dd880c, 0x1d8654, 0x4dc00009, 0xcc00013, 0x7c0000e, 0x7c00006, 0x251d86d2,
+    0x1d8883, 0xcc00004, 0x400015, 0x8c00019, 0x7c0000c, 0x7c0000d, 0x2800012, 0x2800005,
+    0xd9d8841, 0x27400013, 0x7c00012, 0x1400000, 0x1d8945, 0x1400013, 0x800000, 0xcc00012,
+    0x1d88c9, 0xd400008, 0x1d89c8, 0x4d5d8905, 0x1d8a41, 0x1d8ad2, 0x1d898f, 0x1d8a85,
+    0xd1d8bc5, 0xd800001, 0x100000c, 0xd400012, 0x27400013, 0x1d8b47, 0x400005, 0x1400014,
+    0x4cc00013, 0x2680000f, 0xd400010, 0xd000008, 0x1d8685, 0xd800012, 0xd800014, 0x2800012,
+    0xd400010, 0x8c0000c, 0x2580000c, 0x2500000e, 0x1d8c05, 0xd400001, 0x8c0000f, 0xd80000f,
+    0x1d8b0e, 0x1d8cc5, 0xd400012, 0x1d8b93, 0x7400012, 0x1d8c89, 0x1d8e01, 0x8c00015,
+    0x800005, 0x1d8e85, 0x1d8f05, 0xd400001, 0x8c0000d, 0x40001f, 0x26000012, 0xd80000b,
+    0x1d8e45, 0xd400015, 0xd400012, 0x8c0000c, 0xd400010, 0x8c0000e, 0x400003, 0x48800012,
+    0xd400014, 0x2800002, 0xd400012, 0xd800005, 0x26000012, 0x27400013, 0x400000, 0xd000001,
+    0xd400001, 0x8c0000d, 0x26c00005, 0x9d9185, 0xd800001, 0xd400008, 0x400009, 0x8c00012,
+    0x1d8dc5, 0x400009, 0x7c00012, 0x400002, 0xd5d8f41, 0x400014, 0xd400003, 0xd5d8fd2,
+    0x9d9005, 0xd400001, 0x8c00000, 0x25400005, 0x1d90c1, 0x1d904c, 0x100000d, 0x26400014,
+    0x1d9109, 0x2f400005, 0x5000005, 0x1d9310, 0x400013, 0x5000009, 0x1d9293, 0x700000f,
+    0x1d9095, 0x8c00014, 0x26400012, 0x140000f, 0xd000005, 0x8c0000e, 0x14000009, 0x7c00013,
+    0x8c00004, 0xd800001, 0x1180000d, 0x4d5d9605, 0x8c00015, 0x8c00005, 0x8c0000c, 0x1d9152,
+    0x1d9341, 0x53400013, 0x1d938e, 0x27400001, 0x1d93c5, 0x1400000e, 0x140000d, 0x1d8f81,
+    0xdc00003, 0x1d94c5, 0x1d92d4, 0x2800001, 0xec00015, 0x1400014, 0x2800006, 0x27400010,
+    0x8c0000b, 0x1d9741, 0x7c0000d, 0x8c0000e, 0xd800015, 0x1d9642, 0x2800013, 0x2800014,
+    0x1dd9781, 0x1d9581, 0xd400012, 0x4d5d9554, 0x25000001, 0x1d9413, 0x1300000f, 0x1d9bc5,
+    0xd000005, 0x4ddd970e, 0x1c00006, 0xd000001, 0x400012, 0x1d96d2, 0x25400002, 0x36c00014,
+    0x8c00004, 0x8c00010, 0x1d9c4e, 0xd00000d, 0x400005, 0xd000012, 0x400013, 0x4d400012,
+    0x30000002, 0x1d9843, 0x6400017, 0x1d950c, 0x7000010, 0x7c0001a, 0x4a800012, 0x1d99c9,
+    0x8c00014, 0x1d8c52, 0x8c0000c, 0x4a800002, 0x1d9ace, 0xd000008, 0x1d9901, 0x2800006,
+    0x1d97d2, 0x1d9a92, 0x1d98c5, 0xa000003, 0x1d9d8c, 0x4d400009, 0x5400000c, 0xd000012,
+    0x8c00007, 0x2800010, 0x1d9dd4, 0x275d9c09, 0x7c00005, 0x2800014, 0x37c0001f, 0xc800014,
+    0x800005, 0x5000013, 0x26800001, 0x4e40000e, 0x26800017, 0x4d400013, 0x25800012, 0x500000b,
+    0xd400012, 0x500000d, 0x26800001, 0x500000c, 0x5000010, 0x5200000e, 0x8c0000c, 0x15800013,
+    0x1d9b85, 0x5000003, 0xd400009, 0x4d400010, 0x25400005, 0x1d9f04, 0xd400012, 0x7c00004,
+    0x7c0000e, 0x400014, 0x11c00000, 0x1d9c81, 0x8c0000e, 0x9d9b53, 0xd400005, 0x1d9d05,
+    0x1400004, 0xcc00009, 0x2800012, 0x26000001, 0x1400013, 0xd000001, 0xcc0000d, 0x2800005,
+    0x8c0000e, 0x800007, 0x7c00000, 0x140001a, 0x26c00014, 0x8c0000b, 0x1d9d54, 0x8c00012,
+    0x1d9b0e, 0x1d9e85, 0x1180000f, 0x7c00009, 0x8c0001a, 0x1d9f89, 0x1da110, 0x1d9e15,
+    0x1da248, 0x1400017, 0xcc00003, 0x800014, 0xcc0001a, 0x1d9e53, 0x15800012, 0x1d9f52,
+    0x7c0000e, 0x7c00004, 0xd000005, 0xd400001, 0x25000013, 0x7c00004, 0x7c00012, 0x27000014,
+    0x7c00000, 0xcc00014, 0x7c00009, 0x5000007, 0x2800007, 0xd800006, 0x1da284, 0x1da205,
+    0x1da2c5, 0x1da343, 0x500000e, 0x1da006, 0x2800001, 0xd80000f, 0x10400006, 0x25800001,
+    0x4d400005, 0x2480000f, 0x2800001, 0x7c0001a, 0x8c00001, 0x1da453, 0x1da312, 0x7c0000d,
+    0x1da145, 0x14000009, 0x7000019, 0xd000012, 0x8c00015, 0x14000010, 0x1da385, 0x8c00000,
+    0x1da0ce, 0xd400012, 0x8c00003, 0x8c00004, 0x8c00010, 0x8c0000b, 0x5000014, 0x27400014,
+    0x5500000e, 0xd000001, 0x8c00009, 0x1da50e, 0x8c00012, 0x1da185, 0x5000012, 0x8c00015,
+    0x400005, 0x5000013, 0x7800008, 0xcc00000, 0xcc0000b, 0x1da682, 0x7c00003, 0x4dc00009,
+    0x1da6d3, 0x7c00006, 0x1b400007, 0x10400001, 0x400001, 0x400015, 0x1da607, 0x4d400013,
+    0x4d400014, 0x1da54e, 0x8c0000b, 0x1da7cc, 0x8c0000d, 0x1400014, 0xcc00014, 0x1da5d4,
+    0x1da794, 0x1da888, 0x275da853, 0x1d9ed4, 0x1da481, 0x14000003, 0x8c00017, 0x19400006,
+    0xcc00005, 0x8c0001a, 0x8c0000e, 0x8c0000e, 0xcc00009, 0x5000001, 0x8c00010, 0x14000012,
+    0x1da94e, 0x8c00014, 0xcc0000f, 0x8c00002, 0x3000000c, 0xd400001, 0x1da9c9, 0x1400013,
+    0x1da648, 0xd400005, 0x1040000b, 0x80000c, 0x1da8c1, 0x1da749, 0xcc00014, 0x8c0000e,
+    0x800008, 0x800004, 0x1da809, 0x10400005, 0xd400010, 0x2a000012, 0x7c00005, 0x1da984,
+    0x800008, 0x7800014, 0x1da909, 0x1b400001, 0x1daace, 0x2500000b, 0xf800007, 0xf800012,
+    0x800005, 0x800014, 0x10400006, 0x10400007, 0x800008, 0x1dab0e, 0x1400007, 0x1040000b,
+    0x1040000c, 0x8c0000c, 0x15dabce, 0x1dac8e, 0x800003, 0x2800005, 0x7c00009, 0x7c00003,
+    0x80000f, 0x500000d, 0x40000e, 0x10400017, 0x51dae85, 0x7c00009, 0x80001a, 0x1dab8e,
+    0x1dab42, 0x80000c, 0x8c00007, 0x10400012, 0x800006, 0x10400014, 0x1dad92, 0x800012,
+    0x80001f, 0x400003, 0x1da70c, 0x800014, 0x15c0000e, 0x800029, 0xf800015, 0x400009,
+    0x800007, 0x1dac41, 0x5dad4c, 0xf800015, 0x1daf14, 0x1dac05, 0x5000005, 0x5000012,
+    0x1dae52, 0x2800009, 0x80000c, 0x7c00000, 0x780000b, 0xcc0000f, 0xf800009, 0x4d40000f,
+    0x7c00005, 0x1dad05, 0x800014, 0x1db254, 0x1400006, 0x1db048, 0x12c00005, 0x10400005,
+    0x3f800008, 0x800006, 0x10400007, 0x7c0001a, 0x1db1c7, 0x10400009, 0x800019, 0x1daa4c,
+    0x1040000d, 0x140000e, 0x5000005, 0x1dadc1, 0x800010, 0x3f800005, 0x10400013, 0x1db005,
+    0x1dafc6, 0x1db314, 0xcc00012, 0x1dae09, 0x1db284, 0x1daf85, 0x1daa86, 0x1db407,
+    0x15daec8, 0x800005, 0x1b400019, 0x2a000013, 0x1db44c, 0xcc00004, 0x1db48e, 0xcc00009,
+    0x500000d, 0x8c00012, 0x4a000003, 0x1db213, 0x1db7c5, 0x4d5db741, 0xd400008, 0x1db097,
+    0x1db712, 0x7c00013, 0x1db51a, 0x2800015, 0x500000b, 0x4a00000e, 0x1db841, 0x7ddb34e,
+    0xd400009, 0xf80000c, 0x8c00002, 0x10400013, 0x1b400013, 0x51db654, 0x51db795, 0x51db603,
+    0xf800013, 0x1dbad2, 0xcc00006, 0x80000c, 0x1db895, 0x5000009, 0x8c00008, 0x80000b,
+    0x1db5c9, 0x255db9c5, 0x8c0000c, 0x8c0000c, 0x5540000e, 0x1db8ce, 0x1db69f, 0xf800013,
+    0x14000009, 0x4d1db812, 0x8c00004, 0x280000c, 0x14000002, 0x5580000e, 0x8c00000, 0x800012,
+    0x8c00012, 0x1db92a, 0xd000005, 0x14000009, 0xec0000e, 0x26000001, 0x1dbb45, 0x8c0000d,
+    0x1dba0e, 0x1db945, 0x1dbb88, 0x400002, 0x14000012, 0x26800003, 0x8c00014, 0x8c00009,
+    0x26ddbc13, 0x400008, 0x7c00012, 0x2680000f, 0xd400010, 0x4cc00005, 0xd400015, 0x1db98e,
+    0xd400014, 0x800005, 0x5000010, 0x7800002, 0x7800001, 0xd000012, 0xd000013, 0x7c00006,
+    0x1400014, 0x4cc00005, 0x7c00009, 0x2c000002, 0x500000b, 0x7c0000c, 0x25000001, 0x1dbc4e,
+    0x7c0000d, 0x780000e, 0x1dbb05, 0x1dbed2, 0x8c0000e, 0x55c00014, 0x25000009, 0x8ddbc8c,
+    0x2c000012, 0x7c00018, 0x26800010, 0xd400012, 0xcc00005, 0x8c00009, 0x10400006, 0xf80000e,
+    0x8c00015, 0x10400007, 0x1dbf47, 0x800004, 0x800015, 0xf800015, 0x5000003, 0xf800003,
+    0x8c00012, 0xf80000b, 0xdc0000f, 0x10400013, 0x800014, 0x10400013, 0x2800005, 0x1dbcd2,
+    0xdc00009, 0xd000005, 0xf800014, 0x1dbd52, 0x1dbf85, 0xd000009, 0x1dc241, 0x8c0000f,
+    0x26800009, 0xd5dba52, 0xcc00015, 0x14c0000f, 0x2780000f, 0x7800013, 0xd40000e, 0x1dbfd0,
+    0x1dc213, 0x26c0001f, 0x7000000, 0x1dbdd4, 0x8c00008, 0xd00000f, 0x25000010, 0xd400012,
+    0x8c00014, 0xec00005, 0x8c0000f, 0x1dc009, 0x1dc054, 0x8c00009, 0xec0000e, 0x27400014,
+    0x2a800009, 0x1400000e, 0xdc00009, 0x1dba8e, 0x1dc292, 0xd800001, 0x2500000d, 0x1400004,
+    0x8c00015, 0x8c00005, 0x1400000e, 0x26400003, 0xd000001, 0xd800005, 0x25000004, 0x30000002,
+    0xd00001a, 0x2c000002, 0xdc00003, 0x1dc305, 0x8c0000d, 0x2800000e, 0x280000d, 0x8c00004,
+    0x1dc349, 0x400009, 0x8c0000b, 0xdc00029, 0xd800014, 0xcddc38e, 0x2800002a, 0x2800012,
+    0xdc00007, 0x1dc4d2, 0x4cc00013, 0x8c00010, 0xdc00002, 0x7c00003, 0xd80000d, 0x7c00001,
+    0x1dc805, 0x1dc081, 0x1dc3d5, 0x7c00005, 0x2800013, 0x780000b, 0x7c00000, 0x22000001,
+    0x7c00008, 0x22000003, 0xd000005, 0x3a800005, 0x1dc552, 0x1dc5c3, 0x7c00000, 0xd000009,
+    0x1dc7c5, 0x2540000b, 0x7c00018, 0x1dc489, 0xfc00001, 0x8c0000e, 0x3a800010, 0x800009,
+    0x4cc00013, 0x7c00019, 0x1dc454, 0x1dc60e, 0x119dc652, 0x1dc685, 0x8c00014, 0x251dca14,
+    0x2200001a, 0x31000005, 0x2800007, 0x1dc6ce, 0x36c00002, 0xd400005, 0x2800001, 0x1dca52,
+    0x2800015, 0x8c0000e, 0xcddc785, 0x8c00010, 0xd5dc954, 0x28000009, 0x1400012, 0x8c00014,
+    0x8c00015, 0xd000017, 0x2c000013, 0xf80000d, 0xec0000f, 0x140000e, 0x10400007, 0x1400008,
+    0x8c0000f, 0xec00015, 0x8c00012, 0x1400003, 0x5000001, 0x2800013, 0x8c00019, 0x1dcb54,
+    0x14000010, 0x8c00004, 0x2800016, 0xec00006, 0x8c00001, 0x8c00012, 0x19400009, 0xd000010,
+    0x800002, 0x3000000c, 0xf800014, 0x25000014, 0x28000009, 0x8c00010, 0x1dcd52, 0x1dca92,
+    0x251dcc53, 0xd00001a, 0x8c0000f, 0x1dc981, 0xd800001, 0x140000e, 0xd400001, 0x10400013,
+    0x1dcac5, 0x1b40000d, 0x1400014, 0xcc00007, 0x1dccc9, 0xc800015, 0x5000004, 0x280000e,
+    0x800015, 0x1dcb08, 0xd400007, 0x2800001, 0x1dce05, 0x4cc00007, 0x1400000, 0x280000c,
+    0x2800009, 0xd400005, 0x1400014, 0x5000014, 0x1dcd97, 0x1dcc85, 0x2800000f, 0x15dcdda,
+    0x2a000007, 0x51dce52, 0x1400005, 0xd400001, 0x1400014, 0x5000014, 0x10400013, 0x56000005,
+    0x4eddd046, 0x10400001, 0x4ec00008, 0x10400006, 0x800014, 0x1dce94, 0x3b80000c, 0x800013,
+    0x1dced2, 0x80000f, 0xc800014, 0x280000d, 0x10000009, 0x280000e, 0x800013, 0x3b000015,
+    0x5000005, 0xfc0002a, 0xec00005, 0x11800001, 0x2800013, 0x140000d, 0x1dcf12, 0x1dcf53,
+    0xd400012, 0xcc00013, 0x800002, 0x1400013, 0x1400010, 0x7c00002, 0x1dcfc5, 0x1dd102,
+    0x8c00012, 0x1dd0c6, 0x1dcf9a, 0x140000e, 0x800002, 0x15dd154, 0xd800008, 0x27400013,
+    0xec00005, 0x4d5dd201, 0x5640000e, 0x1dd00e, 0x8c00012, 0xd40000e, 0x7c00000, 0x51dd092,
+    0x25000013, 0x10400004, 0x1dd185, 0x15dd1c6, 0x3b800007, 0x4ec00008, 0x10400004, 0x8c0000e,
+    0x1dd24b, 0x1dd30e, 0xdc00009, 0x1dd2c9, 0xdc00012, 0x11800012, 0x8c0000b, 0x15dd292,
+    0x1dd349, 0x7c00013, 0x4cc00007, 0x14000010, 0xd80000f, 0x1400013, 0x8c00012, 0x8c0001a,
+    0x14000015, 0x8c00015, 0x8c00001, 0xf800008, 0x1dd513, 0x800003, 0x1dcd15, 0x1dd385,
+    0x10400013, 0x800014, 0x140000e, 0x800005, 0x800006, 0x10400006, 0x1400013, 0x1040000d,
+    0x2f800008, 0xd400001, 0x800009, 0x1040000c, 0x8c00009, 0x10400004, 0x10400014, 0x800006,
+    0x5000005, 0x4dddd3ce, 0x5000008, 0xd400005, 0x7c00004, 0x1dd405, 0x5000001, 0x500000f,
+    0x140000b, 0x1040001a, 0x800002, 0x5000014, 0x10400013, 0xd400003, 0x1c00000, 0x200000b,
+    0x8c00010, 0xd000005, 0xd800009, 0x500000e, 0x2000013, 0x80000d, 0x8c0000c, 0x1dd549,
+    0x8c0000e, 0x1dd585, 0x1dd5c5, 0x8c00013, 0x1c0000e, 0x800006, 0xcc0000b, 0x800007,
+    0x1dd492, 0x1dd453, 0x11c00000, 0x8c00012, 0x1dd742, 0x200001a, 0x2000018, 0xd00000e,
+    0x1dd78e, 0x5000001, 0x8c00008, 0x2000002, 0x119dd692, 0x1dd6c1, 0x1dd64c, 0x25800012,
+    0xd000005, 0x1dd90c, 0x1dd4da, 0x14000006, 0x14000007, 0x7c0001a, 0x1dd614, 0xd00001f,
+    0x8c00012, 0x1400000c, 0x8c0000d, 0x1c00012, 0x1dd710, 0x2000001, 0x1c00015, 0xdc00012,
+    0x1dd80e, 0xec00014, 0x1dd7d2, 0x2000013, 0xd800012, 0x26c0000e, 0x5000013, 0x500001f,
+    0x4d400014, 0x1dd892, 0xd5dd84d, 0x4d400008, 0x1c00000, 0x2000006, 0x8c00002, 0x1dd981,
+    0x1c00004, 0x1c00000, 0x4dc00009, 0x2d400005, 0x1dd9cd, 0x500001a, 0x1ddcc9, 0x1dd8c9,
+    0x2000007, 0x8c00012, 0x1c0000e, 0x4d40000c, 0x1dda52, 0xd80000f, 0x500001f, 0x2800005,
+    0x1ddbd2, 0xd00000e, 0x8c00012, 0x26c0000e, 0x15800001, 0x7c0000e, 0x8c0000e, 0xd00000c,
+    0xec00015, 0xd00000e, 0x8c00009, 0x2800001, 0x700001f, 0x1dd95f, 0x4000000f, 0xd800001,
+    0x26dddd8e, 0x14000009, 0x26c0000e, 0x14000007, 0x2800014, 0xd800008, 0x5040000e, 0x8c0000b,
+    0x8c0000d, 0x1dda0e, 0x4cc00001, 0x26c0000c, 0x1dde08, 0x26000014, 0x25000001, 0x5000005,
+    0xcc00010, 0x8c00015, 0x5000006, 0x25000007, 0x2a000014, 0x1ddb01, 0xd000009, 0x56800001,
+    0x28000009, 0x79de005, 0x8c00004, 0x4f000013, 0x1de28e, 0x1ddc49, 0x1de041, 0x4c800007,
+    0x80000c, 0x9ddfcd, 0x1de08e, 0x1de314, 0x280002a, 0x1de1c5, 0x1de192, 0x1400007,
+    0x800008, 0x27400013, 0x1de205, 0x1de2d7, 0xa00000d, 0x1040000d, 0x1400007, 0x1400003,
+    0x800012, 0x80000f, 0x19400003, 0x8c00012, 0x5000001, 0x1de388, 0x1de452, 0xd40000f,
+    0x8c0000d, 0x2800003, 0x40000c, 0x1400014, 0x26c0000e, 0x1400006, 0x1de16a, 0x2800002,
+    0x25400003, 0x4d800013, 0xd400004, 0x400015, 0x2800015, 0xd000012, 0x5000015, 0x5000012,
+    0x5000015, 0xd800001, 0x40000c, 0xd5de54e, 0x27400010, 0x1de3c5, 0x1400000, 0xd000005,
+    0x27400001, 0x400014, 0xd40000f, 0x1400010, 0x7c00003, 0x12c00005, 0x8c00003, 0x40000f,
+    0x2a00000b, 0x800010, 0x27800001, 0x1de585, 0x5000012, 0x2800015, 0x1de485, 0x4e400013,
+    0x1de414, 0x1400013, 0x1de4c5, 0x1400014, 0x1400014, 0x800014, 0x80000f, 0x56c00001,
+    0x7c00014, 0x1de793, 0xcc0000f, 0xd000010, 0x4d40000e, 0xd800005, 0xf80000e, 0x5000006,
+    0x5000002, 0x5000015, 0xcc00006, 0x29400008, 0xdc00007, 0x8c00002, 0x36c00002, 0xd00001f,
+    0x1400013, 0x30000003, 0xd800005, 0x500000d, 0x5000013, 0x57000012, 0x5000015, 0x8c00029,
+    0x2800014, 0x2800009, 0x8c00007, 0x1de683, 0x8c00010, 0x1de7c5, 0x1de701, 0x1de60f,
+    0xd5de912, 0x1400005, 0x1400004, 0x1400014, 0x1400007, 0x1400013, 0x800013, 0x1de50f,
+    0xd400010, 0x800013, 0x27400003, 0x800005, 0x1de814, 0x1de885, 0xd000005, 0x1de746,
+    0x10400014, 0x1400008, 0x800001, 0x33c00013, 0x1de84b, 0x140000c, 0x1040000c, 0x1de985,
+    0xc80000d, 0x4c800014, 0xd400001, 0x1de6d4, 0x27400013, 0x8c0000e, 0x1de945, 0x25000013,
+    0x2800012, 0x575deb8e, 0x1de8c9, 0x4c800013, 0xd40000c, 0x25000013, 0x25000012, 0x1000000,
+    0x4e5de9cf, 0x180000e, 0x4d40000e, 0x26400012, 0x7000000, 0x8c00002, 0x4c800002, 0x8c00010,
+    0x269deb01, 0x25000009, 0x14000013, 0x19400008, 0x1c00001, 0x1dea45, 0x1c0000d, 0x800000,
+    0xd800008, 0x1dea0e, 0x8c0000e, 0x2600000c, 0x1000014, 0x1dea92, 0xd80000c, 0x1000015,
+    0x1c00005, 0x1c0000d, 0x25400001, 0x400001, 0x1deac1, 0x46400013, 0x1000012, 0x8c00015,
+    0x1dec05, 0x1deb45, 0x1000000, 0x1000008, 0xd400006, 0x3b000001, 0x8c0000e, 0x2800005,
+    0xa000007, 0x800005, 0x1c0001f, 0x1dec85, 0x1c0002a, 0x5dec49, 0x800000, 0x1c0000f,
+    0x8c00000, 0x8c0000e, 0x251decd3, 0xd400009, 0x1ded52, 0x2680000f, 0x33c00004, 0x26c00005,
+    0x1c00005, 0x1dedd3, 0xd00000b, 0x57800005, 0xdc00003, 0xd000015, 0x8c0000e, 0x25000009,
+    0x5000007, 0x1000013, 0x1df101, 0xd000012, 0x1df2cc, 0x1c00017, 0x2800000d, 0x1ded89,
+    0x2c000002, 0x980000b, 0x1df1ce, 0x1def01, 0x1400000e, 0xd400001, 0xdc00015, 0x1dee45,
+    0x14000012, 0x8c0000d, 0xd00000e, 0x25000001, 0x4dddee8e, 0x1defc5, 0x8c0000e, 0x25000005,
+    0x1dee12, 0xd000009, 0x30000002, 0x2540000b, 0x1df605, 0x8c00015, 0x1df405, 0x1df301,
+    0x1df19f, 0x1df289, 0x800000, 0x1c00001, 0x1df254, 0x1df3c5, 0x1c00006, 0x1000007,
+    0xd000008, 0x8c0000c, 0xd00001a, 0x1df145, 0x100000c, 0xd40000f, 0x1c00015, 0x1df642,
+    0x1df041, 0x1400004, 0xd400001, 0x1000013, 0x1df545, 0x80000f, 0x1df4c5, 0x1c00017,
+    0x400000, 0xd400007, 0x1c0001a, 0x19400002, 0xd000001, 0x1df345, 0x1c0000e, 0x1df6c3,
+    0x6400013, 0x16800009, 0x1df5c5, 0x251df453, 0x1df385, 0x280000c, 0x27400013, 0x4d400013,
+    0x1000009, 0x4e40000b, 0x1000005, 0x1ddf484, 0x2740000f, 0x7c00000, 0x400014, 0xd80000f,
+    0x400006, 0x7c00007, 0xd400001, 0xd400012, 0x1000015, 0x1c00005, 0x7c00014, 0xd000013,
+    0x800003, 0x1000014, 0x80000e, 0x7c00000, 0x12400001, 0x4cc00007, 0x25000013, 0xd400001,
+    0x21800008, 0x1c0000d, 0x800014, 0x1c0001a, 0x57400014, 0x2600000c, 0xcc0000b, 0x251df805,
+    0x4d40000c, 0x1c00014, 0x8c0000d, 0x31000005, 0x4d400001, 0x5000005, 0xd400001, 0x1df745,
+    0x1df705, 0x8c0000c, 0x1df781, 0x8c00012, 0x1df841, 0x1c00009, 0x7c00013, 0xd000015,
+    0x4dc00009, 0xd40000c, 0x6400013, 0x1c0000d, 0x8c0002a, 0x640000b, 0x640000c, 0xd400012,
+    0x57c0000f, 0x1c00000, 0x6400003, 0x7c00009, 0x581df7c5, 0x7c00006, 0x6400005, 0x6400008,
+    0xcc00008, 0x1c00015, 0xa000008, 0x640000d, 0x1c0000d, 0x2a000014, 0x8c00009, 0x1c0000e,
+    0x2600001f, 0x8c00004, 0x1dfa13, 0x8c00006, 0x8c00004, 0x80000c, 0x1c00015, 0x10400007,
+    0x8c00005, 0x800006, 0x800007, 0x1dfb0e, 0x8c00012, 0x7800014, 0x80000b, 0x80000c,
+    0x8c0000c, 0x8c0000c, 0x1df8c5, 0x80000c, 0x10400014, 0x1df68e, 0x800013, 0x280000c,
+    0x280000c, 0x1df50f, 0x800017, 0x50c00014, 0x8c00010, 0x800012, 0x800003, 0x7c0000c,
+    0x8c0000e, 0x800014, 0x800014, 0x1400012, 0x1400013, 0x8c00004, 0x5000007, 0xd800005,
+    0x80000d, 0x1400014, 0x140000e, 0xd000009, 0x2a000001, 0x800012, 0xdc00001, 0x1400001,
+    0x4e400013, 0x9dfb54, 0x2800005, 0x1df9c6, 0x1400007, 0x10400008, 0xd400005, 0x2740001a,
+    0x4cc0000e, 0x5000007, 0x26800005, 0x1400009, 0x1df945, 0x500000e, 0xcc00006, 0x25c00013,
+    0x500000e, 0xc80000e, 0xd000015, 0xd400001, 0x1df905, 0x800013, 0x5000013, 0xd40000c,
+    0xf800015, 0x4dc0000e, 0xd400009, 0x2800012, 0xd000001, 0x1400013, 0x8c00009, 0x800013,
+    0x1dfa85, 0x4d800014, 0xd80000f, 0xd40000c, 0x251dfa45, 0xd400012, 0x800029, 0x25c00003,
+    0x25400012, 0x1dfb88, 0xd400012, 0x980000e, 0x7000000, 0x8c00013, 0xa00000c, 0xfc00001,
+    0x8c00000, 0x4d400013, 0x800005, 0xa00000e, 0xd400010, 0x800012, 0x8c00014, 0x8c0000f,
+    0x1dfd14, 0x8c00002, 0x14000009, 0xa000000, 0x26c00013, 0x8c0000e, 0x27400014, 0x26800001,
+    0x5000004, 0x8c0000f, 0x280000e, 0xd5dfc01, 0x2000006, 0x8c00012, 0x8c00006, 0x1dfbc5,
+    0x1dfac5, 0xd40000c, 0x500000e, 0x1dfc49, 0x1c00017, 0x8c00012, 0x8c0000d, 0x400009,
+    0x2800014, 0x2800015, 0x1c00000, 0x1dff92, 0x26000012, 0x1c00001, 0x4c800013, 0x1400000e,
+    0x27000002, 0x800005, 0x1dfe8e, 0x26800017, 0x100000d, 0x26c00008, 0x7c00009, 0x14000009,
+    0x280000d, 0x15800002, 0x8c0000c, 0x1dfd85, 0x1e008e, 0x8c0000e, 0xd40000b, 0xec00001,
+    0x2800009, 0x1dff01, 0x8c00013, 0x4640000c, 0x280000c, 0x2800005, 0xd000014, 0xd800009,
+    0x585dff41, 0x1dffc5, 0x1dfdd4, 0x1e0109, 0x1dfd45, 0xd00000c, 0x2000000, 0xd400008,
+    0x1e0009, 0xd40000f, 0x1e00d2, 0x1e0045, 0x1e0292, 0x2800015, 0x1c00000, 0x26c0000e,
+    0x11400000, 0x26000012, 0x1000002, 0x1e0303, 0x1c00004, 0x11800009, 0x1c00006, 0x1c00007,
+    0x26000012, 0x4dde02d3, 0x1c0000f, 0x800014, 0x1c0000c, 0xd400012, 0x25c00003, 0x1e034e,
+    0x44800001, 0x1e0381, 0x1c00012, 0x1000013, 0x1e0413, 0x1e0485, 0x10400013, 0x1c00017,
+    0x7800014, 0x1e0209, 0x1c0001a, 0x800004, 0x16400001, 0x5000001, 0x1e0501, 0x4d400009,
+    0x140000d, 0xcc00009, 0x1e04c5, 0xd000005, 0xdc00002, 0x1180000b, 0x1e014e, 0xd000009,
+    0x5000005, 0x7000000, 0xf800009, 0x1e03c5, 0x1400013, 0x7c0000f, 0x140000d, 0x1b40000f,
+    0x10400006, 0x16400009, 0x25c00015, 0x5880000e, 0x10000009, 0xd800001, 0x7c00000, 0x5000013,
+    0x800013, 0x1e0445, 0xd000001, 0x10400013, 0x1e0746, 0x1e0687, 0x15e06c8, 0x800003,
+    0x10400009, 0xd80000e, 0x79e084c, 0x15800005, 0x780000e, 0x800003, 0x4ec00010, 0x14000002,
+    0x1e0554, 0x1e060e, 0x1e0594, 0x4cc00013, 0x4ec00013, 0x1e05d4, 0x280000d, 0x80000e,
+    0xec00005, 0x2800013, 0x25c00001, 0x25c00009, 0x25400005, 0x1e080c, 0x27400010, 0x25de0641,
+    0xdc00013, 0x800000, 0x8c00009, 0x1e08c5, 0x1e0a85, 0x9e0704, 0xcde0785, 0x8c00006,
+    0x1c00012, 0xd400001, 0x8c00009, 0x1c00000, 0x700000b, 0x1e07d4, 0x8c00012, 0x8c00015,
+    0x1e0883, 0x27400013, 0x1e0905, 0x400006, 0x1e0953, 0x1c00014, 0x800015, 0xd80000f,
+    0x5000009, 0x14000009, 0x1c0000b, 0x1e09d3, 0x1e0a4d, 0x500000e, 0x29400004, 0x280000e,
+    0x1e0a13, 0xcde0994, 0x5000013, 0xa000013, 0xa000014, 0x1c00019, 0x1e0ac5, 0x14000004,
+    0x2800000e, 0x1e0c01, 0x1e0d45, 0x400009, 0x1e0c41, 0x1000019, 0x55400014, 0x1e114f,
+    0x1e0e0b, 0x400010, 0x1e0e4e, 0xd40000d, 0x1c00006, 0x1e0b52, 0x1e0b15, 0x1e0c8c,
+    0x1e0b95, 0x100000b, 0x1e0f0c, 0x8c00007, 0x1c0000e, 0x1e1445, 0x1e0dc1, 0xd00001a,
+    0x1e0d12, 0x8c00010, 0x8c0000f, 0x8c00009, 0x8c00010, 0x6de1017, 0x1c0001f, 0x30000013,
+    0x1c0001a, 0x8c00015, 0x30000002, 0x26000003, 0x100000f, 0x11400001, 0x800001, 0x800012,
+    0x5000014, 0x1e1049, 0x1c00005, 0x800001, 0x8c0000c, 0x1e1589, 0x1e108e, 0x1e1285,
+    0x1e16c3, 0x5e120c, 0x1e1112, 0x1c00009, 0x80000f, 0x1e1241, 0x80000c, 0xd000012,
+    0x1e13c5, 0x125e1345, 0xcc00000, 0x400001, 0x800012, 0xcc00001, 0xd800009, 0x80002a,
+    0x5000009, 0x1e1385, 0xd40000f, 0x100000c, 0xd40000f, 0x1400001, 0x9800010, 0x1e1485,
+    0x1c0000f, 0x1e1405, 0x9800014, 0xe80000f, 0x8c0000c, 0xd400009, 0x251e1314, 0x5000004,
+    0xa00000b, 0x1e154f, 0xd40001f, 0x140000f, 0x25c00012, 0x4d400013, 0x1400012, 0x1e178e,
+    0x8c00013, 0x1e17c5, 0x500000d, 0x5000013, 0x800013, 0x8c00005, 0xec00009, 0x25000001,
+    0x140000c, 0x2800000, 0x1e151f, 0x800009, 0x4cc00007, 0x8c00014, 0x25000007, 0x1e1a54,
+    0x8c00001, 0x1e1645, 0x1400001, 0x53800001, 0x4cc00010, 0x1e1905, 0x1e1705, 0x5000005,
+    0x26800003, 0x4cc00013, 0x1e1852, 0xd800001, 0x140000b, 0x500000c, 0x1e1745, 0x8c00005,
+    0x5000012, 0x15800005, 0x1000015, 0x1e1813, 0xd400010, 0x27400013, 0x4cc00013, 0x4cc00014,
+    0x5380000f, 0x5000012, 0x8c00006, 0x1e18c1, 0x8c00008, 0x8c0000c, 0x800000, 0x800001,
+    0xdc00014, 0x1e1a88, 0x1c0000c, 0x1e1985, 0x8c00010, 0x5000009, 0xd000005, 0x8c00013,
+    0x1e19c5, 0x8c0000c, 0x1c00014, 0x8c00001, 0x27400005, 0x25000013, 0x1c00010, 0x4d800009,
+    0x4f80000e, 0x7c00005, 0x1c00014, 0x1000015, 0x2800012, 0x8c00015, 0x7c00000, 0x5000004,
+    0x1c0001a, 0x1400004, 0x25400005, 0xd00001a, 0x1400010, 0x8c00013, 0x5000003, 0x8c0000e,
+    0x15800012, 0x4d000002, 0x2800005, 0x80000b, 0x11800001, 0x1e1b45, 0xc800013, 0x7c00005,
+    0x7c00005, 0x140000d, 0x8c00012, 0xd000012, 0x800014, 0x7c00015, 0xd00000c, 0x8c00002,
+    0x1e1bc6, 0xcc0000d, 0x1e1a05, 0x1400008, 0xd400001, 0x1400003, 0x7c00000, 0xd800001,
+    0x5000014, 0x1400005, 0x1e1ac4, 0x1e1ec1, 0x800005, 0x1400013, 0x800002, 0x140000d,
+    0x1e0bd3, 0x10400004, 0x14000013, 0xcc00006, 0x1e1c97, 0x8de1dd3, 0x1400006, 0x140001a,
+    0x7c00000, 0xd400001, 0x1e1e14, 0xcc00002, 0x5000001, 0x8de1e45, 0x1e1d06, 0x1e1fc7,
+    0x1400013, 0x8c00012, 0x21400009, 0x8c00015, 0x2500000d, 0x1e1f0d, 0x1e1cce, 0x58c00014,
+    0x12c00005, 0x1400001, 0x7c00001, 0x1400006, 0x1e1d94, 0x1e1f49, 0x1400014, 0x1400003,
+    0x5000014, 0x10400006, 0x1e2013, 0x1400004, 0xcc00014, 0x5000005, 0x1400014, 0x1040000c,
+    0x5000005, 0x25000013, 0x25000013, 0xd800009, 0x1e1e85, 0x8c00005, 0x26800001, 0x8c00012,
+    0x2800005, 0x8c00005, 0x1400013, 0x8c0000e, 0x280000e, 0x1040001a, 0xd00000d, 0xd40000e,
+    0x1180000e, 0x2800005, 0x5000001, 0x5000005, 0x2a000002, 0x26c0000f, 0x8c00012, 0x7c0000c,
+    0x800010, 0x800012, 0x1400001, 0xd00000f, 0x25000013, 0x4d400013, 0x25800012, 0x7c00005,
+    0x1e1f89, 0x7c00007, 0xcc00010, 0x26c0000d, 0x1dc84d, 0x7c0000b, 0x8c00014, 0x8c00005,
+    0x26c00012, 0x8c00014, 0x4d400013, 0x1400009, 0x800006, 0x800007, 0x800008, 0x8c0000c,
+    0x1e214c, 0x80000b, 0x80000c, 0x1e0cd4, 0x800003, 0x7c00009, 0x7c0000c, 0x1400007,
+    0x8c00005, 0x800013, 0x10400012, 0x575e2042, 0x7800014, 0x800017, 0x7c00001, 0x2800006,
+    0x7c00003, 0x1e20c8, 0x1e2454, 0x2800010, 0x2800009, 0x7c00008, 0x7de2189, 0x800014,
+    0x1e23c3, 0x7c0000c, 0x1e210d, 0xcc0000e, 0x800013, 0x1e2414, 0x280000d, 0x1e2212,
+    0x4f800015, 0x280000c, 0x8c00004, 0x8c00007, 0x59000000, 0x1400013, 0xcc00005, 0x1400001,
+    0x27400004, 0x500000b, 0xf80000f, 0x5000014, 0x1400007, 0x4dc00015, 0x7c00015, 0x1400013,
+    0xd000009, 0x1e24d0, 0x1e2587, 0x140000e, 0x2a000014, 0xf80002a, 0x1e2481, 0x4cc0000f,
+    0x10400013, 0x2a00000b, 0x15e2614, 0x1e2786, 0x7800007, 0x7c00013, 0x1e2313, 0x1e2294,
+    0x1e26cb, 0xcc00009, 0x8de2514, 0x1dcbce, 0x7c00005, 0x280000d, 0xcc00004, 0x2740000c,
+    0x1e2713, 0xcc00007, 0x5000003, 0x3f800009, 0x5000013, 0x500000c, 0xd400008, 0x5000015,
+    0x5000009, 0x14000005, 0x3000000c, 0x8c00009, 0x11800008, 0x1e2392, 0x27800001, 0x1e2541,
+    0xd000010, 0x2c000002, 0x275e27c5, 0x1400000, 0x4dc00009, 0x8c00009, 0x8c00029, 0x26800009,
+    0x8c00009, 0x2000005, 0x1e2853, 0x1e2645, 0xd400008, 0x4dc0000e, 0x1400000e, 0x27400012,
+    0x26400001, 0x1e2743, 0x26800003, 0x500000e, 0x1e2805, 0x5380000f, 0x1e2994, 0x800005,
+    0x1e2892, 0x1400009, 0x2800013, 0x36c00007, 0x2800015, 0x36c00006, 0x2680000f, 0x27800010,
+    0x8c0000c, 0x4ec00008, 0x3cc00005, 0x261e22d4, 0x1400013, 0x8c00003, 0x4d5e2952, 0x8c00010,
+    0x4d40000c, 0x19400012, 0x1e28c1, 0x595e2905, 0x8c0000c, 0x7800012, 0x400005, 0x15400001,
+    0x800009, 0x1e2a41, 0x25000013, 0x8c00004, 0x5000003, 0x25000005, 0x8c0000c, 0x8c00009,
+    0x1e29c5, 0x26400005, 0x8c00000, 0x1e2ad3, 0x8c00002, 0x8c00000, 0x2500000d, 0xec00014,
+    0x8c00006, 0x8c00007, 0xa000010, 0xe800005, 0x1e2a94, 0x8c0000b, 0xd00000f, 0x800009,
+    0xd400007, 0x25c00005, 0x8c00010, 0x1c00014, 0xdde2b0b, 0x1e2c13, 0x8c00014, 0x8c0000e,
+    0x8c00016, 0x8c00017, 0x180000c, 0x2800018, 0xd400005, 0xec00014, 0x8c00015, 0x1e2a12,
+    0x8c00012, 0x8c00014, 0x2400014, 0x8c00015, 0x800012, 0x1e2b85, 0x800005, 0x1000001,
+    0x400001, 0x27400004, 0xd5e2bc8, 0xd400012, 0xd80000c, 0x1e2d43, 0x1e2cc5, 0x7000007,
+    0x30000002, 0x1e2c52, 0x1000012, 0xd800001, 0x1000009, 0x26c00012, 0xd40000e, 0x1e2c85,
+    0x780000c, 0x1c00017, 0xd400010, 0xd800009, 0x8c0000e, 0xd800014, 0x1e2b52, 0xd400015,
+    0xcc00005, 0xd80000f, 0xd000005, 0x1e2d92, 0xd800012, 0x1c0001f, 0x1c00004, 0xd400001,
+    0x4d400001, 0x25c00009, 0x1c0000f, 0xd000003, 0x25400005, 0xd000010, 0x500000f, 0x1040000c,
+    0x4c800005, 0x5000013, 0x8c0000e, 0x1e2e85, 0x1e2d05, 0x280000c, 0x1e2dc5, 0x1e30c4,
+    0x1e2e05, 0x11400014, 0x1e2e4e, 0x4cc00014, 0x1e3085, 0x8c0000b, 0x1c00000, 0x1c0000d,
+    0x1e3145, 0x14000015, 0x8c00002, 0x1800013, 0x8c00012, 0x100000c, 0x4cc00014, 0xd400005,
+    0x11400015, 0x1e2f45, 0x1e31c7, 0x4dc0000e, 0x1e3241, 0xd40000e, 0x8c0000d, 0x1e3445,
+    0xd000005, 0x2800000e, 0x500000b, 0xcde3201, 0x1e331f, 0xd000012, 0x2800013, 0x1e32c5,
+    0xd000015, 0xd40000f, 0x59800013, 0x30000002, 0x1e3295, 0x1e2f0c, 0x4cc00014, 0x5000004,
+    0x1c0000e, 0x4e400013, 0x26c00012, 0x1e34c5, 0x8c0000c, 0x1e3193, 0x7000012, 0x1e2fce,
+    0xcc00008, 0x1e350e, 0xe9e3601, 0x1e3392, 0xd40000f, 0xd00000d, 0x1e3405, 0xdc00012,
+    0x140000f, 0x5000005, 0x25c00013, 0x1e3489, 0x1e3354, 0x1e3645, 0xd400005, 0x8c00000,
+    0x2780000f, 0xd400010, 0xd000012, 0x5000005, 0x2800000f, 0xd400014, 0x1e35c5, 0x8c0000c,
+    0x27400013, 0xd400009, 0x1400000e, 0x8c0000e, 0x4dde3988, 0x26c00013, 0x8c00012, 0xd80000f,
+    0x1e3a0f, 0xd400003, 0xd400012, 0x8c00006, 0x9e3685, 0x1c0000f, 0xd400001, 0x4c80000b,
+    0x28000006, 0x1000005, 0x4dc00009, 0x1e3b48, 0x1e2ece, 0x5000015, 0x29c00001, 0x4dde38d2,
+    0x8c00005, 0x1e3741, 0xd400015, 0x25000005, 0x1000015, 0x1e3785, 0xd000003, 0x140000e,
+    0x27400013, 0x10400013, 0x140000f, 0x1400014, 0xdc00014, 0x10000012, 0x1e3909, 0xd800001,
+    0x140001a, 0x56800001, 0x4cc00013, 0x8c00005, 0xd00000c, 0x1e3c05, 0x1400002, 0x31400014,
+    0xd000003, 0x29c00017, 0xcc00009, 0x5000001, 0x1400008, 0xd80001a, 0x4dc0000c, 0x27400013,
+    0x1e3b09, 0x1e3c41, 0x1e3954, 0x5000009, 0x1400000c, 0x1e3a45, 0xd000001, 0x10400013,
+    0x1400014, 0x2f000014, 0x26c00005, 0x8c00012, 0x25000001, 0x8c00012, 0x8c0000b, 0xd40000f,
+    0x26000001, 0xd40000e, 0x1e3a85, 0xd000008, 0xdc00006, 0x8c00012, 0xd000005, 0x1e39c5,
+    0x10400005, 0x1400013, 0x25800015, 0xd400009, 0x1400006, 0x2800013, 0x5000009, 0x27400005,
+    0x1e3dd2, 0xd400012, 0x1e3d8d, 0xf80000e, 0x1e4014, 0xcc0000e, 0x5000012, 0x34c00005,
+    0xf800013, 0x2a000005, 0x1400009, 0x8c00008, 0x800004, 0x800014, 0x80000f, 0x7c00008,
+    0x7c00009, 0x800014, 0x5000012, 0x7c0000c, 0x5000007, 0x1e3e87, 0x10400001, 0x1580001f,
+    0xcc00014, 0x1400013, 0x140000e, 0x1400001, 0xd000005, 0x1400014, 0x4d40000e, 0x1400013,
+    0x10400002, 0x500000f, 0x15e3f14, 0x1e3b85, 0x10400006, 0x10400007, 0x1e410e, 0x59c00009,
+    0x11800001, 0x1040000b, 0x1040000c, 0x5000015, 0x1e3d05, 0x51e3f85, 0x1e3ec1, 0x26800010,
+    0x1e3e45, 0x10400013, 0x10400014, 0x5a000012, 0x1e42c5, 0x1e3e1f, 0x19400006, 0x280000e,
+    0x7000000, 0xdc00015, 0x1e4054, 0x25c00001, 0x1e4085, 0x26c00005, 0x4dc0000c, 0x1e000016,
+    0x4d800014, 0x26c00013, 0xd40000c, 0x26800003, 0x1e41c5, 0x8c00012, 0x1e4145, 0x1e3fce,
+    0x1e4205, 0x5000002, 0xd80002a, 0x1400001, 0x500000e, 0x8c00012, 0x5040000c, 0xd000001,
+    0xd800005, 0x8c0000d, 0x25400001, 0x100000b, 0x8c00012, 0x8c0000f, 0x1e44d3, 0x1e4514,
+    0x8c00002, 0xd00000d, 0x17400017, 0xd00000c, 0x8c00004, 0xd400008, 0x2800012, 0xd000009,
+    0x800000, 0x8c00014, 0x5000000, 0x8c00004, 0x1e418e, 0x29c00012, 0x2800014, 0xd800010,
+    0x1e45d2, 0x4d400013, 0xdc00014, 0x13c00009, 0x800019, 0x26c00013, 0xdc00018, 0x6c00001,
+    0x1b5e428e, 0xdc00015, 0x800000, 0x1c00012, 0x5c00012, 0x8c00012, 0x5e4545, 0x1e4345,
+    0x8c00013, 0xd400009, 0x800005, 0xd400008, 0x8c0000d, 0x800001, 0x1e4248, 0xd800001,
+    0x26800003, 0x28000015, 0xd800001, 0x7c00000, 0x800008, 0x700000d, 0x3800009, 0x4d40000c,
+    0x8c0000d, 0xdc00009, 0x1e4406, 0x1e4585, 0x5000012, 0x8c0000d, 0x25400005, 0x7000002,
+    0x8c00012, 0x7000004, 0xcc00000, 0x7000006, 0x7000007, 0xd40000e, 0xd400012, 0x1e47cc,
+    0x10400005, 0x700000c, 0x37c00001, 0x800001, 0x80000f, 0x800008, 0xcc00014, 0x7000012,
+    0x6c00013, 0x140000d, 0x5000014, 0x800009, 0x7000017, 0x800014, 0x80000c, 0x700001a,
+    0x140000e, 0x1e4806, 0x1e460f, 0x1e4793, 0x1e4854, 0xd400005, 0x21400009, 0x2740000c,
+    0x11c00000, 0x800014, 0xdc00014, 0xf800014, 0x1040001a, 0x1e48c5, 0x1e4993, 0x800006,
+    0x8c00008, 0x11c00009, 0x280000d, 0x27400013, 0x1e444c, 0x800003, 0x800004, 0x1e4a0f,
+    0x800009, 0xf800014, 0x5000015, 0x1e4b93, 0x1e4b4e, 0xf80000e, 0x8c00012, 0x25000001,
+    0x800013, 0xfc0000e, 0x1e4c52, 0x1c00000, 0x1e4a85, 0x8c00014, 0x5000013, 0x7000012,
+    0xa000014, 0xa000015, 0x4cc00013, 0x26800001, 0x27c00005, 0x7000007, 0x7000008, 0x1e4bc5,
+    0x1c0000d, 0x5a40000e, 0x700000c, 0x15800003, 0x700000b, 0x5000012, 0x700000d, 0x500000e,
+    0x280000d, 0x1e4ac1, 0x8c0000e, 0x8c00013, 0x1c00002, 0x800009, 0x2c000002, 0x2800014,
+    0x700001a, 0x1e4941, 0x3800002, 0xa000012, 0x3800004, 0xd000009, 0x3800006, 0x400007,
+    0x3800008, 0x26c0000d, 0x4dde4d0e, 0x380000b, 0x40000c, 0x25400005, 0x6c00029, 0x3800002,
+    0x3800010, 0x8c00015, 0x1e4b05, 0xd00000b, 0x3800014, 0x25000001, 0x1e4c01, 0x3800017,
+    0x25400010, 0x1e4f05, 0x400009, 0x17400001, 0x400013, 0x1000029, 0x8c00002, 0x8c00003,
+    0x3800013, 0x3800014, 0x400015, 0x5a800001, 0x3800002, 0x1e4f89, 0x7000004, 0xa000012,
+    0x7000006, 0x800000, 0x1000001, 0x20000009, 0xa000000, 0x8c00010, 0x380000c, 0x1e4d81,
+    0x700000e, 0x25000001, 0x5000001, 0x800000, 0x17400012, 0x3800013, 0x30000002, 0x8c00003,
+    0x1e4c85, 0x6c00017, 0xec00006, 0x8c00007, 0x700001a, 0x1e4cd4, 0x400006, 0x1c0002a,
+    0xfc0000c, 0x8c0000d, 0x8c0000e, 0x800029, 0xec00010, 0x14000006, 0x8c00009, 0x1000014,
+    0x800014, 0x8c00015, 0x8c0000c, 0x1400013, 0xd40000e, 0x14000001, 0x5ade4e09, 0x700000e,
+    0x1400001, 0x14000012, 0x100001f, 0x14000016, 0x8c00005, 0x2940000c, 0x8c00002, 0x8c0000c,
+    0xd000009, 0x28000001, 0xd000001, 0x1b000007, 0x280000e, 0x5000005, 0xd000005, 0xdc0000b,
+    0x1e5005, 0x5b000012, 0x1400000e, 0x1e4dc5, 0x9800010, 0x1e5192, 0x4cc00014, 0x26800009,
+    0x1800014, 0x7800007, 0x8c0000e, 0xd000012, 0x12c00005, 0x1400004, 0xd9e4ed4, 0x1040000e,
+    0x7800013, 0x4cc00002, 0x11de4f45, 0x1e51c1, 0x1e5145, 0x25800001, 0x280000b, 0x8c00004,
+    0x800003, 0x10400007, 0x1400013, 0x8c00013, 0x10400013, 0x1400014, 0x280000d, 0x7c00014,
+    0x1e50d3, 0x1400006, 0xf800009, 0x5000003, 0xd000010, 0x1e52d3, 0x4cc00007, 0x280000e,
+    0x25400001, 0x2800012, 0x1e5049, 0xd000015, 0x1e489a, 0xf800014, 0x55400008, 0x5000005,
+    0x1e5114, 0x280000b, 0x47c00000, 0x5000009, 0x1e4fce, 0x1e5285, 0xd400001, 0x7000005,
+    0x53400013, 0x580000c, 0xd000009, 0x8c00005, 0x1e5301, 0x8c00012, 0x1e554e, 0x8c0000c,
+    0x8c00012, 0x1c00014, 0x1e55ce, 0xd400003, 0x800000, 0x1e54d2, 0x5000001, 0x280000e,
+    0x5000000, 0x1e56c8, 0x26c00013, 0xd800010, 0x8c0000c, 0xd400001, 0x8c00012, 0x280000d,
+    0x8c0000e, 0x1e5505, 0x5000009, 0x8c0000d, 0xd400005, 0x1400012, 0x1400000, 0xcc00007,
+    0x1400007, 0x1400006, 0x7000014, 0x1e5894, 0xd000003, 0x1e5705, 0x1e5792, 0x1e5813,
+    0xd800001, 0x80000d, 0x2800002, 0x1400009, 0x1400008, 0x1400013, 0x800014, 0x1e58cc,
+    0x1e5984, 0x1400008, 0x1e540f, 0x7c00007, 0x1e5649, 0x2800003, 0x1e5a53, 0x800015,
+    0x7c0000e, 0xf80000e, 0x3cc00005, 0x1e57d4, 0x10400013, 0xcc00000, 0x5000013, 0x4d400004,
+    0x800013, 0x800014, 0x800014, 0x2800002, 0x1400009, 0x80000c, 0x8c0000c, 0x5000014,
+    0xd400009, 0xf80000c, 0x500000e, 0x80000e, 0x8c0000e, 0x5000010, 0x8c0000b, 0x10400014,
+    0x1e568e, 0x8c0000e, 0xdc00014, 0x1e5945, 0x1e5a12, 0x1e4e93, 0xd400014, 0xf80001a,
+    0x2800015, 0x8c00010, 0x1e5a89, 0x1400013, 0xd000005, 0xd400001, 0x25000013, 0xd400005,
+    0x8c0000f, 0x800001, 0x800007, 0xd000014, 0x8c00000, 0x7c00002, 0x8c00015, 0x1040000c,
+    0xd800005, 0x8c00013, 0x1e59c5, 0x1dc886, 0x1e5b07, 0x8c00008, 0x27800005, 0xd000005,
+    0x8c0000b, 0x1e5ccc, 0xcc0000e, 0x1e5acc, 0x8c0000f, 0x1b40000f, 0x1400009, 0x1e5d4f,
+    0xd000015, 0x280000d, 0x27400014, 0x10400006, 0x1e5d17, 0x80000c, 0x8c00001, 0x2500001a,
+    0x4cc00005, 0x5000000, 0x800005, 0x8c00015, 0x8c00012, 0x2800007, 0xd800001, 0xa000002,
+    0x8c00004, 0x251e5b81, 0x1e5b45, 0x8c0000f, 0xa00000f, 0x26c00012, 0xd400029, 0x1040000b,
+    0x500000c, 0x8c00029, 0x9800009, 0x2f000009, 0x8c00016, 0x8c0000e, 0xfc00012, 0x56c00012,
+    0x1e5c0e, 0x1e5bd2, 0xec0000e, 0x25c00012, 0x5a1e5dd2, 0xec00010, 0xd400005, 0x1c00016,
+    0x4d400005, 0x4dc00009, 0x8c00018, 0x27400013, 0x7c0000f, 0x2580001a, 0xa000029, 0x1e5d8b,
+    0x10400009, 0x80000c, 0x1e5c41, 0x7800007, 0x535e5ece, 0x2800010, 0x2800008, 0x7c0000b,
+    0x1e5f05, 0x800014, 0x26c00012, 0x25000013, 0x800014, 0x4e800001, 0x80000d, 0x1e5f4c,
+    0x8de5e45, 0x1e5e05, 0x800000, 0x800005, 0x80000f, 0x800008, 0x8c00014, 0x4cc00014,
+    0x7c00015, 0x1e5fc5, 0x1e5e97, 0x2500000c, 0x8c00013, 0x10400006, 0x1400007, 0x800008,
+    0x800010, 0x1e5f93, 0x105e604b, 0x1e608c, 0x8c00006, 0x1e60ce, 0x800019, 0x800009,
+    0xcc0000f, 0xd800005, 0x15e6193, 0x1e6014, 0x4d5e610e, 0x780000c, 0x10400017, 0x780000c,
+    0x7c00005, 0x80001a, 0x5000014, 0x800006, 0x1e6292, 0x8c00003, 0xd400012, 0x8c00003,
+    0x2800005, 0x2a000014, 0x800002, 0x25000007, 0x280000b, 0x8c0000c, 0x1e6389, 0x4fc0000e,
+    0x800029, 0x10400013, 0x1e6949, 0x1e62d2, 0x80000f, 0x2800012, 0x1e6314, 0x1e6242,
+    0x1e6850, 0x280000d, 0x2800012, 0x25800014, 0x1e6447, 0x1e690e, 0x1e6515, 0x1e6a94,
+    0xdc0000b, 0x1e64cc, 0x800008, 0x4d1e654e, 0x80001f, 0x1e65c9, 0xd000015, 0x7c00012,
+    0x800013, 0x1e66d4, 0x1e620e, 0x8c00007, 0x8c00010, 0xc800003, 0x1e6612, 0x280000b,
+    0x7c00006, 0x2800015, 0x7c0000d, 0xc80000e, 0x8c00007, 0x7c00005, 0x1e670c, 0x7c0000d,
+    0x1e6989, 0xd000005, 0x1640000f, 0x8c00017, 0x1e6789, 0xd800001, 0x280001a, 0x2a00000c,
+    0x10400013, 0x3cc00001, 0xd40000f, 0x8c00010, 0x7800002, 0x26c0000e, 0x1e6a45, 0x1e6753,
+    0x1400014, 0x500000c, 0x27400010, 0x800007, 0x2800013, 0x140000b, 0x1e6b9a, 0x780000d,
+    0x1e6b54, 0x7c0000f, 0x2a00000e, 0x44c0000d, 0x4d400001, 0x4fc0000d, 0x4b5e6a14, 0x10400013,
+    0x1e6bc5, 0xd000001, 0x4d40000e, 0x2800008, 0x780001a, 0x4dc00013, 0x280000b, 0x1e6c46,
+    0x280000d, 0x280000e, 0xcc00007, 0x1e6fc5, 0x1e6c89, 0x500000f, 0x2800013, 0x2800014,
+    0xd400008, 0x280000c, 0x2800005, 0x5b400013, 0xd5e69d4, 0x4cc00005, 0x1b400006, 0x6c0000c,
+    0x1b400008, 0x4dc00009, 0x15e6cd5, 0x5000001, 0x1e6ac3, 0x5000003, 0x1e6d45, 0x4fc00005,
+    0x2800007, 0x1e6c01, 0x26800001, 0x1e6d09, 0x800008, 0x15800005, 0x4d5e7045, 0x1e6d85,
+    0x1e6dc1, 0xfc00005, 0x11de6b10, 0x10400008, 0x7c00010, 0x7c00009, 0x26400001, 0x1e6e45,
+    0xd00000b, 0x1e6e85, 0x1400001, 0x25800014, 0x10400008, 0xd400001, 0x800008, 0x10400009,
+    0x15dc9cc, 0x1400006, 0x800014, 0x800012, 0x1e7005, 0x1e6f13, 0x1e6e14, 0x1e6ed3,
+    0x1e6f94, 0x5000005, 0x1400014, 0x1e7117, 0x37800014, 0x5000009, 0xd800014, 0x26c00013,
+    0xf80000e, 0xd800001, 0x5000005, 0x7c00000, 0x4c800004, 0xcc00002, 0x25000002, 0x5000009,
+    0x1e6f45, 0x2000006, 0x5000009, 0xcc00014, 0x1e70c9, 0x26c00002, 0x4b800003, 0xd00001a,
+    0x26c00004, 0x1e7192, 0xd000001, 0xdc00008, 0xdc00009, 0x25000006, 0x25000012, 0x2500000c,
+    0x1e7155, 0x800012, 0x1e71c1, 0xcc0000e, 0x800015, 0x1e7092, 0x4d80000e, 0x26800005,
+    0x4cc0000d, 0x2a000002, 0x8c00007, 0x25800014, 0x140000e, 0x1400000e, 0x800014, 0x1e7212,
+    0xd000008, 0xd000009, 0xd000010, 0x280000d, 0xd400008, 0x2580000c, 0x51e7301, 0x8c00009,
+    0xd000010, 0x200001a, 0x1400007, 0x280000e, 0x4d400004, 0xd400012, 0x1e7245, 0x1e729f,
+    0x10400009, 0x26800009, 0x4d9e7409, 0x12c00009, 0x1400005, 0x1400013, 0x1400013, 0x5000012,
+    0x5000009, 0x140000b, 0x7c00000, 0x7c00000, 0x30000004, 0x46400012, 0x25000005, 0x5000003,
+    0x7c00005, 0xd00000b, 0x5000005, 0x19400003, 0x25de7445, 0xdc00009, 0x2800014, 0x26c00012,
+    0x1e72d4, 0x1e75c8, 0x8c0000c, 0x5000005, 0x5000010, 0x27400013, 0x4d5e7552, 0x51400014,
+    0xdc00010, 0x8c0000c, 0x8c0000d, 0x1e734e, 0x280000e, 0x33c0001a, 0xd400001, 0x4d5e7392,
+    0x26c00014, 0x280000d, 0x4d5e73c5, 0xd800014, 0x1940000d, 0x5000015, 0x1400014, 0x4e400013,
+    0x8c00012, 0x4cc00014, 0x14000004, 0x8c0000d, 0x1400005, 0x10400014, 0x25400014, 0x8c00009,
+    0x8c0000d, 0xec00001, 0x140001a, 0x1e77ce, 0x1e770e, 0x1e74d2, 0x29c00015, 0xd000005,
+    0x1e7492, 0x25000013, 0x10400013, 0x8c00015, 0x5040000e, 0xec00005, 0x14000003, 0x8c00004,
+    0xd400012, 0x1400014, 0x2c000002, 0x46400003, 0x1e7505, 0x25400001, 0x1400000b, 0x500000e,
+    0xd00000d, 0x14000009, 0xd400008, 0x8c0000d, 0x8c0000c, 0xd40000c, 0x1e7692, 0x16400005,
+    0x14000015, 0x1e7605, 0x1e7812, 0x1e7593, 0xd000010, 0x1400007, 0x10400013, 0x105e7ad4,
+    0x1400005, 0x7c00004, 0x140000c, 0x4dc00014, 0x11c00000, 0xcc00014, 0x3f800019, 0x1e7a93,
+    0x1e7a54, 0x1400005, 0x33c00008, 0x1400004, 0x500000e, 0x10400007, 0x5000007, 0x12c00009,
+    0x1e7745, 0x800002, 0xd000008, 0x5000006, 0xd00000b, 0x26c00013, 0x8c0000e, 0x800015,
+    0x1e7b1a, 0x8c00001, 0x1400013, 0x10400014, 0x33c0001a, 0x25000013, 0x1e7b52, 0x500000e,
+    0x1400001, 0x1e7949, 0x1e7844, 0x5000001, 0x7c00000, 0x8c00007, 0x10400002, 0x7c00014,
+    0x1400004, 0xcc00012, 0x1e7d06, 0x1400007, 0x800008, 0x8c00005, 0x27400007, 0x1e7d4b,
+    0xcc00004, 0x4e400013, 0xa00000c, 0x5000007, 0xcc00008, 0x25000003, 0x800005, 0x1400013,
+    0x1180000e, 0x8c00002, 0x8c0000e, 0x1400003, 0x5000004, 0x280000d, 0x25000004, 0xcc00013,
+    0x25000001, 0xd400014, 0x14000002, 0x1e7a01, 0x1e7c89, 0x4dc0000e, 0xdc00009, 0x8c00012,
+    0x1e7c4e, 0xd400005, 0x1400014, 0x26c00014, 0x3000000c, 0x1400029, 0x1e7d8e, 0x56400001,
+    0x25800014, 0x26de7c12, 0x1e7bd2, 0x800001, 0x5000008, 0x8c0000e, 0xd000001, 0x1e7f52,
+    0x5000007, 0xd400001, 0x1400008, 0x8c0000e, 0x800002, 0xf800004, 0xf800014, 0x25400014,
+    0x2000005, 0x5000012, 0x2740000c, 0x1b40000d, 0x5b800004, 0x11800009, 0x25000006, 0xcc00007,
+    0x1400006, 0x1640000b, 0x2800014, 0x5000012, 0xdc0000d, 0x2500000d, 0x1400007, 0x1e7e8e,
+    0x1e7b93, 0x8c00012, 0x1e7e0e, 0x14000012, 0x8c00015, 0x8c00014, 0x4dc00009, 0x26c00013,
+    0x4d400013, 0x8c00015, 0x1e7e5a, 0x12c00008, 0x7800005, 0x8c00012, 0xd000009, 0x140002a,
+    0x25c00009, 0x5000009, 0x1c00014, 0x1c00001, 0x5000001, 0x6c00000, 0x780000f, 0x25c00005,
+    0x5000005, 0x1400001, 0x800004, 0x28000012, 0x8c0000d, 0x1e7cce, 0x14000002, 0x8de7fd2,
+    0x53c00001, 0xd800009, 0x1e7dd3, 0x1e808e, 0x8c0000d, 0x26de7ece, 0x2c000003, 0x7c00012,
+    0x15800000, 0x280000e, 0x5000019, 0x25400001, 0xd400005, 0x1400006, 0x1e80d2, 0x8c0000c,
+    0x1400000b, 0x8c00006, 0x8c00005, 0x1400000e, 0x8c0000e, 0x8c00012, 0x1e8146, 0x25000012,
+    0x1e7f01, 0x26de804e, 0x14000015, 0x1400000d, 0xd000005, 0x1e8492, 0x1400004, 0x26c00013,
+    0x1e8201, 0x2a400016, 0x29400012, 0x5bc0000e, 0x7c00005, 0x8c0000c, 0x4f00000b, 0x2800007,
+    0x8c00003, 0x5000003, 0x2800014, 0x1e81cc, 0x8c00001, 0x280000f, 0x7c0001f, 0x5c000003,
+    0x8c00009, 0x280000e, 0xdc00001, 0xd000006, 0x8c00007, 0x1e840e, 0x1e7f9f, 0x14000010,
+    0x1e830c, 0xd5e8692, 0x8de828e, 0x8c0000b, 0x280000d, 0x8c0000d, 0x8c00004, 0xdc00009,
+    0x7c00000, 0x1e83d2, 0x26c00013, 0x2800014, 0x2500000e, 0xcc0000d, 0x500000c, 0x1400014,
+    0x1e8752, 0x1e8453, 0x27800001, 0x1e8515, 0x2f000002, 0x5000003, 0x8c00014, 0x1e8541,
+    0x7c00005, 0x1400014, 0x1e86c9, 0xd000005, 0x10400009, 0x2a000002, 0x2a000003, 0xd800001,
+    0x2a000009, 0x1400002, 0x5000008, 0x5000006, 0x19400012, 0x1e84cf, 0x1e8885, 0x5c400010,
+    0x5000013, 0x2580000e, 0x7c0000e, 0x5c80000c, 0x5000003, 0xec00014, 0x2a000013, 0x5000008,
+    0x5000014, 0x2800015, 0x1e8994, 0x500000e, 0xd40000e, 0xd00001f, 0x2a000017, 0xd400005,
+    0x1e8001, 0x8c0000e, 0x8c00002, 0x280000d, 0x140000c, 0xfc00001, 0x29400013, 0x1400000,
+    0x5000009, 0x8c00000, 0x1e8b85, 0x8c00014, 0x8c00012, 0x2800009, 0x1e8c93, 0x4cc00005,
+    0x4cc00005, 0x1e8ad2, 0x1e8952, 0x5cc00013, 0x1e8bc5, 0x4d80000f, 0x1e8c14, 0x25c00001,
+    0x4ec0000b, 0xfc00015, 0x10400002, 0xd80000f, 0x8c00013, 0x10400005, 0x10400006, 0xd400001,
+    0xd400001, 0x4d5e8d05, 0x27400014, 0x8c00012, 0x1e8a45, 0x28000014, 0xd800013, 0x1040001a,
+    0x1e89d3, 0x8c00015, 0x29c00005, 0x25800008, 0xd00000c, 0x2680000f, 0x1e8a05, 0xd400012,
+    0x1e8b45, 0xd400012, 0x200000f, 0x1e8c46, 0x1de8d52, 0x1c00012, 0x2000000, 0x1e8d81,
+    0x1e8a8b, 0x1c00029, 0xd000005, 0x1e8b0e, 0x1e8e05, 0xd40001f, 0x7000001, 0x1c0000c,
+    0x1c0001a, 0x5000009, 0x26c00009, 0x2800009, 0x46400008, 0x25000004, 0x2000009, 0x26800010,
+    0xd800012, 0x5d000013, 0x8c00002, 0x200000e, 0x1e8dd3, 0x25400001, 0x14000012, 0x26de8e8e,
+    0x8c00014, 0x8c00015, 0xd000010, 0x25400001, 0x5d40000e, 0x500000c, 0xa000019, 0x26c00005,
+    0x29400014, 0x25000001, 0xd40000d, 0x25000009, 0x2800013, 0x25000001, 0x2fc00004, 0x25000002,
+    0xd000013, 0x18800009, 0x8c00015, 0x2000005, 0x1e8ec1, 0x500000e, 0x1c00005, 0x5d80000f,
+    0x25000010, 0xa00000f, 0x1c00009, 0x1e8f01, 0x1e8f54, 0x2000015, 0x2500000e, 0x4d5e8852,
+    0x25c00013, 0xa000010, 0xd00001a, 0x1c00017, 0x1e8f85, 0x4d400019, 0x5000005, 0x1400013,
+    0x140000d, 0x140000e, 0x7c00000, 0x1e91d4, 0x140000e, 0x56c00001, 0x25c0000f, 0x1e8fc5,
+    0x1e9044, 0x50000013, 0x140000d, 0x280000e, 0x2800007, 0x400004, 0x5000009, 0x4e400004,
+    0x27800005, 0x6800013, 0x25de9141, 0x1c00005, 0x1e9010, 0x4d80000e, 0x800014, 0x27400001,
+    0x2800009, 0xd400001, 0x1e90c5, 0x8c00004, 0x1e9214, 0x1e9085, 0x4e400013, 0x1e9185,
+    0xa000000, 0x5000015, 0xa00000e, 0x25000005, 0xd000001, 0xa000005, 0x25000005, 0x1400000e,
+    0x1400000b, 0xd800001, 0x8c0000e, 0x27400010, 0xd400017, 0x27400013, 0xd400008, 0x14000012,
+    0x25400010, 0x14000015, 0x1e8cc1, 0x29e9401, 0x1400015, 0xec0000e, 0xdc00012, 0x1e9485,
+    0x1400013, 0xd400008, 0xa000009, 0x25c00012, 0x1e92c9, 0x2a000003, 0x1e96c7, 0xd400009,
+    0x1e93cf, 0x500000c, 0x1e97d3, 0xa1e9452, 0x101e95d2, 0x1040001a, 0x4d5e9253, 0xa1e9793,
+    0xcc0000e, 0x5000014, 0x1de9347, 0x27400001, 0xd000005, 0x25000005, 0x1c0001a, 0x1e94c5,
+    0xdc00015, 0x8c0001f, 0x7000013, 0xdc00014, 0x7c00001, 0xcc00005, 0xcc00010, 0xa00000f,
+    0x3f800009, 0x5c800007, 0x1e9745, 0x5000007, 0x1c00014, 0x200001a, 0x31400014, 0x7c0000c,
+    0xd40000f, 0x7c00007, 0x1000014, 0xd40000c, 0x8c00009, 0x1e9812, 0x2a000014, 0x8c0000e,
+    0x5000005, 0x1400013, 0x51e9545, 0x1e9845, 0x2a000017, 0xd400010, 0x14000012, 0x2a00001a,
+    0x46400008, 0x56c00014, 0x1e9ac5, 0x14000012, 0x3140000e, 0x8c00009, 0x1e958e, 0x8c00009,
+    0x2800010, 0x2000009, 0x1e99d2, 0x1e9652, 0xd40000c, 0x800005, 0xd5e8e52, 0x1e9a85,
+    0x280000d, 0x8c00009, 0x29c00009, 0x1c00010, 0xa00000f, 0xa000012, 0x1e98c8, 0x2a80000f,
+    0x14000012, 0x8c0000f, 0x31400013, 0xfc00005, 0x1e9905, 0x2500000c, 0x1e9894, 0x8c00015,
+    0xd000012, 0x8c00005, 0x4cc00013, 0x1c00009, 0x28000002, 0x8c00013, 0x1e9b0e, 0x8c00004,
+    0x25c00005, 0x6400000, 0x1e9a12, 0x780000f, 0x6400000, 0xdc0000b, 0x1c00000, 0x1e994d,
+    0x5000018, 0x1e9cce, 0xd00000b, 0x7000005, 0x27400013, 0x26c00013, 0x8c00009, 0x5dc00008,
+    0xa000003, 0x1e9b41, 0x1e9b84, 0x26c00013, 0xd000015, 0x1e9bc5, 0x800005, 0x8c00012,
+    0x25c00005, 0xcc00001, 0x740000c, 0xa000012, 0x8c0000e, 0xcde9c85, 0x1c00001, 0xc80000c,
+    0x8c00012, 0x11400009, 0x1e9d85, 0x8c00015, 0xd000001, 0x26400015, 0x2000009, 0x800009,
+    0x1c00001, 0x80000c, 0x25000009, 0x275e9d13, 0x800000, 0x800000, 0x1e9985, 0x400003,
+    0x4d5e9c53, 0x400008, 0xd400012, 0x800015, 0x5000012, 0xd400012, 0x8c0000b, 0x9800009,
+    0x12400009, 0x5000005, 0x2800004, 0x1c00012, 0x1e9ed0, 0x4dc0000e, 0x8c00013, 0x8c0000d,
+    0x1e9dc8, 0xd000017, 0xd00000e, 0x1c0000c, 0xd000005, 0x8c00001, 0x1c00001, 0x51e9d53,
+    0x6c00014, 0xcde9f45, 0xa000000, 0xd40000b, 0x7c00008, 0xd40002a, 0x8c0000e, 0x14000009,
+    0x580000d, 0x1ea001, 0x7c0000c, 0xd80000f, 0xd00001f, 0x15800012, 0x2580000e, 0x1c00012,
+    0x1400006, 0x26800009, 0x1c00002, 0x5e000003, 0x1c00004, 0x800007, 0x1c00006, 0x1de9e47,
+    0x1c00008, 0x1e9fc5, 0x1c0000f, 0xd000005, 0x1c0000c, 0x25de9f92, 0x31400013, 0x1400008,
+    0xd400010, 0x1ea192, 0x800014, 0x1dea153, 0x5e400004, 0x7c00000, 0x1c00016, 0x1c00017,
+    0x2500000f, 0x25400005, 0x1400014, 0x1ea1c7, 0x800006, 0x25000001, 0x1ea24e, 0x8c0000e,
+    0x80001a, 0x5000013, 0x5000001, 0x29400004, 0x1ea283, 0x280000d, 0x8c00009, 0xf800000,
+    0xcc0001f, 0x1ea215, 0x280001f, 0xd000010, 0x400000, 0x80000e, 0x4dc00009, 0x8c00012,
+    0x8c0000d, 0xd000015, 0x1ea0d3, 0x7c00014, 0x7c00015, 0x7c0000e, 0x1400001, 0x14c0000f,
+    0x8c00000, 0x5000012, 0x40000e, 0x25400001, 0x800015, 0x10400002, 0xd000002, 0x1ea045,
+    0x140000b, 0x800006, 0x27400004, 0xd000010, 0x1ea085, 0x1ea307, 0x1400009, 0x1040000e,
+    0x1ea2c9, 0x1400001, 0x15800013, 0xcc00013, 0x1ea385, 0x1ea34e, 0x8c0000e, 0x80001a,
+    0x5000000, 0x8c0000b, 0xd000001, 0xd800015, 0x5000013, 0xd800014, 0x5000014, 0x800015,
+    0xd00000f, 0x1ea401, 0x800000, 0x1c00000, 0x4ddea54e, 0x1ea7d2, 0x1e9f0c, 0x8c00003,
+    0x500000c, 0x5000014, 0x1ea485, 0x5000013, 0x1c00009, 0x1ea685, 0x1ea705, 0x25000010,
+    0x25400001, 0x1ea5cc, 0xa000009, 0x7000013, 0xd400001, 0x7000009, 0x8c00012, 0x700000e,
+    0x25400009, 0x251ea881, 0x1c00002, 0x1ea592, 0x1ea604, 0x1ea905, 0x1dea746, 0x4e400013,
+    0x1ea841, 0x7000002, 0x14000009, 0x1000014, 0x1ea785, 0x1c00006, 0x700000e, 0x1c00008,
+    0xa00001f, 0x7000006, 0x6c00012, 0x1ea6d3, 0x1eaad4, 0x4cc00001, 0x33c00016, 0xd400015,
+    0x1c00014, 0x1c00012, 0x5000007, 0x1eabd4, 0x1c00018, 0x15800009, 0x1c00017, 0x8c0000b,
+    0x1ea941, 0x700000d, 0x1c00000, 0x25c00003, 0x1eab45, 0x2800003, 0x1c00013, 0x7000014,
+    0x1eac81, 0x4d40002a, 0x800016, 0x1000007, 0x13c0000e, 0xa000009, 0x500000c, 0x1eaa01,
+    0x2800000e, 0x1ead05, 0x1c00003, 0x1eab85, 0x1ea994, 0x1eac05, 0xd000012, 0x1c00010,
+    0x8c00013, 0x1eacc9, 0xd400029, 0x1c00004, 0x25000010, 0x1deab06, 0x1000007, 0x1ea808,
+    0x280000d, 0x4cc00013, 0x1800013, 0x100000c, 0xd400009, 0x5000012, 0x8c00002, 0xd400017,
+    0x1eae01, 0x1eadc9, 0x1000013, 0x9c0000b, 0xcc00005, 0x11400012, 0x1c00017, 0x11400019,
+    0x14000010, 0x1c0001a, 0x800012, 0x1eb045, 0x1ead81, 0xd40001f, 0x325eaf81, 0x1eb013,
+    0xd5eae45, 0x11400012, 0x1eb185, 0x400005, 0x11400009, 0x1c0000f, 0x800009, 0x1000009,
+    0xd5ead52, 0x5eb105, 0x1140000f, 0x20000000, 0x1000001, 0x400009, 0xd1eb203, 0x800005,
+    0x800005, 0x6c00013, 0x3800014, 0x1deb381, 0x1eaf08, 0x29400008, 0xd40000f, 0x1eb3c5,
+    0x71eb0c5, 0xd40002a, 0x15eaec1, 0x1c00010, 0x1eae92, 0x100001f, 0x1eafc5, 0xd5eb2d4,
+    0xa00000c, 0x1400000b, 0xa00000e, 0x1eb452, 0x1eb28f, 0x5000009, 0x1c00029, 0x8c00019,
+    0x7000015, 0x1000004, 0x26c00012, 0x8c00015, 0x1eb605, 0x1eb5ce, 0xe800015, 0x800014,
+    0x5000003, 0x1eb247, 0x1eb695, 0x280000d, 0x1eb305, 0x800002, 0x1040000b, 0xd80000e,
+    0xd40000c, 0x1eb485, 0x1eb4c1, 0x1eb6d3, 0x1eb645, 0x800007, 0x80000e, 0x1eb814,
+    0xd000015, 0x8c00007, 0x1eb41a, 0x800015, 0xf80000c, 0x800007, 0x1eb914, 0x1eb7d4,
+    0x80000f, 0x500000e, 0x7c0000e, 0xd400009, 0xd400005, 0x2800015, 0x280000c, 0xd400009,
+    0x5000013, 0xf800013, 0x800014, 0x1c00014, 0xd000005, 0x8c00014, 0xd40000f, 0x2800012,
+    0xd800012, 0xd40000c, 0x1400001, 0xd400015, 0x8c0000e, 0x8c00015, 0x8c0000f, 0x5000000,
+    0x4dc0000e, 0x4d400005, 0x25c00001, 0x25400001, 0x7000005, 0x5000009, 0xd000001, 0x1400000,
+    0x1eb785, 0x8c00009, 0x8c00012, 0x3000000c, 0xd1eb745, 0x1eb554, 0x700000d, 0x27400013,
+    0x1eb705, 0xd800015, 0x8c00012, 0x26000012, 0x600000c, 0x5000013, 0x1eba0e, 0x8c0000e,
+    0x1eba8e, 0x8c00007, 0x1eba53, 0x280001f, 0x8c00012, 0x8c00000, 0xd800003, 0x25c00009,
+    0xd40000f, 0x1eb845, 0xd400001, 0x11400012, 0x1c00014, 0x1eb889, 0xd40000c, 0x8c00015,
+    0x1eb945, 0xd40000f, 0x7000005, 0x11400000, 0xd400012, 0x1ebb0c, 0x500000e, 0xd800014,
+    0x1eb9c5, 0x1c00015, 0x1ebb88, 0xd400012, 0xa00000b, 0x1000012, 0x1180000f, 0x1ebc12,
+    0x400015, 0x4d400015, 0xd40000f, 0x1ebad0, 0x1c0000c, 0x1eb985, 0x780000c, 0x26000001,
+    0x1ebb4e, 0x2600000c, 0x140000c, 0x1ebc45, 0x11400019, 0x1400005, 0x1ebc85, 0x1400010,
+    0x1eb8c6, 0x5000015, 0x26400012, 0x500000e, 0x1ebcd3, 0xd80000f, 0x1ebd13, 0x2800013,
+    0x26800012, 0x2800015, 0x10400017, 0x280000d, 0x10000009, 0xf80000d, 0x5000009, 0x8c00009,
+    0x1ebd41, 0x800013, 0x8c0000c, 0x26c00002, 0x1ebdc5, 0x800015, 0x8c0000e, 0x8c0000c,
+    0x8c00012, 0x1ebe4e, 0x8c0000d, 0x2800009, 0xd400001, 0x1ec112, 0x1ebe0f, 0x1ebf54,
+    0x11debec4, 0x16400003, 0x8c00012, 0x1400009, 0xf800007, 0x1ec085, 0x5000005, 0x27400013,
+    0xd400001, 0x800003, 0x1040000b, 0x1400004, 0xf800008, 0x4d400001, 0x800005, 0x2800005,
+    0x3840000f, 0x1ec18e, 0x1ec050, 0x1ebe94, 0x2500000f, 0x7c00005, 0xd800001, 0x10400008,
+    0x5000007, 0x140001a, 0x8c00005, 0x1040000c, 0xdc00014, 0x1ec0c1, 0x4c800013, 0x10400010,
+    0x80001a, 0x1ec145, 0x26c0001a, 0x12c00009, 0xcc00001, 0x1040000c, 0x2800004, 0x2a000014,
+    0x1b400014, 0x800014, 0x5000005, 0x5000009, 0x800009, 0x1400001, 0x1b400009, 0x8c00004,
+    0xd000006, 0xcc00006, 0x1400005, 0x30000012, 0x8c00007, 0x2a000007, 0x1ec248, 0x1ec1c5,
+    0x5000019, 0x8c00005, 0x2a00000c, 0x25000001, 0x80001a, 0xa000000, 0xcc00013, 0x8c00016,
+    0x1ec201, 0xd80000f, 0x2a000014, 0x1ec40e, 0x4cdec285, 0x2a000017, 0x8c00004, 0x55800012,
+    0xcc0001a, 0xfc00002, 0x8c0000c, 0x1ec2c1, 0xec0000c, 0xd000008, 0x8c0000c, 0x1ec305,
+    0x1ec3ce, 0x1ec441, 0x4d400013, 0x26800003, 0x8c00014, 0x8c0000e, 0x1400001, 0x8c00009,
+    0x25000013, 0x8c0000d, 0xec0000f, 0x8c0000e, 0x26400012, 0x8c00015, 0x2500000f, 0x26800015,
+    0x2800013, 0xd400001, 0x28000015, 0x1ec489, 0xd800014, 0x5000014, 0xd400014, 0x5e800012,
+    0x1400006, 0x25000013, 0x11c00001, 0xd400005, 0xd400001, 0xd400005, 0x26c00013, 0x8c0000e,
+    0x8c00013, 0xd000015, 0x11c00009, 0xd400005, 0xcc00010, 0x10400005, 0x5000013, 0x5000012,
+    0x2a000014, 0x7c0000f, 0x5000015, 0xcc00006, 0x1b400007, 0x280000b, 0x1ec585, 0xcc0000d,
+    0x800009, 0x80000e, 0x500000d, 0x8c00004, 0xd800005, 0xcc00010, 0x1400001, 0x1400005,
+    0x8c00014, 0x5000014, 0x800008, 0x2800007, 0x7800016, 0x7c00012, 0x7c00015, 0x500001a,
+    0x8c00012, 0xc800009, 0x8c0000c, 0xcc00012, 0xcc00004, 0x1400013, 0x1ec5c2, 0xcc00014,
+    0x2800003, 0x1ec709, 0x7dec981, 0x1ec8d2, 0x80001a, 0x2800012, 0x1ec7c8, 0x5000012,
+    0x1ec90c, 0x1ec749, 0x1ec4ce, 0x280000c, 0x1ec894, 0x1ec78d, 0x7c00005, 0x800013,
+    0x1ec854, 0x2800012, 0x4d5ecad2, 0xcc00014, 0x80000f, 0xd40000b, 0x8c00016, 0x9ec94e,
+    0x1400013, 0x800010, 0x8c00005, 0x1eca82, 0x7800002, 0x800014, 0x25400005, 0x5000014,
+    0x80000f, 0x10400007, 0x1ecb06, 0x800006, 0x15ecd0e, 0x1040000c, 0xd800001, 0x800001,
+    0x140000e, 0x5ec00013, 0x2540000b, 0x8c0000d, 0x500000c, 0x10400001, 0x1400014, 0x1b400006,
+    0x1ec9d3, 0xcc00007, 0x1ecfce, 0x25000003, 0x1ecc45, 0x1ecf06, 0x1b400013, 0x1400008,
+    0x4c800013, 0x1ec814, 0x140000b, 0x1ecf4c, 0x1ecd8d, 0x1eca0e, 0x11c00000, 0x2740001a,
+    0x5000003, 0x1ecc12, 0x15eccd3, 0xcc0000b, 0xdc00006, 0x1ecb4d, 0x1ed00e, 0x2800008,
+    0x8c00001, 0x140001a, 0x1ece81, 0xd40000c, 0x1ece14, 0x500000c, 0x1ed10d, 0x1400002,
+    0x5f000013, 0x7c00010, 0x1ed149, 0xec00001, 0x10400014, 0xf800005, 0x800015, 0x5000018,
+    0x800029, 0x8c00012, 0x1400004, 0x140000d, 0x2800005, 0x4d9ece4e, 0x1ecdc5, 0x25000001,
+    0x1ecec5, 0x25c00010, 0x6c00001, 0x27800001, 0xd400001, 0x4d400009, 0x1400013, 0x1ed045,
+    0x1ed203, 0x7c0000f, 0xd400012, 0x400005, 0x8c00002, 0x1ed393, 0x8c00015, 0x1c0000c,
+    0x26800010, 0x279ed0c5, 0x11c0000b, 0x1ed185, 0xd800014, 0x4d400013, 0x2800009, 0x8c0000e,
+    0x1ed094, 0x1940000c, 0x7800003, 0x11c00014, 0x7c00014, 0x11c00005, 0x27400013, 0x1400007,
+    0x1ecf94, 0x5000008, 0x4dc00009, 0x8c00013, 0x800014, 0xd400001, 0x10400013, 0x2640000c,
+    0x10400004, 0x1400014, 0x10400006, 0x10400007, 0x1ed1d4, 0x7c0000e, 0x800012, 0x140000b,
+    0x1040000c, 0x25c00013, 0xa000005, 0x26ded303, 0x1ed285, 0xa000014, 0x8c0000c, 0x8c00014,
+    0x8c00012, 0xd800012, 0x20000005, 0x10400017, 0x4d400012, 0x1ed412, 0x14000004, 0x1ed5ce,
+    0xd00000c, 0x8c0000f, 0x4cc00013, 0x1c00013, 0x8c0000f, 0x1ed645, 0x8c00014, 0xec0000e,
+    0xd400005, 0x27400014, 0x5f400008, 0x8c00012, 0x5c00014, 0x5000014, 0x5c00009, 0xb400001,
+    0x7000008, 0xd800001, 0x1ed485, 0x1ed441, 0xa000000, 0x500000e, 0x8c00012, 0x1ed4d2,
+    0x7c00001, 0xd400001, 0x1ed605, 0xcc00005, 0x7000000, 0x1ed3ce, 0x8c0000d, 0xd80000f,
+    0xd400015, 0xd80000b, 0x7c00001, 0x1ed253, 0x1ed552, 0x27400013, 0xd000010, 0x6c00012,
+    0xdc00009, 0x280000c, 0x8c0000d, 0x17400001, 0x800000d, 0x6c00002, 0x1ed80c, 0x1ed585,
+    0x4dc00009, 0xd800005, 0x1ed8cd, 0x6c00012, 0xd400012, 0xa000000, 0x25400005, 0x6c00002,
+    0xa000006, 0x1c00011, 0xdc00014, 0x7000006, 0x7000007, 0x1edece, 0x1140000c, 0x7000012,
+    0x1eda4e, 0x700000f, 0x1edc41, 0xd000005, 0x1eda12, 0xd400010, 0x1edd85, 0x1ed943,
+    0x7000013, 0x1ed894, 0x1edb86, 0x1edac1, 0x6c00017, 0xcdedbc9, 0x1ede42, 0x1ede05,
+    0x1edd4f, 0x1ed84d, 0x26c00004, 0x26c00005, 0xcc00006, 0x1ee2ce, 0xcdedb12, 0xa1ed993,
+    0x1c00000, 0x800015, 0x25000001, 0x5000000, 0x7000018, 0x1edf85, 0x1edfd2, 0x25000005,
+    0x1ed792, 0xa000013, 0x25000009, 0x1c00019, 0x1c00018, 0x2540000b, 0xec00007, 0x1ee041,
+    0x2500000f, 0x8c0000b, 0x1edde9, 0x1ee185, 0x1ee145, 0x1edc15, 0x1ee094, 0x1ede89,
+    0x1ee289, 0x180000e, 0x1ee105, 0x1c00029, 0x1edcea, 0x1edf0f, 0x5000000, 0x600000c,
+    0x8c00007, 0x100000f, 0x1400000e, 0x25000005, 0xa000015, 0x1ee013, 0x1000014, 0x5000000,
+    0xdc00001, 0x8c0000c, 0xd000005, 0x8c00002, 0x25000005, 0x1ee205, 0x27c00009, 0x1ee412,
+    0x3d000009, 0x1000000, 0xd000001, 0xd000005, 0x25000013, 0x1c00000, 0x5c0000c, 0x20400000,
+    0x5000004, 0x1c00002, 0x1400013, 0x1ee0c4, 0x395ee345, 0x1ee446, 0x7000007, 0x6400008,
+    0x1c00009, 0x8c00002, 0x1c0000b, 0x1c0000c, 0x7800014, 0x1c0000e, 0xd00001a, 0x8c0000e,
+    0x1000018, 0x7000012, 0x1ee713, 0x1ee314, 0xdc00003, 0x1000013, 0x1c00017, 0x8c00006,
+    0x5800007, 0x640001a, 0x2800004, 0x100000c, 0x1eeac5, 0x1400000d, 0x700000d, 0x1ee605,
+    0x4ddee74e, 0x25800012, 0x500000c, 0x8dee392, 0x1ee792, 0x1ee4d3, 0x800001, 0x1ee3d4,
+    0x17400005, 0x2800013, 0x1ee805, 0xd000015, 0x1c00029, 0x280001a, 0xcc00009, 0x2a400004,
+    0x25000001, 0xd000017, 0x800012, 0x1c00004, 0x80000f, 0x7000006, 0x3800007, 0xd00000c,
+    0x30000002, 0x4d5ee494, 0xcc00005, 0x1ee8cc, 0x1ee7c9, 0x700000e, 0x1ee6d3, 0x1eea09,
+    0x800000, 0xd000012, 0x3800013, 0x1ee915, 0x205ee9ce, 0x1ee845, 0x1dee517, 0x800012,
+    0x7000006, 0x1c0001a, 0x1800013, 0x400014, 0x11400000, 0x1c00001, 0xd00001f, 0x8c0000c,
+    0x2800008, 0x1eeb05, 0x1000001, 0x1400001, 0x6c00014, 0xd40000d, 0x8000010, 0x1eed85,
+    0x2800010, 0x5c0000b, 0x8c00014, 0x500000e, 0x1eedd3, 0xec0000e, 0x4cc00007, 0x5ee1ea,
+    0x1eee0c, 0x25800001, 0x25800012, 0x800000, 0x1eebd2, 0x1eec8c, 0xd800005, 0x8c00001,
+    0xd000015, 0x800000, 0xd400015, 0x8c00009, 0x25deeb85, 0x4d5eea54, 0x1400012, 0xd800014,
+    0x14000002, 0xd400012, 0x4dc0000e, 0x800000, 0x1400000c, 0x25c00005, 0x4d40000e, 0x25c00001,
+    0x280000d, 0x8c0000b, 0x1eee52, 0x1eec0f, 0x8c00014, 0x1eed45, 0xd800014, 0x1eecc8,
+    0x8c00012, 0x8c0000c, 0x1eefcc, 0x8c00001, 0x8c00013, 0x700000b, 0x1ef0d2, 0x100000f,
+    0x26000012, 0x4d5ef153, 0x8c00015, 0x8c00012, 0x6c00001, 0x1ef2c5, 0xd400009, 0x1ef244,
+    0x800000, 0x6c00013, 0xa000000, 0xa000010, 0x11400016, 0xd000001, 0xd400005, 0xd80000f,
+    0xd000005, 0x27400013, 0xd000003, 0x1ef312, 0x6400007, 0x4d400005, 0x2780000f, 0x2800015,
+    0x3800001, 0xd400001, 0x14000009, 0x8c00009, 0xd400012, 0x1eeec5, 0x8c0000c, 0x1800005,
+    0x4ddeef04, 0x800000, 0x700001f, 0x25c0000f, 0x11400009, 0x800005, 0xd00001f, 0x1c00001,
+    0x1ef1d3, 0x6400001, 0x15800000, 0x1c0000b, 0xcc0000e, 0xa000000, 0xa000003, 0x1eef8e,
+    0x5000014, 0xa000012, 0x700000b, 0x1ef34b, 0x71ef112, 0xa000014, 0x1c00009, 0x1c0000f,
+    0x800001, 0x700000e, 0xa000014, 0x1c0001a, 0x1ef494, 0x7000005, 0x11400007, 0x7000012,
+    0x400009, 0x800013, 0x800005, 0x1ef40c, 0x11400003, 0x1c0001f, 0x1c0000f, 0x12400003,
+    0x7000004, 0x800012, 0x1c00013, 0x80000e, 0x1c0000b, 0x1ef189, 0x11400005, 0x80000e,
+    0x1ef3c5, 0x1ef5d4, 0x2000000e, 0x800003, 0x1ef648, 0x1c00002, 0x25000013, 0x6400013,
+    0x4dc00009, 0x1c00018, 0x7000007, 0x2800009, 0xd800008, 0x700000a, 0x1ef28e, 0xa000003,
+    0x1ef60b, 0x1c0002a, 0x11c0000b, 0x7000010, 0x800014, 0xa000003, 0x1ef213, 0x1ef6c2,
+    0x1c00006, 0x1c0000d, 0x80000e, 0xd00000c, 0xcc00014, 0x1c0001a, 0xd00000f, 0x7000013,
+    0xa00000e, 0x80000c, 0x800006, 0xcc00007, 0x5000014, 0x8c00001, 0x27400005, 0x1ef505,
+    0x7c00017, 0x25000001, 0x8c0000e, 0xcc0000f, 0x1ef7ce, 0x7c00000, 0x1400005, 0xcc00013,
+    0x8c00014, 0xcc00013, 0xd400029, 0x26c00012, 0xd000001, 0x1ef4c1, 0xcc0001a, 0x7c00013,
+    0x1efb13, 0x1ef754, 0x8de2246, 0x1ef587, 0x1eef48, 0x1180000f, 0x80000c, 0x800010,
+    0x1ef813, 0x1ef84d, 0x1ef787, 0x10400012, 0x1efbcc, 0x1400006, 0x8c00003, 0x1ef913,
+    0x8c00012, 0x2800015, 0x8c00009, 0x1ef9d7, 0x1ef885, 0x8c00014, 0x7c00009, 0x4cc00015,
+    0x2800012, 0xcc00007, 0x7c0000c, 0x1efa41, 0x80000f, 0x500000b, 0x7800010, 0x1efc85,
+    0x1ef992, 0x700000d, 0x800007, 0x2800015, 0xa000006, 0x1efa29, 0xa000000, 0x3f800005,
+    0x1c00002, 0x1ef94f, 0xa000013, 0x1efb45, 0x7c0001f, 0x800012, 0x1400013, 0x1efa89,
+    0xa00000c, 0x12c00009, 0x1c0000c, 0x1400009, 0x700000d, 0x200000d, 0x12400012, 0x1defc01,
+    0x6400002, 0x7c0001f, 0x4ddefccf, 0x1400010, 0x1efd88, 0xcc00007, 0xcc00005, 0x3a800009,
+    0x26000012, 0x1c0000b, 0xcc00009, 0x7c00029, 0x12c0000f, 0x1c00002, 0x1400010, 0xcc00004,
+    0x1400012, 0x1c00006, 0x7c00000, 0xcc00008, 0x1c00002, 0x4cc00014, 0x800001, 0x1c0000c,
+    0xcc0000d, 0x3040000e, 0xcc00000, 0xa000009, 0xcc00002, 0x280000e, 0x1efc53, 0x1efd05,
+    0x2000008, 0x1240000d, 0x1c00017, 0x7000009, 0xcc00000, 0xcc0000b, 0x1efe14, 0xcc0000d,
+    0x1c00003, 0x1400004, 0x1c00006, 0x1c00007, 0xa1efdc7, 0x2e000013, 0xcc00014, 0x1c00000,
+    0x1f0288, 0x1c0000c, 0xcc0000c, 0x1eff8e, 0x7c00005, 0x7c00006, 0x12400012, 0x1f0053,
+    0xcc00014, 0x1400001, 0x1efe41, 0x8defacc, 0x1f03c1, 0x1c0000e, 0x1effc5, 0x11c00000,
+    0xd800001, 0x1400009, 0x1c00013, 0x1efec4, 0x12400009, 0x7000000, 0xa00000d, 0x4000000,
+    0x26000001, 0x1f02c2, 0xd40000c, 0xd000003, 0x1f0005, 0x1ef386, 0x1f06cd, 0x12400014,
+    0x1f0109, 0x1c00010, 0x5f800013, 0x1f0194, 0x700000d, 0x1f04ce, 0x2000005, 0x7000006,
+    0xcc00006, 0x1400002, 0x1c00000, 0x1efd53, 0x1f0254, 0xcc00006, 0x1c00000, 0x140000e,
+    0x1f0606, 0x800007, 0x4000005, 0xcc00005, 0xd000009, 0x7c0000e, 0x80000c, 0x32c00005,
+    0x1c0000e, 0x1400001, 0x800013, 0xe000014, 0x25400014, 0x1c00005, 0x1f0750, 0x1c0000f,
+    0x7000000, 0x7000005, 0xcc00002, 0x1c00010, 0x7000003, 0x1c00005, 0x7000008, 0x1e800007,
+    0x4000007, 0x1c00009, 0x5000001, 0x4d400012, 0x7000008, 0x2000015, 0x1c00012, 0x1f0a0e,
+    0x1c00010, 0x1c0000f, 0x6400013, 0x1c00013, 0x1c00014, 0x2d5f08d3, 0x1c00014, 0x1c00003,
+    0x6df0684, 0xcc00019, 0x1f07c6, 0x4000007, 0xa1f0648, 0x7000009, 0xa000014, 0x700000b,
+    0x1c0000c, 0x1c00003, 0x1f058e, 0x7000000, 0x2000010, 0x1c00000, 0xcc00001, 0x2000013,
+    0x7000005, 0x1f0795, 0x1400000, 0x7000006, 0x8c00012, 0x1c00002, 0x1f0849, 0xa00001b,
+    0x1f0485, 0x7000008, 0x1e800007, 0xa000001, 0x1240000b, 0x1c00010, 0xac0000b, 0x7c00003,
+    0x6400001, 0x1c00014, 0x1f0815, 0x7c00007, 0x12400008, 0xa00001a, 0x21800013, 0x8c0000e,
+    0x1c00015, 0x1f0a8d, 0x1c00001, 0x1c00002, 0x1f0990, 0xcc00004, 0xcc00000, 0x1df0893,
+    0x1c00007, 0x1c00000, 0x5000001, 0xcc00001, 0xa00000b, 0x2000004, 0x1c00005, 0x1c0000e,
+    0x1c00007, 0x7000010, 0xf800009, 0x1f0a45, 0xd000001, 0x7c00001, 0x8c00001, 0x700000e,
+    0x29c00005, 0x7c00005, 0xcc00014, 0x8c00009, 0x1c00013, 0x1c00014, 0x8c0000c, 0xf00000c,
+    0x1f070e, 0x700000e, 0x7c00001, 0x8c00012, 0x8c0000f, 0x1f0945, 0x1c00005, 0xf000014,
+    0x1f0913, 0x1f0ac5, 0x1f0b01, 0x11400001, 0x4cc0000e, 0x1140001a, 0x1800014, 0x5fc00005,
+    0x40000c, 0x800010, 0x1c00001, 0x4cc00013, 0xec0000e, 0x6400014, 0x400014, 0x26c00013,
+    0xa00000c, 0x8c00012, 0x1c0000e, 0x7000013, 0x8c0000c, 0x2c000009, 0x6c00014, 0x7000014,
+    0x1f0bd3, 0x1f0b81, 0x4ddf0b4e, 0x27400003, 0x1400000, 0x1400013, 0x5000013, 0x8c0000f,
+    0x5380000f, 0x5000007, 0x7000000, 0x1f0e4e, 0xd400001, 0x1f0c05, 0x800015, 0x1f09d2,
+    0xdc0000e, 0x8c00014, 0x1000000, 0xd5f0d05, 0xd800014, 0x700000b, 0x5000014, 0xd000015,
+    0x1f0cc1, 0x8c00010, 0x400001, 0x2c000012, 0x1f0d85, 0x40000c, 0x2000000e, 0x25c00001,
+    0xd1f0d41, 0xd000008, 0x7400012, 0x1f0c85, 0xd000002, 0x1f1012, 0x1f1185, 0x80000f,
+    0xd40000c, 0x3800001, 0x4e400013, 0x26c00012, 0x800000, 0x11400005, 0x700000c, 0x1c00001,
+    0x1f0ec1, 0xd400012, 0x1f0c53, 0x1f0dd2, 0x1f1285, 0x7000009, 0x2800014, 0x800000,
+    0x400001, 0x8c00013, 0x800005, 0x1f0fc8, 0x1f1085, 0x1f134b, 0xa00000c, 0xa000001,
+    0x4f400029, 0x1c00012, 0x800009, 0x1f1105, 0x80001f, 0x8c0000c, 0x1df1382, 0xa000009,
+    0x8c0000d, 0xa000015, 0x1880000c, 0x14000012, 0x1000015, 0x1c0001f, 0x26800017, 0x500000b,
+    0x6400009, 0x1c0000d, 0x26c0000c, 0x1f1145, 0xd000010, 0x80000f, 0x30000002, 0x21400001,
+    0x8c0000d, 0x800015, 0x7000014, 0x1f10c5, 0xa000001, 0xd80000f, 0x11400008, 0x5f1049,
+    0x1f11c8, 0x700002a, 0x8c0000e, 0x6c00005, 0x1f1483, 0xd80000f, 0xdc00009, 0x26800001,
+    0xd400012, 0x5900000c, 0x8c0000d, 0xa00000e, 0x1f1245, 0x8c0000e, 0xa000008, 0x14000012,
+    0x25400005, 0x4d00000d, 0xd40000c, 0x1f15c5, 0x8c00014, 0x7000007, 0x180000e, 0x8c00003,
+    0xd400012, 0x8c00000, 0x71f13cc, 0x6c00000, 0x8c0000d, 0x7c0000f, 0xdc0000c, 0x1c00005,
+    0x8c00009, 0x4cc00013, 0x1000002, 0xa1f1443, 0x1c00004, 0x800005, 0x7000006, 0x6c00007,
+    0xa00000e, 0xd400001, 0x4cc00013, 0x40000b, 0x700000c, 0x1f1405, 0x8c0000c, 0x8c00015,
+    0x1400017, 0x800000, 0x1c00012, 0x6c00013, 0xd000002, 0xdc00003, 0x9f14c5, 0x21800017,
+    0x2540000b, 0x1f16c8, 0x700001a, 0x400000, 0x1f01cb, 0x400002, 0x1f1603, 0xdc00003,
+    0x51f12ce, 0x8c00002, 0xdc0000e, 0xd000001, 0x1f1508, 0x2c000012, 0x8c00010, 0xdc00015,
+    0x8c00014, 0x1c0000d, 0x1f170e, 0x8c00015, 0x1f1581, 0x14000009, 0x8c00012, 0x27400013,
+    0xd1f1645, 0x8c00015, 0x1f1553, 0x280000e, 0xd000009, 0x2800004, 0x14000012, 0x2540000d,
+    0x1f178e, 0x1f1685, 0x1df17c6, 0x8c0000c, 0xd1f1841, 0x3800000, 0x251f1901, 0x2800000e,
+    0x7000015, 0x4000006, 0x1c00015, 0x1f050c, 0x2800013, 0x2800014, 0xd000015, 0x380000c,
+    0x2c000002, 0x1f1b4c, 0x2dc0000f, 0x4000010, 0x8c00006, 0x25800012, 0x8c00008, 0xd1f19c9,
+    0x280000c, 0xdc0000d, 0x2800000e, 0x26c0000d, 0x4ddf1b8e, 0xd1f1ac5, 0x7000015, 0xcc00012,
+    0x1f1a52, 0x1f18d3, 0x1f1e85, 0x400002, 0xcc00009, 0x7000004, 0xd000005, 0xd000001,
+    0x25000010, 0x19400006, 0x1f25df, 0x1f2502, 0x1f1894, 0x6c0000c, 0xa000000, 0x6c0000e,
+    0x25000013, 0x25000013, 0xd800001, 0x1f1c12, 0x1000013, 0x25000002, 0x25400003, 0x8c00004,
+    0x4000017, 0x1f1a0f, 0xcc0001f, 0x700001a, 0x1c00013, 0x1000013, 0x1000014, 0x140000c,
+    0x2500000d, 0x1f1bce, 0xa000000, 0xec00010, 0x30000002, 0x8c00003, 0x25400013, 0x500000c,
+    0xd000001, 0x1f1fc1, 0x1f2385, 0x1f1d49, 0x1f2105, 0x1f1ec5, 0x1f2685, 0x5e1f1dcd,
+    0xa1f1f8e, 0x60000009, 0x25400003, 0xd00000c, 0xa1f1f12, 0xa000013, 0x8c00014, 0x80000f,
+    0x5000001, 0x1f1e52, 0x2500000b, 0x800000, 0x1f20c1, 0x800015, 0x60400003, 0x6080000e,
+    0xcc00001, 0xcc00000, 0x1f204b, 0x1c0000c, 0x1f2705, 0x1f248e, 0x800005, 0x1f1d1f,
+    0x25400001, 0x1000002, 0x1f2545, 0x1000001, 0x1f2605, 0x1f2802, 0xcc0000f, 0x6c00013,
+    0x1f2581, 0x1f20a9, 0x25000001, 0xd000009, 0x1f2645, 0x4cdf2754, 0x29c0000f, 0x8c00012,
+    0x800000, 0xa000000, 0x25000009, 0x9800010, 0x7c00004, 0x4c80000b, 0xd000017, 0x8c00014,
+    0x12400001, 0x1f2792, 0x800009, 0x1c00004, 0xcc00005, 0xd000015, 0xcc00005, 0x7c00004,
+    0x7c0000c, 0xa000010, 0xcc00009, 0xcc00000, 0x1c0000d, 0x1f27c8, 0x1f2892, 0xa000012,
+    0xcc0000d, 0x8c00005, 0x4d80000f, 0x2500000c, 0xd000012, 0x7c00012, 0x7000005, 0xa000000,
+    0x8c00000, 0x27400001, 0xcc0000f, 0x27400013, 0x1f2905, 0x640001a, 0xa000001, 0x1f294e,
+    0x8c0000e, 0x25400014, 0x1f2845, 0xa00000c, 0x8c00014, 0x1c0001a, 0x600000c, 0x8c0000e,
+    0x8c0000d, 0xd400012, 0x1180000e, 0x8c0000e, 0x1f26d2, 0x8c00012, 0x1f2a52, 0x30000007,
+    0x2800015, 0x8c00001, 0x1f28ce, 0x2800015, 0x8c00009, 0x1f2a85, 0x8c00012, 0x8c0000c,
+    0x1c00015, 0x25df2981, 0x5000006, 0x25c00009, 0x26800001, 0x1f29c5, 0x8c00012, 0x500000b,
+    0x1000001, 0x8c0000d, 0xec0000e, 0xd40000d, 0xa000013, 0x17c00014, 0x1f2f45, 0x2640000c,
+    0x8c0000b, 0x4d800009, 0xa000004, 0x2680000c, 0x280000e, 0xd40000e, 0x27400013, 0x8c0001f,
+    0x1f2e48, 0xd400012, 0x11400000, 0x7c00001, 0x1000015, 0x8c00009, 0x8c0000c, 0x6c00005,
+    0xd40000c, 0x11800008, 0xd000009, 0x8c0000e, 0x26c00013, 0x8c00012, 0x25000007, 0x8c0000c,
+    0x1f2f04, 0x1f2e8e, 0x1f2dd0, 0x10000012, 0xd400001, 0x4d5f2e12, 0x1f2bc7, 0x1f2b95,
+    0x4cc00007, 0xd400014, 0x1f2d45, 0x1f30d3, 0x60c00014, 0x26c00013, 0x7c00013, 0xa000014,
+    0x1f2ec5, 0x80001f, 0x5bc00012, 0xd800001, 0x1940000e, 0x8c0000e, 0x1f3212, 0x1f2fc5,
+    0x280000e, 0x19800008, 0x8c0000e, 0x1c00009, 0x28000007, 0x2800005, 0x8c0000b, 0xdc00009,
+    0x8c00010, 0x8c0000e, 0x1f3041, 0x1f3012, 0x800009, 0x27400013, 0x7000001, 0x8c00014,
+    0x1f2f89, 0x6c0000e, 0x280000e, 0x8c0000c, 0x8c0000d, 0x500000e, 0x1f3105, 0x8c0000f,
+    0x3800000, 0xd000001, 0x4d40000c, 0x1f3348, 0x6400000, 0x7c0000b, 0x1f3401, 0x1f308e,
+    0x400008, 0x175f3185, 0xd400012, 0x6c00005, 0xa000009, 0x1f33c9, 0x700000e, 0x1fc0000c,
+    0x1c0000d, 0x1f34c5, 0x12400000, 0x2cc00013, 0x1c00010, 0xd400014, 0x7000004, 0xcc00000,
+    0x2740000c, 0x7000007, 0x20400014, 0x1f35c2, 0x7000003, 0xa000008, 0xcc00005, 0xcc00006,
+    0x7c0000e, 0x7000005, 0x17400006, 0x7c00008, 0x7000014, 0x20400013, 0xcdf368b, 0x4dc00009,
+    0x700000c, 0x1c00010, 0xcc00000, 0x700000f, 0x12400002, 0x7000003, 0xcc0000b, 0x1f394b,
+    0x7000006, 0x6400007, 0x6400008, 0xcc00000, 0x1f3585, 0xcc0000b, 0xd000001, 0x175f3504,
+    0x6c0000e, 0x1f38c5, 0x1f398c, 0x1c00005, 0xd400001, 0x65f3613, 0x7000014, 0xa000006,
+    0xcc00005, 0x1f31ce, 0x7c00004, 0x1740000f, 0x7c0001a, 0x640000f, 0xa000010, 0x7c00014,
+    0x7c00012, 0x1740000b, 0x17400002, 0x7000000, 0xd00000d, 0x275f3552, 0x1f3386, 0x6400014,
+    0x1c00005, 0x1c00014, 0x20400007, 0xa000014, 0x7c00013, 0x4dc00013, 0x1f380e, 0xd00000c,
+    0x7c00004, 0xd400008, 0xd5f3452, 0x7000007, 0x400013, 0xd000009, 0x1fc00000, 0x1f3701,
+    0x7000002, 0x7c0001f, 0x6c0000e, 0x1f3745, 0x17400005, 0x1c00003, 0x7000007, 0xd400009,
+    0x6c00013, 0x700000b, 0x700000c, 0xdc00005, 0x1f384b, 0xa00000d, 0x1f3a02, 0x1f3648,
+    0x5000005, 0x7000013, 0x7000014, 0x140000e, 0x8c00005, 0x7000013, 0x1f3881, 0x1f3b85,
+    0x80000c, 0x7c0000c, 0x7df3a85, 0xdc00015, 0x8c00012, 0x700001b, 0x7c00005, 0xcc00010,
+    0x7c00009, 0x7df37cc, 0x1400007, 0x2a000014, 0x1f3b13, 0x1400001, 0x4cc00007, 0x1f3912,
+    0x800009, 0x500000f, 0x1f3c4c, 0x10400009, 0x800008, 0x10400009, 0x8c00013, 0x10400014,
+    0x1400006, 0x1f3c0c, 0x7800016, 0x800003, 0x780000e, 0x8c0000c, 0x1f3dd4, 0x80000f,
+    0x7800012, 0x7c00004, 0x1b400003, 0x11c00002, 0x80000c, 0x2800014, 0x7c00009, 0x7c0002a,
+    0x780000b, 0x1f3d54, 0x15f3cd2, 0x1400013, 0x9f3d14, 0x1f39ce, 0x1f3d82, 0x7c00006,
+    0x1f3e85, 0x800001, 0x800006, 0xcc00007, 0x1f3fc9, 0x1f3e43, 0x7c0000d, 0x500000b,
+    0x1f3e0c, 0x1f3c89, 0x1f3a4e, 0xcc00009, 0x280000d, 0xcc00014, 0x280000c, 0xcc00013,
+    0x1f3f14, 0x17400009, 0x1f3f52, 0x1f3ec8, 0x25000013, 0x1f3f85, 0x1400013, 0xd400005,
+    0xcc00001, 0x1400014, 0x1400005, 0x800015, 0x8c00015, 0xd800001, 0x2800006, 0x1400006,
+    0x8c0000c, 0xd800001, 0xcc00007, 0xd800001, 0x80000d, 0x1f4105, 0x1b400009, 0x140000e,
+    0x800015, 0x1f4049, 0x2800005, 0x8c00014, 0x10400013, 0xcc00006, 0x1f4089, 0x25c0000f,
+    0x1f40d4, 0xd40000f, 0x8c0000e, 0x8c00005, 0xd40000f, 0x1f401f, 0x2800005, 0x27400002,
+    0x1f4145, 0x8c00009, 0xcc00013, 0x8c00014, 0x8c00005, 0x8c0000e, 0x140000d, 0x140000f,
+    0x8c00012, 0x5680001f, 0x500000e, 0x1f4185, 0x56c0000c, 0x25000005, 0x7800012, 0x1400016,
+    0xd40000e, 0x1f41c1, 0x1400014, 0x1000003, 0xa000000, 0x1c00006, 0x8c00029, 0xa000000,
+    0x7c00001, 0xd400009, 0x14000007, 0x2c000002, 0xa000005, 0x25000010, 0x980000f, 0xd40000f,
+    0x1f4395, 0x8df424e, 0x8df4289, 0x1f4348, 0x1f4214, 0x1c00016, 0x8c00013, 0x1f42ce,
+    0x8c00004, 0x1f4401, 0x26c00013, 0x14000012, 0x2800013, 0x2c400014, 0xcc00014, 0x2a400016,
+    0x1400012, 0x10400005, 0x4dc0000e, 0x8c00005, 0x8c00005, 0x26c00013, 0x1f43c7, 0x1400014,
+    0x8c0000e, 0x1400009, 0xd400015, 0x800009, 0x7c00005, 0xd000001, 0x400013, 0x2a000013,
+    0x1f4687, 0x1f4313, 0x1f4614, 0x1f44ce, 0x1f46ce, 0x1f48d2, 0x1400017, 0x25000013,
+    0x7800002, 0x3c40001a, 0x25000002, 0x7800004, 0x1f4641, 0x1f490b, 0xd400005, 0x10400005,
+    0x27800001, 0x1f45ce, 0x1f4a04, 0x5000003, 0x1f448e, 0x2800014, 0x5000003, 0x400000,
+    0x611f4852, 0x140000c, 0x7800014, 0x1f4785, 0x1f4a48, 0x1f49c1, 0x2740000f, 0x8c0000e,
+    0x6140000e, 0x5000015, 0x4cc00014, 0xdc00003, 0x800004, 0xdc00010, 0x4d400015, 0xf800014,
+    0x1f4b52, 0xdc00009, 0xd00000d, 0xdc0000e, 0x1f4945, 0x1f4b14, 0x1f4b8c, 0x80000d,
+    0x1f47ce, 0x1f4c93, 0x1f4992, 0x7c00013, 0xd5f4bd2, 0x27400005, 0xd40000f, 0xd400010,
+    0x4cc00014, 0xd00000e, 0x4cc00009, 0x4d400014, 0x8c00012, 0x1f4c41, 0x1f4ac5, 0x1f4a81,
+    0x26c00014, 0x4d400005, 0x1f4e0e, 0x4e400013, 0x7c0002a, 0x7c00000, 0x7c00009, 0x8c00003,
+    0xd40000c, 0xd000003, 0x280000b, 0x1f4d41, 0xd40000b, 0x1f4e89, 0xd400015, 0xd800005,
+    0xd400017, 0x1f4d0d, 0x1f4cce, 0x4cc0000c, 0x5000005, 0x1f4f53, 0x1f50d2, 0x1f4c13,
+    0x8c00014, 0x7c00008, 0x57400014, 0x7c00000, 0x7c00018, 0x1f4e53, 0x7c0000d, 0x1f500e,
+    0x800006, 0x8c0000f, 0x10400008, 0x10400013, 0x8c0000f, 0x1400009, 0x1f534c, 0x25000002,
+    0x1f4ece, 0x1f4fc1, 0x4e400013, 0xdc00002, 0x280000e, 0x800009, 0x800007, 0x800014,
+    0x8c00005, 0x1f5389, 0x1f55cf, 0x1f5193, 0x10400006, 0x80000e, 0xcc00003, 0x10400013,
+    0x1040000b, 0x1f51c9, 0x1040000c, 0x1f5452, 0x5000005, 0x5000013, 0x80001a, 0x1f5494,
+    0x800012, 0x800015, 0x5000009, 0x800007, 0x800016, 0x1f5249, 0xcc00013, 0x1f5141,
+    0x1f54c1, 0x280000e, 0xd000005, 0x1f5687, 0x8c00012, 0x500001a, 0x1f53ce, 0x800013,
+    0x8c00005, 0x1f5509, 0x1f5792, 0x1f5585, 0x1f5605, 0x1f530f, 0xd80000f, 0x8c00013,
+    0x2800012, 0xfc00012, 0x61800012, 0x2800015, 0x51f5415, 0x1f5908, 0x26c0000e, 0x25c00009,
+    0x8c0000e, 0x8c0000d, 0x25000005, 0x1400000c, 0x8c00009, 0x1f554e, 0x500001f, 0x280000e,
+    0xd400005, 0x14000012, 0x1f5712, 0x1400002, 0x33c00008, 0x1400001, 0x8c00001, 0x1400013,
+    0xd400008, 0xfc0002a, 0x1f4dd2, 0xdc00015, 0x280000d, 0x14000003, 0x1400007, 0x8c0000d,
+    0xd000012, 0x2800009, 0x140000c, 0x8c00009, 0x800003, 0xcc0000c, 0xcc0000d, 0x25000014,
+    0x25c00005, 0x1040000e, 0x1f5847, 0x1400005, 0x8c00012, 0x25000001, 0x80000d, 0x10400013,
+    0x800014, 0x140001a, 0x10400006, 0x1400007, 0x8c00009, 0x800014, 0x1400004, 0x7c0000b,
+    0x1040000c, 0xd400001, 0x1400008, 0x19400012, 0x8c0000f, 0x8c0000d, 0x280000d, 0x2800000e,
+    0x14000005, 0x1f57c9, 0x8c0000d, 0x1400017, 0x1f58cc, 0x2000014, 0xec00012, 0x800002,
+    0x25000002, 0x5000000, 0x8c0000d, 0x1400000d, 0x25000002, 0x8c00009, 0x25000014, 0x7000000,
+    0xd000009, 0xd00000b, 0x1c00003, 0x26c00013, 0x500000c, 0x14000004, 0x2800010, 0xcc0000b,
+    0x5000004, 0xd800001, 0x8c00010, 0x1f5a52, 0x8c00012, 0x8c0000d, 0x25000010, 0xd000010,
+    0x8c00015, 0x8c00018, 0x500000e, 0xd000014, 0x8c00014, 0x1f5bce, 0x1f5a9a, 0x5000013,
+    0x500000f, 0x1f5b12, 0x8c00005, 0x2000014, 0x1f5814, 0x8c0000f, 0x2000017, 0x5000012,
+    0x14000013, 0x8c00014, 0x1f5889, 0x1f5b88, 0x26c0000e, 0x200002a, 0x1f5c41, 0x7800014,
+    0x4d5f5ccc, 0x1f5c12, 0x1f5c85, 0xd5f5ad2, 0xd9f5a05, 0xf800013, 0x4ddf5d8e, 0x2800004,
+    0x7c00001, 0x10400014, 0x1f5e92, 0x2d800014, 0xd400005, 0xd800009, 0xd9f5d01, 0x27800012,
+    0x280000d, 0x7c00004, 0x7c00003, 0x2800005, 0x15f5dc7, 0x8c00008, 0x1f5e54, 0x1400006,
+    0x800005, 0x1400007, 0x8c0000f, 0xd800001, 0x1f5f10, 0xd00000f, 0x1f5f4e, 0x5000010,
+    0x31400013, 0x1f6047, 0xf800014, 0x1f5d54, 0x1400001, 0x4b400008, 0x1f5ece, 0x140001a,
+    0x2740000b, 0x8c00001, 0x8c00009, 0x8c00008, 0x1400005, 0x1f5fd3, 0x1f5e14, 0x800004,
+    0x1f5f8f, 0x8c00014, 0xd00000e, 0x1f608e, 0x800017, 0x1400006, 0xd400009, 0x8c0000d,
+    0x8c0000e, 0x1f60d4, 0x8c00015, 0x1e400003, 0x19400006, 0x4d400014, 0x1f6013, 0x1f6152,
+    0x14000012, 0x4dc00014, 0x8c00001, 0x26c00012, 0x5000005, 0x8c00009, 0x8c0000e, 0x1f61c9,
+    0x8c0000f, 0xd000003, 0x14000003, 0x14000010, 0xd400009, 0x4cc00015, 0x2a000002, 0x800007,
+    0x500000b, 0x1f6341, 0x7c00004, 0x1f6553, 0x1f63d4, 0x1f6645, 0x8c0000e, 0x8c00010,
+    0x10400005, 0x7c00009, 0x1f6583, 0x1f6381, 0x1f6292, 0x1f020d, 0x1400000, 0x1f6245,
+    0xcc00014, 0x8c00012, 0x140000e, 0x800003, 0x7800003, 0x7c00015, 0x1040000c, 0x1f6197,
+    0x1400003, 0x8c00006, 0x800010, 0x40000c, 0x780000b, 0x1f6505, 0x1f6681, 0x8c0000d,
+    0x14000002, 0x1400017, 0x1f6312, 0x10400013, 0x5000015, 0x26c00007, 0x1f6709, 0x1180000e,
+    0x800004, 0x7c00014, 0xd40000c, 0x800007, 0x26c0000e, 0x8c00013, 0x8c00010, 0xc80001a,
+    0x1f6852, 0x1f64d3, 0x1f65c9, 0x80000e, 0x10400014, 0x40000c, 0x800014, 0x800012,
+    0x8c0001a, 0x1400001, 0x1400000, 0x1f6612, 0x25000001, 0x275f6741, 0x80001a, 0x1400005,
+    0x500000c, 0x1f6785, 0xd400009, 0x26c0000e, 0x1f6905, 0x1f68c9, 0x800013, 0x25000001,
+    0x140000e, 0x5000001, 0xcc00004, 0x1f67cf, 0x800015, 0x1f6a08, 0xd800005, 0x9f6894,
+    0x5000012, 0x2a000005, 0x61c00015, 0xd800005, 0x1f69d2, 0x8c00015, 0x25c00013, 0x4d800013,
+    0x8c00008, 0x1400000e, 0x5000009, 0x280000e, 0x8c00009, 0xd00000f, 0x1f694e, 0x1f6cc1,
+    0xd00001f, 0x1f6b0e, 0xd400012, 0x29c00015, 0x8c00014, 0x2800004, 0x1f6993, 0xd000001,
+    0x1f6b41, 0x280000e, 0x1c0000e, 0x500000c, 0x4d40000b, 0x5000004, 0x280000d, 0x1940000e,
+    0x1f6a8f, 0x19400015, 0x2800013, 0x2540000c, 0x1f6b85, 0x1c0000c, 0x280000b, 0x1f6e0e,
+    0x29c00005, 0xd000009, 0x27400012, 0x26800001, 0x26c00013, 0x4d400001, 0x25400014, 0xec0000e,
+    0x1f6f45, 0x4d400005, 0x4d00000c, 0x26800001, 0x1f6dc5, 0x46400008, 0x8c00009, 0x1f6d45,
+    0x2800005, 0x400015, 0x15800007, 0xd400009, 0x1f6c4e, 0x8c00015, 0x5000005, 0x1f6bd2,
+    0xd40000c, 0x4d5f6f85, 0x1f6ec5, 0x48c0000e, 0x27400003, 0x1f7085, 0x26800009, 0x26000001,
+    0x25400005, 0x8c00013, 0x26800001, 0x25c00009, 0x1f6c93, 0x1f6d94, 0x1f6e45, 0x1f7009,
+    0x4f400001, 0x25000003, 0x1f7448, 0x8c00012, 0x1f70c5, 0x25c00009, 0x26c00013, 0x59400005,
+    0xd80000f, 0x26c00005, 0x500000e, 0x1f74c5, 0xd400008, 0x25000001, 0x1f6e95, 0x1f7185,
+    0x19400009, 0xd400012, 0xd000012, 0x1f7245, 0xd40000c, 0xd400012, 0x4cc00013, 0x1f7345,
+    0xd000003, 0x1f7112, 0x26c00012, 0x26000012, 0x29c00005, 0x62000005, 0x1f7503, 0x56800001,
+    0x26c00014, 0x1f7205, 0xd40000c, 0x4d5f7405, 0xd400001, 0x1f6a53, 0xd800008, 0x27400009,
+    0x1f7553, 0x1f76c5, 0x29df7645, 0x4d400012, 0xd40000c, 0xd80000f, 0x1f7754, 0x1f778c,
+    0x26400012, 0xd40000c, 0x1f77c5, 0x1400001, 0x27400013, 0x1f75d2, 0x4d40000e, 0x2800000f,
+    0x25000013, 0x2000015, 0x2000015, 0x25400005, 0x2600000f, 0x2000000, 0x26800001, 0xd400012,
+    0x26800001, 0xd400001, 0x2000005, 0x1f7b85, 0x1f7685, 0x26000012, 0xd400009, 0xd400008,
+    0xd40000c, 0x2600000c, 0x1f7a48, 0xd40000e, 0xd40000f, 0x2000000, 0x5380000f, 0x1f6f12,
+    0x62800012, 0x1f7952, 0xd400015, 0x27800001, 0x1f7815, 0x26400015, 0x1f7845, 0x4d5f7985,
+    0x8c00001, 0x200000c, 0x1f7b45, 0xd800009, 0x62c00005, 0x26c0001a, 0xd40001f, 0x54000013,
+    0xd40000f, 0x6240000f, 0xd400001, 0x1f7913, 0x27400012, 0x25c00001, 0x1f79c5, 0xd400015,
+    0xd000005, 0x1f7bc5, 0x26c00005, 0x27400012, 0x4cc00013, 0x1f7a83, 0xd400001, 0x2000014,
+    0xd000005, 0x26c00005, 0x2000014, 0xd80001f, 0x8c00012, 0xd40000f, 0x26400012, 0x4e400013,
+    0x26c00008, 0xd400001, 0x8c00009, 0x1f7d54, 0x2680000f, 0x8c0000e, 0x1400000d, 0xd400012,
+    0x4ec00006, 0x4cc0000f, 0x8c00014, 0x140000e, 0x3b80000c, 0x4c800002, 0x4dc00004, 0xcc00014,
+    0x5000003, 0x7c00013, 0x4dc00009, 0x5000005, 0x4dc00004, 0x1400001, 0x8c00001, 0x27400014,
+    0x8c00005, 0xf80000e, 0xd00000e, 0x2800001, 0xd000005, 0x4d40000e, 0x1f7ac5, 0xd400001,
+    0x800015, 0x4dc00009, 0x7df7e94, 0xd000001, 0x1c00013, 0x25400005, 0x4d800005, 0x4cc00005,
+    0xd400012, 0xcc0000f, 0x180000e, 0x25000004, 0x180000f, 0x4dc0000e, 0x5000000, 0xdc00014,
+    0xd00000b, 0x26800001, 0x10400004, 0xd800005, 0x980000b, 0x1f7c05, 0x1c0000d, 0x8c0000e,
+    0x1400000e, 0x4cc00014, 0xd000001, 0x14000012, 0xd1f8081, 0x80000f, 0x1800014, 0xd80000f,
+    0x1f7f45, 0x1f7dd3, 0xd5f7ed2, 0x4d400005, 0x19400003, 0x1180000d, 0x4dc0000e, 0x2800014,
+    0x1f7e45, 0x800005, 0x1f8205, 0x30000002, 0x1f7f05, 0x800005, 0x4e400013, 0x80000f,
+    0x1f7f8e, 0xcc0000c, 0x1f8248, 0xd00001a, 0x2800013, 0x1c00010, 0xd000015, 0x25000010,
+    0x80000e, 0x1f83c5, 0xd400017, 0x8c00004, 0x1f81c1, 0x27400013, 0x1f82c5, 0x400005,
+    0x1f8385, 0x1c00017, 0xd400006, 0x140000c, 0x1c0001a, 0xcc0000c, 0xa000000, 0x1f7fc1,
+    0x1f800f, 0x800000, 0x63000001, 0x1f8445, 0x4d5f8481, 0x5000008, 0x1000015, 0xd400005,
+    0x1f8285, 0x6400029, 0x280000f, 0x6c00009, 0x1f8309, 0x2800012, 0x15f8341, 0xd400001,
+    0x100001f, 0x26000012, 0xd80000f, 0x1f86c5, 0x4d400005, 0x1f8692, 0x25000001, 0x1c00013,
+    0x2500000f, 0x8c00009, 0x27400013, 0x1400008, 0x1f84c5, 0x5000013, 0xd400010, 0x29df8812,
+    0x26800009, 0xd000009, 0xd400014, 0xd400001, 0x2800000e, 0xd400001, 0x4cc00005, 0x1c00029,
+    0x53400013, 0x1f8505, 0xdc00014, 0x8c0000e, 0x31000013, 0x4d400005, 0x1f8794, 0xd400001,
+    0x1f8605, 0xd800005, 0x4d400012, 0x1f8585, 0x5000005, 0xcc00005, 0x2a00001a, 0x4ddf864e,
+    0x5000003, 0x1f8755, 0x2a000014, 0x1f8714, 0x25000005, 0x2800001, 0xc80000d, 0x8c00012,
+    0x1f85ce, 0xdc0000e, 0x4d40000e, 0xc800012, 0x1c00002, 0x100000d, 0x1f87c5, 0xd400009,
+    0x980000f, 0x1400000, 0x1c00014, 0x4cc00008, 0x800007, 0x100000c, 0xa000007, 0x1c00016,
+    0x800003, 0x1c0000c, 0x26c00013, 0x1400009, 0x26c00014, 0xd400009, 0x1c0000b, 0x800000,
+    0x1f8a52, 0x1f8a94, 0x100000c, 0x25c00005, 0x13400005, 0xd40000c, 0x26400001, 0x26c00005,
+    0x1c00013, 0x32000012, 0x26000001, 0x4cc00013, 0x26c0000e, 0x2800029, 0xfc00001, 0x1f8b07,
+    0x1c0001a, 0x1f8b42, 0x8c0000c, 0x1f8d08, 0x2680000f, 0xd400010, 0xd400001, 0x25000013,
+    0x1f8ac8, 0xd400014, 0xd00000e, 0x1f8c09, 0x31400014, 0x57800005, 0xd000005, 0xfc00012,
+    0x1f8d52, 0x15800012, 0x1f8ccc, 0x200000c, 0xec00005, 0x800005, 0x26c00013, 0x800004,
+    0x8c00002, 0x25c00005, 0x1f8c48, 0x4cc00006, 0x1f8b92, 0x1f8d85, 0x2800008, 0x5000012,
+    0x5000015, 0x25000009, 0x1f894e, 0x1f8bd2, 0x25c00009, 0x8c00009, 0x2740000c, 0x1400014,
+    0xdc00012, 0xdc00012, 0x26c0000e, 0x4d400012, 0x1f8e08, 0x26800003, 0x140000b, 0x26400009,
+    0x4d80000e, 0x1f8e54, 0xd000005, 0x2740000c, 0x4d000013, 0x14000009, 0x1400013, 0x1f9008,
+    0x5000001, 0x4dc00009, 0x8c00012, 0x10400005, 0x7800002, 0x1f8c92, 0xd400012, 0x4ec00005,
+    0x25000006, 0x3b800007, 0x10400005, 0x63400001, 0x1400013, 0xd000005, 0x3b80000c, 0x4d5f8f85,
+    0x1f8dd4, 0x80000e, 0x800014, 0x800009, 0x8c00012, 0x26800003, 0x38c0000c, 0x6340000d,
+    0x80000e, 0x8c00017, 0xd800001, 0x26c00005, 0x780001a, 0x80000e, 0xd000005, 0x3bc0000e,
+    0x7c00000, 0x800017, 0x800014, 0xddf9052, 0x10400007, 0x5000012, 0x4f400001, 0x25000007,
+    0x27400013, 0x10400007, 0x1f9285, 0x1f9394, 0x800006, 0xd400012, 0xd000001, 0xd400001,
+    0x1f9449, 0x3b80000b, 0x14000009, 0x7800013, 0xd40000f, 0x4d1f8fce, 0x10400014, 0x8c00004,
+    0x800014, 0xd400001, 0x10400004, 0xd400012, 0x1f90c5, 0xd000009, 0x8c0000e, 0x1f93ce,
+    0x3b80001a, 0x5400000c, 0xd000002, 0x1f95d2, 0xd40001f, 0x26c00003, 0x80000c, 0x1400000e,
+    0xd000009, 0x5000012, 0x2500000e, 0x26c0000e, 0xd400001, 0x29c0000e, 0x27400013, 0x4cc00014,
+    0x26800005, 0xd80000e, 0xd800009, 0x1f940e, 0x1f9589, 0x4e40001a, 0x26c00009, 0x25800009,
+    0x63800014, 0x2740000e, 0xd800000, 0x1f91d2, 0x1f9705, 0xd80000e, 0x26400003, 0xd80000e,
+    0x53400001, 0x26400009, 0x1f9305, 0x639f934e, 0x1f9745, 0x26c00012, 0xd800012, 0x2740000e,
+    0x27400012, 0x1f978d, 0x63df9552, 0xd800000, 0x1f948e, 0x26c00001, 0x2580000e, 0x4cc00005,
+    0xd800002, 0x53400012, 0xd800009, 0x64000012, 0xd80000f, 0x1f964f, 0xd800009, 0x1f97c5,
+    0x26c0000c, 0xd800009, 0x1f9845, 0x26c0000f, 0xd800009, 0x1f94d3, 0xd800013, 0xd80000e,
+    0x1f9612, 0x1f968e, 0x2640000c, 0xd800010, 0x6440000e, 0x26400012, 0x27400005, 0x1f9892,
+    0x26c0000f, 0xd800000, 0x53400012, 0xd000014, 0x4cc00001, 0x29c00012, 0xd800009, 0x1f98c3,
+    0x2740000e, 0x1f9812, 0x1f96c5, 0x4cc00005, 0x1f990e, 0xd000012, 0xd000014, 0xd80000e,
+    0xd80000e, 0x26c00005, 0x63800007, 0xd800014, 0x26c00001, 0xd800000, 0x2640000f, 0x1f9945,
+    0x2640000e, 0x1f9a03, 0x1f9d09, 0xd800013, 0x1f9985, 0x1f99d4, 0x26c00010, 0xd000012,
+    0x1f9ac5, 0x4d800005, 0x4cc0000e, 0x1f9a94, 0x26c00012, 0xd9f9b8c, 0x2640000c, 0x4c800008,
+    0x1f9b4e, 0x64800005, 0x1f9c83, 0xd000005, 0x1f9c52, 0xd000001, 0x1f9c05, 0x1f9b05,
+    0x1f3b53, 0x27400003, 0x31000012, 0x1f9506, 0x1f9bc5, 0x1f9d94, 0x4d800005, 0x1f9f12,
+    0x53400015, 0x1f9e09, 0x1f9e87, 0x26c00005, 0x1f9cc5, 0x26c00014, 0x4cc00013, 0x53400001,
+    0x1f9ece, 0x1f9d45, 0x1f9dc5, 0x1f9f88, 0x26c00001, 0x26c00001, 0xd800012, 0x1fa0c6,
+    0xd800013, 0x26c00001, 0x5340000c, 0xd800012, 0x64c00013, 0xd80000e, 0xd800014, 0x4d800012,
+    0xd800006, 0x1f9e45, 0x1f9f45, 0x27400013, 0x26c00012, 0x1f9fc5, 0x1fa005, 0x26c00001,
+    0x4cc00009, 0x63800014, 0x53400003, 0x63dfa105, 0xd800001, 0x1fa048, 0xd800000, 0x26c00012,
+    0x1fa147, 0x2640000e, 0x5000005, 0x7c00009, 0x26c0000c, 0xd000000, 0x26c00015, 0xcdfa2c6,
+    0x1fa181, 0x2f800008, 0x1fa1c1, 0x26c00014, 0x63c00001, 0x2f80000c, 0xd000012, 0xd80000b,
+    0x1fa209, 0x26c00012, 0x1fa092, 0xd80000d, 0x26c00003, 0xd800012, 0xcc0000c, 0xd800002,
+    0x2f800017, 0xd80000b, 0x1fa28e, 0x4cc00013, 0xd80000d, 0x1fa305, 0xfc00004, 0x26400009,
+    0xd800014, 0xd80001f, 0x1fa352, 0x26c00001, 0x28000004, 0xd80000e, 0x1fa25f, 0x1fa4d3,
+    0x28000008, 0x1fa44e, 0xcc00029, 0x2800004, 0x4cc00005, 0x1fa487, 0xd800009, 0xd80000e,
+    0x7c00000, 0x63c00005, 0x4cc0000f, 0x1fa3cc, 0xd80000f, 0x4cc0000e, 0xd80000b, 0x4cc00005,
+    0xd00000e, 0x2800000c, 0x2800008, 0x2800000e, 0x7c00006, 0x26c0000c, 0x5000012, 0x1b400013,
+    0x26c00009, 0xd80000c, 0x5000004, 0x6540001f, 0xd00000b, 0x1fa412, 0x1fa745, 0x15800017,
+    0x28000014, 0x65000017, 0x1fa585, 0xd80000b, 0x1fa792, 0x2800015, 0x65800006, 0x28000014,
+    0x2800014, 0xd000007, 0xd80002a, 0x1fa510, 0x2800000e, 0x280000c, 0x1fa847, 0xd800013,
+    0x4d800013, 0xd80000e, 0xd00000d, 0x1fa8cf, 0x1fa541, 0x26c00001, 0xcc00005, 0xcc00000,
+    0x28000006, 0x7000013, 0xd00000c, 0x28000014, 0x2800005, 0x29c00015, 0xd000013, 0x1faa53,
+    0x1faa86, 0x28000006, 0x2800013, 0x65c00013, 0xd00000e, 0x26c00005, 0xa000005, 0xa000012,
+    0x1fa605, 0x65000017, 0xd00000e, 0xd800012, 0x2800001a, 0x2800000e, 0x4cc00002, 0x1fa7c5,
+    0x1b400009, 0xd000004, 0x27400014, 0xd000005, 0xd000007, 0xd000005, 0x2800007, 0x37c00005,
+    0x1fa805, 0xd800013, 0xd000003, 0xd000005, 0x280000b, 0x1fa894, 0x1fac13, 0x4cc00013,
+    0x4cc00014, 0x1fab0c, 0xd800009, 0x1b400005, 0xcc00003, 0xcc0000d, 0xd80000d, 0xcc00006,
+    0xd00000e, 0x27400005, 0x66000009, 0x5000009, 0x2800009, 0x28000005, 0xfc0000e, 0x4cc00005,
+    0x27400014, 0x1fa98c, 0x26c00001, 0x1faa12, 0x1fa38e, 0x2580000c, 0xd800002, 0xd00000e,
+    0xd000001, 0x1fa712, 0xd80000e, 0xd80000e, 0x280000e, 0x2800007, 0x7c00005, 0xd000014,
+    0x7000000, 0x53400009, 0xd000004, 0xd1fa9c9, 0x1fad14, 0xd000009, 0x280000b, 0x28000014,
+    0xd800013, 0xa000007, 0xd000009, 0xd000014, 0x66400007, 0x1fac4e, 0x28000002, 0xd800012,
+    0x1fab8d, 0xd800000, 0x28000006, 0x1faac9, 0xa000014, 0x28000008, 0x63c00012, 0x2800000b,
+    0x66800005, 0x66c00012, 0x63c00012, 0x2800000b, 0xd000010, 0x1facce, 0x26400008, 0x26400009,
+    0xd80000c, 0x1fac85, 0xd80000e, 0x2800017, 0xd800009, 0x1fad8e, 0xd800012, 0xd800000,
+    0x1fad52, 0xd000014, 0x4cc0000c, 0xd800009, 0x28000014, 0x1fadc1, 0xd000005, 0x6700000e,
+    0x15800005, 0x4cc00013, 0x28000004, 0x2800013, 0x26400001, 0x26c00009, 0x2800013, 0x1fae05,
+    0x2740000b, 0x7000015, 0xd800000, 0x2800005, 0xd800007, 0x26400006, 0x26c00003, 0xd800002,
+    0xd800000, 0xd800002, 0xd000013, 0xd80000c, 0x64800001, 0xd800012, 0x7c00000, 0x2800002,
+    0x26c0000f, 0x2a80001f, 0x27400013, 0x1fae89, 0xd800017, 0xd800002, 0x1fae4e, 0xd00000e,
+    0x280000c, 0x28000017, 0x27400003, 0x4cc00013, 0x63dfaf12, 0xd800009, 0x67400012, 0xd000013,
+    0x1faec1, 0x28000012, 0xd80000d, 0x63c00013, 0x28000013, 0x4c800005, 0x1faf54, 0x1faf85,
+    0xd800012, 0x26c00001, 0x64000012, 0xcc0000e, 0x2dc00006, 0xcc00003, 0xd00000b, 0x3d80000e,
+    0xd00000b, 0x1b400015, 0x2800003, 0x4d800005, 0xd000001, 0x1fb045, 0x4d800012, 0x27400010,
+    0x51fb005, 0xd80000e, 0xd80000e, 0x26400012, 0x4cc00013, 0xd800012, 0xa000001, 0xd800012,
+    0xfc0000e, 0x63dfafd2, 0x700000d, 0xd800002, 0x1fb0c5, 0x1fab54, 0xa00000f, 0xd800012,
+    0x5000014, 0x7000013, 0x4d800017, 0x1d800013, 0x7000005, 0x7000017, 0x1fb089, 0xa000013,
+    0x1fb105, 0x1fb185, 0x280000c, 0x7000006, 0x1fb245, 0x1fb145, 0x280000e, 0xd800009,
+    0xd800000, 0x5000005, 0x6c00005, 0x1fb1c5, 0xd800013, 0xd800000, 0x4d800005, 0xfc0000e,
+    0x5000005, 0xd800005, 0x67800029, 0x26400002, 0x7000017, 0x28000007, 0x4cc00007, 0x27400015,
+    0xd000004, 0x4cc00012, 0xd800009, 0x63c00013, 0x28000004, 0x500000e, 0x63dfb294, 0x1fb354,
+    0x7000007, 0x1ec00000, 0x26c0000d, 0x26400012, 0x27400009, 0x1fb208, 0x1fb301, 0x67c0000d,
+    0x1fb3d2, 0x28000009, 0x5000004, 0x28000004, 0x1fb2d2, 0x280000b, 0xfc00002, 0x65000013,
+    0x4cc00006, 0x700001f, 0xfc00006, 0xd000001, 0x26dfb541, 0x1fb48c, 0x1fb50e, 0xd000014,
+    0x1fb38e, 0x1fb4c5, 0x4d80000e, 0xd00000f, 0xd800004, 0x4d800005, 0x1fb454, 0x4cc00014,
+    0x4cc00014, 0x500000c, 0x1fb5cd, 0x1fb601, 0xd80000d, 0xd800002, 0x1fb41a, 0x1fb592,
+    0x27400012, 0x5000000, 0x1fb845, 0x5000009, 0x2800001, 0xd800018, 0x1fb654, 0xfc00012,
+    0x2800000c, 0x2800000d, 0xd800012, 0x2800007, 0x4cc00003, 0x1fb712, 0x5000009, 0x28000013,
+    0x29c00005, 0x27400012, 0xcc00006, 0xcc00009, 0xcc0000e, 0xd80000c, 0x280000e, 0x1fb88e,
+    0x5000006, 0x1fbad7, 0xcc0000c, 0x5000014, 0xd800013, 0x11c0000c, 0xc80000e, 0xcc00008,
+    0x2800005, 0x1fb794, 0x11c00009, 0x1b400009, 0xc800007, 0xd800012, 0x280000e, 0x4d800012,
+    0x28000014, 0xd800013, 0x2800012, 0x26400008, 0x6380000e, 0x2800005, 0xd00000d, 0x68000017,
+    0x28000014, 0x4cc00014, 0xd800012, 0x29c0000c, 0xd000015, 0xd800001, 0x2800014, 0x1fb692,
+    0x25800009, 0xd000012, 0x26c00005, 0xcc00012, 0x25800012, 0x26c00005, 0x1fb95a, 0xd80000e,
+    0x1fba4e, 0x1fb9d2, 0x65000007, 0x26400009, 0x2800014, 0x26c00010, 0x2800008, 0xcc00005,
+    0x63c0000c, 0x1fb6c9, 0x4d800007, 0x26400015, 0x4cc00013, 0x1b400005, 0x5000017, 0x1fb8d2,
+    0x28000005, 0x37800012, 0xd800012, 0xd000012, 0xd00000e, 0x1fbb0c, 0x63c00005, 0xd80000e,
+    0x2800014, 0xd800012, 0x26c00012, 0xd80000e, 0x1fbb92, 0x700000f, 0xd000005, 0xd000005,
+    0x2800013, 0x1fbc53, 0x280000e, 0x28000014, 0xd00000c, 0x1fba92, 0x65000007, 0x1fbcc2,
+    0xd000010, 0xd800000, 0xd80001a, 0x2800006, 0xd80000e, 0x2800014, 0xa000012, 0x1fba12,
+    0x280000b, 0xa000003, 0x1fbc93, 0x280001a, 0xa000014, 0x1f3ac8, 0x1fbbc1, 0xd80000c,
+    0x1fbd93, 0x1fb912, 0x2800007, 0xd80000c, 0xd800013, 0x26c00001, 0x1fbc12, 0x2800000c,
+    0x4cc00007, 0x26c00001, 0xcc00001, 0x2800013, 0xd000006, 0x1fbdd4, 0x1fbb53, 0x2800015,
+    0x5000012, 0xd00000b, 0x28000017, 0x5000014, 0x28000006, 0x5000000, 0x7c00005, 0x1fbe12,
+    0x5340000c, 0xcc00005, 0x68400001, 0x1fbec9, 0x26c00001, 0x1fbf52, 0x4cc00010, 0x1b40001f,
+    0x6500001a, 0x4cdfbd13, 0xcc00009, 0xd800005, 0xd000000, 0x2800002, 0xd00000e, 0x15800000,
+    0xd00000e, 0x15800004, 0x1fbe45, 0xd000013, 0x2800003, 0x2a80000e, 0x1fbf12, 0x2800005,
+    0x2800013, 0x1fbfc5, 0x4cc00002, 0x27400001, 0x2800001, 0x2800007, 0x4cc00006, 0x2800014,
+    0x53c00013, 0x65000013, 0x53400008, 0x28000014, 0x1fbe8c, 0x25800015, 0x6880000e, 0x26c0001f,
+    0xcc00005, 0xfc00014, 0xd00000d, 0x1fc053, 0xd80000e, 0x7c0000e, 0xcc00005, 0x1b400009,
+    0xcc00009, 0x1b400005, 0x2800012, 0x2800012, 0x7000000, 0x2800000, 0x1b40000f, 0x4c800001,
+    0x7000015, 0xd000000, 0xd000007, 0xd000013, 0x1fc005, 0xd000005, 0x2800000b, 0x5000002,
+    0x66400006, 0xd000007, 0xd800012, 0x15800005, 0x4d800005, 0xd000005, 0x2800000c, 0x7c0000c,
+    0x1fbd4c, 0xd000010, 0xd000006, 0x2800002, 0x1fbf93, 0xd80000c, 0x1fc0cd, 0xa000007,
+    0x280000d, 0xd80000b, 0xa000003, 0x2800000c, 0xd80000f, 0xcc00009, 0x28000014, 0xd000007,
+    0x1fc105, 0x63c0000e, 0x2800017, 0x2800000b, 0x280000c, 0x2800000d, 0x7000014, 0x26c00002,
+    0x5000005, 0x7c00000, 0xa00000d, 0x1fc093, 0xcc00012, 0x27400005, 0x65000007, 0xd80000e,
+    0xd000017, 0x1b400005, 0x4cc00014, 0x5000013, 0xcc00005, 0xd000016, 0xd800014, 0x5000000,
+    0x1fc141, 0x5000002, 0x1fc1c5, 0xcc0000e, 0x27400001, 0x5000006, 0x26c0000c, 0x7000000,
+    0xcc00013, 0x26c00009, 0x7000000, 0x28000005, 0xcc00005, 0x1fc243, 0x7000001, 0x2740000b,
+    0xd800004, 0x5000012, 0xcc0000f, 0x1fc194, 0x7000009, 0x68dfc213, 0xa000005, 0x7000009,
+    0x7000013, 0xa00000e, 0xa000002, 0x2800005, 0x700000d, 0xa000015, 0xa00000e, 0x2800006,
+    0xa000005, 0xd800001, 0x7000004, 0x700000c, 0x280000b, 0x4cc00013, 0x28000013, 0xd800004,
+    0x28000014, 0x7c00014, 0x500000c, 0x7000007, 0x700001f, 0xa00000b, 0x1fc312, 0x53400015,
+    0x1fc292, 0x28000006, 0x65000007, 0x66400008, 0xcc00015, 0x700002a, 0x280000b, 0x280000b,
+    0x64800013, 0x500000c, 0x2740000b, 0x280000d, 0xd80000c, 0xd800015, 0x2800013, 0x28000013,
+    0xd000000, 0x280000b, 0x63800009, 0x2800002, 0x27400005, 0x26c00014, 0xcc00013, 0x4cc00013,
+    0xd800006, 0xd000007, 0x2800008, 0x4cc00002, 0x2800002, 0xcc00002, 0x28000007, 0x28000013,
+    0xcc0000d, 0x2800007, 0x1fc4ce, 0x1fc504, 0x1fb748, 0x15800003, 0xcc00013, 0x1fc3cb,
+    0x7c00003, 0xd000009, 0x2640000c, 0xd000013, 0x2800005, 0x1fc385, 0xcc00014, 0x26c00012,
+    0x26c00029, 0xcc0000d, 0x2800007, 0x26c00001, 0x1fc713, 0x1fc848, 0x2800001a, 0x275fc549,
+    0x28000007, 0x63800004, 0x28000014, 0x27400005, 0x63c0000e, 0x2800013, 0x2800013, 0x4d800017,
+    0x1fc412, 0x26c00003, 0x2800002, 0x4c800010, 0x26400009, 0x66400029, 0x1fc44e, 0x1fca48,
+    0x7c0000f, 0x1fc48e, 0xd80000e, 0x5000000, 0x280000c, 0x1fc792, 0xd80000c, 0x53400012,
+    0xd800009, 0x4cc0000d, 0x37800009, 0x1fc752, 0x26400012, 0x26400008, 0x1fc7d2, 0x7000007,
+    0x6c00001, 0x2800007, 0xd00000c, 0x6c00007, 0x66400007, 0x6700000e, 0xd800008, 0x67c00002,
+    0xd800007, 0xd800009, 0x4c800002, 0x27400009, 0x4d800013, 0xd000000, 0xd800014, 0x28000013,
+    0x5000005, 0xd00000e, 0xd000009, 0xd800004, 0x280001a, 0x1fc348, 0x2740000e, 0x4d800029,
+    0xd800009, 0x68000001, 0x63c00001, 0x29c00005, 0xd80000e, 0x1fc8c5, 0x26400009, 0x1fc888,
+    0xd800012, 0x59800007, 0x1fc6c5, 0x1b400013, 0x4d80000c, 0x26400009, 0x1fc814, 0x4d80000f,
+    0x1fcad4, 0xcc0000e, 0x2800012, 0xcc00006, 0x7c0000e, 0xd800013, 0xd800012, 0x68000017,
+    0xcc0000f, 0x7c0000e, 0xcc00009, 0xcc00005, 0x500002a, 0x2800005, 0x2800009, 0x2800006,
+    0x1fc945, 0x1fc905, 0x280000d, 0xd000014, 0x1fcb52, 0x1fca85, 0x63dfcbd2, 0x26c00003,
+    0xd80000e, 0x7000002, 0x20400000, 0x63c0000f, 0x15800015, 0x26c00010, 0x2640000c, 0x2740001f,
+    0x26c00003, 0x2800015, 0x2800014, 0xd80000e, 0x65c00013, 0x26400001, 0x1fce4b, 0x1fccd4,
+    0xcc0000e, 0xd800007, 0x63dfcd52, 0x2800005, 0xd000005, 0x1fca13, 0xd000005, 0x7000000,
+    0x6c0000f, 0xd000004, 0x280000b, 0x2800013, 0x4cc00006, 0x7000007, 0x4cc00006, 0xd80000d,
+    0x67c0001f, 0x500000e, 0x28000013, 0x2800005, 0x2800000e, 0x2800007, 0xd80000e, 0x2800014,
+    0xd800014, 0x67c00008, 0xd000006, 0x1fd005, 0x4cc00014, 0x1fce97, 0x7c00013, 0x8800000,
+    0x4cc0001a, 0x66400013, 0x28000014, 0x500000b, 0x28000012, 0x28000012, 0x63c00009, 0x2800007,
+    0x4d800029, 0x1fcc05, 0xd00000e, 0x26400012, 0x1fd092, 0x1fcf05, 0x7c00000, 0x1fce05,
+    0x2740000b, 0x1fcc45, 0x7c00005, 0x28000014, 0x2800014, 0x26c00012, 0x69000012, 0x26c00001,
+    0xd000012, 0x1fcec5, 0x2800009, 0xcc00006, 0x4fc00005, 0x2800014, 0x7c0000e, 0x1fd154,
+    0x66c0000e, 0x4d800017, 0xcc00008, 0x4c800002, 0x280000c, 0xd000012, 0x1fcdc9, 0x4cc00003,
+    0x64c00009, 0xcc0001a, 0x1fd301, 0x64800008, 0xc800013, 0x2800014, 0x26c00009, 0xd000014,
+    0xd800013, 0xd000013, 0xcc00015, 0x7000017, 0xd800012, 0x275fc2ce, 0x53400010, 0xd80000c,
+    0xd80000e, 0x1fd052, 0x1fd292, 0xd800009, 0xd80000c, 0xd800009, 0xd800000, 0x1fd20e,
+    0xd800009, 0x63c00012, 0x1fd349, 0xd80000e, 0xd80000c, 0xd800001, 0x1fcfce, 0x1fd1c5,
+    0x2580000f, 0xd800005, 0xd00000d, 0x26400015, 0xd800012, 0x28000007, 0xd800013, 0xd000013,
+    0xd800009, 0xd80000c, 0xd800002, 0xd80000e, 0xd800009, 0x7c00012, 0xd000005, 0xd800012,
+    0xd000004, 0x2800005, 0xd000007, 0xc800013, 0xd80000e, 0xd800007, 0x1fd44e, 0xd000012,
+    0x280000d, 0x63c0000c, 0x26400012, 0xd800015, 0x280000b, 0xd800006, 0x1d800007, 0x2800013,
+    0x2800005, 0x1fd2c2, 0x1fd553, 0xd80001f, 0xd800010, 0x4cc00004, 0x2800017, 0x4cc00006,
+    0x7c00015, 0x500000f, 0x1fd5d3, 0x1fd385, 0x1fd3c5, 0x53400001, 0xd80000e, 0x1fd18e,
+    0xd800012, 0x7c00014, 0x6380000e, 0xd000005, 0x4cc00013, 0xd800013, 0xd00000e, 0x1b400012,
+    0xcc00013, 0x7c00005, 0x1fd493, 0x6940001f, 0x1fd412, 0x26c00014, 0x7c00005, 0x26c00005,
+    0x4cc00013, 0x27400009, 0x1b400001, 0x1fd253, 0x63c00009, 0x63c00008, 0x2800013, 0x63dfd4d2,
+    0xd800012, 0x2800005, 0x500000e, 0x26c00001, 0x1fd78e, 0x1fd885, 0x2800009, 0x27400008,
+    0xcc00001, 0xcc0000c, 0x26c00001, 0x1fd685, 0x1fd8c5, 0x1fd92a, 0xcc00014, 0x7c0000c,
+    0xcc00013, 0x28000004, 0xd000003, 0xd80000e, 0x26c00012, 0x1b400014, 0x500000c, 0xcc00004,
+    0xd000014, 0xcc0000e, 0xd80000e, 0xd800013, 0x2800005, 0xc800009, 0x7c00004, 0x1b400009,
+    0x7c00002, 0x500000c, 0xcc00005, 0xc800002, 0x2800000, 0x1b400017, 0x1fd513, 0xd00000e,
+    0x2800006, 0x2800005, 0xd000001, 0x1b40001a, 0x1b400005, 0x1b400015, 0xfc00012, 0xc80000e,
+    0xcc00001, 0x1fda49, 0x1b400013, 0xcc0000b, 0x1b400014, 0x1b400001, 0xcc0001f, 0x1fda85,
+    0x1fd612, 0x5000004, 0xcc00006, 0x1b40000c, 0x51fd82a, 0x1fdac5, 0x1fdb85, 0x1fd705,
+    0x1fdc90, 0x5000005, 0x1fd99f, 0xcc00012, 0x51fdcd4, 0x7c00001, 0x1fda05, 0xcc00013,
+    0xcc00002, 0x500001f, 0x51fd952, 0x11c0000b, 0x1fd9e9, 0x280000e, 0x4a000007, 0x28000004,
+    0xfc0000b, 0x28000009, 0x2800007, 0x1fdc0d, 0x1fd841, 0x500000c, 0xd000014, 0x28000007,
+    0x4d800009, 0x63c00001, 0x1fdbc9, 0x1fdb05, 0x28000012, 0x280000b, 0x28000012, 0x64400012,
+    0x7c00007, 0x1fdd93, 0x4d800013, 0xd80000e, 0x2800014, 0x7c00002, 0xd800012, 0x26400012,
+    0x1fde89, 0x7c00006, 0x1fddc5, 0x7c00008, 0xd800005, 0x7c00014, 0xd000014, 0x1fde14,
+    0xc80000d, 0xd000014, 0x1fde4c, 0xd800002, 0x6380000e, 0x26c00005, 0x1fdd0e, 0x1fdd45,
+    0xd80000f, 0xd000004, 0x4cc00006, 0x2800005, 0xd800012, 0x2800007, 0x1fdf45, 0xd80000e,
+    0x4cc00005, 0x1fdec6, 0x1fdf07, 0x1fdc46, 0x64800007, 0x7c0000e, 0x1fe00b, 0x1fe14c,
+    0xd800000, 0x1fe18c, 0x280000b, 0x1fdb52, 0x4d80000b, 0x28000013, 0x4cc0001a, 0x26400008,
+    0xd000009, 0xd000001, 0xd800017, 0x65c00013, 0x1fe052, 0xd000005, 0x27400009, 0x28000014,
+    0xd000012, 0x28000008, 0xd800005, 0x2800001a, 0x28000003, 0x280000b, 0x1fdf81, 0xd800004,
+    0xcc00012, 0x1fe10e, 0x1fe081, 0x1fdfc5, 0x26c00005, 0x28000014, 0x2800012, 0x1fe245,
+    0x6380000e, 0x5000009, 0x1fe0c1, 0x1fe1c5, 0xc800009, 0xc800002, 0xd800012, 0xd00000b,
+    0x2800000b, 0xd000005, 0x26400002, 0xcc0002a, 0x26c0002a, 0x1580000e, 0x26c0001f, 0x26dfe349,
+    0x26c00029, 0xcc0000c, 0xd800010, 0xcc00009, 0x65000014, 0xcc0000c, 0x26c0000f, 0x31400003,
+    0xcc00013, 0xd800004, 0x280000e, 0x280000e, 0x500000e, 0x1fe4cb, 0x51fe305, 0x1b400014,
+    0x0, 0x27400010, 0x63dfe212, 0xd1fe394, 0x32c0000e, 0x280000e, 0x1b400009, 0xa000009,
+    0x2640000d, 0x26c00005, 0x69800012, 0x1fe28f, 0x1b400019, 0xa00000e, 0x26400012, 0x6640000d,
+    0x7000001, 0x28000017, 0xa00000c, 0xd800010, 0x28000014, 0x1fe2d4, 0x700000d, 0xa000014,
+    0xd800009, 0x28000014, 0xa000007, 0x2800005, 0x2800014, 0x5000005, 0xcc00012, 0xcdfe50e,
+    0x27400001, 0xd00001a, 0x26c00029, 0xcc00001, 0x280000c, 0x280000d, 0xcc00006, 0xcc00002,
+    0x69c00008, 0x27400009, 0x68000012, 0x66000005, 0xcc00001, 0x1fe44d, 0x2800004, 0x68000017,
+    0x26400009, 0x1fe485, 0x1fe3d2, 0xd1fe545, 0x1fe409, 0x1b400014, 0x63dfe64e, 0xd000006,
+    0xd000009, 0x280002a, 0xcc0000f, 0x27400015, 0x5000007, 0xcc0000b, 0xcc00014, 0x1fe5c9,
+    0x27400015, 0x1fe603, 0x1fe588, 0xcc00013, 0xd00000c, 0xd000012, 0xd800012, 0xd800008,
+    0xd800009, 0xd800009, 0x63c0000e, 0xd1fe687, 0x1fe6cf, 0x26c0000c, 0x63c00013, 0x26400009,
+    0x2800000c, 0xd80000e, 0x63800004, 0xd000009, 0xcc00012, 0xcc0002a, 0x1fe741, 0xd800012,
+    0x53400001, 0x63c00012, 0xd80000e, 0x2800013, 0x700000b, 0xd800012, 0x1fe70e, 0x2800005,
+    0x27400013, 0xd800018, 0x5340000f, 0x67c00007, 0xd800012, 0x1fe84c, 0x4cc0000e, 0x26c00010,
+    0x7000004, 0xd000013, 0x7000004, 0x1fe814, 0x700000d, 0x2800013, 0x1fe7c5, 0x14c00000,
+    0xd800005, 0x5000007, 0x7c00002, 0x7c0000e, 0x7000008, 0x1fe78e, 0x14c00015, 0x7dfea02,
+    0xd00000e, 0xcc0000d, 0x1fe893, 0x4cc00014, 0xd800009, 0x1fe98e, 0x1fe945, 0xd800007,
+    0xd800009, 0xd800003, 0xd800015, 0x1feb08, 0xcc00010, 0x26c00014, 0x7000018, 0x27400015,
+    0x6dfe8d5, 0x4d800009, 0xd80000e, 0x6380000e, 0xd80000b, 0x1fea45, 0x1fe9d2, 0x63dfe912,
+    0xcc00004, 0x63c00012, 0x63c0000e, 0xcc00006, 0x1b40001a, 0xcc00012, 0x1b40000f, 0xd800012,
+    0x6380000e, 0xd800005, 0x280000c, 0x26c00012, 0x26c00014, 0xd80000d, 0x1fead3, 0x1feb4e,
+    0xcc00013, 0x1fea92, 0xd000004, 0xd000009, 0x4cc00006, 0x27400015, 0xd800012, 0x2800005,
+    0xa000012, 0x26c00012, 0x2640000e, 0xd80000e, 0x26400009, 0xd800018, 0x2640000e, 0x1febce,
+    0x26c00005, 0x63c00012, 0xd80000e, 0xd800009, 0x1feb88, 0x1b400005, 0x64c0000e, 0x27400003,
+    0x1b40000b, 0xcc00014, 0xd80000c, 0xd000009, 0x27400009, 0xd80000e, 0x1b400001, 0x1fec85,
+    0x68400005, 0xcc0000c, 0x1fec01, 0x1fecd2, 0x6a000005, 0xd800005, 0x6c00001, 0xd80000e,
+    0x26c00012, 0xd000012, 0x1ff108, 0x67000013, 0xd800009, 0x1fed05, 0x7000005, 0x7c00000,
+    0x1feed2, 0x26c00015, 0x2740000b, 0x1b400000, 0x7000007, 0x1fed52, 0x1fec52, 0xd800007,
+    0xd800012, 0xd000001, 0x700000e, 0x4c800014, 0xd800012, 0x7000001, 0x1fee49, 0x7000014,
+    0x2800012, 0x2640000f, 0x67c0000d, 0x1ec0000f, 0x7000016, 0x1fed85, 0xd800015, 0xd800015,
+    0x7c00007, 0x2800007, 0x7c00013, 0x2800007, 0x4cc00013, 0xcc00005, 0x6500000d, 0x53c0000b,
+    0xcc00006, 0x6c0000c, 0xa000008, 0x1ff0c2, 0x28000013, 0xd80000c, 0xd800009, 0x2800013,
+    0x1fef8e, 0xd800003, 0x12400009, 0xd80000f, 0xcc00012, 0xcc00013, 0xd80000c, 0x26c0001f,
+    0xd800012, 0x12400017, 0x4d9fedd2, 0x1ff188, 0x7c00015, 0xd800010, 0x5000008, 0x700001f,
+    0xcc00009, 0x63800015, 0x26c00001, 0xd80000c, 0x6a400013, 0xd800009, 0xa000012, 0xd800012,
+    0x26c00010, 0xd80000e, 0x700000c, 0x2800001, 0x28000013, 0xd800012, 0x5000007, 0x500000d,
+    0x26c0000f, 0x26c00012, 0xd800012, 0x1ff1ce, 0xcc00005, 0x27400012, 0xcc00006, 0x2800015,
+    0x1fefd5, 0xcc00001, 0x1ff209, 0x26c0000f, 0x1ff005, 0x1b400009, 0x280000c, 0x1b400014,
+    0x5000012, 0xd80000e, 0xc800005, 0xcc00013, 0xcc0000e, 0x500000c, 0xcc0000f, 0x6380000c,
+    0xcc00000, 0xfc00014, 0xcc0000c, 0x2800000b, 0x7c00010, 0xcc00005, 0x1ff2ce, 0xcc00008,
+    0x63c00005, 0x7c00001, 0x1b400009, 0x1ff145, 0x26c00010, 0x5000013, 0xd80000c, 0x26c00001,
+    0x1ff245, 0x26c00005, 0x28000014, 0x63c0000e, 0x26c00003, 0x1ff308, 0xd000012, 0x27400005,
+    0xd800009, 0xd800009, 0xd80001f, 0x1ff292, 0x28000007, 0x7c00015, 0x1b400008, 0x1ff085,
+    0x2800000, 0x28000004, 0x64000012, 0x500002a, 0x27400005, 0xd800012, 0x63800012, 0x500000e,
+    0x4cdff453, 0x1ff552, 0xcc0000c, 0xd000013, 0x26c00012, 0x1ff348, 0xd80000c, 0x26c00014,
+    0x2800014, 0x6380000e, 0xd00000c, 0xd800009, 0x26c00001, 0x2800014, 0x48800012, 0x2800001a,
+    0x63800005, 0x1ff392, 0x1ff412, 0x4d800009, 0x5000005, 0xfc00014, 0x26400009, 0x1ff3d2,
+    0x67c00007, 0xd800000, 0x2800013, 0x2640000b, 0x1ff649, 0x1ff91a, 0x26c00010, 0x2740000d,
+    0x4cc00004, 0x2800007, 0x6c0000e, 0x700001f, 0xd80000f, 0x1ff492, 0x1ff68d, 0xd80000e,
+    0xd800012, 0x1ff70e, 0x1ff752, 0xd800012, 0x37c00013, 0xd800017, 0x2740000e, 0x1ff88e,
+    0x4cc00014, 0x63c00012, 0xd800002, 0xd800005, 0x55400009, 0x4cc00013, 0x2800001, 0x29c00012,
+    0xd800012, 0xcc0000c, 0xd80000e, 0xd800003, 0xd800003, 0xd80000c, 0x1b400000, 0x1b400009,
+    0x1ff50e, 0x63c00012, 0xd80000e, 0xcc00001, 0xcc00017, 0x28000006, 0xd1ff947, 0x2800012,
+    0xfc0000c, 0x1ff9c1, 0xcc00006, 0xcc00007, 0x68000017, 0x1ff785, 0x1b40000c, 0xd1ff6d0,
+    0x5000004, 0x28000012, 0x280000c, 0x1ff992, 0xd000014, 0x6c00002, 0xcc00012, 0xcc00013,
+    0xd800015, 0x6500001a, 0x65c00013, 0xd800012, 0xd800012, 0xd80000e, 0x63dff84e, 0x63800012,
+    0x7c00005, 0x1ff7c5, 0x28000014, 0x63dffb8e, 0x1ffa45, 0x63800013, 0x66400007, 0xd800000,
+    0x2800017, 0x700000c, 0x26c00012, 0x27400010, 0x280000d, 0x5000005, 0x1ffa92, 0x53400001,
+    0x1ffbd2, 0x2740000b, 0xd800002, 0x1ffa05, 0xd800014, 0xcc0000c, 0x28000017, 0x1ff801,
+    0x1ffadf, 0x11c0000e, 0x2800005, 0xd800009, 0xcc00013, 0x63800012, 0x31400005, 0xd800012,
+    0xd800009, 0x2800005, 0xd80000e, 0x32c00013, 0x6c00000, 0xd800012, 0x17400000, 0xd800007,
+    0xd800000, 0x26c0001f, 0x1ffc94, 0x7000013, 0x27400001, 0x2740000b, 0x6c00013, 0x6c00015,
+    0x7000012, 0xd800012, 0x6c0000e, 0xd800005, 0x4cc00006, 0x27400012, 0x25800009, 0x1fabd2,
+    0x5000005, 0x4cc0000b, 0x2800013, 0xd800009, 0xd80000d, 0x4cc00014, 0x2800001, 0x46000013,
+    0x4cc00012, 0x4cc00013, 0xd80000e, 0xfc00008, 0xd000001, 0x4cc00017, 0xd000007, 0xd800001,
+    0x1ffccc, 0x26c00001, 0x5000000, 0xd800013, 0x26c00005, 0xd800009, 0x1ffd12, 0x27400009,
+    0x1b400005, 0xcc0000d, 0x5000001, 0xcc00005, 0x5000013, 0xd000003, 0x2800014, 0x2800007,
+    0x26dffd49, 0x1ffdc5, 0x2800017, 0xd80000e, 0x26c00001, 0x51ffc41, 0x2800000e, 0x63dffe0c,
+    0x2800003, 0x63800002, 0xd00000c, 0x1ffe45, 0x7c00000, 0xcc00000, 0x2800012, 0x1ffec5,
+    0xd800013, 0xcc00006, 0xcc00006, 0x5000014, 0x1ffd94, 0x2800014, 0x500000d, 0x5000005,
+    0x1b400005, 0xcc00003, 0x1fff12, 0x7c00001, 0x1b400000, 0xd80000e, 0x26c00010, 0xcc00014,
+    0x280000f, 0x1ffe95, 0x5000012, 0x1b400005, 0xcc00009, 0x500000c, 0x1ffb05, 0x63800013,
+    0xcc00005, 0x7c00004, 0xd000005, 0xcc00000, 0x2800014, 0x1fffc6, 0xcc00013, 0x200087,
+    0x1fff85, 0x7c00009, 0x4f80000e, 0xcc00007, 0x2800009, 0x1fff4e, 0x20010e, 0x200146,
+    0x2800003, 0x2800005, 0xcc00005, 0x26c00001, 0xd80000e, 0xcc00010, 0xcc00013, 0xcc00001,
+    0xcc0000b, 0xcc00009, 0x200005, 0x5000008, 0xd80000e, 0x2800010, 0x4d800005, 0x24400005,
+    0x200049, 0x200192, 0x5000006, 0x2001d2, 0x1b400007, 0x5000015, 0x2800012, 0xd800000,
+    0x280000d, 0x68400005, 0x2800012, 0x26400002, 0xcc0000c, 0x63c0000e, 0x2000c9, 0x500000d,
+    0x6aa00252, 0xcc00005, 0xd800009, 0x200292, 0x700000c, 0x4cc0000b, 0x26400007, 0x200354,
+    0x200492, 0x2760044e, 0x2800006, 0x2004ce, 0x26c00004, 0x2800007, 0xd800013, 0x7c00000,
+    0xd000005, 0x2002d3, 0x20030f, 0x63c00012, 0x2800007, 0x28000008, 0x200514, 0xd80000e,
+    0x4d800013, 0x200592, 0xd00001a, 0x28000007, 0x26c00005, 0x2006d3, 0x2800012, 0x200607,
+    0x2800000e, 0x28000013, 0xd800012, 0x6640000b, 0x2800017, 0x5000003, 0xcc00005, 0x200692,
+    0x26c00005, 0x2005c5, 0x2003c5, 0x280000e, 0x1b400013, 0x26c00001, 0x2800001, 0x28000017,
+    0xd000007, 0x29c00009, 0x29c00004, 0x2800000c, 0x28000014, 0xd000000, 0x26c00005, 0xd000007,
+    0x2740000e, 0x28000007, 0x7c00000, 0xd000004, 0x2800009, 0x2008d7, 0x2800013, 0xd000010,
+    0x6ac00007, 0x28000006, 0x65000007, 0x28000006, 0x27400005, 0xd000001, 0xd000004, 0x2800014,
+    0x200893, 0x2800015, 0x53400015, 0x28000015, 0xd000002, 0xd000015, 0x200714, 0x28000005,
+    0xd200946, 0xd000007, 0x27400012, 0x6500000b, 0x65000002, 0x280000b, 0x2800000c, 0x4ce00785,
+    0x65000006, 0x5000012, 0x4d800005, 0xd00000e, 0x53c00013, 0x200813, 0xd000012, 0xd000014,
+    0xcc00002, 0xd80000e, 0x2800001a, 0xd800009, 0x5000001, 0x2800008, 0xd800000, 0xd800000,
+    0x280000b, 0x26c00001, 0xd800009, 0x280000c, 0x200917, 0x26c00003, 0x26400002, 0x28000006,
+    0x5000012, 0x200a4c, 0x200992, 0x4d80001a, 0x2009c7, 0xd000004, 0xd000014, 0xa00000c,
+    0x2800014, 0x200849, 0x200a05, 0x2640000d, 0xd800002, 0x2800000b, 0xcc00005, 0x26c00010,
+    0xd00000e, 0x2640000e, 0x63e00a92, 0xd800015, 0x6b000005, 0xa000005, 0x4cc00012, 0xa000000,
+    0xd800012, 0xcc00012, 0x200652, 0xd80000e, 0x63c0000e, 0xd800012, 0xd800005, 0xd800007,
+    0x27400001, 0x200b4e, 0x200ac9, 0xd800009, 0x26c00001, 0x200b94, 0xd00000c, 0xd80000d,
+    0x63c00013, 0x53400003, 0xa000013, 0x200b05, 0x4cc00005, 0x63c00012, 0x5000009, 0x66c00012,
+    0xd000008, 0x28000002, 0x2800014, 0xd800000, 0x2800002, 0xd00000c, 0x63c00015, 0x4000009,
+    0x28000004, 0xd00000e, 0x4cc0000e, 0xd000005, 0x200552, 0x5000010, 0x2a80000e, 0x2800004,
+    0x200c42, 0x31400005, 0x28000007, 0xd80000e, 0xd800001, 0x20074e, 0x200c05, 0xd800001,
+    0x2800014, 0x200bd2, 0xd800010, 0x280000c, 0x26400012, 0x200c94, 0x26400009, 0x26400007,
+    0x200cc3, 0xc800014, 0x31400005, 0xd80000c, 0xd000006, 0xd80000f, 0xd80000e, 0xd000006,
+    0x200d49, 0x5000008, 0x200d88, 0x200dd2, 0x25800012, 0xd00000d, 0x200d13, 0x1b400014,
+    0xcc0000c, 0x200e0e, 0x2800005, 0x5340001f, 0xd800005, 0xd000014, 0xd80000c, 0x7000000,
+    0x200e52, 0x1b400014, 0x27400012, 0xd800009, 0xa000008, 0x29c00003, 0x700000c, 0x56400003,
+    0xcc0000c, 0x28000014, 0x200e8e, 0xa000015, 0x280000f, 0x26c00015, 0xd00000c, 0x200f14,
+    0x200f45, 0x63c00013, 0x64c0000e, 0x7000012, 0x200fc5, 0x26c0001a, 0xd800009, 0xd800012,
+    0xd800012, 0x7000007, 0xd800012, 0xa00000f, 0x200ece, 0x200f89, 0x6c00007, 0x7c0001f,
+    0x7000008, 0x2640000e, 0x201252, 0x6e00382, 0xd80000e, 0x20400007, 0x201052, 0x6c0000e,
+    0x7c00002, 0x2800009, 0xcc00015, 0xd800007, 0x201081, 0xd800009, 0xd800013, 0xcc0000e,
+    0x201288, 0xd800003, 0xd800003, 0x2800017, 0x12400013, 0x201012, 0x280000c, 0xd800018,
+    0xd800000, 0x700001f, 0xd800009, 0xcc00004, 0x4cc00013, 0xcc00003, 0xd800012, 0x5000000,
+    0x201145, 0x26c00001, 0xcc00013, 0x32c00010, 0x26400012, 0xd80000c, 0xcc00002, 0x53400017,
+    0x201113, 0x5000000, 0xa000015, 0x4cc0000e, 0x20148e, 0x2800005, 0xd800012, 0x2800005,
+    0xd800012, 0x27400005, 0xd80000b, 0x20130e, 0xcc00009, 0x37800005, 0x4cc00013, 0x6c00012,
+    0x2011d2, 0xd800018, 0x2800003, 0x2800003, 0x2014da, 0x6800000f, 0x2800001, 0xcc0000d,
+    0x28000007, 0xd000014, 0xd800000, 0xa000012, 0x53400009, 0x2800017, 0x26400005, 0x4c800014,
+    0x201694, 0x201514, 0x28000006, 0x2800007, 0xcc00012, 0x2800014, 0x1b400008, 0xa000000,
+    0x2800000c, 0x20040e, 0x2800009, 0x63e0160e, 0xd80000d, 0x4d800005, 0xd80000e, 0xd2016d3,
+    0x69c00002, 0xd80000e, 0x20174e, 0x28000017, 0x201712, 0xd80000c, 0x2800001a, 0xd80000e,
+    0x2740000e, 0xcc00005, 0x1b400000, 0xd00000c, 0xcc00001, 0xd000001, 0xcc00013, 0xcc00014,
+    0x201592, 0xcc00005, 0x46000009, 0x20178e, 0xd000007, 0x6b400002, 0x2800010, 0x1b400005,
+    0x7c0000b, 0x7c00005, 0x4cc00013, 0x1b400013, 0xd2017ce, 0x26c00005, 0x46000015, 0xd00000c,
+    0x2800004, 0xc80000e, 0x5201809, 0x4cc00014, 0x1b400008, 0xcc00001, 0x1b400001, 0x201549,
+    0x5000013, 0x5000009, 0xd000017, 0x2800010, 0x5000004, 0x5000001, 0xd000007, 0x1b40001f,
+    0x2800000e, 0x201852, 0xd800005, 0x6840000f, 0x63c00013, 0xd800012, 0x2800000, 0x2018ce,
+    0x201a48, 0x63c0000e, 0xd80000c, 0x26400012, 0x201988, 0x4cc00013, 0x280000c, 0x17400000,
+    0xcc0001a, 0xd800000, 0x1b400013, 0x280000b, 0x7c00009, 0x27400014, 0xd800009, 0xd80000e,
+    0xa00000e, 0x7000009, 0xd80000c, 0x28000014, 0x2640000e, 0x27400005, 0x201469, 0xa000005,
+    0x201885, 0x7000001, 0xd000001, 0x6c00014, 0x7000003, 0x7000008, 0x1fc00000, 0x47400000,
+    0x7000007, 0x7000010, 0x2012c6, 0x7000015, 0xd800003, 0x6b80000d, 0x7000000, 0x1fc00009,
+    0x7000003, 0x7000013, 0x7000003, 0x7000008, 0x7000004, 0x201b0e, 0x7000013, 0x201949,
+    0x7000002, 0x1fc00013, 0x7000003, 0x700000a, 0x7000014, 0x7000004, 0x7000000, 0xd800002,
+    0x700000e, 0xd00000d, 0x700000e, 0x26c00009, 0x7000007, 0x6c00013, 0x7000004, 0x7000014,
+    0x4cc00005, 0x7000015, 0xd00000e, 0x700000c, 0x26c00014, 0x4cc00005, 0x4d800009, 0x201912,
+    0x26c00015, 0x7000014, 0x6c00012, 0x280000b, 0xcc00000, 0x700000c, 0x7000012, 0x7000003,
+    0x26c0000f, 0xd000013, 0x2800005, 0x2800014, 0x7000001, 0x7000007, 0x2800013, 0x2019d5,
+    0x59800008, 0x7000015, 0xd800012, 0x7c00000, 0x7000010, 0x700000d, 0xd000013, 0x201a87,
+    0x201a14, 0x2800013, 0x2800000b, 0x6c00014, 0x7201b48, 0x2800000d, 0x7c00015, 0xd000013,
+    0x27400009, 0x5000003, 0x26c00003, 0x26c00009, 0x4cc00013, 0x201ac5, 0x700002a, 0x5000009,
+    0x67c00014, 0xd800013, 0x7c00012, 0x201b8d, 0x25800005, 0xd00000c, 0x27400001, 0x63c00012,
+    0x2800015, 0x28000006, 0xa000001, 0xd800000, 0xd000000, 0xd800012, 0xcc00001, 0x5000013,
+    0x7000009, 0xa000007, 0x7000007, 0xa000015, 0x2740000f, 0x7000005, 0x4cc00012, 0x201c45,
+    0x201bc1, 0x7000013, 0xd000001, 0xa000013, 0x5000001, 0x201c05, 0xd800013, 0xd000013,
+    0x700000e, 0xd800012, 0xcc0000e, 0x2800004, 0x700001a, 0x201cc5, 0x26c00029, 0x201c94,
+    0x2800012, 0x5000005, 0x201d09, 0x7000019, 0x201e05, 0x26c00001, 0x26c00006, 0x1b400012,
+    0x7c00001, 0x4d800013, 0x7c0000d, 0xd000014, 0xc80000e, 0x7c00003, 0x63c00014, 0x7c0000e,
+    0x500002a, 0x700000c, 0x26c00005, 0xd00000b, 0xc800013, 0xc800014, 0x7000014, 0x700000c,
+    0x6c000008, 0x5000010, 0x201d8e, 0x7000002, 0x700000e, 0x201ec7, 0x6bc00013, 0x6c00014,
+    0x7000007, 0x26c00012, 0x201e5f, 0xd800012, 0xcc00006, 0x201dce, 0x1b400013, 0x1240000f,
+    0x201f05, 0xce01d53, 0x20218e, 0x7000012, 0x7000013, 0x12400002, 0xd800007, 0xcc0000e,
+    0x7000000, 0xcc00013, 0xa00000f, 0x31400012, 0x7000001, 0x7000000, 0x7000014, 0x2800005,
+    0x26c00001, 0x11c0000b, 0x7000009, 0x7000002, 0x700000c, 0x65c00013, 0x26c00003, 0x6c400006,
+    0x7000008, 0x7000013, 0xa000000, 0x700000d, 0x7000006, 0x7000005, 0x2800007, 0xcc00005,
+    0x63e01e94, 0x7c0002a, 0x2740002a, 0x700001f, 0x4d800010, 0x2800013, 0x26400003, 0x63e021d2,
+    0xd800001, 0x20208e, 0x63c0000e, 0x201f52, 0xd80000e, 0x28000004, 0x201fce, 0x27400009,
+    0xd000007, 0x7c00014, 0x2740000e, 0x4cc00014, 0x26400012, 0x26c00014, 0x2800006, 0x26c00012,
+    0x7000002, 0xd80000e, 0xcc00000, 0x7000009, 0x2800013, 0x201f94, 0x2800001, 0xa00000b,
+    0xa000002, 0xa000012, 0xd80000d, 0x7000009, 0x12400013, 0x202352, 0xa000012, 0xa000000,
+    0x25800009, 0x2024c8, 0x63e020d3, 0x63c00012, 0x2010c1, 0x20240b, 0x20210e, 0x2800014,
+    0x202588, 0x63e0220e, 0x202249, 0xd000007, 0x20214e, 0xd000007, 0xd000012, 0xfc00000,
+    0x7000009, 0x2800014, 0x27400008, 0xd800007, 0xa000012, 0x6c0000c, 0x6c00001, 0x26c0000e,
+    0x6c00007, 0x7000010, 0x28000004, 0x2800005, 0xd800005, 0x2800007, 0x2800013, 0x2800000e,
+    0x6c0000d, 0x2025c9, 0x6c00000, 0x7000013, 0x7c00007, 0x202552, 0x202605, 0x1ec0000f,
+    0x28000009, 0x2800013, 0x28000004, 0x2800005, 0xcc00009, 0x2800007, 0x2023c2, 0x4d80000b,
+    0x4d80000c, 0xcc00015, 0x201648, 0x20248c, 0x28000010, 0xcc0000e, 0xcc00015, 0x2800013,
+    0xd00000f, 0x2dc0000d, 0x28000014, 0x2800017, 0xcc00015, 0xd800012, 0x53c00004, 0x2dc00013,
+    0xa000006, 0xd800005, 0xa000008, 0x2dc00017, 0xd800000, 0xcc00000, 0x2026c1, 0x6c00008,
+    0x26400012, 0xcc00009, 0xd000000, 0xd80000e, 0xd00000e, 0xd80000c, 0xcc00009, 0x3c400009,
+    0x6380000e, 0x65000004, 0xd800009, 0x202712, 0x280000c, 0x7000015, 0xd800005, 0xcc00012,
+    0x700000c, 0xd000012, 0xcc00015, 0x28000009, 0xd80000e, 0x280001a, 0xd800015, 0x2800014,
+    0xd800001, 0x63e027d2, 0x7c00014, 0xd80000d, 0xcc0001f, 0x2800000, 0x202645, 0x2800005,
+    0x2800008, 0x202685, 0x64c00013, 0x280000b, 0x280000c, 0x4d80000c, 0x202803, 0xcc0002a,
+    0xd800013, 0x20274e, 0x4cc00002, 0x20290b, 0x280000e, 0x20278e, 0xd000001, 0xd80000e,
+    0x4d800017, 0x26400012, 0x20284e, 0xd80000d, 0x7c00005, 0xd800002, 0xd000014, 0x7000000,
+    0xd800008, 0xd00000c, 0x17400000, 0x2028c3, 0x17400015, 0x1fc00009, 0xd800009, 0x29c00005,
+    0x27400012, 0xd800001, 0xd800012, 0xd800000, 0xd800013, 0x7000000, 0x202885, 0x26c00001,
+    0x26c00009, 0xd800013, 0x20294e, 0xd80000e, 0xcc00013, 0x202a05, 0xd800000, 0x6600000d,
+    0xcc00006, 0x202a45, 0x7c00001, 0xcc0000f, 0x202992, 0x2800005, 0xd800013, 0x5000000,
+    0x2800005, 0x5000005, 0xcc00013, 0xcc00005, 0xcc00000, 0xcc00005, 0x1b400009, 0x2800002,
+    0x7c0000e, 0xcc00008, 0x2800003, 0x1b40001a, 0xcc00005, 0xcc00002, 0x59800002, 0x29c0001a,
+    0xcc0000e, 0xcc00006, 0x1740001f, 0xc80000e, 0xc80000f, 0xd80000b, 0x5000013, 0xd80000e,
+    0x2800005, 0x202a93, 0xd80000e, 0x6700000e, 0x28000014, 0x4cc0000c, 0xcc00013, 0x67000004,
+    0xd800012, 0x280000c, 0x37800012, 0x6c00014, 0xd80000e, 0xd000013, 0x63c0000e, 0x1b400007,
+    0x6c800014, 0x202ad2, 0x2800007, 0x5000000, 0xcc0000c, 0xa00000b, 0xc800014, 0x2640000e,
+    0x2800007, 0x202b45, 0x1b400013, 0x1b400013, 0xd00000b, 0x1b400005, 0x2800005, 0x202b89,
+    0x202cd2, 0xd80000c, 0x27400005, 0xcc00014, 0xd000006, 0xd800009, 0x202e47, 0x27400005,
+    0xd800007, 0x202e8e, 0xd800000, 0xd00000b, 0xd800015, 0x28000009, 0x53400001, 0x202b15,
+    0xcc00005, 0x2800002, 0x280000b, 0xd80000e, 0x7c00010, 0xfc00002, 0x7c00006, 0x6cc00014,
+    0x280000e, 0x7c00006, 0x66400007, 0x4cc00008, 0x50c00014, 0x4c800014, 0xcc00001, 0x4cc0000c,
+    0x4cc0000d, 0x28000003, 0xcc00005, 0x500000e, 0x7c00014, 0xd000004, 0x202f93, 0xcc00005,
+    0x64800007, 0xd800002, 0x26c00014, 0x202c54, 0x1b400013, 0x4cc0000c, 0xd800012, 0x2800005,
+    0xd000002, 0xd80000e, 0x2800012, 0x28000014, 0x7c00000, 0x55400009, 0x202d85, 0x4cc00013,
+    0x2800012, 0x2800014, 0x1b400000, 0xd800013, 0x26c00009, 0xd80000e, 0x202c85, 0xd000006,
+    0xa000001, 0x4c800005, 0x31400012, 0x202dc5, 0xd800009, 0x4cc00003, 0xd800014, 0x7c00013,
+    0x4cc00007, 0x26c00009, 0x63c00012, 0x2800005, 0x26c00005, 0x203014, 0x4d800005, 0x6380000c,
+    0xd000006, 0xd000007, 0x2029c1, 0xd00001a, 0xcc00005, 0xd00000b, 0xcc0000e, 0xd800012,
+    0x4c800014, 0xd00000e, 0xd000000, 0x202ec5, 0xd800003, 0xd000013, 0xd800012, 0xcc00002,
+    0x2030d3, 0x63c00013, 0xd000029, 0x280000e, 0x203054, 0xd00000e, 0x2800014, 0x2800014,
+    0xcc0000b, 0x7c00000, 0xcc00005, 0xcc0000c, 0xd00000e, 0x2032d3, 0x6d000008, 0xcc00006,
+    0x5000014, 0x15800000, 0x203189, 0x2800010, 0xd00000c, 0x280000e, 0x5000012, 0xd000006,
+    0xcc00006, 0xd80000c, 0x4da03201, 0x2800004, 0xd000007, 0xc800013, 0x66000015, 0x4f800013,
+    0x35000012, 0x20314e, 0xd800013, 0x28000007, 0x280000c, 0x280000d, 0xd800012, 0x280000f,
+    0x202f0e, 0x2800013, 0x48800007, 0x4cc0001a, 0x5000004, 0xd800005, 0xd800010, 0x202f52,
+    0xd800003, 0xd800005, 0x2800013, 0x6d60330e, 0x203453, 0x63c0000e, 0x203094, 0x202fd2,
+    0x54400012, 0x20310e, 0x6380000c, 0x203412, 0xd800012, 0xd800012, 0xd80000e, 0x2031cc,
+    0x20348e, 0x2800029, 0x2800001, 0x5000000, 0xd800012, 0x20368c, 0x5000005, 0x203613,
+    0x26400012, 0xd00000c, 0x2034c5, 0x63c00013, 0x203548, 0x6800000c, 0x20378e, 0xd800001,
+    0x26400009, 0x20364e, 0x4d800009, 0x4e203709, 0x4d800009, 0x2035d0, 0x5000013, 0x26c00003,
+    0x2800017, 0x20358e, 0xd800005, 0x2036cc, 0x203752, 0xd80000d, 0x26400009, 0x27400009,
+    0x4cc00013, 0x59800003, 0x203908, 0x203852, 0x20380e, 0x4d80000c, 0xd800009, 0xd800009,
+    0x26c00014, 0xd800012, 0x203505, 0xd80000c, 0x5000005, 0x64400012, 0xd800018, 0x2800005,
+    0x2037d2, 0x2038d2, 0x26400012, 0x2800009, 0x26400009, 0x26400003, 0x203949, 0x53400012,
+    0x7000000, 0x700000d, 0xd800001, 0x26400012, 0xcc00012, 0x6c00002, 0xd80000e, 0x203892,
+    0x59800002, 0xd800000, 0x2039d4, 0x7000002, 0xd800015, 0xd80000e, 0x6c00007, 0xd800009,
+    0x20398e, 0x26400007, 0xd80000e, 0x203a01, 0x203b12, 0xd800002, 0xcc00013, 0xd80000e,
+    0x26c0000e, 0x37c00001, 0x5000015, 0x7000006, 0xd800009, 0xd800012, 0xd800012, 0x27400009,
+    0x63e03a92, 0x63e03b8e, 0x26400012, 0x2800014, 0x5000013, 0x64400012, 0xd000012, 0x203a45,
+    0x7000007, 0x203cc5, 0x55400005, 0x7000014, 0x7c00000, 0x4d800005, 0x26c00001, 0x280000c,
+    0x27400005, 0xd000014, 0x203b4b, 0xd00000d, 0x29c00006, 0x280000c, 0xda03c45, 0x26c00009,
+    0x7c00000, 0x2800009, 0x203d93, 0x2800012, 0xd80000e, 0x280000d, 0xd000017, 0x66000009,
+    0x4cc00016, 0xd000012, 0xd000009, 0x4d800012, 0x203dcb, 0xd800003, 0x26c00015, 0xd800001,
+    0x63a03e92, 0xd000000, 0x65c00013, 0x203c89, 0xcc00013, 0x63800012, 0x65000007, 0xd800009,
+    0x26c00001, 0x203e43, 0x6d800013, 0x6d40000b, 0x6dc00000, 0x6e000008, 0x31000012, 0x6e400002,
+    0x6e800013, 0x60c00001, 0x203f83, 0x203d05, 0x3100000c, 0x6d40000b, 0x203d54, 0x576040d4,
+    0x204314, 0x29c00010, 0x203ec9, 0x203e09, 0x203f05, 0x31000012, 0x20414b, 0x64c00005,
+    0x203fc8, 0x31604204, 0x6e00000e, 0x6e800012, 0x53c00009, 0x6dc00007, 0x57400005, 0x6e800012,
+    0x6ec00012, 0x6f000009, 0x204108, 0x6d400005, 0x31400000, 0x204045, 0x6e800012, 0x204245,
+    0x204085, 0x6f400012, 0x20434e, 0x204385, 0x57400001, 0x6e800012, 0x31000002, 0x204192,
+    0x204297, 0x204412, 0x204445, 0x204552, 0x29c00001, 0x37c0000c, 0x6fa0464e, 0x31000012,
+    0x31400000, 0x204592, 0x6d400004, 0x3100000c, 0x57400005, 0x204493, 0x57400003, 0x37c00005,
+    0x37c00007, 0x6e000017, 0x3100000e, 0x204515, 0x37c00014, 0x31000000, 0x2045d5, 0x4f800009,
+    0x6fc00002, 0x204754, 0x57400001, 0x2048d3, 0x37c0001a, 0x29c00002, 0x31000012, 0x37c00012,
+    0x37c00013, 0x29c00000, 0x29c00012, 0x29c00001, 0x3100000d, 0x57400001, 0x20478e, 0x2dc00007,
+    0x37c00000, 0x5740000f, 0x29c0000c, 0x6e000017, 0x15800000, 0x1580000e, 0x204985, 0x4f800009,
+    0x37c00005, 0x1580000e, 0x6d400005, 0x53c00009, 0x70000007, 0x37c00007, 0x6fc00005, 0x15800012,
+    0x3100000b, 0x37c00009, 0x70400005, 0x3100000c, 0x37c00008, 0x1fc00002, 0x29c00017, 0x31000005,
+    0x4f80000e, 0x4f800009, 0x60c00009, 0x1fc00002, 0x60c0000e, 0x2049c9, 0x31000001, 0x6e000014,
+    0x37c00005, 0x4f800007, 0x70800013, 0x70c0000d, 0x0, 0x57400005, 0x204905, 0x37c0000f,
+    0x204944, 0x204892, 0x1fc00015, 0x0, 0x1fe04a07, 0x29c00013, 0x29c00001, 0x53c00005,
+    0x204705, 0x6e000015, 0x37c00013, 0x4f800015, 0x1580000e, 0x57400012, 0x31400014, 0x37c00010,
+    0x6d40000c, 0x37c00007, 0x31000009, 0x64c00012, 0x31400014, 0x2dc0000f, 0x71000009, 0x37e04ac8,
+    0x37c00007, 0x37c00005, 0x37c0000f, 0x29c00005, 0x17400003, 0x37c0000b, 0x37c0000e, 0x71400005,
+    0x29c00005, 0x57400003, 0x37c00016, 0x37c0000c, 0x6fc00005, 0x31400000, 0x29c00000, 0x57400005,
+    0x4f800015, 0x71800014, 0x2dc00007, 0x6d400013, 0x57400003, 0x29c00003, 0x71c0000e, 0x6ec0000e,
+    0x29c00014, 0x31400014, 0x1580000e, 0x3100000c, 0x31400000, 0x0, 0x29c00001, 0x37c00004,
+    0x31400013, 0x204a88, 0x31000012, 0x37c00010, 0x57400005, 0x204b0e, 0x31000012, 0x15800012,
+    0x31400012, 0x57400005, 0x29c00007, 0x37c00006, 0x29c00014, 0x31400013, 0x29c0000b, 0x29c0000c,
+    0x204b52, 0x4f800005, 0x37c00001, 0x6d400013, 0x6d400014, 0x6e000014, 0x31400014, 0x31000008,
+    0x37c00013, 0x37c0000b, 0x37c00001, 0x7200000e, 0x4f800009, 0x204a52, 0x37c0000c, 0x37c0000e,
+    0x6d400005, 0x6d400013, 0x57400012, 0x37c00012, 0x37c00007, 0x37c0000c, 0x37c0000d, 0x4f800012,
+    0x6ea04bce, 0x71800015, 0x37c0000b, 0x1fc00013, 0x31400009, 0x37c00008, 0x31400005, 0x37c00005,
+    0x4f800000, 0x60c00009, 0x204852, 0x72400012, 0x37c00002, 0x4f800000, 0x37c00017, 0x3100000c,
+    0x37c00013, 0x6e000007, 0x204c4e, 0x29c00014, 0x6e000004, 0x37c0000c, 0x31000012, 0x37c00005,
+    0x37c00006, 0x37c00007, 0x6dc00005, 0x6e000014, 0x2dc0000f, 0x6e80000e, 0x37c00005, 0x4f800000,
+    0x4f800003, 0x1fc0000e, 0x11c0000e, 0x71400015, 0x204b85, 0x2047d4, 0x6fc0000e, 0x4f80000c,
+    0x6e800012, 0x60c00012, 0x57400010, 0x37c00005, 0x31000002, 0x72800002, 0x3100000c, 0x31000003,
+    0x2dc00014, 0x6e000000, 0x31000000, 0x6d400013, 0x2dc0000c, 0x2dc00002, 0x31000009, 0x204c08,
+    0x2dc00002, 0x2dc00015, 0x3100000c, 0x15a04c81, 0x2dc00001, 0x4f800005, 0x29c00015, 0x57400001,
+    0x37c00000, 0x72800002, 0x7180000e, 0x4f800013, 0x31000007, 0x6ec0000e, 0x37c00005, 0x37c00005,
+    0x5740000f, 0x204d05, 0x204cce, 0x72c00015, 0x57400009, 0x57400005, 0x57400001, 0x57400001,
+    0x70000007, 0x37c00005, 0x204d45, 0x4f800000, 0x53c0001f, 0x37c00005, 0x72800002, 0x60c00012,
+    0x11c0000d, 0x15800012, 0x2dc00009, 0x2dc00015, 0x2dc00007, 0x4f800013, 0x4f800008, 0x204e0e,
+    0x29c00005, 0x31000012, 0x2dc00009, 0x11c00007, 0x31000012, 0x37c00004, 0x2dc00007, 0x37c00009,
+    0x204d88, 0x73400000, 0x2dc00012, 0x4f80000e, 0x72800012, 0x204e85, 0x37c00000, 0x204dcc,
+    0x6dc00009, 0x7300001a, 0x7040000e, 0x37c00007, 0x4f800012, 0x2dc00005, 0x6e000003, 0x37c00001,
+    0x37c00013, 0x0, 0x31000009, 0x71400015, 0x72800002, 0x6e000012, 0x57400014, 0x204e52,
+    0x37c0000c, 0x6e000012, 0x31400007, 0x6e00000e, 0x6d400007, 0x37c00002, 0x1fc00000, 0x37c0000e,
+    0x6d400009, 0x6e000017, 0x6d800013, 0x72c00013, 0x6e00001a, 0x64c00001, 0x60c00012, 0x37c0000e,
+    0x73800005, 0x205005, 0x17400014, 0x6e800005, 0x15800005, 0x73c0000e, 0x204ece, 0x2dc00007,
+    0x4f800005, 0x3100000c, 0x71800001, 0x37c0000f, 0x205092, 0x31400000, 0x37c0000c, 0x3100000e,
+    0x29c0000c, 0x37c0000c, 0x37c0000d, 0x6d40000b, 0x1fc00002, 0x7200000e, 0x4f800013, 0x37c00012,
+    0x31400007, 0x15800000, 0x37c00014, 0x31000007, 0x70000007, 0x6e000013, 0x74000004, 0x74400013,
+    0x31400013, 0x29c00005, 0x71400005, 0x204f41, 0x37c00006, 0x4f800012, 0x31000007, 0x31400000,
+    0x72400012, 0x204f12, 0x4f800009, 0x37c00005, 0x72800014, 0x37c00007, 0x53c0000e, 0x31400005,
+    0x37c00005, 0x31000002, 0x204fce, 0x70000007, 0x72c00007, 0x53c00005, 0x31000013, 0x7400000b,
+    0x31000000, 0x31400005, 0x31400013, 0x31000012, 0x29c00005, 0x205188, 0x3140000c, 0x29c00005,
+    0x4f800012, 0x74800005, 0x29c00005, 0x6e800012, 0x2dc0000e, 0x204f92, 0x71000003, 0x2dc00009,
+    0x31000009, 0x2dc00007, 0x15800005, 0x31000001, 0x6e000013, 0x37c0000c, 0x31400013, 0x74800013,
+    0x6d400007, 0x2050c5, 0x205047, 0x37c00005, 0x29c00001, 0x57400005, 0x205112, 0x6d400005,
+    0x60c00009, 0x6ee05152, 0x29c00000, 0x57400003, 0x57400001, 0x2dc00009, 0x57400001, 0x29c00009,
+    0x3100000f, 0x29e051c5, 0x37c0001a, 0x205205, 0x2053c5, 0x6d400004, 0x37c00003, 0x37c0000e,
+    0x37c00013, 0x37c00007, 0x53c00005, 0x31400005, 0x60c0001f, 0x31000009, 0x74c00005, 0x31400005,
+    0x1740002a, 0x205245, 0x37c00012, 0x205488, 0x0, 0x0, 0x75c0001f, 0x0,
+    0x37c00005, 0x0, 0x6e000013, 0x3100000e, 0x31000007, 0x31000002, 0x2dc00004, 0x2007d7,
+    0x37c00007, 0x6d400012, 0x205294, 0x6d400013, 0x37c0000e, 0x1fc00013, 0x205512, 0x74000006,
+    0x6e000017, 0x6e800012, 0x3100000d, 0x2dc00009, 0x2052d0, 0x6d40000c, 0x6e000004, 0x6e000017,
+    0x37c00005, 0x7040000d, 0x6e000013, 0x15800001, 0x74000013, 0x6e800009, 0x4f800003, 0x37c00007,
+    0x6d400017, 0x37c00004, 0x2dc0000c, 0x37c00007, 0x2055d3, 0x29c00007, 0x2dc00007, 0x2dc00007,
+    0x64c00005, 0x31000014, 0x37c00001, 0x205405, 0x37c00000, 0x4f80000c, 0x1fc00015, 0x1fc0000b,
+    0x3100000e, 0x205309, 0x71000014, 0x1fc0000e, 0x0, 0x29c0002a, 0x31000007, 0x0,
+    0x1fc0000e, 0x205552, 0x31000012, 0x37c0000e, 0x1fc00001, 0x60c00012, 0x15800010, 0x7380000e,
+    0x3100000d, 0x31000009, 0x6e800012, 0x1fc00001, 0x31000005, 0x57400010, 0x37c00014, 0x60c0000e,
+    0x31000014, 0x37c00013, 0x2dc0000e, 0x37c00014, 0x1fc00006, 0x4f800013, 0x1fc00008, 0x6e000008,
+    0x37c00013, 0x37c00013, 0x70000005, 0x53c00010, 0x37c00001, 0x64e05445, 0x15800000, 0x37c0000e,
+    0x37c00014, 0x37c00014, 0x37c00003, 0x37c00013, 0x37c00007, 0x1fc0000e, 0x2dc0000c, 0x2dc00004,
+    0x37c0000d, 0x1fc00009, 0x4f800009, 0x37c00007, 0x37c00008, 0x37c00012, 0x37c00007, 0x37c0000b,
+    0x205608, 0x57400005, 0x37c00017, 0x205848, 0x31000012, 0x0, 0x31000007, 0x37c00014,
+    0x31000005, 0x70800014, 0x6e000014, 0x2dc00002, 0x6e800012, 0x11c00014, 0x1580000e, 0x72c0000e,
+    0x37c00013, 0x6e000006, 0x2dc00014, 0x2058ce, 0x2054ce, 0x6e000013, 0x205905, 0x37c00005,
+    0x37c00014, 0x4f800003, 0x1580000c, 0x53c0000c, 0x6e800012, 0x205685, 0x2dc00015, 0x6e000014,
+    0x4f800005, 0x31400003, 0x2056c9, 0x29c00000, 0x37c00007, 0x31400012, 0x57400010, 0x205953,
+    0x37c00004, 0x37c00014, 0x4f800014, 0x37c00014, 0x205883, 0x37c00005, 0x74000004, 0x205a55,
+    0x31400014, 0x15800000, 0x6e800013, 0x29c00003, 0x37c0000c, 0x6e800015, 0x6d400004, 0x3100000c,
+    0x31000009, 0x37c0000c, 0x74000004, 0x37c00007, 0x70000004, 0x0, 0x31000012, 0x37c00012,
+    0x6d40000b, 0x17400013, 0x6e00000d, 0x37c00008, 0x57400005, 0x37c00007, 0x37c00013, 0x70400007,
+    0x64c0000c, 0x37c00005, 0x6e000004, 0x37c0000e, 0x205a93, 0x205782, 0x70000014, 0x29c00001,
+    0x37c0000c, 0x6e00001a, 0x53c00009, 0x6e800012, 0x57400005, 0x37c00015, 0x37c00014, 0x29c00012,
+    0x75000006, 0x6e800008, 0x37c00014, 0x75000009, 0x205ac1, 0x70000013, 0x205708, 0x75400013,
+    0x75800013, 0x7580000e, 0x61400005, 0x75c0000c, 0x205754, 0x76000005, 0x2057d2, 0x75800005,
+    0x75c0000c, 0x205805, 0x205985, 0x205cd2, 0x205b12, 0x205bcc, 0x75c00017, 0x76400007,
+    0x76400008, 0x76605c93, 0x76400005, 0x205b45, 0x205d4e, 0x75c00004, 0x75800001, 0x76a05dce,
+    0x205b8b, 0x7580000d, 0x75800010, 0x76c00000, 0x205c4d, 0x75800007, 0x75400000, 0x75400000,
+    0x77000006, 0x61400000, 0x205f05, 0x75400007, 0x77400001, 0x75800005, 0x77800012, 0x78000005,
+    0x77c00004, 0x205f52, 0x78400005, 0x78800004, 0x76400013, 0x77c00004, 0x75400002, 0x205d02,
+    0x0, 0x0, 0x0, 0x78c00005, 0x0, 0x0, 0x205e07, 0x0,
+    0x78000005, 0x3e400013, 0x76c00004, 0x0, 0x75c00012, 0x75c00015, 0x7640000e, 0x6140000d,
+    0x77400015, 0x75800009, 0x75c00008, 0x3e400005, 0x205e89, 0x75c00009, 0x205d95, 0x205f93,
+    0x75400009, 0x75400002, 0x205e55, 0x79000014, 0x6c000013, 0x78800013, 0x76a05fce, 0x206005,
+    0x75c00013, 0x78800005, 0x7540000f, 0x78000012, 0x75c00005, 0x78c00013, 0x20614e, 0x7680000e,
+    0x75c00014, 0x3e400000, 0x7940000d, 0x79800000, 0x75c0000c, 0x75c00000, 0x75400002, 0x76400014,
+    0x76a060ce, 0x75c0000e, 0x206048, 0x75c00002, 0x75c0000e, 0x77800003, 0x2061ce, 0x79c00004,
+    0x75800014, 0x206294, 0x7a000013, 0x6d000000, 0x206205, 0x78800003, 0x206305, 0x7680000b,
+    0x7a400012, 0x7a800004, 0x7640000c, 0x7ac00004, 0x76c00000, 0x75c00005, 0x206081, 0x205ed2,
+    0x0, 0x78800003, 0x7540000e, 0x7ac00004, 0x20624e, 0x3e400000, 0x7540000d, 0x75400004,
+    0x7a40000e, 0x206389, 0x75800000, 0x7b000004, 0x75800000, 0x7540000c, 0x7a400013, 0x206185,
+    0x206587, 0x76400009, 0x206104, 0x75800000, 0x2065ce, 0x75400013, 0x75800000, 0x75800000,
+    0x0, 0x75c00015, 0x2064ce, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+};
+static const uint8_t HYPH_DE_1996_VALUES[] = {
+    0, 1, 1, 1, 1, 1, 2, 0, 3, 2, 1, 1, 0, 2, 2, 1, 2, 1, 1, 0, 3, 2, 1, 2,
+    0, 1, 2, 0, 1, 1, 0, 3, 2, 1, 4, 2, 1, 4, 1, 2, 2, 4, 0, 3, 2, 5, 4, 0,
+    3, 3, 2, 1, 0, 2, 4, 1, 0, 3, 4, 5, 2, 0, 2, 4, 5, 0, 2, 1, 2, 0, 3, 1,
+    2, 2, 1, 2, 2, 2, 2, 1, 3, 0, 3, 2, 1, 6, 0, 3, 2, 3, 2, 0, 3, 4, 1, 2,
+    0, 3, 4, 3, 2, 0, 2, 2, 3, 0, 3, 2, 0, 1, 0, 2, 4, 3, 0, 1, 4, 1, 2, 1,
+    2, 1, 2, 3, 2, 1, 1, 3, 0, 3, 2, 3, 4, 0, 3, 4, 1, 4, 0, 3, 4, 3, 4, 2,
+    1, 2, 0, 3, 4, 2, 1, 0, 3, 4, 5, 4, 0, 3, 2, 0, 2, 1, 2, 1, 4, 0, 1, 3,
+    0, 3, 6, 3, 2, 0, 3, 3, 0, 1, 0, 2, 1, 4, 0, 3, 1, 0, 2, 0, 2, 6, 1, 0,
+    3, 1, 2, 4, 0, 3, 1, 0, 1, 0, 3, 6, 3, 6, 0, 3, 4, 2, 2, 1, 2, 3, 4, 1,
+    1, 4, 3, 1, 3, 3, 1, 2, 3, 1, 4, 3, 1, 1, 0, 2, 2, 2, 0, 4, 2, 0, 2, 1,
+    0, 4, 2, 0, 0, 2, 2, 2, 2, 3, 0, 3, 2, 0, 3, 0, 3, 2, 2, 1, 1, 2, 2, 3,
+    2, 2, 3, 4, 2, 2, 1, 4, 1, 2, 2, 1, 1, 3, 1, 0, 5, 2, 2, 5, 2, 0, 4, 2,
+    0, 3, 2, 0, 2, 3, 2, 2, 2, 3, 2, 1, 1, 5, 0, 4, 3, 0, 0, 2, 0, 2, 3, 4,
+    1, 3, 3, 0, 1, 2, 2, 1, 2, 1, 3, 1, 0, 2, 0, 4, 2, 0, 0, 4, 2, 2, 2, 4,
+    0, 3, 4, 0, 2, 2, 2, 2, 1, 0, 4, 2, 0, 1, 2, 0, 4, 3, 0, 2, 2, 1, 3, 3,
+    0, 4, 0, 4, 2, 0, 3, 4, 1, 3, 2, 0, 4, 2, 1, 5, 1, 3, 3, 0, 2, 0, 4, 4,
+    0, 0, 1, 1, 3, 2, 1, 2, 0, 4, 2, 1, 0, 2, 1, 3, 1, 2, 1, 1, 3, 3, 2, 4,
+    0, 1, 5, 1, 2, 1, 3, 1, 3, 1, 0, 1, 1, 3, 2, 3, 4, 0, 3, 3, 0, 2, 0, 4,
+    3, 0, 0, 3, 1, 3, 2, 3, 2, 0, 3, 2, 2, 3, 2, 2, 4, 1, 2, 2, 2, 2, 0, 4,
+    3, 0, 0, 4, 0, 4, 1, 0, 2, 2, 0, 4, 4, 0, 2, 3, 0, 4, 2, 1, 0, 3, 0, 3,
+    3, 2, 2, 0, 3, 2, 0, 4, 1, 2, 4, 3, 0, 4, 1, 0, 3, 4, 0, 4, 4, 0, 0, 2,
+    0, 3, 2, 2, 2, 0, 2, 4, 4, 0, 4, 1, 0, 0, 4, 0, 4, 2, 1, 2, 1, 2, 2, 4,
+    2, 0, 3, 5, 4, 1, 0, 3, 4, 0, 3, 0, 4, 4, 0, 3, 2, 0, 3, 4, 0, 4, 0, 3,
+    3, 0, 3, 0, 2, 2, 4, 0, 4, 4, 3, 0, 4, 0, 4, 4, 4, 3, 2, 0, 4, 3, 0, 2,
+    3, 0, 4, 3, 0, 4, 3, 0, 1, 6, 0, 2, 5, 2, 0, 2, 5, 4, 1, 3, 1, 0, 4, 2,
+    2, 5, 4, 1, 3, 5, 0, 2, 1, 3, 2, 0, 2, 0, 2, 2, 5, 0, 4, 1, 0, 0, 2, 1,
+    3, 3, 0, 3, 0, 3, 1, 0, 4, 0, 4, 1, 0, 4, 1, 0, 4, 1, 2, 3, 2, 1, 3, 2,
+    0, 1, 0, 4, 2, 3, 0, 4, 1, 3, 1, 1, 2, 0, 4, 2, 0, 2, 5, 0, 4, 1, 2, 0,
+    3, 1, 3, 4, 3, 4, 1, 3, 4, 3, 2, 1, 3, 1, 2, 3, 4, 1, 2, 3, 2, 3, 2, 3,
+    2, 3, 4, 4, 1, 1, 3, 2, 2, 3, 3, 2, 4, 3, 3, 2, 2, 1, 4, 1, 4, 3, 2, 1,
+    2, 4, 1, 3, 3, 2, 4, 1, 3, 2, 5, 2, 2, 2, 4, 3, 0, 4, 1, 0, 3, 2, 0, 3,
+    1, 0, 5, 0, 4, 2, 0, 0, 3, 0, 5, 4, 3, 2, 2, 3, 2, 3, 4, 0, 2, 0, 5, 3,
+    2, 0, 2, 1, 3, 1, 5, 1, 2, 4, 1, 2, 3, 2, 3, 2, 2, 2, 4, 5, 3, 2, 3, 6,
+    2, 3, 3, 0, 3, 0, 5, 2, 0, 0, 3, 4, 1, 4, 2, 0, 3, 2, 2, 3, 4, 4, 1, 2,
+    3, 2, 1, 2, 2, 3, 2, 0, 4, 0, 4, 2, 0, 0, 1, 0, 5, 4, 0, 0, 0, 2, 0, 4,
+    3, 2, 1, 4, 0, 5, 2, 0, 0, 0, 2, 1, 4, 2, 0, 0, 4, 1, 1, 6, 1, 2, 4, 2,
+    1, 3, 5, 2, 3, 0, 5, 2, 1, 0, 0, 4, 1, 3, 1, 0, 3, 3, 2, 1, 4, 2, 3, 3,
+    0, 2, 1, 3, 4, 0, 3, 2, 3, 3, 2, 3, 2, 3, 2, 0, 2, 0, 3, 4, 0, 1, 0, 3,
+    3, 0, 4, 0, 5, 2, 0, 1, 0, 3, 4, 1, 6, 4, 1, 5, 1, 4, 1, 0, 0, 2, 2, 3,
+    3, 2, 2, 0, 5, 2, 1, 0, 0, 3, 0, 4, 2, 3, 0, 2, 1, 4, 3, 0, 0, 2, 1, 3,
+    4, 0, 4, 0, 4, 2, 3, 0, 3, 2, 3, 3, 0, 4, 1, 4, 3, 0, 5, 4, 2, 3, 1, 0,
+    2, 0, 4, 1, 0, 2, 3, 1, 3, 4, 2, 1, 0, 5, 1, 0, 0, 0, 4, 1, 3, 4, 0, 2,
+    3, 2, 5, 4, 2, 3, 1, 2, 1, 1, 2, 1, 6, 2, 3, 1, 0, 1, 0, 4, 2, 1, 2, 5,
+    0, 4, 2, 1, 0, 5, 0, 3, 3, 0, 5, 2, 3, 2, 1, 4, 0, 5, 3, 0, 0, 0, 3, 0,
+    4, 1, 4, 0, 2, 3, 2, 4, 5, 3, 1, 6, 0, 5, 2, 0, 0, 4, 3, 2, 2, 2, 5, 2,
+    3, 2, 3, 4, 1, 4, 2, 0, 0, 1, 2, 3, 2, 0, 3, 0, 5, 2, 0, 0, 3, 2, 1, 4,
+    3, 0, 2, 3, 1, 4, 2, 1, 6, 3, 1, 4, 3, 2, 1, 2, 1, 4, 3, 0, 3, 4, 1, 4,
+    3, 0, 3, 2, 1, 3, 5, 0, 3, 1, 3, 2, 0, 3, 1, 3, 2, 2, 1, 1, 4, 2, 0, 0,
+    2, 1, 4, 3, 0, 0, 4, 2, 2, 3, 6, 1, 4, 3, 0, 0, 3, 2, 3, 2, 2, 3, 1, 3,
+    2, 1, 4, 2, 3, 3, 2, 1, 0, 5, 2, 0, 0, 0, 4, 2, 3, 3, 4, 3, 3, 2, 4, 4,
+    0, 4, 2, 0, 2, 3, 3, 1, 7, 0, 4, 3, 0, 3, 2, 0, 5, 4, 1, 0, 3, 2, 0, 4,
+    2, 1, 2, 4, 2, 3, 3, 4, 1, 1, 3, 4, 1, 2, 0, 5, 4, 3, 0, 0, 2, 2, 3, 2,
+    0, 1, 0, 5, 4, 3, 0, 0, 4, 0, 5, 5, 0, 0, 0, 1, 1, 4, 3, 0, 4, 3, 1, 4,
+    3, 2, 0, 1, 1, 3, 2, 4, 3, 1, 4, 1, 0, 0, 4, 0, 5, 3, 0, 0, 2, 3, 1, 3,
+    3, 2, 3, 0, 5, 3, 2, 0, 0, 4, 0, 3, 1, 0, 3, 1, 3, 3, 0, 5, 0, 5, 4, 0,
+    0, 0, 1, 2, 3, 3, 0, 1, 2, 3, 5, 4, 2, 0, 5, 1, 0, 0, 5, 2, 0, 4, 3, 0,
+    0, 1, 2, 3, 2, 2, 1, 1, 3, 4, 1, 4, 1, 2, 2, 5, 0, 5, 2, 0, 0, 0, 1, 0,
+    2, 7, 4, 1, 4, 4, 1, 0, 1, 0, 4, 3, 0, 1, 4, 1, 1, 7, 2, 3, 4, 1, 2, 0,
+    3, 5, 0, 3, 2, 3, 4, 1, 4, 1, 4, 1, 0, 3, 4, 0, 4, 4, 0, 0, 3, 0, 4, 5,
+    4, 0, 3, 0, 3, 3, 2, 3, 0, 4, 3, 2, 0, 4, 0, 5, 4, 0, 0, 2, 1, 3, 2, 6,
+    3, 0, 5, 3, 0, 0, 0, 4, 1, 4, 4, 0, 0, 2, 0, 4, 3, 0, 1, 2, 1, 2, 1, 1,
+    1, 4, 2, 1, 2, 3, 1, 2, 4, 5, 1, 4, 1, 0, 5, 4, 2, 3, 4, 3, 2, 0, 5, 2,
+    0, 2, 1, 4, 3, 2, 2, 2, 2, 3, 1, 0, 3, 1, 4, 2, 0, 1, 4, 2, 2, 3, 1, 2,
+    3, 3, 4, 4, 3, 2, 2, 4, 4, 2, 3, 4, 5, 1, 4, 4, 2, 2, 1, 5, 1, 2, 5, 1,
+    3, 5, 1, 1, 3, 2, 3, 3, 4, 2, 3, 2, 3, 3, 2, 0, 2, 1, 4, 2, 1, 0, 2, 1,
+    4, 2, 1, 0, 4, 3, 3, 2, 1, 2, 2, 1, 6, 1, 2, 5, 4, 1, 4, 2, 1, 0, 3, 4,
+    2, 4, 1, 2, 4, 2, 1, 2, 1, 1, 5, 3, 0, 0, 0, 4, 0, 4, 2, 0, 1, 4, 2, 3,
+    1, 0, 4, 0, 4, 2, 1, 0, 1, 1, 5, 2, 0, 0, 0, 2, 3, 3, 2, 0, 1, 2, 3, 4,
+    0, 4, 1, 4, 4, 1, 4, 3, 0, 2, 6, 3, 3, 3, 3, 2, 1, 4, 2, 4, 3, 3, 3, 4,
+    1, 2, 5, 1, 5, 4, 2, 2, 3, 4, 2, 4, 4, 2, 3, 3, 0, 6, 0, 6, 3, 0, 0, 0,
+    0, 1, 1, 3, 1, 2, 2, 2, 3, 4, 3, 4, 2, 4, 2, 1, 0, 2, 1, 3, 3, 2, 1, 1,
+    4, 2, 1, 4, 2, 3, 3, 3, 4, 3, 3, 3, 4, 3, 2, 3, 2, 2, 5, 2, 4, 4, 3, 2,
+    1, 5, 1, 6, 3, 2, 7, 4, 3, 3, 4, 0, 2, 3, 3, 1, 2, 4, 0, 5, 2, 0, 0, 2,
+    1, 1, 5, 2, 0, 0, 0, 7, 4, 2, 5, 6, 1, 2, 5, 2, 4, 2, 4, 2, 3, 3, 4, 3,
+    4, 1, 4, 2, 3, 2, 1, 2, 4, 2, 0, 0, 2, 0, 6, 2, 0, 0, 0, 0, 2, 0, 5, 5,
+    2, 0, 3, 2, 0, 4, 4, 1, 0, 2, 0, 5, 4, 1, 0, 0, 3, 1, 4, 4, 1, 0, 4, 1,
+    5, 1, 0, 0, 3, 4, 3, 3, 1, 0, 2, 2, 3, 6, 3, 2, 2, 4, 2, 0, 3, 2, 1, 4,
+    4, 1, 0, 2, 4, 2, 2, 5, 0, 5, 1, 0, 0, 0, 1, 2, 4, 4, 0, 0, 1, 3, 3, 3,
+    2, 3, 0, 5, 3, 4, 0, 5, 4, 0, 5, 3, 0, 0, 0, 2, 4, 2, 5, 2, 3, 2, 6, 1,
+    4, 2, 1, 4, 1, 4, 3, 0, 0, 1, 1, 4, 2, 0, 3, 4, 2, 4, 2, 0, 0, 4, 0, 5,
+    3, 2, 0, 3, 2, 0, 2, 7, 2, 0, 2, 2, 6, 1, 3, 4, 0, 1, 4, 2, 6, 5, 1, 5,
+    3, 0, 0, 0, 2, 5, 1, 7, 2, 4, 2, 3, 0, 3, 2, 4, 3, 0, 0, 2, 3, 3, 5, 0,
+    4, 3, 3, 4, 1, 4, 0, 5, 1, 0, 0, 2, 5, 4, 2, 2, 4, 0, 4, 2, 1, 0, 4, 1,
+    4, 2, 0, 0, 3, 6, 1, 3, 6, 1, 4, 3, 4, 4, 3, 0, 4, 3, 4, 4, 0, 0, 4, 3,
+    3, 3, 0, 4, 6, 1, 5, 2, 4, 4, 3, 0, 4, 0, 3, 3, 4, 3, 2, 4, 4, 3, 0, 5,
+    5, 2, 3, 4, 1, 4, 4, 0, 0, 3, 2, 4, 4, 0, 0, 4, 4, 2, 7, 4, 2, 3, 4, 0,
+    3, 5, 2, 4, 3, 3, 3, 4, 0, 4, 0, 5, 4, 0, 3, 0, 4, 0, 4, 4, 0, 0, 4, 2,
+    4, 4, 0, 0, 3, 1, 4, 4, 0, 0, 4, 0, 6, 3, 0, 0, 0, 0, 4, 5, 2, 6, 3, 4,
+    2, 4, 5, 1, 4, 6, 3, 0, 4, 1, 4, 4, 3, 0, 4, 1, 5, 4, 0, 0, 3, 4, 4, 2,
+    7, 6, 5, 2, 4, 5, 4, 3, 3, 0, 4, 2, 4, 4, 0, 0, 5, 4, 3, 4, 0, 4, 2, 2,
+    4, 4, 0, 6, 4, 0, 0, 3, 0, 5, 0, 7, 4, 3, 0, 0, 0, 0, 4, 0, 1, 7, 0, 3,
+    3, 0, 6, 4, 2, 5, 4, 1, 3, 3, 4, 3, 6, 1, 7, 6, 1, 6, 6, 2, 6, 5, 3, 2,
+    5, 6, 3, 2, 6, 5, 4, 3, 6, 5, 6, 7, 1, 6, 7, 1, 5, 5, 2, 6, 5, 3, 5, 6,
+    0, 0, 0, 6, 5, 3, 5, 0, 6, 2, 2, 5, 6, 3, 4, 6, 0, 0, 6, 0, 2, 6, 5, 2,
+    3, 6, 0, 5, 0, 5, 6, 0, 0, 0, 6, 1, 3, 6, 0, 5, 2, 4, 6, 0, 0, 6, 2, 2,
+    6, 5, 1, 4, 6, 5, 0, 6, 0, 4, 6, 0, 0, 6, 4, 4, 6, 0, 0, 6, 1, 4, 6, 0,
+    0, 6, 1, 2, 6, 5, 1, 6, 6, 0, 0, 0, 0, 6, 1, 3, 5, 0, 6, 0, 2, 5, 6, 2,
+    3, 5, 0, 6, 3, 4, 6, 5, 0, 6, 6, 2, 5, 6, 1, 2, 5, 6, 3, 3, 6, 5, 6, 1,
+    4, 6, 0, 0, 5, 5, 1, 8, 3, 1, 8, 4, 1, 8, 3, 4, 8, 0, 0, 8, 7, 1, 8, 8,
+    1, 8, 4, 1, 7, 4, 2, 7, 8, 6, 1, 8, 3, 4, 8, 7, 0, 8, 4, 4, 8, 7, 0, 8,
+    1, 1, 8, 7, 1, 7, 4, 2, 8, 7, 1, 2, 8, 7, 2, 1, 8, 3, 2, 8, 7, 1, 3, 8,
+    0, 8, 7, 2, 7, 8, 5, 4, 8, 7, 0, 8, 9, 1, 8, 3, 4, 8, 0, 0, 7, 5, 2, 8,
+    7, 6, 2, 8, 7,
+};
+static const uint16_t HYPH_DE_1996_VALUE_OFFSETS[] = {
+    0, 1, 4, 7, 12, 16, 19, 24, 27, 30, 35, 38, 42, 47, 52, 56,
+    61, 65, 69, 74, 78, 81, 86, 91, 96, 101, 105, 110, 114, 117, 121, 125,
+    128, 133, 138, 143, 146, 151, 156, 161, 165, 168, 173, 178, 182, 187, 191, 196,
+    201, 206, 211, 215, 218, 221, 224, 227, 230, 234, 240, 246, 250, 255, 260, 264,
+    268, 272, 276, 281, 285, 291, 295, 299, 302, 308, 312, 317, 321, 326, 332, 336,
+    341, 345, 351, 357, 362, 368, 373, 376, 381, 387, 392, 398, 403, 408, 411, 415,
+    420, 425, 430, 436, 441, 446, 450, 454, 460, 466, 472, 478, 483, 488, 492, 498,
+    504, 509, 513, 519, 525, 529, 534, 539, 545, 550, 555, 559, 565, 571, 577, 583,
+    586, 590, 594, 599, 603, 608, 613, 617, 623, 628, 633, 639, 645, 650, 656, 661,
+    667, 673, 678, 683, 688, 691, 695, 699, 702, 706, 710, 714, 717, 721, 724, 728,
+    732, 736, 742, 747, 753, 760, 765, 772, 775, 779, 784, 788, 792, 797, 804, 810,
+    815, 820, 825, 831, 838, 844, 851, 857, 860, 864, 869, 876, 881, 885, 890, 895,
+    900, 905, 910, 915, 922, 925, 928, 934, 939, 946, 952, 958, 963, 969, 974, 980,
+    985, 991, 996, 1003, 1008, 1012, 1017, 1021, 1026, 1032, 1038, 1043, 1048, 1055, 1061, 1065,
+    1068, 1075, 1079, 1084, 1090, 1095, 1102, 1108, 1114, 1120, 1126, 1132, 1137, 1142, 1147, 1153,
+    1159, 1163, 1169, 1174, 1179, 1184, 1191, 1196, 1200, 1206, 1209, 1215, 1222, 1228, 1233, 1238,
+    1245, 1250, 1257, 1264, 1270, 1276, 1281, 1287, 1294, 1299, 1306, 1311, 1316, 1323, 1328, 1333,
+    1340, 1346, 1351, 1356, 1360, 1367, 1371, 1377, 1383, 1386, 1391, 1396, 1401, 1407, 1413, 1419,
+    1424, 1430, 1437, 1441, 1448, 1454, 1460, 1464, 1470, 1474, 1480, 1485, 1492, 1496, 1501, 1507,
+    1511, 1516, 1520, 1524, 1527, 1531, 1534, 1537, 1540, 1544, 1548, 1553, 1559, 1565, 1570, 1573,
+    1577, 1583, 1587, 1593, 1600, 1606, 1611, 1617, 1624, 1629, 1634, 1640, 1644, 1649, 1653, 1658,
+    1661, 1665, 1669, 1674, 1682, 1687, 1692, 1698, 1703, 1709, 1714, 1719, 1723, 1729, 1732, 1736,
+    1741, 1746, 1753, 1760, 1764, 1768, 1772, 1777, 1783, 1789, 1797, 1804, 1810, 1817, 1823, 1830,
+    1835, 1840, 1846, 1852, 1856, 1863, 1869, 1874, 1881, 1888, 1892, 1896, 1900, 1906, 1912, 1918,
+    1925, 1929, 1933, 1938, 1942, 1949, 1952, 1958, 1964, 1969, 1974, 1981, 1985, 1991, 1997, 2000,
+    2003, 2009, 2015, 2020, 2023, 2029, 2034, 2040, 2044, 2050, 2056, 2060, 2065, 2069, 2074, 2081,
+    2087, 2093, 2099, 2107, 2111, 2115, 2121, 2127, 2134, 2138, 2142, 2147, 2153, 2158, 2162, 2170,
+    2179, 2182, 2187, 2191, 2196, 2199, 2202, 2206, 2210, 2214, 2219, 2222, 2225, 2229, 2236, 2241,
+    2245, 2251, 2255, 2260, 2267, 2272, 2278, 2282, 2288, 2294, 2300, 2306, 2310, 2318, 2323, 2327,
+    2332, 2338, 2342, 2346, 2351, 2357, 2360, 2363, 2366, 2372, 2375, 2378, 2381, 2385, 2388, 2394,
+    2400, 2403, 2406, 2410, 2414, 2417, 2421, 2426, 2430, 2436, 2439, 2445, 2449,
+};
+
+// en-us: 4447 patterns, 1454 exceptions
+//
+// For ushyphex.tex, which is also added to the end of hyph-en-us.hyp.txt:
+// Copyright 2008 TeX Users Group.
+// You may freely use, modify and/or distribute this file.
+//
+// For other files:
+// Copyright (C) 1990, 2004, 2005 Gerard D.C. Kuiken.
+// Copying and distribution of this file, with or without modification,
+// are permitted in any medium without royalty provided the copyright
+// notice and this notice are preserved.
+static const uint16_t HYPH_EN_US_ALPHABET[] = {
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+    0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a,
+};
+static const uint32_t HYPH_EN_US_TRIE[] = {
+    0x340, 0x661, 0x9a2, 0xc83, 0xfc4, 0x12e5, 0x1606, 0x18c7,
+    0x1be8, 0x1f09, 0x224a, 0x22eb, 0x25cc, 0x28ed, 0x2bce, 0x2f0f,
+    0x3230, 0x771, 0x3512, 0x3833, 0x3b54, 0x3e95, 0x4156, 0x42d7,
+    0x4578, 0x4879, 0x4afa, 0x4d21, 0x5002, 0x5043, 0x52a4, 0x5545,
+    0x5806, 0x58a7, 0x5aa8, 0x5b29, 0x458a, 0x5dcb, 0x5dec, 0x5f4d,
+    0x602e, 0x61ef, 0x64b0, 0x7f1, 0x64f2, 0x6753, 0x69f4, 0x4055,
+    0x6a96, 0x6c37, 0xa58, 0x15d9, 0xb3a, 0x6d82, 0x5403, 0x106f64,
+    0xb85, 0x100ca6, 0x7147, 0x5028, 0x284cc9, 0x20000a, 0xd8b, 0x732c,
+    0x6dad, 0x1074ce, 0x18000f, 0x76f0, 0xbf1, 0x87992, 0x7c13, 0x7d34,
+    0x7f15, 0x5b56, 0x1bb7, 0xe38, 0x22b9, 0x165a, 0x8021, 0x303162,
+    0x287c55, 0x480004, 0x82c5, 0x400006, 0xeed5, 0x500008, 0x8589, 0x20000a,
+    0x68000b, 0x6082ec, 0x48000d, 0x500ece, 0x860f, 0x180010, 0x120c5, 0x1912,
+    0x380db3, 0x4027f4, 0x8815, 0x200016, 0x580017, 0x788a61, 0x1a19, 0x882183,
+    0xfdb6, 0x8c85, 0x10378, 0x1480006, 0x408d48, 0x788f89, 0x6927b2, 0x9810cb,
+    0x708f6c, 0x12be5, 0x90000e, 0x78918f, 0x14415, 0x200011, 0x9392, 0x800013,
+    0x305e14, 0x94d5, 0x17729, 0x18125, 0x188ef, 0x780019, 0x123a, 0xa09761,
+    0x200002, 0x900003, 0xb80004, 0x9aa5, 0x480006, 0x9847, 0xc00008, 0x9d89,
+    0x20000a, 0xc8000b, 0x764c, 0x20000d, 0xb0000e, 0x78a02f, 0x200010, 0x1780009,
+    0x78a2f2, 0xa84893, 0x1734, 0x78a4d5, 0x200016, 0x200017, 0x1480005, 0x102959,
+    0xa6a1, 0x305282, 0xa923, 0xab64, 0xaca5, 0x206ac6, 0xaea7, 0xb816a8,
+    0x28afc9, 0x20162a, 0x422b, 0xb1cc, 0xb2ed, 0xb54e, 0xb7ef, 0xba90,
+    0x2018f1, 0xbd32, 0xbfd3, 0xc1f4, 0x18a1f5, 0x9e96, 0x93f7, 0x1a58,
+    0x4cb9, 0x78c321, 0x580002, 0x1490345, 0x180004, 0xc5e5, 0x4857e6, 0x10649,
+    0x180008, 0x78c7e9, 0x1e285, 0x16829, 0xe04fec, 0x18000d, 0x18000e, 0x78448f,
+    0x580010, 0x100008, 0x6a32, 0xd00013, 0x403c74, 0xd8c855, 0x1e595, 0x78c961,
+    0x880002, 0x780019, 0x680004, 0xcb85, 0x16a3a, 0xe86fa7, 0x5da8, 0xce69,
+    0x1080000, 0x18709, 0x289b6c, 0x201b8d, 0xb18e, 0x78d14f, 0x880010, 0x1886f,
+    0x78c6b2, 0x281c73, 0x22d4, 0xce15, 0x1f155, 0x880017, 0x15fc1, 0x784339,
+    0xd381, 0x200002, 0x780010, 0x1480013, 0xd5e5, 0x200006, 0x1780009, 0x200008,
+    0xd889, 0x162ec, 0x18000b, 0xb0394c, 0x4824ed, 0x30000e, 0xdaaf, 0x580010,
+    0x1480013, 0xf04672, 0xe824b3, 0x4914, 0xa8d5, 0x1280019, 0x2027d7, 0x20c74,
+    0x4539, 0x30ba21, 0xdc02, 0xde63, 0x40e0a4, 0xf8b5c5, 0xe1a6, 0x40e2e7,
+    0x880008, 0x1000009, 0x88000a, 0x18000b, 0xe52c, 0xe76d, 0xe9ce, 0x40eb0f,
+    0x40b8b0, 0x2631, 0x18edb2, 0xef13, 0xf134, 0x200015, 0x406136, 0x580017,
+    0x2cf8, 0x180019, 0x76ba, 0x1085201, 0x19988, 0x199c9, 0x16701, 0x7860e5,
+    0xd1c1, 0x200002, 0x1480005, 0x1b2cf, 0xf365, 0x880006, 0x1580008, 0x680008,
+    0x20f4a9, 0x324f, 0x68000b, 0x20492c, 0x20000d, 0x584e, 0x640f, 0x32f5,
+    0x1480013, 0x3312, 0xe87d53, 0x900014, 0x21505, 0x1280008, 0x200017, 0xf6e1,
+    0x303602, 0xe85343, 0x407244, 0xf825, 0x4035c6, 0xb07887, 0xd00008, 0xfb49,
+    0x18000a, 0x3c8b, 0x20fdcc, 0x40838d, 0xa8000e, 0xff0f, 0x408a10, 0x21861,
+    0x480012, 0xa87a33, 0x1901d4, 0x10315, 0x3bf6, 0x300017, 0x22d35, 0x78a5b9,
+    0x7904e1, 0x485b02, 0x580003, 0x68000c, 0x10705, 0x480006, 0x128000f, 0x400008,
+    0x109e9, 0x880012, 0x18000b, 0x48000c, 0x203d4d, 0x48820e, 0x790c2f, 0x490af0,
+    0x108000e, 0x500012, 0xe846b3, 0x180014, 0x78f0f5, 0x1da93, 0x180017, 0x790ec1,
+    0xb00002, 0x11183, 0xff64, 0x112c5, 0x880006, 0x11547, 0xb07208, 0x11809,
+    0x20000a, 0x110948b, 0x48000c, 0x90400d, 0xe872ee, 0x11a6f, 0xb854f0, 0x200011,
+    0x203f92, 0xa91d53, 0x2116f4, 0x11ef5, 0xc00016, 0xb80017, 0x68000f, 0x6699,
+    0x1842ba, 0x18e4e1, 0xf562, 0x12083, 0xd624, 0x9705, 0x4266, 0x12127,
+    0xc04ba8, 0x292329, 0x90000a, 0x4074eb, 0x124ac, 0x1276d, 0x1127ce, 0x29294f,
+    0x12ad0, 0x200011, 0x12cb2, 0x12f53, 0x13074, 0x28dd75, 0xa2b6, 0xbd77,
+    0x116e05, 0x4bd9, 0x793181, 0x480002, 0x16f89, 0x680004, 0x13465, 0x180006,
+    0x180007, 0x13668, 0x13949, 0x235e4, 0x120000b, 0x118b2ac, 0x48000d, 0xd0000e,
+    0x13b0f, 0x488650, 0x680010, 0x290272, 0xa87bb3, 0x313db4, 0x13f35, 0x2374f,
+    0x880017, 0x14181, 0x2096c2, 0x20ce43, 0x5e24, 0x144e5, 0x207f26, 0x293107,
+    0x686168, 0x147c9, 0x88000a, 0x7e8b, 0x20abac, 0x20c3cd, 0x136ae, 0x14a6f,
+    0x20aef0, 0x23949, 0xb8e7b2, 0x1114cf3, 0xfe14, 0x14d95, 0xc616, 0x200017,
+    0x900012, 0xa0f9, 0x294f21, 0x580002, 0x15203, 0x580004, 0x15345, 0x500006,
+    0xd00007, 0x113c08, 0x15629, 0x214c1, 0x2888cb, 0xc0c06c, 0x31090d, 0xb8000e,
+    0x7958cf, 0x15ad0, 0x4a11, 0x200012, 0x415c73, 0x15db4, 0x795f95, 0x180016,
+    0x284c97, 0x12138f, 0x1290dd9, 0x7961a1, 0x300002, 0x1855e3, 0x480004, 0x164c5,
+    0x300006, 0x480007, 0x16788, 0x169e9, 0x24945, 0x15a41e1, 0x40a60c, 0x4853ad,
+    0xa8000e, 0x796c8f, 0x480010, 0x24e01, 0x15732, 0xe86e33, 0x80a834, 0x796f75,
+    0x180016, 0x68a077, 0x128000f, 0x789059, 0x18597a, 0x17061, 0xcba2, 0x170c3,
+    0x17304, 0x8c65, 0x6dc6, 0x6887, 0x100019, 0x13135e9, 0x90000a, 0x18000b,
+    0x174ac, 0x140ed, 0x175ce, 0x896f, 0x14f10, 0x14a6145, 0x17912, 0x417bb3,
+    0x15a94, 0x885b75, 0xc00016, 0x797d01, 0x59b8, 0xf5eb, 0x611a, 0x17ee5,
+    0x1bbae, 0x1480015, 0x1580010, 0x18169, 0xf752, 0xf8b3, 0x880001, 0x18501,
+    0x200002, 0x1838f, 0x1e4c9, 0x18785, 0x126a29, 0x1e64c, 0x61c8, 0x297e89,
+    0xf00016, 0x128000b, 0x924c, 0x1280019, 0x622e, 0x1387f4f, 0x900010, 0x230000e,
+    0x7412, 0x13d13, 0x180014, 0x20f72, 0x218801, 0xfb81, 0x1400003, 0x680019,
+    0x207045, 0xb485, 0x10a030e, 0x2079e8, 0x88e349, 0xb2c9, 0x2a05d2, 0x1c00013,
+    0x21825, 0x21990, 0x8866ef, 0x88ac10, 0x280013, 0x1280008, 0x900009, 0xc06f54,
+    0x206515, 0xc4d5, 0x2174f, 0x680018, 0x86c1, 0x200002, 0x20b583, 0x200004,
+    0xfa05, 0x216a1, 0x7127, 0x500008, 0x200009, 0x217e5, 0x235a5, 0xe42c,
+    0xdf6d, 0xd8ae, 0xb9798f, 0x18990, 0x680010, 0xd992, 0x18a73, 0x83f4,
+    0x9897c1, 0x180002, 0x200017, 0x1280017, 0x40e665, 0x1280019, 0x26de1, 0x980001,
+    0x3087a9, 0x1280019, 0x180019, 0x108000c, 0x18000d, 0x2b535, 0x788bef, 0x900001,
+    0x1080003, 0x129e3, 0x1fda5, 0x6e54, 0x10803, 0x9544, 0x7565, 0x75c6,
+    0x76c7, 0xe872ba, 0x129cc, 0x18000f, 0x1714cae, 0xc8ec, 0xb4ed, 0x18d0e,
+    0x1480013, 0xc150, 0x12c94, 0x10f72, 0x11df3, 0x16754, 0x12bb5, 0xa916,
+    0x7937, 0x18ce1, 0x880001, 0x19301, 0x200e5, 0x18f85, 0x880005, 0x7d65,
+    0x200c9, 0x19029, 0x1499448, 0x150f049, 0x1446c, 0x68000c, 0x2020f, 0x1248f,
+    0x88000f, 0x195ef, 0xec12, 0x230c3, 0xbd92, 0x190d5, 0xf2e1, 0xac35,
+    0x2180019, 0x1db85, 0x19885, 0xa779, 0x809a, 0x1d9c9, 0x19909, 0x1480005,
+    0x680010, 0x11381, 0x1480005, 0x880009, 0xf88f, 0x12045, 0x880012, 0xcbd2,
+    0x11728, 0x1693389, 0xd555, 0x8e81, 0x1480002, 0x81e3, 0xb739, 0x8485,
+    0x1480009, 0x1500007, 0x11c52, 0x9da9, 0x11c74, 0x13415, 0x105ac, 0x12abe48,
+    0x171ee, 0x26532, 0x9950, 0x8cb1, 0xab92, 0x1589453, 0x9af4, 0x158a655,
+    0xaed6, 0xd101, 0xe298, 0x99b9, 0x1ff45, 0xcd45, 0x15121c1, 0x23605,
+    0x20149, 0xb849, 0x15105e5, 0x1feec, 0x188ac, 0xa2c8, 0xe1c9, 0x9c8f,
+    0x680005, 0xa0000f, 0xdeb2, 0xa32e, 0xbc2f, 0x9fb5, 0x19ba1, 0x19a72,
+    0x100019, 0x24a21, 0x1519ce5, 0x1172e1, 0xaf03, 0x11564, 0x12a89, 0x16145,
+    0xa6c7, 0x24c69, 0x1580015, 0x9964e9, 0x19eef, 0xaf8c, 0xd2ad, 0x161a16e,
+    0x68000d, 0x1786f, 0xa515, 0xb1b2, 0xdaf3, 0xb014, 0xc0d9, 0x111c1,
+    0x12e61, 0x1c061, 0x292e1, 0xb925, 0x151a265, 0x11b2a5, 0x20849, 0xb989,
+    0x1a3c9, 0x1caa9, 0x2a93e9, 0x1a761, 0x2080f, 0xbe0f, 0x1a5cf, 0x15154e5,
+    0xf5b2, 0x20874, 0x11c21, 0x17649, 0xbb15, 0x1b3d5, 0x13865, 0x1280017,
+    0xc4ae, 0x19a2f, 0x19c49, 0x180000, 0x29621, 0x680005, 0x234e5, 0xffb5,
+    0x1a8cf, 0xe822, 0x23469, 0x150c504, 0xc6c5, 0xd406, 0xd495, 0x1480009,
+    0x2330f, 0x23512, 0x232f3, 0xca2c, 0xcacd, 0xd06e, 0x1580017, 0xd2d0,
+    0x128000f, 0x14872, 0x158d213, 0xd854, 0xd775, 0xdb56, 0x1aa41, 0xdd18,
+    0x1aba1, 0x1780001, 0x141e5, 0xde46, 0x1ae25, 0x16de8, 0x1a069, 0xdf48,
+    0x13d89, 0x1296c, 0x1b00012, 0x23833, 0x1914f, 0x880015, 0x1af4f, 0x11592,
+    0xe5f3, 0x1280002, 0xe935, 0x16001, 0xe115, 0x1ace3, 0xf259, 0x1b0e5,
+    0xe5b9, 0x148000d, 0x1514c68, 0x1514989, 0x1480010, 0xf00b, 0xea0c, 0xea2d,
+    0xec2e, 0x1012f, 0x1b2f0, 0xebd1, 0x2d248, 0x2d009, 0x149a4b4, 0x1b3f5,
+    0x149b501, 0xefb7, 0x20221, 0x1510999, 0x149b645, 0x103e1, 0x204c5, 0x1513f08,
+    0x1511889, 0x10da5, 0x1520389, 0x1e045, 0x780006, 0x1bd49, 0x1b7ef, 0x1e2c9,
+    0x203cf, 0x1ba12, 0x1bd81, 0xf86f, 0xf315, 0x1e08f, 0x1c045, 0xf853,
+    0xf4f9, 0x11a88, 0x1b6a9, 0x1e115, 0x180000, 0x10f21, 0x19a7c1, 0xd80001,
+    0x10aaf, 0x1510845, 0x12e05, 0x11bb2, 0x1280003, 0x118e9, 0x19649, 0x1480005,
+    0x10e2c, 0x1480008, 0x88000c, 0x1108f, 0x1150af, 0x132d0, 0x191212, 0x11ce4,
+    0x12245, 0x110f5, 0x120785, 0x880009, 0x41bcc9, 0x2e6e3, 0x100004, 0x11e0c,
+    0x1280017, 0x2074c, 0x1230f, 0x138e1, 0x148000f, 0x12012, 0x123b3, 0x13145,
+    0x192ab5, 0x14a5f61, 0x900009, 0x980009, 0x2e812, 0x1480005, 0xf0000c, 0x123905,
+    0x98000e, 0x11344f, 0x15241, 0x14a39c9, 0x1480005, 0x12ec4, 0x413a85, 0x13695,
+    0x26169, 0x1480001, 0x9939e9, 0x1280019, 0x8a3a52, 0x1502c, 0x18000d, 0x1bf41,
+    0x12eaf, 0x14ae6c9, 0x19b324, 0x15785, 0x26cc5, 0x414507, 0x1280019, 0x1c149,
+    0x26ec9, 0x13b6b, 0x18979, 0x580001, 0x13f4e, 0x1493ecf, 0x23041, 0x1d7a5,
+    0x14921, 0x1c253, 0x1c354, 0x15df5, 0x13fe5, 0x2ed92, 0x1480009, 0x16048,
+    0x16469, 0xd0000f, 0x162edd4, 0x10000c, 0x232af, 0x923be1, 0x1802f, 0x580015,
+    0x2ee12, 0x23c25, 0x142d3, 0x400019, 0x880015, 0x1c4e1, 0x145c2, 0x14823,
+    0x152e4, 0x17c05, 0x15886, 0x158000f, 0x1280003, 0x99c409, 0x100005, 0x300000e,
+    0x152e829, 0x14f4d, 0x24729, 0x1692f, 0x280010, 0x1780011, 0x14af2, 0x15153,
+    0x180000, 0x15e41, 0x100005, 0x28ce1, 0x1480015, 0x680008, 0x28b69, 0x28f05,
+    0x15328, 0x186a9, 0x11b001, 0x155ab, 0x68000c, 0x1280003, 0x1c785, 0x1568f,
+    0x15a50, 0x196328, 0x1c8a9, 0x15b33, 0x168f4, 0x15555, 0x68000c, 0x2fbcc,
+    0x1864f, 0x29ae5, 0x680002, 0x215b52, 0x15bf3, 0x16d74, 0x118435, 0x16b27,
+    0x29dcc, 0x1080000, 0x100019, 0x1280019, 0x180000c, 0x16b04, 0x15cee, 0x160000d,
+    0x16d47, 0x30125, 0x1780012, 0x15f33, 0x16774, 0x16e8c, 0x1480015, 0x18dee,
+    0x2e7b6, 0x680001, 0x1280019, 0x18b72, 0x16cf3, 0x780014, 0x180000, 0x17b01,
+    0x17761, 0x25029, 0x1117f04, 0x68001a, 0x1a145, 0x17167, 0x3054f, 0x68000f,
+    0x17a29, 0x24165, 0x79846c, 0x188000d, 0x1736e, 0x240e9, 0x128000f, 0x2ebe8,
+    0x2ecc9, 0x1918213, 0xd9b494, 0x2432f, 0x17b35, 0x1780017, 0x280002, 0x16fb9,
+    0x680004, 0xd98bc5, 0xd00006, 0x28981, 0xd97ec4, 0x680005, 0x3000012, 0x128b05,
+    0x79722c, 0x900003, 0x19f8e, 0x177af, 0x1818c, 0x182cd, 0x1844e, 0xd8000f,
+    0x29c5f4, 0x289cf, 0x1ba52, 0x1980013, 0x1c634, 0x186d5, 0x18ba6, 0x18e27,
+    0x2f00012, 0x128000c, 0x900014, 0x1ab225, 0x18ecc, 0x18f0d, 0x698dce, 0x2b329,
+    0x1280013, 0x24701, 0x19052, 0x1ba33, 0x19414, 0x192c2, 0x18fc3, 0x19184,
+    0x24768, 0x24649, 0x1900007, 0x1a00008, 0x128000c, 0x2d472, 0x900013, 0x1aacc,
+    0x200015, 0x1c90e, 0x900012, 0x19690, 0x400000, 0x19732, 0x198b3, 0x1acb4,
+    0x19da4, 0x19976, 0x180000, 0x1ab61, 0x68000d, 0xd80009, 0x2ec0f, 0x151cb85,
+    0x1af6c, 0x2d20e, 0x79ca4e, 0x1cba9, 0xd80010, 0x2d172, 0x19bf2, 0x1bed3,
+    0x1499e94, 0x1a8000f, 0x30795, 0x1480017, 0x1a481, 0xd9a5e1, 0x19df4, 0x1b00003,
+    0x1a585, 0x18f25, 0x19ea6, 0x180001, 0x1c0a9, 0x180009, 0x303b2, 0x30573,
+    0x1a64c, 0x40000d, 0x41cbce, 0x19f2f, 0x1cd50, 0x1a821, 0x40000c, 0x1a0b3,
+    0x31a334, 0x1500005, 0x2cf30, 0x41a747, 0x1480019, 0x149ab29, 0x108001a, 0x2e665,
+    0x1b66c, 0x1ae6d, 0x1cdee, 0x2e649, 0x1be10, 0x1cca1, 0x1bb72, 0x1af13,
+    0x21fb81, 0x1cf25, 0x161b136, 0x1b237, 0x1fd25, 0x151cec9, 0x1c3fa, 0x880008,
+    0x1fd89, 0x260a5, 0x1c00004, 0x1c80f, 0x1280006, 0x260c9, 0x2ede4, 0x129b469,
+    0x20000c, 0x1b255, 0x1cd8c, 0x1cfad, 0xd8000e, 0x308b3, 0x1ce50, 0x29281,
+    0x1cfd2, 0x79b933, 0x1b9cf94, 0x1080000, 0x2edb2, 0x1c80002, 0x1c1c3, 0x1529269,
+    0xc80002, 0x180006, 0x400007, 0x1280001, 0x128000c, 0x68000f, 0x26b8e, 0x1c945,
+    0x1d0000d, 0x1c2ae, 0x880012, 0x980009, 0x26c74, 0x1d112, 0x880016, 0xd9d0f4,
+    0x1500012, 0x199c576, 0x3100005, 0x306c9, 0x1080019, 0x400000, 0x1c601, 0x1d122,
+    0x1d203, 0x300004, 0x1c845, 0x100019, 0x14a0b61, 0x30653, 0x1ca09, 0x30948,
+    0x780005, 0x1d16c, 0x129d2ad, 0x79d2ce, 0x20c09, 0x99d350, 0x880011, 0x1d3f2,
+    0x151d4d3, 0x99c974, 0xda0a6f, 0x99cb76, 0x1080000, 0x1d9cfe1, 0x180019, 0x1d5e3,
+    0xd80004, 0x1cb25, 0x200006, 0x1d067, 0x30607, 0x1fa81, 0x30a72, 0x3058a,
+    0x1d36c, 0x1fce5, 0x21d6ee, 0x79d32f, 0x1d230, 0x21fd09, 0x151d3b2, 0x161d4b3,
+    0x1d554, 0xd80000, 0x1e00016, 0x1fb4f, 0x480001, 0x1d464, 0x1080005, 0x1a00006,
+    0x1280007, 0x900015, 0x680003, 0x30bce, 0x2cc69, 0x1d6ac, 0x1d5cd, 0x1d7ce,
+    0x1d82f, 0x1d650, 0x18000f, 0x1280012, 0xd80013, 0x2a90e, 0x1d695, 0x680016,
+    0x1d841, 0xd80018, 0x27e65, 0x1780014, 0x149d8a5, 0x90000e, 0x27e09, 0x880010,
+    0x1d909, 0x1f972, 0x1480013, 0x1fc14, 0x27d6f, 0x30b2f, 0x1d7ef, 0x1e80001,
+    0x30ccf, 0x29d983, 0x312e2, 0x1d8c5, 0x1d795, 0x680007, 0x180001, 0x180002,
+    0x180019, 0x92c781, 0x1d92c, 0x1da6d, 0x68000e, 0x2c9e5, 0x19da50, 0xb80002,
+    0x1d883, 0x161da24, 0x24aad, 0x2498e, 0x1dac7, 0x300a2, 0x308ec, 0x90000f,
+    0x26a4af3, 0x69daec, 0x1db0d, 0x1db4e, 0x313ce, 0x30733, 0x2ca65, 0x1dbd2,
+    0x1db73, 0x29dd14, 0x1de21, 0x29ddf6, 0x1dc83, 0x680007, 0x21db25, 0x2ffd4,
+    0x90000f, 0x1480009, 0x29de89, 0x218ad, 0x2188e, 0x1de4c, 0x1480015, 0x2f2cf,
+    0x1deef, 0x218d3, 0x680014, 0x21ded2, 0x80001, 0x1df74, 0x21dd75, 0x1f00004,
+    0x1df05, 0x2e881, 0x14a9e25, 0x30707, 0x19e169, 0x2ea45, 0x29e69, 0x30046,
+    0x280003, 0x1df24, 0x19e06f, 0x280006, 0x2a8000f, 0x1de12, 0x307f2, 0x3008e,
+    0x1df55, 0x1e0ec, 0x28000d, 0x1e22e, 0x2fef3, 0x2000010, 0x1e1c1, 0x30801,
+    0x1f9dff3, 0x1df94, 0x1e0a5, 0x307c5, 0x2a445, 0x900018, 0x1e349, 0x2b00008,
+    0x2a2c9, 0x900003, 0x1b00004, 0x1b0000e, 0x1e3cf, 0x151e2e7, 0x88000f, 0x3122f,
+    0x313ec, 0x31589, 0x1e2b5, 0x1e4ed, 0x1e4ae, 0x6a0c81, 0x1080019, 0x21e6c1,
+    0x1e532, 0x20aa5, 0x1e554, 0x1e725, 0x280006, 0x220ba9, 0x28781, 0x29e9a9,
+    0x1eac1, 0x1b00002, 0x1e88c, 0x220b0f, 0x21e6a5, 0x1e9cf, 0x28969, 0x1c31692,
+    0x1ec49, 0x1e5b3, 0x1e7b4, 0x1e775, 0x282ef, 0x1e5ce, 0x1ea2f, 0x1e7f0,
+    0x2ed21, 0x315d3, 0x28295, 0x1e921, 0x1eb55, 0x1e7c3, 0x1eb04, 0x1ed85,
+    0x880019, 0x12e7e5, 0x22024, 0x1eea9, 0x8ae9c8, 0x220e7, 0x31772, 0x2eed0,
+    0x18000e, 0x19edef, 0x220ac, 0x2e94f, 0x2216e, 0x1e973, 0x1ed54, 0x1ed35,
+    0x221b2, 0x22193, 0x880014, 0x1edd9, 0x1f0001a, 0x900006, 0x280007, 0x305ee,
+    0x2080009, 0x30887, 0x1480005, 0x88000c, 0x304f3, 0x22a68, 0x17a2c69, 0x1ed70,
+    0x309ce, 0x21ef12, 0x1480013, 0x129ec94, 0x1ec15, 0x11efa1, 0x900017, 0x22c52,
+    0x3178c, 0x1f005, 0x22bb5, 0x31d63, 0x1ee48, 0x10000c, 0x14a19cd, 0x121ace,
+    0x1f08c, 0x21af0, 0x31759, 0x20000f, 0x21913, 0x21a94, 0x1f172, 0x1ee73,
+    0x1f114, 0x1efd5, 0x99f261, 0x41f182, 0x1f1c3, 0x2fe81, 0x1f3a5, 0x27fa4,
+    0x27f45, 0x980008, 0x99f629, 0x1480012, 0x980009, 0x30c14, 0x210000d, 0x1f20e,
+    0x41f6cf, 0x27fce, 0x128000f, 0x3000f, 0x99f253, 0x1f2d4, 0x19f1f5, 0xb9f421,
+    0x1f377, 0x29f743, 0x316b2, 0xc1f585, 0x2b2e1, 0x2feb9, 0x19f648, 0x21f8c9,
+    0x100005, 0x1f46b, 0x31184, 0x1f66d, 0x2b309, 0x1f6af, 0x21f990, 0x2eb05,
+    0x1f441, 0x41f693, 0x1f9b4, 0x1f615, 0x1f925, 0x680017, 0x31370, 0x1f4c8,
+    0x1fba9, 0x2ef8f, 0x2f0b0, 0x1fd62, 0x1fec3, 0x18000e, 0x1f84f, 0x29d41,
+    0x180007, 0x1fc32, 0x1fdc9, 0x129e05, 0x1f875, 0x1fe6c, 0x2000d, 0x29f29,
+    0x1f8b9, 0x1b0001a, 0x31ea5, 0x109fdf2, 0x3100004, 0x20074, 0x1ff35, 0x180000,
+    0x1fe81, 0x680002, 0x20023, 0x400004, 0x317ee, 0x6aa8c5, 0x20de1, 0x1280019,
+    0x1580012, 0x2a969, 0x20cc5, 0x1ffac, 0x1ff6d, 0x2010e, 0x20c49, 0x88000f,
+    0x1780001, 0x161ff92, 0x202c3, 0x20184, 0x128000f, 0x1480016, 0x20167, 0x20485,
+    0x325b2, 0x180007, 0x20e95, 0x202ac, 0x2ed65, 0x4203ee, 0x2ee27, 0x2050d,
+    0x205ae, 0x1480006, 0x200b3, 0x2eeec, 0x20572, 0x20593, 0x206b4, 0x2070c,
+    0x4206cd, 0x2062e, 0x32789, 0x1580014, 0x400000, 0x205f2, 0x20533, 0x20774,
+    0x400004, 0x20605, 0x6acf05, 0x30425, 0x327ce, 0x18001a, 0xbacd69, 0x304c9,
+    0x207ac, 0x2cfac, 0x7a090e, 0x7a07cf, 0x30902, 0x3044f, 0x204b2, 0x207f3,
+    0x20894, 0x6a0d21, 0x680016, 0x1080000, 0x22208c1, 0x400005, 0x220963, 0x1291c5,
+    0x209a5, 0x20d49, 0x29328, 0x292c9, 0x30972, 0x31b0933, 0xd8000e, 0x148000c,
+    0x20a8d, 0x20b8e, 0x108000f, 0xd80013, 0xf00014, 0xda0832, 0x20a53, 0x29215,
+    0x680015, 0x1080016, 0xd80000, 0x30983, 0x1c00002, 0xd8001a, 0xd80000, 0x1080005,
+    0x880002, 0x2280007, 0x3270f, 0x20ae9, 0x308cc, 0x900007, 0x31441, 0x23529,
+    0x1520d8e, 0x108000f, 0x148000c, 0x32745, 0x20d12, 0x20e53, 0x20ea2, 0x20f03,
+    0x1600016, 0x20ec5, 0x15b138d, 0x20da7, 0x32834, 0x314f0, 0x32666, 0x32603,
+    0x2106c, 0x68000d, 0x2104e, 0x303e1, 0x21010, 0x1480003, 0x211b2, 0x20f93,
+    0x211c1, 0x20f35, 0x21243, 0x12a10c4, 0x327b4, 0x26ae4, 0x10a11fa, 0x3048d,
+    0x32694, 0x303cf, 0x26a49, 0x2126c, 0x210ed, 0x2a12ee, 0x2110f, 0x1c00010,
+    0x28269cf, 0x21452, 0x221173, 0x6a1334, 0x1480015, 0x21301, 0x26bf5, 0x212c3,
+    0x2ea83, 0x1b00004, 0x3180008, 0x21407, 0x1b00007, 0x2eac1, 0x2eb49, 0x3180014,
+    0x238000c, 0x2148d, 0x2152e, 0x213af, 0x680010, 0x2ec69, 0x21472, 0x214f3,
+    0x214b4, 0x215a4, 0x280016, 0x88000f, 0x6a1647, 0x1080018, 0x680012, 0x32805,
+    0x1480009, 0x2170c, 0x217ad, 0x216ee, 0x2176f, 0x14a19e5, 0x315af, 0x21852,
+    0x21793, 0x21ba9, 0x21635, 0x21816, 0x221b2c, 0x27d42, 0x27e83, 0x90000f,
+    0x27b65, 0x32989, 0x221b52, 0x32ac1, 0x21c01, 0x21a55, 0x21a03, 0x68000c,
+    0x21aa5, 0x27f8e, 0x30a05, 0x180008, 0x421d09, 0x2e982, 0x30ae9, 0x21b6c,
+    0x1480005, 0x1b00016, 0x21c8f, 0x33429, 0x30b4f, 0x4a1cf2, 0x21d81, 0x21d34,
+    0x21e15, 0x1b00004, 0x21dc5, 0x2eb30, 0x1480004, 0x180000, 0x121ec9, 0x1c00001,
+    0x1480002, 0x21fcc, 0x21fe5, 0x221e6, 0x21eef, 0x30de7, 0x22209, 0x1280012,
+    0x22281, 0x88000c, 0x121f15, 0x1b00001, 0x22005, 0x1b00003, 0x2e8a4, 0x22068,
+    0x1a22c9, 0x180014, 0x880001, 0x170000c, 0x30870, 0x30831, 0x12210f, 0x2e96d,
+    0x30854, 0x22312, 0x222421, 0x1580004, 0x222b5, 0x2eaec, 0x223e5, 0x1b00006,
+    0x88000f, 0x33824, 0x9a24e9, 0x267cc, 0x32d65, 0x2234c, 0x900015, 0x18000e,
+    0x2236f, 0x26832, 0x268d3, 0x267b4, 0x224c1, 0x22254, 0x223b5, 0x1780016,
+    0x22525, 0x68000e, 0x2a485, 0x680010, 0x9a2609, 0x22ebd2, 0x2a389, 0x1480014,
+    0x32d99, 0x226ce, 0x2244f, 0x32ec2, 0x2a36f, 0x326ac, 0x400000, 0x22621,
+    0x1225b5, 0x22763, 0x1a26e4, 0x4227a5, 0x32533, 0x22907, 0x2a339, 0x422969,
+    0x180000, 0x18000b, 0x18000c, 0x32f52, 0x40000e, 0x32284f, 0x33b8e, 0x22927,
+    0x33c2f, 0x422873, 0x22954, 0x9a2815, 0x20000c, 0x68000d, 0x22b6e, 0x180019,
+    0x22550, 0x3080009, 0x22a12, 0x1280013, 0x22b34, 0x22a35, 0x222d41, 0x2f72f,
+    0x33a6f, 0x22cc4, 0x22d65, 0x33eb5, 0x22ce7, 0x2f795, 0x9a2de9, 0x331c1,
+    0x400000, 0x22e41, 0x22d8d, 0x2422e03, 0x22daf, 0x1a2c85, 0xd80006, 0x32e89,
+    0x22f68, 0x22fa9, 0x22dd5, 0xf0000b, 0x22f8c, 0x22e6d, 0x34049, 0x122f4f,
+    0x9a2ff0, 0x2fd27, 0x23261, 0x24a3153, 0x231b4, 0x122f35, 0x423125, 0x33aaf,
+    0x2fc0e, 0x400008, 0x223429, 0x2556c, 0xd8000d, 0x150000e, 0x2fb74, 0x180010,
+    0x2320f, 0x33b19, 0x300c3, 0x23192, 0x680015, 0x180014, 0x234b5, 0x100004,
+    0x780005, 0x32e2f, 0x680007, 0x2301a, 0x2ff8d, 0x1080000, 0x32f74, 0x2362c,
+    0x2500003, 0x2368e, 0x34792, 0x301f4, 0x26961, 0x200012, 0x14a3553, 0x23494,
+    0x26845, 0x2366c, 0x128000d, 0x2380e, 0x226889, 0x680010, 0x31809, 0x34850,
+    0x14a3733, 0x23842, 0x23863, 0x238a4, 0x3182f, 0x880012, 0x237e7, 0x3180005,
+    0x268b5, 0x348f2, 0x280001, 0x23a62, 0x2388d, 0x2396e, 0x1c00001, 0x23986,
+    0x23c47, 0x239b2, 0x23933, 0x23a94, 0x34b89, 0x1a3a36, 0x23acd, 0x23c6e,
+    0x3036c, 0x23b90, 0x34bf0, 0x23cd2, 0x1523cf3, 0x900005, 0x304b2, 0x23d76,
+    0x1480014, 0x30415, 0xda3c19, 0x23d81, 0x23d22, 0x23e43, 0x24064, 0x31603,
+    0x23ee6, 0x24027, 0x22ea72, 0x1480013, 0x680014, 0xd8000b, 0x258000c, 0x2410d,
+    0x2422e, 0x23def, 0x3150e, 0x2600011, 0x317b0, 0x23fb3, 0x224214, 0x23f01,
+    0x24136, 0x2a6e1, 0x317d6, 0x1243a5, 0x20001a, 0x2a6c5, 0x34ee9, 0x2a40c9,
+    0xd80000, 0x22a889, 0x24402, 0x24383, 0x25a21, 0x6a42af, 0x180006, 0x243e7,
+    0x225905, 0x32144, 0x2a612, 0x2a093, 0x25b49, 0x2450d, 0x2452e, 0x243cf,
+    0x24550, 0x320ec, 0x24692, 0x246d3, 0x246f4, 0x24575, 0x180016, 0x24741,
+    0x25975, 0x32334, 0x25b37, 0x2247a5, 0x288c1, 0x33d4c, 0x247c8, 0x24889,
+    0x28ba5, 0x1b00001, 0x24782, 0x24903, 0x28cc9, 0x247e5, 0x1480006, 0x33db6,
+    0x200012, 0x249c9, 0x28c4f, 0x1524615, 0x34f09, 0x2496d, 0x347e7, 0x17a482f,
+    0x180010, 0x400002, 0x24b83, 0x24853, 0x780014, 0x34e33, 0x24b07, 0x400008,
+    0x24b69, 0x1c00004, 0x30665, 0x24bcc, 0x349d5, 0x24b4e, 0x305a9, 0x180010,
+    0x180000, 0x24c12, 0x24d13, 0x24d74, 0x424dc4, 0x30b6e, 0x30d4f, 0x280007,
+    0x34b6e, 0x2ece1, 0x30cb3, 0x2ec83, 0x24ccc, 0x2a4d2d, 0x7a4f4e, 0x24a4f,
+    0x3000008, 0x8ab421, 0x24d52, 0x424d93, 0x25014, 0x2b445, 0x680016, 0x1080000,
+    0x1780001, 0x2b3c9, 0x2ed12, 0x25064, 0x34ff2, 0x2ed55, 0x1480007, 0x2b4af,
+    0x25381, 0x340cd, 0x3428e, 0x24fac, 0x25245, 0x251ee, 0x24eef, 0x254e8,
+    0x125549, 0x34ecc, 0x125193, 0x25094, 0x250a3, 0x2700004, 0x2542f, 0x34f32,
+    0x250c7, 0x10001a, 0x250e9, 0x253d4, 0x18000b, 0x2528c, 0x252cd, 0x2530e,
+    0x100019, 0x180003, 0x34ea1, 0x2a5372, 0x1525333, 0x25354, 0x253f5, 0x280016,
+    0xaa52a2, 0x25723, 0xd8000c, 0x34a2e, 0x2bbee, 0x25507, 0x2f0c3, 0x34ab2,
+    0x2bcd2, 0x148000b, 0x2558c, 0x2564d, 0x12576e, 0x90000c, 0x2f1cb, 0x90000e,
+    0x257d2, 0x12a57f3, 0x1258f4, 0x125795, 0x25816, 0x256e1, 0x1c00013, 0x2f114,
+    0x3502c, 0x25825, 0x31664, 0x178000c, 0x25a08, 0x25889, 0x400000, 0x25741,
+    0x2a5982, 0x2a5ae3, 0x400004, 0x2584f, 0x3162e, 0x25c47, 0x200012, 0x3508f,
+    0x31732, 0x200015, 0x25c6c, 0x25b8d, 0x7a5c2e, 0xd8000f, 0x25b70, 0x280011,
+    0x225d12, 0x7a5df3, 0x25bf4, 0x25e01, 0x6a5d76, 0x680017, 0x12b5112, 0x25ce5,
+    0x31405, 0x32f05, 0x25ea8, 0x25ec9, 0x312c9, 0x32e09, 0x25f4c, 0x148000c,
+    0x266e1, 0x25ccf, 0x3134f, 0x330cf, 0x26545, 0x25f13, 0x34fa5, 0x225d55,
+    0x2a6729, 0x1ba5ee1, 0x25fa2, 0x100019, 0x6a5f24, 0x25f85, 0x25fe6, 0x25fc7,
+    0x1c00001, 0x26452, 0x680013, 0x148000b, 0x26675, 0x22604d, 0x22610e, 0x68000f,
+    0x300000c, 0x345ad, 0x3454e, 0x26033, 0x126134, 0x260e2, 0x261c3, 0x800004,
+    0xd80005, 0x34cc5, 0x1a6227, 0x350d4, 0x26189, 0x34dc9, 0x34de1, 0x2626c,
+    0x2628d, 0x6a63ee, 0x34d45, 0x1a62b0, 0x322e3, 0x26492, 0x264d3, 0x264b4,
+    0x7a6335, 0x264f6, 0x263d7, 0x265a1, 0x35129, 0x680003, 0x3236d, 0x1263a5,
+    0x35009, 0x3516f, 0x1580003, 0x265c9, 0x32393, 0x680005, 0x10000c, 0x178000d,
+    0x980001, 0x2660f, 0x265f0, 0x680004, 0x26685, 0x26626, 0x266b4, 0x162f150,
+    0x266c9, 0x350a1, 0x162f193, 0x2f234, 0x12a686d, 0x278000e, 0x88000f, 0x34f41,
+    0x2f179, 0x200005, 0x26a81, 0x26574, 0x14a6948, 0x269a9, 0x226b65, 0x34e89,
+    0x269ec, 0x34f6f, 0x26c49, 0x26a0f, 0x980012, 0x12a6a6c, 0x26ad2, 0x26cae,
+    0x268f4, 0x26995, 0x30a4c, 0x26c12, 0x26da3, 0x26dc4, 0x26cf5, 0x26e26,
+    0x1480007, 0x30ad3, 0x7a6bb9, 0x30b15, 0x35252, 0x26e6c, 0x226e81, 0x26e4e,
+    0x30bba, 0x2a6ee4, 0x26f05, 0x26f46, 0x26e13, 0x26eb4, 0x2a7189, 0x1780017,
+    0x2f6cc, 0x26f8c, 0x680015, 0x2f76f, 0x2702f, 0x26fb0, 0x2f752, 0x2f6f3,
+    0x2f714, 0x280014, 0x272f5, 0x280016, 0x27121, 0x27242, 0x100019, 0x9a7521,
+    0x1272a5, 0x9a70a3, 0x4270e4, 0x27445, 0x27549, 0x26d67, 0x35229, 0x275c9,
+    0x26f2d, 0x271eb, 0x2734f, 0x273b0, 0x32cc1, 0x275ef, 0x276c4, 0x880000,
+    0x32d45, 0x17a7493, 0x275b4, 0x27635, 0x27016, 0x68000b, 0x15b1142, 0x100001,
+    0x880003, 0x31005, 0x27270, 0x277c5, 0x27792, 0x274d3, 0x427868, 0x276e9,
+    0x32cb5, 0x1600004, 0x1b0000d, 0x2f286, 0x310b0, 0x2772f, 0x2278c1, 0x1b00019,
+    0x200012, 0x351e5, 0x27905, 0x980015, 0x276a7, 0x98000e, 0x27a49, 0x1c00019,
+    0x2f073, 0x2f2b4, 0x278ad, 0x2794e, 0x27a0f, 0x27a70, 0x31863, 0x279f2,
+    0x27a93, 0x27ab4, 0x279b5, 0x27ac1, 0x35407, 0x2a7bc3, 0x200019, 0x180009,
+    0x14b184d, 0x319ae, 0x354b2, 0x27ae9, 0x27b81, 0x31972, 0x68000c, 0x319f4,
+    0x27ce5, 0x10000f, 0x27c70, 0x1a7de8, 0x27f09, 0x295e5, 0x27d14, 0x280e3,
+    0x1280004, 0x298e9, 0x27c4f, 0x28107, 0x20000c, 0x12a8009, 0x3518c, 0x296cf,
+    0x128000c, 0x148000f, 0x281ce, 0x353a5, 0x9a7eb0, 0x880015, 0x28212, 0x180015,
+    0x28254, 0x880005, 0x1480016, 0x180000, 0x27a8081, 0xd80019, 0x280003, 0xa8264,
+    0x12a7f25, 0xd80007, 0x98000e, 0x88000f, 0x178000c, 0x68000d, 0x148000b, 0x2838c,
+    0x3520e, 0x281ee, 0x2822f, 0x180000, 0x282c1, 0x283b2, 0x29a21, 0x2a8494,
+    0x28445, 0x35145, 0x29ee5, 0x2d1ec, 0x28669, 0x6ad26e, 0x29fc9, 0x28000c,
+    0x1b0000c, 0x2d232, 0x2858f, 0x2d354, 0x14a9ccf, 0x15ad2f6, 0x180013, 0x1780014,
+    0x1080015, 0x1280002, 0x880015, 0x17a8421, 0x780019, 0x285c3, 0x12a8744, 0x286c5,
+    0x353c1, 0x28547, 0x323ef, 0x32430, 0x1480005, 0x148000e, 0x2862c, 0x324b4,
+    0x2a88ae, 0x28a85ef, 0x324d7, 0x680003, 0x28844, 0x28885, 0x28814, 0x2980007,
+    0x400000, 0x287a9, 0x352ce, 0x328000f, 0x286ac, 0x2af05, 0x2894e, 0x3566c,
+    0x680010, 0x2b069, 0x29287d2, 0x7a8873, 0x12a8b34, 0x289b5, 0x28ca1, 0x14ab1cf,
+    0x880008, 0x33585, 0x100005, 0x14b3647, 0x68000c, 0x100008, 0x28c09, 0x180017,
+    0x2e850, 0x34401, 0x3368e, 0x1580002, 0x2e80014, 0x34385, 0x1480005, 0x1480006,
+    0x33514, 0x343c9, 0x28d15, 0x35569, 0x1280017, 0x28dec, 0x68000d, 0x28000e,
+    0x2d541, 0x2d522, 0x1b356d4, 0x28d32, 0x1080013, 0x2a8e54, 0x428e62, 0x28ec3,
+    0x22d3e9, 0x35712, 0x28f26, 0x32ae4, 0x32885, 0x100009, 0x2d38f, 0x280010,
+    0x28e2c, 0x28f8d, 0x2904e, 0x35765, 0x29150, 0x32b4e, 0x29172, 0x100013,
+    0x28f54, 0x28e95, 0x29256, 0x32b14, 0x2f5c1, 0x3100005, 0x2919a, 0x400000,
+    0x29341, 0x291a2, 0x29383, 0xa9404, 0x2f669, 0x295c6, 0x293c7, 0x35901,
+    0x29429, 0x355c9, 0x2f6af, 0x2952c, 0x98000c, 0x2944e, 0x98000f, 0x29570,
+    0x2f695, 0x2a29612, 0x29713, 0x297b4, 0x15294f5, 0x1529916, 0x29697, 0x17a9981,
+    0x12a99e2, 0x29a63, 0x293a4, 0x29965, 0x32761, 0x29aa7, 0x1580003, 0x1600004,
+    0x327e5, 0x35a08, 0x2992c, 0x29bed, 0x29c0e, 0x98000f, 0x29bd0, 0x1280011,
+    0x33be4, 0x129d33, 0x29df4, 0x33b47, 0x29db6, 0x29e82, 0x129d63, 0x15b2854,
+    0x680005, 0x2a0a6, 0x33c4e, 0x3000012, 0x3000005, 0x1b00014, 0x1529f4b, 0x2a00c,
+    0x2a14d, 0x2a28e, 0x2a16f, 0x2a250, 0x33a41, 0x2a1b2, 0x2a1d3, 0x2a314,
+    0x229d01, 0x2a436, 0x680003, 0x1c00018, 0x12a545, 0x1780001, 0x351a9, 0x22a5c8,
+    0x22a469, 0x2a6a5, 0x33bcf, 0x2a5e7, 0x1c0000f, 0x2a689, 0x2a4ef, 0x200010,
+    0x339f5, 0x2a74d, 0x2aa82e, 0x300002, 0x2aa03, 0x22d5a5, 0x900017, 0x2a953,
+    0x2a7d4, 0x2d709, 0x1080009, 0x280009, 0x88000c, 0x2ab6c, 0x351c5, 0x2ab4e,
+    0x17ad630, 0x200010, 0x35389, 0x680001, 0x2d754, 0x2ac54, 0x1480015, 0x2a856,
+    0x1080017, 0x2aae1, 0x280008, 0x90000e, 0x1b00002, 0x2aca5, 0x1780004, 0x35472,
+    0x152a8e8, 0x2ace9, 0x180000, 0x6aac61, 0x2ad6c, 0x2ad43, 0x262aec4, 0x2ad8f,
+    0x35969, 0x2aa9c7, 0x3000009, 0x1080009, 0x1280012, 0x200015, 0x2af4c, 0x2adcd,
+    0x2b04e, 0x680012, 0x2aa50, 0x31e04, 0x2b112, 0xbab093, 0x31ee7, 0x2ab35,
+    0x10aaff6, 0x2ad17, 0x1080018, 0x980002, 0x2b143, 0x2b2c4, 0x1580009, 0x1280003,
+    0x2b027, 0x31e92, 0x7acb81, 0x32094, 0x35bb2, 0x2b20c, 0x2cbe5, 0x32b38e,
+    0x7ab28f, 0x900005, 0x2ccc9, 0x2ab472, 0x780013, 0x2b3b4, 0x1080015, 0x780016,
+    0x2ccef, 0x2b5c3, 0x88000e, 0x108001a, 0x2b406, 0x680009, 0x2cb15, 0x354f3,
+    0x68000c, 0x880015, 0x2b68c, 0xd8000d, 0x2b72e, 0x2db21, 0x12ab5f0, 0x42b6a1,
+    0x2b712, 0x2dce5, 0x1b00008, 0x2b665, 0x1ab3f6, 0xeadc69, 0x2b748, 0x2b7e9,
+    0x2d8000c, 0x680008, 0x2b56c, 0x2de2f, 0x22b781, 0x2b7cf, 0x2b80003, 0x1480013,
+    0x2b8a5, 0x35c0f, 0x68000b, 0x1c00004, 0x22b9e9, 0x400000, 0x2ba01, 0x12ab5ac,
+    0x1780001, 0x128000e, 0x2b865, 0x2b830, 0x680002, 0x2ba28, 0x2abc49, 0x280014,
+    0x2b6d5, 0x2bb4c, 0x1b00017, 0x178000c, 0x2bd0f, 0x2bbc1, 0x2c80002, 0x6abc12,
+    0x359ce, 0x900012, 0x35e29, 0x2c00007, 0x1f00017, 0x2bb29, 0x100019, 0x35685,
+    0x128000c, 0x2abbad, 0x28000e, 0x180009, 0x337ec, 0xd80000, 0x280012, 0x42bde2,
+    0x2bd23, 0x2bc84, 0x336f2, 0x1900006, 0x33814, 0x33855, 0x2bca9, 0xd80019,
+    0x35cce, 0x2abf6c, 0x2bdcd, 0x2bfae, 0x35ed2, 0x2c010, 0x35c25, 0x2c152,
+    0x2bfd3, 0x2bf34, 0x2be35, 0x1480016, 0x400017, 0x2bff8, 0x180000, 0x2c0a1,
+    0x6b5b6f, 0x2c163, 0x32c124, 0x780005, 0x35d25, 0x14ac1e7, 0x1780007, 0x357ac,
+    0x680019, 0x178000e, 0x2c2ac, 0x2c32d, 0x2c3ee, 0x78000f, 0x6ac230, 0x35834,
+    0x2c312, 0x2c3b3, 0x2c434, 0xd80015, 0x400000, 0x2c2e1, 0xd80018, 0x180019,
+    0x35c85, 0x2ac4c5, 0x2f1e8, 0x980008, 0x1b0000c, 0x2c509, 0x35d45, 0x2f1ad,
+    0x18000c, 0x2f20f, 0x2f250, 0x2c52f, 0x35a45, 0x3400004, 0x2f274, 0x400013,
+    0x7ac541, 0x1300002, 0x2c5c3, 0x2c584, 0x2c385, 0x152c3c6, 0x42c4e7, 0x35a6e,
+    0x88000f, 0x980012, 0x1c00009, 0x2c4ac, 0x7ac5ed, 0x32c80e, 0x7ac7af, 0x35e67,
+    0x1080011, 0x3180008, 0x2c833, 0x2c774, 0x680015, 0x7ac636, 0x1780002, 0x2c843,
+    0x2c7c4, 0x7ac8fa, 0x400006, 0x2c887, 0x35ca1, 0x2ca89, 0x1780015, 0x680005,
+    0x1b00005, 0x2caed, 0x2ca2e, 0x680008, 0x32a05, 0x1600001, 0x2cb72, 0x1500013,
+    0x32a69, 0x2c935, 0x35eb3, 0x2cb37, 0x9acac1, 0x2cc82, 0x32a4f, 0x1500004,
+    0x180005, 0x1900006, 0x880012, 0x32b74, 0x2d00009, 0x180002, 0x1480003, 0x880001,
+    0xd8000d, 0x2ccae, 0x35fce, 0x2ce30, 0x1b0000f, 0x2ced2, 0xd80013, 0x2d0a9,
+    0x30621, 0x2ceee, 0x2d06c, 0x30684, 0x1780009, 0x2d052, 0x15b07a7, 0x200014,
+    0x880012, 0x1480016, 0x35d89, 0x880015, 0x1b00004, 0x2cf45, 0x1780007, 0x1280019,
+    0x1b00015, 0x2d1c9, 0x1580013, 0x30514, 0x35f49, 0x90000e, 0x22d361, 0x2cf6f,
+    0x2d303, 0x2d404, 0x6ad325, 0x2d133, 0x2d2c7, 0x1280015, 0x2ad4a9, 0x2d3a1,
+    0x1b00015, 0x2d4ec, 0x1f0000d, 0x12d505, 0xb8000f, 0x31d03, 0x31fe4, 0x22d5c9,
+    0x1ad493, 0x2d454, 0x8ad3d5, 0x1b00016, 0x680003, 0x680004, 0x31f8c, 0x320cd,
+    0x3212e, 0x212d4d3, 0x2d7b4, 0x1480015, 0x35f67, 0x32321d3, 0x1b00003, 0x1b00019,
+    0x1b0001a, 0x22d8a1, 0x2d842, 0x1480003, 0x980004, 0x2d8e5, 0x2d886, 0x35ff4,
+    0x1b00004, 0x2d969, 0x1b00015, 0x2f80007, 0x2ad82c, 0x200012, 0x2d78e, 0x2d76f,
+    0x2d9d0, 0x148000d, 0x2eb6e, 0x2d913, 0x2db14, 0x880015, 0x2db41, 0x1280013,
+    0x152d923, 0x35881, 0x2d9e5, 0x300000b, 0x880013, 0x880005, 0x2dc29, 0x35fae,
+    0x1080000, 0x2d98c, 0x2e00002, 0x2dca3, 0x3180014, 0x980010, 0x358ce, 0x14adc87,
+    0x2da13, 0x2dbd4, 0x12da95, 0x35993, 0x2de4c, 0x2db8d, 0x2dd6e, 0x180000,
+    0x2de10, 0x1780001, 0x2de72, 0x180004, 0xd80014, 0x1780005, 0x1580007, 0x1580009,
+    0x152e62c, 0x1780009, 0x2e74e, 0x2e00c, 0x3100003, 0x2de8e, 0x1480012, 0x2e6b3,
+    0x2e694, 0x2e132, 0xe2e093, 0x2e0b4, 0x2e0e1, 0x358ec, 0x1c0001a, 0x2e164,
+    0x1c00007, 0x880006, 0x2d8c7, 0x35852, 0x35733, 0x360a9, 0x148000b, 0x42df2c,
+    0x36062, 0x22e3ce, 0x2e1cf, 0x680010, 0x1080000, 0x2dbb2, 0x2df93, 0x2e254,
+    0x1780010, 0xd80016, 0x1b00001, 0x14b6041, 0x35dd4, 0x1480009, 0x1b00005, 0xd8000b,
+    0x2e4ac, 0x2dfed, 0x2e3a2, 0x400003, 0x980009, 0x178000c, 0x2e4d2, 0x2e507,
+    0x2e4f4, 0x2e069, 0x178000f, 0x35e12, 0x2e5cc, 0x148000d, 0x35b01, 0x880002,
+    0x880003, 0x1280007, 0x2e392, 0x2e3f3, 0x2e594, 0x2e441, 0x2e5b6, 0x135c4d,
+    0x2e544, 0x2e5e5, 0x1280010, 0x2e863, 0x355ae, 0x1280013, 0x30a81, 0x2e787,
+    0x2e52c, 0x3480014, 0x306a5, 0x1280000, 0x180014, 0x158000d, 0x200012, 0x2e613,
+    0x1280010, 0x2eba5, 0x880016, 0x1c00013, 0x309af, 0x1780009, 0x680003, 0x360d4,
+    0x1400005, 0x3000012, 0x309f5, 0x8aeb8f, 0x2ec49, 0x35e82, 0x1b5293, 0x1080014,
+    0x2ec34, 0x900015, 0x128000f, 0x361a6, 0x35f29, 0xd8001a, 0x1480013, 0x9aecb4,
+    0x2eab5, 0x2efe1, 0x2f2e3, 0x1c00003, 0x1b0000e, 0x2ee45, 0x1480007, 0x3000007,
+    0x680012, 0x2ef29, 0x680001, 0x35f04, 0x1480005, 0x2f4ae, 0x2ef6e, 0x2ef0f,
+    0x1580009, 0x2f312, 0x2f333, 0x2f414, 0x302f094, 0x2f381, 0x2f502, 0x1780009,
+    0x2f464, 0x3000009, 0x36154, 0x2f442, 0x2f588, 0x2f544, 0x3000008, 0x1780005,
+    0x2f5e7, 0x2f5ad, 0x2f7a4, 0x180012, 0x2f8c6, 0x2f62c, 0x302f612, 0x2f4f3,
+    0x2f64f, 0x36185, 0x2f536, 0x32c49, 0x2f8ee, 0x2f574, 0x32bac, 0x32d0d,
+    0x2f9d2, 0x2f933, 0x2f7f4, 0x2f983, 0x32c72, 0x32c93, 0x32dd4, 0x36169,
+    0x2f4da, 0x180001, 0x98000c, 0x2fac1, 0x2f94c, 0x2fa0d, 0x2fa8e, 0x2fb85,
+    0x2faf0, 0x36109, 0x2fb12, 0x2fc49, 0x14afb34, 0x2fa35, 0x2fa6c, 0x90000f,
+    0x2fba1, 0x2fbef, 0x2fd43, 0x2fdc4, 0x1580005, 0x1780003, 0x2fcc7, 0x2fe08,
+    0x1b00006, 0x36245, 0x2fe2b, 0x2fd6c, 0x2fd0d, 0x2fe6e, 0x352ac, 0x2fc70,
+    0x9b534e, 0x14afed2, 0x2ff13, 0x2ffb4, 0x2fdb5, 0x30141, 0x2fe57, 0x30163,
+    0x3622f, 0x30221, 0x30106, 0x302c3, 0x362c1, 0x3100001, 0x30186, 0x1480001,
+    0x3028c, 0x3024d, 0x3030a, 0x158000f, 0x30ce1, 0x31fc4, 0x302f2, 0x30333,
+    0x30d25, 0x36314, 0x30352, 0x302b3, 0x30e29, 0x3210c, 0x180019, 0x3228e,
+    0x363a1, 0x30f64, 0x30c8f, 0x32032, 0x322b3, 0x1480003, 0x30f29, 0x321a5,
+    0x30db5, 0x30f4c, 0x30f0d, 0x30fce, 0x323aa, 0x180000, 0x323cc, 0x31032,
+    0x30ec9, 0x31054, 0x36365, 0x30fac, 0x30fed, 0x2e80001, 0x32354, 0x310d0,
+    0x680009, 0x31092, 0x3180013, 0x3180014, 0x311c5, 0x35ee1, 0x365e9, 0x31138,
+    0x1480004, 0x35de5, 0x3116b, 0x3110c, 0x3126d, 0x312ae, 0x32c23, 0x300000e,
+    0x1480005, 0x30f92, 0x1280000, 0x31334, 0x311f5, 0x3100016, 0x314a3, 0x313a4,
+    0x3080005, 0x31546, 0x32b2f, 0x32bf0, 0x31981, 0x32cf2, 0x150000b, 0x1500014,
+    0x300000e, 0x36714, 0x31a07, 0x31430, 0x31a69, 0x36013, 0x15b1473, 0x314d4,
+    0x31495, 0x300000e, 0x36429, 0x3100010, 0x31aa6, 0x14b1b47, 0x33ee1, 0x31894,
+    0x319d5, 0x3200016, 0x34065, 0x31a2d, 0x1531b0e, 0x15b1acf, 0x31a50, 0x31931,
+    0x31a82, 0x3500002, 0x14b1af4, 0x680001, 0x33f6f, 0x31b87, 0x1b6732, 0x34132,
+    0x31c8a, 0x148000d, 0x33f95, 0xd80009, 0x31c0e, 0x31baf, 0x31da3, 0x31b31,
+    0x1b00002, 0x1c00012, 0x31d87, 0x31c35, 0x31cd6, 0x1780007, 0x31dcb, 0x31dec,
+    0x1b00007, 0x31e2e, 0x32544, 0x32405, 0x680012, 0x31ed2, 0x31c53, 0x31e74,
+    0x35432, 0x35453, 0x35314, 0x31bf8, 0x3262e, 0x3246f, 0x329a4, 0x36081,
+    0x32572, 0x329c7, 0x32494, 0x328c9, 0x32596, 0x1f00002, 0x32a8c, 0x33082,
+    0x1480003, 0x33184, 0x3634c, 0x33026, 0x32ab2, 0x18000f, 0x329f4, 0x3674e,
+    0x336a1, 0x3644e, 0x32eed, 0x330ee, 0x33705, 0x680008, 0x36129, 0x338c8,
+    0x33909, 0x332d4, 0x332e1, 0x33376, 0x33323, 0x33384, 0x30b3465, 0x333a6,
+    0x365c5, 0x33732, 0x334e9, 0x1080000, 0x335e2, 0x1480005, 0x331ed, 0x3354e,
+    0x337b9, 0x334d0, 0x35ae2, 0x1b00003, 0x30b33f3, 0x333d4, 0x33495, 0xd8000c,
+    0x335b7, 0x336cf, 0x337c3, 0x1480011, 0x35aac, 0x335d3, 0x3000005, 0x33675,
+    0x1b00010, 0x33797, 0x1c00001, 0x33a0c, 0x33acd, 0x150000e, 0x1480004, 0x338b0,
+    0x33e01, 0x33af2, 0x33933, 0x33994, 0x33e85, 0x339b6, 0x35485, 0x33de8,
+    0x33e69, 0x341e2, 0x354c9, 0x362ad, 0x300000e, 0x98000c, 0x33e2f, 0x880012,
+    0x353ef, 0x33e52, 0x341a2, 0x36275, 0x33f4d, 0x35d69, 0x342a6, 0x34110,
+    0x1480012, 0x34152, 0x33d93, 0x342eb, 0x3426c, 0x343a3, 0x1b00012, 0x367b4,
+    0x34350, 0x34da4, 0x34232, 0x1780017, 0x1c00009, 0x34455, 0x3442c, 0x3430d,
+    0x344ce, 0x34d6c, 0x10b65af, 0x34e6e, 0x34512, 0x342d3, 0x34334, 0x34c92,
+    0x34d13, 0x34e54, 0x34378, 0x3460c, 0x346ad, 0x346ce, 0x3458f, 0x14b4630,
+    0x34491, 0x34701, 0x1080000, 0x480001, 0x34575, 0x347c5, 0x1c00004, 0x1080005,
+    0x345d9, 0x34809, 0x361e9, 0x1080009, 0x36953, 0x180002, 0x16346e1, 0x345ef,
+    0x34883, 0x34904, 0x1634745, 0x347a6, 0x36213, 0x1080014, 0x348a9, 0x880001,
+    0x1c0000b, 0x35263, 0x366cf, 0x35065, 0x1c0000f, 0x34ac3, 0x349e4, 0x34925,
+    0x34ba4, 0x1780001, 0x1580015, 0x34a09, 0x34a88, 0x88000f, 0x34a4c, 0x180001,
+    0x34aec, 0x367e9, 0x880014, 0x900015, 0x68000c, 0x348d3, 0x34b12, 0x34b33,
+    0x34a76, 0x35507, 0x34c56, 0x34b41, 0x34c02, 0x1480002, 0x352ec, 0x34c65,
+    0x180003, 0x363f3, 0x1c00014, 0x34c29, 0x8b5592, 0x2d80003, 0x35534, 0x35545,
+    0x3300006, 0x3686e, 0x300000d, 0x280001, 0x34cb2, 0x35603, 0x3000008, 0x355ed,
+    0x356ae, 0x178000f, 0x880010, 0x356e1, 0x1580007, 0x35373, 0x1780014, 0x880015,
+    0x68000e, 0x359e1, 0x2b5630, 0x35789, 0x1c00005, 0x359a5, 0x680014, 0x35655,
+    0x1b00009, 0x18000f, 0x357c3, 0x35944, 0x280012, 0x68000d, 0x35a8e, 0x178000f,
+    0x1c00005, 0x680017, 0x900001, 0x178000c, 0x358ad, 0x3592e, 0x3100006, 0x1580010,
+    0x35f89, 0x3100008, 0x28001a, 0x6b5874, 0x900015, 0x3380016, 0x3000017, 0x1c35bc3,
+    0x68000f, 0x1780012, 0x180000, 0x35ac7, 0x36035, 0x180000, 0x900001, 0x3400002,
+    0x980003, 0x90001a, 0x35cee, 0x1780006, 0x1c00004, 0x1480005, 0x35d12, 0x35b33,
+    0x36790, 0x36329, 0x1b00016, 0x368f3, 0x35b8f, 0xd80003, 0x1b00006, 0x2680005,
+    0x36763, 0x35bf4, 0x28000f, 0x180009, 0x360f4, 0x363c1, 0x2a80014, 0x12b6401,
+    0x180004, 0x3000019, 0x3688d, 0x36525, 0x36ac9, 0x2366e7, 0xd80014, 0x2d0000e,
+    0x362ec, 0x3648d, 0x3654e, 0x24b658e, 0x108000f, 0x108000f, 0x36612, 0x180005,
+    0x1480001, 0xd80014, 0x1780008, 0x366a9, 0x1280005, 0x1080009, 0x1580007, 0x150001a,
+    0x36513, 0x368b4, 0x36641, 0x1780009, 0x1c00006, 0x1080004, 0x280001, 0x369a1,
+    0x36914, 0x1c00002, 0x880005, 0x1c00014, 0x128000e, 0x369e9, 0x680009, 0x36a29,
+    0x1780005, 0x3000013, 0x36814, 0x1b00019, 0x3100004, 0x368d4, 0x180012, 0x1480016,
+    0x36849, 0x36981, 0x36829, 0x310000b, 0x36b29, 0x1080000, 0x18000f, 0x36a81,
+    0x3696f, 0x36a09, 0x1b0000f, 0x1780001, 0x36aa1, 0x68000c, 0x36b89, 0x369cf,
+    0x1c00007, 0x180019, 0x980005, 0x3000009, 0x36a4f, 0x178000f, 0x100000, 0x1280008,
+    0x1b00005, 0x980003, 0x36b14, 0x1780015, 0x108000d, 0x36b4e, 0x1080009, 0x280015,
+    0x36be1, 0x36cb4, 0x1c00013, 0x100009, 0x1280005, 0x350000f, 0x680001, 0x36ae9,
+    0x780001, 0x3580014, 0x36bd4, 0x680015, 0x36d65, 0xd80000, 0x3000009, 0x36c21,
+    0x10b6a69, 0xd80004, 0x1480010, 0xd80014, 0x36c0f, 0x1580004, 0x36c41, 0x3000009,
+    0x580014, 0x36c87, 0x1480002, 0x180009, 0x36d50, 0x200001, 0x880005, 0x1480010,
+    0x36df3, 0x36cc5, 0x1b0000c, 0x108000e, 0x300000c, 0x36e82, 0x180017, 0x680005,
+    0x880014, 0x680005, 0x36ea9, 0x6b6d25, 0x36d85, 0x36da5, 0x900004, 0x1580001,
+    0x36ef4, 0x1480003, 0x1280014, 0x36dc5, 0x1c00010, 0x3100001, 0x36cef, 0x36f49,
+    0x3710c, 0x1c0000b, 0x128000e, 0x1b00010, 0x36f13, 0x36ec5, 0x880013, 0x3180014,
+    0x36f88, 0x36fa9, 0x1536f74, 0x37001, 0x36f25, 0x1280004, 0x1280002, 0x12b728c,
+    0x1c00009, 0x1280009, 0x37066, 0x370e5, 0x37141, 0x3600015, 0x1c0000f, 0x370ce,
+    0x680005, 0x178000d, 0x1580009, 0x10000c, 0x3704d, 0x371ae, 0x12b716c, 0x36fd5,
+    0x14b7134, 0x137252, 0x2d80012, 0x1480013, 0x880001, 0x1780002, 0x372a3, 0x128000c,
+    0x1580009, 0x308000e, 0x680001, 0x3000014, 0x37312, 0x680019, 0x37352, 0x3000012,
+    0x178000d, 0x12b71c3, 0x18000c, 0x37373, 0x1b00002, 0x680003, 0x1280000, 0x980014,
+    0x680019, 0x98000c, 0x300000c, 0x1b0000c, 0x3732e, 0x1c0001a, 0x3000012, 0x900012,
+    0x3738e, 0x880002, 0xd80014, 0x880006, 0x200007, 0x1480004, 0x3680014, 0x1580005,
+    0x12b73a4, 0x1280013, 0x1780008, 0x680001, 0x148000e, 0x280008, 0x1280000, 0x37429,
+    0x370b3, 0x1280003, 0x880001, 0x372c2, 0x1080003, 0x1280004, 0x680001, 0x900004,
+    0x37507, 0x10000c, 0x1b00007, 0x900019, 0x3740e, 0x1b75c1, 0x37728, 0x90000e,
+    0x1780009, 0x1280014, 0x373d4, 0x2d80012, 0x200013, 0x1280017, 0x37498, 0x374a2,
+    0x37563, 0x900003, 0x373e5, 0x300000f, 0x374c7, 0x1b00007, 0x3768d, 0x3752e,
+    0x1480007, 0x1280003, 0x90000d, 0x374ee, 0x88000f, 0x1280007, 0x375b0, 0x3760e,
+    0x137553, 0x37789, 0x680017, 0x3700016, 0x93764e, 0x37663, 0x12b76ec, 0x1480005,
+    0x158000e, 0x37467, 0x1780001, 0x377e1, 0x377c1, 0x900001, 0x880000, 0x1b00006,
+    0x37b762e, 0x900005, 0x37768, 0x68000f, 0x900014, 0x12b75f3, 0x1480007, 0x3000005,
+    0x37743, 0x178000d, 0x900005, 0x680008, 0x178001a, 0x1780005, 0x376b2, 0x37713,
+    0x376d4, 0x90000c, 0x1280013, 0x880017, 0x88000f, 0x1780016, 0x880009, 0x3784f,
+    0x377b3, 0x1780014, 0x900015, 0x3788e, 0x90000c, 0x1280009, 0x3780e, 0x108001a,
+    0x379c5, 0x37929, 0x12b7a54, 0x37969, 0x37834, 0x1480002, 0x17b7a68, 0x37b25,
+    0x68000c, 0x37b09, 0x8b78ef, 0x37b85, 0x37aa1, 0x400000, 0x379a1, 0x178000f,
+    0x37983, 0x37a2e, 0x18000c, 0x1480014, 0x1480002, 0x1780012, 0x379e9, 0x378d4,
+    0x37c27, 0x37b4c, 0x37a0d, 0x37bee, 0x37d89, 0x1780017, 0x1480011, 0x137ba3,
+    0x37a93, 0x3000014, 0x3800001, 0x880001, 0x37ac3, 0x3804f, 0x37ae5, 0x37ce5,
+    0x1b00002, 0x900003, 0x37dce, 0x137c41, 0x680009, 0x37fc9, 0x37c12, 0x37bce,
+    0x20000f, 0x137ccc, 0x137ed2, 0x137f6e, 0x1780001, 0x180014, 0x680015, 0x14b7b76,
+    0x1480012, 0x100003, 0x137e44, 0x980015, 0x880012, 0x37d47, 0x37e61, 0x1b00015,
+    0x3818e, 0x37d65, 0x1b0000d, 0x2b8000d, 0x2b0000e, 0x37da9, 0x37f89, 0x3802e,
+    0x88000f, 0x37cb3, 0x178000f, 0x1480015, 0x1137e8f, 0x900003, 0x37f32, 0x437eb2,
+    0x980003, 0x380c4, 0x880001, 0x1280007, 0x3880010, 0x3000005, 0x880005, 0x137ff3,
+    0x900001, 0x38089, 0x38169, 0x3037f0e, 0x1780004, 0x1080000, 0x900005, 0x900012,
+    0x3810f, 0x38074, 0x1b00012, 0x3812c, 0x148000c, 0x381ae, 0x128000e, 0x178000c,
+    0x310000c, 0x9b8212, 0x3824e, 0x680005, 0x300000e, 0x1580012, 0x1480016, 0x382ac,
+    0x880014, 0xf00001, 0x180001, 0x381f4, 0x1780001, 0x381cc, 0x1780009, 0x3000013,
+    0x382d4, 0x38149, 0x68000f, 0x382e8, 0x1538344, 0x1280013, 0x1080012, 0x1280005,
+    0x1280019, 0x38385, 0x18000f, 0x38328, 0x300000e, 0x1080014, 0xd00000, 0x38301,
+    0x3840e, 0x384b4, 0x383b3, 0x38265, 0x384c4, 0x2b80013, 0x1c00009, 0x14b8449,
+    0x1080001, 0x3842c, 0x38492, 0x3880004, 0x280005, 0x1480014, 0x3900007, 0x900001,
+    0x300000c, 0x180013, 0x310000c, 0x1780015, 0x1480014, 0x148000e, 0x180019, 0x38361,
+    0x1b0000c, 0x38509, 0x1b00005, 0x383c5, 0x1780009, 0x3000009, 0x180001, 0x1480009,
+    0x1080000, 0x38653, 0x384e9, 0x383e5, 0x3000013, 0x398000e, 0x1280019, 0x1480013,
+    0x18000f, 0xd80009, 0x38614, 0x3180008, 0x38469, 0x90000f, 0x38529, 0x178000f,
+    0x1080009, 0x38541, 0x300001a, 0x178000d, 0x3100008, 0x148000c, 0x880012, 0x3100015,
+    0x178000e, 0x37449, 0x68000f, 0x18000f, 0x386e9, 0x38575, 0x180019, 0x18000f,
+    0x1c00012, 0x385e5, 0x128000f, 0x310000e, 0x1b80000, 0x680019, 0x88000c, 0x38784,
+    0x38773, 0x180019, 0x1480002, 0x387a7, 0x1280000, 0x1580012, 0x128000e, 0x880007,
+    0x900005, 0x38594, 0x1780013, 0x10000e, 0x128000f, 0x3a80001, 0x1080013, 0x3a00013,
+    0x386a4, 0x385a9, 0x1080000, 0x388e4, 0x148000e, 0x1780009, 0x180014, 0x3862f,
+    0x1280009, 0x38713, 0x3000006, 0x388d2, 0x1b00001, 0x308000e, 0x3b00014, 0x38830,
+    0x3000008, 0x2a8000c, 0x900015, 0x148000d, 0x17b87e1, 0x38883, 0x389c4, 0x300000e,
+    0x180019, 0x14b8947, 0x1480014, 0x386c9, 0x158000c, 0x148000b, 0x388a1, 0x1c00013,
+    0x1580001, 0x15389a4, 0x780004, 0x38a41, 0x1c00014, 0x3b8000f, 0x38994, 0x1480010,
+    0x3038861, 0x389ec, 0x1c00012, 0x3500010, 0x2100009, 0x38a10, 0x38b65, 0x38a6c,
+    0xd80012, 0x38a34, 0x90000f, 0x12b8961, 0x38b22, 0x68000f, 0x1b0000e, 0x38ba5,
+    0x3100008, 0x38aa5, 0x1280001, 0x38b8e, 0x38ac5, 0x38bc8, 0x38bf2, 0x148000c,
+    0x88000e, 0x38a8f, 0x178000f, 0x1480010, 0x300000e, 0x1480012, 0x38ae9, 0x3000005,
+    0x1480001, 0x38b01, 0x1480013, 0x880019, 0x3000014, 0x2f00005, 0x680001, 0xd80004,
+    0x900013, 0x14b8c25, 0x3180005, 0x38b41, 0x7b8d13, 0x38c85, 0x3100005, 0x1280012,
+    0x38d2e, 0x300000e, 0x38cb0, 0x38c09, 0x1600010, 0x98000e, 0x38ce9, 0x38e2b,
+    0x1b00019, 0x1780005, 0x1b00013, 0x38d45, 0x1780008, 0x38c72, 0x38cd4, 0x1b00015,
+    0x1480014, 0x180003, 0x3c00014, 0x3000013, 0x1b00005, 0x38c49, 0x1b00001, 0x1580009,
+    0x90000e, 0x38f32, 0x1780009, 0x2b80009, 0x18000f, 0x3000015, 0x38e12, 0x2b80003,
+    0x1080001, 0x1280015, 0x1900014, 0x178000e, 0x900004, 0x18000d, 0x680005, 0x38f01,
+    0x1080010, 0x38f74, 0x1b8f92, 0x3100013, 0x1280019, 0x1280009, 0x38fce, 0x38ee1,
+    0x139010, 0x1280019, 0x3906e, 0x900005, 0x3904c, 0x68000d, 0x30b9035, 0x1b0000f,
+    0x1280019, 0x1480013, 0x880012, 0x880005, 0x128000d, 0x17b8e4f, 0x1480005, 0x1b0000f,
+    0x3c80001, 0x3180004, 0x980014, 0x1b00015, 0x3980001, 0x200000, 0x1780017, 0x880003,
+    0x1480005, 0x38fb2, 0x391b2, 0x39143, 0x39085, 0x880005, 0x1c00002, 0x390d4,
+    0x880002, 0x90000e, 0x1780012, 0x39121, 0x1b00014, 0x900005, 0x1c00009, 0x38ff4,
+    0x200014, 0x680012, 0x178000c, 0x2100002, 0x178000e, 0x39164, 0x880007, 0x980012,
+    0x1780001, 0x280002, 0x1780014, 0x680019, 0x1780011, 0x12b91c7, 0x2b8000d, 0x1b00012,
+    0x88000e, 0x980012, 0x1b00008, 0x39212, 0x39264, 0x3000016, 0x178000f, 0x3910e,
+    0x390f2, 0x392cc, 0x390b3, 0x400014, 0x3922c, 0x180014, 0x3918e, 0x680009,
+    0x391e5, 0x28001a, 0x880005, 0x3928c, 0x180014, 0x2080003, 0x3600015, 0x180016,
+    0x1780005, 0x180001, 0x400000, 0x900000, 0x1280001, 0x1b92a5, 0x3000005, 0x392f2,
+    0x39253, 0x180009, 0xf80008, 0x900013, 0x3932c, 0x1480013, 0x1280014, 0x18000f,
+    0x39315, 0x1580009, 0x178000f, 0x280012, 0x39341, 0x180015, 0x980013, 0x393f4,
+    0x39365, 0x1b00008, 0x900009, 0x1280012, 0x1580009, 0x393b2, 0x680003, 0x3d00005,
+    0x68000f, 0x178000c, 0x880001, 0x1c00005, 0x1480002, 0x1280003, 0x39405, 0x39484,
+    0x1b00009, 0x1280006, 0x39469, 0x394c4, 0x1480007, 0x393c9, 0x1780012, 0x3d8000c,
+    0x1780008, 0x1b00007, 0x1b0000c, 0x395ee, 0x39441, 0x39501, 0x1280013, 0x1780002,
+    0x180000, 0x1480004, 0x680013, 0x39394, 0x1780012, 0x3100013, 0x180013, 0x3968d,
+    0x280009, 0x3e0001a, 0x394af, 0x395c1, 0x1b00013, 0x39701, 0x39781, 0x395a5,
+    0x900013, 0x39534, 0x980005, 0x180000, 0x180012, 0x396a2, 0x980009, 0x1480011,
+    0x680019, 0x3954c, 0x1280007, 0x397d2, 0x680013, 0x3f0000d, 0x18000e, 0x39672,
+    0x3e8000d, 0x88000e, 0x180001, 0x3972e, 0x16b9803, 0x1b00019, 0x39641, 0x880014,
+    0x1780007, 0x900004, 0x398f2, 0x398b4, 0x3600014, 0x3962c, 0x10000d, 0x3994c,
+    0x40000f, 0x178000c, 0x1b0000f, 0x396cc, 0x1b96f3, 0x3990e, 0x1080007, 0x980014,
+    0x2a80004, 0x39932, 0x1b00009, 0x1c00013, 0x3000013, 0x680019, 0x399f4, 0x128000c,
+    0x1280000, 0x900008, 0x310000f, 0x900013, 0x39964, 0x397e5, 0x180019, 0x1480007,
+    0x1c0000e, 0x3000008, 0x1280005, 0x399c9, 0x3000009, 0x148000e, 0x1480005, 0xdb9984,
+    0x39825, 0x128000f, 0x2b00001, 0x158000f, 0x1480007, 0x398c1, 0x1580009, 0x39a01,
+    0x300000e, 0x399a5, 0x39ad2, 0x1280009, 0x680009, 0x397a9, 0x1780019, 0x39a54,
+    0x3100014, 0x1b00013, 0x1080000, 0x180000, 0x1780008, 0x180005, 0xd80003, 0x39b61,
+    0x39b45, 0x1080007, 0x39a23, 0x1480005, 0x880001, 0xd80007, 0x680012, 0x1b80009,
+    0x39a65, 0x3180012, 0x1b00009, 0x680007, 0x1280013, 0x128000f, 0x1b00007, 0x780014,
+    0x1080011, 0x28000d, 0xdb9c33, 0x39ae9, 0x39b85, 0x1280006, 0x39b32, 0x680013,
+    0x39a94, 0x39aaf, 0x39ba1, 0x68000c, 0x880001, 0x180013, 0x39d14, 0x1280015,
+    0x39b05, 0xd80008, 0x39c02, 0x880019, 0xd80009, 0x1480010, 0x39c45, 0x1280017,
+    0x100000, 0x1580009, 0x1280001, 0x39d52, 0x3fb9dce, 0x39d6e, 0x2939d85, 0x68000f,
+    0x2080010, 0x39da9, 0x1580009, 0x88000c, 0x39c8b, 0x1280004, 0x900001, 0x900014,
+    0x880003, 0x39d21, 0x3100004, 0x1480014, 0x880007, 0x680009, 0x39bd1, 0x300000e,
+    0x39e69, 0x88000c, 0x39c75, 0x2a8000e, 0x900017, 0x39cc5, 0x90000f, 0x39f45,
+    0x1080007, 0x2a80014, 0x14b9be9, 0x1580009, 0xd80015, 0x3039ce1, 0x1080000, 0x88000d,
+    0x680001, 0x39f2e, 0x1c00002, 0x39e25, 0x880001, 0x39ee9, 0x1280005, 0x400014,
+    0x39f0e, 0x1b00007, 0x3a032, 0x39def, 0x900009, 0x39e0f, 0x880014, 0x1580009,
+    0x39f8e, 0x39e85, 0x1480014, 0x300000e, 0x680001, 0x178000e, 0x1780012, 0x39fb2,
+    0x3000008, 0x1780009, 0x1b00004, 0x1580012, 0x1080009, 0x3000013, 0x3a094, 0x3000013,
+    0x90000e, 0x3a06e, 0x1b00005, 0x178000f, 0x900005, 0x280001, 0x4000014, 0x3100004,
+    0x1b0000e, 0x3a009, 0x180004, 0x3a0a9, 0x39fe8, 0x4080014, 0x108000e, 0x3a0c9,
+    0x68000c, 0x3a0e9, 0x3a04c, 0x3a163, 0x39fcc, 0x1480005, 0x180000, 0x90000c,
+    0x1080005, 0x3a14e, 0x39ed4, 0x3180008, 0x3a109, 0x3a18f, 0x1580016, 0x3a229,
+    0x418000f, 0x1480016, 0x1480014, 0x14ba201, 0x1600014, 0x3a393, 0x3a284, 0x180005,
+    0x3a2b4, 0x6ba301, 0x3a1d2, 0x1480009, 0x1480001, 0x980005, 0x3a489, 0x4100019,
+    0x3a348, 0x128000c, 0x1480007, 0x3000014, 0x180008, 0x3039eb3, 0xdba2f4, 0x128000e,
+    0x1480001, 0x3a2c5, 0x12ba3b2, 0xd80004, 0x3a365, 0x68000f, 0x3a3c7, 0x1ba572,
+    0x1c0000c, 0x3a3e5, 0x30ba513, 0x1780005, 0x3a661, 0x3a425, 0x3a405, 0x3a527,
+    0x3a454, 0x3a5c9, 0x3180008, 0x1480014, 0x1280015, 0x900006, 0x880014, 0x3a4af,
+    0x3a4e1, 0x1780010, 0x1280015, 0x1480001, 0x3a581, 0x3a625, 0x3a6d2, 0x3a545,
+    0x680012, 0x3a619, 0xd80013, 0x3a5f2, 0x3a653, 0x6ba769, 0x3a5b5, 0x3100016,
+    0x2d8000e, 0x180000, 0x680001, 0x3a6a9, 0x900012, 0x1b00013, 0x3a783, 0x10ba734,
+    0x180014, 0x1580003, 0x1480003, 0x180005, 0x3a6e9, 0x1480005, 0x300000b, 0x1580009,
+    0x3a701, 0x3100012, 0x148000c, 0x90000d, 0x880012, 0x900014, 0x900003, 0x3a8b3,
+    0xd80014, 0x880001, 0x98000e, 0x3a7b4, 0x3a993, 0x3a7c5, 0x3a74f, 0x3a7f5,
+    0x680014, 0x3a849, 0x1280009, 0x3a813, 0x1480002, 0x1480012, 0x280005, 0x90000e,
+    0xc80006, 0x1580015, 0x108000b, 0x3a861, 0x680001, 0x1b00009, 0x180005, 0x1080005,
+    0x3a9e9, 0x3a9a1, 0x68000f, 0x68000f, 0x3a829, 0x100005, 0x200014, 0x400000,
+    0x900005, 0x4200009, 0x1280002, 0x88000c, 0x88001a, 0x3a96e, 0x1b00001, 0x128000d,
+    0x880002, 0x3aa32, 0x1480012, 0x1280001, 0x3000016, 0x3180002, 0x1780001, 0x180010,
+    0x1b00008, 0x1080000, 0x1b00009, 0x400014, 0x98000e, 0x178000e, 0x180017, 0x680010,
+    0x2baa09, 0x68000c, 0x900014, 0x3a889, 0x3aac1, 0x3ab05, 0x680012, 0x1480007,
+    0x900012, 0x1280008, 0x3a949, 0x14babcc, 0x178000e, 0x3ab74, 0x3000005, 0x3aa52,
+    0x3a9cf, 0x880014, 0x90000c, 0x1780012, 0x4280009, 0x3ac49, 0x3000014, 0x3aa93,
+    0x3abe1, 0x1480016, 0x3abaf, 0x68000f, 0x3ab8f, 0x3aca1, 0x1b00001, 0xd8000e,
+    0x1c3aa69, 0x180003, 0x318000c, 0x1480005, 0x3ac05, 0x1780019, 0x3acc5, 0x1b00002,
+    0x3600013, 0x3ac8f, 0x3200004, 0x1280003, 0x680005, 0x3000007, 0x3ad21, 0x3adc6,
+    0x900009, 0x1480002, 0x1c00014, 0x900002, 0x3ac72, 0x1780012, 0x3ace5, 0x1500006,
+    0x3adad, 0x3ac34, 0x1b0000e, 0x3ad05, 0x88000e, 0x3180004, 0x1c00009, 0x3ad4e,
+    0x980005, 0x1480010, 0x4300014, 0x1480005, 0x900009, 0x3300002, 0x148000c, 0x3ab45,
+    0x3ae01, 0x178000c, 0x13ae2e, 0x3180006, 0x1280004, 0x1780003, 0x3ad8f, 0x3ae41,
+    0x3af2c, 0x128000c, 0x3adf4, 0x3180005, 0x3afa5, 0x900012, 0x3af72, 0x3ad69,
+    0x3180012, 0x158000f, 0x3ae63, 0x900007, 0x680001, 0x3afd4, 0x3f00012, 0x880005,
+    0x3af94, 0x3afee, 0x90000f, 0x40000e, 0xc80019, 0x1280012, 0x3ae89, 0x128000f,
+    0x1c00009, 0x3100002, 0x3aea5, 0x3aee5, 0x88000e, 0x4380013, 0x1780014, 0x3000006,
+    0x3aec5, 0x880007, 0x3b045, 0x1b00005, 0x1600005, 0x90000d, 0x3b325, 0x3b02f,
+    0x680015, 0x3100001, 0x128000e, 0x680009, 0x3b114, 0x3b289, 0x3b0f4, 0x3b013,
+    0x3b227, 0x1b0000c, 0x1780012, 0x3b1b3, 0x880014, 0x880001, 0x3b3c9, 0x3b183,
+    0x3b2a4, 0x1b00008, 0x2a80006, 0x1480012, 0x3b3a5, 0x1c0000c, 0x1b0000f, 0x280005,
+    0x90000c, 0x1780002, 0x3b1ee, 0x90000f, 0x1580009, 0x3b314, 0x68000c, 0x3b2f3,
+    0x3b274, 0x3b407, 0x900016, 0x3b38e, 0x3b2cd, 0x178000e, 0x1780009, 0x3b172,
+    0x128000e, 0x12bb1d4, 0x900013, 0x880001, 0x680003, 0x3b443, 0x900004, 0x3b352,
+    0x88000e, 0x980003, 0x3b485, 0x3b3e4, 0x3b470, 0x3b253, 0x213b4a9, 0x88000e,
+    0x9bb36e, 0x3000015, 0x3100014, 0x1c00005, 0x3b42d, 0x88000f, 0x1b0000d, 0x1c00009,
+    0x880004, 0x980013, 0x1c00004, 0x900015, 0x3b4c1, 0x3b50e, 0x900000, 0x90000e,
+    0x3b4e5, 0x1c3b5e1, 0x680015, 0x880014, 0x3b553, 0x3600007, 0x280009, 0x1500005,
+    0x9bb592, 0x1780009, 0x3b5cc, 0x580001, 0x3b52e, 0x3b603, 0x900006, 0xd80008,
+    0x1b00005, 0x6bb645, 0x90000d, 0x3b5b3, 0x2b00005, 0x3b668, 0x90000c, 0x3000017,
+    0x98000e, 0x20000f, 0x178000c, 0x680005, 0x680001, 0x3b635, 0x3b574, 0x880015,
+    0x3000014, 0x2bb6c1, 0x128000e, 0x3b694, 0x1480015, 0x3b6af, 0x680019, 0x1b00014,
+    0x900012, 0x3b749, 0x68000f, 0x3b72c, 0x3b705, 0x1c00013, 0x178000c, 0x2e8000c,
+    0x3c00009, 0x3b7f2, 0x1280013, 0x3b9e3, 0x3b7c8, 0x1480004, 0x880006, 0x3b7a3,
+    0x1500004, 0x68000e, 0x3b825, 0x880013, 0x3b814, 0x3b872, 0x178000c, 0x1c00009,
+    0x680001, 0x3b8e1, 0x680015, 0x880013, 0x680005, 0x3b893, 0x300000e, 0x1480001,
+    0x3bb61, 0x3bb01, 0x1280003, 0x3b785, 0x3ba04, 0xdbba25, 0x3bab2, 0x2bb9c5,
+    0xd80005, 0x173b929, 0x3bb28, 0x1480014, 0xdbbc69, 0x680001, 0x3bd01, 0x1b0000e,
+    0x3000009, 0x14bbf8d, 0x3b8b4, 0x3af54, 0x3bb52, 0x3bc09, 0x12bba89, 0x1780019,
+    0x3bcb2, 0x3bbe5, 0x3bd6d, 0x128000e, 0x158000f, 0x3bae9, 0xd80002, 0x300000e,
+    0x3bc8e, 0x3bc54, 0x1b00015, 0x1600016, 0x680012, 0x3be93, 0x980003, 0x3be29,
+    0x1080005, 0xd80003, 0x3be4e, 0x900001, 0x3bef2, 0x300000e, 0x1480012, 0x1780005,
+    0x178000f, 0x3bdce, 0x1080000, 0x1080009, 0x178000e, 0x1280000, 0x3bcd3, 0x680019,
+    0x8bbf08, 0x3000004, 0xd8000e, 0x30bbd8e, 0x1580001, 0xd8001a, 0x3bdb9, 0x3bd33,
+    0x3bd45, 0x1b0000d, 0x180007, 0x680009, 0x128000f, 0x280015, 0x1600013, 0x680019,
+    0x4400014, 0x148000e, 0x680001, 0x108000e, 0x1280004, 0x1280002, 0x3bfd2, 0x3bff9,
+    0x3bf43, 0x3bf33, 0x3bf65, 0x3c086, 0x90000c, 0x3c183, 0x88000e, 0x4280002,
+    0x3c0e6, 0x3c0ac, 0x880012, 0x1980005, 0x880014, 0x158000d, 0x158000c, 0x1580012,
+    0x3c053, 0x3c0d4, 0x1580003, 0x1580016, 0x3bece, 0x3c133, 0x1600014, 0x10bc005,
+    0x400000, 0x14bbfb3, 0x1480012, 0x1480012, 0x1780009, 0x1c00016, 0x3c1e8, 0x3c106,
+    0x68000f, 0x3c065, 0x90000c, 0x3c269, 0x1780012, 0x100009, 0x3c154, 0x3c165,
+    0x1480014, 0x3c227, 0xd80012, 0x1280009, 0xd80014, 0x1480014, 0x1c00003, 0x3c1a5,
+    0x303c245, 0x1b0000f, 0x3c1c8, 0x3c281, 0x3c209, 0x3c2c9, 0x1280002, 0x3c2a5,
+    0x2080002, 0x1480006, 0x880001, 0x1280007, 0x300000e, 0x318000d, 0x3c2e5, 0x3c472,
+    0x1480001, 0x13c32e, 0x3c705, 0x128000c, 0x3c305, 0x980005, 0x98000c, 0x3c3e9,
+    0x178000e, 0x3c3a9, 0x680014, 0x3c42f, 0x3c352, 0x303c38e, 0x3c412, 0x3c4a1,
+    0x1080016, 0x680017, 0x980009, 0x2bc445, 0x3c4e9, 0x1b00014, 0x3c554, 0x1780009,
+    0x1280000, 0x1280009, 0x3c48f, 0x3c674, 0x680008, 0x18000c, 0x1b00015, 0x300000f,
+    0x980015, 0x1780012, 0x3c505, 0x880014, 0x148000e, 0x1b00015, 0x3c4c9, 0x680019,
+    0x3c5b0, 0x3c621, 0x880003, 0x3c5f3, 0x153c654, 0x3c6a5, 0x1480002, 0x3c612,
+    0x1580001, 0x3c6c9, 0x3c729, 0x680007, 0x3c561, 0x14bc68e, 0x3c741, 0x3c6ef,
+    0x1280005, 0x3c78e, 0x900013, 0x900014, 0x1bc829, 0x980012, 0x1080009, 0x1b00014,
+    0x3c761, 0x13c981, 0x128000f, 0x1280012, 0x1480004, 0x1480005, 0x10bc908, 0x1480007,
+    0x1c00009, 0x1280000, 0x2bc8ac, 0x880014, 0x1480003, 0x1c00003, 0xd8000f, 0x3c8d0,
+    0x3c9a1, 0x880008, 0x3c925, 0x680005, 0x3c9c5, 0x100004, 0x1580009, 0x3c949,
+    0x3ca29, 0x1480010, 0x1280007, 0x1280015, 0x3cc74, 0x1780012, 0x88000e, 0x3c8e5,
+    0x158000c, 0x900003, 0x3c872, 0x88000c, 0x2bc7f5, 0x3cb45, 0x12bc3d3, 0x3ca0e,
+    0x128000f, 0x1280012, 0x980005, 0x900014, 0x680008, 0x880014, 0x3c9e9, 0x3c965,
+    0x880019, 0x3800013, 0x880014, 0x1480009, 0x880016, 0x3ca41, 0x1580009, 0x3caa5,
+    0x78000d, 0x1480005, 0x1480010, 0x3cbe9, 0x1b0000f, 0x3ca69, 0x3cbd0, 0x1080014,
+    0x3cc08, 0x1480013, 0x680001, 0x1280001, 0x3cc4e, 0x2080002, 0x3cb05, 0x1480003,
+    0x3cb74, 0x300000e, 0x1480006, 0x148000f, 0x3000013, 0x8bcb23, 0x3000013, 0x900001,
+    0x3ca8e, 0x680019, 0x1480016, 0x128000f, 0x3ccf2, 0x318000e, 0x880014, 0x3cad3,
+    0x880002, 0x880009, 0x3ccc3, 0x68000c, 0x3cdb2, 0x1780013, 0x1280007, 0x3ccaf,
+    0x4480016, 0x210000c, 0x178000e, 0x178000e, 0x3cd6e, 0x1c0000f, 0x1b00002, 0x3cd29,
+    0x1480004, 0x3cc25, 0x3cd50, 0x880007, 0x310000b, 0x900003, 0x880003, 0x3ce87,
+    0x3cd0c, 0x3ce6f, 0x3cdec, 0x4500001, 0x88000e, 0x3cc94, 0x128000f, 0x3cb93,
+    0x3ce52, 0x3cd93, 0x1280016, 0x108000b, 0x3ce01, 0xd80003, 0x3cec4, 0x880019,
+    0x1580012, 0x1480016, 0x3ce32, 0x1b00001, 0x880014, 0x3ceee, 0x3c8000d, 0x1480010,
+    0x148000d, 0x1280004, 0x1b0000f, 0x3cea9, 0x1b80005, 0x3100016, 0x180009, 0x1480014,
+    0x3100005, 0x1480009, 0x3000006, 0x180005, 0x1280009, 0x3cf0e, 0x3000013, 0x1580015,
+    0x1280013, 0x2c0000f, 0x1c00017, 0x2b00005, 0x3cdd0, 0x3cf8f, 0xd80014, 0x980005,
+    0x1080006, 0x3cf55, 0x90000c, 0x3cf21, 0x3d085, 0x180003, 0x1480004, 0x3cf65,
+    0x480000, 0x1c00007, 0x980012, 0x3d009, 0x1b00008, 0x900003, 0x1080016, 0x3d12e,
+    0x1080016, 0x98000e, 0x178000f, 0xd80010, 0x128000c, 0x1480005, 0x3d0b4, 0x148000f,
+    0x1c00014, 0x3100016, 0x3cfec, 0x3d0c5, 0x318000e, 0x100001, 0x3d036, 0x10bcfa9,
+    0x303d052, 0x3cfc5, 0x10bd1ce, 0x880007, 0x1c00001, 0x880014, 0x3d169, 0x3d2ce,
+    0x1b00009, 0x180019, 0x3d321, 0x880014, 0x3d194, 0x3d0ec, 0x300000c, 0x318000e,
+    0x90000e, 0x3d28c, 0x3d1b4, 0x680005, 0x3180014, 0x3d341, 0x680009, 0x3d2e8,
+    0x4580004, 0x1b80000, 0x3000001, 0x1c00003, 0x1c00004, 0x3d369, 0x1080009, 0x13d205,
+    0x1480007, 0x3d3ae, 0x1a0000f, 0x148000e, 0x1280019, 0x400012, 0x3d3c5, 0x1280004,
+    0x3d4b2, 0x310000f, 0x1080016, 0x300000c, 0x128000e, 0x3d30e, 0x18000f, 0x3180013,
+    0x3000012, 0x88000c, 0x180014, 0x3d38e, 0x12bd2a5, 0x3d3f2, 0x880005, 0x100007,
+    0x3d493, 0x900014, 0x153d5d7, 0x3d1ec, 0x10000c, 0x3d40d, 0x3d4ce, 0x200005,
+    0x2080010, 0x3d681, 0x1280000, 0x900001, 0x3d574, 0x23d4e3, 0x1580009, 0x1280005,
+    0x880006, 0x3d6a9, 0x98000c, 0x3d503, 0x1b00013, 0x3180014, 0x1c0000f, 0x3d529,
+    0x3d54e, 0x3d5ac, 0x180009, 0x1b0000f, 0x1080012, 0x3d66d, 0x3d60e, 0x3d7a5,
+    0x1280010, 0x180019, 0x3d632, 0x3d6cc, 0x1b00001, 0x1b0000f, 0x3d64f, 0x300000e,
+    0x3d585, 0x3d784, 0x3d809, 0x1480005, 0x1580009, 0x3d725, 0x18000b, 0x3d6ec,
+    0x3d769, 0x3d7c4, 0x3d70f, 0x1480001, 0x1b0000c, 0x180003, 0x3d755, 0x180005,
+    0x3000005, 0x3d834, 0x1b00009, 0x3d469, 0x3d845, 0xd80000, 0x1b00005, 0x1b00019,
+    0x1b00009, 0x180014, 0x463d7e1, 0x1580003, 0x4680004, 0x180000, 0x3000009, 0x1080014,
+    0x3d881, 0x7bd949, 0xd80003, 0xd80004, 0x3d865, 0x300000e, 0x3d8ee, 0x1bd8c1,
+    0x1080013, 0x3da08, 0xd8000e, 0x3dae3, 0x680002, 0x3db24, 0x1c00016, 0x3d909,
+    0x1bd933, 0x3db4c, 0x1480001, 0x7bd8b4, 0x18000c, 0x1080009, 0x3da2e, 0x1b00019,
+    0x18000f, 0x18000b, 0xd80014, 0x3dad2, 0x1080015, 0x128000f, 0x3da54, 0x180010,
+    0x1b00003, 0x100001, 0x1780001, 0x4700015, 0x3da95, 0x3dca5, 0xd80005, 0x178000c,
+    0x1780001, 0xd80009, 0x300000e, 0x3dc2e, 0x3db65, 0x18000f, 0x148000d, 0xd80000,
+    0x1b0000f, 0x1480010, 0x3dbe1, 0xd80004, 0x3dd72, 0x3dbd4, 0x280012, 0x1b00003,
+    0x280001, 0x1480002, 0x3dba1, 0x1080012, 0x280001, 0x180014, 0x1580002, 0x3dd83,
+    0x18000f, 0x1c00009, 0x3dd13, 0x3dd54, 0x3dd29, 0x1c00006, 0x1280013, 0x1080001,
+    0x1780012, 0x3de23, 0x180019, 0x3000013, 0x14bdc8d, 0x680009, 0x3dcc9, 0x3000013,
+    0x1780019, 0xd00000, 0x3ddb6, 0x40000d, 0x3dced, 0x3ddce, 0x3000013, 0x3de10,
+    0x1b00001, 0x3de8e, 0x3ddf3, 0xd80005, 0x1480016, 0x1580016, 0x3180005, 0x10bde49,
+    0x1480009, 0x1b00008, 0x3df85, 0x3dc61, 0x128000c, 0x1c0000f, 0x1500004, 0x1480002,
+    0x3180005, 0x128000e, 0x8bde72, 0x1580009, 0x1780012, 0x3deb3, 0x1b0000e, 0x1b00019,
+    0x3000016, 0x200003, 0x680009, 0x3df25, 0x3dfc9, 0x1280005, 0x1580014, 0x3df45,
+    0x3dec9, 0x680014, 0x200007, 0x3000001, 0x3df65, 0x1c00002, 0x148000d, 0x680009,
+    0x303e0c8, 0x1b00013, 0x900014, 0x3000013, 0x3e034, 0x3dfa5, 0x900001, 0x20000e,
+    0x3e001, 0x3e045, 0x1b0000c, 0x980009, 0x1b00002, 0x3e1ae, 0x3e0f2, 0x3df14,
+    0x3e189, 0x3000014, 0x680009, 0x3deee, 0x3e252, 0x3dfec, 0x1280013, 0x180015,
+    0x3e133, 0x900001, 0x680012, 0x68000d, 0x10000e, 0x680017, 0x3e2e1, 0x3e152,
+    0x3e1cf, 0x3e1f3, 0x3e105, 0x3e389, 0x1580016, 0x180000, 0x3e2ae, 0x680005,
+    0x3e201, 0x3e225, 0x3e289, 0x68000f, 0x1280007, 0x3e265, 0x3000013, 0x3000015,
+    0x1c00001, 0x8be306, 0x1780009, 0x680005, 0x1b0000e, 0x3e349, 0x680012, 0x680009,
+    0x1280013, 0x98000e, 0x88000f, 0x1480002, 0x1b0000c, 0x3e2c5, 0x900004, 0x200014,
+    0x3e428, 0x303e449, 0x900001, 0x3e325, 0x880003, 0x178001a, 0x3000012, 0x180000,
+    0x90000e, 0x680005, 0x680010, 0x1b0000f, 0x1b0000f, 0x880014, 0x3e3c9, 0x3e48c,
+    0x980012, 0x3e52e, 0x3e4af, 0x18000c, 0x3e369, 0x1be46e, 0x1280013, 0x1b00006,
+    0x1c00007, 0x1b00009, 0x1580015, 0x3e589, 0x3e5a9, 0x478001a, 0x3e5cd, 0x90000e,
+    0x880000, 0x1c0000f, 0x3e749, 0x3e54f, 0x180000, 0x3e669, 0x1280015, 0x1600015,
+    0x1c00009, 0x3e635, 0x6be5e5, 0x178000f, 0x3e56c, 0x1280004, 0x3e705, 0x68000f,
+    0x3e7e5, 0x1780015, 0x3e689, 0x3e72c, 0x1080009, 0x108000e, 0x3e64d, 0x3100014,
+    0x3e6f4, 0x1280019, 0x158000c, 0x180009, 0x3e6b3, 0x3e6d4, 0x680019, 0xf00001,
+    0x2a80012, 0x100003, 0x1c00004, 0x980015, 0x1580012, 0x180007, 0x680001, 0x3e761,
+    0x680001, 0x90000c, 0x900005, 0x180019, 0x3e805, 0x3e7a5, 0x900000, 0x3000009,
+    0x1480014, 0x980005, 0x3e7c5, 0x1480014, 0x3e832, 0x148000c, 0x3e894, 0x1c0000f,
+    0x148000e, 0x1080014, 0xd80005, 0xd80016, 0x3180008, 0x3e90c, 0x3e864, 0x680019,
+    0x178000e, 0x1480007, 0x3e8a5, 0x3180014, 0x3180014, 0x1c00016, 0x680013, 0x680005,
+    0x1c00005, 0x1480009, 0x3ea94, 0x128000f, 0x3e855, 0x310000c, 0x1b00009, 0x1b0000f,
+    0x1280005, 0x1b00012, 0x3ea6e, 0x1480005, 0x3e4c9, 0x3e8c3, 0x1580004, 0x300000d,
+    0x3e8e1, 0x1280006, 0x3180001, 0x3e98f, 0x3e928, 0x1b00003, 0x3000014, 0x1280003,
+    0x3e945, 0x1280004, 0x280001, 0x1c0000d, 0x1b00001, 0x3eb03, 0x1780001, 0x3000012,
+    0x3e9c9, 0x1780003, 0x3ed52, 0x3eb44, 0x1b0000c, 0x178000f, 0x1280013, 0x3100012,
+    0x3ec01, 0x178000f, 0x3eae5, 0x3eb25, 0x3ea25, 0xd80013, 0x3ecc5, 0x3e9ef,
+    0x3ec49, 0x3e9b5, 0x3d5f0, 0x3eacf, 0x3ece5, 0x1c00014, 0x3ed08, 0x3eb8f,
+    0x3ebcf, 0x3eab9, 0x3ebe3, 0x3ecb8, 0x3ec69, 0x3ee0d, 0x310000d, 0x3ebb5,
+    0x3ed2c, 0x1580005, 0x3ed85, 0x3eb6c, 0x3ec33, 0x3edc9, 0x3eec8, 0x3ee81,
+    0x3edf4, 0x3ef09, 0x3ef28, 0x3efc1, 0x3eea5, 0x3ef89, 0x3ee65, 0x3f014,
+    0x3ef6d, 0x3f06e, 0x3eef4, 0x3f02f, 0x3efaf, 0x480000d, 0x303f1e5, 0x3f089,
+    0x3f12c, 0x1480019, 0x3f04b, 0x3ef52, 0x3f0cf, 0x3eff2, 0x1c00001, 0x3f18f,
+    0x3f0a8, 0x3f164, 0x3f26e, 0x3f2a3, 0x3f109, 0x3f141, 0x3f36c, 0x3f242,
+    0x3f0eb, 0x1c00001, 0x3f3a9, 0x3f409, 0x158000d, 0x3f3d2, 0x3f467, 0x3f2f5,
+    0x3f5ad, 0x3f4a5, 0x3f1b7, 0x3f294, 0x3f5ce, 0x3f52c, 0x3f701, 0x3f54d,
+    0x3f4da, 0x3f5ee, 0x3f433, 0x3f60e, 0x3f492, 0x3f58f, 0x3f4eb, 0x3f62c,
+    0x3f44e, 0x3f577, 0x3f68e, 0x3f514, 0x3f6c6, 0x3f655, 0x3f6e7, 0x3f6b3,
+    0x3f677, 0x3f723, 0x3f749, 0x3f894, 0x3f768, 0x3f7e5, 0x3f7ac, 0x3100003,
+    0x3f821, 0x3f801, 0x3f901, 0x3f7cf, 0x3f793, 0x3f94c, 0x3f8e5, 0x1480001,
+    0x3f8b0, 0x3f929, 0x3fa4f, 0x3fa01, 0x3f9ae, 0x3fa83, 0x3f970, 0x3f86f,
+    0x3f992, 0x3f9cd, 0x3fa61, 0x3fa2c, 0x3f854, 0x3100012, 0x3f8cc, 0x3f9f3,
+    0x3fad3, 0x3fab1, 0x3fb48, 0x3fb05, 0x3fbce, 0x3fb25, 0x3fb65, 0x3fbec,
+    0x3fd70, 0x3fc06, 0x3fd87, 0x3fea5, 0x3fcb9, 0x3fde5, 0x3fcc1, 0x3fd12,
+    0x3fc35, 0x3fcef, 0x3faee, 0x3fc83, 0x3fb8e, 0x3fdd0, 0x3fc53, 0x3fc74,
+    0x3fee6, 0x3ff85, 0x3fe85, 0x3fd34, 0x3ffe3, 0x3ffcf, 0x3ff08, 0x400b3,
+    0x40141, 0x40069, 0x40166, 0x3fd53, 0x3ff45, 0x3ff21, 0x4004c, 0x401cc,
+    0x1580001, 0x401e5, 0x3f3f4, 0x40009, 0x3000003, 0x4022c, 0x40108, 0x40285,
+    0x15c00c9, 0x4024f, 0x403a2, 0x4018b, 0x40363, 0x402f0, 0x4800002, 0x4030c,
+    0x402c3, 0x402b4, 0x40214, 0x40386, 0x40326, 0x404ce, 0x40430, 0x404ad,
+    0x40261, 0x404f4, 0x40410, 0x4052c, 0x3180009, 0x40505, 0x40543, 0x4058b,
+    0x4048e, 0x40a04, 0x406b2, 0x40454, 0x403f6, 0x403d3, 0x488000d, 0x405b4,
+    0x158000d, 0x405f4, 0x40605, 0x405cf, 0x406ce, 0x40649, 0x40634, 0x406ef,
+    0x1480009, 0x4068c, 0x40725, 0x40761, 0x40465, 0x40834, 0x4070e, 0x4084c,
+    0x40752, 0x40665, 0x408ec, 0x40c21, 0x40872, 0x40b85, 0x408d5, 0x408a9,
+    0x4092d, 0x40895, 0x40792, 0x409e7, 0x40a65, 0x40814, 0x4094f, 0x40a32,
+    0x40acd, 0x4090d, 0x40ae5, 0x407d9, 0x40ab7, 0x40baf, 0x40b53, 0x40b14,
+    0x409ce, 0x40a4b, 0x40c85, 0x40b33, 0x40bd3, 0x40a96, 0x40c04, 0x4900014,
+    0x40c61, 0x1c00007, 0x40e09, 0x40bed, 0x40dd4, 0x40e2e, 0x40cc5, 0x40c4d,
+    0x40eb4, 0x40df5, 0x40d13, 0x40e8e, 0x40e61, 0x40b73, 0x40cb4, 0x40fa6,
+    0x40ec6, 0x40ee9, 0x40f04, 0x40f62, 0x40f2e, 0x40fe3, 0x40f89, 0x40fc1,
+    0x41149, 0x310000b, 0x411e1, 0x40e52, 0x41042, 0x4102c, 0x4110f, 0x413b3,
+    0x41073, 0x4120d, 0x1580012, 0x4116f, 0x41226, 0x410f0, 0x4134b, 0x4130f,
+    0x41245, 0x4100b, 0x410a5, 0x413c2, 0x41265, 0x4136e, 0x412b2, 0x4138e,
+    0x412c5, 0x41401, 0x4118f, 0x41448, 0x318000f, 0x413ef, 0x488000c, 0x41329,
+    0x414a9, 0x41527, 0x4148f, 0x41645, 0x41565, 0x4142f, 0x1580009, 0x4146f,
+    0x414e9, 0x414d5, 0x40cf5, 0x41589, 0x41707, 0x41541, 0x41515, 0x41614,
+    0x415d4, 0x416e5, 0x4174e, 0x4162b, 0x415f2, 0x41835, 0x416a1, 0x41661,
+    0x41765, 0x41734, 0x4178f, 0x41895, 0x41933, 0x417ac, 0x417c7, 0x41965,
+    0x418ee, 0x41954, 0x418ae, 0x4186f, 0x41a09, 0x417f3, 0x41a63, 0x419ae,
+    0x41ac3, 0x41904, 0x41a46, 0x41993, 0x419c5, 0x31419e5, 0x41ae3, 0x4800008,
+    0x41b54, 0x41a8b, 0x41a25, 0x3100001, 0x1480019, 0x41be5, 0x41c35, 0x41b88,
+    0x41b2f, 0x41bc5, 0x41aa8, 0x41b6f, 0x41bae, 0x41c53, 0x41ca2, 0x41c67,
+    0x41d6b, 0x41b14, 0x41c09, 0x41c85, 0x41cc1, 0x4980001, 0x41d95, 0x41de2,
+    0x41da1, 0x41d45, 0x3100001, 0x41e45, 0x41d03, 0x41e93, 0x41ff7, 0x3180003,
+    0x42041, 0x42089, 0x420b2, 0x41fa8, 0x41cef, 0x41ea7, 0x310000f, 0x41d32,
+    0x420c1, 0x41e2b, 0x4230d, 0x42385, 0x41e13, 0x42121, 0x41dd5, 0x41fd4,
+    0x422ac, 0x42005, 0x41ed4, 0x42165, 0x42108, 0x424c5, 0x42185, 0x421c9,
+    0x15c242f, 0x42203, 0x421a9, 0x42245, 0x4226b, 0x42321, 0x41f72, 0x422ce,
+    0x42443, 0x31c2225, 0x1c42661, 0x424f4, 0x42492, 0x423cf, 0x421f5, 0x424a8,
+    0x42465, 0x3ee54, 0x423b4, 0x4252f, 0x42508, 0x425e6, 0x423f1, 0x42582,
+    0x42374, 0x426c8, 0x427ed, 0x425c5, 0x42752, 0x4272e, 0x42710, 0x427c5,
+    0x428a5, 0x42965, 0x42801, 0x4288f, 0x42874, 0x42912, 0x42845, 0x42943,
+    0x427b3, 0x426f3, 0x42649, 0x428f7, 0x4298c, 0x42a94, 0x42a49, 0x42aac,
+    0x42933, 0x42770, 0x1c00005, 0x42a07, 0x426b3, 0x42bed, 0x428d5, 0x42a29,
+    0x42c0e, 0x42bce, 0x42b48, 0x4283a, 0x42c52, 0x148000c, 0x42b0f, 0x42af4,
+    0x42c24, 0x42c84, 0x42ad2, 0x42b25, 0x42b6e, 0x42b81, 0x42ec1, 0x42ca8,
+    0x42cc1, 0x42c65, 0x42d16, 0x42ce1, 0x42e06, 0x1c00005, 0x42e2e, 0x42fcc,
+    0x42f8e, 0x42d49, 0x43021, 0x430c8, 0x42fa5, 0x42e93, 0x42ef4, 0x310000e,
+    0x42f41, 0x43143, 0x42d92, 0x42fe1, 0x430e7, 0x43225, 0x42db4, 0x436e3,
+    0x431ce, 0x431f4, 0x432af, 0x431a5, 0x42f0e, 0x43345, 0x43259, 0x43294,
+    0x43374, 0x43261, 0x43134, 0x43545, 0x432c4, 0x4320f, 0x43326, 0x4374e,
+    0x43715, 0x43767, 0x437ae, 0x43828, 0x432ec, 0x318000d, 0x437e2, 0x43846,
+    0x43410, 0x433e3, 0x43893, 0x434d3, 0x43314, 0x43587, 0x433c8, 0x433b7,
+    0x4348a, 0x4364b, 0x43804, 0x435cd, 0x438a8, 0x437c9, 0x43610, 0x43729,
+    0x43a29, 0x436b3, 0x43694, 0x3000014, 0x43636, 0x436d7, 0x43868, 0x438c9,
+    0x43925, 0x43793, 0x43949, 0x4398c, 0x43909, 0x43969, 0x43a83, 0x439e4,
+    0x439af, 0x438f2, 0x43b23, 0x43ac1, 0x43a0f, 0x439d4, 0x43aa8, 0x43b8e,
+    0x43c12, 0x43b15, 0x43af5, 0x43bf4, 0x43a6d, 0x43b4f, 0x43bc9, 0x43cf3,
+    0x43bb2, 0x43e0d, 0x43c28, 0x43d07, 0x43c66, 0x3100015, 0x43c4f, 0x43d32,
+    0x3100004, 0x43dee, 0x3100014, 0x43e62, 0x43cc5, 0x43e45, 0x43fae, 0x43da5,
+    0x43ea9, 0x43e34, 0x43f93, 0x43fe5, 0x43d8d, 0x3180005, 0x43f15, 0x43e89,
+    0x44092, 0x44014, 0x43fc5, 0x43f74, 0x4406e, 0x43ecf, 0x4800006, 0x44021,
+    0x43ef2, 0x441b4, 0x440b1, 0x44045, 0x484410c, 0x440d7, 0x441e7, 0x44169,
+    0x44229, 0x44195, 0x443f0, 0x441c5, 0x442a5, 0x44412, 0x4424f, 0x44218,
+    0x4444e, 0x4a44347, 0x442f5, 0x444d3, 0x444eb, 0x44136, 0x442d0, 0x44425,
+    0x44292, 0x44395, 0x443c5, 0x44523, 0x44465, 0x44277, 0x44563, 0x44503,
+    0x444a9, 0x44602, 0x44705, 0x44669, 0x4464b, 0x448d1, 0x44763, 0x44335,
+    0x4454c, 0x4458e, 0x445ce, 0x44492, 0x44681, 0x4472e, 0x447eb, 0x449ed,
+    0x446c5, 0x445b2, 0x446e1, 0x446b4, 0x44810, 0x44865, 0x44745, 0x448ed,
+    0x447d4, 0x44a27, 0x44789, 0x44884, 0x35e45, 0x447b2, 0x44910, 0x44a03,
+    0x4482f, 0x44a8c, 0x449d2, 0x44966, 0x44a65, 0x4484e, 0x44b2b, 0x44985,
+    0x44a56, 0x44bb0, 0x448b3, 0x44934, 0x44b62, 0x44aa8, 0x44b45, 0x44b81,
+    0x44af0, 0x44c01, 0x44cf4, 0x44d52, 0x44dcc, 0x44bec, 0x44c72, 0x44cb4,
+    0x44bd2, 0x4a00007, 0x44c25, 0x44da3, 0x44c4e, 0x310000b, 0x44c81, 0x3000001,
+    0x44d6c, 0x44e95, 0x3100009, 0x44ad5, 0x498000f, 0x44d2f, 0x3100013, 0x44de1,
+    0x44e2f, 0x44d89, 0x44f42, 0x44f61, 0x45015, 0x44e05, 0x44d0e, 0x44fcb,
+    0x45021, 0x1580005, 0x4508e, 0x44ef4, 0x44f92, 0x44ec5, 0x44f36, 0x45072,
+    0x44eb0, 0x44fef, 0x45184, 0x44fae, 0x45115, 0x451a4, 0x1c450e1, 0x450a1,
+    0x452a9, 0x450c9, 0x45165, 0x45375, 0x451c9, 0x45234, 0x452ec, 0x45303,
+    0x45381, 0x45324, 0x455a7, 0x4534c, 0x45274, 0x453cd, 0x45252, 0x45405,
+    0x454a7, 0x45214, 0x45430, 0x45505, 0x4544c, 0x453f4, 0x4548b, 0x452ce,
+    0x4528b, 0x45563, 0x454c5, 0x4546e, 0x3100009, 0x45663, 0x455c3, 0x453ac,
+    0x45554, 0x454f4, 0x45527, 0x45653, 0x45686, 0x45584, 0x457d4, 0x456f0,
+    0x45729, 0x45749, 0x45614, 0x1b00004, 0x457ab, 0x45774, 0x4586c, 0x458a1,
+    0x456d4, 0x1b00014, 0x45629, 0x1b00007, 0x1b00004, 0x1b00002, 0x68000e, 0x1c00006,
+    0x900015, 0x900014, 0x1b00000, 0x1b0000e, 0x1780001, 0x1480012, 0x3000005, 0x1b0000f,
+    0x1b0000c, 0x1780009, 0x1780004, 0x1c0000e, 0x900012, 0x1c0000e, 0x680000, 0x180003,
+    0x900000, 0x45789, 0x1c00001, 0x1780008, 0x1b00016, 0x1b00003, 0x1b00001, 0x2f8000f,
+    0x4780014, 0x148000f, 0x45834, 0x1c0000e, 0x3100009, 0x1780005, 0x1b00019, 0x1780003,
+    0xd80019, 0x4880004, 0x880009, 0x1c00005, 0x680005, 0x3000009, 0x680017, 0x3000013,
+    0x900009, 0x1780013, 0x900005, 0x45134, 0x680009, 0x880013, 0x4800008, 0x68000f,
+    0x158000f, 0x680005, 0x1780001, 0x4a0000c, 0x680012, 0x108001a, 0x880012, 0x1b0000f,
+    0x1b00001, 0x4596c, 0x45805, 0x3100009, 0x45849, 0x3180014, 0x1c00013, 0x900005,
+    0x3000007, 0x458e1, 0x1780014, 0x457e9, 0x4a0000c, 0x458c1, 0x880015, 0x1b00013,
+    0x900000, 0x4592e, 0x1780014, 0x1b0000c, 0x900009, 0x178000e, 0x3100001, 0x900013,
+    0x178000e, 0x880014, 0x1780014, 0x178000c, 0x178000f, 0x178000f, 0x1b00008, 0x1780000,
+    0x1c0000d, 0x1780001, 0x45a4e, 0x45889, 0x680007, 0x1780014, 0x1c0000d, 0x90000e,
+    0x1b00010, 0x1780001, 0x1c0000e, 0x1b00002, 0x1780015, 0x148000f, 0x31459ee, 0x1780001,
+    0x451e5, 0x45a01, 0x3000001, 0x1480012, 0x1480012, 0x4800009, 0x1480009, 0x1480001,
+    0x1b00012, 0x1b00007, 0x4b00001, 0x1b00014, 0x1b0000e, 0x1c0001a, 0x178001a, 0x4800008,
+    0x1580003, 0x4a80012, 0x4dcb8, 0x430000f, 0x1480009, 0x1780012, 0x4880008, 0x1b00019,
+    0x1080010, 0x3000014, 0x45945, 0x3000009, 0x1c00005, 0x3000005, 0x1c00014, 0xd8000f,
+    0x1780014, 0x158000e, 0x1b0000e, 0x1480001, 0x1480003, 0x459a5, 0x1c0000d, 0x180016,
+    0x1480019, 0x45a89, 0x1c0000c, 0x45909, 0x1b00012, 0x45b10, 0x1c0000f, 0x3180014,
+    0xdc5b69, 0x18000e, 0x1b0000d, 0x45ba9, 0x1c00013, 0xd80009, 0x4880010, 0x1b00005,
+    0x1780000, 0x45c25, 0x45c43, 0x158001a, 0xd80014, 0x1080009, 0x158000d, 0x900000,
+    0x180003, 0x180001, 0x45a21, 0x158001a, 0x3100014, 0x1780003, 0x1080005, 0x1580012,
+    0x1c00012, 0x180009, 0x1580003, 0x1780013, 0x318000e, 0x1080000, 0x1580014, 0x500001,
+    0x148000c, 0x1080009, 0x1b00007, 0x310000f, 0x3000005, 0x3180009, 0x45c09, 0x3980002,
+    0x1280015, 0x45a69, 0x1b00001, 0x3000009, 0x680005, 0x1c00014, 0x1b00019, 0x900014,
+    0x180016, 0x68000e, 0x4a0000e, 0x1b0000d, 0x68000c, 0xd80015, 0x3000005, 0xdc5c83,
+    0x45aae, 0x45c69, 0x158000c, 0x45ae9, 0x4800012, 0x580016, 0x680012, 0x1580009,
+    0x1b0000c, 0x45b94, 0x4b80011, 0xd80000, 0x68000d, 0x1b0001a, 0x3100009, 0xd80000,
+    0x1780012, 0x1c0001a, 0x1b00012, 0x45b2f, 0x3100012, 0x1780014, 0x45cac, 0x180000,
+    0x1c00012, 0x1480005, 0x1c00005, 0x1b00012, 0x1580015, 0x1480003, 0x1c00012, 0x1580012,
+    0x3180005, 0x1c00013, 0x180013, 0x900006, 0x1c0000e, 0x3180009, 0x148000c, 0x158000e,
+    0x1280000, 0x3100003, 0x180013, 0x45d33, 0x45d49, 0x128000d, 0x900005, 0x128000d,
+    0x1280003, 0x1280013, 0x45cf0, 0x1780001, 0x128000d, 0x1780001, 0x1780001, 0x1080009,
+    0x68000e, 0x900014, 0x1b0000f, 0x1280013, 0x1b00019, 0x3600005, 0x880005, 0x45cc5,
+    0x45e65, 0x1c0000f, 0x45bc9, 0x1b00007, 0x3000004, 0x4a00001, 0x1b00009, 0x45be9,
+    0x45eb2, 0x1780001, 0x880005, 0x2f80000, 0x1780001, 0x1780000, 0x3600007, 0x45ec9,
+    0x680002, 0x880012, 0x1b00008, 0x1b00001, 0x1780001, 0x45f32, 0x1b00005, 0x1b00008,
+    0x1b00001, 0x45d09, 0x3300009, 0x108001a, 0x1b0001a, 0x1280014, 0x45d65, 0x1780003,
+    0x45d85, 0x1b00009, 0x900013, 0x1b0000f, 0x1b0000f, 0x1780008, 0x45ee7, 0x1b00003,
+    0x1780012, 0x1280002, 0x45da9, 0x3b80002, 0x1b00014, 0x1b00013, 0x1b0000c, 0x45fc9,
+    0x1580012, 0x12c5f43, 0x1280004, 0x1b00001, 0x880014, 0x180004, 0x1780008, 0x318000c,
+    0x680005, 0x88000c, 0x1b00000, 0x1c0000f, 0x1280001, 0x158000e, 0x4c00013, 0x178000f,
+    0x1b00001, 0x108000b, 0x45f63, 0x1780005, 0x180005, 0x88000e, 0x46045, 0x1b00013,
+    0x1780014, 0x1480012, 0x1080015, 0x680013, 0x180014, 0x1780014, 0x1580012, 0x1b00012,
+    0x1b0000e, 0x1b00003, 0x108001a, 0x1780014, 0x46074, 0x1c0000e, 0x46096, 0x45f05,
+    0x460ce, 0x45ff4, 0x90000e, 0x1780015, 0x1b00001, 0x1780012, 0x680005, 0x460f2,
+    0x3d00002, 0x4a0000e, 0x88000e, 0x1780007, 0x90000f, 0x3000004, 0x4880004, 0x148000f,
+    0x1b00012, 0x1b0000d, 0x46115, 0x900005, 0x45fa9, 0x1b00001, 0x1780003, 0x1780007,
+    0x310000c, 0x1b00006, 0x900002, 0x1b00014, 0x900007, 0x178000c, 0x3000009, 0x1c00008,
+    0x318000f, 0x1780007, 0x3100005, 0x1b00013, 0x1780005, 0x1c00013, 0x4880008, 0x3100005,
+    0x900000, 0x88000e, 0x4800014, 0x1080001, 0x50000c, 0x1780012, 0x88000e, 0x1080005,
+    0x1b0000c, 0x1580005, 0x46009, 0x1480005, 0x460b4, 0x4800014, 0x1480009, 0x1b00014,
+    0x900013, 0x3100001, 0x3100014, 0x1b00014, 0x1c00019, 0x3100003, 0x68000e, 0x148000e,
+    0x1080001, 0x180016, 0x1c00013, 0x1080000, 0x1b00013, 0x88000e, 0x680014, 0x1b00014,
+    0x3000014, 0x17c619a, 0x1c00005, 0x1b0001a, 0x480000f, 0x3100009, 0x1c00015, 0x1b0001a,
+    0x180001, 0x461e8, 0xd80004, 0x46133, 0x318000d, 0x1480009, 0x1080000, 0x46145,
+    0x410001a, 0x1480005, 0x3180005, 0x178000e, 0x1480005, 0x46165, 0x461a5, 0x1c00014,
+    0x1b00013, 0x310000f, 0x1480001, 0x3180010, 0x461c9, 0x1480019, 0x3100001, 0x1480004,
+    0x68000e, 0x3000005, 0x158000c, 0x46205, 0x0, 0x0, 0x900014, 0x4a00012,
+    0x1580009, 0x900015, 0x1c00012, 0x3180005, 0x1480019, 0x4880005, 0x1c00014, 0x1b0000e,
+    0x1c0000c, 0x90001a, 0x46029, 0x1b00013, 0x158000f, 0x68000e, 0x1c00005, 0x1280014,
+    0x1280016, 0x462e9, 0x1780001, 0x1b00000, 0x1280000, 0x1280001, 0x46254, 0x1b00001,
+    0x1b00005, 0x1780001, 0x2c80001, 0x1780001, 0x158000c, 0x1b0000e, 0x1b00003, 0x1c00015,
+    0x880009, 0x1480012, 0x180000, 0x1c00002, 0x1b0000f, 0x1b00014, 0x1780001, 0x3180009,
+    0x1280005, 0x1c00001, 0x1c0000e, 0x1780005, 0x1b00001, 0x900009, 0x1c00005, 0x1780001,
+    0x46261, 0x680014, 0x0, 0x4a0000c, 0x46234, 0x462a9, 0x46321, 0x0,
+    0x1c00019, 0x1780012, 0x462c9, 0x1b0000e, 0x463a5, 0x900013, 0x1b00006, 0x1780004,
+    0x46309, 0x1480005, 0x463f2, 0x1c00005, 0x68000e, 0x46292, 0x1580014, 0x1080000,
+    0x1b0000e, 0x1580015, 0x46349, 0x178000e, 0x463c1, 0x1c00010, 0x4a0000e, 0x4c80014,
+    0x1780019, 0x46385, 0x68000c, 0x4a0000e, 0x680000, 0x1b0000c, 0x1480009, 0x1780001,
+    0x680013, 0x1780001, 0x178000c, 0x1480019, 0x128000d, 0x128000d, 0x1780014, 0x900009,
+    0x1780000, 0x3600000, 0x1b00000, 0x478000b, 0x900005, 0x1080014, 0x46489, 0x880000,
+    0x1480005, 0x1580003, 0x46413, 0x180016, 0x1b0000e, 0x1c00014, 0x330000f, 0x1480005,
+    0x148000c, 0x4644c, 0x1080000, 0x680005, 0x464d3, 0x3100002, 0x180019, 0x680009,
+    0x1b0000f, 0x1080000, 0x46429, 0x68000f, 0x6c6514, 0x46692, 0x108000f, 0x680012,
+    0x180000, 0x464a5, 0x1c00012, 0x680001, 0x148000c, 0x1580001, 0x1580012, 0x900001,
+    0x46623, 0x46554, 0x1780007, 0x465b5, 0x1580012, 0x1c0000c, 0xd80003, 0x1b00014,
+    0x1580012, 0x4d0001a, 0x1080000, 0x46534, 0x1b00005, 0x3100004, 0x4a00001, 0x1b00007,
+    0x46650, 0x4800005, 0x3180001, 0x900000, 0x1c00015, 0x1c00014, 0x1080001, 0x46733,
+    0x465e9, 0x1580005, 0x4800015, 0x1480009, 0x46769, 0x1780007, 0x1c0000e, 0x1480019,
+    0x1b00005, 0x3600007, 0x1080001, 0x1c00003, 0x1b0000e, 0x4674e, 0x1780005, 0x1480019,
+    0x1c00013, 0x1480005, 0x1c0000e, 0x1780013, 0x1480005, 0x900001, 0xd80009, 0x158001a,
+    0x900005, 0x1b0001a, 0x467ba, 0x1b00009, 0x158000c, 0xd80001, 0x467c9, 0x1c00019,
+    0x46852, 0x4100005, 0x12c66ec, 0x1480009, 0x45f81, 0x1c00005, 0x1c00005, 0x3180001,
+    0x1780000, 0x4a0000c, 0x466b3, 0x180000, 0x46592, 0x1c00014, 0x1780019, 0x4846881,
+    0x1580009, 0x1b00019, 0x4a00013, 0x466c9, 0x1b00001, 0x1b00013, 0x4a80012, 0x3100009,
+    0x1280013, 0x467f3, 0x4880009, 0x46912, 0x178000c, 0x4a00009, 0x1c00009, 0x468ad,
+    0x178001a, 0x1b00014, 0x1580005, 0x1480014, 0x1280000, 0x90000f, 0x90000c, 0x3100002,
+    0x4d80005, 0x46952, 0xd80003, 0x46a03, 0x469b4, 0x880013, 0x900005, 0x6c68d4,
+    0x1080000, 0xd8000f, 0x880009, 0x1c0001a, 0x1480001, 0x3100009, 0x178001a, 0x1280012,
+    0x880012, 0x90000f, 0x158000c, 0x1780005, 0x46927, 0xd80003, 0x1480007, 0x1c00002,
+    0x4696c, 0x3000003, 0x4a00009, 0x46982, 0x4e0000c, 0x90001a, 0x880014, 0x880005,
+    0x469cc, 0x3600007, 0x1580005, 0x1480005, 0x3100005, 0x1780003, 0x3180013, 0x46792,
+    0x1b00007, 0x1480012, 0x1780001, 0x4100013, 0x410001a, 0x128000d, 0x46ab2, 0x1080014,
+    0x900005, 0x1b00004, 0x1480008, 0x1b00005, 0x900005, 0x46869, 0x46a54, 0x46af4,
+    0x1580013, 0x1780012, 0x1b00014, 0x128000f, 0x469e5, 0x46a25, 0xd8001a, 0x1b0000e,
+    0x880003, 0x880005, 0x3000014, 0x4a00013, 0x1780012, 0x1b00000, 0x1780007, 0x900000,
+    0x900005, 0x3000005, 0x46a89, 0x1780005, 0x46a69, 0x1780001, 0x46b13, 0x1780008,
+    0x468f2, 0x46ac9, 0x1780000, 0x1780001, 0x900009, 0x1480005, 0x1b00014, 0x46b4e,
+    0x680009, 0x480000f, 0xd8000c, 0x4800006, 0x4a46b29, 0xdc6b81, 0x0, 0x1780007,
+    0x46be7, 0x1780001, 0x4a0000e, 0x1280009, 0x90000e, 0x1c00008, 0x1780019, 0x46b69,
+    0x1780007, 0x900012, 0x1780019, 0x90000c, 0x1780009, 0x46bc9, 0x46c25, 0x1780000,
+    0x1c0000e, 0x46cb4, 0x46c85, 0x178000f, 0x1780019, 0x8c6bb0, 0x1b0000c, 0x3100009,
+    0x158000c, 0x4a00009, 0x46c14, 0x46c73, 0x1780019, 0x1780019, 0x1b00014, 0x1780000,
+    0x1b00001, 0x46c4e, 0x1b00013, 0x1780012, 0x880005, 0x108000e, 0x3180013, 0x680014,
+    0x1b00014, 0x1c00009, 0x46cc2, 0x880014, 0x1480013, 0x1c0000c, 0x1480019, 0x46d07,
+    0x1b00012, 0x300000c, 0x46369, 0x46d89, 0x4a00001, 0x3000005, 0x1480003, 0x46d33,
+    0x1280000, 0x68000e, 0x46ce2, 0x1580009, 0x46d61, 0x1b0000e, 0x3100009, 0x1280007,
+    0x4800005, 0x1b0001a, 0x1b00019, 0x158000f, 0x680000, 0x1b00007, 0x680005, 0xd80005,
+    0x46d41, 0x1b00001, 0x46df4, 0x1080009, 0x1c00012, 0x3100014, 0x3000002, 0x1c00001,
+    0x1080014, 0x3100014, 0x46da9, 0x1080009, 0x3000005, 0x46dc1, 0x1480001, 0x880005,
+    0x158000d, 0x1c0000f, 0x4e80014, 0x46e05, 0x318000f, 0x880001, 0x3180005, 0x46ea5,
+    0x46e29, 0x1c00009, 0x1580012, 0x46e49, 0x3000005, 0xd80013, 0x1480005, 0x1580014,
+    0x1c00006, 0x69798, 0x310000f, 0x1b00005, 0x18000c, 0x1b00009, 0x900005, 0x1580012,
+    0x46f67, 0x158000c, 0x46e8f, 0x1780007, 0x46e61, 0x680005, 0x1b00008, 0xd80019,
+    0x680003, 0x1480012, 0x1480012, 0x2080001, 0x1b00012, 0x46eec, 0x46ecd, 0x1480005,
+    0x1780013, 0x1c00014, 0x1580013, 0x46f01, 0x46f92, 0x1b0000e, 0x680009, 0x46ff3,
+    0x46fa9, 0x1780009, 0x680012, 0x1780007, 0x1b00009, 0x68000c, 0x1c00013, 0x1780003,
+    0x3d0001a, 0x158000c, 0x1b0000c, 0x46f2c, 0x1780012, 0x1080004, 0x680005, 0x47132,
+    0x1c0000e, 0x108000e, 0x1c00012, 0x1480005, 0x1080000, 0x3100005, 0x470e9, 0x4c80002,
+    0x1780014, 0x1c00012, 0x47164, 0x158001a, 0x1580003, 0x1c0000c, 0x1b00013, 0x17c71a7,
+    0x68000e, 0x1b00012, 0x1080000, 0x1b0000c, 0x1480001, 0x1580014, 0x148000c, 0x47154,
+    0x47192, 0x178000c, 0x1580003, 0x46fc5, 0x1c0000c, 0x680005, 0x4280013, 0x1b00000,
+    0x900014, 0x1780007, 0x1480014, 0x1480012, 0x1c00009, 0x1b00000, 0x4a00008, 0x3000004,
+    0x1280014, 0x3180009, 0x1b00000, 0x1280012, 0x300000c, 0x471d0, 0x158000c, 0x310000e,
+    0x3000009, 0x1080005, 0x1580009, 0x1480005, 0x4f80004, 0x1480019, 0x1080000, 0x900004,
+    0x900014, 0x1280019, 0x4a00012, 0x1b00004, 0x2d0000f, 0x1b00012, 0xd80000, 0x180019,
+    0x68000c, 0x180004, 0x180001, 0x4f00014, 0x47212, 0x1c00014, 0x90000e, 0x3100001,
+    0x18000f, 0x18000c, 0x158000e, 0x488000c, 0x4800008, 0x1080008, 0x4800014, 0x1b0001a,
+    0x4a80004, 0x1080013, 0xd8000f, 0x1b00005, 0x680002, 0x1b00007, 0x1780003, 0x1b00007,
+    0x471e9, 0x3000004, 0xd80012, 0x900007, 0x1280000, 0x4710c, 0x3100001, 0x1480012,
+    0x1b00019, 0x3000009, 0x1080004, 0x1080000, 0x4722e, 0x4724e, 0x90000f, 0x3100001,
+    0x900019, 0x1780007, 0x108000b, 0x108000b, 0x3180001, 0x1080005, 0xd80005, 0x1b0000e,
+    0x1280004, 0x1280004, 0x1c0000e, 0x47005, 0x1c0000f, 0x178001a, 0x472ac, 0x1b00007,
+    0x470a9, 0x1480005, 0x4880001, 0x180003, 0x47775, 0x0, 0x47261, 0x3000009,
+    0x47054, 0x880000, 0x0, 0x1b00012, 0x680012, 0x1280019, 0x1480013, 0x470c5,
+    0x47289, 0x1c00014, 0xd8000e, 0x1580014, 0x1b00012, 0x3100005, 0x180013, 0x1b00000,
+    0x1b00001, 0x1780013, 0x1c00014, 0x1580013, 0x108000b, 0x1580013, 0x1b00005, 0x472c9,
+    0x1c0000c, 0x68000f, 0x473c9, 0x472e9, 0x473fa, 0xd80000, 0x473a5, 0x47409,
+    0xd80000, 0x178000e, 0x900000, 0x4736c, 0x47301, 0x3100009, 0x1780005, 0x1780012,
+    0x1c00009, 0x4748e, 0x47465, 0x1780014, 0x1c00008, 0x4a47329, 0x47385, 0x3100009,
+    0x47528, 0x680013, 0x474c9, 0x2f80007, 0x880000, 0x1780004, 0x1780007, 0x1580010,
+    0x47434, 0x900009, 0x128000f, 0x1c0001a, 0x180013, 0x1580013, 0x1480005, 0x180019,
+    0x158000e, 0x1b00014, 0x148000c, 0x1080005, 0x1780013, 0x47572, 0x3d00002, 0x1780012,
+    0x1c0001a, 0x1b00008, 0x680012, 0x4880001, 0x3600007, 0x1c00013, 0x310000f, 0x1b00008,
+    0x680019, 0x1580002, 0x47652, 0x680013, 0x1780007, 0x3100013, 0x1c00002, 0x680013,
+    0x474b2, 0x47609, 0x475ae, 0x680012, 0x1c00014, 0x1c00012, 0x1780005, 0x680005,
+    0x68000e, 0x1b00013, 0x1c0000c, 0x476b2, 0x3000009, 0x47449, 0x880005, 0x474e1,
+    0x1780007, 0x1b00005, 0x47665, 0x4768e, 0x1580009, 0x1b0001a, 0x900005, 0x158000d,
+    0x1080000, 0x1580005, 0xd80005, 0x47629, 0x1480005, 0x1c00002, 0x1580008, 0x1080000,
+    0x1b0001a, 0x1580012, 0x1b00009, 0x1080004, 0x128000c, 0x180005, 0x8c774e, 0x1580014,
+    0x1480005, 0x47782, 0x47729, 0x1280013, 0x4880008, 0x50000e, 0x1080014, 0x1b00012,
+    0x1b00012, 0x476c9, 0x1080013, 0x1b0000e, 0x4d0001a, 0x4a00001, 0x476f4, 0x3000004,
+    0x480000c, 0x1780001, 0x47714, 0x1780012, 0x88000e, 0x4750e, 0x1b00014, 0x477a5,
+    0x477f3, 0x4782c, 0x47802, 0x1480012, 0x47842, 0x4788e, 0x478c1, 0x47948,
+    0x478a2, 0x47873, 0x477ce, 0x475f2, 0x478ee, 0x47925, 0x47907, 0x47992,
+    0x479af, 0x479c1, 0x47a24, 0x47aa9, 0x47979, 0x47aec, 0x47a68, 0x47b48,
+    0x47b21, 0x47a16, 0x47b8e, 0x47b05, 0x47a8e, 0x1480005, 0x47c05, 0x47b69,
+    0x47ad2, 0x4800013, 0x47bae, 0x47be7, 0x47ca3, 0x5000012, 0x47c43, 0x47c92,
+    0x479e9, 0x47d0f, 0x47a41, 0x47c70, 0x4b69a, 0x47fc5, 0x48041, 0x47c33,
+    0x47d33, 0x47d53, 0x47ef2, 0x47f2d, 0x47d8e, 0x47f93, 0x47f52, 0x47f6c,
+    0x47f12, 0x47cf2, 0x47fae, 0x47fec, 0x48009, 0x47da8, 0x47ed9, 0x48061,
+    0x48096, 0x481cf, 0x480a5, 0x1c0000f, 0x480c9, 0x4810e, 0x48126, 0x480e9,
+    0x48145, 0x48168, 0x48201, 0x48181, 0x481a8, 0x4802f, 0x48221, 0x481e5,
+    0x482a5, 0x4830f, 0x48244, 0x48284, 0x482c4, 0x48270, 0x483c5, 0x4834f,
+    0x48d99, 0x482ed, 0x48333, 0x48385, 0x48445, 0x484d7, 0x4840c, 0x483e5,
+    0x48585, 0x4842e, 0x48485, 0x4800002, 0x4846b, 0x484a9, 0x48371, 0x43673,
+    0x483b0, 0x48505, 0x3000005, 0x486c2, 0x485c1, 0x3000009, 0x484f0, 0x310000c,
+    0x48743, 0x48672, 0x487ac, 0x486e9, 0x485f4, 0x4856e, 0x48685, 0x0,
+    0x4878c, 0x48637, 0x48532, 0x48553, 0x48808, 0x4870f, 0x486ae, 0x489a1,
+    0x48614, 0x48b05, 0x48ccb, 0x487f4, 0x48732, 0x48892, 0x4892c, 0x48a2e,
+    0x48909, 0x487d3, 0x488b5, 0x488d3, 0x48821, 0x488f2, 0x48a0d, 0x489cf,
+    0x48945, 0x489e5, 0x48bc3, 0x48cef, 0x48c2e, 0x48a72, 0x48a54, 0x48a92,
+    0x48c6f, 0x48c52, 0x4896f, 0x48c13, 0x48b2d, 0x48c93, 0x48ab2, 0x48854,
+    0x48875, 0x48b4c, 0x48bf4, 0x48d0c, 0x48acf, 0x48d29, 0x48cb2, 0x48dc8,
+    0x48af3, 0x48d6b, 0x48e45, 0x48d53, 0x48e82, 0x48db3, 0x48e0c, 0x48e21,
+    0x48f37, 0x48eee, 0x48e63, 0x48fb3, 0x48f4c, 0x48f03, 0x49065, 0x48ec9,
+    0x48fc1, 0x48f89, 0x48eb0, 0x1480009, 0x490f6, 0x49172, 0x491e8, 0x48f73,
+    0x492ad, 0x48fe9, 0x4910e, 0x49008, 0x490c5, 0x490b3, 0x491d2, 0x49212,
+    0x4922c, 0x4924c, 0x492c5, 0x49365, 0x492ec, 0x49294, 0x49345, 0x5000008,
+    0x4926f, 0x4930f, 0x49325, 0x4938f, 0x493a8, 0x494f2, 0x493ce, 0x491b9,
+    0x49409, 0x49465, 0x494a5, 0x494c5, 0x4944c, 0x49489, 0x493f4, 0x496ec,
+    0x4950f, 0x49433, 0x49581, 0x49601, 0x49681, 0x4954e, 0x5080014, 0x4956e,
+    0x49536, 0x496ae, 0x4974c, 0x495b3, 0x4918e, 0x49673, 0x497b4, 0x49629,
+    0x49729, 0x49895, 0x49769, 0x498b3, 0x49825, 0x4996d, 0x49812, 0x49847,
+    0x48de3, 0x498d4, 0x499a9, 0x498e5, 0x49872, 0x49983, 0x49782, 0x499e9,
+    0x49928, 0x49a2e, 0x49a54, 0x4994f, 0x49a63, 0x49ac5, 0x49a14, 0x49b05,
+    0x499cc, 0x4a502, 0x49b4d, 0x49a94, 0x49af3, 0x49b88, 0x49c8f, 0x49b34,
+    0x49c6c, 0x49c4e, 0x49bb4, 0x49919, 0x49ca6, 0x49d64, 0x49cc6, 0x49bd2,
+    0x49dc4, 0x49ab8, 0x49b6c, 0x49d13, 0x49eb6, 0x49c08, 0x49f61, 0x49d90,
+    0x49c2d, 0x4800009, 0x49e6c, 0x49e2c, 0x49e89, 0x49d33, 0x49ec5, 0x49fc8,
+    0x49eef, 0x49df3, 0x49e54, 0x49f2f, 0x49f09, 0x49fb7, 0x4a064, 0x49fe7,
+    0x49f85, 0x4a021, 0x4a0f4, 0x4a1a4, 0x4800009, 0x4a273, 0x4a0af, 0x4a2d7,
+    0x4a050, 0x4a009, 0x4a0d2, 0x4a1e1, 0x4a284, 0x4a22c, 0x3100019, 0x4a184,
+    0x4a2b4, 0x4a1cf, 0x4a145, 0x4a345, 0x4a20f, 0x4a412, 0x4a16e, 0x4a2e5,
+    0x4a3b2, 0x4a365, 0x4a387, 0x49bef, 0x4a30c, 0x4a474, 0x4a445, 0x4a564,
+    0x4a4a1, 0x4a5a1, 0x497f3, 0x4a492, 0x4a42e, 0x1c0000e, 0x4a3f1, 0x4a629,
+    0x4a3d4, 0x4a527, 0x4a54e, 0x4a4e4, 0x4a614, 0x4a685, 0x4a6b4, 0x4a5c5,
+    0x4a5ef, 0x4a748, 0x4a701, 0x4a7ae, 0x4a672, 0x4a7e1, 0x4a833, 0x4a589,
+    0x4a7cd, 0x4a6ed, 0x4a721, 0x4a6d2, 0x4a805, 0x4a656, 0x4a869, 0x4a885,
+    0x4a793, 0x4a8ce, 0x4a8a5, 0x4a854, 0x4a908, 0x4a8e5, 0x4a76f, 0x4a961,
+    0x4a945, 0x4a92e, 0x4aa08, 0x4a9b3, 0x4a9e5, 0x4a9ce, 0x4aa4c, 0x4aa25,
+    0x3100012, 0x4ac62, 0x4aaa5, 0x4aacf, 0x4a993, 0x4aba3, 0x4ac21, 0x4ab6f,
+    0x4abe5, 0x4aa94, 0x4aca9, 0x4ac0f, 0x4acc1, 0x4ada1, 0x4aa75, 0x4abd4,
+    0x4aec8, 0x4ad93, 0x4a4d3, 0x4ad13, 0x4ac85, 0x4afe1, 0x4ad6c, 0x4ac53,
+    0x4ae0f, 0x4ae73, 0x4ae93, 0x4adc9, 0x4af8c, 0x4acf0, 0x4ae29, 0x3100009,
+    0x4ad4f, 0x4af73, 0x4aee5, 0x4aea5, 0x4af45, 0x4ae54, 0x4af39, 0x4b043,
+    0x4b106, 0x4b161, 0x4b18f, 0x4afc2, 0x4b126, 0x4b0ad, 0x4b02c, 0x4b006,
+    0x4afae, 0x4b203, 0x1c00012, 0x4b08f, 0x4b2af, 0x4b14c, 0x4b2e1, 0x4b1af,
+    0x4b348, 0x4b0d0, 0x4b32f, 0x4b405, 0x4b073, 0x4b1f4, 0x4b269, 0x4b1d3,
+    0x4b253, 0x4b0f9, 0x4b2cf, 0x4b234, 0x4b292, 0x4b4a7, 0x4800009, 0x4b36f,
+    0x4b3cc, 0x4b383, 0x4b459, 0x4b532, 0x4b4e3, 0x4b5f2, 0x4b485, 0x4b60e,
+    0x4b709, 0x4b42f, 0x4b589, 0x4b5cf, 0x4b655, 0x4800002, 0x4b633, 0x4b6d2,
+    0x4b7a9, 0x4b5b0, 0x4a121, 0x4b665, 0x4b4d3, 0x4b514, 0x4b6f6, 0x4b813,
+    0x4b883, 0x4b6b3, 0x4b94d, 0x4b82c, 0x4b8a5, 0x4b8f3, 0x4b9e5, 0x4b76f,
+    0x4b752, 0x4af0f, 0x4b84c, 0x4b928, 0x4b864, 0x4b96d, 0x4ba73, 0x4b9ad,
+    0x4ba09, 0x4ba25, 0x4b912, 0x4b7d1, 0x4b9ce, 0x4ba90, 0x4b994, 0x4ba55,
+    0x4bb2d, 0x4bbc7, 0x4bba6, 0x4bab7, 0x4bb72, 0x4bc14, 0x4bb09, 0x4baef,
+    0x4bb41, 0x4bad0, 0x4bb82, 0x4bbe1, 0x4bc4f, 0x4bc27, 0x1c0000f, 0x4bdac,
+    0x4bc90, 0x4bccf, 0x4bd09, 0x4bd72, 0x4bcf6, 0x4bd29, 0x4bf61, 0x4bc6f,
+    0x4bd94, 0x4be89, 0x310000c, 0x4be4c, 0x4bf2f, 0x4bdd2, 0x4bfe6, 0x4bcb4,
+    0x4bde2, 0x4be03, 0x4be24, 0x4beef, 0x4be66, 0x4bd47, 0x1c00014, 0x4c101,
+    0x4bfcf, 0x4c085, 0x4bf0c, 0x4c00d, 0x4c150, 0x4c164, 0x4c18f, 0x4c121,
+    0x4c20e, 0x4c1cc, 0x4c059, 0x4c2e1, 0x4c2b4, 0x4bfaf, 0x4c3a5, 0x4c029,
+    0x4c249, 0x4c403, 0x4c3d3, 0x4c281, 0x4c225, 0x4c581, 0x4c464, 0x4c305,
+    0x4c327, 0x4c487, 0x4c385, 0x4c42e, 0x4c4a1, 0x4c66d, 0x4c525, 0x4c6a9,
+    0x4c68d, 0x4c541, 0x4c4f0, 0x4c368, 0x4c825, 0x4c2d3, 0x4c6cf, 0x4c8c9,
+    0x4c502, 0x4c905, 0x4c355, 0x4c645, 0x4c574, 0x4c5d3, 0x4c4d3, 0x4c7b2,
+    0x4c3f5, 0x4c725, 0x4c612, 0x4c741, 0x4c715, 0x4c865, 0x4c6f0, 0x4c769,
+    0x4c883, 0x4c7c5, 0x4c949, 0x4c7e5, 0x4c964, 0x4ca73, 0x4c8b2, 0x4ca08,
+    0x4c985, 0x4c807, 0x4cac1, 0x4c8ef, 0x4c9c4, 0x4cc49, 0x4cae1, 0x4c9ae,
+    0x4ca29, 0x4c9f4, 0x4ff17, 0x4cb29, 0x4cc68, 0x4cc8f, 0x0, 0x4cd61,
+    0x0, 0x4cb74, 0x4cbb2, 0x4cb8b, 0x4cd47, 0x4cbef, 0x4cbd3, 0x4cc0e,
+    0x4cc2c, 0x4cdb2, 0x4ccb0, 0x4ce23, 0x4cd88, 0x4cdd2, 0x4cf47, 0x4cde9,
+    0x4ce61, 0x4ce48, 0x4ce12, 0x4ce90, 0x4cf35, 0x1c00014, 0x4cea9, 0x4d012,
+    0x4d0e1, 0x4d069, 0x4cf81, 0x4d16f, 0x4d0c5, 0x4cf73, 0x4cecf, 0x4d08f,
+    0x4d112, 0x4d021, 0x4cee9, 0x4cfe4, 0x4d1ac, 0x4d194, 0x4d214, 0x4d0b4,
+    0x4d125, 0x4d253, 0x4d145, 0x4d1cf, 0x4d041, 0x4d1e1, 0x4d22c, 0x4d272,
+    0x4d28f, 0x4d2ed, 0x4d2a5, 0x4d2c4, 0x4d321, 0x4d34f, 0x4d3af, 0x4d401,
+    0x4d468, 0x4d445, 0x4d374, 0x4d425, 0x4d394, 0x4d3c5, 0x4d31a, 0x4d584,
+    0x4d7b2, 0x4d4b0, 0x4d5e5, 0x4d508, 0x4d785, 0x4d493, 0x1c00005, 0x4d5c5,
+    0x4d64f, 0x4d8a5, 0x4d6f5, 0x4cfc8, 0x4d830, 0x4d572, 0x4d613, 0x4d634,
+    0x4d841, 0x4d673, 0x4d74c, 0x4d7e1, 0x4d885, 0x4d875, 0x4d8cc, 0x4d990,
+    0x4d6d3, 0x4d7c3, 0x4d90e, 0x4d94b, 0x4d765, 0x4d9b4, 0x4d925, 0x4d8ee,
+    0x4d9d2, 0x4d969, 0x4da24, 0x4da8e, 0x4da69, 0x4da52, 0x4da0c, 0x4dac5,
+    0x4daf4, 0x4db21, 0x4db47, 0x4daaf, 0x310000c, 0x4dba4, 0x4db69, 0x4d9f5,
+    0x4db8c, 0x4db14, 0x4dbc5, 0x4dc48, 0x4dc05, 0x4dc2e, 0x4dbf0, 0x4dc90,
+    0x4dd03, 0x4de09, 0x4df21, 0x4ddd4, 0x4dc70, 0x4de69, 0x4ddf4, 0x4dd4e,
+    0x4df41, 0x4de4f, 0x4de34, 0x4de85, 0x4dfcd, 0x4df72, 0x4dd65, 0x4df85,
+    0x4dec8, 0x4e065, 0x4df01, 0x4dfb5, 0x4deb4, 0x4e0b2, 0x4e001, 0x4dff3,
+    0x4e045, 0x4e087, 0x4deef, 0x4e02e, 0x4e0e5, 0x4e0cb, 0x4e12f, 0x4e145,
+    0x4e172, 0x4e182, 0x310000e, 0x4e201, 0x4e112, 0x4e268, 0x4e1ae, 0x4e221,
+    0x4e24d, 0x4e2ac, 0x4e3e3, 0x4e1d5, 0x4e1f3, 0x4e368, 0x4e32b, 0x4e293,
+    0x4e2e7, 0x4e345, 0x4e309, 0x4e473, 0x4e2d7, 0x4e494, 0x4e3c5, 0x4e385,
+    0x4e3b4, 0x4e5ac, 0x4e4e2, 0x4e425, 0x4e534, 0x4e4a1, 0x4e4c7, 0x4e6ac,
+    0x5000012, 0x1b00000, 0x4e509, 0x4e754, 0x4e709, 0x4e5c5, 0x4e672, 0x4e415,
+    0x4e553, 0x4e565, 0x3000005, 0x4e6cc, 0x4e629, 0x4e765, 0x4e641, 0x4e612,
+    0x4e801, 0x4e8c8, 0x4e7f4, 0x4e908, 0x4e7c1, 0x4e785, 0x4e950, 0x4e923,
+    0x4e8a6, 0x1c00012, 0x4e829, 0x4e845, 0x4d805, 0x4e9b3, 0x4eba9, 0x4e7a7,
+    0x4ea25, 0x4ea13, 0x0, 0x4e989, 0x4e9cc, 0x4e8e8, 0x4ea7a, 0x4eaa8,
+    0x4e96f, 0x4e9ef, 0x4e88e, 0x4eb08, 0x4eb2c, 0x4ea45, 0x4eb48, 0x4ea85,
+    0x4ebe1, 0x4ead3, 0x4ec06, 0x4eca8, 0x4eaf3, 0x4ebd3, 0x4eb81, 0x4eb73,
+    0x4ece5, 0x4ec43, 0x4ec69, 0x4ecc9, 0x4ed01, 0x4ec28, 0x4ed79, 0x3b80002,
+    0x4ed2e, 0x4ed93, 0x1280009, 0x340001a, 0x12ced41, 0x4ec94, 0x1b00005, 0x1280013,
+    0x900001, 0x90000f, 0x1b00013, 0x4edc1, 0x4edb4, 0x68000e, 0x310000e, 0x1c00007,
+    0x1b00016, 0x5000001, 0x1b00014, 0x1c00007, 0x1480012, 0x5080002, 0x1b0001a, 0x3100012,
+    0x1080003, 0x1080000, 0x1080000, 0x1080003, 0x1c00000, 0x4ee54, 0x1480013, 0x310000e,
+    0x680013, 0x4800006, 0x1b00001, 0x68000f, 0x1280005, 0x4ee63, 0x1080009, 0x1b00005,
+    0x3400013, 0x310001a, 0x4ee14, 0x1280000, 0x4edf3, 0x1b00016, 0x1b00001, 0x480000f,
+    0x1b00002, 0x3100013, 0x1b00001, 0x1b00001, 0x1c00005, 0x3000012, 0x180000, 0x180013,
+    0x1b00005, 0x4ee94, 0x1280000, 0x1280000, 0x3000005, 0x1280001, 0x1b0000e, 0x1b00001,
+    0x1b00001, 0x180000, 0x180005, 0x5000003, 0x90000f, 0x3100001, 0x310000e, 0x1080000,
+    0x4f014, 0x0, 0x4eea1, 0x1b00016, 0x4ee25, 0x1280013, 0x1280013, 0x1c00005,
+    0x4ef69, 0x310000e, 0x680003, 0x1c0001a, 0x3100012, 0x900000, 0x1080003, 0x1c00012,
+    0x4800001, 0x1480013, 0x3100012, 0x4ef0e, 0x4ef4e, 0x3000012, 0x1280000, 0x108000f,
+    0x180019, 0x180005, 0x18000c, 0x180009, 0x5100013, 0x1480019, 0x1c00012, 0x1080005,
+    0x1b00016, 0x4f029, 0x1080001, 0x900013, 0x1480000, 0x1480001, 0x5000009, 0x3100012,
+    0x68000f, 0x900000, 0x4ef88, 0x310001a, 0x1080001, 0x4f06e, 0x180001, 0x4f0c5,
+    0x1c00009, 0x1080003, 0x1480000, 0x1b00005, 0x4100013, 0x900019, 0x1c00002, 0x1480013,
+    0x1c00000, 0x1b00014, 0x4f0b4, 0x4800001, 0x148000d, 0x1b00000, 0x4eec9, 0x4eee9,
+    0x900019, 0x4efa1, 0x4ef29, 0x1480014, 0x5180009, 0x680019, 0x4800001, 0x1b00000,
+    0x310000c, 0x1b00016, 0x4f04c, 0x4efc9, 0x0, 0x1b00005, 0x1080004, 0x310000e,
+    0x1b00019, 0x3100012, 0x90000f, 0x180007, 0x1b00005, 0x1b00000, 0x180009, 0x3000005,
+    0x4a00007, 0x900009, 0x1b00013, 0x4f1b2, 0x1c00009, 0x1c00005, 0x1b0001a, 0x680003,
+    0x1b0001a, 0x3100003, 0x310000c, 0x310000c, 0x1b00016, 0x1b0001a, 0x3100012, 0x148000c,
+    0x1080009, 0x1480004, 0x680010, 0x1b00000, 0x1b00000, 0x3100014, 0x1c0000e, 0x3100002,
+    0x148000e, 0x4f154, 0x510000e, 0x1c0000c, 0x1b0000c, 0x3100014, 0x4f1d0, 0x900014,
+    0x680009, 0x3280000, 0x1c00003, 0x900000, 0x1c00000, 0x1280000, 0x1c00015, 0x1c00005,
+    0x1c00012, 0x4800001, 0x1080003, 0x1b00013, 0x4a0000c, 0x5100004, 0x5100008, 0x1080015,
+    0x1480013, 0x1c00013, 0x1480007, 0x4800009, 0x1b00013, 0x1b00014, 0x4efe9, 0x1c00013,
+    0x3100001, 0x1080003, 0x3100005, 0x4f223, 0x1480009, 0x310000e, 0x3000005, 0x1080001,
+    0x1080014, 0x90001a, 0x3100014, 0x1480000, 0x1b00014, 0x3000014, 0x1c00005, 0x1c00013,
+    0x1c0001a, 0x1c0000e, 0x680000, 0x1480003, 0x4f287, 0x4800001, 0x5200013, 0x1c00004,
+    0x1c00014, 0x5000014, 0x1b00005, 0x4f254, 0x1c0001a, 0x1c00003, 0x1c00005, 0x4a0000e,
+    0x4f121, 0x4f2b9, 0x4f2e1, 0x4f314, 0x310000e, 0x4f161, 0x68000f, 0x500000f,
+    0x310000c, 0x4f36e, 0x4f26d, 0x0, 0x4f34c, 0x4f3af, 0x4f38c, 0x0,
+    0x4f448, 0x4f7c2, 0x0, 0x4f330, 0x4f42e, 0x4f465, 0x4f505, 0x4f4b2,
+    0x4f2d1, 0x4f927, 0x4f4cc, 0x4f585, 0x4f0f2, 0x4f4f4, 0x4f493, 0x4f3e5,
+    0x4f5c4, 0x4f414, 0x4f54f, 0x4f56f, 0x4f5ef, 0x4f3d9, 0x4f60f, 0x4f74e,
+    0x4f68d, 0x4f5b5, 0x4f768, 0x4f6d0, 0x4f634, 0x4f84e, 0x4f889, 0x4f965,
+    0x4f793, 0x4f6f6, 0x4f6b2, 0x4f66f, 0x4f70c, 0x4f874, 0x4f72e, 0x4f7b4,
+    0x4f8c1, 0x4f830, 0x4f801, 0x4f90f, 0x4fa15, 0x4f9e5, 0x4f8e4, 0x4f9a3,
+    0x4f9c5, 0x4f955, 0x4fb15, 0x4facd, 0x4fb63, 0x4fa25, 0x4fa69, 0x4f8af,
+    0x4fa89, 0x4fb53, 0x4fa47, 0x4fc24, 0x4f98e, 0x4fb89, 0x5280000, 0x4fd06,
+    0x0, 0x4faa9, 0x4fc02, 0x4fd44, 0x4fc52, 0x4fc6f, 0x4fbe1, 0x4fd25,
+    0x4fcf3, 0x4fd65, 0x4fbcf, 0x4fd85, 0x4fca5, 0x4fbb3, 0x4fdc5, 0x4fe41,
+    0x4fcd4, 0x4fe10, 0x4fea5, 0x0, 0x4fe6c, 0x4fdb2, 0x4fc99, 0x500e5,
+    0x4fe8e, 0x4fe29, 0x4fec9, 0x50108, 0x501a4, 0x501c1, 0x500d2, 0x50048,
+    0x50015, 0x50152, 0x4fef3, 0x500ae, 0x50121, 0x4ff8f, 0x501f2, 0x50208,
+    0x50242, 0x50268, 0x5028f, 0x50172, 0x504a7, 0x502a6, 0x50194, 0x50225,
+    0x502d2, 0x4ffe5, 0x50352, 0x5036b, 0x50385, 0x50025, 0x5000009, 0x503b3,
+    0x5032f, 0x503c5, 0x4fde5, 0x502ef, 0x50314, 0x5048f, 0x50505, 0x50469,
+    0x50583, 0x5280000, 0x505a2, 0x50672, 0x505d2, 0x5054e, 0x5056e, 0x506d4,
+    0x5052e, 0x5060e, 0x504c5, 0x50681, 0x50729, 0x506e9, 0x5040e, 0x50761,
+    0x505f2, 0x50632, 0x50789, 0x50749, 0x50652, 0x507c5, 0x50710, 0x506b0,
+    0x507a7, 0x507e3, 0x3100012, 0x50864, 0x508a8, 0x5080b, 0x508cf, 0x50826,
+    0x5094d, 0x50889, 0x50988, 0x5044f, 0x508e9, 0x509e1, 0x50a21, 0x514a8,
+    0x509ac, 0x50853, 0x509c1, 0x50976, 0x50937, 0x5090f, 0x50a0c, 0x50aaf,
+    0x50a49, 0x50ad4, 0x50ae5, 0x50b12, 0x50b2e, 0x5280000, 0x50a83, 0x50b94,
+    0x50a61, 0x50b4f, 0x50bb2, 0x530000f, 0x50c01, 0x50bc5, 0x5280000, 0x50b74,
+    0x50d12, 0x50be1, 0x50c53, 0x50cd3, 0x50c65, 0x50d81, 0x50ca5, 0x50c85,
+    0x50cf2, 0x50d29, 0x50dc4, 0x5280000, 0x50c25, 0x50d63, 0x50d49, 0x50e0c,
+    0x50db3, 0x50ec3, 0x5280000, 0x5280000, 0x50ea3, 0x510f9, 0x0, 0x50f4e,
+    0x50e70, 0x50eed, 0x50f61, 0x0, 0x50e2f, 0x0, 0x510a3, 0x51143,
+    0x51209, 0x50e92, 0x50e58, 0x50f13, 0x50df6, 0x50f30, 0x50ff0, 0x50fb3,
+    0x51090, 0x5102f, 0x511e5, 0x51061, 0x51269, 0x5280000, 0x5136e, 0x510c5,
+    0x512a9, 0x51134, 0x51245, 0x5118f, 0x51293, 0x511c1, 0x51169, 0x5130e,
+    0x51323, 0x512e9, 0x512cf, 0x51385, 0x51401, 0x513ac, 0x513cc, 0x51593,
+    0x51353, 0x51444, 0x514ef, 0x51564, 0x513e8, 0x51524, 0x5150c, 0x51545,
+    0x51e79, 0x3100012, 0x0, 0x51492, 0x514d4, 0x515cf, 0x516c9, 0x515e5,
+    0x51769, 0x51425, 0x518e1, 0x515b3, 0x518a9, 0x51885, 0x51e27, 0x51614,
+    0x51714, 0x516b3, 0x516f4, 0x51672, 0x51754, 0x5162f, 0x51659, 0x5168c,
+    0x51833, 0x5184f, 0x5190e, 0x51796, 0x517c9, 0x519ad, 0x51861, 0x51812,
+    0x518cc, 0x50093, 0x5196c, 0x5380000, 0x519e9, 0x50074, 0x51941, 0x51a50,
+    0x517b5, 0x5192f, 0x51a2e, 0x51a05, 0x517ef, 0x519d4, 0x51a8e, 0x51991,
+    0x51ae5, 0x51ab0, 0x51c08, 0x51b0c, 0x51a75, 0x51ad4, 0x51b28, 0x51b53,
+    0x51ba9, 0x51c50, 0x51d05, 0x5280000, 0x51c74, 0x51bd0, 0x51b85, 0x51b61,
+    0x51d89, 0x51dc5, 0x51caf, 0x51c8d, 0x51eb2, 0x51de8, 0x51ee4, 0x51cd3,
+    0x5280000, 0x51c33, 0x51da5, 0x533ba, 0x51e14, 0x51f4e, 0x51f88, 0x51f6c,
+    0x51e45, 0x51ec5, 0x51f09, 0x51fd3, 0x51fa1, 0x522a1, 0x51ff2, 0x5208d,
+    0x5200f, 0x51d69, 0x51e8f, 0x52029, 0x51f35, 0x52065, 0x52790, 0x520c4,
+    0x52053, 0x520ec, 0x52167, 0x520b2, 0x521b5, 0x521ec, 0x52149, 0x52125,
+    0x523b2, 0x522ef, 0x52245, 0x5220f, 0x52283, 0x5218f, 0x52237, 0x523c9,
+    0x524e3, 0x521d6, 0x52112, 0x522d4, 0x52453, 0x5240e, 0x52272, 0x524d4,
+    0x52663, 0x524ae, 0x52484, 0x52433, 0x52312, 0x5252f, 0x525ae, 0x52465,
+    0x526ae, 0x52583, 0x52393, 0x52557, 0x52710, 0x52614, 0x523f3, 0x5250f,
+    0x525f4, 0x52686, 0x52573, 0x525d2, 0x52721, 0x52768, 0x526f3, 0x527c7,
+    0x52753, 0x527a4, 0x52634, 0x526d7, 0x5280000, 0x527ef, 0x52888, 0x5284e,
+    0x52823, 0x528c9, 0x52813, 0x5280000, 0x5380000, 0x52905, 0x52874, 0x52a0c,
+    0x528f4, 0x52932, 0x52941, 0x52965, 0x529ce, 0x528a1, 0x529a3, 0x52a4e,
+    0x52a76, 0x52aaf, 0x52a23, 0x52b01, 0x52b4d, 0x5356d, 0x52a8c, 0x52ac3,
+    0x52bb3, 0x529e1, 0x52ae9, 0x52b81, 0x52bcf, 0x52b2f, 0x52be8, 0x52b6f,
+    0x52c81, 0x52d24, 0x5380000, 0x52dec, 0x0, 0x52c10, 0x52f45, 0x52c54,
+    0x52c2d, 0x52cee, 0x52d85, 0x52da6, 0x52cd0, 0x52e74, 0x52ec7, 0x52e8c,
+    0x52dc7, 0x52ea1, 0x52f12, 0x52fa9, 0x52caf, 0x52ef7, 0x52f81, 0x53093,
+    0x52d53, 0x52fce, 0x5302c, 0x52e59, 0x530c3, 0x52e17, 0x5314c, 0x53008,
+    0x53224, 0x52ff5, 0x5316e, 0x52f33, 0x530a5, 0x53048, 0x53270, 0x5312f,
+    0x53317, 0x53109, 0x53074, 0x53189, 0x530ef, 0x531af, 0x53366, 0x532c9,
+    0x532e9, 0x53390, 0x53325, 0x53209, 0x534e4, 0x53341, 0x532a5, 0x53533,
+    0x53250, 0x53514, 0x531f7, 0x533c9, 0x534c7, 0x531d5, 0x53405, 0x53554,
+    0x535a5, 0x533e9, 0x53445, 0x534b5, 0x53608, 0x53583, 0x535cf, 0x53629,
+    0x53425, 0x535ef, 0x53677, 0x53742, 0x536e1, 0x53689, 0x52c69, 0x53701,
+    0x536cf, 0x53652, 0x53725, 0x53801, 0x536b4, 0x53785, 0x537ce, 0x537f0,
+    0x53832, 0x538a6, 0x538c4, 0x53923, 0x53941, 0x5388e, 0x53854, 0x53873,
+    0x539a9, 0x5390b, 0x53965, 0x5348f, 0x538ee, 0x539c9, 0x53775, 0x5398e,
+    0x53a48, 0x539f4, 0x53a69, 0x53a0d, 0x53ab2, 0x53b45, 0x53a2f, 0x53a8c,
+    0x53c07, 0x53b61, 0x53b27, 0x53ccc, 0x53acc, 0x53be5, 0x53c34, 0x53bd3,
+    0x53d89, 0x53b09, 0x53c4c, 0x53d2d, 0x53e04, 0x53b96, 0x53dec, 0x53aef,
+    0x53cb3, 0x53e4d, 0x53d48, 0x53d67, 0x53eb3, 0x53eec, 0x53bae, 0x53e69,
+    0x53fe8, 0x53f02, 0x53daf, 0x53ecf, 0x53e34, 0x53e88, 0x53f21, 0x53f41,
+    0x5404e, 0x53f61, 0x5406e, 0x53fd2, 0x540c1, 0x53fa1, 0x5402e, 0x5380000,
+    0x5422c, 0x54123, 0x54014, 0x54212, 0x54094, 0x54293, 0x54162, 0x53f88,
+    0x541b5, 0x542f2, 0x541cd, 0x540af, 0x54341, 0x54274, 0x54242, 0x54361,
+    0x54183, 0x542c9, 0x541f3, 0x542b2, 0x54312, 0x54119, 0x54421, 0x543ef,
+    0x5438e, 0x54339, 0x54414, 0x543ac, 0x543d9, 0x54444, 0x544e1, 0x5452e,
+    0x54542, 0x544ae, 0x544d2, 0x54483, 0x54152, 0x54509, 0x546d3, 0x545cc,
+    0x546a1, 0x54573, 0x54613, 0x5468c, 0x54473, 0x54845, 0x548e3, 0x54869,
+    0x547ae, 0x548d9, 0x5488f, 0x54594, 0x545f2, 0x547e7, 0x54761, 0x549b3,
+    0x54925, 0x549d4, 0x549eb, 0x54833, 0x54ac1, 0x54974, 0x54909, 0x4f7e5,
+    0x54659, 0x54beb, 0x54788, 0x54a27, 0x54b13, 0x54c8e, 0x54b61, 0x54a4f,
+    0x54caf, 0x54b35, 0x54815, 0x54d25, 0x54ab2, 0x54953, 0x54a14, 0x54b92,
+    0x54c2e, 0x54cce, 0x545a9, 0x54dcf, 0x54de3, 0x54e0d, 0x54d6c, 0x54d45,
+    0x54dac, 0x54c41, 0x54c13, 0x54cee, 0x54c69, 0x54d02, 0x5400000, 0x1c00014,
+    0x54eb2, 0x54d82, 0x54e26, 0x54f54, 0x54f90, 0x54f25, 0x54f63, 0x54e6e,
+    0x5400000, 0x54e85, 0x54fa5, 0x550d4, 0x54ecf, 0x55023, 0x550b4, 0x55559,
+    0x54eee, 0x54fe9, 0x0, 0x54fd2, 0x5506e, 0x550ec, 0x54f0b, 0x55110,
+    0x5504c, 0x551e4, 0x552c2, 0x55093, 0x551cd, 0x55249, 0x5522c, 0x5516f,
+    0x55153, 0x55017, 0x552a9, 0x55135, 0x55269, 0x55288, 0x537b5, 0x551b4,
+    0x55392, 0x55425, 0x55192, 0x55212, 0x553a9, 0x552e9, 0x55334, 0x5536f,
+    0x55314, 0x553e9, 0x554e9, 0x5548b, 0x5540d, 0x55441, 0x554b0, 0x5534d,
+    0x55469, 0x5380000, 0x554c5, 0x55609, 0x55502, 0x555e1, 0x55727, 0x55534,
+    0x556e5, 0x55584, 0x55674, 0x555a5, 0x5280000, 0x55697, 0x555d3, 0x556a5,
+    0x55712, 0x55789, 0x55885, 0x557a5, 0x553d3, 0x556c5, 0x5574f, 0x56817,
+    0x0, 0x55769, 0x5564f, 0x558c7, 0x558b3, 0x5562e, 0x55941, 0x557ec,
+    0x557c9, 0x5586f, 0x55828, 0x55a21, 0x5590c, 0x55854, 0x558ed, 0x559b2,
+    0x55b27, 0x55993, 0x55973, 0x559cc, 0x55bc8, 0x55a8f, 0x55933, 0x55b41,
+    0x55a54, 0x55c67, 0x55ba3, 0x55a73, 0x55c84, 0x55810, 0x55d04, 0x55c54,
+    0x55d27, 0x55cc6, 0x55cb2, 0x55ce2, 0x55d42, 0x55d92, 0x559f3, 0x55d64,
+    0x55da5, 0x55dcd, 0x55e05, 0x5400000, 0x55e6f, 0x55de9, 0x55e81, 0x55e29,
+    0x55e52, 0x0, 0x55ec9, 0x0, 0x55f34, 0x55eb6, 0x0, 0x55f49,
+    0x560e5, 0x56145, 0x55fc2, 0x55bf4, 0x55f72, 0x55ef5, 0x55f12, 0x55f8f,
+    0x56045, 0x560d2, 0x55fe5, 0x56132, 0x5610f, 0x55fb3, 0x5600d, 0x56169,
+    0x56065, 0x5618f, 0x56089, 0x56274, 0x56236, 0x563a1, 0x56343, 0x563e8,
+    0x56441, 0x56332, 0x561c7, 0x561b3, 0x55c0f, 0x56373, 0x5625a, 0x56313,
+    0x561f2, 0x560a8, 0x56285, 0x56410, 0x4800014, 0x5380000, 0x5642e, 0x56392,
+    0x56512, 0x563d6, 0x564f9, 0x56541, 0x56469, 0x56485, 0x565b4, 0x5658e,
+    0x565f2, 0x56576, 0x5652c, 0x56673, 0x56609, 0x564b3, 0x5280000, 0x566c8,
+    0x5280000, 0x56629, 0x566ec, 0x565c1, 0x56650, 0x56829, 0x56725, 0x5668e,
+    0x566a3, 0x5670c, 0x56795, 0x56765, 0x567d2, 0x56753, 0x568c7, 0x567ab,
+    0x56845, 0x567ee, 0x56865, 0x56894, 0x56963, 0x55c25, 0x568e1, 0x56985,
+    0x0, 0x56a03, 0x569ce, 0x56932, 0x568b4, 0x569b3, 0x56910, 0x56950,
+    0x56a23, 0x56b49, 0x56b68, 0x56bb0, 0x56ce8, 0x56d24, 0x56a72, 0x56c63,
+    0x56a4f, 0x56ad2, 0x900005, 0x0, 0x56c01, 0x3400005, 0x56d0e, 0x56bd4,
+    0x56c92, 0x56a92, 0x56b8f, 0x56be9, 0x1b00012, 0x56c29, 0x1080003, 0x1b00007,
+    0x4800012, 0x1b00007, 0x1b00013, 0x900012, 0x1c00003, 0x56aa9, 0x1b00000, 0x5000012,
+    0x1b00005, 0x56ae9, 0x3100005, 0x4800009, 0x1080013, 0x1c00016, 0x5000001, 0x1c00005,
+    0x310001a, 0x1b00014, 0x1080001, 0x1c00005, 0x1c00000, 0x1080019, 0x5704f, 0x56ecc,
+    0x1b0001a, 0x108001a, 0x56f41, 0x56de9, 0x56dc9, 0x56db4, 0x56cc3, 0x56f65,
+    0x56e28, 0x56f85, 0x56eed, 0x56e8c, 0x56e0d, 0x56f24, 0x56fa1, 0x56fe5,
+    0x57021, 0x57085, 0x56f0d, 0x56fd5, 0x56eb9, 0x56e49, 0x571ef, 0x570e9,
+    0x57143, 0x570b3, 0x56e72, 0x57184, 0x571a4, 0x57012, 0x5712c, 0x57229,
+    0x5710d, 0x572a5, 0x570d2, 0x57265, 0x57365, 0x57201, 0x57429, 0x57079,
+    0x57249, 0x57307, 0x57176, 0x57481, 0x57321, 0x572e1, 0x57593, 0x5746f,
+    0x573ef, 0x57568, 0x571d9, 0x5480000, 0x5740f, 0x57452, 0x57665, 0x57761,
+    0x5c6d1, 0x572cf, 0x5768c, 0x574b5, 0x576b4, 0x5750d, 0x57527, 0x576cd,
+    0x575e5, 0x577a7, 0x575d5, 0x57625, 0x57555, 0x577e3, 0x57653, 0x57792,
+    0x575b0, 0x57755, 0x577ce, 0x578eb, 0x578d3, 0x578a4, 0x5796b, 0x5500000,
+    0x57986, 0x57834, 0x57807, 0x5770f, 0x57a2c, 0x57865, 0x57a48, 0x57890,
+    0x5480000, 0x579d4, 0x579f4, 0x579a9, 0x5480000, 0x57f06, 0x57a69, 0x57b81,
+    0x57934, 0x57bd4, 0x57a8c, 0x57b32, 0x57913, 0x57b52, 0x57953, 0x57b73,
+    0x57bae, 0x57c49, 0x57bef, 0x57b13, 0x57af3, 0x57aa5, 0x5480000, 0x5480000,
+    0x57c13, 0x57c21, 0x5500000, 0x57d74, 0x57d87, 0x5500000, 0x57d52, 0x5580000,
+    0x57cc2, 0x57c6f, 0x57e53, 0x57f28, 0x57f93, 0x57ce5, 0x57e0d, 0x57ec5,
+    0x57e65, 0x57d13, 0x57d33, 0x59677, 0x596b9, 0x57ee9, 0x57dd2, 0x57ca5,
+    0x57f48, 0x57dec, 0x57db3, 0x57e32, 0x57ea9, 0x5500000, 0x57fad, 0x58043,
+    0x57f72, 0x58021, 0x58067, 0x57e94, 0x5600000, 0x580c4, 0x58012, 0x58125,
+    0x58105, 0x57ff4, 0x57fd4, 0x581d3, 0x58141, 0x58165, 0x58189, 0x58281,
+    0x58516, 0x581b3, 0x582a9, 0x58202, 0x582cd, 0x581ef, 0x58347, 0x580b3,
+    0x58401, 0x58367, 0x583c5, 0x0, 0x5838f, 0x582e5, 0x58421, 0x58335,
+    0x58314, 0x5826e, 0x58548, 0x583b3, 0x58229, 0x58447, 0x585a5, 0x583f3,
+    0x584af, 0x58473, 0x5848e, 0x58089, 0x584c9, 0x5856e, 0x58606, 0x58521,
+    0x58623, 0x58781, 0x58681, 0x585d3, 0x5864f, 0x587e1, 0x586a1, 0x0,
+    0x58772, 0x585f5, 0x58593, 0x586e3, 0x5872d, 0x58674, 0x586d4, 0x58754,
+    0x587b4, 0x58801, 0x58948, 0x58822, 0x58712, 0x58872, 0x588c9, 0x588e1,
+    0x58b21, 0x587d3, 0x5896c, 0x589c7, 0x588b5, 0x58a94, 0x58893, 0x58853,
+    0x58994, 0x58a09, 0x589f3, 0x58b89, 0x58ba9, 0x58b13, 0x58b44, 0x58a74,
+    0x58be9, 0x58b74, 0x58c0c, 0x58bcf, 0x58c2f, 0x58d28, 0x58a55, 0x58c48,
+    0x58cc4, 0x58af9, 0x58de5, 0x58cb2, 0x58d14, 0x58c92, 0x58ced, 0x5480000,
+    0x58d4d, 0x58d61, 0x58e68, 0x58eec, 0x58e2e, 0x58e42, 0x58fa4, 0x58e14,
+    0x58d8f, 0x58f0e, 0x5500000, 0x58ea6, 0x58da1, 0x58e89, 0x58f92, 0x59067,
+    0x58dd2, 0x58f68, 0x58f42, 0x59141, 0x58f2e, 0x58fee, 0x59021, 0x59009,
+    0x58ecc, 0x5908c, 0x59203, 0x591e9, 0x59241, 0x59229, 0x59128, 0x59261,
+    0x592c4, 0x590c9, 0x5480000, 0x593f2, 0x590f5, 0x5928c, 0x591a9, 0x5916f,
+    0x592ee, 0x59369, 0x59113, 0x59185, 0x592a1, 0x593a5, 0x59429, 0x59305,
+    0x59449, 0x59490, 0x5932f, 0x59394, 0x59403, 0x594c9, 0x59524, 0x59473,
+    0x5480000, 0x59549, 0x595c5, 0x5960e, 0x593d2, 0x594af, 0x594e1, 0x595e9,
+    0x59625, 0x5968e, 0x595ae, 0x59741, 0x59575, 0x596c6, 0x59721, 0x5976e,
+    0x597a7, 0x59652, 0x5600000, 0x59513, 0x0, 0x5970f, 0x598a5, 0x5982b,
+    0x59983, 0x59795, 0x597d2, 0x597f9, 0x5984d, 0x596f6, 0x59873, 0x598cf,
+    0x59812, 0x59889, 0x598e8, 0x59923, 0x59909, 0x5994f, 0x59a32, 0x599d4,
+    0x59964, 0x599a3, 0x599ed, 0x59a0f, 0x59a45, 0x59a94, 0x59a61, 0x5480000,
+    0x59ae8, 0x59b4c, 0x59b14, 0x59aa1, 0x59b21, 0x59bc1, 0x5500000, 0x59df4,
+    0x59b61, 0x59b8e, 0x59c09, 0x59bf2, 0x59c32, 0x59ce1, 0x59c72, 0x0,
+    0x0, 0x59bb3, 0x59ad3, 0x59d8e, 0x59d21, 0x59c4d, 0x59cc9, 0x59d09,
+    0x59e83, 0x59e0e, 0x59c9a, 0x59e2c, 0x59f25, 0x59db4, 0x59cb4, 0x59e69,
+    0x59d49, 0x59dcf, 0x59fc3, 0x59eb2, 0x59f10, 0x59f6d, 0x59e41, 0x5a0a1,
+    0x5600000, 0x5a079, 0x5480000, 0x5a0ee, 0x59f53, 0x5a033, 0x59ff2, 0x5a08f,
+    0x5a055, 0x5a0d3, 0x5a169, 0x5a1a5, 0x5a1c7, 0x5a1e4, 0x5a261, 0x5a125,
+    0x5a254, 0x5a281, 0x5a20b, 0x5a2b4, 0x5a101, 0x5680000, 0x5a352, 0x5a334,
+    0x5a310, 0x5a3e1, 0x5a466, 0x5a3c5, 0x5a483, 0x5a421, 0x5a2c9, 0x5a3b4,
+    0x5a409, 0x5a373, 0x5480000, 0x5a392, 0x5a449, 0x5a159, 0x5a4a9, 0x5a541,
+    0x5a239, 0x5a645, 0x5a509, 0x5a563, 0x5a4ed, 0x5a4d3, 0x5a2f9, 0x5a688,
+    0x5a532, 0x5a5a1, 0x5a604, 0x5a741, 0x5a634, 0x5a592, 0x5a6cc, 0x5a7e2,
+    0x5a5cf, 0x5a668, 0x5a715, 0x5a6a1, 0x5a789, 0x5500000, 0x5a5f3, 0x5a732,
+    0x5a8ac, 0x5a869, 0x5a904, 0x5aa21, 0x5a7d5, 0x5a8ec, 0x5a922, 0x5b304,
+    0x5a8d2, 0x5580000, 0x5a94e, 0x5a854, 0x5aae5, 0x5a832, 0x5a80f, 0x5aa43,
+    0x5a981, 0x5a9d0, 0x5a969, 0x5a773, 0x5a9a5, 0x5aa0f, 0x5ab49, 0x5aa72,
+    0x5aaa5, 0x5ab2f, 0x5a88e, 0x5ac45, 0x5ac85, 0x5a9e9, 0x5aa94, 0x5ab0d,
+    0x5ac72, 0x5ac09, 0x5abc5, 0x5abf3, 0x5600000, 0x5ab90, 0x5aec1, 0x5ad49,
+    0x5ab6f, 0x5ac2d, 0x5aca9, 0x5adac, 0x5ad92, 0x5abb3, 0x5acc8, 0x5ace5,
+    0x5ad25, 0x5480000, 0x5ad12, 0x5ad6c, 0x5aea1, 0x5adf2, 0x5add4, 0x5ae8e,
+    0x5480000, 0x5afe3, 0x5b02d, 0x5ae53, 0x5b041, 0x5b0c1, 0x5afac, 0x5ae6c,
+    0x5ae34, 0x5b073, 0x5b1b3, 0x5afcc, 0x5b134, 0x5b0ec, 0x5b189, 0x5480000,
+    0x5480000, 0x5af94, 0x5b150, 0x5b105, 0x5b163, 0x5600000, 0x5af69, 0x5b1c5,
+    0x5b085, 0x5b0b3, 0x5b232, 0x5b1f4, 0x5b292, 0x5b245, 0x5b335, 0x5b2c6,
+    0x5b2ec, 0x5b5b5, 0x5b403, 0x5b26d, 0x5b389, 0x5b348, 0x5b20f, 0x5b3a5,
+    0x5b424, 0x5b2af, 0x5b3ce, 0x5b525, 0x5b584, 0x5b46c, 0x5b485, 0x5b604,
+    0x5b644, 0x5700000, 0x5b3f4, 0x5b546, 0x5b374, 0x5b4c5, 0x5b44f, 0x5b6b4,
+    0x5b4e9, 0x5b4af, 0x5b565, 0x5b747, 0x5b805, 0x5b5cf, 0x5b721, 0x5d1fa,
+    0x5b66e, 0x0, 0x5b767, 0x5b825, 0x5b68e, 0x5b8ac, 0x5b633, 0x5b7af,
+    0x5b78d, 0x5b947, 0x5b7c7, 0x5b8c4, 0x5b92c, 0x5b8e5, 0x5bac8, 0x5b6d5,
+    0x5b96f, 0x5b715, 0x5ba49, 0x5b985, 0x5b875, 0x5b9c1, 0x5ba25, 0x5ba13,
+    0x5ba81, 0x5bb54, 0x5bab0, 0x5b914, 0x5bb6f, 0x5bae5, 0x5bb25, 0x5bbc5,
+    0x5bbe1, 0x5bb8f, 0x5bb19, 0x5bc69, 0x5bc46, 0x5bcd2, 0x5bba9, 0x5bd32,
+    0x5bc21, 0x5bdae, 0x5580000, 0x5bcef, 0x5bcac, 0x5be87, 0x5bf65, 0x5bd04,
+    0x5bd4e, 0x5bd63, 0x5beed, 0x5becf, 0x5bc88, 0x5be72, 0x5bdf5, 0x5480000,
+    0x5bf82, 0x5bf21, 0x5be41, 0x5bf0e, 0x5480000, 0x5beb3, 0x5bfce, 0x5c02c,
+    0x5c001, 0x5be39, 0x5bf4d, 0x5c052, 0x5c129, 0x5c1c3, 0x5c14c, 0x5c1a4,
+    0x5c1f4, 0x5c0a9, 0x5c203, 0x5c2f9, 0x5c08e, 0x5c185, 0x5c0c9, 0x5c261,
+    0x5c233, 0x0, 0x5c345, 0x0, 0x0, 0x5c294, 0x5c170, 0x5cbc2,
+    0x5c2d4, 0x5c370, 0x5c329, 0x5c309, 0x5c0ed, 0x5c4c1, 0x5c393, 0x5c255,
+    0x5c474, 0x5c2a3, 0x5c52c, 0x5c4a5, 0x5c487, 0x5c3b5, 0x5c44c, 0x5c554,
+    0x5c6a3, 0x5500000, 0x5c419, 0x5c673, 0x5c515, 0x5c4f9, 0x5c6e4, 0x5c721,
+    0x5c584, 0x5c3d3, 0x5c686, 0x5c5a7, 0x5c705, 0x5480000, 0x5c5ef, 0x5c794,
+    0x5c8b0, 0x5c76e, 0x5c56e, 0x5c745, 0x5c8ec, 0x5c7d9, 0x5c961, 0x5c82d,
+    0x5c7b0, 0x5ca23, 0x5c7e5, 0x5c637, 0x5c893, 0x5c812, 0x5ca54, 0x5c8cf,
+    0x5cb68, 0x5c9f2, 0x5c992, 0x5cb32, 0x5ca65, 0x5000001, 0x5cbad, 0x5c955,
+    0x5cbe3, 0x5cb4e, 0x5c909, 0x5cc0f, 0x5ca83, 0x5cb07, 0x5600000, 0x5cca5,
+    0x5caa1, 0x5cae1, 0x5cc65, 0x5cd73, 0x5cc29, 0x5cd33, 0x5cc81, 0x5cd14,
+    0x5cdcc, 0x5600000, 0x5ccc9, 0x5ce54, 0x5600000, 0x5cc55, 0x5cee1, 0x5cea5,
+    0x5cce5, 0x5ce6e, 0x5cfa3, 0x5cd4f, 0x5600000, 0x5d007, 0x5cfd0, 0x5cfe1,
+    0x5cf05, 0x5cf41, 0x5d0d2, 0x5d054, 0x5cdf0, 0x5d02c, 0x5cf29, 0x5cecf,
+    0x5cf69, 0x5d06f, 0x5d088, 0x5d0e5, 0x5d1a3, 0x5d0ac, 0x5d109, 0x5d2a1,
+    0x5d129, 0x5d184, 0x5d1c1, 0x5d150, 0x5580000, 0x5d245, 0x5480000, 0x5d4e5,
+    0x5ce0e, 0x5d2ce, 0x5d462, 0x5d20f, 0x5d334, 0x5d234, 0x5d17a, 0x5d306,
+    0x5cf8d, 0x5d352, 0x5d4c3, 0x5d3ce, 0x5d26d, 0x5d369, 0x5d4a9, 0x5d393,
+    0x5d2ee, 0x5d402, 0x5d3ac, 0x5d510, 0x5d52c, 0x5d489, 0x5d426, 0x5480000,
+    0x5d3e5, 0x5d5a1, 0x5d590, 0x5d552, 0x5d7cb, 0x5d449, 0x5d605, 0x5d5e3,
+    0x5d573, 0x5d62c, 0x5d6d4, 0x5d6a9, 0x5500000, 0x5480000, 0x5d709, 0x5d5d5,
+    0x5d812, 0x5d76e, 0x5d648, 0x5d665, 0x5d829, 0x5580000, 0x5d983, 0x5480000,
+    0x5d7e9, 0x5d869, 0x5dbb2, 0x5da45, 0x5d8d6, 0x5d854, 0x5d8ac, 0x5d793,
+    0x5d8f9, 0x5d92d, 0x5d9c8, 0x5d967, 0x5d890, 0x5d9b4, 0x5da05, 0x5da21,
+    0x5d913, 0x5da87, 0x5d957, 0x5d7b7, 0x5d9f3, 0x5dae8, 0x5dab3, 0x5db25,
+    0x5da65, 0x5db05, 0x5db41, 0x5dac8, 0x5db86, 0x5db65, 0x5dc49, 0x5dd41,
+    0x5dbc5, 0x5de12, 0x5e152, 0x5dc6c, 0x5dc07, 0x5dd89, 0x5dc8c, 0x5e8b6,
+    0x5de48, 0x5dea1, 0x5dde5, 0x5dccc, 0x0, 0x5ddc9, 0x5de22, 0x5ddae,
+    0x5de8d, 0x5dd2f, 0x5d749, 0x5de6c, 0x5dee9, 0x5dcf9, 0x5580000, 0x5480000,
+    0x5df2e, 0x5df13, 0x5dec1, 0x5e009, 0x5dfc4, 0x5e06e, 0x5e084, 0x5df64,
+    0x5dfb3, 0x5e0a5, 0x5e041, 0x5df55, 0x5e0c1, 0x5e035, 0x5e0f3, 0x5e105,
+    0x5e174, 0x5dff3, 0x5df81, 0x5500000, 0x5e12f, 0x5580000, 0x5e219, 0x5e185,
+    0x5e1b2, 0x5e1c1, 0x5e2d3, 0x5e1e5, 0x5e225, 0x5e2ed, 0x5e304, 0x5480000,
+    0x5e354, 0x5e2a1, 0x5e4a9, 0x5e26f, 0x5e498, 0x5e443, 0x5e421, 0x5500000,
+    0x5e567, 0x5e4ee, 0x5e50e, 0x5480000, 0x5e3e9, 0x5e549, 0x5500000, 0x5480000,
+    0x5e473, 0x5500000, 0x5e3b3, 0x5e6e7, 0x5e3cc, 0x5e688, 0x5580000, 0x5e5ee,
+    0x5e532, 0x5e581, 0x5e7e5, 0x5e38c, 0x5e5b2, 0x5e709, 0x5480000, 0x5e4cf,
+    0x5e787, 0x5480000, 0x5e7a5, 0x5e6a1, 0x0, 0x0, 0x5e754, 0x5e774,
+    0x5e72c, 0x5e5d2, 0x5e7d3, 0x5e888, 0x5e90d, 0x5e872, 0x5e8e9, 0x5e855,
+    0x5ea08, 0x5e833, 0x5e952, 0x5e921, 0x5e972, 0x5e990, 0x5ea61, 0x5e813,
+    0x5ea25, 0x5e9f3, 0x5e9af, 0x5ea52, 0x5e8d2, 0x5e9cf, 0x5eb08, 0x5500000,
+    0x5eb44, 0x5500000, 0x5eace, 0x5ea88, 0x5ebc4, 0x5eaf9, 0x90000f, 0x108001a,
+    0x1b0000f, 0x108001a, 0x1c00003, 0x5eaa5, 0x1b00014, 0x5780000, 0x5eb29, 0x5800000,
+    0x5eb64, 0x5eba9, 0x5eb94, 0x5880000, 0x5880000, 0x5ec43, 0x5ec65, 0x5ec09,
+    0x5ec2f, 0x5ec89, 0x5edef, 0x5780000, 0x5900000, 0x5ee73, 0x5ecc9, 0x5ed49,
+    0x5ed84, 0x0, 0x5ebf3, 0x5ecf2, 0x5edc5, 0x5ecae, 0x5ed2d, 0x5ee09,
+    0x5ed6e, 0x5ef09, 0x5ef4d, 0x5ef73, 0x5f083, 0x5f029, 0x5efcc, 0x5edb3,
+    0x5eeaf, 0x5f124, 0x5ef2f, 0x5980000, 0x5eecf, 0x5f0e5, 0x5f170, 0x5f20c,
+    0x5f18e, 0x5f019, 0x5f053, 0x5f2d3, 0x5f303, 0x5f073, 0x5f1c2, 0x5f32e,
+    0x5f372, 0x5f158, 0x5f387, 0x5f354, 0x5f3ad, 0x5f3ed, 0x5f253, 0x5f3c3,
+    0x5f265, 0x5f2af, 0x5a00000, 0x5a00000, 0x5f294, 0x5f401, 0x5f4c1, 0x5f2ef,
+    0x5f442, 0x5f474, 0x5f1f0, 0x5f552, 0x5f4ae, 0x5f4e1, 0x5f429, 0x5f584,
+    0x5f5a1, 0x5f6b4, 0x5f573, 0x5f525, 0x5f48f, 0x5f514, 0x5800000, 0x5a00000,
+    0x5f5ee, 0x5f64c, 0x5f605, 0x5a00000, 0x5980000, 0x5f5d5, 0x5a00000, 0x5a00000,
+    0x5f8a3, 0x5f748, 0x5f7d2, 0x5f76f, 0x5f833, 0x5f7b2, 0x5f885, 0x5f705,
+    0x5a00000, 0x5a80000, 0x5a80000, 0x5b00000, 0x5f954, 0x5800000, 0x5f974, 0x5f733,
+    0x5f8ec, 0x5f78e, 0x5f873, 0x5f7e5, 0x5fa4d, 0x5f923, 0x5f8c7, 0x5fab2,
+    0x5a00000, 0x5a00000, 0x5fa6e, 0x5800000, 0x5b00000, 0x5800000, 0x5fae4, 0x5f9c9,
+    0x5f9b3, 0x5fa0e, 0x5fb0c, 0x5fa92, 0x5fad4, 0x5fa25, 0x5fb4f, 0x5fb21,
+    0x5f9e5, 0x5980000, 0x5fbd5, 0x5fc04, 0x5fc41, 0x5fb6f, 0x5f98f, 0x5fc85,
+    0x5800000, 0x0, 0x5fca5, 0x5fc6e, 0x5fcc5, 0x5980000, 0x5fbb4, 0x5fcef,
+    0x5fbf4, 0x5fd21, 0x5fc39, 0x5fe29, 0x5fb93, 0x5ff61, 0x5a00000, 0x5fd69,
+    0x5fd14, 0x5fe4e, 0x5fd54, 0x5fe92, 0x5feb3, 0x5ff4c, 0x5ff22, 0x5ed01,
+    0x5ff0e, 0x5fdae, 0x5fec5, 0x5fe6c, 0x5ff83, 0x6022c, 0x6037a, 0x5fe09,
+    0x600d3, 0x5fde9, 0x5ffc8, 0x5800000, 0x5ffe9, 0x5ffb5, 0x5fee9, 0x60114,
+    0x60049, 0x60192, 0x6006e, 0x601e1, 0x6000e, 0x600e5, 0x60161, 0x6034b,
+    0x60425, 0x604c5, 0x602a1, 0x601d3, 0x602f2, 0x60294, 0x6030d, 0x60212,
+    0x60132, 0x60247, 0x6026c, 0x604e8, 0x6038c, 0x603ee, 0x603c2, 0x602c9,
+    0x605c5, 0x60462, 0x60409, 0x60509, 0x606c1, 0x0, 0x605a9, 0x6056f,
+    0x60454, 0x60534, 0x5800000, 0x60674, 0x606e7, 0x60701, 0x6072e, 0x5800000,
+    0x606a5, 0x60773, 0x60850, 0x608a5, 0x5800000, 0x60745, 0x60595, 0x5b80000,
+    0x60794, 0x607f2, 0x60694, 0x60863, 0x608e9, 0x60981, 0x609c1, 0x607c5,
+    0x60905, 0x60881, 0x60803, 0x607b3, 0x60825, 0x6094c, 0x609f4, 0x60933,
+    0x5800000, 0x5a00000, 0x60a05, 0x609ad, 0x60ba6, 0x60be9, 0x60a30, 0x5980000,
+    0x60bc9, 0x60a50, 0x608d3, 0x60aa9, 0x60a72, 0x60c85, 0x60ca5, 0x5800000,
+    0x60b01, 0x60cce, 0x60cee, 0x60ad3, 0x60d09, 0x5a80000, 0x60d2c, 0x60d47,
+    0x60d84, 0x60c14, 0x60c53, 0x5800000, 0x60e65, 0x60f01, 0x60eac, 0x60e39,
+    0x60d74, 0x60db4, 0x5780000, 0x60f23, 0x60e53, 0x60dd2, 0x60ece, 0x60e99,
+    0x60e01, 0x60ee1, 0x60fc9, 0x60b32, 0x60f62, 0x60f4e, 0x5800000, 0x60fa4,
+    0x60f87, 0x60df5, 0x61034, 0x61064, 0x6104f, 0x61009, 0x61163, 0x61193,
+    0x60ff5, 0x610a5, 0x610c5, 0x611ae, 0x611c3, 0x611e3, 0x612a3, 0x61209,
+    0x5a00000, 0x61270, 0x61232, 0x610e5, 0x6128d, 0x61129, 0x61245, 0x61385,
+    0x61322, 0x613e4, 0x612d2, 0x61103, 0x612e1, 0x6130e, 0x61544, 0x61443,
+    0x613b3, 0x61348, 0x6148b, 0x615c5, 0x613c5, 0x61563, 0x61433, 0x5800000,
+    0x61645, 0x614cc, 0x614a5, 0x5a00000, 0x0, 0x61509, 0x6158e, 0x615e9,
+    0x61662, 0x616c1, 0x61709, 0x614e9, 0x5c00000, 0x61761, 0x61415, 0x6152f,
+    0x6168c, 0x5800000, 0x61629, 0x616e5, 0x616af, 0x61721, 0x5a00000, 0x618a4,
+    0x6186b, 0x61612, 0x6184f, 0x617a1, 0x61805, 0x61945, 0x617f4, 0x61923,
+    0x61881, 0x5c00000, 0x61752, 0x5c80000, 0x61b44, 0x61981, 0x617d4, 0x6178f,
+    0x618d9, 0x61914, 0x618ec, 0x61970, 0x61833, 0x61b10, 0x619e7, 0x61b83,
+    0x61ba1, 0x61b2f, 0x61a45, 0x61c83, 0x61af3, 0x61b6c, 0x61a85, 0x619b2,
+    0x61a65, 0x5980000, 0x619d4, 0x61cb3, 0x61d4e, 0x61d69, 0x61a14, 0x61d81,
+    0x61bc5, 0x61d29, 0x61dcd, 0x5880000, 0x61d12, 0x61dab, 0x61e65, 0x5800000,
+    0x61ce9, 0x61c24, 0x61e88, 0x60c65, 0x61de1, 0x5a00000, 0x5800000, 0x61ecb,
+    0x61f07, 0x61e19, 0x5880000, 0x5b00000, 0x61e25, 0x61ee5, 0x61f62, 0x5d00000,
+    0x61fb0, 0x5800000, 0x61f25, 0x61f85, 0x61e49, 0x6212c, 0x620b4, 0x62005,
+    0x61eb3, 0x61f4e, 0x62045, 0x5800000, 0x62183, 0x62109, 0x5c80000, 0x62149,
+    0x62030, 0x61fd3, 0x621a1, 0x620f0, 0x61ff3, 0x6206e, 0x6216e, 0x621cb,
+    0x60c29, 0x5800000, 0x0, 0x62281, 0x5b00000, 0x3c025, 0x5f914, 0x62261,
+    0x6230e, 0x61c74, 0x6220f, 0x6234e, 0x620d4, 0x622c1, 0x62250, 0x62087,
+    0x622f9, 0x62335, 0x622a9, 0x62394, 0x62225, 0x5a00000, 0x6244c, 0x624e4,
+    0x62375, 0x623b4, 0x62568, 0x62505, 0x6252e, 0x62405, 0x6258d, 0x623c9,
+    0x624c9, 0x623e7, 0x625b2, 0x625e2, 0x625d9, 0x6254c, 0x62608, 0x5800000,
+    0x62714, 0x6268d, 0x62887, 0x626ee, 0x6274c, 0x627e3, 0x62473, 0x626a6,
+    0x627b4, 0x626cf, 0x5800000, 0x628d4, 0x627c1, 0x62725, 0x62672, 0x62792,
+    0x62850, 0x62805, 0x6292b, 0x6282f, 0x5c00000, 0x62ac3, 0x628e1, 0x629d4,
+    0x62ba5, 0x62a74, 0x62b05, 0x62a0e, 0x628b6, 0x62aee, 0x62a48, 0x629ef,
+    0x62be3, 0x62b53, 0x62ab9, 0x62b32, 0x62a29, 0x62c09, 0x62b8f, 0x62ccd,
+    0x62cef, 0x5a00000, 0x62c6c, 0x62c2f, 0x62bd9, 0x62d03, 0x62d69, 0x62b68,
+    0x62c45, 0x62d83, 0x62dac, 0x62c84, 0x5a00000, 0x5800000, 0x62ea5, 0x62f05,
+    0x62ef4, 0x63076, 0x62ec9, 0x62f28, 0x62d53, 0x5a00000, 0x62f6e, 0x62f88,
+    0x62f54, 0x62ff4, 0x63009, 0x62fc7, 0x62d2e, 0x62fa4, 0x6302c, 0x62e73,
+    0x63089, 0x630e9, 0x62dcf, 0x63105, 0x63054, 0x630af, 0x630ca, 0x63204,
+    0x63129, 0x5a00000, 0x6318f, 0x6314b, 0x5a00000, 0x62e33, 0x631ac, 0x63172,
+    0x5800000, 0x63225, 0x5c80000, 0x632c9, 0x63273, 0x631d0, 0x63241, 0x632b3,
+    0x633d2, 0x6330c, 0x5a00000, 0x632f4, 0x631ee, 0x5c00000, 0x6342b, 0x63293,
+    0x5a00000, 0x63345, 0x63397, 0x6344f, 0x63333, 0x63373, 0x63501, 0x633ef,
+    0x635ad, 0x63550, 0x634d4, 0x63521, 0x635ce, 0x6356c, 0x634e9, 0x63669,
+    0x63408, 0x6362e, 0x63609, 0x63493, 0x6346f, 0x6364e, 0x5800000, 0x62e85,
+    0x5d00000, 0x636ee, 0x635f2, 0x636cb, 0x6378e, 0x63708, 0x5a00000, 0x6372e,
+    0x637ac, 0x63695, 0x637c8, 0x6376c, 0x636ae, 0x6374c, 0x638c3, 0x63821,
+    0x633a6, 0x5880000, 0x63ac5, 0x637f0, 0x6388d, 0x63aa3, 0x63812, 0x5a00000,
+    0x639f3, 0x63853, 0x63a65, 0x63934, 0x63a93, 0x5800000, 0x638e9, 0x63910,
+    0x63b25, 0x63b05, 0x63b72, 0x5800000, 0x63a53, 0x63a39, 0x5d80000, 0x63874,
+    0x63969, 0x638a9, 0x63af3, 0x63bf2, 0x63c6e, 0x63b53, 0x63ce5, 0x63c8e,
+    0x63ccc, 0x63b8f, 0x63d21, 0x63ba9, 0x63d0c, 0x639af, 0x5c80000, 0x63de5,
+    0x63dc1, 0x5a00000, 0x63ca5, 0x63d8e, 0x6400d, 0x63d45, 0x5b00000, 0x63c19,
+    0x63ed4, 0x63da5, 0x63e14, 0x5a00000, 0x5b00000, 0x63e32, 0x63e45, 0x63d73,
+    0x5780000, 0x63fae, 0x63bcc, 0x5b00000, 0x63f52, 0x5800000, 0x63eef, 0x64185,
+    0x63f2e, 0x63f13, 0x63f75, 0x63e90, 0x63fd4, 0x63f8f, 0x63fe5, 0x640a5,
+    0x640ec, 0x64054, 0x64029, 0x5800000, 0x6412e, 0x641c9, 0x64073, 0x64230,
+    0x640d3, 0x6410f, 0x64265, 0x64313, 0x64245, 0x64169, 0x64289, 0x64352,
+    0x641ef, 0x64472, 0x644a7, 0x6414f, 0x642b9, 0x64489, 0x643ae, 0x6438e,
+    0x642c1, 0x644ec, 0x64525, 0x64515, 0x645f2, 0x643d3, 0x64430, 0x64544,
+    0x644cf, 0x64335, 0x64573, 0x64581, 0x6444f, 0x646a9, 0x645b0, 0x64653,
+    0x645c9, 0x64719, 0x64661, 0x5800000, 0x6462b, 0x64753, 0x64681, 0x646cc,
+    0x64601, 0x64727, 0x647da, 0x64783, 0x6484c, 0x5880000, 0x64962, 0x6440c,
+    0x64914, 0x648f4, 0x648ac, 0x64894, 0x648c1, 0x647b5, 0x64a45, 0x649ce,
+    0x6494d, 0x64829, 0x5980000, 0x64b45, 0x64ae5, 0x5980000, 0x64a14, 0x649e5,
+    0x64773, 0x649b2, 0x64b14, 0x64b24, 0x64b89, 0x5980000, 0x5800000, 0x64995,
+    0x5a00000, 0x64ac2, 0x5980000, 0x64c6d, 0x64b6c, 0x64ab3, 0x64a25, 0x64a81,
+    0x64baf, 0x64f39, 0x64cc7, 0x64d8f, 0x64c92, 0x64d09, 0x64c49, 0x64cb4,
+    0x64c13, 0x64c33, 0x64be8, 0x64cec, 0x64d25, 0x64d48, 0x64e25, 0x64dae,
+    0x64bc3, 0x5b00000, 0x64dee, 0x64e53, 0x5800000, 0x64f47, 0x64e73, 0x64f85,
+    0x64e92, 0x64ea9, 0x64ef2, 0x64ed0, 0x64fd2, 0x65027, 0x5a00000, 0x64f0c,
+    0x64f65, 0x65044, 0x65003, 0x650b4, 0x650ec, 0x650c5, 0x65165, 0x651d0,
+    0x5800000, 0x0, 0x65230, 0x65069, 0x65208, 0x65154, 0x65139, 0x651e1,
+    0x651b4, 0x65384, 0x65189, 0x652d0, 0x5b00000, 0x65290, 0x652ef, 0x65247,
+    0x5a80000, 0x653b3, 0x653e7, 0x65265, 0x64fb2, 0x65444, 0x65493, 0x5780000,
+    0x5800000, 0x652a5, 0x65301, 0x65405, 0x6536f, 0x65341, 0x654ac, 0x65505,
+    0x659f6, 0x6552e, 0x65473, 0x653d3, 0x654cf, 0x65543, 0x655c9, 0x654e9,
+    0x65623, 0x65605, 0x65561, 0x5a00000, 0x65432, 0x656b2, 0x6564e, 0x6566e,
+    0x656c9, 0x65705, 0x65725, 0x655f4, 0x657a2, 0x656ef, 0x65593, 0x5a00000,
+    0x65745, 0x65885, 0x65792, 0x655b3, 0x65692, 0x65803, 0x657f3, 0x658af,
+    0x657d2, 0x65765, 0x6594c, 0x65821, 0x658c7, 0x65841, 0x6596d, 0x6590e,
+    0x659c1, 0x65a89, 0x65a2c, 0x65aa3, 0x659a9, 0x65874, 0x65985, 0x5800000,
+    0x65a0f, 0x65a72, 0x65ba5, 0x65a45, 0x5800000, 0x65ad0, 0x0, 0x65b67,
+    0x65b12, 0x65b59, 0x65b27, 0x5800000, 0x65cd0, 0x0, 0x65af4, 0x65bf4,
+    0x65d2e, 0x65bcc, 0x65ce5, 0x65b8d, 0x65d13, 0x65c49, 0x65d4d, 0x65e01,
+    0x65de1, 0x65c2f, 0x5800000, 0x65c94, 0x65e6c, 0x5a00000, 0x65d73, 0x65c17,
+    0x65d92, 0x65db2, 0x65c73, 0x65e52, 0x5a00000, 0x65ed0, 0x65ee1, 0x65e2f,
+    0x65e95, 0x65dc5, 0x65f48, 0x65f8c, 0x65f64, 0x65eb3, 0x65f07, 0x65cae,
+    0x65fa5, 0x65f27, 0x65fef, 0x65fd5, 0x66005, 0x66079, 0x66049, 0x5a00000,
+    0x6602f, 0x66085, 0x5800000, 0x5800000, 0x66184, 0x660d7, 0x5800000, 0x5a00000,
+    0x66154, 0x5a00000, 0x661c9, 0x6644e, 0x660a8, 0x66221, 0x661a9, 0x66259,
+    0x5800000, 0x66267, 0x66165, 0x662e4, 0x662c9, 0x66361, 0x66133, 0x663c5,
+    0x66465, 0x663a1, 0x663e3, 0x66481, 0x66394, 0x66564, 0x664c3, 0x664ae,
+    0x5b00000, 0x664f3, 0x5b00000, 0x66413, 0x66505, 0x665a7, 0x5a00000, 0x5e00000,
+    0x66605, 0x665e4, 0x66315, 0x66355, 0x0, 0x0, 0x66532, 0x66725,
+    0x665d3, 0x66783, 0x676e2, 0x66681, 0x5e80000, 0x5f00000, 0x6662e, 0x66596,
+    0x66649, 0x66435, 0x666c9, 0x5f00000, 0x666a9, 0x66772, 0x66675, 0x66553,
+    0x667ee, 0x667d3, 0x5f80000, 0x66741, 0x66701, 0x66825, 0x66879, 0x66810,
+    0x6000000, 0x668f3, 0x667ad, 0x66985, 0x669c3, 0x6684c, 0x66956, 0x66925,
+    0x66912, 0x669a5, 0x6080000, 0x66969, 0x66881, 0x668b3, 0x66a85, 0x669e5,
+    0x66a25, 0x66a61, 0x6100000, 0x66a47, 0x66a09, 0x66aee, 0x6080000, 0x66ad4,
+    0x6180000, 0x66aa1, 0x666ec, 0x6200000, 0x66b43, 0x66c89, 0x66dcf, 0x66ca5,
+    0x66ba1, 0x66b65, 0x66b85, 0x66b2e, 0x66d01, 0x66cf2, 0x6000000, 0x66d45,
+    0x66de5, 0x66d84, 0x66c2c, 0x6280000, 0x66cd5, 0x66c74, 0x66b13, 0x66d65,
+    0x66c4f, 0x66da5, 0x66e8e, 0x668d3, 0x66d33, 0x5e00000, 0x67047, 0x67065,
+    0x66e43, 0x6100000, 0x66e12, 0x66ef4, 0x66eb3, 0x66f30, 0x6708e, 0x66ec1,
+    0x670b2, 0x6280000, 0x66f45, 0x6280000, 0x5e00000, 0x6712d, 0x67001, 0x66f6d,
+    0x66fb3, 0x66fce, 0x5f00000, 0x5f00000, 0x67025, 0x5e00000, 0x66fe9, 0x67229,
+    0x671f4, 0x67252, 0x6300000, 0x5f00000, 0x672ab, 0x6380000, 0x5f80000, 0x5e00000,
+    0x670c4, 0x672e9, 0x671cc, 0x6740c, 0x6100000, 0x67325, 0x67204, 0x673ae,
+    0x6300000, 0x5e00000, 0x6963a, 0x67457, 0x67345, 0x0, 0x0, 0x673ce,
+    0x67505, 0x67379, 0x672d3, 0x67390, 0x6730f, 0x673e5, 0x6746c, 0x67565,
+    0x67549, 0x67493, 0x674a1, 0x67433, 0x5e00000, 0x5e00000, 0x67532, 0x675a5,
+    0x674f2, 0x674d4, 0x6080000, 0x6080000, 0x675e4, 0x675d4, 0x6772f, 0x6766c,
+    0x67615, 0x66334, 0x67689, 0x67633, 0x67654, 0x676ac, 0x6280000, 0x67904,
+    0x5f80000, 0x67793, 0x67953, 0x676c5, 0x6200000, 0x67593, 0x677cf, 0x6784d,
+    0x677f4, 0x67834, 0x67814, 0x67a05, 0x679d4, 0x677a6, 0x67a65, 0x67983,
+    0x67921, 0x67ab2, 0x5e00000, 0x679b0, 0x67b21, 0x67b0d, 0x678d5, 0x679f3,
+    0x67b45, 0x5f80000, 0x6796f, 0x67be4, 0x67c32, 0x67b69, 0x5e00000, 0x5e00000,
+    0x67cf0, 0x67cd4, 0x67d2c, 0x67c49, 0x67d76, 0x67af3, 0x6300000, 0x67dac,
+    0x67d83, 0x67a91, 0x67c09, 0x6280000, 0x67bb3, 0x67c79, 0x5e00000, 0x67b8f,
+    0x67e2d, 0x67c93, 0x67cb3, 0x5e00000, 0x67d09, 0x67f24, 0x67df6, 0x67d48,
+    0x67f74, 0x67ac5, 0x67ece, 0x67f41, 0x67eec, 0x5f00000, 0x67f13, 0x68032,
+    0x67fc9, 0x5e00000, 0x68123, 0x68068, 0x6280000, 0x680d3, 0x6280000, 0x5e00000,
+    0x67f92, 0x680f4, 0x681e5, 0x68153, 0x68173, 0x681cd, 0x5e00000, 0x67fb3,
+    0x680b9, 0x68088, 0x681b4, 0x68209, 0x682a9, 0x6400000, 0x6822e, 0x68195,
+    0x682c1, 0x682e3, 0x6100000, 0x6830e, 0x6400000, 0x6400000, 0x5f00000, 0x5e00000,
+    0x68324, 0x68341, 0x5f00000, 0x68299, 0x68254, 0x685d4, 0x68385, 0x6826f,
+    0x683c5, 0x6400000, 0x5f00000, 0x5e00000, 0x6200000, 0x68369, 0x683a9, 0x68409,
+    0x6480000, 0x69376, 0x68425, 0x6969a, 0x684ed, 0x68587, 0x685ae, 0x68601,
+    0x683f3, 0x68487, 0x684c5, 0x5f00000, 0x684a8, 0x68505, 0x68453, 0x6854c,
+    0x6846f, 0x685f2, 0x68629, 0x6080000, 0x6400000, 0x5f00000, 0x6500000, 0x6500000,
+    0x687ae, 0x5f80000, 0x686b3, 0x68883, 0x6890c, 0x68721, 0x68793, 0x687f2,
+    0x68812, 0x5e00000, 0x68659, 0x68688, 0x68753, 0x688a8, 0x68937, 0x68709,
+    0x68964, 0x5f00000, 0x68985, 0x689ac, 0x68853, 0x68953, 0x688ce, 0x689c5,
+    0x689e9, 0x68a45, 0x5f80000, 0x68ac5, 0x68a12, 0x686ec, 0x5e00000, 0x688e9,
+    0x68b25, 0x68b13, 0x5e00000, 0x68af3, 0x68a25, 0x68b89, 0x68bee, 0x68bd2,
+    0x6280000, 0x68bb0, 0x68c13, 0x6080000, 0x68aa9, 0x68ca9, 0x68d2d, 0x68c6f,
+    0x68a61, 0x68c2c, 0x6480000, 0x5e00000, 0x68d0e, 0x68b73, 0x6580000, 0x68e29,
+    0x68e61, 0x68d72, 0x68cd0, 0x68cef, 0x68d53, 0x68d94, 0x68c89, 0x68c45,
+    0x68dd3, 0x68e09, 0x68df2, 0x68ea8, 0x68e50, 0x68e94, 0x68db3, 0x6080000,
+    0x68f69, 0x68ec1, 0x5f80000, 0x68ef2, 0x69161, 0x68b44, 0x68f8c, 0x68f22,
+    0x68f54, 0x69025, 0x69095, 0x68f09, 0x5f00000, 0x68fb3, 0x69132, 0x69159,
+    0x69043, 0x691b9, 0x68ff7, 0x69061, 0x692c3, 0x690a2, 0x690c2, 0x690e1,
+    0x5e00000, 0x69249, 0x68fd4, 0x5f80000, 0x69353, 0x6280000, 0x69329, 0x69190,
+    0x6400000, 0x693a5, 0x5f00000, 0x693e5, 0x69679, 0x693ce, 0x0, 0x5e00000,
+    0x6100000, 0x69319, 0x69285, 0x5e00000, 0x69433, 0x692b3, 0x692e5, 0x6940c,
+    0x69521, 0x69472, 0x69565, 0x69492, 0x69748, 0x69445, 0x695c5, 0x694f3,
+    0x69385, 0x69587, 0x69514, 0x694a5, 0x69552, 0x695e9, 0x695b3, 0x6080000,
+    0x696a4, 0x69761, 0x6080000, 0x69649, 0x696e3, 0x69610, 0x6970e, 0x696d9,
+    0x697ed, 0x69725, 0x6480000, 0x69852, 0x6980e, 0x697b0, 0x69829, 0x6400000,
+    0x5e00000, 0x699a3, 0x69901, 0x5e00000, 0x5e00000, 0x5e00000, 0x697d3, 0x69ae5,
+    0x69b6d, 0x69ac3, 0x69874, 0x69953, 0x69a55, 0x698c5, 0x69a69, 0x69b94,
+    0x69989, 0x698b3, 0x69974, 0x69a8c, 0x69c25, 0x69a05, 0x69933, 0x699f3,
+    0x69ab3, 0x699cd, 0x69be5, 0x69b09, 0x69b2e, 0x69c41, 0x69a29, 0x69c08,
+    0x69c75, 0x69c94, 0x69b4e, 0x69ba5, 0x69cf3, 0x69d4c, 0x69cb0, 0x69e81,
+    0x69d30, 0x69bcf, 0x69e49, 0x6080000, 0x69ccf, 0x6000000, 0x6480000, 0x69ec7,
+    0x6300000, 0x69ef2, 0x6280000, 0x69f24, 0x69f4d, 0x5e00000, 0x6080000, 0x69fce,
+    0x69f67, 0x69d6f, 0x69fe6, 0x5e00000, 0x69fa5, 0x69de5, 0x6080000, 0x6480000,
+    0x69d89, 0x69eb3, 0x6280000, 0x69f13, 0x69e65, 0x6a005, 0x6a0c3, 0x6a0f4,
+    0x69f93, 0x6a145, 0x6a165, 0x6280000, 0x6a132, 0x5e00000, 0x69e35, 0x6a1b3,
+    0x6280000, 0x6a1c3, 0x6a0b3, 0x6400000, 0x6a025, 0x6a214, 0x6a1e5, 0x5e00000,
+    0x6a2f2, 0x6a061, 0x6a228, 0x6a105, 0x6a181, 0x6a474, 0x6a265, 0x6a853,
+    0x6a284, 0x6a24d, 0x6a348, 0x6080000, 0x6a30f, 0x6a404, 0x6a3c7, 0x6a385,
+    0x5e00000, 0x6a36b, 0x6a2b3, 0x6280000, 0x6280000, 0x6a3e4, 0x6a489, 0x6a2d2,
+    0x6a330, 0x6a4c3, 0x6a425, 0x5f80000, 0x5e00000, 0x6a4af, 0x6a3b2, 0x6a081,
+    0x6a58e, 0x5e00000, 0x5e00000, 0x6a4f4, 0x6280000, 0x6a54c, 0x6a519, 0x6a44f,
+    0x6080000, 0x6a532, 0x6a623, 0x6a665, 0x6a5c9, 0x6300000, 0x6a654, 0x6a5b3,
+    0x6aa13, 0x6a5f2, 0x6a6c8, 0x6a605, 0x6a6a9, 0x6a72c, 0x6a783, 0x6400000,
+    0x6a049, 0x6a779, 0x6a6e5, 0x6a7c9, 0x5f00000, 0x762d1, 0x6a821, 0x6a969,
+    0x6a693, 0x6a92d, 0x6280000, 0x6a749, 0x6a7f4, 0x6a7b4, 0x6400000, 0x6a948,
+    0x6a80f, 0x6a9c9, 0x6a8b3, 0x6a910, 0x6a894, 0x6aa69, 0x6aae5, 0x5f00000,
+    0x6a872, 0x6a990, 0x6300000, 0x5e00000, 0x5f80000, 0x6aa4e, 0x5f00000, 0x6280000,
+    0x6aab0, 0x5e00000, 0x6ab65, 0x6600000, 0x6aad9, 0x6ab2c, 0x6a9f3, 0x6abda,
+    0x6000000, 0x6a9a9, 0x6aa35, 0x6680000, 0x6ab45, 0x6ab81, 0x6ab13, 0x6400000,
+    0x6480000, 0x6ad44, 0x6a8ef, 0x6acc5, 0x6ac49, 0x6ac10, 0x6ac74, 0x6400000,
+    0x6aca2, 0x6abf5, 0x6aa8f, 0x6ada7, 0x6abb9, 0x6ac8c, 0x6280000, 0x6adf9,
+    0x6380000, 0x6ae45, 0x6ad29, 0x6ae01, 0x6ac39, 0x6ad13, 0x6ae73, 0x6ad92,
+    0x6af03, 0x6afa1, 0x6acf3, 0x6380000, 0x6ae34, 0x6afd3, 0x5e00000, 0x6ad69,
+    0x6af21, 0x6add3, 0x6ae8f, 0x6af74, 0x6280000, 0x6b054, 0x6aeb2, 0x6afee,
+    0x6aee7, 0x6b072, 0x6b021, 0x5e00000, 0x6b186, 0x6b081, 0x6aed4, 0x6b152,
+    0x6280000, 0x6b1ce, 0x6b172, 0x6b0a1, 0x6b232, 0x6b005, 0x6b24c, 0x6b113,
+    0x6b2e3, 0x6b2b2, 0x6b30d, 0x6b347, 0x6b1a1, 0x5e00000, 0x6b1f3, 0x6b423,
+    0x6b3c5, 0x6af8f, 0x6b3f4, 0x6b3b2, 0x6b385, 0x6b4a4, 0x6b44c, 0x6700000,
+    0x6b40f, 0x6b269, 0x6b4d4, 0x6b4e9, 0x6b489, 0x6b32f, 0x6b521, 0x6b565,
+    0x6480000, 0x6b5f9, 0x6400000, 0x6300000, 0x6b50f, 0x6b58c, 0x6b7a5, 0x6b641,
+    0x6b474, 0x6b5b3, 0x6b6ac, 0x6b5d0, 0x6b6f4, 0x6b629, 0x6b612, 0x6b7c5,
+    0x5f80000, 0x6b82c, 0x6b7e5, 0x6b556, 0x6b885, 0x6b709, 0x5f00000, 0x6b745,
+    0x6b80f, 0x6b689, 0x6100000, 0x6b984, 0x6b86e, 0x6100000, 0x6b924, 0x6b90c,
+    0x5f00000, 0x6b8a9, 0x5f80000, 0x6ba44, 0x6b84f, 0x6b9a1, 0x6b8c5, 0x6ba73,
+    0x6080000, 0x5e00000, 0x6ba2c, 0x6b9d2, 0x6b9e1, 0x6b973, 0x6bd08, 0x6bacc,
+    0x6ba05, 0x6bab5, 0x6bb85, 0x6bb4e, 0x6b954, 0x6ba89, 0x6bae6, 0x6bbe9,
+    0x6bb0e, 0x6bc12, 0x6bc61, 0x6bb69, 0x6bce7, 0x6bc43, 0x6bcc3, 0x6bbb0,
+    0x6bbc9, 0x6600000, 0x5f00000, 0x6bc92, 0x6be25, 0x6bde9, 0x6080000, 0x6bc23,
+    0x6bd94, 0x5e00000, 0x6be4c, 0x6bd4e, 0x6be6c, 0x6280000, 0x6c0c9, 0x6bdc5,
+    0x6bf68, 0x6200000, 0x6bf84, 0x5e00000, 0x6bfc5, 0x6bf32, 0x5e00000, 0x6be05,
+    0x6bfa3, 0x6bf0e, 0x6c063, 0x6bea9, 0x6bed3, 0x6bfe5, 0x6c025, 0x6bca1,
+    0x6bf53, 0x6be85, 0x6c08e, 0x6c044, 0x5f80000, 0x6280000, 0x5f00000, 0x5f00000,
+    0x6c12e, 0x6c013, 0x5f00000, 0x6c0a1, 0x5f00000, 0x6c152, 0x6c20e, 0x6c0f2,
+    0x6c22d, 0x6c1a1, 0x6c1c9, 0x6c268, 0x6c16c, 0x6c193, 0x6c249, 0x6c113,
+    0x6c2a7, 0x6c2c3, 0x6c348, 0x6c2ec, 0x6c28e, 0x6c1f3, 0x6c301, 0x6c325,
+    0x6c369, 0x6c3c8, 0x6c407, 0x6c385, 0x6480000, 0x6c4cd, 0x6c453, 0x6280000,
+    0x6c3b4, 0x6c554, 0x6c425, 0x6c4ec, 0x6400000, 0x5f00000, 0x0, 0x6c489,
+    0x6c5b4, 0x6c469, 0x6c592, 0x6c521, 0x6c3f3, 0x6c5f3, 0x6c6b3, 0x6c5ce,
+    0x6c605, 0x5e00000, 0x6c4ac, 0x5e00000, 0x6c7e5, 0x6c632, 0x6c654, 0x6c50f,
+    0x6c693, 0x6c665, 0x6080000, 0x6c82e, 0x6c84e, 0x6c808, 0x6c868, 0x6c781,
+    0x6c774, 0x6c7a9, 0x6c945, 0x6c728, 0x6c7d4, 0x6c973, 0x6c713, 0x6c988,
+    0x6780000, 0x6c8e5, 0x6c8a1, 0x5e00000, 0x6ca30, 0x6c8d4, 0x6c928, 0x6c905,
+    0x6c899, 0x6ca45, 0x6cae2, 0x6c9b3, 0x6cb21, 0x5e00000, 0x6c9d5, 0x6ca74,
+    0x6ca16, 0x6cc74, 0x6c9f3, 0x6cb09, 0x6cb6c, 0x6cbce, 0x6cc08, 0x6ccc5,
+    0x6cab3, 0x6cbf3, 0x6cc2e, 0x6480000, 0x6ca8c, 0x6ccee, 0x6cad5, 0x6cc4c,
+    0x6cd4c, 0x5e00000, 0x6cd6d, 0x6cdc5, 0x6cd8e, 0x6cd09, 0x6cc95, 0x6ce05,
+    0x6cdae, 0x6ce85, 0x6600000, 0x6ccb3, 0x6cde6, 0x6ce36, 0x6cd35, 0x6cec1,
+    0x6cf25, 0x6ceb4, 0x6ce69, 0x6ceee, 0x6cf65, 0x6cf52, 0x6cf03, 0x6d041,
+    0x5e00000, 0x6cf85, 0x5e00000, 0x6cfa6, 0x6d0a1, 0x5f00000, 0x6d0ee, 0x6d128,
+    0x6d1ce, 0x6d061, 0x6cfe6, 0x6700000, 0x6d185, 0x5e00000, 0x6800000, 0x6d029,
+    0x6dff7, 0x6d1a5, 0x6d149, 0x6d232, 0x6d285, 0x6cfd3, 0x6d2e5, 0x6d00c,
+    0x6d088, 0x6880000, 0x6d207, 0x6900000, 0x6d805, 0x6d2a1, 0x6d374, 0x6980000,
+    0x6d32e, 0x6d303, 0x6d38e, 0x6a00000, 0x6d3ae, 0x6a80000, 0x6d48c, 0x6800000,
+    0x6d2d3, 0x6d449, 0x6d3f2, 0x6d3c1, 0x6d34f, 0x6d421, 0x6b00000, 0x6d969,
+    0x6d6cc, 0x6980000, 0x6b80000, 0x6d703, 0x6d533, 0x6d5c1, 0x6b80000, 0x6d415,
+    0x6b80000, 0x6d4d9, 0x6d587, 0x6d46f, 0x6d573, 0x6d4f5, 0x6d5b3, 0x6d825,
+    0x6d5f3, 0x6d7ec, 0x6d613, 0x6b80000, 0x6d6f3, 0x6a80000, 0x6d765, 0x6d8c3,
+    0x6d64f, 0x6d7b3, 0x6d8e2, 0x6d7d4, 0x6d905, 0x6d892, 0x6d8b2, 0x6980000,
+    0x6d94e, 0x6d854, 0x6d9a9, 0x6d924, 0x6c00000, 0x6d9e9, 0x6d753, 0x6da09,
+    0x6d873, 0x6d9d3, 0x6da23, 0x6daa9, 0x6d992, 0x6880000, 0x6d793, 0x6da92,
+    0x6da6b, 0x6db48, 0x6980000, 0x6b80000, 0x6c80000, 0x6980000, 0x6db90, 0x6dc04,
+    0x6da4e, 0x6dbd9, 0x6dae1, 0x6dad9, 0x6dc4c, 0x6dc6e, 0x6dcb3, 0x6880000,
+    0x6db12, 0x6dd33, 0x6c00000, 0x6ddb2, 0x6ddc3, 0x6d00000, 0x6880000, 0x6dbe9,
+    0x6dc33, 0x6d00000, 0x6de14, 0x6d80000, 0x6db65, 0x6c80000, 0x6e00000, 0x6dc8f,
+    0x6880000, 0x6e80000, 0x6dd53, 0x6900000, 0x6dde8, 0x6dd93, 0x6deae, 0x6dce5,
+    0x6d00000, 0x6dee5, 0x6dd61, 0x6e80000, 0x6980000, 0x6dcd3, 0x6dfc8, 0x6c80000,
+    0x6df69, 0x6dfb2, 0x0, 0x6de53, 0x0, 0x0, 0x6e04c, 0x6df09,
+    0x6df25, 0x6df94, 0x6e145, 0x6df53, 0x6e00000, 0x6e0cd, 0x6e033, 0x6e072,
+    0x6e00c, 0x6e241, 0x6e093, 0x6e0ec, 0x6e185, 0x6e1b4, 0x6e225, 0x6e26e,
+    0x6e209, 0x6e1f3, 0x6f00000, 0x6e1d9, 0x6e28e, 0x6e125, 0x6980000, 0x6b80000,
+    0x6d00000, 0x6e314, 0x6e2b0, 0x6800000, 0x6e348, 0x6d00000, 0x6e36d, 0x6880000,
+    0x6980000, 0x6e4b3, 0x6c80000, 0x6e2c2, 0x6e3af, 0x6a80000, 0x6e384, 0x6d00000,
+    0x6e405, 0x6e4d6, 0x6e3e1, 0x6c80000, 0x6880000, 0x6880000, 0x6e333, 0x6880000,
+    0x6e8d2, 0x6e6d5, 0x6e72e, 0x6e525, 0x6c80000, 0x6e3d3, 0x6e625, 0x6e429,
+    0x6e685, 0x6e48f, 0x6e6a5, 0x6e573, 0x6e765, 0x6e789, 0x6e445, 0x6e64f,
+    0x6f80000, 0x6c80000, 0x6e513, 0x6e705, 0x6e801, 0x6e843, 0x6e6f4, 0x6e7d3,
+    0x6e825, 0x7000000, 0x6e90b, 0x6e745, 0x6e5c9, 0x6800000, 0x7080000, 0x7080000,
+    0x6e9e5, 0x6c80000, 0x6c80000, 0x6800000, 0x6e7f3, 0x6800000, 0x6c80000, 0x6ea13,
+    0x6ea73, 0x6eaa5, 0x6e9c3, 0x6e8af, 0x6980000, 0x6e8e5, 0x6e885, 0x6a00000,
+    0x6ea81, 0x6e00000, 0x6e933, 0x6eae9, 0x6900000, 0x6ebc5, 0x6b80000, 0x6880000,
+    0x6ea33, 0x6ea53, 0x6880000, 0x6eace, 0x6eb2e, 0x6e952, 0x6eb06, 0x6c80000,
+    0x6ebee, 0x6ec0e, 0x6ebb3, 0x6eb6e, 0x6d00000, 0x7100000, 0x6880000, 0x6ece5,
+    0x7180000, 0x6eb42, 0x6c80000, 0x6ec30, 0x6ec93, 0x6800000, 0x6ed05, 0x6ecd3,
+    0x6ee12, 0x6edd4, 0x6ee32, 0x6ec53, 0x6d00000, 0x6ee89, 0x6ed21, 0x7200000,
+    0x6e00000, 0x6ecb3, 0x6a80000, 0x6ed79, 0x6c80000, 0x6ef0c, 0x6eec1, 0x6ef2d,
+    0x6ed50, 0x6d00000, 0x6880000, 0x6880000, 0x6900000, 0x6efa5, 0x6d00000, 0x6efc9,
+    0x6f059, 0x6f004, 0x6d00000, 0x6ee53, 0x6f065, 0x6eee5, 0x6880000, 0x6ee73,
+    0x6880000, 0x6880000, 0x6eeb3, 0x6880000, 0x6f1a5, 0x6ef41, 0x6c80000, 0x6e00000,
+    0x6f0cd, 0x6f033, 0x6f1c5, 0x6f1ee, 0x6f193, 0x6f0a5, 0x6f221, 0x6f204,
+    0x6c80000, 0x6f093, 0x6f121, 0x6880000, 0x6f0f3, 0x6880000, 0x6f268, 0x6f435,
+    0x6edaf, 0x6f153, 0x6f173, 0x6f249, 0x6f2c3, 0x6f289, 0x6f2f4, 0x6f2b3,
+    0x6f3e1, 0x6f443, 0x6f3a8, 0x6f314, 0x6f32d, 0x6f3c9, 0x6f103, 0x6f36f,
+    0x6f38d, 0x6980000, 0x6f354, 0x6f409, 0x6f5e5, 0x6f4ac, 0x6f469, 0x6f4c3,
+    0x6f493, 0x7280000, 0x6980000, 0x6f4e9, 0x6eff4, 0x6d80000, 0x6f523, 0x6f5cc,
+    0x6f652, 0x6f60c, 0x6f66c, 0x6f72c, 0x6f513, 0x6f579, 0x7180000, 0x6f5a5,
+    0x6900000, 0x6c80000, 0x6f00000, 0x6e00000, 0x6f593, 0x6d00000, 0x7000000, 0x6f80000,
+    0x6f794, 0x6880000, 0x6f7ed, 0x6880000, 0x6c80000, 0x6f825, 0x6f852, 0x6e00000,
+    0x6e00000, 0x6f872, 0x7000000, 0x6e00000, 0x6f8a3, 0x6880000, 0x6880000, 0x6f8f3,
+    0x6f80e, 0x6f80000, 0x6f7d3, 0x6b80000, 0x6f688, 0x6880000, 0x6b80000, 0x6f972,
+    0x6f9a8, 0x6fa05, 0x6f989, 0x7300000, 0x6900000, 0x6f90e, 0x6f893, 0x6f00000,
+    0x6c80000, 0x6f8d3, 0x6fa2b, 0x6f925, 0x6faa3, 0x6f9d3, 0x6f7a4, 0x6f94f,
+    0x7380000, 0x6880000, 0x6880000, 0x6fa72, 0x6fa89, 0x7380000, 0x6f9f4, 0x6880000,
+    0x6fbe5, 0x6fb14, 0x6fb8d, 0x6fb61, 0x6fb4c, 0x6880000, 0x6fc03, 0x6880000,
+    0x6fbac, 0x6fc65, 0x6fcd4, 0x6900000, 0x6900000, 0x6fbcf, 0x6fac8, 0x6900000,
+    0x6fc4f, 0x6900000, 0x6fc32, 0x6fd04, 0x6980000, 0x6fd45, 0x6fca3, 0x6e00000,
+    0x6fcef, 0x6fd6f, 0x6fc93, 0x6fd33, 0x6fd94, 0x6fe08, 0x6fdc5, 0x6fe72,
+    0x6fdae, 0x6fdf3, 0x6c80000, 0x6fe29, 0x6e00000, 0x6c80000, 0x6e00000, 0x6c00000,
+    0x6e80000, 0x6ff0e, 0x6ff4e, 0x6fe55, 0x6880000, 0x6880000, 0x6fe85, 0x6fee5,
+    0x6fea5, 0x6ff64, 0x6ffd3, 0x6ff85, 0x700f3, 0x6c80000, 0x70113, 0x70121,
+    0x6ffe9, 0x6d00000, 0x6880000, 0x6880000, 0x70005, 0x6f80000, 0x6880000, 0x6d00000,
+    0x6e00000, 0x7022e, 0x70041, 0x701b2, 0x700b4, 0x6880000, 0x701ee, 0x70025,
+    0x703b4, 0x70265, 0x6f80000, 0x70163, 0x7071a, 0x70193, 0x70152, 0x6f80000,
+    0x70245, 0x70288, 0x701c4, 0x702ed, 0x70321, 0x70365, 0x70073, 0x70210,
+    0x6c80000, 0x700c5, 0x702c5, 0x70425, 0x6d00000, 0x6880000, 0x70392, 0x703ee,
+    0x70309, 0x7400000, 0x70604, 0x6880000, 0x6e80000, 0x70513, 0x703d9, 0x702b3,
+    0x7040f, 0x6900000, 0x70448, 0x70485, 0x6880000, 0x6880000, 0x7046f, 0x704b3,
+    0x70541, 0x70743, 0x6e00000, 0x705b9, 0x70534, 0x6e00000, 0x70633, 0x7068c,
+    0x70573, 0x7480000, 0x70593, 0x6b80000, 0x707a8, 0x70653, 0x7080e, 0x7072e,
+    0x70768, 0x708a3, 0x7066f, 0x705c9, 0x706a8, 0x706c5, 0x708e3, 0x7000000,
+    0x6880000, 0x70927, 0x70785, 0x6d00000, 0x707d5, 0x6900000, 0x707e5, 0x70821,
+    0x706f3, 0x6d80000, 0x7098c, 0x709f4, 0x70a13, 0x70a43, 0x6900000, 0x6e00000,
+    0x709ce, 0x70875, 0x6f80000, 0x70a67, 0x70a29, 0x6c80000, 0x6f80000, 0x7380000,
+    0x70a94, 0x70b0c, 0x70b53, 0x0, 0x70b74, 0x70ba9, 0x70c04, 0x70ace,
+    0x70b25, 0x70af3, 0x70aa9, 0x709b3, 0x70c2c, 0x70c85, 0x6800000, 0x70b82,
+    0x70ca5, 0x70c56, 0x6800000, 0x6c80000, 0x70c69, 0x70def, 0x70da7, 0x70d8e,
+    0x6f80000, 0x70bd5, 0x7180000, 0x6c80000, 0x70e95, 0x70ecc, 0x70d39, 0x6880000,
+    0x70eec, 0x70dd5, 0x70ea6, 0x70f33, 0x70f03, 0x70f50, 0x70d73, 0x70ce9,
+    0x6900000, 0x70fe4, 0x6d00000, 0x70e29, 0x71005, 0x70e53, 0x70e73, 0x70f61,
+    0x71033, 0x7180000, 0x71085, 0x70fc7, 0x70fa5, 0x6900000, 0x7000000, 0x710c5,
+    0x71104, 0x710f6, 0x71123, 0x70f93, 0x71189, 0x71174, 0x7104e, 0x7380000,
+    0x6880000, 0x712c5, 0x0, 0x71149, 0x71073, 0x71208, 0x711e8, 0x711ce,
+    0x710b3, 0x7122e, 0x71245, 0x711b3, 0x71305, 0x7500000, 0x6c80000, 0x6980000,
+    0x713ae, 0x712e4, 0x71281, 0x7136f, 0x6980000, 0x71334, 0x713c3, 0x7138f,
+    0x7126e, 0x7500000, 0x712ad, 0x7500000, 0x7280000, 0x715a5, 0x7158e, 0x71565,
+    0x713f3, 0x71433, 0x7500000, 0x6d00000, 0x7140f, 0x71613, 0x716a5, 0x71721,
+    0x71692, 0x716cb, 0x6e00000, 0x7162e, 0x6e00000, 0x716ee, 0x7170e, 0x71827,
+    0x715ec, 0x715ce, 0x717a3, 0x717c6, 0x7000000, 0x717e5, 0x71863, 0x7184c,
+    0x71b23, 0x71794, 0x71808, 0x71774, 0x71885, 0x718a5, 0x718c8, 0x71753,
+    0x718e1, 0x6e80000, 0x71474, 0x71909, 0x71928, 0x71994, 0x6880000, 0x71a05,
+    0x719a5, 0x6c80000, 0x6f80000, 0x7196d, 0x719e1, 0x719c1, 0x6d00000, 0x71a47,
+    0x6880000, 0x6880000, 0x71a72, 0x71a2e, 0x71953, 0x71aa8, 0x71bf2, 0x71c05,
+    0x6a80000, 0x6e00000, 0x7180000, 0x71c67, 0x71ac6, 0x71a8e, 0x71c2b, 0x6d00000,
+    0x7000000, 0x71ccc, 0x71b41, 0x6d00000, 0x0, 0x6880000, 0x71b65, 0x71ba5,
+    0x0, 0x71e05, 0x71673, 0x71ca1, 0x71c93, 0x7000000, 0x71f23, 0x71db2,
+    0x71d94, 0x71b8c, 0x71d34, 0x71f45, 0x71d79, 0x71d45, 0x7580000, 0x71fe5,
+    0x71df0, 0x71e73, 0x6c80000, 0x72004, 0x71d13, 0x6d00000, 0x71fd2, 0x6f80000,
+    0x71ed9, 0x71e85, 0x71f13, 0x72072, 0x6d00000, 0x6e00000, 0x71e33, 0x7202e,
+    0x6880000, 0x71fb3, 0x71b16, 0x720c9, 0x720ae, 0x71eb5, 0x720f9, 0x6800000,
+    0x7208f, 0x6c80000, 0x6c80000, 0x72053, 0x721c9, 0x721a5, 0x72173, 0x72209,
+    0x71f85, 0x71eec, 0x6c80000, 0x6880000, 0x6880000, 0x721f4, 0x722a8, 0x72113,
+    0x7226c, 0x6880000, 0x72309, 0x7228e, 0x72193, 0x72245, 0x722c1, 0x0,
+    0x7222b, 0x72332, 0x72392, 0x6c80000, 0x72349, 0x72445, 0x7000000, 0x7180000,
+    0x723ae, 0x723d3, 0x723f3, 0x7240c, 0x722f3, 0x724e4, 0x7246d, 0x7000000,
+    0x724d2, 0x63589, 0x72504, 0x724a9, 0x72589, 0x72539, 0x72433, 0x725e5,
+    0x72545, 0x6c80000, 0x725ae, 0x72627, 0x6880000, 0x6880000, 0x7266e, 0x6880000,
+    0x72613, 0x6880000, 0x6d00000, 0x72579, 0x72653, 0x72865, 0x6880000, 0x72824,
+    0x72712, 0x726f4, 0x72732, 0x727b4, 0x727ce, 0x72812, 0x72884, 0x72773,
+    0x72793, 0x728e4, 0x728c1, 0x72944, 0x6880000, 0x7600000, 0x728b2, 0x726ce,
+    0x72966, 0x72914, 0x729c4, 0x72934, 0x7680000, 0x72a12, 0x72a85, 0x7700000,
+    0x72988, 0x729f9, 0x72a69, 0x7700000, 0x7780000, 0x72a39, 0x72b05, 0x729b3,
+    0x72aa8, 0x72acc, 0x72b25, 0x72b6d, 0x7800000, 0x72c83, 0x7880000, 0x72a53,
+    0x72c49, 0x7900000, 0x72b54, 0x7980000, 0x72bb2, 0x7980000, 0x72af3, 0x7a00000,
+    0x7780000, 0x72d2e, 0x72bf4, 0x72bd2, 0x72c34, 0x72493, 0x7a80000, 0x7780000,
+    0x72b99, 0x72c61, 0x72d73, 0x72e0f, 0x72dce, 0x7880000, 0x7b00000, 0x7b80000,
+    0x7c00000, 0x7880000, 0x72d48, 0x7c80000, 0x7c00000, 0x7c00000, 0x7a80000, 0x72cb5,
+    0x7780000, 0x7880000, 0x7600000, 0x72e69, 0x72d81, 0x72852, 0x7900000, 0x72ef3,
+    0x0, 0x72e33, 0x72ce5, 0x72ecc, 0x7d00000, 0x72de9, 0x7d00000, 0x72e53,
+    0x72e93, 0x72f28, 0x72f45, 0x72eb3, 0x72f69, 0x72f0e, 0x7c00000, 0x73085,
+    0x7880000, 0x7780000, 0x7d80000, 0x72f93, 0x72fa8, 0x7e00000, 0x72fd4, 0x73033,
+    0x730a5, 0x7e80000, 0x7f00000, 0x72ff4, 0x7900000, 0x7d00000, 0x731d3, 0x73001,
+    0x7680000, 0x73139, 0x7f00000, 0x72154, 0x731e5, 0x7f80000, 0x73052, 0x7f00000,
+    0x731a9, 0x73232, 0x7680000, 0x73190, 0x73176, 0x8000000, 0x73243, 0x73201,
+    0x73153, 0x8080000, 0x8100000, 0x8180000, 0x7b00000, 0x73069, 0x7b00000, 0x732af,
+    0x730e9, 0x73109, 0x7b00000, 0x732f2, 0x73305, 0x7e80000, 0x7e80000, 0x7e00000,
+    0x733e4, 0x7e80000, 0x73362, 0x7600000, 0x73382, 0x73424, 0x73273, 0x7334e,
+    0x7680000, 0x8200000, 0x7680000, 0x8280000, 0x7b00000, 0x73329, 0x7b00000, 0x734e5,
+    0x733b3, 0x7350c, 0x7358c, 0x73449, 0x734d3, 0x7780000, 0x73533, 0x73541,
+    0x7f00000, 0x7880000, 0x73405, 0x7364e, 0x7368d, 0x73704, 0x735f3, 0x735d0,
+    0x735af, 0x7880000, 0x7374e, 0x736f3, 0x7900000, 0x7a00000, 0x73814, 0x73561,
+    0x7378d, 0x8300000, 0x73621, 0x7900000, 0x73733, 0x736a1, 0x7b00000, 0x7b00000,
+    0x7384e, 0x7e80000, 0x73762, 0x7360c, 0x738b6, 0x73884, 0x7e80000, 0x73985,
+    0x7b00000, 0x8380000, 0x73972, 0x73829, 0x737d3, 0x739b3, 0x737f3, 0x7600000,
+    0x8400000, 0x8200000, 0x7b00000, 0x7780000, 0x738d3, 0x7a80000, 0x73a08, 0x739f2,
+    0x73865, 0x738f5, 0x73a53, 0x73a65, 0x73aa3, 0x7800000, 0x8480000, 0x7780000,
+    0x73a2c, 0x73a81, 0x73b87, 0x73b79, 0x8280000, 0x7f00000, 0x7394f, 0x8480000,
+    0x739d3, 0x73acf, 0x73b49, 0x8480000, 0x73bd4, 0x73af4, 0x7680000, 0x73b29,
+    0x7f00000, 0x8100000, 0x8500000, 0x7b00000, 0x73be7, 0x73cac, 0x73c54, 0x73d03,
+    0x7e80000, 0x7600000, 0x73c19, 0x73c73, 0x73b06, 0x7680000, 0x73d34, 0x73ba1,
+    0x8100000, 0x7680000, 0x8580000, 0x73c33, 0x7f00000, 0x73dae, 0x73c83, 0x7f00000,
+    0x73e0e, 0x73dd4, 0x7b00000, 0x8500000, 0x7680000, 0x7780000, 0x7780000, 0x7800000,
+    0x73d53, 0x8600000, 0x73d6d, 0x741ab, 0x73e23, 0x73e4c, 0x7c80000, 0x73ee3,
+    0x74179, 0x73cc9, 0x73ce1, 0x73d95, 0x73e69, 0x73f28, 0x0, 0x73f68,
+    0x73f88, 0x73f43, 0x73ec5, 0x737a9, 0x7f00000, 0x73eb3, 0x74049, 0x73e85,
+    0x7780000, 0x73fae, 0x741c5, 0x7a80000, 0x8680000, 0x73fec, 0x7800000, 0x7402f,
+    0x7420d, 0x73df5, 0x74013, 0x74074, 0x74285, 0x742a5, 0x73fd9, 0x740d0,
+    0x742e5, 0x7e80000, 0x740b4, 0x74309, 0x7f00000, 0x74154, 0x7e00000, 0x8000000,
+    0x74393, 0x8480000, 0x7d00000, 0x8400000, 0x8500000, 0x74425, 0x7f00000, 0x8500000,
+    0x74454, 0x742d9, 0x74365, 0x7f00000, 0x743ef, 0x74341, 0x74249, 0x74467,
+    0x7a00000, 0x7f00000, 0x74405, 0x7e80000, 0x74325, 0x743b3, 0x743d3, 0x7448d,
+    0x8080000, 0x744e5, 0x8400000, 0x744cd, 0x7900000, 0x74094, 0x74569, 0x7900000,
+    0x744b3, 0x74581, 0x745a7, 0x7f00000, 0x7f00000, 0x745cf, 0x74509, 0x74621,
+    0x8280000, 0x7c00000, 0x7780000, 0x74533, 0x7464e, 0x74681, 0x74665, 0x74553,
+    0x7460e, 0x746b0, 0x745f3, 0x8500000, 0x746cd, 0x74785, 0x74709, 0x7f00000,
+    0x74909, 0x74734, 0x7474f, 0x7f00000, 0x7f00000, 0x746f3, 0x7900000, 0x749a7,
+    0x74892, 0x74a27, 0x74a63, 0x74873, 0x748b3, 0x747d3, 0x74992, 0x7900000,
+    0x7b00000, 0x748f4, 0x74a05, 0x74922, 0x7f00000, 0x8400000, 0x74ace, 0x74a53,
+    0x74a8e, 0x7e80000, 0x74823, 0x74b49, 0x74ae1, 0x74ab4, 0x74b93, 0x7b00000,
+    0x74b28, 0x74d73, 0x74b6f, 0x7880000, 0x8700000, 0x74c2f, 0x7700000, 0x74de9,
+    0x74b13, 0x7f00000, 0x74d03, 0x7494c, 0x74bd2, 0x7680000, 0x74c12, 0x74c6e,
+    0x8400000, 0x74d94, 0x74cd4, 0x74bb3, 0x74cef, 0x7d00000, 0x74c93, 0x74d53,
+    0x7900000, 0x7f00000, 0x74da9, 0x74dd4, 0x72d14, 0x74e01, 0x74e52, 0x74cb4,
+    0x74ecd, 0x74e21, 0x8780000, 0x74d39, 0x74bf2, 0x74ee5, 0x74ea1, 0x74f33,
+    0x7d80000, 0x75013, 0x74e89, 0x74e70, 0x74f49, 0x7d00000, 0x74fb4, 0x8580000,
+    0x75093, 0x8400000, 0x750d4, 0x75114, 0x8400000, 0x7514e, 0x750f2, 0x7900000,
+    0x7900000, 0x75133, 0x7d00000, 0x751c5, 0x75243, 0x75074, 0x751b3, 0x8280000,
+    0x7502c, 0x75225, 0x8280000, 0x7f00000, 0x750af, 0x752a5, 0x75201, 0x751ec,
+    0x7e00000, 0x8800000, 0x75173, 0x7528e, 0x7b00000, 0x7e80000, 0x75423, 0x75325,
+    0x7530c, 0x8280000, 0x752f4, 0x7b00000, 0x752d3, 0x7b00000, 0x75273, 0x8700000,
+    0x75344, 0x75453, 0x7e80000, 0x7b00000, 0x75543, 0x753a1, 0x8800000, 0x7b00000,
+    0x753f3, 0x7e00000, 0x75365, 0x75474, 0x8280000, 0x75385, 0x754d0, 0x8280000,
+    0x7780000, 0x7c00000, 0x75488, 0x7e80000, 0x8280000, 0x8280000, 0x8280000, 0x75529,
+    0x75181, 0x7556e, 0x754a1, 0x755c1, 0x0, 0x8500000, 0x0, 0x755b2,
+    0x0, 0x7540f, 0x754f3, 0x75688, 0x75663, 0x75587, 0x7e00000, 0x8180000,
+    0x7880000, 0x75613, 0x756e5, 0x7550f, 0x757a4, 0x75655, 0x756ce, 0x8180000,
+    0x75823, 0x7b00000, 0x757c9, 0x75945, 0x75792, 0x756b4, 0x75852, 0x75914,
+    0x75779, 0x7588e, 0x758ee, 0x757f3, 0x7600000, 0x7880000, 0x7598e, 0x759c4,
+    0x8880000, 0x7e80000, 0x75819, 0x75865, 0x7f00000, 0x7680000, 0x7680000, 0x7680000,
+    0x7680000, 0x8800000, 0x8500000, 0x75a4c, 0x7680000, 0x75bfa, 0x758c1, 0x75973,
+    0x758a5, 0x8000000, 0x75d6f, 0x75a85, 0x75a69, 0x75b25, 0x75b04, 0x759f3,
+    0x75a13, 0x75a33, 0x8080000, 0x75ae8, 0x8280000, 0x75aae, 0x75b65, 0x75929,
+    0x8400000, 0x75c84, 0x7f00000, 0x7d00000, 0x75ac9, 0x7680000, 0x75b52, 0x75bb2,
+    0x75ce7, 0x75f21, 0x75c6c, 0x75c14, 0x75bd4, 0x75c4e, 0x75d25, 0x7e00000,
+    0x7b00000, 0x7680000, 0x75d49, 0x8400000, 0x8500000, 0x75cd3, 0x8580000, 0x75d13,
+    0x75e4e, 0x75e8e, 0x75e34, 0x7d00000, 0x8100000, 0x8100000, 0x75d85, 0x75eb2,
+    0x7680000, 0x75ca5, 0x75dd3, 0x7b00000, 0x75e13, 0x75ed9, 0x7f80000, 0x75f08,
+    0x75ef3, 0x7e80000, 0x8100000, 0x75f53, 0x75f72, 0x7700000, 0x8900000, 0x7680000,
+    0x8100000, 0x75e69, 0x75dee, 0x8700000, 0x76003, 0x75ff4, 0x76081, 0x7d00000,
+    0x76113, 0x760c3, 0x760e8, 0x7780000, 0x7b00000, 0x8280000, 0x76152, 0x7f00000,
+    0x76199, 0x76163, 0x7612e, 0x75da3, 0x76021, 0x7f00000, 0x75fb3, 0x7f00000,
+    0x761c4, 0x7e80000, 0x76209, 0x76243, 0x761b4, 0x75fc1, 0x8400000, 0x7680000,
+    0x761e3, 0x7b00000, 0x762ec, 0x76ad9, 0x76292, 0x76325, 0x8280000, 0x7f00000,
+    0x7c80000, 0x7a80000, 0x76065, 0x8980000, 0x76229, 0x76301, 0x762b4, 0x7680000,
+    0x7e80000, 0x7674d, 0x7900000, 0x76269, 0x76407, 0x76373, 0x763e5, 0x7680000,
+    0x7f00000, 0x7680000, 0x76393, 0x7f00000, 0x7f00000, 0x764c7, 0x7e80000, 0x7634c,
+    0x7680000, 0x7680000, 0x763a5, 0x7680000, 0x7f00000, 0x7e80000, 0x76469, 0x7f00000,
+    0x7f00000, 0x7680000, 0x7f00000, 0x76453, 0x763c6, 0x7f00000, 0x7f00000, 0x8a00000,
+    0x7b00000, 0x7662f, 0x8a80000, 0x76493, 0x8b00000, 0x765e4, 0x764b3, 0x8b80000,
+    0x8c00000, 0x8c80000, 0x766c5, 0x8d00000, 0x8e00000, 0x76533, 0x8c00000, 0x76614,
+    0x76674, 0x765d3, 0x764ec, 0x766a9, 0x8d80000, 0x765a1, 0x76433, 0x76505,
+    0x76569, 0x8e80000, 0x76709, 0x8c00000, 0x766f3, 0x76690, 0x8f00000, 0x767ac,
+    0x8f80000, 0x9000000, 0x8c80000, 0x76649, 0x8c80000, 0x9080000, 0x767e3, 0x77bef,
+    0x76873, 0x76732, 0x7690e, 0x768a5, 0x8f00000, 0x759ae, 0x76785, 0x76927,
+    0x76769, 0x9100000, 0x76829, 0x767d3, 0x8a80000, 0x9180000, 0x769a9, 0x76a29,
+    0x76a49, 0x9200000, 0x9100000, 0x76990, 0x76a8c, 0x76973, 0x8c80000, 0x8f80000,
+    0x76b23, 0x9280000, 0x9000000, 0x9300000, 0x76a09, 0x76b49, 0x76819, 0x9100000,
+    0x8b00000, 0x76bd6, 0x76bf3, 0x76af9, 0x769f4, 0x8b00000, 0x76b8e, 0x9380000,
+    0x769d3, 0x8b00000, 0x76b13, 0x76c4e, 0x76b69, 0x76bb9, 0x8b00000, 0x76c2c,
+    0x76c8c, 0x9400000, 0x76cb3, 0x76d84, 0x76953, 0x76d65, 0x76d54, 0x8c00000,
+    0x76cce, 0x76dc5, 0x8f80000, 0x76df3, 0x9480000, 0x76d0b, 0x76e48, 0x9000000,
+    0x9500000, 0x9500000, 0x9580000, 0x76e6e, 0x8f00000, 0x76e8c, 0x9600000, 0x9680000,
+    0x77283, 0x76e36, 0x8b00000, 0x76eae, 0x8b00000, 0x76e13, 0x8b00000, 0x76eec,
+    0x76ec8, 0x76f39, 0x76f45, 0x9100000, 0x9000000, 0x9700000, 0x8f80000, 0x76f8e,
+    0x76f64, 0x76fa1, 0x9080000, 0x9780000, 0x76da5, 0x76f13, 0x76fd3, 0x9100000,
+    0x770ae, 0x77092, 0x76fe5, 0x8c80000, 0x9100000, 0x76d2c, 0x9800000, 0x77025,
+    0x8d00000, 0x9800000, 0x9880000, 0x9180000, 0x770ee, 0x9800000, 0x77012, 0x7704e,
+    0x9900000, 0x8a80000, 0x8a80000, 0x7714e, 0x77134, 0x9980000, 0x9100000, 0x7718b,
+    0x9980000, 0x9a00000, 0x9a80000, 0x7734c, 0x77169, 0x8f80000, 0x77263, 0x8d80000,
+    0x77219, 0x9980000, 0x771b4, 0x9b00000, 0x9b00000, 0x8c80000, 0x9b80000, 0x77233,
+    0x772c1, 0x771d3, 0x773d3, 0x772a9, 0x771f3, 0x77423, 0x77253, 0x77493,
+    0x77412, 0x773a9, 0x77313, 0x9a00000, 0x77449, 0x8a80000, 0x9c00000, 0x774ce,
+    0x77373, 0x77381, 0x774ac, 0x77529, 0x8d80000, 0x8e00000, 0x8e00000, 0x9c80000,
+    0x77514, 0x77479, 0x77335, 0x775a3, 0x9d00000, 0x9100000, 0x9d80000, 0x775e4,
+    0x7754e, 0x9e00000, 0x8a80000, 0x9800000, 0x776a4, 0x9700000, 0x9e80000, 0x774f3,
+    0x7768e, 0x9f00000, 0x9680000, 0x77732, 0x77581, 0x77669, 0x77613, 0x9680000,
+    0x9f80000, 0x755f2, 0x777a5, 0x0, 0x77653, 0x0, 0x0, 0x9080000,
+    0x777cc, 0x77713, 0x77793, 0x77629, 0x77574, 0x776f9, 0x7774d, 0x77889,
+    0x77964, 0x776d3, 0x7784e, 0x8a80000, 0x9800000, 0xa000000, 0x77833, 0x777f2,
+    0x7792e, 0x779c1, 0x7786c, 0x77813, 0x9980000, 0x9000000, 0x778d5, 0x778b9,
+    0x77a09, 0x9800000, 0x9800000, 0x9800000, 0x77a44, 0x77a8c, 0x9100000, 0x77993,
+    0x9d80000, 0x77ac5, 0x77b79, 0x77a61, 0x9d80000, 0x778f5, 0x77ae9, 0x779f3,
+    0x77a33, 0x8c00000, 0x77b89, 0x77bd9, 0x9500000, 0x77bae, 0x77908, 0x77b24,
+    0x77aad, 0x77b09, 0x9380000, 0x9b80000, 0x9180000, 0x77c65, 0x9a00000, 0x77ca9,
+    0x77c81, 0x77cf4, 0xa080000, 0x77b4c, 0x77c4f, 0x74f0c, 0xa100000, 0x9680000,
+    0x77d99, 0x9d80000, 0x79842, 0x77e41, 0x77e29, 0x9180000, 0x77c2e, 0x77c13,
+    0x77cd3, 0x77d4c, 0x77d6e, 0x77dc3, 0x9e00000, 0x77d14, 0xa100000, 0x9980000,
+    0x9000000, 0x8c00000, 0x77ec9, 0x9680000, 0x77da9, 0x8c80000, 0x9800000, 0x77f05,
+    0x77eb3, 0x9100000, 0x9100000, 0x9800000, 0x77e85, 0x8b00000, 0x9b00000, 0x77f72,
+    0x780ec, 0x9180000, 0x77ef3, 0x77fe7, 0x77de5, 0x78005, 0x77fce, 0x8b00000,
+    0x77f29, 0x9200000, 0x9b80000, 0x77f49, 0x78027, 0x77d2c, 0x8c00000, 0x8c00000,
+    0x78065, 0x78045, 0xa180000, 0xa200000, 0x78163, 0x78092, 0x780c1, 0x780b3,
+    0x8c00000, 0x781ac, 0x78112, 0x78181, 0x9e00000, 0x794a6, 0x781ee, 0x78121,
+    0x782c5, 0x78153, 0x7826c, 0x9c00000, 0x9980000, 0x9500000, 0x78309, 0x9500000,
+    0xa280000, 0x781d5, 0x9b80000, 0x78205, 0x9a00000, 0x77e0e, 0x78365, 0x9580000,
+    0xa300000, 0x78221, 0x9000000, 0x9400000, 0x9580000, 0x78325, 0x9980000, 0x9800000,
+    0x8a80000, 0x8a80000, 0x783ec, 0x783c1, 0x78ca7, 0x784cc, 0x78293, 0x78412,
+    0x9b00000, 0x8d00000, 0x9980000, 0x78393, 0x78445, 0x8d00000, 0x78429, 0xa380000,
+    0xa100000, 0x7834e, 0x783ae, 0x785a5, 0x9800000, 0x7848f, 0x9800000, 0x9100000,
+    0x8c00000, 0x9b00000, 0x78472, 0x785c9, 0x78629, 0x785e4, 0xa400000, 0x784b4,
+    0x8a80000, 0x8a80000, 0x9b00000, 0x78593, 0x9b00000, 0xa380000, 0xa080000, 0x786b2,
+    0x7860e, 0x7866e, 0xa380000, 0x8a80000, 0x78705, 0x9380000, 0x786d2, 0x8c80000,
+    0x78853, 0x786e9, 0x7856f, 0x78654, 0xa180000, 0x787c5, 0x8c00000, 0x8b00000,
+    0x8b00000, 0x8b00000, 0x8f00000, 0x8e80000, 0xa100000, 0x78694, 0x782ad, 0x78741,
+    0x9a00000, 0x78873, 0x78793, 0x78721, 0x8a80000, 0x78a32, 0x78829, 0x9980000,
+    0x788c9, 0xa480000, 0x789c5, 0x9b00000, 0x9800000, 0x787f3, 0x78813, 0x7894e,
+    0x9580000, 0x78a0e, 0x9100000, 0x78a69, 0x8a80000, 0x8a80000, 0x9100000, 0x788f3,
+    0x78999, 0x9800000, 0x789b3, 0x78975, 0x789f4, 0x78a4e, 0x9800000, 0x78af2,
+    0x9800000, 0x78a8e, 0x78ad4, 0xa500000, 0x78b05, 0x78b34, 0xa580000, 0xa600000,
+    0x78ba3, 0x78b6c, 0xa680000, 0x78bd3, 0x78c08, 0xa700000, 0xa700000, 0xa780000,
+    0x78b99, 0x78bf6, 0x78c70, 0xa800000, 0x78c33, 0xa680000, 0x78b53, 0x788af,
+    0xa880000, 0xa900000, 0x78c4f, 0xa800000, 0xa800000, 0x78cd4, 0x78d12, 0x78d4e,
+    0x78d83, 0x78cf6, 0x78d21, 0x78253, 0xa980000, 0x78c83, 0xaa00000, 0xa800000,
+    0xaa80000, 0xab00000, 0x78da1, 0x78ded, 0x78dcc, 0xaa00000, 0x78fb4, 0x78e05,
+    0x78d73, 0x78e45, 0xab80000, 0x78e65, 0x78e85, 0xa800000, 0x78f65, 0x78eac,
+    0x78f19, 0x78f85, 0xa580000, 0xac00000, 0xac80000, 0x79007, 0xad00000, 0xa500000,
+    0xaa80000, 0x79029, 0xad80000, 0xa680000, 0xae00000, 0xab80000, 0x78ec5, 0x78f21,
+    0xa880000, 0xae80000, 0xaf00000, 0xaf80000, 0x79125, 0x78ff3, 0xa500000, 0xa800000,
+    0x79073, 0x790b4, 0x79259, 0x79147, 0xaa80000, 0xb000000, 0x79093, 0xb080000,
+    0x790d3, 0xb100000, 0xaa00000, 0x7904e, 0xb180000, 0x79189, 0xa800000, 0xa580000,
+    0xb200000, 0xb280000, 0x792a5, 0xaa80000, 0x79293, 0x790f3, 0x78fc9, 0x791f3,
+    0xb300000, 0x79279, 0xb300000, 0xa600000, 0x79111, 0x79169, 0xb380000, 0x792cd,
+    0xab80000, 0xb400000, 0x791a5, 0xb480000, 0xb500000, 0x79303, 0xb580000, 0xb300000,
+    0x7934c, 0x78554, 0x79334, 0x79392, 0x793c3, 0xb600000, 0x791c9, 0xaf80000,
+    0xaf80000, 0x79467, 0xb680000, 0x792f3, 0xb700000, 0xb780000, 0x79483, 0xaa00000,
+    0xb800000, 0xb700000, 0x794ee, 0x794d3, 0xb880000, 0xb480000, 0xb900000, 0x79369,
+    0x79453, 0xa600000, 0xa980000, 0x793e9, 0x79579, 0xaa00000, 0x79515, 0x795e3,
+    0x793a9, 0xb980000, 0x7922c, 0xac80000, 0xba00000, 0x7962d, 0xb200000, 0xba80000,
+    0x79533, 0xaf80000, 0xbb00000, 0x796c3, 0x7966d, 0x79593, 0xaa00000, 0x7954f,
+    0x795b2, 0x79705, 0x79763, 0xa880000, 0x79699, 0xb700000, 0xbb80000, 0x79783,
+    0xbc00000, 0x7974e, 0x79649, 0xa580000, 0xbc80000, 0x797b0, 0x797ce, 0xaa80000,
+    0x79823, 0x797ef, 0x79809, 0x796ac, 0xb000000, 0x79739, 0x796ec, 0x79885,
+    0x79925, 0x79869, 0xbd00000, 0x7990d, 0x79963, 0xbc00000, 0x79948, 0xba80000,
+    0xb200000, 0x799c3, 0x798b3, 0xb700000, 0x798cf, 0x799a9, 0xbd80000, 0xb980000,
+    0xa880000, 0x79ad2, 0x79b19, 0xb880000, 0x79cd4, 0xbd80000, 0x79b45, 0x79a0e,
+    0x79b2e, 0x799e5, 0xbd80000, 0xbe00000, 0x79a65, 0xa980000, 0x79a33, 0x798ec,
+    0x79a41, 0x79ab3, 0x79b8c, 0xbe80000, 0x79b72, 0x79bad, 0xb480000, 0x79cae,
+    0x79bec, 0x79bc1, 0x79c2c, 0xbf00000, 0xbf80000, 0x79d04, 0xc000000, 0xc080000,
+    0xc100000, 0x79da7, 0x79eed, 0x79cf3, 0x79dc3, 0x79c14, 0x7a174, 0x79d73,
+    0x79c45, 0x79c73, 0x79e64, 0x79d2e, 0xbb00000, 0xb000000, 0x79e49, 0xb500000,
+    0x79d8c, 0x79ea3, 0x79de1, 0xb080000, 0x79e32, 0xc180000, 0xb500000, 0x79e87,
+    0xb180000, 0x79fee, 0x79f83, 0x79fa9, 0xa600000, 0x79ec9, 0xa880000, 0xbf00000,
+    0xc200000, 0x79d53, 0xc200000, 0x7a659, 0x7a003, 0x7a02c, 0x79f13, 0xac80000,
+    0x7a045, 0x79f53, 0x79f30, 0x79e05, 0xc280000, 0xba80000, 0xba80000, 0x7a105,
+    0x7a125, 0xc300000, 0xb600000, 0x7a20e, 0x7a0c5, 0x79f65, 0x7a063, 0xc180000,
+    0xc380000, 0xc400000, 0xc480000, 0x7a187, 0xc500000, 0xc580000, 0xc600000, 0x7b696,
+    0x7b58b, 0x7a0f3, 0x7a14c, 0xc680000, 0x7a1e5, 0xc700000, 0x0, 0x79fcc,
+    0xc780000, 0x7a1a9, 0x7a0a9, 0x7a085, 0x7a345, 0x7a221, 0x7a2c3, 0xc800000,
+    0x7a32e, 0x7a367, 0xc880000, 0xc680000, 0xc900000, 0x7a38c, 0x7a293, 0x7a3f3,
+    0xc980000, 0x7a2ac, 0x7a3cc, 0xca00000, 0xca80000, 0xcb00000, 0x7a249, 0xcb80000,
+    0xcc00000, 0x7a623, 0x7a501, 0x7a413, 0xcc80000, 0x7a4b3, 0xcd00000, 0x7a4ce,
+    0x7a532, 0xcd80000, 0xc980000, 0x7a549, 0x7a2e9, 0x7a441, 0x7a589, 0xc800000,
+    0x7a4f3, 0x7a56f, 0xce00000, 0xce80000, 0xcf00000, 0xcd80000, 0xc800000, 0xcd00000,
+    0xcf80000, 0x7a681, 0xd000000, 0x7a5b4, 0x7a70e, 0x7a5f5, 0xd080000, 0x7a434,
+    0x7a673, 0x7a6e5, 0xd100000, 0xc980000, 0xd180000, 0xc380000, 0xd200000, 0xd280000,
+    0x7a46f, 0xcf80000, 0x7a7d9, 0xc700000, 0xd300000, 0x7a78e, 0x7a7f3, 0xd180000,
+    0x7a813, 0xcc00000, 0x7a8c5, 0xd380000, 0xd400000, 0x7a84d, 0xd480000, 0x7a773,
+    0xc900000, 0xc900000, 0x7a7b3, 0xd500000, 0xd100000, 0x7a8e3, 0x7a6a1, 0x7a735,
+    0x7a92e, 0xd580000, 0x7a873, 0x7a905, 0x7a893, 0xc800000, 0x7a5c7, 0x7a8a5,
+    0xc700000, 0xd600000, 0x7a955, 0xd680000, 0x7a995, 0x7a9a9, 0xc700000, 0x7a9c5,
+    0x7a9e3, 0xd700000, 0x7a96f, 0x7a753, 0x7aa4e, 0xd680000, 0xd780000, 0x7aa87,
+    0xd800000, 0xd780000, 0xd880000, 0xd380000, 0xd900000, 0x7aa0e, 0x7aa21, 0xd980000,
+    0x7aad9, 0x7aaee, 0x7ab61, 0xcf80000, 0x7aa72, 0xda00000, 0xda80000, 0xdb00000,
+    0xdb80000, 0x7ab29, 0x7ab8c, 0xc380000, 0x7aab3, 0xcc00000, 0xdc00000, 0x7ab13,
+    0x7abee, 0xdc80000, 0x7ab49, 0xdd00000, 0xdc80000, 0x7ac43, 0x7aba1, 0x7acad,
+    0xd600000, 0x7abd3, 0xdc80000, 0x7ac6f, 0xdd80000, 0x7acce, 0x7ac81, 0xc900000,
+    0xd780000, 0xde00000, 0xc700000, 0x7ae33, 0x7ac13, 0x7ac2f, 0x7ad0f, 0xd180000,
+    0xde80000, 0xdf00000, 0x7ae44, 0x78aa8, 0xc880000, 0x7ad52, 0x7ad35, 0xdf80000,
+    0x7aee3, 0x7ad61, 0x7acf3, 0x7ae09, 0xe000000, 0x7add3, 0x7af52, 0x7ae99,
+    0x7af33, 0xe080000, 0xe080000, 0xe100000, 0xe180000, 0x7af8c, 0x7af68, 0xe200000,
+    0xe280000, 0x7ad8c, 0x7aeb3, 0x7b025, 0x7ae79, 0xe300000, 0x7adb4, 0xe380000,
+    0xe400000, 0xe480000, 0x7b093, 0x7b065, 0x7b0a1, 0x7b0c3, 0x7b14c, 0x7b123,
+    0x78921, 0xe500000, 0xe580000, 0xe600000, 0x0, 0x7aed2, 0x7af09, 0xe680000,
+    0x7b003, 0x7afc1, 0x7b179, 0xe700000, 0x7b053, 0xe780000, 0xe800000, 0xe880000,
+    0x7b0ec, 0x7b1c5, 0xe900000, 0xe700000, 0xe980000, 0x7b225, 0xe680000, 0x7b2f9,
+    0xea00000, 0x7b20f, 0x7b1b3, 0x7b715, 0x7b245, 0x7b2b4, 0xea80000, 0x7b185,
+    0x7b2c7, 0x7b1e5, 0xeb00000, 0x7afee, 0xe080000, 0xe080000, 0xeb80000, 0x7a6c8,
+    0xec00000, 0x7b30e, 0x7b343, 0x7b36e, 0xe600000, 0x7b40c, 0xec80000, 0xed00000,
+    0xed00000, 0x7b4a7, 0xeb80000, 0x0, 0x7b334, 0xed80000, 0xee00000, 0xee80000,
+    0x7b38f, 0x7b4ec, 0x7b3a7, 0x7b3d4, 0x7b439, 0x7b472, 0xe600000, 0x7b56e,
+    0x7b52c, 0xef00000, 0xef80000, 0x7b5c3, 0xf000000, 0xf080000, 0x7b48e, 0xf100000,
+    0x7b513, 0xf180000, 0xf200000, 0x7b5b2, 0xf280000, 0x7b272, 0x7b554, 0x7b5ec,
+    0x7b605, 0xf300000, 0xf100000, 0xf380000, 0xf400000, 0x7b659, 0x7b679, 0x7b621,
+    0x7b4c3, 0xf480000, 0xf500000, 0xf580000, 0x7b454, 0xf600000, 0xf680000, 0x7b759,
+    0x7b6b2, 0xf700000, 0xf780000, 0x7b3ec, 0x7b794, 0xf800000, 0xf880000, 0xf900000,
+    0xf980000, 0x7b7da, 0x7b7ae, 0xfa00000, 0x7b80c, 0x7b7ee, 0xfa80000, 0x7b825,
+    0xfb00000, 0xfb80000, 0x7b8c9, 0xfc00000, 0x7b773, 0xfc80000, 0x7b8e9, 0xfd00000,
+    0xfd80000, 0xfe00000, 0x7b90e, 0xfe80000, 0x7ba19, 0x7b6c9, 0x7b841, 0x7b985,
+    0xff00000, 0x7b6e5, 0xff80000, 0x10000000, 0x7ba25, 0x7b86f, 0x7b9a8, 0x7b8b5,
+    0x7ba79, 0x7b885, 0x10080000, 0x10100000, 0x10180000, 0x7ba4c, 0x7b933, 0x0,
+    0x7b9e9, 0x10200000, 0x7bae5, 0x7b9c5, 0x7bb45, 0x7bb65, 0x7bace, 0x7ba81,
+    0x10280000, 0x10300000, 0x7bc03, 0x7bb15, 0x10380000, 0x10400000, 0x7bab9, 0x7bbed,
+    0x10480000, 0x10500000, 0x10580000, 0x10600000, 0x7bbd3, 0x10680000, 0x7bc92, 0x10700000,
+    0x7bb35, 0x7bc54, 0x10780000, 0x10780000, 0x7bc2e, 0x7bce7, 0x10800000, 0x10880000,
+    0x7bd0c, 0x7bba1, 0x10900000, 0x7bb94, 0x10980000, 0x7bd4d, 0x7bda5, 0x10a00000,
+    0x10a80000, 0x7bdcc, 0x10b00000, 0x10b80000, 0x7bcb3, 0x10c00000, 0x10c80000, 0x7bcd3,
+    0x0, 0x0, 0x7be09, 0x7bea3, 0x7be28, 0x10d00000, 0x7bde5, 0x7bd73,
+    0x10d80000, 0x7bd34, 0x7bd94, 0x7bf05, 0x7bec9, 0x0, 0x7be4f, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7be72, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+};
+static const uint8_t HYPH_EN_US_VALUES[] = {
+    0, 0, 2, 2, 2, 1, 1, 2, 0, 1, 4, 1, 1, 1, 2, 1, 2, 0, 2, 2, 1, 0, 3, 2,
+    5, 2, 0, 1, 2, 0, 2, 4, 1, 0, 2, 4, 3, 0, 2, 4, 5, 1, 2, 2, 2, 2, 1, 4,
+    0, 3, 1, 4, 4, 0, 1, 1, 0, 3, 4, 3, 2, 1, 1, 3, 1, 1, 5, 2, 1, 1, 0, 2,
+    1, 2, 0, 3, 2, 1, 2, 0, 3, 4, 1, 4, 1, 2, 1, 4, 1, 2, 1, 2, 1, 2, 5, 2,
+    0, 2, 2, 3, 0, 1, 3, 1, 2, 4, 2, 0, 3, 4, 1, 2, 0, 3, 4, 0, 4, 0, 3, 2,
+    0, 4, 0, 3, 4, 5, 4, 0, 1, 5, 0, 3, 4, 0, 2, 0, 3, 1, 2, 2, 0, 3, 2, 3,
+    2, 1, 1, 4, 0, 3, 2, 0, 2, 0, 3, 1, 0, 2, 1, 2, 3, 2, 3, 1, 4, 3, 1, 2,
+    3, 1, 3, 3, 1, 1, 0, 2, 4, 2, 1, 2, 4, 4, 2, 1, 3, 2, 2, 4, 2, 0, 3, 4,
+    0, 5, 0, 4, 4, 0, 0, 4, 0, 4, 5, 0, 0, 4, 0, 2, 2, 5, 0, 4, 3, 0, 0, 2,
+    2, 1, 5, 0, 2, 3, 4, 3, 1, 5, 0, 3, 2, 3, 4, 2, 2, 2, 2, 0, 3, 1, 4, 3,
+    0, 3, 1, 0, 1, 1, 2, 1, 1, 0, 3, 4, 0, 3, 2, 2, 2, 4, 2, 2, 4, 1, 1, 3,
+    4, 0, 4, 2, 2, 3, 4, 1, 3, 2, 0, 5, 0, 3, 1, 0, 4, 0, 3, 3, 4, 4, 0, 3,
+    2, 5, 3, 1, 3, 4, 0, 2, 0, 3, 2, 0, 1, 0, 3, 4, 0, 1, 0, 2, 5, 2, 0, 3,
+    4, 4, 4, 0, 2, 4, 4, 0, 4, 2, 0, 0, 4, 2, 2, 2, 1, 0, 3, 3, 0, 4, 1, 3,
+    2, 0, 4, 0, 3, 3, 0, 1, 0, 2, 1, 4, 0, 3, 5, 0, 4, 1, 3, 1, 0, 4, 1, 3,
+    3, 0, 4, 2, 2, 4, 4, 1, 2, 2, 5, 2, 2, 2, 3, 2, 2, 4, 3, 0, 3, 5, 0, 3,
+    1, 2, 4, 1, 0, 3, 2, 1, 4, 1, 2, 5, 4, 0, 4, 3, 0, 0, 4, 1, 2, 4, 5, 4,
+    1, 4, 4, 1, 2, 4, 1, 5, 4, 1, 3, 4, 1, 1, 1, 3, 5, 0, 5, 2, 2, 3, 3, 2,
+    3, 5, 0, 4, 2, 2, 5, 5, 0, 4, 5, 5, 0, 4, 2, 2, 2, 5, 1, 3, 4, 0, 3, 1,
+    2, 4, 3, 1, 4, 5, 0, 0, 5, 1, 4, 3, 0, 0, 3, 2, 3, 1, 0, 2, 1, 4, 1, 0,
+    0, 4, 3, 2, 2, 5, 1, 3, 1, 0, 3, 3, 2, 5, 4, 0, 2, 5, 4, 0, 3, 4, 3, 3,
+    0, 4, 5, 0, 0, 5, 2, 3, 5, 0, 5, 3, 2, 3, 4, 0, 3, 5, 0, 5, 2, 3, 4, 0,
+    4, 1, 4, 4, 0, 0, 4, 0, 3, 5, 5, 2, 0, 4, 4, 0, 0, 5, 1, 3, 2, 5, 5, 1,
+    4, 2, 0, 0, 4, 1, 4, 5, 0, 0, 4, 3, 2, 4, 5, 1, 2, 5, 5, 3, 2, 1, 3, 1,
+    3, 4, 0, 5, 2, 2, 5, 4, 0, 3, 3, 0, 3, 0, 2, 1, 1, 2, 3, 3, 0, 5, 3, 2,
+    5, 2, 3, 2, 3, 3, 3, 2, 3, 2, 2, 3, 2, 0, 2, 0, 4, 5, 0, 0, 3, 1, 3, 4,
+    0, 1, 0, 2, 5, 5, 5, 1, 5, 5, 1, 3, 4, 2, 3, 4, 4, 2, 5, 5, 5, 1, 4, 4,
+    2, 5, 4, 0, 4, 3, 0, 0, 5, 3, 2, 5, 5, 1, 4, 4, 3, 0, 3, 2, 3, 3, 0, 3,
+    1, 2, 3, 3, 3, 2, 4, 4, 3, 3, 3, 0, 3, 4, 2, 4, 3, 4, 2, 4, 5, 0, 5, 5,
+    0, 0, 0, 4, 6, 1, 5, 3, 3, 5, 0, 5, 6, 1, 4, 0, 5, 5, 0, 0, 5, 5, 4, 3,
+    5, 0, 5, 2, 4, 10, 10, 10, 10, 7, 1, 5, 2, 4, 10, 10, 11, 10, 2, 4, 10, 11, 10, 10,
+    2, 5, 10, 10, 11, 10, 10, 2, 5, 10, 10, 10, 10, 10, 2, 5, 10, 10, 10, 11, 10, 2, 5, 10,
+    11, 10, 10, 10, 2, 5, 10, 10, 11, 10, 11, 2, 5, 10, 11, 10, 11, 10, 2, 6, 10, 10, 10, 11,
+    11, 10, 2, 6, 10, 10, 10, 11, 10, 10, 2, 6, 10, 10, 11, 11, 10, 10, 2, 6, 10, 11, 11, 10,
+    10, 10, 2, 6, 10, 11, 10, 10, 10, 10, 2, 6, 10, 10, 11, 10, 10, 10, 2, 6, 10, 10, 10, 10,
+    11, 10, 2, 6, 10, 10, 10, 10, 10, 10, 2, 6, 10, 11, 10, 11, 11, 10, 2, 6, 10, 11, 10, 10,
+    11, 10, 2, 6, 10, 11, 10, 11, 10, 10, 2, 6, 10, 10, 11, 10, 11, 10, 2, 6, 10, 11, 10, 10,
+    11, 11, 2, 7, 10, 10, 10, 11, 10, 10, 10, 2, 7, 10, 11, 11, 10, 10, 10, 10, 2, 7, 10, 10,
+    10, 10, 11, 10, 10, 2, 7, 10, 11, 10, 11, 10, 10, 10, 2, 7, 10, 11, 10, 10, 11, 11, 10, 2,
+    7, 10, 11, 10, 10, 11, 10, 10, 2, 7, 10, 11, 10, 10, 10, 10, 10, 2, 7, 11, 10, 10, 10, 10,
+    11, 10, 2, 7, 10, 11, 10, 10, 10, 11, 10, 2, 7, 10, 10, 11, 10, 10, 10, 10, 2, 7, 10, 10,
+    11, 11, 10, 10, 10, 2, 7, 10, 10, 10, 10, 10, 10, 10, 2, 7, 10, 10, 11, 10, 11, 10, 10, 2,
+    7, 10, 10, 11, 10, 10, 11, 10, 2, 7, 10, 11, 11, 10, 10, 11, 10, 2, 7, 10, 11, 10, 11, 10,
+    11, 10, 2, 7, 10, 10, 10, 11, 10, 11, 10, 2, 7, 10, 11, 10, 10, 10, 11, 11, 2, 7, 10, 10,
+    10, 10, 10, 11, 10, 2, 7, 10, 10, 10, 11, 11, 10, 10, 2, 8, 10, 10, 10, 11, 11, 10, 10, 10,
+    2, 8, 10, 10, 10, 11, 10, 10, 10, 10, 2, 8, 10, 10, 10, 11, 10, 11, 10, 10, 2, 8, 10, 11,
+    10, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 11, 10, 10, 11, 10, 2, 8, 10, 11, 10, 11, 10, 10,
+    10, 10, 2, 8, 11, 10, 10, 10, 11, 10, 10, 10, 2, 8, 10, 11, 10, 10, 10, 11, 10, 10, 2, 8,
+    10, 11, 10, 10, 11, 11, 10, 10, 2, 8, 10, 10, 11, 10, 10, 11, 10, 10, 2, 8, 10, 10, 10, 10,
+    11, 10, 10, 10, 2, 8, 10, 11, 10, 10, 10, 11, 11, 10, 2, 8, 10, 10, 11, 10, 11, 10, 10, 10,
+    2, 8, 10, 10, 11, 11, 10, 10, 10, 10, 2, 8, 10, 11, 10, 11, 10, 11, 10, 10, 2, 8, 10, 10,
+    11, 10, 10, 10, 10, 10, 2, 8, 10, 10, 10, 10, 10, 11, 10, 10, 2, 8, 10, 11, 10, 11, 11, 10,
+    10, 10, 2, 8, 10, 10, 10, 11, 11, 11, 10, 10, 2, 8, 10, 10, 11, 10, 10, 10, 11, 10, 2, 8,
+    10, 10, 11, 10, 11, 11, 10, 10, 2, 8, 10, 11, 10, 10, 10, 10, 11, 10, 2, 8, 10, 10, 11, 11,
+    10, 11, 10, 10, 2, 8, 10, 10, 10, 11, 10, 10, 11, 10, 2, 8, 10, 10, 11, 11, 10, 10, 11, 10,
+    2, 8, 10, 11, 10, 10, 11, 10, 11, 10, 2, 8, 10, 11, 10, 10, 10, 10, 10, 10, 2, 8, 10, 10,
+    10, 10, 11, 11, 10, 10, 2, 9, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11,
+    10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10,
+    10, 10, 2, 9, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 9, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+    2, 9, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 11, 11, 10, 10, 2, 9,
+    10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 9, 10, 11, 10, 10, 11, 10, 10, 11, 10, 2, 9, 10, 10,
+    11, 10, 10, 11, 10, 10, 10, 2, 9, 11, 10, 10, 10, 10, 11, 11, 10, 10, 2, 9, 10, 11, 10, 10,
+    10, 11, 11, 10, 10, 2, 9, 10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10,
+    10, 11, 10, 2, 9, 10, 10, 11, 10, 10, 11, 11, 10, 10, 2, 9, 10, 10, 11, 10, 10, 10, 10, 10,
+    10, 2, 9, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2,
+    9, 10, 10, 10, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 11, 10, 10, 2, 9, 10,
+    10, 11, 11, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 9, 10, 11, 10,
+    10, 10, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 11, 10,
+    11, 10, 10, 10, 2, 9, 10, 10, 11, 11, 10, 11, 10, 10, 10, 2, 9, 10, 11, 10, 11, 11, 10, 10,
+    10, 10, 2, 9, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 9, 10, 10, 11, 10, 11, 10, 11, 10, 10,
+    2, 9, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 9, 10, 10, 10, 10, 11, 10, 10, 11, 10, 2, 9,
+    10, 11, 10, 11, 10, 10, 10, 11, 10, 2, 9, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 9, 10, 10,
+    11, 10, 10, 10, 10, 11, 10, 2, 9, 10, 10, 10, 11, 11, 10, 10, 11, 10, 2, 9, 10, 10, 11, 10,
+    11, 10, 10, 11, 10, 2, 9, 10, 10, 11, 10, 10, 11, 10, 11, 10, 2, 9, 10, 10, 10, 10, 10, 10,
+    11, 11, 10, 2, 9, 10, 11, 10, 10, 10, 10, 10, 11, 10, 2, 9, 10, 10, 10, 10, 10, 11, 10, 11,
+    10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10,
+    10, 2, 10, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10,
+    10, 2, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10,
+    10, 2, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 2, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10,
+    10, 2, 10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 2, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10,
+    10, 2, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10,
+    10, 2, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10,
+    10, 2, 10, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 10, 11, 10, 11,
+    10, 2, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 2, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10,
+    10, 2, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10,
+    10, 2, 10, 10, 10, 10, 10, 10, 11, 11, 10, 10, 10, 2, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+    10, 2, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 10, 10, 10, 11, 11, 10, 11, 10, 10, 10,
+    10, 2, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 2, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10,
+    10, 2, 10, 10, 11, 11, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10,
+    10, 2, 10, 10, 10, 10, 10, 10, 11, 10, 11, 10, 10, 2, 10, 10, 11, 11, 10, 10, 10, 10, 10, 10,
+    10, 2, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10,
+    10, 2, 10, 10, 10, 10, 11, 10, 10, 11, 11, 10, 10, 2, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10,
+    10, 2, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    10, 2, 10, 10, 11, 10, 10, 11, 11, 10, 11, 10, 10, 2, 10, 10, 10, 10, 11, 10, 11, 10, 11, 10,
+    10, 2, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10,
+    10, 2, 10, 10, 10, 11, 11, 10, 10, 10, 11, 10, 10, 2, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10,
+    10, 2, 10, 10, 10, 10, 11, 10, 11, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 11, 10, 11, 11, 10,
+    10, 2, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 2, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10,
+    10, 2, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 2, 10, 10, 11, 10, 10, 10, 11, 11, 10, 11,
+    10, 2, 10, 10, 10, 11, 11, 10, 10, 10, 11, 11, 10, 2, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10,
+    10, 2, 10, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10,
+    10, 2, 10, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 2, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10,
+    10, 10, 2, 11, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 11, 10, 10, 10, 11, 11,
+    10, 10, 10, 10, 2, 11, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 11, 10, 11, 10, 10, 11,
+    10, 10, 11, 11, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 10,
+    11, 10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10,
+    10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 11, 10, 10, 11, 10, 11, 10, 10, 11, 11, 10, 10, 2,
+    11, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 11, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10,
+    10, 2, 11, 10, 10, 11, 11, 10, 10, 10, 10, 10, 11, 10, 2, 11, 10, 10, 11, 10, 10, 11, 10, 11,
+    10, 10, 10, 2, 11, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10,
+    10, 10, 10, 10, 10, 2, 11, 10, 10, 11, 10, 10, 11, 10, 11, 11, 10, 10, 2, 11, 10, 10, 10, 10,
+    10, 11, 11, 10, 10, 10, 10, 2, 11, 10, 10, 11, 11, 10, 11, 10, 10, 10, 11, 10, 2, 11, 10, 10,
+    11, 10, 10, 10, 10, 10, 10, 11, 10, 2, 11, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 11,
+    10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10,
+    2, 11, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10,
+    10, 10, 2, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 11,
+    10, 11, 10, 10, 2, 11, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 2, 11, 10, 11, 10, 10, 11,
+    10, 10, 10, 11, 10, 10, 2, 11, 10, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 2, 11, 10, 10, 10,
+    11, 11, 10, 10, 10, 10, 11, 10, 2, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10,
+    10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2,
+    11, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 2, 11, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10,
+    10, 2, 11, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 2, 11, 10, 10, 10, 11, 11, 10, 10, 10,
+    10, 10, 10, 2, 11, 10, 10, 11, 11, 10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 11,
+    10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 2, 11, 10, 10, 11, 10,
+    10, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 2, 11, 10, 10,
+    10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 11, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 2, 11,
+    10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 2, 11, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10, 10,
+    2, 11, 10, 10, 11, 10, 10, 11, 11, 10, 10, 11, 10, 2, 11, 10, 10, 10, 11, 11, 10, 10, 11, 10,
+    10, 10, 2, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 11, 10, 10, 10, 11, 10, 11, 10,
+    10, 10, 11, 10, 2, 11, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 11, 10, 11, 10, 10, 11,
+    10, 11, 10, 10, 10, 10, 2, 11, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 11, 10, 10, 11,
+    10, 11, 10, 10, 11, 10, 11, 10, 2, 11, 10, 10, 10, 11, 11, 10, 10, 11, 11, 10, 10, 2, 11, 10,
+    10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 2, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 2,
+    11, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 11, 10, 10, 10, 10, 11, 10, 10, 11, 10, 11,
+    10, 2, 11, 10, 11, 10, 10, 10, 10, 10, 11, 10, 11, 10, 2, 12, 10, 10, 10, 10, 11, 10, 10, 10,
+    11, 10, 10, 10, 2, 12, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 12, 10, 11, 10, 10,
+    11, 10, 10, 10, 10, 10, 10, 10, 2, 12, 10, 11, 10, 11, 10, 10, 11, 11, 10, 10, 11, 10, 2, 12,
+    10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 2, 12, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10,
+    10, 10, 2, 12, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 10,
+    11, 10, 10, 11, 10, 10, 2, 12, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 2, 12, 10, 11,
+    10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10,
+    2, 12, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 11, 10, 10, 11, 10, 10,
+    10, 11, 10, 10, 2, 12, 10, 10, 11, 10, 10, 10, 10, 11, 10, 11, 10, 10, 2, 12, 10, 10, 10, 11,
+    10, 10, 10, 10, 11, 10, 10, 10, 2, 12, 10, 11, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 12,
+    10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11,
+    10, 10, 2, 12, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 11, 10, 10, 11,
+    10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 12, 10, 11,
+    10, 11, 10, 10, 11, 11, 10, 10, 10, 10, 2, 12, 10, 11, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10,
+    2, 12, 10, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 10, 11, 10,
+    10, 10, 10, 10, 2, 12, 10, 11, 10, 10, 11, 11, 10, 10, 11, 11, 10, 10, 2, 12, 10, 11, 10, 10,
+    11, 10, 11, 10, 10, 11, 10, 10, 2, 12, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 12,
+    10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 10, 11, 11, 10, 10, 11, 10, 10,
+    10, 10, 2, 12, 10, 10, 10, 11, 11, 10, 11, 10, 11, 10, 10, 10, 2, 12, 10, 10, 11, 10, 11, 10,
+    10, 11, 11, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 12, 10, 10,
+    11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 2, 12, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 10,
+    2, 12, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 11, 10, 2, 12, 10, 10, 11, 10, 10, 11, 11, 10,
+    11, 10, 11, 10, 2, 12, 10, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 12, 10, 10, 10, 11,
+    10, 11, 10, 10, 10, 10, 10, 10, 2, 12, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 12,
+    10, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 12, 10, 10, 11, 10, 10, 11, 11, 10, 10, 10,
+    11, 10, 2, 12, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 12, 10, 10, 10, 11, 10, 11,
+    10, 10, 11, 10, 11, 10, 2, 12, 10, 10, 11, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 12, 10, 11,
+    10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 12, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10,
+    2, 12, 10, 10, 11, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 12, 10, 11, 10, 10, 10, 10, 11, 10,
+    10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10,
+    10, 11, 10, 10, 10, 10, 10, 10, 2, 12, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 2, 12,
+    10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 2, 12, 10, 10, 10, 11, 10, 10, 10, 10, 11, 11,
+    10, 10, 2, 12, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 12, 10, 11, 10, 11, 10, 10,
+    10, 10, 10, 10, 10, 10, 2, 13, 10, 10, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 2, 13, 10,
+    11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 13, 10, 10, 10, 11, 10, 11, 10, 10, 10, 11,
+    10, 10, 10, 2, 13, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10, 2, 13, 10, 11, 10, 10,
+    11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 13, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 11, 10, 10,
+    2, 13, 10, 10, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 13, 10, 10, 10, 10, 10, 11, 10,
+    10, 10, 11, 10, 10, 10, 2, 13, 10, 11, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 13, 10,
+    10, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 13, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10,
+    11, 10, 10, 2, 13, 10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 2, 13, 10, 11, 10, 11,
+    10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 13, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10,
+    2, 13, 10, 11, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 2, 13, 10, 10, 10, 10, 11, 10, 10,
+    11, 10, 10, 10, 10, 10, 2, 13, 10, 10, 10, 11, 11, 10, 11, 10, 11, 10, 10, 10, 10, 2, 13, 10,
+    10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 11, 10, 2, 13, 10, 10, 10, 10, 11, 10, 10, 11, 10, 10,
+    11, 10, 10, 2, 13, 10, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 10, 2, 13, 10, 10, 10, 10,
+    11, 10, 10, 10, 10, 11, 10, 10, 10, 2, 13, 10, 10, 11, 10, 11, 11, 10, 10, 10, 11, 10, 10, 10,
+    2, 13, 10, 10, 11, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 2, 13, 10, 10, 10, 10, 11, 10, 11,
+    11, 10, 11, 10, 10, 10, 2, 13, 10, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 11, 10, 2, 13, 10,
+    10, 10, 11, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 13, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10,
+    10, 10, 10, 2, 13, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 13, 10, 10, 11, 10,
+    11, 10, 10, 10, 11, 11, 10, 10, 10, 2, 13, 10, 10, 11, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10,
+    2, 13, 10, 10, 11, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 13, 10, 10, 10, 10, 11, 10, 10,
+    11, 10, 11, 10, 10, 10, 2, 13, 10, 11, 10, 11, 10, 10, 10, 11, 10, 11, 10, 11, 10, 2, 14, 10,
+    11, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 11, 10, 2, 14, 10, 10, 10, 11, 10, 10, 10, 10, 11,
+    11, 10, 10, 10, 10, 2, 14, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 14, 10,
+    10, 11, 10, 11, 11, 10, 10, 10, 11, 10, 11, 10, 10, 2, 14, 10, 10, 10, 11, 10, 11, 10, 11, 10,
+    10, 10, 11, 10, 10, 2, 14, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 2, 14, 10,
+    10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 14, 10, 11, 10, 10, 10, 10, 10, 11, 10,
+    10, 10, 11, 10, 10, 2, 14, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 2, 14, 10,
+    10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 2, 14, 10, 11, 10, 10, 11, 10, 10, 11, 10,
+    10, 10, 11, 10, 10, 2, 14, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 2, 14, 10,
+    11, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 14, 10, 10, 10, 11, 10, 11, 10, 10, 10,
+    11, 11, 10, 10, 10, 2, 14, 10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2, 14, 10,
+    10, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 14, 10, 10, 10, 10, 11, 10, 10, 10, 10,
+    10, 11, 10, 10, 10, 2, 14, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 2, 14, 10,
+    11, 10, 10, 11, 10, 10, 11, 11, 10, 10, 11, 10, 10, 2, 14, 10, 11, 10, 10, 11, 11, 10, 10, 11,
+    10, 11, 10, 10, 10, 2, 14, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 2, 14, 10,
+    10, 11, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 2, 14, 10, 10, 11, 10, 11, 10, 11, 10, 11,
+    10, 10, 11, 10, 10, 2, 14, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 2, 14, 10,
+    10, 11, 10, 11, 10, 10, 11, 10, 11, 10, 11, 10, 10, 2, 14, 10, 10, 10, 10, 11, 10, 10, 11, 10,
+    10, 10, 11, 10, 10, 2, 14, 10, 10, 11, 10, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 2, 14, 10,
+    10, 11, 10, 11, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 14, 10, 10, 11, 10, 10, 11, 10, 10, 11,
+    10, 11, 10, 10, 10, 2, 14, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 11, 10, 10, 10, 2, 15, 10,
+    11, 10, 10, 10, 11, 10, 10, 11, 10, 10, 11, 10, 10, 10, 2, 15, 10, 10, 11, 11, 10, 10, 10, 10,
+    10, 11, 11, 10, 10, 10, 10, 2, 15, 10, 10, 11, 10, 10, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10,
+    2, 15, 10, 11, 10, 11, 10, 11, 10, 10, 11, 11, 10, 11, 10, 11, 10, 2, 15, 10, 10, 10, 10, 11,
+    10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 2, 15, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 11,
+    10, 10, 10, 2, 15, 10, 10, 11, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 2, 15, 10, 11,
+    10, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 15, 10, 10, 10, 10, 11, 10, 10, 10, 11,
+    10, 11, 10, 10, 10, 10, 2, 15, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 10, 2,
+    15, 10, 10, 11, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 2, 16, 10, 10, 10, 11, 10, 10,
+    11, 11, 10, 11, 10, 10, 10, 11, 10, 10, 2, 16, 10, 10, 11, 10, 11, 10, 11, 10, 11, 10, 10, 11,
+    10, 10, 10, 10, 2, 16, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 11, 11, 10, 10, 2, 16,
+    10, 10, 10, 11, 10, 10, 11, 10, 10, 10, 11, 11, 10, 10, 11, 10, 2, 16, 10, 11, 10, 10, 11, 10,
+    10, 11, 10, 11, 10, 10, 11, 10, 10, 10, 2, 16, 10, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10,
+    10, 10, 10, 10, 2, 16, 10, 10, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 2, 16,
+    10, 10, 11, 10, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 10, 10, 2, 16, 10, 10, 10, 10, 10, 11,
+    10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 2, 17, 10, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10, 11,
+    10, 10, 11, 10, 10, 2, 17, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 11, 10, 10,
+    2, 17, 10, 11, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 2, 17, 10, 10, 10,
+    11, 10, 11, 10, 10, 11, 10, 10, 11, 10, 11, 10, 10, 10, 2, 17, 10, 10, 10, 10, 11, 10, 10, 10,
+    10, 11, 10, 10, 10, 11, 10, 10, 10, 2, 18, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 11, 10,
+    10, 11, 10, 10, 10, 2, 18, 10, 10, 10, 11, 10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10,
+    10, 2, 18, 10, 10, 10, 11, 10, 10, 11, 10, 11, 10, 11, 11, 10, 10, 11, 11, 10, 10, 2, 21, 10,
+    10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 2, 25, 10, 10,
+    10, 11, 10, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10, 10, 10, 11, 10, 10, 10, 11, 10, 10,
+};
+static const uint16_t HYPH_EN_US_VALUE_OFFSETS[] = {
+    0, 1, 5, 8, 11, 14, 17, 21, 26, 29, 33, 37, 41, 45, 48, 53,
+    56, 61, 64, 67, 70, 74, 79, 84, 88, 92, 96, 100, 103, 107, 112, 117,
+    122, 127, 130, 135, 140, 145, 148, 153, 158, 162, 165, 168, 171, 174, 178, 182,
+    185, 189, 194, 200, 206, 210, 216, 219, 223, 226, 231, 235, 240, 245, 249, 254,
+    258, 262, 267, 271, 276, 281, 286, 291, 296, 301, 306, 310, 315, 319, 325, 329,
+    334, 339, 344, 348, 353, 358, 363, 367, 371, 375, 379, 384, 388, 393, 397, 403,
+    407, 410, 413, 416, 419, 422, 427, 431, 436, 440, 446, 450, 455, 459, 465, 471,
+    476, 482, 486, 491, 495, 499, 504, 510, 515, 519, 524, 529, 535, 540, 546, 551,
+    557, 563, 567, 571, 575, 580, 584, 589, 593, 598, 602, 606, 610, 615, 621, 626,
+    630, 633, 636, 640, 644, 647, 651, 657, 661, 667, 672, 676, 680, 685, 689, 693,
+    700, 703, 708, 711, 718, 723, 729, 732, 738, 744, 751, 758, 765, 772, 779, 786,
+    794, 802, 810, 818, 826, 834, 842, 850, 858, 866, 874, 882, 890, 899, 908, 917,
+    926, 935, 944, 953, 962, 971, 980, 989, 998, 1007, 1016, 1025, 1034, 1043, 1052, 1061,
+    1070, 1080, 1090, 1100, 1110, 1120, 1130, 1140, 1150, 1160, 1170, 1180, 1190, 1200, 1210, 1220,
+    1230, 1240, 1250, 1260, 1270, 1280, 1290, 1300, 1310, 1320, 1330, 1340, 1350, 1361, 1372, 1383,
+    1394, 1405, 1416, 1427, 1438, 1449, 1460, 1471, 1482, 1493, 1504, 1515, 1526, 1537, 1548, 1559,
+    1570, 1581, 1592, 1603, 1614, 1625, 1636, 1647, 1658, 1669, 1680, 1691, 1702, 1713, 1724, 1735,
+    1746, 1757, 1768, 1779, 1790, 1801, 1813, 1825, 1837, 1849, 1861, 1873, 1885, 1897, 1909, 1921,
+    1933, 1945, 1957, 1969, 1981, 1993, 2005, 2017, 2029, 2041, 2053, 2065, 2077, 2089, 2101, 2113,
+    2125, 2137, 2149, 2161, 2173, 2185, 2197, 2209, 2221, 2233, 2245, 2257, 2269, 2281, 2293, 2305,
+    2317, 2329, 2341, 2353, 2365, 2377, 2389, 2401, 2413, 2425, 2437, 2450, 2463, 2476, 2489, 2502,
+    2515, 2528, 2541, 2554, 2567, 2580, 2593, 2606, 2619, 2632, 2645, 2658, 2671, 2684, 2697, 2710,
+    2723, 2736, 2749, 2762, 2775, 2788, 2801, 2814, 2827, 2840, 2853, 2866, 2879, 2892, 2905, 2918,
+    2931, 2944, 2957, 2970, 2983, 2996, 3009, 3022, 3035, 3048, 3061, 3074, 3087, 3100, 3113, 3126,
+    3139, 3152, 3165, 3178, 3191, 3204, 3217, 3230, 3244, 3258, 3272, 3286, 3300, 3314, 3328, 3342,
+    3356, 3370, 3384, 3398, 3412, 3426, 3440, 3454, 3468, 3482, 3496, 3510, 3524, 3538, 3552, 3566,
+    3580, 3594, 3608, 3622, 3636, 3650, 3664, 3678, 3692, 3706, 3720, 3734, 3748, 3762, 3776, 3790,
+    3804, 3818, 3832, 3846, 3860, 3874, 3888, 3902, 3916, 3930, 3944, 3958, 3972, 3986, 4000, 4014,
+    4029, 4044, 4059, 4074, 4089, 4104, 4119, 4134, 4149, 4164, 4179, 4194, 4209, 4224, 4239, 4254,
+    4269, 4284, 4299, 4314, 4329, 4344, 4359, 4374, 4389, 4404, 4419, 4434, 4449, 4464, 4479, 4494,
+    4509, 4525, 4541, 4557, 4573, 4589, 4605, 4621, 4637, 4653, 4669, 4685, 4701, 4717, 4733, 4749,
+    4765, 4781, 4797, 4813, 4829, 4845, 4861, 4877, 4893, 4909, 4925, 4941, 4957, 4973, 4989, 5006,
+    5023, 5040, 5057, 5074, 5091, 5108, 5125, 5142, 5159, 5176, 5194, 5212, 5230, 5248, 5266, 5284,
+    5302, 5320, 5338, 5357, 5376, 5395, 5414, 5433, 5453, 5473, 5493, 5516,
+};
+
+// es: 3590 patterns, 0 exceptions
+//
+// License: MIT/X11
+//
+// Copyright (c) 1993, 1997 Javier Bezos
+// Copyright (c) 2001-2015 Javier Bezos and CervanTeX
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// For further info, bug reports and comments:
+//
+// http://www.tex-tipografia.com/spanish_hyphen.html
+//
+// I would like to thanks Francesc Carmona for his permission
+// to steal parts of his work without restrictions. For his
+// patterns, (c) by Francesc Carmona
+static const uint16_t HYPH_ES_ALPHABET[] = {
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+    0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0xe1, 0xe9, 0xed, 0xf1, 0xf3, 0xfa,
+};
+static const uint32_t HYPH_ES_TRIE[] = {
+    0x7c0, 0xe81, 0x81482, 0x81b43, 0x82204, 0x28c5, 0x82fc6, 0x83687,
+    0x3d48, 0x43c9, 0x8484a, 0x84f0b, 0x855cc, 0x85c8d, 0x8634e, 0x6a0f,
+    0x86f10, 0x875d1, 0x87c92, 0x88353, 0x88a14, 0xd95, 0x890d6, 0x89797,
+    0x89e58, 0x8a519, 0x8abda, 0xb21b, 0x2a9c, 0xb71d, 0x80b9e, 0xb4df,
+    0x100981, 0x100e02, 0x101103, 0x102804, 0x27c5, 0x100006, 0x100007, 0x1308,
+    0xf49, 0x10000a, 0x10000b, 0x10000c, 0x102acd, 0x10000e, 0x180000, 0x104250,
+    0x100011, 0x100fd2, 0x102093, 0x104514, 0x1798e, 0x100016, 0x100017, 0x100018,
+    0x100019, 0x10001a, 0x180000, 0x2d41, 0x13c2, 0x4583, 0xba84, 0x1545,
+    0x6846, 0x17bc9, 0x1294c, 0x2589, 0x19385, 0x16d01, 0x454c, 0x49cd,
+    0xb38e, 0x1d8f, 0x12f94, 0x18e4e, 0xbe92, 0xbb13, 0x2994, 0x26d5,
+    0x18281, 0x17705, 0x180000, 0x1818f, 0x280002, 0x286783, 0x280004, 0x2c5d,
+    0x282d06, 0x284387, 0x200008, 0xc289, 0x28000a, 0x28000b, 0x30c68c, 0x28448d,
+    0x28000e, 0x17755, 0x28b690, 0x280011, 0x30cd52, 0x280013, 0x284f94, 0x189d2,
+    0x280016, 0x280017, 0x280018, 0x280019, 0x28001a, 0x180000, 0xc441, 0x280002,
+    0x289643, 0x280004, 0x7485, 0x284a46, 0x284cc7, 0x38d408, 0x5209, 0x28000a,
+    0x28000b, 0x30dacc, 0x28578d, 0x28e18e, 0x620f, 0x28bdd0, 0x280011, 0x30e292,
+    0x280013, 0x28e7d4, 0x6595, 0x280016, 0x280017, 0x280018, 0x280019, 0x286b9a,
+    0x180000, 0x19493, 0x280002, 0x289d03, 0x280004, 0xe885, 0x2866c6, 0x286887,
+    0x200008, 0x17ecf, 0x28000a, 0x28000b, 0x28000c, 0x286acd, 0x28000e, 0x18395,
+    0x28e650, 0x280011, 0x30ed12, 0x280013, 0x288a94, 0x18307, 0x280016, 0x280017,
+    0x280018, 0x280019, 0x28001a, 0x180000, 0xbbc1, 0x170c5, 0xf083, 0xf3c4,
+    0x6d85, 0x178c9, 0x180000, 0x19445, 0x179c1, 0x1854e, 0x171c4, 0x19b54,
+    0xf40d, 0xa54e, 0xf2cf, 0x15409, 0x17a89, 0xf912, 0x7713, 0x18a98,
+    0x8115, 0x1568f, 0x480005, 0xfd18, 0x173d2, 0x180013, 0x761b, 0x180000,
+    0x7b81, 0x280002, 0x280003, 0x280004, 0x19b93, 0x280006, 0x280007, 0x200008,
+    0x500014, 0x28000a, 0x28000b, 0x31048c, 0x28000d, 0x28000e, 0x910f, 0x280010,
+    0x280011, 0x310b52, 0x280013, 0x289214, 0x48001f, 0x280016, 0x280017, 0x280018,
+    0x280019, 0x28001a, 0x180000, 0x9401, 0x280002, 0x280003, 0x280004, 0x9ac5,
+    0x280006, 0x280007, 0x200008, 0xa589, 0x28000a, 0x28000b, 0x31120c, 0x28000d,
+    0x28a8ce, 0xa88f, 0x280010, 0x280011, 0x3118d2, 0x280013, 0x280014, 0xb295,
+    0x280016, 0x280017, 0x280018, 0x280019, 0x28001a, 0x180000, 0xac81, 0x280002,
+    0x280003, 0x280004, 0xffc5, 0x280006, 0x280007, 0x200008, 0xc009, 0x28000a,
+    0x28000b, 0x28000c, 0x28000d, 0x28000e, 0xaacf, 0x280010, 0x280011, 0x280012,
+    0x280013, 0x280014, 0x17ac1, 0x280016, 0x280017, 0x280018, 0x280019, 0x28001a,
+    0xfa01, 0xafc2, 0xbcc3, 0xce44, 0xaec5, 0x280000, 0xeb87, 0x17f81,
+    0x1794f, 0x17c45, 0x18a45, 0x17e92, 0x50000e, 0xf38e, 0xb40f, 0x18209,
+    0x50000e, 0x180000, 0xb253, 0x280002, 0x280003, 0x280004, 0x17fd2, 0x280006,
+    0x280007, 0x200008, 0x18094, 0x28000a, 0x28000b, 0x28000c, 0x28000d, 0x28000e,
+    0x18c49, 0x280010, 0x280011, 0x280012, 0x280013, 0x280014, 0x18c0f, 0x280016,
+    0x280017, 0x280018, 0x280019, 0x28001a, 0x180000, 0x500014, 0x280002, 0x280003,
+    0x280004, 0x50000e, 0x280006, 0x280007, 0x200008, 0xb609, 0x28000a, 0x28000b,
+    0x311f8c, 0x28000d, 0x28000e, 0x1a243, 0x280010, 0x280011, 0x312652, 0x280013,
+    0x280014, 0x500013, 0x280016, 0x280017, 0x280018, 0x280019, 0x28001a, 0x180000,
+    0x50001a, 0x280002, 0x28d2c3, 0x280004, 0x1a1d4, 0x28b446, 0x28b9c7, 0x200008,
+    0xbd89, 0x28000a, 0x28000b, 0x392d0c, 0x28c10d, 0x28000e, 0xc50f, 0x293050,
+    0x280011, 0x280012, 0x280013, 0x28c714, 0x50000e, 0x280016, 0x280017, 0x280018,
+    0x280019, 0x28001a, 0x180000, 0x13341, 0x280002, 0x28d983, 0x280004, 0x13405,
+    0x28c546, 0x28cd87, 0x200008, 0x13549, 0x28000a, 0x28000b, 0x28000c, 0x28cf0d,
+    0x28d44e, 0xd1cf, 0x293590, 0x280011, 0x280012, 0x280013, 0x28e594, 0xd815,
+    0x280016, 0x280017, 0x280018, 0x280019, 0x28001a, 0x180000, 0xd8c1, 0x280002,
+    0x290343, 0x280004, 0x135c5, 0x28dcc6, 0x28de87, 0x200008, 0x1a34e, 0x28000a,
+    0x28000b, 0x28000c, 0x28decd, 0x28000e, 0xf54f, 0x293690, 0x280011, 0x280012,
+    0x280013, 0x293754, 0x1a50c, 0x280016, 0x280017, 0x280018, 0x280019, 0x28001a,
+    0x180000, 0xe841, 0x18d49, 0xe503, 0x50000e, 0xf7c5, 0x180000, 0x500014,
+    0x50000e, 0xfac9, 0x500014, 0x18b12, 0x138cc, 0xe70d, 0xea4e, 0xe78f,
+    0x50001a, 0x50000e, 0x1aac4, 0x13d13, 0x180000, 0x13a81, 0x280002, 0x280003,
+    0x280004, 0xfe05, 0x280006, 0x280007, 0x200008, 0xf4c9, 0x28000a, 0x28000b,
+    0x31410c, 0x28000d, 0x28ecce, 0xf1cf, 0x280010, 0x280011, 0x3147d2, 0x290153,
+    0x28f814, 0xf595, 0x280016, 0x280017, 0x280018, 0x280019, 0x28001a, 0x180000,
+    0x1a446, 0x280002, 0x280003, 0x280004, 0x180000, 0x280006, 0x280007, 0x200008,
+    0x1a00e, 0x28000a, 0x28000b, 0x28000c, 0x28000d, 0x28000e, 0x1be0e, 0x280010,
+    0x280011, 0x280012, 0x280013, 0x280014, 0xf9d5, 0x280016, 0x280017, 0x280018,
+    0x280019, 0x28001a, 0x180000, 0x13ac1, 0x280002, 0x290a03, 0x280004, 0x11bc5,
+    0x28fcc6, 0x290807, 0x200008, 0x1be4d, 0x28000a, 0x28000b, 0x28000c, 0x29158d,
+    0x28000e, 0x1000f, 0x293b10, 0x280011, 0x314e92, 0x280013, 0x292014, 0x1b443,
+    0x280016, 0x280017, 0x280018, 0x280019, 0x28001a, 0x180000, 0x15241, 0x280002,
+    0x292503, 0x280004, 0x10f05, 0x290786, 0x290fc7, 0x200008, 0x1b492, 0x28000a,
+    0x28000b, 0x28000c, 0x29168d, 0x28000e, 0x154cf, 0x2955d0, 0x280011, 0x280012,
+    0x280013, 0x295654, 0x12e55, 0x280016, 0x280017, 0x280018, 0x280019, 0x28001a,
+    0x180000, 0x11801, 0x280002, 0x295343, 0x280004, 0x15745, 0x291786, 0x291c47,
+    0x200008, 0x11e09, 0x28000a, 0x28000b, 0x40000c, 0x291fcd, 0x28000e, 0x1238f,
+    0x295890, 0x280011, 0x315dd2, 0x412d53, 0x2930d4, 0x500013, 0x280016, 0x280017,
+    0x400018, 0x280019, 0x41381a, 0x180000, 0x50001a, 0x280002, 0x280003, 0x280004,
+    0x180000, 0x280006, 0x280007, 0x200008, 0x133c9, 0x28000a, 0x28000b, 0x31648c,
+    0x28000d, 0x28000e, 0x1be8e, 0x280010, 0x280011, 0x316b52, 0x280013, 0x280014,
+    0x1bed4, 0x280016, 0x280017, 0x280018, 0x280019, 0x28001a, 0x180000, 0x13781,
+    0x280002, 0x280003, 0x280004, 0x1bc93, 0x280006, 0x280007, 0x200008, 0x50000e,
+    0x28000a, 0x28000b, 0x28000c, 0x28000d, 0x28000e, 0x500014, 0x280010, 0x280011,
+    0x280012, 0x280013, 0x280014, 0x50001a, 0x280016, 0x280017, 0x280018, 0x280019,
+    0x28001a, 0x180000, 0x1c18f, 0x280002, 0x296343, 0x280004, 0x13b45, 0x293d46,
+    0x293c07, 0x200008, 0x50000e, 0x28000a, 0x28000b, 0x28000c, 0x293ccd, 0x28000e,
+    0x500014, 0x296e90, 0x280011, 0x280012, 0x280013, 0x294854, 0x50001a, 0x280016,
+    0x280017, 0x280018, 0x280019, 0x28001a, 0x180000, 0x180000, 0x280002, 0x296a03,
+    0x280004, 0x1ab44, 0x293e46, 0x294147, 0x200008, 0x1c1c7, 0x28000a, 0x28000b,
+    0x28000c, 0x29448d, 0x28000e, 0x180000, 0x296f10, 0x280011, 0x280012, 0x280013,
+    0x295194, 0x1ae14, 0x280016, 0x280017, 0x280018, 0x280019, 0x28001a, 0x180000,
+    0x1c3ce, 0x280002, 0x280003, 0x280004, 0x1c282, 0x280006, 0x280007, 0x200008,
+    0x1c38d, 0x28000a, 0x28000b, 0x28000c, 0x28000d, 0x28000e, 0x1464f, 0x280010,
+    0x280011, 0x280012, 0x280013, 0x280014, 0x1c645, 0x280016, 0x280017, 0x280018,
+    0x280019, 0x28001a, 0x14f82, 0x1c341, 0x16f84, 0x1cc52, 0x180000, 0x18e01,
+    0x300000, 0x14c09, 0x18f04, 0x180000, 0x190c6, 0x19107, 0x152ce, 0x1528f,
+    0x1d0cf, 0x1c44f, 0x17492, 0x157d3, 0x180000, 0x17901, 0x15982, 0x15c4c,
+    0x15944, 0x165ce, 0x19314, 0x1cd93, 0x1cbcc, 0x500014, 0x16693, 0x16a54,
+    0x50000e, 0x15b4d, 0x180000, 0x18641, 0x180000, 0x500013, 0x500014, 0x15fd3,
+    0x15a54, 0x19ec5, 0x1a5c3, 0x1a704, 0x1cb01, 0x50000e, 0x18a0c, 0x185cd,
+    0x1840e, 0x18b8f, 0x180000, 0x19781, 0x1a78d, 0x194c3, 0x188d4, 0x19985,
+    0x19754, 0x198d5, 0x1cb8f, 0x19649, 0x1c204, 0x50000e, 0x19c4c, 0x195cd,
+    0x1940e, 0x1988f, 0x500013, 0x500014, 0x19c82, 0x196d3, 0x19714, 0x19d05,
+    0x1c8d0, 0x1c99b, 0x50000e, 0x1c113, 0x1a383, 0x19ddb, 0x19e1c, 0x19e5d,
+    0x1a407, 0x19f8f, 0x180000, 0x1ca07, 0x580002, 0x580003, 0x580004, 0x19e95,
+    0x580006, 0x580007, 0x580008, 0x1a312, 0x58000a, 0x58000b, 0x58000c, 0x58000d,
+    0x58000e, 0x500014, 0x580010, 0x580011, 0x580012, 0x580013, 0x580014, 0x500013,
+    0x580016, 0x580017, 0x580018, 0x580019, 0x58001a, 0x180000, 0x50001a, 0x580002,
+    0x580003, 0x580004, 0x1c901, 0x580006, 0x580007, 0x580008, 0x1c805, 0x58000a,
+    0x58000b, 0x58000c, 0x58000d, 0x58000e, 0x50000e, 0x580010, 0x580011, 0x580012,
+    0x580013, 0x580014, 0x50000e, 0x580016, 0x580017, 0x580018, 0x580019, 0x58001a,
+    0x180000, 0x180000, 0x280002, 0x280003, 0x280004, 0x1d1ce, 0x280006, 0x280007,
+    0x280008, 0x50000e, 0x28000a, 0x28000b, 0x10000c, 0x28000d, 0x28000e, 0x500014,
+    0x280010, 0x280011, 0x100012, 0x280013, 0x280014, 0x50001a, 0x280016, 0x280017,
+    0x280018, 0x280019, 0x28001a, 0x180000, 0x1d18c, 0x580002, 0x580003, 0x580004,
+    0x1d20d, 0x580006, 0x580007, 0x580008, 0x50000e, 0x58000a, 0x58000b, 0x58000c,
+    0x58000d, 0x58000e, 0x500014, 0x580010, 0x580011, 0x580012, 0x580013, 0x580014,
+    0x50001a, 0x580016, 0x580017, 0x580018, 0x580019, 0x58001a, 0x180000, 0x500014,
+    0x50000e, 0x50000e, 0x180000, 0x1a205, 0x580002, 0x580003, 0x580004, 0x1a549,
+    0x580006, 0x580007, 0x580008, 0x1a489, 0x58000a, 0x58000b, 0x58000c, 0x58000d,
+    0x58000e, 0x1a58f, 0x580010, 0x580011, 0x580012, 0x580013, 0x580014, 0x180000,
+    0x580016, 0x580017, 0x580018, 0x580019, 0x58001a, 0x1a6c3, 0x480005, 0x50000e,
+    0x1da94, 0x500013, 0x1dcce, 0x1a4c9, 0x500013, 0x500014, 0x1d845, 0x1ccc1,
+    0x50001a, 0x1df53, 0x500013, 0x180000, 0x180000, 0x1a913, 0x580002, 0x580003,
+    0x580004, 0x50001a, 0x580006, 0x580007, 0x580008, 0x1cd0f, 0x58000a, 0x58000b,
+    0x58000c, 0x58000d, 0x58000e, 0x1a741, 0x580010, 0x580011, 0x580012, 0x580013,
+    0x580014, 0x1cc1b, 0x580016, 0x580017, 0x580018, 0x580019, 0x58001a, 0x180000,
+    0x600005, 0x1aa4f, 0x1a9c2, 0x1e18c, 0x1c946, 0x280000, 0x1a694, 0x1cc89,
+    0x1db45, 0x1ab09, 0x1e153, 0x1af0c, 0x1aa8d, 0x1a84e, 0x1ae93, 0x1abcf,
+    0x180000, 0x1a952, 0x1cd54, 0x1ac14, 0x180000, 0x1b281, 0x60001b, 0x1d4d2,
+    0x300000, 0x1ac85, 0x1e714, 0x1ce1d, 0x1e285, 0x1af89, 0x1dac3, 0x1db04,
+    0x1b40c, 0x1b2cd, 0x1b00e, 0x1afcf, 0x480015, 0x1b881, 0x1c6ce, 0x1b393,
+    0x1b3d4, 0x1b8c5, 0x1c512, 0x1ca53, 0x1ddc4, 0x1ba49, 0x48001f, 0x1b65b,
+    0x1b69c, 0x1b55d, 0x1bf83, 0x1bacf, 0x1ba10, 0x180000, 0x1dd0e, 0x500014,
+    0x1b7d4, 0x1bd95, 0x1e212, 0x1c2cc, 0x1c78d, 0x1e54d, 0x1e649, 0x1bb9b,
+    0x1b75c, 0x1bddd, 0x180000, 0x1bc5f, 0x580002, 0x580003, 0x580004, 0x1c598,
+    0x580006, 0x580007, 0x580008, 0x50000e, 0x58000a, 0x58000b, 0x58000c, 0x58000d,
+    0x58000e, 0x500014, 0x580010, 0x580011, 0x580012, 0x580013, 0x580014, 0x50001a,
+    0x580016, 0x580017, 0x580018, 0x580019, 0x58001a, 0x180000, 0x50000e, 0x580002,
+    0x580003, 0x580004, 0x500014, 0x580006, 0x580007, 0x580008, 0x50000e, 0x58000a,
+    0x58000b, 0x58000c, 0x58000d, 0x58000e, 0x500014, 0x580010, 0x580011, 0x580012,
+    0x580013, 0x580014, 0x50001a, 0x580016, 0x580017, 0x580018, 0x580019, 0x58001a,
+    0x180000, 0x1e8cd, 0x580002, 0x580003, 0x580004, 0x50000e, 0x580006, 0x580007,
+    0x580008, 0x1e955, 0x58000a, 0x58000b, 0x58000c, 0x58000d, 0x58000e, 0x1e601,
+    0x580010, 0x580011, 0x580012, 0x580013, 0x580014, 0x1c255, 0x580016, 0x580017,
+    0x580018, 0x580019, 0x58001a, 0x180000, 0x50000e, 0x580002, 0x580003, 0x580004,
+    0x50000e, 0x580006, 0x580007, 0x580008, 0x1eacc, 0x58000a, 0x58000b, 0x58000c,
+    0x58000d, 0x58000e, 0x500014, 0x580010, 0x580011, 0x580012, 0x580013, 0x580014,
+    0x1e509, 0x580016, 0x580017, 0x580018, 0x580019, 0x58001a, 0x180000, 0x50000e,
+    0x580002, 0x580003, 0x580004, 0x1e454, 0x580006, 0x580007, 0x580008, 0x1edcf,
+    0x58000a, 0x58000b, 0x58000c, 0x58000d, 0x58000e, 0x50000e, 0x580010, 0x580011,
+    0x580012, 0x580013, 0x580014, 0x500013, 0x580016, 0x580017, 0x580018, 0x580019,
+    0x58001a, 0x180000, 0x50001a, 0x580002, 0x580003, 0x580004, 0x1ebd0, 0x580006,
+    0x580007, 0x580008, 0x50000e, 0x58000a, 0x58000b, 0x58000c, 0x58000d, 0x58000e,
+    0x500014, 0x580010, 0x580011, 0x580012, 0x580013, 0x580014, 0x50001a, 0x580016,
+    0x580017, 0x580018, 0x580019, 0x58001a, 0x180000, 0x180000, 0x280002, 0x280003,
+    0x280004, 0x1ec14, 0x280006, 0x280007, 0x280008, 0x1ea84, 0x28000a, 0x28000b,
+    0x28000c, 0x28000d, 0x28000e, 0x1ee85, 0x280010, 0x280011, 0x280012, 0x280013,
+    0x280014, 0x1eb50, 0x280016, 0x280017, 0x280018, 0x280019, 0x28001a, 0x50000e,
+    0x1cdc3, 0x1d001, 0x1f003, 0x1f144, 0x500013, 0x500014, 0x500013, 0x1d347,
+    0x1d083, 0x69d88c, 0x1d243, 0x1ce4e, 0x1d38c, 0x50001a, 0x1cf0e, 0x1d44f,
+    0x180000, 0x1d28c, 0x1d2c5, 0x1d30e, 0x50000e, 0x1d058, 0x1dd8f, 0x1d412,
+    0x50000e, 0x500013, 0x500014, 0x1d494, 0x1d549, 0x500013, 0x500014, 0x1e584,
+    0x500013, 0x1eed3, 0x1d9cf, 0x1ef93, 0x280000, 0x1e041, 0x1decc, 0x50001a,
+    0x1db8e, 0x1e74e, 0x50000e, 0x1efce, 0x1e092, 0x1e812, 0x50000e, 0x500013,
+    0x500014, 0x50000e, 0x1da5f, 0x1e10f, 0x180000, 0x1df01, 0x580002, 0x580003,
+    0x580004, 0x500014, 0x580006, 0x580007, 0x580008, 0x500014, 0x58000a, 0x58000b,
+    0x58000c, 0x58000d, 0x58000e, 0x50000e, 0x580010, 0x580011, 0x580012, 0x580013,
+    0x580014, 0x1de95, 0x580016, 0x580017, 0x580018, 0x580019, 0x58001a, 0x180000,
+    0x50000e, 0x580002, 0x580003, 0x580004, 0x1e2c5, 0x580006, 0x580007, 0x580008,
+    0x1f30f, 0x58000a, 0x58000b, 0x58000c, 0x58000d, 0x58000e, 0x1e1cf, 0x580010,
+    0x580011, 0x580012, 0x580013, 0x580014, 0x500013, 0x580016, 0x580017, 0x580018,
+    0x580019, 0x58001a, 0x180000, 0x50001a, 0x580002, 0x580003, 0x580004, 0x1f081,
+    0x580006, 0x580007, 0x580008, 0x1f5d3, 0x58000a, 0x58000b, 0x58000c, 0x58000d,
+    0x58000e, 0x700000, 0x580010, 0x580011, 0x580012, 0x580013, 0x580014, 0x1f244,
+    0x580016, 0x580017, 0x580018, 0x580019, 0x58001a, 0x1e6c2, 0x1e9c3, 0x1e90e,
+    0x1e981, 0x500013, 0x1e881, 0x50000e, 0x1ea13, 0x1f353, 0x1ec45, 0x180000,
+    0x50001a, 0x500014, 0x1ea49, 0x1fb93, 0x1f585, 0x50000e, 0x1fe81, 0x50001a,
+    0x1e84f, 0x1ec8c, 0x500013, 0x500014, 0x500013, 0x1f8d3, 0x1fc45, 0x1ecd2,
+    0x50000e, 0x1ed54, 0x1fd0c, 0x50001a, 0x1fecf, 0x500013, 0x500014, 0x180000,
+    0x1ee01, 0x580002, 0x580003, 0x580004, 0x1fa4f, 0x580006, 0x580007, 0x580008,
+    0x1fdcf, 0x58000a, 0x58000b, 0x58000c, 0x58000d, 0x58000e, 0x1ee4f, 0x580010,
+    0x580011, 0x580012, 0x580013, 0x580014, 0x1fc0d, 0x580016, 0x580017, 0x580018,
+    0x580019, 0x58001a, 0x180000, 0x1ff14, 0x580002, 0x580003, 0x580004, 0x180000,
+    0x580006, 0x580007, 0x580008, 0x50000e, 0x58000a, 0x58000b, 0x58000c, 0x58000d,
+    0x58000e, 0x500014, 0x580010, 0x580011, 0x580012, 0x580013, 0x580014, 0x50001a,
+    0x580016, 0x580017, 0x580018, 0x580019, 0x58001a, 0x180000, 0x1ff54, 0x580002,
+    0x580003, 0x580004, 0x20009, 0x580006, 0x580007, 0x580008, 0x50000e, 0x58000a,
+    0x58000b, 0x58000c, 0x58000d, 0x58000e, 0x500014, 0x580010, 0x580011, 0x580012,
+    0x580013, 0x580014, 0x50001a, 0x580016, 0x580017, 0x580018, 0x580019, 0x58001a,
+    0x50000e, 0x204d5, 0x50000e, 0x1f2cd, 0x1f0ce, 0x500013, 0x500014, 0x500013,
+    0x500014, 0x1f393, 0x1f454, 0x1f3c1, 0x1f6cd, 0x1f78e, 0x20dd3, 0x1f405,
+    0x20855, 0x1f752, 0x1f7d3, 0x1f954, 0x1facd, 0x1f88e, 0x1f80f, 0x1f54d,
+    0x1f4ce, 0x1f48f, 0x1fb53, 0x1fbd4, 0x180000, 0x1f653, 0x1f694, 0x7a00c1,
+    0x20c05, 0x20e4d, 0x20f4d, 0x79fe45, 0x20ad0, 0x1f909, 0x800008, 0x7a0189,
+    0x20201, 0x1f98d, 0x1fd8e, 0x2198c, 0x1fc85, 0x7a044f, 0x2120c, 0x1fe13,
+    0x21293, 0x2168e, 0x20094, 0x7a07d5, 0x21081, 0x215cc, 0x2028f, 0x21a45,
+    0x21481, 0x7a011b, 0x78001c, 0x78001d, 0x20595, 0x7a035f, 0x20320, 0x7a0941,
+    0x21449, 0x21c8f, 0x980000, 0x7a0a45, 0x21b0e, 0x22541, 0x2039f, 0x7a0709,
+    0x22a02, 0x22dcf, 0x21d44, 0x21889, 0x2054e, 0x8a088f, 0x920cc1, 0x21d0f,
+    0x21f4e, 0x980000, 0x9202c5, 0x780015, 0x22305, 0x21fd3, 0x900009, 0x2210f,
+    0x22852, 0x79ffdb, 0x78001c, 0x78001d, 0x920bcf, 0x7a079f, 0x780020, 0x21f1f,
+    0x22745, 0x21e01, 0x920b95, 0x900001, 0x220d3, 0x226c5, 0x980000, 0x900005,
+    0x90001b, 0x90001c, 0x90001d, 0x900009, 0x90001f, 0x900020, 0x2340f, 0x2280f,
+    0x22603, 0x90000f, 0x921581, 0x2364f, 0x229d3, 0x228cc, 0x921045, 0x900015,
+    0x22d12, 0x22593, 0x921009, 0x22bd3, 0x2264c, 0x90001b, 0x90001c, 0x90001d,
+    0x92114f, 0x90001f, 0x900020, 0x18000f, 0x23c89, 0x20fd4, 0x920d55, 0x7a2381,
+    0x22b0c, 0x23ec5, 0x180000, 0x880005, 0x920f1b, 0x9211dc, 0x90001d, 0x7a14c9,
+    0x90001f, 0x920ea0, 0xa00001, 0x22e48, 0x23385, 0x7a1a8f, 0x980000, 0x22f0f,
+    0x23745, 0x23805, 0x247c5, 0x7a25d5, 0x23fd3, 0xa80002, 0x980000, 0x227c9,
+    0xa23a8f, 0x7a139b, 0x78001c, 0x78001d, 0x22f8e, 0x78001f, 0x780020, 0x22d89,
+    0x236ce, 0x23053, 0x24081, 0x22ecd, 0x232ce, 0x23713, 0x24185, 0x980000,
+    0x980000, 0x23353, 0x24501, 0x980000, 0x2490f, 0x242cf, 0x23a4c, 0xb80001,
+    0x2424f, 0x22f49, 0xb249ce, 0xb80005, 0x23589, 0x238ce, 0xc00008, 0xb80009,
+    0x23a0e, 0x23c4e, 0x23913, 0x23993, 0x239d3, 0xb8000f, 0x23f93, 0xc80001,
+    0x240c4, 0xca3d41, 0x241c1, 0xb80015, 0x245d4, 0x2454c, 0x24f4f, 0x2444f,
+    0x246c3, 0xb8001b, 0xb8001c, 0xb8001d, 0x25181, 0xb8001f, 0xb80020, 0xc8000f,
+    0x24e49, 0x24714, 0x24490, 0xc8000f, 0x2484e, 0x25941, 0x24753, 0x24dc9,
+    0x24d4c, 0x25cc5, 0xb80001, 0x24e8e, 0x24ed2, 0x260c9, 0xb80005, 0x25405,
+    0x2500f, 0xc00008, 0xb80009, 0x2624f, 0x25c0f, 0x25505, 0x256cf, 0x2554c,
+    0xb8000f, 0x26855, 0x180000, 0x78000f, 0x268cf, 0x24f81, 0xb80015, 0x25b4d,
+    0x248dc, 0x25345, 0x257d3, 0x2495f, 0xb8001b, 0xb8001c, 0xb8001d, 0x26c8f,
+    0xb8001f, 0xb80020, 0x25a52, 0x255cf, 0x26202, 0x25acf, 0x26604, 0x25fcf,
+    0x26385, 0x26681, 0x264d3, 0x26805, 0x26a85, 0x26745, 0x27401, 0x259cd,
+    0x2590e, 0x980000, 0x980000, 0x26d02, 0x27112, 0x26a53, 0x25bd4, 0x2678f,
+    0x274cf, 0x27b0f, 0x26989, 0x26dc9, 0x28247, 0x27443, 0x27203, 0x26d8e,
+    0x27313, 0x27487, 0x26e47, 0x270d2, 0x27193, 0x26f13, 0x27543, 0x276cd,
+    0x27847, 0x27f12, 0x27d47, 0x27a8a, 0x27511, 0x27d8c, 0x27dcd, 0x27e0f,
+    0x27f42, 0x279ce, 0x28084, 0x2814d, 0x282c4, 0x27594, 0x28307, 0x27c54,
+    0x28192, 0x2850a, 0x283c9, 0x2838c, 0x285cd, 0x28414, 0x28354, 0xb80001,
+    0x29101, 0x2870f, 0x28acf, 0xb80005, 0x284c3, 0x700000, 0xc00008, 0xb80009,
+    0x28481, 0x700000, 0x287d4, 0x28909, 0x28809, 0xb8000f, 0x28b0c, 0x29bc1,
+    0x28bd4, 0x288c5, 0x28992, 0xb80015, 0x29041, 0x2a44f, 0x28a8f, 0x28781,
+    0x289d3, 0xb8001b, 0xb8001c, 0xb8001d, 0x28a13, 0xb8001f, 0xb80020, 0x29349,
+    0x28b45, 0x300000, 0x2978f, 0x28cd2, 0xd00000, 0x2998f, 0xd00000, 0x2a00f,
+    0x2960c, 0xd80000, 0x2a20f, 0x980000, 0x980000, 0x29743, 0x300000, 0x29912,
+    0x29d12, 0x291c9, 0x29805, 0x29b43, 0x28d4e, 0x2920d, 0x2aa8f, 0x290d3,
+    0x2908d, 0x293d3, 0x29cc2, 0x296d3, 0xb80001, 0x29e5d, 0x29413, 0x29c92,
+    0xb80005, 0x29b92, 0x2acc9, 0xc00008, 0xb80009, 0x29dd4, 0x2b301, 0x29e81,
+    0x2a094, 0x180000, 0xb8000f, 0x2a509, 0x2a152, 0x2b549, 0x2bb8f, 0x2bdcf,
+    0xb80015, 0x2a5c9, 0x2a494, 0x2a352, 0x2a687, 0x2a592, 0xb8001b, 0xb8001c,
+    0xb8001d, 0x2c40f, 0xb8001f, 0xb80020, 0x800002, 0x800003, 0x800004, 0x2a654,
+    0x800006, 0x800007, 0xe00008, 0x2c641, 0x2a881, 0x2a541, 0x2a747, 0x80000d,
+    0x2a847, 0x2ca45, 0x800010, 0x800011, 0x2ad93, 0x800013, 0x800014, 0xb80001,
+    0x800016, 0x2cc8f, 0x2b10f, 0xb80005, 0x2d049, 0x300000, 0xc00008, 0xb80009,
+    0x2ac45, 0xd00000, 0x2af14, 0x2d681, 0xd00000, 0xb8000f, 0xc8000f, 0x2b41a,
+    0x2b094, 0x2b2c1, 0x2b20e, 0xb80015, 0x2b5d2, 0x2afc5, 0x2ac8d, 0x2d8c9,
+    0x2bb45, 0xb8001b, 0xb8001c, 0xb8001d, 0x2af53, 0xb8001f, 0xb80020, 0x2af93,
+    0x2b350, 0x2b854, 0x2be0f, 0x2b514, 0xeab583, 0xc80001, 0x2ba14, 0x2b7c9,
+    0x2bbc3, 0xf00001, 0x2bf8e, 0x2bc92, 0x2df0f, 0xf00005, 0x2bcce, 0x2b483,
+    0x700000, 0x2c004, 0xe80011, 0xc8000f, 0x2e149, 0x2c2d2, 0x2cf8c, 0xf0000f,
+    0x2c349, 0xa00000, 0x2c505, 0x2cfd2, 0x2c38e, 0x2c5cc, 0x2d141, 0x2e785,
+    0x2c88d, 0x2c7cf, 0x2ce43, 0xf0001b, 0xf0001c, 0xf0001d, 0x2e9cf, 0x2c992,
+    0x2c8cd, 0x2d303, 0x2d592, 0xf80008, 0x2c813, 0x2f005, 0x2d00e, 0x2cf12,
+    0x2cd91, 0x2d190, 0x2d5c5, 0x2d2d3, 0x2d412, 0xb80001, 0x2f24f, 0x2d60d,
+    0x2d385, 0xb80005, 0x2d48f, 0x2d785, 0xc00008, 0xb80009, 0x2d845, 0x180000,
+    0x2f78f, 0x2e1cc, 0x2d905, 0xb8000f, 0x2d7cd, 0x2d88d, 0x2dbc5, 0x2dc05,
+    0x2df45, 0xb80015, 0x2d80f, 0x2de0d, 0x2e105, 0x2da13, 0x2e309, 0xb8001b,
+    0xb8001c, 0xb8001d, 0x2e245, 0xb8001f, 0xb80020, 0x2dfcf, 0x180000, 0x2ea4c,
+    0x2e445, 0x2e00f, 0x2e745, 0x2e493, 0x2e7c5, 0x2e84f, 0x180000, 0x2ec53,
+    0x180000, 0x2f405, 0x980000, 0x980000, 0x2edd3, 0x2f841, 0x2fbc7, 0x2f50f,
+    0x305ce, 0x2fb85, 0x2ef45, 0x280003, 0x2f2d3, 0x2ef09, 0x30647, 0x2fb05,
+    0x2eb85, 0x2f290, 0x2f544, 0x30089, 0x780000, 0x2ec93, 0x2ed53, 0x2f10c,
+    0x2ff0c, 0x2fd18, 0x2f34c, 0x102fc8d, 0x2f683, 0x2f444, 0x2ff4e, 0x1000011,
+    0x30a4d, 0x2f813, 0x3014d, 0x2ffce, 0x2f496, 0x2fe95, 0x2fd4d, 0x2fdce,
+    0x2fc01, 0x2fd82, 0xc00018, 0x300c4, 0xc0000e, 0x2fe54, 0xb80018, 0x1080014,
+    0x30043, 0x3054d, 0x30595, 0x100000c, 0x30107, 0x30684, 0x30710, 0x30346,
+    0x30614, 0x3030c, 0x30910, 0x308c3, 0x30992, 0x1080014, 0x30a03, 0x30212,
+    0x1100001, 0x30c8a, 0x301d5, 0x30c0d, 0x1100005, 0x2fcd4, 0x30c45, 0x30cd4,
+    0x1130749, 0x306d8, 0x30d85, 0x30dc3, 0x30f45, 0x30bd2, 0x110000f, 0x30ec6,
+    0x30f03, 0x31094, 0x3110e, 0x31144, 0x1100015, 0x30a8c, 0x31254, 0x311ce,
+    0x31b82, 0x315c9, 0x110001b, 0x110001c, 0x110001d, 0x880013, 0x110001f, 0x1100020,
+    0x30e02, 0x30d43, 0x30e84, 0x31501, 0x32845, 0x309c7, 0x31994, 0x31205,
+    0xa8000d, 0x3218e, 0x31388, 0x30b8d, 0x3100e, 0x32b53, 0x30f90, 0x31401,
+    0x30b12, 0x30e53, 0x1200001, 0x31485, 0xa80002, 0x800003, 0x1200005, 0x31189,
+    0x324df, 0x1180008, 0x1200009, 0x1231801, 0x80000a, 0x32b13, 0x32801, 0x1200005,
+    0x120000f, 0x312df, 0x32505, 0x1200009, 0x31a92, 0x980000, 0x1200015, 0x980000,
+    0x32a94, 0x120000f, 0x32bce, 0x980000, 0x120001b, 0x120001c, 0x120001d, 0x1200015,
+    0x120001f, 0x1200020, 0x32c4e, 0x32d53, 0x180000, 0x120001b, 0x120001c, 0x120001d,
+    0x31442, 0x120001f, 0x1200020, 0x31745, 0x317c6, 0x31607, 0x980000, 0x32e53,
+    0x3164a, 0x31d02, 0x319cc, 0x180000, 0x31c4e, 0x180000, 0x31a10, 0xa80011,
+    0x180000, 0x32b89, 0x31301, 0x32f8e, 0x31f4d, 0x31d8e, 0x32545, 0x280000,
+    0xa8001a, 0x12b2241, 0x321d3, 0x31914, 0x32fc9, 0x12b2105, 0x32dd3, 0x980000,
+    0x322cf, 0x12b25c9, 0x33053, 0x32e13, 0x980000, 0x32ec1, 0x80001d, 0x12b238f,
+    0x1180001, 0x329c5, 0x32712, 0x3328f, 0x1180005, 0x12b1e55, 0x980000, 0x1300008,
+    0x1180009, 0x980000, 0x334c9, 0x128001b, 0x128001c, 0x12b245d, 0x118000f, 0x128001f,
+    0x1280020, 0x330d3, 0x32c8f, 0x980000, 0x1180015, 0x980000, 0xd80000, 0x33453,
+    0x33553, 0x1180001, 0x118001b, 0x118001c, 0x118001d, 0x1180005, 0x118001f, 0x1180020,
+    0x1300008, 0x1180009, 0x1180001, 0x980000, 0x980000, 0x1380000, 0x1180005, 0x118000f,
+    0x1380000, 0x1300008, 0x1180009, 0x980000, 0x980000, 0x1180015, 0x980000, 0x980000,
+    0x118000f, 0x33693, 0xa00000, 0x118001b, 0x118001c, 0x118001d, 0x1180015, 0x118001f,
+    0x1180020, 0x980000, 0x33509, 0x1180001, 0x118001b, 0x118001c, 0x118001d, 0x1180005,
+    0x118001f, 0x1180020, 0x1300008, 0x1180009, 0x1180001, 0x33113, 0x980000, 0x180000,
+    0x1180005, 0x118000f, 0x1380000, 0x1300008, 0x1180009, 0x60001d, 0x1380000, 0x1180015,
+    0x33913, 0x1380000, 0x118000f, 0xf00000, 0x33789, 0x118001b, 0x118001c, 0x118001d,
+    0x1180015, 0x118001f, 0x1180020, 0x3388c, 0x980000, 0x33193, 0x118001b, 0x118001c,
+    0x118001d, 0x331d3, 0x118001f, 0x1180020, 0x33413, 0x332c9, 0x33853, 0x180000,
+    0x33cc9, 0x32c0d, 0x3358e, 0xe80012, 0x33f0f, 0x1180001, 0x33994, 0x335d3,
+    0x33349, 0x1180005, 0x3454f, 0x33a84, 0x1300008, 0x1180009, 0x33ad2, 0x1000008,
+    0x3478f, 0x33b94, 0x33753, 0x118000f, 0x100000d, 0x35952, 0x366c1, 0x36052,
+    0x1000011, 0x1180015, 0x36541, 0x1000014, 0x36485, 0x1000016, 0x1180001, 0x118001b,
+    0x118001c, 0x118001d, 0x1180005, 0x118001f, 0x1180020, 0x1300008, 0x1180009, 0x1180001,
+    0x3664f, 0x3694f, 0x36b8f, 0x1180005, 0x118000f, 0x180000, 0x1300008, 0x11b3a49,
+    0x180000, 0x36853, 0x1180015, 0x36ad3, 0x180000, 0x118000f, 0x36c41, 0x180000,
+    0x118001b, 0x118001c, 0x118001d, 0x1180015, 0x118001f, 0x1180020, 0x36903, 0x980000,
+    0x36893, 0x118001b, 0x118001c, 0x118001d, 0x1500000, 0x118001f, 0x1180020, 0x344c2,
+    0x34cc3, 0x34e84, 0x369d3, 0x33e86, 0x34b87, 0x33d48, 0x371c5, 0x33c4a,
+    0x980000, 0x3530c, 0x354cd, 0x353ce, 0x36a45, 0x35910, 0x3698f, 0x35292,
+    0x35853, 0x35894, 0x33b15, 0x33f96, 0x36b0f, 0x38092, 0x33dd9, 0x349da,
+    0x35c0d, 0x35dce, 0x148000f, 0x36c13, 0x1400011, 0x35d12, 0x34613, 0x35f44,
+    0x33e05, 0x37481, 0x34d87, 0x362c2, 0x342c3, 0x34484, 0x180000, 0x3400c,
+    0x3578d, 0x3624e, 0x375d3, 0x980000, 0x36b4c, 0x35ecc, 0x33e53, 0x3498e,
+    0x1500000, 0x36f81, 0x180000, 0x363d2, 0x34a53, 0x180000, 0x180000, 0x34896,
+    0x180000, 0x34e18, 0x36359, 0x36442, 0x1180001, 0x35244, 0x34ac5, 0x3718f,
+    0x1180005, 0x1500000, 0x180000, 0x1300008, 0x1180009, 0x374d3, 0x37cc5, 0x3544e,
+    0x37513, 0x37553, 0x118000f, 0x1180001, 0x35653, 0x37341, 0x980000, 0x1180005,
+    0x1180015, 0x37793, 0x1300008, 0x1180009, 0x980000, 0x36d94, 0x118001b, 0x118001c,
+    0x118001d, 0x118000f, 0x118001f, 0x1180020, 0x37701, 0x377c1, 0x980000, 0x1180015,
+    0x37905, 0x37845, 0x37dd3, 0x37a45, 0x980000, 0x118001b, 0x118001c, 0x118001d,
+    0x980000, 0x118001f, 0x1180020, 0x36a8f, 0x1180001, 0x37c5c, 0x37ac5, 0x37b85,
+    0x1180005, 0x37949, 0x800012, 0x1300008, 0x1180009, 0x37a8d, 0x37e8e, 0x3775b,
+    0x37b1c, 0x36d1d, 0x118000f, 0x37ed3, 0x37c09, 0x37e4f, 0x800005, 0x38052,
+    0x1180015, 0x37fd5, 0x800009, 0x800001, 0x37f05, 0x1180001, 0x118001b, 0x118001c,
+    0x118001d, 0x1180005, 0x118001f, 0x1180020, 0x1300008, 0x1180009, 0x380c1, 0x37c81,
+    0x800001, 0x80000f, 0x383c9, 0x118000f, 0x800005, 0x38801, 0x80001d, 0x38209,
+    0x800009, 0x1180015, 0x381c5, 0x38601, 0x3828c, 0x80001b, 0x80000f, 0x118001b,
+    0x118001c, 0x118001d, 0x38305, 0x118001f, 0x1180020, 0x3819c, 0x800005, 0x800009,
+    0x3811b, 0x800005, 0x80001b, 0x80001c, 0x80001d, 0x800001, 0x80001f, 0x38bc9,
+    0x800001, 0x800009, 0x38000f, 0x382cc, 0x800005, 0x1180001, 0x3898c, 0x38352,
+    0x800009, 0x1180005, 0x3900f, 0x80000f, 0x1300008, 0x1180009, 0x80000f, 0x700000,
+    0x700000, 0x38405, 0x700000, 0x118000f, 0x1180001, 0x38441, 0x3924f, 0x3988f,
+    0x1180005, 0x1180015, 0x38394, 0x1300008, 0x1180009, 0x39acf, 0x38b93, 0x118001b,
+    0x118001c, 0x118001d, 0x118000f, 0x118001f, 0x1180020, 0x38553, 0x3a4cf, 0x3a112,
+    0x1180015, 0xd80000, 0x3ab0f, 0xd00000, 0x3ad4f, 0x1180001, 0x118001b, 0x118001c,
+    0x118001d, 0x1180005, 0x118001f, 0x1180020, 0x1300008, 0x1180009, 0x1180001, 0xd00000,
+    0x980000, 0x388cf, 0x1180005, 0x118000f, 0x38593, 0x1300008, 0x1180009, 0x38d0f,
+    0x1580000, 0x1180015, 0x38cd3, 0x980000, 0x118000f, 0x38785, 0xd80000, 0x118001b,
+    0x118001c, 0x118001d, 0x1180015, 0x118001f, 0x1180020, 0x3b381, 0x839489, 0x1180001,
+    0x118001b, 0x118001c, 0x118001d, 0x1180005, 0x118001f, 0x1180020, 0x1300008, 0x1180009,
+    0x1180001, 0x38b53, 0x3b4d2, 0x3bac1, 0x1180005, 0x118000f, 0x838d89, 0x1300008,
+    0x1180009, 0x38dc5, 0x700001, 0x1180015, 0x38e05, 0x3bd0f, 0x118000f, 0x38d4c,
+    0x980000, 0x118001b, 0x118001c, 0x118001d, 0x1180015, 0x118001f, 0x1180020, 0x39105,
+    0x38f4e, 0x1180001, 0x118001b, 0x118001c, 0x118001d, 0x1180005, 0x118001f, 0x1180020,
+    0x1300008, 0x1180009, 0x1180001, 0x38c93, 0x3c34f, 0x38ec1, 0x1180005, 0x118000f,
+    0x3c581, 0x1300008, 0x1180009, 0x3cbc9, 0x3ce0f, 0x1180015, 0x3d445, 0x39189,
+    0x118000f, 0x39d8c, 0x1580000, 0x118001b, 0x118001c, 0x118001d, 0x1180015, 0x118001f,
+    0x1180020, 0x3d68f, 0x39789, 0x1180001, 0x118001b, 0x118001c, 0x118001d, 0x1180005,
+    0x118001f, 0x1180020, 0x1300008, 0x1180009, 0x1180001, 0x39413, 0x180000, 0x39505,
+    0x1180005, 0x118000f, 0x3915d, 0x1300008, 0x1180009, 0xd00000, 0xd00000, 0x1180015,
+    0x3dccf, 0x397c5, 0x118000f, 0x3df01, 0x1580000, 0x118001b, 0x118001c, 0x118001d,
+    0x1180015, 0x118001f, 0x1180020, 0x39c03, 0x39ccd, 0x1180001, 0x118001b, 0x118001c,
+    0x118001d, 0x1180005, 0x118001f, 0x1180020, 0x1300008, 0x1180009, 0x11b9081, 0x39653,
+    0x38f0c, 0x3984e, 0x1180005, 0x118000f, 0x39d4f, 0x1300008, 0x1180009, 0x3e54f,
+    0x3e789, 0x1180015, 0x3a5c1, 0x3edcf, 0x118000f, 0x3f00f, 0x1680014, 0x118001b,
+    0x118001c, 0x118001d, 0x1180015, 0x118001f, 0x1180020, 0x3f645, 0x3f88f, 0x1180001,
+    0x118001b, 0x118001c, 0x118001d, 0x1180005, 0x118001f, 0x1180020, 0x1300008, 0x1180009,
+    0x1180001, 0x3a30c, 0x3a50d, 0x3a883, 0x1180005, 0x118000f, 0x3fecf, 0x1300008,
+    0x1180009, 0x4010f, 0x4074f, 0x1180015, 0x3a20c, 0x3a558, 0x118000f, 0x3a909,
+    0x3a750, 0x118001b, 0x118001c, 0x118001d, 0x1180015, 0x118001f, 0x1180020, 0x4098f,
+    0x40fc5, 0x1180001, 0x118001b, 0x118001c, 0x118001d, 0x1180005, 0x118001f, 0x1180020,
+    0x1300008, 0x1180009, 0x1180001, 0x3a99d, 0x4120f, 0x4184f, 0x1180005, 0x118000f,
+    0xa00000, 0x1300008, 0x1180009, 0x3afcc, 0x3a945, 0x1180015, 0x41c12, 0x1742241,
+    0x118000f, 0x1600000, 0x39e41, 0x118001b, 0x118001c, 0x118001d, 0x1180015, 0x118001f,
+    0x1180020, 0x4248f, 0x42acf, 0x1180001, 0x118001b, 0x118001c, 0x118001d, 0x1180005,
+    0x118001f, 0x1180020, 0x1300008, 0x1180009, 0x39693, 0x42d01, 0xa00000, 0xa00000,
+    0x3b181, 0x118000f, 0x1180001, 0x3a605, 0x3a645, 0x180000, 0x1180005, 0x1180015,
+    0x140000f, 0x1300008, 0x1180009, 0x1400015, 0x3ab81, 0x118001b, 0x118001c, 0x118001d,
+    0x118000f, 0x118001f, 0x1180020, 0x43353, 0xf80008, 0x4358f, 0x1180015, 0x43bc1,
+    0x3ae53, 0x380009, 0x3b8cc, 0x1180001, 0x118001b, 0x118001c, 0x118001d, 0x1180005,
+    0x118001f, 0x1180020, 0x1300008, 0x11b9709, 0x11ba001, 0x3acd3, 0x43e0f, 0x3ac0f,
+    0x1180005, 0x118000f, 0x3bd8c, 0x1300008, 0x1180009, 0x3bf4c, 0x3b34f, 0x11b9995,
+    0x3c7cc, 0x3b3cf, 0x11ba08f, 0x3b553, 0x3d04c, 0x118001b, 0x118001c, 0x11b995d,
+    0x11b9f95, 0x118001f, 0x1180020, 0x3d8cc, 0x3df8c, 0x1180001, 0x11b9fdb, 0x11ba1dc,
+    0x118001d, 0x1180005, 0x118001f, 0x1180020, 0x1300008, 0x1180009, 0x1180001, 0x3b50f,
+    0x3bc41, 0x3e14c, 0x1180005, 0x118000f, 0x3d245, 0x1300008, 0x1180009, 0x3bf83,
+    0x3e80c, 0x1180015, 0x3ba93, 0x3bb13, 0x118000f, 0x3e9cc, 0x3dacf, 0x118001b,
+    0x118001c, 0x118001d, 0x1180015, 0x118001f, 0x1180020, 0x3f24c, 0x3facc, 0x1180001,
+    0x118001b, 0x118001c, 0x118001d, 0x1180005, 0x118001f, 0x1180020, 0x1300008, 0x1180009,
+    0x1180001, 0x4034c, 0x3f441, 0x40a0c, 0x1180005, 0x118000f, 0x3fcc5, 0x1300008,
+    0x1180009, 0x180000, 0x980000, 0x1180015, 0x3b993, 0x980000, 0x118000f, 0x980000,
+    0x4054f, 0x118001b, 0x118001c, 0x118001d, 0x1180015, 0x118001f, 0x1180020, 0x3ce43,
+    0x3c5d2, 0x1180001, 0x118001b, 0x118001c, 0x118001d, 0x1180005, 0x118001f, 0x1180020,
+    0x1300008, 0x1180009, 0x1180001, 0x980000, 0x4180f, 0x1000009, 0x1180005, 0x118000f,
+    0x980000, 0x1300008, 0x1180009, 0x3ca09, 0x180000, 0x1180015, 0x3ca41, 0x3cc05,
+    0x118000f, 0x100000c, 0x3d3c9, 0x118001b, 0x118001c, 0x118001d, 0x1180015, 0x118001f,
+    0x1180020, 0x180000, 0x3d008, 0x3c053, 0x118001b, 0x118001c, 0x118001d, 0x3c693,
+    0x118001f, 0x1180020, 0x3c60c, 0x3b00d, 0x3af8e, 0x3b1cf, 0x1380000, 0xa8000f,
+    0x41601, 0x3b593, 0x3b694, 0x3cec1, 0x3c853, 0x1000001, 0x3d481, 0x3c149,
+    0x3d841, 0x1000005, 0x1080001, 0x3ee4f, 0x18bd98c, 0x3d089, 0x4164f, 0xa8001f,
+    0x3d749, 0x3c8d3, 0x100000c, 0x1780001, 0x1000001, 0x1000009, 0x3d6c1, 0x1780005,
+    0x3de89, 0x3e505, 0x1800008, 0x1780009, 0xc00012, 0x3cfdb, 0x100001b, 0x100001b,
+    0x100001c, 0x178000f, 0x3dfd5, 0x3e6d2, 0x100001b, 0x3ea09, 0x3f049, 0x1780015,
+    0x40f01, 0x3e755, 0x3ea52, 0x3ecd4, 0x3dd85, 0x178001b, 0x178001c, 0x178001d,
+    0x3e1c9, 0x178001f, 0x1780020, 0x40ec9, 0x3ee09, 0x3eed0, 0x3e00f, 0x100000f,
+    0x3f2d2, 0x3f1c5, 0x41a44, 0x3f54e, 0x3f789, 0x3f985, 0x3f695, 0x3ed15,
+    0x1900014, 0x800002, 0x3f7c9, 0x3fd41, 0x40181, 0x3fd85, 0x1900005, 0x1900001,
+    0x1900014, 0x3ff41, 0x403c5, 0x40681, 0x404d5, 0x406cf, 0x40a92, 0x41455,
+    0x3f4dc, 0x40901, 0x40e09, 0x409c5, 0x41409, 0x190000f, 0x3fa1d, 0x3ffcf,
+    0x41101, 0x41a89, 0x40acc, 0x41549, 0x41e55, 0x41889, 0x41909, 0x44452,
+    0x40c52, 0x424d5, 0x41a09, 0x41b03, 0x41d4e, 0x1800005, 0x41bc4, 0x42289,
+    0x1780001, 0x44b8d, 0x420c6, 0x42210, 0x1780005, 0x421d5, 0x41fce, 0x1800008,
+    0x1780009, 0x4244d, 0x429c2, 0x800012, 0xa80007, 0x41cd3, 0x178000f, 0x1980001,
+    0x42649, 0x431c1, 0x42b52, 0x19c2b05, 0x1780015, 0x438c9, 0x42c55, 0x19c46c9,
+    0x43509, 0x43647, 0x178001b, 0x178001c, 0x178001d, 0x19c240f, 0x178001f, 0x1780020,
+    0x42c92, 0x42e60, 0x43009, 0x19c2cd5, 0x42a5d, 0x43689, 0x433c1, 0x43a09,
+    0x800012, 0x198001b, 0x198001c, 0x19c255d, 0x42edd, 0x19c271f, 0x1980020, 0x1000001,
+    0x43a81, 0x800003, 0x800014, 0x44892, 0x43443, 0x800007, 0x432dd, 0x43d86,
+    0x448c5, 0x4375d, 0x43d4e, 0x43a5d, 0x444c6, 0x43c4c, 0x80000d, 0x44253,
+    0x4341b, 0x800013, 0x800014, 0x43d12, 0x43e85, 0x44181, 0x4470d, 0x4498e,
+    0x44692, 0x44605, 0x43b5b, 0x43dcc, 0x441cd, 0x43f8e, 0x44646, 0x44793,
+    0x44813, 0x800012, 0x44ac9, 0x1180018, 0x980000, 0x44a8d, 0x1a00001, 0x1a80005,
+    0x44d4f, 0x980000, 0x1a00005, 0x4435c, 0x449c5, 0x180000, 0x1a00009, 0x180000,
+    0x180000, 0x180000, 0x44f13, 0x980000, 0x1a4474f, 0x44bcf, 0x1380000, 0x44b0f,
+    0x1b00001, 0x980000, 0x1a00015, 0x980000, 0xa00000, 0x44f93, 0x1380000, 0x1380000,
+    0x1a0001b, 0x1a0001c, 0x1a0001d, 0x1780001, 0x1a0001f, 0x1a00020, 0x44e53, 0x1780005,
+    0x1380000, 0x1380000, 0x1800008, 0x1780009, 0x1780001, 0x980000, 0x980000, 0x980000,
+    0x1780005, 0x178000f, 0x980000, 0x1800008, 0x1780009, 0x180000, 0x980013, 0x1780015,
+    0x45013, 0xf00000, 0x178000f, 0x4504f, 0x180000, 0x178001b, 0x178001c, 0x178001d,
+    0x1780015, 0x178001f, 0x1780020, 0x44c01, 0x45b01, 0x4528f, 0x178001b, 0x178001c,
+    0x178001d, 0x458cf, 0x178001f, 0x1780020, 0x1780001, 0x4614f, 0x44fcd, 0x1480009,
+    0x1780005, 0x4510f, 0x45a85, 0x1800008, 0x1780009, 0x1780001, 0x45cc9, 0x45445,
+    0x47054, 0x1780005, 0x178000f, 0x463c9, 0x1800008, 0x1780009, 0x45c55, 0x470c9,
+    0x1780015, 0x4570f, 0x47512, 0x178000f, 0x471d5, 0x48614, 0x17c4cdb, 0x178001c,
+    0x178001d, 0x1780015, 0x178001f, 0x1780020, 0x44d01, 0x47ed5, 0x1780001, 0x178001b,
+    0x178001c, 0x178001d, 0x1780005, 0x178001f, 0x1780020, 0x1800008, 0x1780009, 0x1780001,
+    0x48655, 0x4844f, 0x4538f, 0x1780005, 0x178000f, 0x1445152, 0x1800008, 0x1780009,
+    0x47850, 0x48843, 0x1780015, 0x1400009, 0x48114, 0x178000f, 0x48a85, 0x45741,
+    0x178001b, 0x178001c, 0x178001d, 0x1780015, 0x178001f, 0x1780020, 0x472cf, 0x48a0c,
+    0x459c5, 0x178001b, 0x178001c, 0x178001d, 0x451c9, 0x178001f, 0x1780020, 0x45945,
+    0x465d2, 0x1400009, 0x460cf, 0x1445b55, 0x148000e, 0x45312, 0x4731f, 0x453d4,
+    0x45515, 0x4524f, 0x48941, 0x47a95, 0x46c02, 0x46201, 0x1000020, 0x46e85,
+    0x45496, 0x462c5, 0x46406, 0x1400004, 0x466c1, 0x46649, 0x46b07, 0x1446f0d,
+    0x46bc9, 0x144668d, 0x48c09, 0x4670f, 0x47212, 0x464d1, 0x46e54, 0x48201,
+    0x46914, 0x46755, 0x46a4f, 0x46b50, 0x46b95, 0x46d41, 0x46f45, 0x46f85,
+    0x46ad5, 0x46cc5, 0x46fc9, 0x47289, 0x469dd, 0x48d54, 0x47890, 0x140000e,
+    0x46d0c, 0x4708f, 0x47682, 0x46a8f, 0x47352, 0x47485, 0x46ed2, 0x47603,
+    0x47441, 0xf80014, 0x47bc3, 0x1400004, 0x489c1, 0x47b46, 0x47b87, 0x476c8,
+    0x47790, 0x140000a, 0x47545, 0x478cc, 0x140000d, 0x48d04, 0x47dc9, 0x148000c,
+    0xf80014, 0x1400012, 0x1400013, 0x48094, 0x48343, 0x47916, 0x48145, 0x48546,
+    0x48685, 0x481c8, 0x1400005, 0x488c4, 0x48885, 0x1480000, 0x48b07, 0x485cc,
+    0x48a49, 0x1480000, 0x48b49, 0x180000, 0x484d3, 0x48594, 0x48393, 0x48416,
+    0x48ace, 0x180000, 0x180000, 0x48994, 0x48793, 0x180001, 0x1780001, 0x180000,
+    0x48e93, 0x140001c, 0x1780005, 0x180000, 0x48ed3, 0x1800008, 0x1780009, 0x1780001,
+    0x980000, 0x180000, 0x49005, 0x1780005, 0x178000f, 0x495c1, 0x1800008, 0x1780009,
+    0x4944e, 0x491d3, 0x1780015, 0x49745, 0x496d3, 0x178000f, 0x1b80000, 0x49793,
+    0x178001b, 0x178001c, 0x178001d, 0x1780015, 0x178001f, 0x1780020, 0x1b80000, 0x49613,
+    0x1780001, 0x178001b, 0x178001c, 0x178001d, 0x1780005, 0x178001f, 0x1780020, 0x1800008,
+    0x1780009, 0x490d3, 0x1b80000, 0x180000, 0x180000, 0x180000, 0x178000f, 0x180000,
+    0x49112, 0x49193, 0x494cd, 0x48b89, 0x1780015, 0x1b80000, 0x1500000, 0x1b80000,
+    0x48f0e, 0x1b80000, 0x178001b, 0x178001c, 0x178001d, 0x48f93, 0x178001f, 0x1780020,
+    0x48dc9, 0x4970d, 0x48e49, 0x4948e, 0x1b80000, 0x4920e, 0x48fcd, 0x493ce,
+    0x49513, 0x4980d, 0x492d3, 0x1b80000, 0x49413, 0x49089, 0x4988d, 0x980000,
+    0x49a13, 0x4984f, 0x980000, 0x980000, 0x49249, 0x49a92, 0x80000e, 0x49593,
+    0x800012, 0x4964e, 0x980000, 0x497c1, 0x800012, 0x49954, 0x49693, 0x49385,
+    0x49b09, 0x800001, 0x49549, 0x498c9, 0x800013, 0x800005, 0x800012, 0x4990d,
+    0x49b4d, 0x49b8d, 0x800003, 0x1c00009, 0x49d09, 0x700000, 0xd80000, 0x80000f,
+    0x800012, 0x800012, 0x80000e, 0x800003, 0x49dcf, 0x4a00f, 0x49a4e, 0x49bce,
+    0x800011, 0x1780001, 0x49993, 0x80001b, 0x80001c, 0x1780005, 0x700000, 0x80001f,
+    0x1800008, 0x1780009, 0x800012, 0x499c5, 0x800014, 0xd80000, 0xf00000, 0x178000f,
+    0x800001, 0x49ed3, 0x980000, 0x980000, 0x800005, 0x1780015, 0x4a093, 0x800001,
+    0xf00001, 0x1d80001, 0x4a785, 0x178001b, 0x178001c, 0x178001d, 0x80000f, 0x178001f,
+    0x1780020, 0x1780001, 0x49d4e, 0x49e0f, 0x1e00000, 0x1780005, 0x4aa81, 0x4a553,
+    0x1800008, 0x1780009, 0x1780001, 0x4a8cf, 0x4ac8f, 0x1e80012, 0x1780005, 0x178000f,
+    0x1580000, 0x1800008, 0x1780009, 0x800001, 0x1f4a48e, 0x1780015, 0x4a394, 0x800005,
+    0x178000f, 0x1580000, 0x1600000, 0x178001b, 0x178001c, 0x178001d, 0x1780015, 0x178001f,
+    0x1780020, 0x4ab43, 0x4a64e, 0x1780001, 0x178001b, 0x178001c, 0x178001d, 0x1780005,
+    0x178001f, 0x1780020, 0x1800008, 0x1780009, 0x1780001, 0x80001b, 0x4a84f, 0x4ac13,
+    0x1780005, 0x178000f, 0x4a34c, 0x1800008, 0x1780009, 0x4ac54, 0x1f80000, 0x1780015,
+    0x4a953, 0x1f80000, 0x178000f, 0x4a4c5, 0x4ad09, 0x178001b, 0x178001c, 0x178001d,
+    0x1780015, 0x178001f, 0x1780020, 0x4ad4e, 0x2000014, 0x1c80001, 0x178001b, 0x178001c,
+    0x178001d, 0x1c80005, 0x178001f, 0x1780020, 0x4a9d3, 0x1cc9d89, 0x4b00e, 0x4af4d,
+    0x2080012, 0x4add2, 0x4b092, 0x1cc9e4f, 0x1780001, 0x4b389, 0x1d00012, 0x800000,
+    0x1780005, 0x1c80015, 0x4ad93, 0x1800008, 0x1780009, 0x4af89, 0x4ae09, 0x1c8001b,
+    0x1c8001c, 0x1c8001d, 0x178000f, 0x1cc9c1f, 0x1c80020, 0x80001d, 0x4b2c9, 0x4b443,
+    0x1780015, 0x4b483, 0x4b253, 0x4b413, 0x4b7d3, 0x1780001, 0x178001b, 0x178001c,
+    0x178001d, 0x1780005, 0x178001f, 0x1780020, 0x1800008, 0x1780009, 0x1780001, 0x4b195,
+    0xe00013, 0x180000, 0x1780005, 0x178000f, 0x4b64e, 0x1800008, 0x1780009, 0x4becc,
+    0x4b701, 0x1780015, 0x4b1e0, 0x4bc13, 0x178000f, 0x4c385, 0xa00000, 0x178001b,
+    0x178001c, 0x178001d, 0x1780015, 0x178001f, 0x1780020, 0x4ba0f, 0x4b3cf, 0x1780001,
+    0x178001b, 0x178001c, 0x178001d, 0x1780005, 0x178001f, 0x1780020, 0x1800008, 0x1780009,
+    0x49e85, 0x4b793, 0x4c2d3, 0x4c445, 0x4a289, 0x178000f, 0x4b4df, 0x4c645,
+    0x4c713, 0x4ca0c, 0x4c813, 0x1780015, 0x4bcc1, 0x4a152, 0x2200000, 0x4c913,
+    0x4bd05, 0x178001b, 0x178001c, 0x178001d, 0x1780001, 0x178001f, 0x1780020, 0x49f5c,
+    0x1780005, 0x180000, 0x4bd8f, 0x1800008, 0x1780009, 0x1780001, 0x4cecc, 0x4be41,
+    0x4d9cc, 0x1780005, 0x178000f, 0x4be85, 0x1800008, 0x1780009, 0x4c041, 0x4d1c1,
+    0x1780015, 0x980000, 0x4c085, 0x178000f, 0x4c3d3, 0x4bf4f, 0x178001b, 0x178001c,
+    0x178001d, 0x1780015, 0x178001f, 0x1780020, 0x4c0cf, 0x4d20f, 0x1780001, 0x178001b,
+    0x178001c, 0x178001d, 0x1780005, 0x178001f, 0x1780020, 0x1800008, 0x1780009, 0x1780001,
+    0x4d653, 0x4c101, 0x180000, 0x1780005, 0x178000f, 0x4c145, 0x1800008, 0x1780009,
+    0x4c841, 0x180000, 0x1780015, 0x1380000, 0x4c885, 0x178000f, 0x80000f, 0x4c20f,
+    0x178001b, 0x178001c, 0x178001d, 0x1780015, 0x178001f, 0x1780020, 0x4c8cf, 0x4c587,
+    0x1780001, 0x178001b, 0x178001c, 0x178001d, 0x1780005, 0x178001f, 0x1780020, 0x1800008,
+    0x1780009, 0x1780001, 0x4dd41, 0x1000012, 0x100000c, 0x1780005, 0x178000f, 0x1000004,
+    0x1800008, 0x1780009, 0x4ca81, 0x1000004, 0x1780015, 0x1080005, 0x4cac5, 0x178000f,
+    0x4ddcf, 0x180000, 0x178001b, 0x178001c, 0x178001d, 0x1780015, 0x178001f, 0x1780020,
+    0x4cb0f, 0x100000f, 0x1780001, 0x178001b, 0x178001c, 0x178001d, 0x1780005, 0x178001f,
+    0x1780020, 0x1800008, 0x1780009, 0x1780001, 0x4c493, 0x108000e, 0x108000c, 0x1780005,
+    0x178000f, 0x100001f, 0x1800008, 0x1780009, 0x4cb81, 0x1080004, 0x1780015, 0x108000c,
+    0x4cbc5, 0x178000f, 0x108000d, 0x180000, 0x178001b, 0x178001c, 0x178001d, 0x1780015,
+    0x178001f, 0x1780020, 0x4cc0f, 0x1d8000d, 0x1780001, 0x178001b, 0x178001c, 0x178001d,
+    0x1780005, 0x178001f, 0x1780020, 0x1800008, 0x1780009, 0x1780001, 0x4c4d3, 0x4cc41,
+    0x4dc01, 0x1780005, 0x178000f, 0x4cc85, 0x1800008, 0x1780009, 0x4ce01, 0x100000d,
+    0x1780015, 0x4dad3, 0x4ce45, 0x178000f, 0x4df4c, 0x4cccf, 0x178001b, 0x178001c,
+    0x178001d, 0x1780015, 0x178001f, 0x1780020, 0x4ce8f, 0x4dc4e, 0x1780001, 0x178001b,
+    0x178001c, 0x178001d, 0x1780005, 0x178001f, 0x1780020, 0x1800008, 0x1780009, 0x1780001,
+    0x4df85, 0x4d241, 0x80000e, 0x1780005, 0x178000f, 0x4d385, 0x1800008, 0x1780009,
+    0x4d401, 0x100000c, 0x1780015, 0x1000003, 0x4d445, 0x178000f, 0x4dd85, 0x4d3cf,
+    0x178001b, 0x178001c, 0x178001d, 0x1780015, 0x178001f, 0x1780020, 0x4d48f, 0x800003,
+    0x1780001, 0x178001b, 0x178001c, 0x178001d, 0x1780005, 0x178001f, 0x1780020, 0x1800008,
+    0x1780009, 0x1780001, 0x80000f, 0x4cd8a, 0x4e003, 0x1780005, 0x178000f, 0x4d88e,
+    0x1800008, 0x1780009, 0x4d581, 0x800013, 0x1780015, 0x680002, 0x4d5c5, 0x178000f,
+    0x4dfd5, 0x180000, 0x178001b, 0x178001c, 0x178001d, 0x1780015, 0x178001f, 0x1780020,
+    0x4d60f, 0x2280012, 0x1780001, 0x178001b, 0x178001c, 0x178001d, 0x1780005, 0x178001f,
+    0x1780020, 0x1800008, 0x1780009, 0x1780001, 0x4d4d3, 0x2280012, 0x100000c, 0x1780005,
+    0x178000f, 0x4e194, 0x1800008, 0x1780009, 0x4d741, 0x230000f, 0x1780015, 0x4e109,
+    0x4d785, 0x178000f, 0x4e153, 0x180000, 0x178001b, 0x178001c, 0x178001d, 0x1780015,
+    0x178001f, 0x1780020, 0x4d7cf, 0x4e1d3, 0x1780001, 0x178001b, 0x178001c, 0x178001d,
+    0x1780005, 0x178001f, 0x1780020, 0x1800008, 0x1780009, 0x1780001, 0x4d513, 0x1000012,
+    0x4e352, 0x1780005, 0x178000f, 0x2380005, 0x1800008, 0x1780009, 0x4d801, 0x4e252,
+    0x1780015, 0x4e412, 0x4d985, 0x178000f, 0x4e301, 0x180000, 0x178001b, 0x178001c,
+    0x178001d, 0x1780015, 0x178001f, 0x1780020, 0x4db4f, 0x4e20e, 0x1780001, 0x178001b,
+    0x178001c, 0x178001d, 0x1780005, 0x178001f, 0x1780020, 0x1800008, 0x1780009, 0x2100001,
+    0x4d553, 0x4db81, 0x4e290, 0x2100005, 0x178000f, 0x4dbc5, 0x2180008, 0x2100009,
+    0x4e50c, 0x4e396, 0x1780015, 0x80000c, 0x4e489, 0x210000f, 0x4e4c5, 0x4dd0f,
+    0x178001b, 0x178001c, 0x178001d, 0x2100015, 0x178001f, 0x1780020, 0x800003, 0x4e615,
+    0x1780001, 0x210001b, 0x210001c, 0x210001d, 0x1780005, 0x210001f, 0x2100020, 0x1800008,
+    0x1780009, 0x1780001, 0x4b84e, 0x4e3d3, 0x4df10, 0x1780005, 0x178000f, 0x800014,
+    0x1800008, 0x1780009, 0x4de56, 0x84e5c3, 0x1780015, 0x4e644, 0x4e552, 0x178000f,
+    0x980000, 0x980000, 0x178001b, 0x178001c, 0x178001d, 0x1780015, 0x178001f, 0x1780020,
+    0x180000, 0x4e74c, 0x1780001, 0x178001b, 0x178001c, 0x178001d, 0x1780005, 0x178001f,
+    0x1780020, 0x1800008, 0x1780009, 0x4de13, 0x4de93, 0x1000003, 0x4e045, 0x100000d,
+    0x178000f, 0x1ccb501, 0x4e089, 0x4ded3, 0x100000c, 0x1c80005, 0x1780015, 0x80000d,
+    0x1000014, 0x1ccb549, 0x1000001, 0x4e78f, 0x178001b, 0x178001c, 0x178001d, 0x1c8000f,
+    0x178001f, 0x1780020, 0x1d00012, 0x4ea84, 0x2500015, 0x1c80015, 0x4e0dd, 0x1300014,
+    0x100000f, 0x1300014, 0x1780001, 0x1ccb59b, 0x1c8001c, 0x1c8001d, 0x1780005, 0x1c8001f,
+    0x1c80020, 0x1800008, 0x1780009, 0x1780001, 0x1000001, 0x4e952, 0x4e805, 0x1780005,
+    0x178000f, 0x4e992, 0x1800008, 0x1780009, 0x4ead4, 0x4e7d3, 0x1780015, 0x4e90c,
+    0x4ee10, 0x178000f, 0x100000f, 0x100000e, 0x178001b, 0x178001c, 0x178001d, 0x1780015,
+    0x178001f, 0x1780020, 0x4ee4e, 0x4ee92, 0x1780001, 0x178001b, 0x178001c, 0x178001d,
+    0x1780005, 0x178001f, 0x1780020, 0x1800008, 0x1780009, 0x1780001, 0x4eccf, 0x4eb45,
+    0x4ea0c, 0x1780005, 0x178000f, 0x4ef12, 0x1800008, 0x1780009, 0x4ebd2, 0x4efcc,
+    0x1780015, 0x4ec4f, 0x4ed95, 0x178000f, 0x4ed13, 0x4f012, 0x178001b, 0x178001c,
+    0x178001d, 0x1780015, 0x178001f, 0x1780020, 0x4edd3, 0x80000d, 0x1a4b741, 0x178001b,
+    0x178001c, 0x178001d, 0x1a4b285, 0x178001f, 0x1780020, 0x4f31a, 0x1a4bac9, 0x1780001,
+    0x80000d, 0x4f292, 0x800001, 0x1780005, 0x1a4b80f, 0x4f3c3, 0x1800008, 0x1780009,
+    0x4f403, 0x80000d, 0x1a4b955, 0x4f254, 0x4f354, 0x178000f, 0x4dc95, 0x4f053,
+    0x1a0001b, 0x1a0001c, 0x1a0001d, 0x1780015, 0x1a0001f, 0x1a00020, 0x4f2da, 0x4f38c,
+    0x1780001, 0x178001b, 0x178001c, 0x178001d, 0x1780005, 0x178001f, 0x1780020, 0x1800008,
+    0x1780009, 0x1780001, 0x800012, 0x800012, 0x800012, 0x1780005, 0x178000f, 0x800012,
+    0x1800008, 0x1780009, 0x4ef8c, 0x1d0000c, 0x1780015, 0x4f4d4, 0x1000012, 0x178000f,
+    0x88000e, 0x4f514, 0x178001b, 0x178001c, 0x178001d, 0x1780015, 0x178001f, 0x1780020,
+    0x4f649, 0x4f113, 0x2480001, 0x178001b, 0x178001c, 0x178001d, 0x24ce445, 0x178001f,
+    0x1780020, 0x4f5d0, 0x2480009, 0x80000e, 0x4f749, 0x4f714, 0x4f584, 0x2280019,
+    0x248000f, 0x4f549, 0x4eb07, 0x244e6d2, 0x4f802, 0x1000009, 0x2480015, 0x4ec8c,
+    0x4e9cd, 0x104ed4e, 0x1000004, 0x2580012, 0x248001b, 0x248001c, 0x248001d, 0x2580005,
+    0x248001f, 0x2480020, 0x4f7d4, 0x2580005, 0x2600014, 0x4eeda, 0x2600013, 0x4f782,
+    0x4f48d, 0x980000, 0x4fa93, 0x268001e, 0x980000, 0x4face, 0x980000, 0x4fb53,
+    0x180000, 0x4f20c, 0x2700001, 0x4fb93, 0x2780000, 0x4fb12, 0x2700005, 0x4f6d3,
+    0x4fbc9, 0x2380008, 0x2700009, 0x2700001, 0x4fc05, 0x4fe41, 0x4fc49, 0x2700005,
+    0x270000f, 0x4fe85, 0x2380008, 0x2700009, 0x4fccf, 0x4ff01, 0x2700015, 0x4ff45,
+    0x4fec9, 0x270000f, 0x4f90c, 0x50212, 0x270001b, 0x270001c, 0x270001d, 0x2700015,
+    0x270001f, 0x2700020, 0x4f8d4, 0x4ff92, 0x2700001, 0x270001b, 0x270001c, 0x270001d,
+    0x2700005, 0x270001f, 0x2700020, 0x2380008, 0x2700009, 0x2700001, 0x1400012, 0x50012,
+    0x4f989, 0x2700005, 0x270000f, 0x4fc8c, 0x2380008, 0x2700009, 0x50149, 0x50052,
+    0x2700015, 0x4f9d2, 0x500d5, 0x270000f, 0x50252, 0x140000a, 0x270001b, 0x270001c,
+    0x270001d, 0x2700015, 0x270001f, 0x2700020, 0x4ffd3, 0x4fdc2, 0x2700001, 0x270001b,
+    0x270001c, 0x270001d, 0x2700005, 0x270001f, 0x2700020, 0x2380008, 0x2700009, 0x50587,
+    0x4fd0d, 0x4fa4e, 0x1400003, 0x4fd50, 0x270000f, 0x4fd92, 0x4fe13, 0x1400014,
+    0x501c1, 0x5028e, 0x2700015, 0x140000c, 0x50185, 0x140000e, 0x502c5, 0x5034f,
+    0x270001b, 0x270001c, 0x270001d, 0x50709, 0x270001f, 0x2700020, 0x140000a, 0x505ce,
+    0x50615, 0x50405, 0x5084d, 0x50642, 0x50115, 0x50492, 0x1400001, 0x1000016,
+    0x50985, 0x50745, 0x1400004, 0x1400004, 0x140000d, 0x5088c, 0x509cc, 0x140001e,
+    0x508c3, 0x506c4, 0x1400007, 0x504d2, 0x140000d, 0x50b09, 0x1480012, 0x50a8f,
+    0x50905, 0x1900005, 0x50e49, 0x1400019, 0x50bc9, 0x50a12, 0x1400013, 0x50952,
+    0x140000e, 0x50b81, 0x50ccf, 0x50ace, 0x5108e, 0x50c85, 0x50f41, 0x50e85,
+    0x507cf, 0x50b49, 0x50c13, 0x100001e, 0x50f12, 0x100000e, 0x1400013, 0x50c4f,
+    0x100000e, 0x100000e, 0x100000e, 0x50ec1, 0x148000a, 0x50d15, 0x140000d, 0x51541,
+    0x51885, 0xf80009, 0x1400001, 0x51705, 0x51c01, 0x50d41, 0x518c5, 0x1480012,
+    0x1480014, 0x5100f, 0x512cc, 0x51e01, 0x51352, 0x5114f, 0x50f81, 0x51b81,
+    0x51b41, 0x51dcf, 0x140000f, 0x5164f, 0x52112, 0x510db, 0x1400009, 0x1400008,
+    0x1480001, 0x4f85b, 0x140001c, 0x140000c, 0x140000f, 0x5140f, 0x140000f, 0x51492,
+    0x51812, 0x1400012, 0x51315, 0x1400001, 0x1400015, 0x51f01, 0x148000f, 0x51d05,
+    0x515db, 0x4f89b, 0x5199b, 0x51c49, 0x140001f, 0x51d89, 0x51f93, 0x51fc7,
+    0x52489, 0x140000f, 0x51f45, 0x5230e, 0x1400012, 0x521c5, 0x140000e, 0x1400015,
+    0x524c5, 0x5214c, 0x52345, 0x52445, 0x5200f, 0x52245, 0x52584, 0x4fa12,
+    0x52549, 0x145240c, 0x522d4, 0x1400012, 0x5204f, 0x5208f, 0x1480005, 0x52514,
+    0x1400005, 0x1480010, 0x1480003, 0x1480004, 0x140000a, 0x525c1, 0x52605, 0x52689,
+    0x2800003, 0xf80007, 0x52754, 0x288000e, 0x148000c, 0x52385, 0x52641, 0x2880012,
+    0x2880013, 0x1400005, 0x1480000, 0x1480000, 0x1b80000, 0x140000d, 0x1b80000, 0x526d4,
+    0x2900000, 0x527d3, 0x1400012, 0x1b80000, 0x1b80000, 0x52a01, 0x1b80000, 0x1b80000,
+    0x1b80000, 0x52785, 0x52a53, 0x1b80000, 0x52ad3, 0x5270d, 0x5280f, 0x1b80000,
+    0x1b80000, 0x1b80000, 0x1b80000, 0x52893, 0x1b80000, 0x52b13, 0x1b80000, 0x1b80000,
+    0x1b80000, 0x1b80000, 0x1b80000, 0x1500000, 0x52bd3, 0x1500000, 0x2980000, 0x980000,
+    0x52849, 0x52d93, 0x5298f, 0x80000e, 0x528cd, 0x52b4e, 0x52909, 0x52dc4,
+    0x980000, 0x52c45, 0x52b93, 0x529cf, 0x800002, 0x800001, 0x800009, 0x52a8f,
+    0x52c13, 0x52c8f, 0x52d53, 0x80000d, 0x52f13, 0x52d01, 0x800009, 0x800009,
+    0x2700001, 0x52cc3, 0x52f93, 0x1580000, 0x2700005, 0x52ed4, 0x52fce, 0x2380008,
+    0x2700009, 0x2700001, 0x980000, 0x52f54, 0x52e4f, 0x2700005, 0x270000f, 0x52e0e,
+    0x2380008, 0x2700009, 0x53285, 0x531d3, 0x2700015, 0x530d3, 0x532c1, 0x270000f,
+    0x1d80013, 0x52e98, 0x270001b, 0x270001c, 0x270001d, 0x2700015, 0x270001f, 0x2700020,
+    0x2a5320e, 0x5300f, 0x53045, 0x270001b, 0x270001c, 0x270001d, 0x180000, 0x270001f,
+    0x2700020, 0x5324c, 0x5310d, 0x53095, 0x2700001, 0x53153, 0x53593, 0x1f80000,
+    0x2700005, 0x53194, 0x980000, 0x2380008, 0x2700009, 0x53614, 0x53641, 0x2a8000e,
+    0xb00000, 0x533d3, 0x270000f, 0x2700001, 0x1e8000f, 0x2b80001, 0x2b00005, 0x2700005,
+    0x2700015, 0x53304, 0x2380008, 0x2700009, 0x5370f, 0x535d3, 0x270001b, 0x270001c,
+    0x270001d, 0x270000f, 0x270001f, 0x2700020, 0x53384, 0x53803, 0x53789, 0x2700015,
+    0x1e80011, 0x800000, 0x537d4, 0x800013, 0x80000e, 0x270001b, 0x270001c, 0x270001d,
+    0x2c00000, 0x270001f, 0x2700020, 0x1e80011, 0x53754, 0x800007, 0x1000010, 0xb00010,
+    0x80000a, 0x80000e, 0x53909, 0x53989, 0x2c00000, 0x5394e, 0xa00000, 0xa00000,
+    0x53b83, 0x53ace, 0x53858, 0x53d03, 0x536cf, 0x2080004, 0x2c80012, 0x53c02,
+    0x2c80012, 0x5388c, 0x53b20, 0x53a8e, 0x539d6, 0x53e14, 0x53bc3, 0x53a13,
+    0x980000, 0x53a54, 0x53c87, 0x2200000, 0x180000, 0x53cca, 0x180000, 0x2d00012,
+    0x53c53, 0x180000, 0x180000, 0x54653, 0x54201, 0x180000, 0x53b53, 0x53ed4,
+    0x54245, 0x2200000, 0x180000, 0x180000, 0x180000, 0x180000, 0x53f93, 0x54193,
+    0x180000, 0x541d3, 0x542cf, 0x180000, 0x54313, 0x54353, 0x180000, 0x180000,
+    0x54413, 0x180000, 0x180000, 0x180000, 0x54453, 0x54493, 0x544d3, 0x54513,
+    0x54553, 0x180000, 0x5470c, 0x54613, 0x980000, 0x5478c, 0x546cd, 0x5458e,
+    0x980000, 0x1380000, 0xd80000, 0xd80000, 0x980000, 0x5484c, 0x547cd, 0x5468e,
+    0xa80012, 0x54b01, 0x180000, 0x180000, 0x180000, 0x54b85, 0x1380000, 0x1380000,
+    0x1380000, 0x1380000, 0x1380000, 0x1380000, 0x549d3, 0x54a13, 0x54a93, 0x54bcf,
+    0x2200000, 0x180000, 0x180000, 0x2400005, 0x54f41, 0x54c53, 0x54c93, 0x54cd3,
+    0x54f85, 0x54d13, 0x54d53, 0x54d93, 0x54dd3, 0x54e13, 0x54e53, 0x980000,
+    0x980000, 0x180000, 0x5500f, 0x54e93, 0x54ed3, 0x54f13, 0x180000, 0x180000,
+    0x2200000, 0x180000, 0x180000, 0x180000, 0x180000, 0x180000, 0x2200000, 0x180000,
+    0x180000, 0x2200000, 0x550d3, 0x55113, 0x55153, 0x980000, 0x980000, 0x980000,
+    0x180000, 0x55193, 0x551d3, 0x55213, 0x55253, 0x55293, 0x180000, 0x55405,
+    0x55381, 0x552d3, 0x55313, 0x55353, 0x553c5, 0x180000, 0x2200000, 0x180000,
+    0x55513, 0x55553, 0x55593, 0x555d3, 0x180000, 0x180000, 0x5548f, 0x180000,
+    0x980000, 0x55613, 0x980000, 0x180000, 0xc0000c, 0x2d80001, 0x2d80005, 0x2080014,
+    0x55653, 0x55693, 0x556d3, 0x800005, 0x5588e, 0x2080014, 0x557c9, 0x55713,
+    0x55753, 0x800009, 0x55793, 0x55805, 0x800003, 0x100001b, 0x1000001, 0x190000e,
+    0x190000e, 0x190000e, 0x1000005, 0x800014, 0x800004, 0x800003, 0x55843, 0x55989,
+    0x800014, 0x1000014, 0x554ce, 0x1000014, 0x800014, 0x55449, 0x800014, 0x800007,
+    0x800009, 0x558ce, 0x800009, 0x800014, 0x55a13, 0x1000001, 0x559c9, 0x1000012,
+    0x100001b, 0x1000005, 0x5594f, 0x55a81, 0x130000e, 0x55ac5, 0x2e00009, 0x2e00010,
+    0x55915, 0x1300013, 0x55b12, 0x2e80001, 0x2e00009, 0x538cf, 0x1000007, 0x55a50,
+    0x2e80009, 0x1880004, 0x2e80005, 0x2e8000f, 0x2e80001, 0x1880005, 0x1d0000d, 0x100001b,
+    0x2e80001, 0x2e80001, 0x2e80009, 0x1d00016, 0x2e80005, 0x55b92, 0xa80010, 0x80000d,
+    0x800014, 0x80000d, 0x2e8000f, 0x1000014, 0x1000001, 0x1000001, 0x100000d, 0x55b45,
+    0x800001, 0x800001, 0x1000009, 0x55d15, 0x1000010, 0x1000014, 0x1000009, 0x55bc9,
+    0x55cc5, 0x55c45, 0x2e8001b, 0x2e8001c, 0x1000005, 0x1000001, 0x55c85, 0x55f49,
+    0x55d43, 0x1000001, 0x1800010, 0x168000e, 0x2600005, 0x55e49, 0x100001b, 0x55e9f,
+    0x180000a, 0x800009, 0x980000, 0x55c1d, 0x55d81, 0x980000, 0x2780000, 0x1400014,
+    0x140000c, 0x55f05, 0x140000f, 0x55f9d, 0x55fc5, 0x2280004, 0x561c3, 0x56005,
+    0x56081, 0x55edd, 0x1400014, 0x1000014, 0x1400013, 0x573d5, 0x56284, 0x140001e,
+    0x148001e, 0x140000c, 0x56052, 0x55e0f, 0x1400010, 0x5620c, 0x56105, 0x1400004,
+    0x1400012, 0x56241, 0x56343, 0x1400004, 0x560d4, 0x1400007, 0x56152, 0x56192,
+    0x1400012, 0x1400016, 0x1000012, 0x1400014, 0x1400010, 0x562cd, 0x140000e, 0x563c1,
+    0x2280013, 0x140000e, 0x140000d, 0x1400012, 0x2f00005, 0x56396, 0x1400014, 0x1400012,
+    0x1400004, 0x56409, 0x1400012, 0x56442, 0x1000012, 0x100000c, 0x1400004, 0x1400014,
+    0x564c2, 0x140000c, 0x1456745, 0x56703, 0x566c9, 0x1400012, 0x567c9, 0x1400003,
+    0x56609, 0x1400012, 0x5688e, 0x2f0001c, 0x56505, 0x1400002, 0x140000c, 0x568c9,
+    0x1400014, 0x56807, 0x140000d, 0x1400007, 0x56643, 0x5684c, 0x57149, 0x1400014,
+    0x569ce, 0x1400010, 0x1480004, 0x56790, 0x1400014, 0x1400003, 0x1400004, 0x140000c,
+    0x56ace, 0x56916, 0x140000e, 0x56b4e, 0x5694c, 0x1456a92, 0x56b01, 0x140000c,
+    0x1400005, 0x56e0c, 0x56a12, 0x56bd3, 0x1400014, 0x1400012, 0x1400014, 0x56985,
+    0x1400003, 0x56e54, 0x56f0e, 0x1480004, 0x56a4f, 0x140000d, 0x1400012, 0x140001a,
+    0x56d44, 0x1400001, 0x56c55, 0x1400007, 0x56e82, 0x5708c, 0x56b91, 0x56d12,
+    0x56c1b, 0x1400014, 0x140001a, 0x56d8f, 0x56c9f, 0x56ce0, 0x56dd2, 0x1400002,
+    0x140000a, 0x1400004, 0x56f8c, 0x140001e, 0x1400004, 0x57012, 0x570c5, 0x140000a,
+    0x1400012, 0x56f4c, 0x140000d, 0x56ece, 0x5704e, 0x1400010, 0x572c2, 0x1400012,
+    0x1400012, 0x1400013, 0x5724e, 0x140000d, 0x148000c, 0x140000e, 0x1400012, 0x1480009,
+    0x57309, 0x57185, 0x140001a, 0x571ce, 0x148001e, 0x5711c, 0x57389, 0x1480003,
+    0x1480003, 0x57281, 0x57352, 0x57452, 0x1400002, 0x574c1, 0x57403, 0x148000e,
+    0x57507, 0x1400012, 0x1400018, 0x57745, 0x1400007, 0x1400012, 0x575c1, 0x1b80000,
+    0x1400012, 0x57645, 0x2900000, 0xf80012, 0x148000a, 0x5760e, 0x5754e, 0xf8000e,
+    0x1b80000, 0x1b80000, 0x1f8000f, 0x1b80000, 0x1b80000, 0x1b80000, 0x1b80000, 0x1b80000,
+    0x1500000, 0x578d3, 0x5768f, 0x57a13, 0x1b80013, 0x980000, 0x980000, 0x57a93,
+    0x579c1, 0x57b13, 0x57b93, 0x56fd3, 0x980000, 0x57c13, 0x700000, 0x576ce,
+    0x700005, 0x57ac9, 0x700005, 0x57cc9, 0x57901, 0x57c53, 0x57a52, 0x2980000,
+    0x57bc9, 0x58085, 0x57f81, 0x580c5, 0x57d53, 0x57e0c, 0x57fc5, 0x180000,
+    0x5795d, 0x57e87, 0x2f80012, 0x57d8c, 0x2000012, 0x57b5d, 0x1f80000, 0x980000,
+    0x5800f, 0x980000, 0x3000015, 0x57c93, 0x980000, 0x58305, 0x3080012, 0x583d4,
+    0x1e80012, 0x1e80001, 0x584c5, 0x2000005, 0x1e80005, 0x3100001, 0x5810d, 0x3100001,
+    0x2c00000, 0x3100005, 0x58145, 0x2c00000, 0x58293, 0x1d80012, 0x2d00004, 0x582d3,
+    0x57e49, 0x57ec3, 0x2d00010, 0x2e00010, 0x2e80001, 0x2d0000c, 0x2e80015, 0x2e80005,
+    0x58189, 0x2d00005, 0x100000e, 0x2e80009, 0x2e80001, 0x58605, 0x2200000, 0x310001b,
+    0x2e80005, 0x581d4, 0x2e8000f, 0x58253, 0x58049, 0x1000014, 0x180000, 0x180000,
+    0x180000, 0x180000, 0x2ed820f, 0x180000, 0x180000, 0x180000, 0x2e8001b, 0x2e8001d,
+    0x180000, 0x2200000, 0x180000, 0x180000, 0x180000, 0x180000, 0x2e8001b, 0x2e8001c,
+    0x180000, 0x180000, 0x2e8001f, 0x586d3, 0x58713, 0x587c1, 0x58793, 0x58881,
+    0x58985, 0x58805, 0x58a01, 0x588c5, 0x58ac5, 0x5850f, 0x58a45, 0x1380000,
+    0x1380000, 0x5864f, 0x1380000, 0x5884f, 0x1380000, 0x5890f, 0x1380000, 0x1380000,
+    0x58a8f, 0x180000, 0x180000, 0x180000, 0x1380000, 0x1380000, 0x1380000, 0x1380000,
+    0x1380000, 0x1380000, 0x2200000, 0x180000, 0x180000, 0x180000, 0x180000, 0x58b53,
+    0x180000, 0x58b93, 0x58bd3, 0x980000, 0x980000, 0x180000, 0x180000, 0x180000,
+    0x2200000, 0x180000, 0x180000, 0x2200000, 0x180000, 0x180000, 0x180000, 0x180000,
+    0x58c13, 0x58c53, 0x180000, 0x58e13, 0x980000, 0x980000, 0x980000, 0x180000,
+    0x180000, 0x180000, 0x2200000, 0x180000, 0x180000, 0x180000, 0x180000, 0x0,
+    0x0, 0x58e53, 0x58e93, 0x3180013, 0x2d80005, 0x58f93, 0x800004, 0x800014,
+    0x1000002, 0x3200001, 0x800009, 0x80001a, 0x3280007, 0x3200005, 0x1880003, 0x0,
+    0x800003, 0x58c8d, 0x58ed2, 0x0, 0x58f10, 0x3300009, 0x800013, 0x320000f,
+    0x58cce, 0x1000005, 0x700004, 0x1880012, 0x1400004, 0x3380001, 0x1000009, 0x100000e,
+    0x1d0000e, 0x100001a, 0x1000014, 0x320001b, 0x320001c, 0x1000012, 0x100000d, 0x320001f,
+    0x100000d, 0x80001a, 0x80001a, 0x80000e, 0x80000e, 0x58d0e, 0x2a80014, 0x1400008,
+    0x59045, 0x589c9, 0x1400012, 0x58d49, 0x1400012, 0x1000014, 0x1400009, 0x1400009,
+    0x58d95, 0x1400014, 0x1400014, 0x1400012, 0x140000c, 0x1000002, 0x140001a, 0x140000c,
+    0x1400003, 0x1400012, 0x1400003, 0x1400012, 0x58fcc, 0x590c9, 0x1400004, 0x1400009,
+    0x1400014, 0x591c5, 0x1400007, 0x1400004, 0x140000c, 0x100000c, 0x59015, 0x1400004,
+    0x1400003, 0x1400007, 0x1400003, 0x1400007, 0x148000e, 0x5914c, 0x0, 0x1400007,
+    0x1400013, 0x592c5, 0x1400012, 0x140000a, 0x58b05, 0x140000a, 0x5918c, 0x1b80000,
+    0x1400004, 0x59541, 0x59256, 0x59395, 0x593c3, 0x140000e, 0x59296, 0x1400012,
+    0x1400012, 0x140000c, 0x140000c, 0x1400012, 0x1400012, 0x1480004, 0x1400016, 0x1480014,
+    0x5931c, 0x148000e, 0x148000e, 0x140000e, 0x59209, 0x1400012, 0x1400012, 0x140000d,
+    0x59456, 0x1400013, 0x140000e, 0x1400014, 0x140000e, 0x1400010, 0x140000d, 0x140000c,
+    0x1400003, 0x1400009, 0x59353, 0x1b80000, 0x1400014, 0xf8000e, 0xf80012, 0x5940e,
+    0x1b80000, 0x1400014, 0x1500000, 0x59744, 0x1b80000, 0x596d3, 0x1b80000, 0x595d4,
+    0x1b80000, 0x1b80000, 0x3400009, 0x5964e, 0x3480001, 0x2980000, 0x3500012, 0x59801,
+    0x5958d, 0x59ac1, 0x5970d, 0x59985, 0x5960d, 0x59b45, 0x2980000, 0x2980000,
+    0x2980000, 0x599cc, 0x2980000, 0x2980000, 0x1000009, 0x59a4f, 0x3580014, 0x59b8f,
+    0x598ce, 0x59b05, 0x980000, 0x980000, 0xd00000, 0x59f54, 0x59ccc, 0x59d8c,
+    0x1e80001, 0x59bd3, 0x59c13, 0x59c53, 0x1e80001, 0x59e0f, 0x100000f, 0x2e80016,
+    0x59d53, 0x1000001, 0x59e92, 0x180000, 0x180000, 0x1000014, 0x180000, 0x180000,
+    0x180000, 0x180000, 0x180000, 0x180000, 0x180000, 0x59e5f, 0x180000, 0x5a313,
+    0x180000, 0x180000, 0x180000, 0x180000, 0x5a453, 0x1380000, 0x1380000, 0x1380000,
+    0x180000, 0x180000, 0x59fd3, 0x5a113, 0x5a213, 0x5a253, 0x5a293, 0x5a2d3,
+    0x180000, 0x180000, 0x180000, 0x5a353, 0x5a393, 0x5a3d3, 0x180000, 0x3280003,
+    0x5a005, 0x100001a, 0x3280010, 0x140000d, 0x1400003, 0x1400002, 0x140001a, 0x1300014,
+    0x1d00014, 0x1400014, 0x5a403, 0x140000c, 0x140000c, 0x130001a, 0x1400005, 0x1400005,
+    0x3280014, 0x140000c, 0x140000c, 0x59f85, 0x140000c, 0x140000a, 0x140000a, 0x1400008,
+    0x1480003, 0x5a08e, 0x5a1c9, 0x1b80000, 0x5a685, 0x980000, 0x3480005, 0x3480009,
+    0x2980000, 0x1400014, 0x5a185, 0x5a0ce, 0x5a494, 0x3480009, 0x2980000, 0x348000f,
+    0x5a6c1, 0x2980000, 0x5a05c, 0x2980000, 0x5a705, 0x2980000, 0x2980000, 0x2980000,
+    0x2980000, 0x2980000, 0x360000f, 0x5a7d3, 0x5a941, 0x2c00000, 0x5a78f, 0x5aa01,
+    0x5a985, 0x5a813, 0x5a5ce, 0x5aa45, 0x5a853, 0x3480000, 0x5a893, 0x180000,
+    0x5a8d3, 0x5a913, 0x5a9cf, 0x2e80009, 0x180000, 0x5aa8f, 0x2e8000e, 0x2e8000e,
+    0x180000, 0x180000, 0x180000, 0x180000, 0x180000, 0x180000, 0x180000, 0x180000,
+    0x5ab13, 0x180000, 0x1400014, 0x5abd3, 0x148000d, 0x1400014, 0x1400014, 0x5ab45,
+    0x1400008, 0x5ac93, 0x980000, 0x2980000, 0x2980000, 0x140001a, 0x2980000, 0x2980000,
+    0x2980000, 0x2980000, 0x2980000, 0x2980000, 0x2980000, 0x3680000, 0x2980000, 0x2980000,
+    0x3680000, 0x2980000, 0x2980000, 0x5b114, 0x3480000, 0x2900000, 0x5acd3, 0x5ad53,
+    0x3700001, 0x5ad93, 0x980000, 0x2980000, 0x3700005, 0x2980000, 0x2980000, 0x3680000,
+    0x5add3, 0x5afd3, 0x5b013, 0x5b053, 0x5b093, 0x5b0d3, 0x370000f, 0x2980000,
+    0x2980000, 0x3680000, 0x2980000, 0x2980000, 0x0, 0x980000, 0x0, 0x0,
+    0x0, 0x5b145, 0x370001b, 0x370001c, 0x0, 0x0, 0x370001f, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+static const uint8_t HYPH_ES_VALUES[] = {
+    0, 0, 1, 1, 2, 1, 2, 0, 1, 4, 0, 2, 2, 1, 0, 1, 2, 1, 1, 2, 1, 1, 4, 0,
+    2, 2, 2, 1, 3, 1, 0, 2, 0, 3, 2, 3, 2, 0, 3, 2, 0, 2, 2, 2, 1, 2, 3, 1,
+    2, 0, 1, 3, 3, 2, 2, 2, 3, 1, 3, 3, 2, 3, 4, 2, 3, 2, 2, 2, 0, 2, 4, 3,
+    1, 1, 3, 3, 2, 3, 2, 4, 1, 2, 3, 2, 1, 2, 3, 1, 1, 0, 5, 4, 0, 0, 0, 4,
+    0, 2, 2, 3, 0, 2, 4, 4, 2, 2, 4, 3, 0, 2, 3, 2, 2, 1, 5, 2, 2, 3, 4, 4,
+    1, 3, 4, 1, 5, 3, 3, 2, 0, 2, 4, 2, 1, 2, 4, 2, 2, 2, 3, 3, 2, 2, 2, 4,
+    1, 1, 0, 3, 4, 4, 3, 2, 2, 2, 3, 2, 1, 3, 1, 2, 5, 4, 0, 2, 4, 2, 0, 3,
+    4, 2, 3, 3, 2, 4, 5, 3, 1, 6, 5, 2, 1, 2, 5, 1, 1, 5, 1, 3, 3, 1, 4, 4,
+    3, 2, 2, 2, 4, 3, 2, 0, 2, 6, 1, 2, 5, 1, 6, 1, 3, 5, 4, 3, 6, 1, 4, 4,
+    3, 2, 1, 2, 4, 2, 2, 3, 5, 1, 4, 0, 1, 5, 4, 1, 4, 0, 6, 4, 3, 0, 3, 0,
+    3, 1, 2, 4, 3, 4, 2, 4, 5, 4, 2, 4, 3, 0, 7, 2, 0, 0, 0, 0, 1, 2, 0, 6,
+    2, 0, 0, 0, 0, 1, 0, 3, 4, 0, 3, 3, 2, 4, 3, 7, 1, 2, 6, 1, 1, 5, 2, 2,
+    3, 5, 3, 2, 1, 2, 3, 3, 4, 3, 4, 3, 3, 2, 1, 2, 3, 2, 2, 1, 4, 3, 3, 2,
+    3, 6, 2, 1, 2, 1, 4, 4, 0, 0, 3, 2, 4, 2, 3, 0, 4, 2, 3, 3, 0, 3, 0, 4,
+    4, 3, 4, 3, 0, 4, 4, 3, 0, 3, 4, 4, 4, 4, 4, 4, 5, 2, 4, 3, 2, 2, 5, 4,
+    2, 3, 3, 4, 3, 1, 3, 3, 0, 3, 4, 3, 3, 4, 4, 4, 2, 2, 1, 4, 3, 4, 3, 4,
+    3, 2, 4, 1, 4, 3, 3, 0, 3, 2, 3, 2, 3, 4, 4, 5, 3, 4, 0, 0, 4, 0, 6, 4,
+    4, 0, 4, 5, 4, 6, 2, 5, 6, 2, 4, 3, 0, 0, 3, 6, 1, 3, 3, 5, 3, 0, 0, 2,
+    3, 3, 4, 3, 0, 3, 4, 3, 3, 4, 1, 4, 5, 1, 5, 7, 1, 3, 4, 3, 3, 4, 3, 4,
+    2, 3, 4, 5, 4, 5, 0, 0, 5, 4, 2, 5, 4, 0, 7, 4, 3, 0, 3, 0, 0, 3, 3, 8,
+    3, 4, 0, 3, 0, 0, 2, 3,
+};
+static const uint16_t HYPH_ES_VALUE_OFFSETS[] = {
+    0, 1, 4, 7, 10, 14, 17, 20, 23, 27, 32, 37, 42, 46, 49, 52,
+    56, 59, 63, 68, 72, 75, 79, 82, 86, 89, 96, 100, 104, 108, 112, 115,
+    119, 122, 125, 130, 134, 138, 143, 146, 151, 155, 158, 162, 166, 171, 175, 178,
+    182, 185, 188, 191, 196, 201, 204, 207, 212, 215, 220, 224, 227, 230, 233, 241,
+    245, 249, 253, 262, 270, 275, 279, 282, 285, 289, 294, 299, 304, 308, 313, 317,
+    323, 329, 334, 340, 346, 352, 356, 360, 365, 370, 375, 379, 384, 388, 393, 398,
+    405, 413, 417, 423, 426, 433, 439, 444, 447, 450, 455, 459, 465, 469, 478,
+};
+
+// fr: 1208 patterns, 0 exceptions
+//
+// Copyright (C) 1994-2002 Daniel Flipo, Bernard Gaulle.
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+// BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+// ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+// CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+static const uint16_t HYPH_FR_ALPHABET[] = {
+    0x27, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0xe0, 0xe2, 0xe7, 0xe8, 0xe9, 0xea, 0xee, 0xef, 0xf4,
+    0xfb, 0x153, 0x2019,
+};
+static const uint32_t HYPH_FR_TRIE[] = {
+    0x980, 0x411c1, 0x1a82, 0x1f43, 0x2844, 0x31c5, 0xfc6, 0x3ac7,
+    0x4308, 0x4b49, 0x518a, 0x8128b, 0x558c, 0x5dcd, 0x660e, 0x6e4f,
+    0x7750, 0x7c51, 0x80192, 0x8553, 0x8e54, 0x9795, 0x2096, 0x9fd7,
+    0x2898, 0x6d9, 0x91a, 0xa81b, 0x8a96, 0x51d, 0x8001e, 0x55f,
+    0xaaa0, 0x9686, 0xa20e, 0xab8e, 0x7e4, 0x9f8a, 0xa782, 0x4af27,
+    0xcb702, 0x1483, 0x1b04, 0x2585, 0xc0b86, 0xb80e, 0xa48, 0xcfc6,
+    0xc144a, 0x200009, 0xa0c, 0xf0d, 0x380e, 0xbcf, 0xc1310, 0xbb11,
+    0xa714, 0x1913, 0xbd14, 0x2c55, 0xc0016, 0xdb4f, 0xce42, 0xd590,
+    0xc001a, 0xe84e, 0x240009, 0xc001d, 0xcc56, 0xc001f, 0xc0ce0, 0xc0021,
+    0xc0022, 0xcc142, 0xc0024, 0xc0025, 0x5ec2, 0xc13c6, 0x440f, 0xef4f,
+    0x6406, 0xc1aca, 0x3e13, 0x4814, 0xbf02, 0x3d56, 0x18000c, 0xc2f10,
+    0x4099, 0xd108, 0xf182, 0xdd8f, 0xd80a, 0xc0016, 0xed0f, 0xf54a,
+    0xde4f, 0xc001a, 0xdbd6, 0xdad7, 0xc001d, 0xe9d6, 0xc001f, 0xc0020,
+    0xc0021, 0xc0022, 0xe186, 0xc0024, 0xc0025, 0x2d83, 0x25c4, 0xe45,
+    0xf10e, 0xf64e, 0x1008, 0xebc8, 0x188a, 0x20bc89, 0xbf8a, 0x228d,
+    0x160e, 0x3b4f, 0xeecf, 0x2111, 0xda50, 0x2053, 0x3014, 0x80002,
+    0x18d6, 0x1557, 0xc696, 0x833c6, 0xe720, 0xf404, 0x8804, 0x8000a,
+    0x8346, 0x219f, 0x10230d, 0xf385, 0xf142, 0x82650, 0xf1c4, 0xf50e,
+    0x103653, 0x89cf, 0xf946, 0x80016, 0xf210, 0xf311, 0x8794, 0x8001a,
+    0xc702, 0x91d7, 0x8001d, 0xf0c4, 0x8001f, 0x80020, 0x80021, 0x80022,
+    0xda0a, 0x80024, 0x80025, 0x83a42, 0x89b42, 0x2bc4, 0xc850, 0x84106,
+    0x89e46, 0xed92, 0x10c5c9, 0x82c0a, 0x8000a, 0x10cb4c, 0x10368d, 0xf616,
+    0xc75a, 0x85710, 0x80010, 0xe742, 0x103413, 0x100013, 0xdc20, 0x82a56,
+    0x80016, 0xf98a, 0x200009, 0x8319a, 0xfdd3, 0xf90d, 0x8001d, 0x240009,
+    0x8001f, 0x80020, 0x80021, 0x80022, 0xe7d3, 0x80024, 0x80025, 0x80026,
+    0x80001, 0x835c2, 0xf054, 0xedcf, 0x3d05, 0x84506, 0xf5ce, 0x280000,
+    0x4049, 0x8494a, 0xef96, 0xef17, 0x3b0d, 0xf355, 0x10506, 0x80010,
+    0xeea2, 0xfd93, 0x103b93, 0x140014, 0xfc02, 0x80016, 0xf3cf, 0xf9c6,
+    0xfe86, 0x8001a, 0xdf42, 0xf8d4, 0x8001d, 0x1008e, 0x8001f, 0x83ca0,
+    0x80021, 0x80022, 0xd34a, 0x80024, 0x80025, 0x843c2, 0x80027, 0xf696,
+    0xd410, 0x84f06, 0x103c6, 0xf006, 0x10886, 0x84c8a, 0x108c4, 0xf28a,
+    0x104e0d, 0xf4d0, 0xf811, 0x80010, 0xf453, 0x140009, 0x104b93, 0x140014,
+    0xdfa0, 0x844d6, 0xf2d5, 0x10002, 0x280000, 0x8001a, 0x1084e, 0x104d5,
+    0x8001d, 0x10694, 0x8001f, 0x846a0, 0x80021, 0x80022, 0x80002, 0x80024,
+    0x80025, 0x10110, 0x85646, 0xf6cf, 0x280000, 0x7cc9, 0x8474a, 0x10755,
+    0xfb14, 0x104d4d, 0x1034a, 0x104e4f, 0x80010, 0x10b0e, 0x10a04, 0x104f93,
+    0x140014, 0x10dce, 0x84ed6, 0x1004f, 0x10944, 0x10595, 0x8001a, 0x10302,
+    0x102d4, 0x8001d, 0x10ccd, 0x8001f, 0x80020, 0x80021, 0x80022, 0x80002,
+    0x80024, 0x80025, 0x1044d, 0x85b86, 0x10ec6, 0x10815, 0x10b84, 0x8528a,
+    0x109ca, 0x10614, 0x10ac2, 0x11046, 0x280000, 0x80010, 0x10e86, 0x110c6,
+    0x10d82, 0x112c6, 0x1108e, 0x84d16, 0x111c6, 0x10a93, 0x11293, 0x8541a,
+    0x5cc2, 0x4cc3, 0x8001d, 0x1078f, 0x8001f, 0x85360, 0x80021, 0x80022,
+    0x10d14, 0x80024, 0x80025, 0x568d, 0x58ce, 0x670f, 0x5c10, 0x1100d,
+    0x80002, 0x280000, 0x5e94, 0x1138e, 0x86cc6, 0x5857, 0xffc2, 0x106209,
+    0x8000a, 0x11351, 0x10206, 0x11942, 0xfb48, 0x5f9f, 0x80010, 0x24000d,
+    0x10b4f, 0x100013, 0xf88e, 0x1028f, 0x80016, 0x10fd4, 0x280000, 0xfd53,
+    0x8001a, 0x115ce, 0x118c2, 0x8001d, 0x11311, 0x8001f, 0x80020, 0x80021,
+    0x80022, 0x85c82, 0x80024, 0x80025, 0x300020, 0x86d86, 0x11a04, 0x11b44,
+    0x1110d, 0x85fca, 0x11194, 0x11745, 0x64cd, 0x630e, 0x10f13, 0x80010,
+    0x280000, 0x11459, 0x11998, 0x5e54, 0x11b8d, 0x80016, 0x140015, 0x11a95,
+    0x280000, 0x8001a, 0x11c46, 0x8001c, 0x8001d, 0x11d84, 0x8001f, 0x80020,
+    0x80021, 0x80022, 0x80002, 0x80024, 0x80025, 0x11bca, 0x86b46, 0x117cf,
+    0x11584, 0x11645, 0x871ca, 0x11507, 0x11d54, 0x11c1f, 0x11e60, 0x618f,
+    0x86c50, 0x11b16, 0x1200f, 0x1154f, 0x140014, 0x280000, 0x866d6, 0x11f95,
+    0x11614, 0x11815, 0x8001a, 0x280000, 0x11ec2, 0x8001d, 0x280000, 0x8001f,
+    0x86460, 0x80021, 0x80022, 0x80002, 0x80024, 0x80025, 0x80026, 0x88246,
+    0x11ccf, 0x11f54, 0x1184f, 0x8000a, 0x1208d, 0x119cf, 0x122d6, 0x11dd4,
+    0x12190, 0x80010, 0x11e14, 0x11fda, 0x14000d, 0x6c94, 0x1240e, 0x86696,
+    0x12155, 0x120cf, 0x1c0019, 0x8001a, 0x11d0d, 0x11f0e, 0x8001d, 0x1261a,
+    0x8001f, 0x80020, 0x80021, 0x80022, 0x11a55, 0x80024, 0x80025, 0x80026,
+    0x6dc3, 0x6ec4, 0x6fc5, 0x125d5, 0x12305, 0x7088, 0x1210d, 0x6e0a,
+    0x12853, 0x12642, 0x12451, 0x864e, 0x12d1a, 0x12fca, 0x6c11, 0x12b06,
+    0x7013, 0x7394, 0x126c6, 0x87642, 0x11c8d, 0x100002, 0x6f59, 0x88686,
+    0x1330a, 0x100006, 0x108e09, 0x8754a, 0x77df, 0x10000a, 0x107a4d, 0x12896,
+    0x7b0f, 0x879d0, 0x1354d, 0x100010, 0x109993, 0x7494, 0x8055, 0x89656,
+    0x13fc9, 0x280000, 0x14000d, 0x8001a, 0x100020, 0x10001a, 0x8001d, 0x134d5,
+    0x8001f, 0x884e0, 0x80021, 0x80022, 0x1410d, 0x80024, 0x80025, 0x89842,
+    0x11e8f, 0x78c4, 0x280000, 0x8a1c6, 0x12043, 0x12254, 0x108d89, 0x88c8a,
+    0x128df, 0x129e0, 0x12b4f, 0x7b8e, 0x14897, 0x80010, 0x12a53, 0x1220e,
+    0x1228f, 0x121cf, 0x1464a, 0x87d56, 0x12d82, 0x12513, 0x12794, 0x87e9a,
+    0x12f86, 0x1474a, 0x8001d, 0x143d5, 0x8001f, 0x89f20, 0x80021, 0x80022,
+    0x280000, 0x80024, 0x80025, 0x80002, 0x13506, 0xa284, 0x12806, 0x8ad46,
+    0x1348e, 0x1338f, 0x10b049, 0x8000a, 0x13802, 0x25274d, 0x908d, 0x18000f,
+    0x124d0, 0x80010, 0xa8d1, 0x2527d3, 0x180014, 0x192915, 0xcd55, 0x8bc16,
+    0x1341a, 0x1484a, 0x13750, 0x8001a, 0x14cc6, 0x1430d, 0x8001d, 0x1438e,
+    0x8001f, 0x80020, 0x80021, 0x80022, 0x141d3, 0x80024, 0x80025, 0x80026,
+    0x8a642, 0x12b88, 0x7fc4, 0x280000, 0x8ce06, 0x1490d, 0x12f45, 0x10d0c9,
+    0x8000a, 0x14acf, 0x12d51, 0x12f0a, 0x12c86, 0x12e14, 0x89250, 0x1314e,
+    0x1270a, 0x10d493, 0x149cf, 0x7f55, 0x8b656, 0x14a88, 0x12950, 0x14814,
+    0x8001a, 0x280000, 0x8001c, 0x8001d, 0x12c16, 0x8001f, 0x881e0, 0x80021,
+    0x80022, 0x8b242, 0x80024, 0x80025, 0x135c8, 0x898c6, 0x12a20, 0x280000,
+    0x148cf, 0x8b18a, 0x1360e, 0x14b4d, 0x13342, 0x14d54, 0x14c06, 0x89210,
+    0x13054, 0x13595, 0x109393, 0x1137c9, 0x1324d, 0x80016, 0x12e4f, 0x1308d,
+    0x13291, 0x8001a, 0x13690, 0x13454, 0x8001d, 0x140c4, 0x8001f, 0x89620,
+    0x80021, 0x80022, 0x80002, 0x80024, 0x80025, 0x13702, 0x8c3c6, 0x1414e,
+    0x1418f, 0x138c6, 0x8000a, 0x146cd, 0x13889, 0x13a0a, 0xb104, 0xcdc5,
+    0x80010, 0x14b95, 0x14b14, 0x13950, 0x14d06, 0x280000, 0x80016, 0xd4cd,
+    0xaece, 0xb7cf, 0x8001a, 0xb351, 0xae92, 0xb753, 0xcd602, 0x8001f,
+    0x80020, 0x280000, 0xcc186, 0x1364e, 0x133cf, 0x1500a, 0xcc4ca, 0x13846,
+    0x13793, 0x139d4, 0x14d86, 0x14a05, 0xcc8d0, 0x14944, 0x14e0a, 0x18000e,
+    0x15256, 0x136d0, 0xc0016, 0x14a4d, 0x180013, 0x180014, 0xc001a, 0x1510a,
+    0x1498f, 0xc001d, 0x14e96, 0xc001f, 0xc0020, 0xc0021, 0xc0022, 0xb783,
+    0xc0024, 0xc0025, 0xb8c6, 0x150c6, 0xbd88, 0x15046, 0x15186, 0x1460e,
+    0x1450f, 0x1508a, 0xbc4e, 0xc9cf, 0x14693, 0xbdd1, 0xe082, 0xd713,
+    0xbed4, 0x152d3, 0xde06, 0x13d83, 0x14044, 0x20e009, 0xe302, 0x15a14,
+    0xe5c4, 0xdc8d, 0xe386, 0x1584a, 0xe1d0, 0x200009, 0x1400e, 0xdf13,
+    0xde94, 0x14091, 0xe4d6, 0x13c13, 0xe350, 0x15acf, 0x15a4a, 0x15890,
+    0xe6c3, 0xe8d5, 0xe916, 0xe806, 0xe2a0, 0xe988, 0xe65a, 0x280000,
+    0x15dd5, 0x15a9f, 0x15f14, 0xe94e, 0xeb8f, 0x1550f, 0xea11, 0x280000,
+    0xec53, 0xe794, 0x180003, 0x15448, 0x153d6, 0xfb86, 0x14bcf, 0x180008,
+    0x15d44, 0xfa4a, 0x157cf, 0x14dd4, 0x24fbcd, 0x18000e, 0x18000f, 0x38000d,
+    0x180011, 0x15682, 0x24fc53, 0x180014, 0x180015, 0x280000, 0x1600d, 0x180018,
+    0x180003, 0x3d61d4, 0x1578f, 0xfe06, 0x180007, 0x180008, 0x2c0009, 0x13ac2,
+    0x280000, 0x15996, 0x15817, 0x13c86, 0x159d5, 0x14ec6, 0x180011, 0x1390a,
+    0x14c49, 0x180014, 0x180015, 0x280000, 0x16213, 0x13e50, 0x13f0e, 0x13e8f,
+    0x13b93, 0x14546, 0x14fd3, 0x14253, 0x14494, 0x1614e, 0x16715, 0x13cda,
+    0x18000d, 0x18000e, 0x18000f, 0x162cf, 0x14282, 0x13b20, 0x254353, 0x180014,
+    0x14586, 0x14e46, 0x1634d, 0x151c3, 0x144ca, 0x14f4a, 0x15146, 0x16a4f,
+    0x15308, 0x15b05, 0x15d82, 0x14f10, 0x15c48, 0x16bcf, 0x1548e, 0x1538f,
+    0x145d6, 0x15351, 0x16042, 0x15593, 0x15294, 0x15c91, 0x15e06, 0x340002,
+    0x15e50, 0x16c42, 0x340002, 0x14fa0, 0x15e94, 0x16cca, 0x340016, 0x15d0e,
+    0x395bcf, 0x355cd0, 0x15f4a, 0x356282, 0x15214, 0x340010, 0x16b48, 0x356506,
+    0x340010, 0x16a84, 0x16ec2, 0x35668a, 0x416394, 0x166c8, 0x16ac8, 0x16d4f,
+    0x16f96, 0x356890, 0x16d8d, 0x217253, 0x17310, 0x16314, 0x16595, 0x356996,
+    0x16413, 0x1708f, 0x16e14, 0x16c15, 0x174da, 0x171d3, 0x1700f, 0x16fd5,
+    0x17545, 0x356a20, 0x357894, 0x17054, 0x176e0, 0x17393, 0x357442, 0x17813,
+    0x380009, 0x17913, 0x3575c6, 0x17796, 0x178d6, 0x17c02, 0x35750a, 0x17e03,
+    0x17d4f, 0x17f0a, 0x17e4d, 0x1764a, 0x340010, 0x17b0a, 0x17853, 0x17f8a,
+    0x17d02, 0x17415, 0x457216, 0x183d5, 0x18094, 0x1814f, 0x340002, 0x17e93,
+    0x17dd0, 0x18248, 0x18413, 0x1769f, 0x340020, 0x3581c2, 0x182cf, 0x17f48,
+    0x18702, 0x358346, 0x18291, 0x17fd5, 0x340010, 0x3584ca, 0x1838a, 0x18506,
+    0x189ce, 0x187c6, 0x18846, 0x358550, 0x18956, 0x18750, 0x18a02, 0x18194,
+    0x18455, 0x358496, 0x18a8d, 0x18b0d, 0x18894, 0x18c4a, 0x18815, 0x188d0,
+    0x18bce, 0x18c09, 0x18b46, 0x3586a0, 0x18914, 0x18b86, 0x18a4a, 0x18d06,
+    0x18c93, 0x18e13, 0x18ccd, 0x280000, 0x18fd5, 0x280000, 0x18f8e, 0x280000,
+    0x1908e, 0x18dd6, 0x18e8a, 0x190c5, 0x280000, 0x18ed5, 0x280000, 0x19106,
+    0x19355, 0x48000d, 0x19021, 0x18f51, 0x18d4f, 0x19406, 0x18d8f, 0x19506,
+    0x280000, 0x19054, 0x280000, 0x19194, 0x1948f, 0x18f0f, 0x1944e, 0x19150,
+    0x1974a, 0x191d0, 0x193d4, 0x195c4, 0x300005, 0x19217, 0x19551, 0x1924f,
+    0x192c6, 0x1928f, 0x19853, 0x280000, 0x19594, 0x50000d, 0x19654, 0x4c0007,
+    0x4c0011, 0x19607, 0x4c0013, 0x19314, 0x280000, 0x4c0016, 0x19b15, 0x4c000f,
+    0x4c0019, 0x196cf, 0x19a16, 0x19a4a, 0x19804, 0x19951, 0x1978f, 0x19715,
+    0x19396, 0x4c0019, 0x280000, 0x1968f, 0x19997, 0x19c42, 0x19b93, 0x19b46,
+    0x198d4, 0x19d13, 0x19d4a, 0x19bc6, 0x19a94, 0x19ad5, 0x540009, 0x19e55,
+    0x19ed3, 0x1988f, 0x19cc6, 0x19fd5, 0x280000, 0x19c10, 0x19c94, 0x19d89,
+    0x19e8e, 0x19dce, 0x280000, 0x280000, 0x19f55, 0x1a006, 0x19f96, 0x280000,
+    0x48000d, 0x280000, 0x1a215, 0x280000, 0x1a14e, 0x1a2cf, 0x280000, 0x280000,
+    0x1a306, 0x19e0f, 0x19f0f, 0x280000, 0x1a508, 0x48000d, 0x1a114, 0x1a194,
+    0x1a04f, 0x1a455, 0x1a08f, 0x1a346, 0x1a54a, 0x1a254, 0x1a0cf, 0x1a294,
+    0x1a3ca, 0x1a582, 0x1a1cf, 0x1a394, 0x1a610, 0x1a4d0, 0x1a410, 0x1a494,
+    0x1a7ca, 0x1a5ca, 0x1a696, 0x1a80a, 0x1a650, 0x1ab10, 0x1a9c6, 0x1a8c4,
+    0x1a910, 0x1a750, 0x1aa4a, 0x1c001a, 0x1a942, 0x1aa15, 0x1a986, 0x1a856,
+    0x1ad53, 0x1abc9, 0x1ac0d, 0x1ab46, 0x1af55, 0x280000, 0x1af95, 0x280000,
+    0x280000, 0x1ae53, 0x1af0e, 0x48000d, 0x1b015, 0x280000, 0x1b055, 0x1ac90,
+    0x1ab8f, 0x49afcd, 0x1adc6, 0x1ac50, 0x100014, 0x1aec6, 0x1b0d0, 0x1ad0e,
+    0x1ad95, 0x280000, 0x1b10a, 0x1b1c6, 0x1be1a, 0x1b094, 0x1b286, 0x1b355,
+    0x1b395, 0x1b193, 0x1b150, 0x1b250, 0x1b3ca, 0x1b2cf, 0x1b486, 0x1b316,
+    0x1b40d, 0x1b442, 0x340002, 0x1b70a, 0x1b4d5, 0x480009, 0x280000, 0x1b513,
+    0x280000, 0x1b58a, 0x1b74e, 0x1b786, 0x1b6a0, 0x1bb46, 0x1b902, 0x1b650,
+    0x1b7d5, 0x1b855, 0x1b993, 0x1ba0a, 0x280000, 0x1b8d4, 0x1b80a, 0x1b5cf,
+    0x1bc0e, 0x100016, 0x280000, 0x1bdd7, 0x1b614, 0x1bd45, 0x100013, 0x1b220,
+    0x1bf04, 0x1ba94, 0x100013, 0x1b88f, 0x1be94, 0x1c04f, 0x280000, 0x1be4a,
+    0x1bb94, 0x1b9cf, 0x1bf4a, 0x1bf96, 0x1c0ce, 0x1bbe0, 0x1bcd4, 0x1c08a,
+    0x1bda0, 0x1bee0, 0x1c2ce, 0x1c106, 0x1c1cd, 0x1bc8f, 0x1c655, 0x1c186,
+    0x1c306, 0x280000, 0x1c414, 0x1c20a, 0x280000, 0x1c285, 0x1c6c8, 0x1c4d6,
+    0x1c3c6, 0x1c48d, 0x1c582, 0x1c446, 0x1c509, 0x1c546, 0x1c791, 0x280000,
+    0x1c7ca, 0x280000, 0x1c5e0, 0x1c70a, 0x1cad5, 0x1ca06, 0x1c988, 0x280000,
+    0x1c694, 0x58000e, 0x1c256, 0x100011, 0x1cc08, 0x1c80d, 0x1ca86, 0x1c9d1,
+    0x1c74f, 0x1ca55, 0x1cec2, 0x180014, 0x100017, 0x1cbd4, 0x1c8d3, 0x100017,
+    0x11c913, 0x1c612, 0x1cc4f, 0x1cb53, 0x1cb0a, 0x1ccc4, 0x1cd10, 0x1cb93,
+    0x1ce8d, 0x1c85f, 0x1c8a0, 0x1cdcd, 0x1cd56, 0x1cd84, 0x1ce06, 0x1cc8e,
+    0x1c946, 0x1d00a, 0x340014, 0x1cf86, 0x1ce49, 0x1cfd1, 0x1cf48, 0x1d195,
+    0x1cf20, 0x1d088, 0x280000, 0x1d406, 0x1d206, 0x280000, 0x280000, 0x1d14a,
+    0x1d4c5, 0x1d10f, 0x1d3d3, 0x1d284, 0x1d348, 0x1d443, 0x1d306, 0x1d482,
+    0x280000, 0x1d9d5, 0x540013, 0x1db48, 0x1d720, 0x1d24f, 0x1d60d, 0x1d1d5,
+    0x1d0d3, 0x1d2d4, 0x1d594, 0x1d056, 0x1d6ca, 0x1d5d0, 0x1d74d, 0x1d80a,
+    0x1d88a, 0x1d38a, 0x1d90a, 0x280000, 0x1d850, 0x280000, 0x48000d, 0x280000,
+    0x1dc55, 0x5c000f, 0x48000d, 0x24000a, 0x1d8d5, 0x1db84, 0x1da90, 0x1d94f,
+    0x1dd15, 0x1d515, 0x1d78f, 0x1d98f, 0x1de55, 0x1da0f, 0x1dd8e, 0x1d694,
+    0x1de0e, 0x1deca, 0x1dacf, 0x1df0e, 0x1df8e, 0x1de8d, 0x1da52, 0x1dfc6,
+    0x1e0c2, 0x3c0009, 0x1dd4f, 0x1e04a, 0x1df53, 0x1ddcf, 0x340002, 0x1e015,
+    0x1e114, 0x1e154, 0x1dbd3, 0x1e24f, 0x1e08a, 0x1e1d0, 0x1e348, 0x1e4d5,
+    0x1e3cf, 0x35e2c2, 0x1e513, 0x1e195, 0x340010, 0x35e546, 0x1e448, 0x1e391,
+    0x1e802, 0x35e40a, 0x1e74a, 0x1e860, 0x1ea44, 0x1e882, 0x1e914, 0x35e6d0,
+    0x1e8cf, 0x1ec8a, 0x1e986, 0x1e214, 0x1e695, 0x35e7d6, 0x1e954, 0x1e9c6,
+    0x1eb06, 0x400002, 0x340004, 0x640002, 0x680002, 0x1ed94, 0x1e5c2, 0x35e7a0,
+    0x1ed4d, 0x1ea97, 0x1ee0e, 0x6c0014, 0x1eb55, 0x1edc4, 0x1eec6, 0x34000f,
+    0x1ea13, 0x680002, 0x680002, 0x340015, 0x600016, 0x600010, 0x1ef8d, 0x1ee8e,
+    0x1f042, 0x68000a, 0x740004, 0x1f08e, 0x1f146, 0x5c000a, 0x1ee55, 0x680010,
+    0x69f50a, 0x1f0cf, 0x1facd, 0x1f1c7, 0x1f3c6, 0x680016, 0x1f610, 0x740011,
+    0x1f116, 0x1f755, 0x1f2c6, 0x740015, 0x1ef16, 0x1f191, 0x1f284, 0x400013,
+    0x1f24e, 0x700019, 0x1f8cf, 0x5c0020, 0x3c0012, 0x1f019, 0x69efe0, 0x3c0015,
+    0x1f44a, 0x1f30f, 0x1fc42, 0x3c000d, 0x700026, 0x1f38d, 0x3c000c, 0x1fa0f,
+    0x1fa82, 0x1fd10, 0x41fb42, 0x1fbd0, 0x1f846, 0x1f713, 0x1fa46, 0x1ff10,
+    0x1f88a, 0x1fc10, 0x70000a, 0x1ff56, 0x1fec2, 0x20006, 0x1fb90, 0x1fcd4,
+    0x203cd, 0x20202, 0x20395, 0x640002, 0x1fdca, 0x1ff86, 0x1fb16, 0x640006,
+    0x1fc89, 0x20253, 0x1fd90, 0x64000a, 0x20188, 0x20415, 0x20455, 0x20544,
+    0x204ca, 0x640010, 0x20485, 0x20a87, 0x20854, 0x660302, 0x20b0d, 0x640016,
+    0x20514, 0x640006, 0x20616, 0x20a13, 0x40000d, 0x64000a, 0x20784, 0x20696,
+    0x2134f, 0x640020, 0x400013, 0x640010, 0x640020, 0x400013, 0x20cce, 0x640014,
+    0x20d4d, 0x640016, 0x20d0e, 0x20811, 0x20592, 0x20d97, 0x3e0954, 0x3e0b55,
+    0x20bc8, 0x20c8d, 0x6a0dc2, 0x640020, 0x6a0c02, 0x21048, 0x211c2, 0x210c6,
+    0x6a1106, 0x214a0, 0x20e4a, 0x3c0009, 0x20eca, 0x20e0d, 0x21384, 0x21202,
+    0x212d4, 0x2164a, 0x21150, 0x21314, 0x21190, 0x2128f, 0x20b96, 0x21246,
+    0x214c6, 0x400002, 0x680002, 0x21a96, 0x21787, 0x5c000a, 0x2168f, 0x21706,
+    0x6a0f20, 0x21504, 0x680020, 0x21a55, 0x2174a, 0x216d6, 0x21451, 0x3c000d,
+    0x400013, 0x217ce, 0x21b54, 0x2188f, 0x218cf, 0x3c0012, 0x215d9, 0x2158d,
+    0x3c0015, 0x21b0f, 0x2190a, 0x5c0020, 0x21810, 0x21946, 0x2198f, 0x21bca,
+    0x219cf, 0x540014, 0x21b88, 0x21c10, 0x21e08, 0x21c46, 0x21d8d, 0x21d55,
+    0x21e47, 0x21c95, 0x21a0a, 0x21ed3, 0x21d0f, 0x21dcf, 0x140006, 0x180000,
+    0x38000d, 0x280000, 0x540010, 0x21e8f, 0x21f06, 0x21f4a, 0x280000, 0x2204d,
+    0x21f86, 0x220c6, 0x22095, 0x22115, 0x780015, 0x180000, 0x2200e, 0x280000,
+    0x280000, 0x221d5, 0x2218a, 0x222cf, 0x280000, 0x2240e, 0x280000, 0x22246,
+    0x22493, 0x280000, 0x224cf, 0x4c0004, 0x2220a, 0x22320, 0x225d5, 0x22655,
+    0x22294, 0x22713, 0x2258a, 0x280000, 0x22454, 0x2214a, 0x223ca, 0x22506,
+    0x22554, 0x4c0012, 0x2268d, 0x22616, 0x180000, 0x500005, 0x226c9, 0x22895,
+    0x227d0, 0x22788, 0x280000, 0x22a55, 0x2284a, 0x2274a, 0x22985, 0x22ad5,
+    0x228ca, 0x7c0013, 0x22946, 0x229c2, 0x2280f, 0x822c02, 0x2290f, 0x180000,
+    0x22b06, 0x540011, 0x22a0f, 0x22b4e, 0x280000, 0x22c4e, 0x280000, 0x22c8a,
+    0x180000, 0x280000, 0x280000, 0x22e0d, 0x22a96, 0x22bd5, 0x280000, 0x22b8f,
+    0x22e85, 0x22d95, 0x280000, 0x22f0e, 0x0, 0x640002, 0x23015, 0x23055,
+    0x23155, 0x640006, 0x22d09, 0x22ccf, 0x23195, 0x64000a, 0x1c000a, 0x23385,
+    0x8631d3, 0x22d51, 0x22f8d, 0x640010, 0x233c5, 0x2320f, 0x2324f, 0x640014,
+    0x23408, 0x640016, 0x2348d, 0x23314, 0x232d3, 0x23355, 0x2310d, 0x880020,
+    0x23504, 0x2358d, 0x2344a, 0x640020, 0x234cd, 0x22f4f, 0x23546, 0x2364e,
+    0x300015, 0x237ca, 0x140015, 0x140006, 0x235cf, 0x180000, 0x180000, 0x5c0006,
+    0x180000, 0x8c000f, 0x23686, 0x23895, 0x100010, 0x23606, 0x236cf, 0x23706,
+    0x23857, 0x23293, 0x2374f, 0x23787, 0x10000a, 0x180000, 0x900000, 0x540020,
+    0x238ca, 0x239c5, 0x2380f, 0x180000, 0x2398f, 0x1c000a, 0x23a86, 0x2390e,
+    0x280000, 0x23a4f, 0x140006, 0x23b53, 0x80015, 0x23a14, 0x280000, 0x23c02,
+    0x23b11, 0x23acf, 0x23954, 0x640014, 0x14000e, 0x140014, 0x140015, 0x14000e,
+    0x23b82, 0x23d0d, 0x23bd0, 0x23cca, 0x23dd5, 0x280000, 0x280000, 0x23c50,
+    0x23c8a, 0x23d4d, 0x23e14, 0x280000, 0x940014, 0x23e4d, 0x23e86, 0x241d5,
+    0x23ed5, 0x23d82, 0x640002, 0x24046, 0x24295, 0x2408e, 0x640006, 0x242d5,
+    0x240c6, 0x24114, 0x64000a, 0x244c2, 0x2424e, 0x100009, 0x2430d, 0x24455,
+    0x640010, 0x24146, 0x2434d, 0x24000d, 0x640014, 0x980012, 0x640016, 0x24197,
+    0x280000, 0x24386, 0x24590, 0x243cf, 0x38000d, 0x2440f, 0x2454e, 0x64001f,
+    0x640020, 0x180000, 0x280000, 0x2448f, 0x580013, 0x580013, 0x2450f, 0x38000d,
+    0x2460f, 0x245c6, 0x2464e, 0x24704, 0x2468f, 0x246cf, 0x24813, 0x100009,
+    0x280000, 0x2474d, 0x100013, 0x180000, 0x247c6, 0x24846, 0x24896, 0x280000,
+    0x24910, 0x10000e, 0x248d5, 0x24a4a, 0x100013, 0x100013, 0x24bc5, 0x10000d,
+    0x864c13, 0x249c4, 0x24996, 0x10000f, 0x24794, 0x24210, 0x10000e, 0x10000c,
+    0x100006, 0x24b0a, 0x24950, 0x24c86, 0x9c0009, 0x24ad1, 0x180000, 0x24b4f,
+    0x24d86, 0x24e02, 0x24c4e, 0x280000, 0x24a96, 0x24b8f, 0x24a20, 0x24d0f,
+    0x280000, 0x24dce, 0x24f8d, 0x24cda, 0x580013, 0x24ec6, 0x280000, 0x24e4f,
+    0x25294, 0x25006, 0x280000, 0x24f0f, 0x251ce, 0x1c0009, 0x24fd5, 0x24d60,
+    0x250d6, 0xa00014, 0x640006, 0x180000, 0x24f54, 0x38000d, 0x64000a, 0x25156,
+    0x2520d, 0x25382, 0x38000d, 0x340019, 0x25450, 0x2524d, 0x340017, 0x252cd,
+    0x640014, 0x180000, 0x254ce, 0x25755, 0x180000, 0x25494, 0x25353, 0x1c000a,
+    0x14000e, 0x180000, 0x257d5, 0x25855, 0x25546, 0x258d5, 0x25586, 0x259d6,
+    0x25995, 0x100006, 0x25646, 0x25615, 0x25686, 0x100008, 0x25806, 0x38000d,
+    0x255c4, 0x25a84, 0x25c55, 0x25882, 0x25c95, 0x25512, 0x256cf, 0x25ce0,
+    0x25d8a, 0x2590f, 0x25711, 0x25bc6, 0x25c06, 0x400002, 0x680002, 0x25954,
+    0x25b17, 0x5c000a, 0x25dcf, 0x25a14, 0x25d07, 0x260d5, 0x25e0e, 0x25b44,
+    0x25d46, 0x25b96, 0x3c0012, 0x480002, 0x2620d, 0x3c0015, 0x25ad1, 0x26056,
+    0x400013, 0x25e4a, 0x25fcf, 0x25e8d, 0x3c000d, 0x2610f, 0x25a59, 0x5c0020,
+    0x25ed0, 0x24e94, 0xa40009, 0x261d0, 0xa80002, 0x25f8f, 0x2600f, 0x5c0015,
+    0xaa5f46, 0x25f15, 0x26255, 0x2608f, 0x26186, 0x26313, 0x262c6, 0x2654a,
+    0x26493, 0x265ca, 0x2635a, 0x600005, 0x34000a, 0x26384, 0xa80014, 0x266c8,
+    0x26846, 0x26410, 0x2628f, 0x68000f, 0x26808, 0x2674a, 0x26907, 0xa0000e,
+    0x26890, 0x400005, 0xa80020, 0x268ca, 0x2644f, 0x263d4, 0x26695, 0x340020,
+    0x264d3, 0xac0005, 0x26a0f, 0x400015, 0x26608, 0x24005, 0x26519, 0x26b82,
+    0x269d6, 0x2664d, 0xb26d53, 0x2670f, 0x26d96, 0xac000d, 0x400015, 0xac0013,
+    0x26594, 0x267d1, 0x26a42, 0x26793, 0x26950, 0x26e8a, 0x26996, 0x26bc5,
+    0x70000f, 0x26c4f, 0x700004, 0x680005, 0x26c0a, 0x2704a, 0xa80002, 0x640004,
+    0x700009, 0x26c96, 0xa80006, 0x700011, 0x48000f, 0x700014, 0xa8000a, 0x26e03,
+    0x680014, 0x680017, 0x680007, 0x26ec6, 0xa80010, 0x26cd4, 0x880016, 0x27191,
+    0xa80014, 0x26b4e, 0xa80016, 0x700014, 0x271c4, 0x26f0f, 0x27313, 0x26f4f,
+    0x440002, 0x27102, 0x3c0020, 0x2748a, 0xa80020, 0x2750f, 0x270c6, 0x270a3,
+    0x26e44, 0x2768d, 0xa00009, 0x2720a, 0xa80014, 0x27445, 0x27349, 0x64000d,
+    0x27402, 0xb40010, 0x440016, 0x27290, 0xa00013, 0xa80014, 0x27806, 0xaa72d4,
+    0x2738a, 0xa80016, 0x274ca, 0x27706, 0x27796, 0x2784d, 0x273d0, 0x27982,
+    0x276d0, 0x27653, 0x3c0006, 0x400019, 0x3c000a, 0x400014, 0x27a8a, 0x277ca,
+    0x27bd0, 0x27946, 0x27ac6, 0x440006, 0x27b46, 0x27a10, 0xa0000f, 0xb8000d,
+    0xa67a53, 0x700013, 0x27c8a, 0xa40016, 0x2788d, 0xac0015, 0x279c2, 0xa4001a,
+    0x70000f, 0x68000e, 0x27c4f, 0x640004, 0x700007, 0x278e0, 0x3c0016, 0xac0013,
+    0x2804f, 0x27d4d, 0x27c0f, 0x27e06, 0x480002, 0x64000f, 0x64000f, 0xa40009,
+    0x27dcf, 0x740015, 0x28090, 0xa80002, 0x640015, 0x5c0015, 0x700019, 0xaa7e46,
+    0x27d95, 0x28215, 0x27e8f, 0x27f08, 0x27eca, 0x28247, 0x400015, 0x27f90,
+    0x400005, 0x27fca, 0x28016, 0x282c2, 0x28496, 0xa80014, 0x28142, 0xb28453,
+    0x28186, 0x640004, 0x400015, 0x2850f, 0x281cf, 0x28286, 0x880016, 0x28655,
+    0xbc000a, 0xa80020, 0x28542, 0x28755, 0x287d5, 0x8000d, 0x28109, 0x284c6,
+    0x2834f, 0x28686, 0x180000, 0xc0000d, 0x180000, 0x3c0013, 0x288c6, 0x180000,
+    0x283e0, 0x28a15, 0x2880d, 0x285cf, 0x28a95, 0x286cf, 0xb8000d, 0x28ad5,
+    0x28a45, 0x280000, 0x2878f, 0x2884d, 0x28c02, 0x280000, 0x28986, 0x180000,
+    0x2890f, 0x180000, 0x28c90, 0x28d85, 0x28dd7, 0x28c55, 0x28e0f, 0x240003,
+    0x28956, 0x28d15, 0x180000, 0x28b0f, 0x28d46, 0x28e4d, 0x28fc5, 0xb8000d,
+    0x29095, 0x180000, 0x28e8d, 0x180000, 0x28ec6, 0x290c8, 0x29053, 0x180000,
+    0x5c0011, 0x2900e, 0x288a0, 0x28f46, 0xc40004, 0x29215, 0x180000, 0x29106,
+    0x2924e, 0x292d5, 0xc4000a, 0x28f0f, 0x300015, 0x29355, 0x29186, 0x2914d,
+    0x180000, 0x180000, 0x291c6, 0x29395, 0x2928a, 0x180000, 0x180000, 0x1c0013,
+    0x29415, 0xc80002, 0x640015, 0xb8000d, 0x295c8, 0xc80006, 0x29306, 0x293c6,
+    0x29484, 0xc8000a, 0x297d5, 0x29446, 0x294c6, 0x29506, 0x29546, 0xc80010,
+    0x29586, 0x2960e, 0x29646, 0xc80014, 0x29686, 0xc80016, 0x2974d, 0x29786,
+    0x2970d, 0x540002, 0xcc0000, 0x29902, 0x296cf, 0x900000, 0x0, 0xc80020,
+    0x29a0a, 0x2980f, 0x29a60, 0x2988f, 0x29855, 0x200015, 0x540008, 0x540010,
+    0x299d5, 0x29b4e, 0x54000a, 0x140005, 0x29950, 0x29b15, 0x29a84, 0x180000,
+    0x280000, 0x2998f, 0x2615d, 0xd00014, 0x298d0, 0x140010, 0x29b95, 0x29ccf,
+    0x29bd5, 0x29d0d, 0x29d8f, 0x28f95, 0x280000, 0xa80014, 0xb8000d, 0x180000,
+    0x29d42, 0x29acf, 0x180000, 0x29f15, 0x29e0a, 0x29c02, 0x29dd3, 0xa80020,
+    0x29c4f, 0x180000, 0x29e4f, 0x29e8a, 0x29f4f, 0x940020, 0x29ec3, 0x5c0004,
+    0xa80002, 0xb8000d, 0xb8000d, 0x2a006, 0x100014, 0x29f8f, 0x280000, 0x2a046,
+    0xac0020, 0x2a186, 0x2a206, 0x180000, 0x2a0d5, 0x2a295, 0x29fcf, 0x2a2d5,
+    0x2a408, 0x2a315, 0x6c000d, 0x100002, 0x2a58a, 0x2a355, 0x2a10f, 0x2a455,
+    0x2a14f, 0x2a242, 0x2a54e, 0x2a5cd, 0x100009, 0xa80002, 0x0, 0x2a64d,
+    0x2a3d0, 0x100014, 0x2a60e, 0x2a48a, 0x2a395, 0x280000, 0x640004, 0x180000,
+    0xc80010, 0x2a4cf, 0x2a815, 0x2a895, 0xc80014, 0x2a50f, 0x2a84e, 0x2a690,
+    0x2a8d3, 0xd40015, 0x2a6cf, 0xb8000d, 0xb6a9c2, 0x2a786, 0x2a995, 0x2a70f,
+    0x2aa4d, 0x2ab15, 0x2ab4d, 0xa00009, 0x640003, 0x6c000d, 0x6c000d, 0x2a90a,
+    0x2aa8d, 0x2aac6, 0xb40010, 0xa2aa11, 0x2a94e, 0x180000, 0x2ab8c, 0xcc0000,
+    0xb40016, 0xcc0000, 0x640011, 0x8c0000, 0x2a74f, 0x2abcf, 0x8c0000, 0x2ad50,
+    0x2ac0f, 0x2accf, 0x2ac56, 0x100013, 0x2ad90, 0x2ac86, 0x2ae82, 0x2ad0f,
+    0x2ae55, 0x8c0000, 0xcc0000, 0xa40009, 0x2aed0, 0x480002, 0x2b008, 0x5c0015,
+    0xa80002, 0x2b090, 0x2add5, 0x2b047, 0xaaaf46, 0x2af15, 0x2ae0f, 0x2af8f,
+    0x400015, 0x2afca, 0x2b0ca, 0x2b116, 0x400005, 0x2b2c2, 0x2b182, 0x2b346,
+    0xb2b553, 0x2b382, 0xa80014, 0xa00002, 0x2b3cf, 0xb40008, 0x400015, 0xd80013,
+    0x2b316, 0x880016, 0x2b206, 0x2b695, 0x2b7ce, 0x2b755, 0xa80020, 0x2b815,
+    0x2b506, 0x700011, 0x2b44f, 0x3c0006, 0x340005, 0x2b850, 0x34000e, 0x2b915,
+    0x2b886, 0xac0013, 0x2b606, 0xac000a, 0x2b5d5, 0x2b8d4, 0x2bb42, 0xac000f,
+    0x740015, 0x2b94a, 0x740016, 0x740015, 0x74000e, 0x2b6c7, 0xac0013, 0x740011,
+    0x2b78f, 0x340003, 0x3c0015, 0x2b717, 0x3c000d, 0x2bbd3, 0x2b996, 0xdc0002,
+    0x2ba95, 0x2bcd4, 0x2b9c4, 0xdc0006, 0x2ba13, 0x2bd95, 0x2bb84, 0xdc000a,
+    0x3c000e, 0x2bc07, 0x2bdd3, 0x2bc42, 0x2a7d4, 0xdc0010, 0x700015, 0x2ba45,
+    0x2bf15, 0xdc0014, 0x2bacf, 0xdc0016, 0x700014, 0x680020, 0x680002, 0x680009,
+    0x2bec9, 0x2c095, 0x2c0d5, 0x2bc8f, 0xe00002, 0xdc0020, 0x2bd42, 0xe4000f,
+    0x440015, 0x640020, 0xd40009, 0x700015, 0xa00002, 0x2c190, 0x800014, 0xd00014,
+    0x2c255, 0x3c0011, 0x2c114, 0x3c000a, 0x2be04, 0x3c0016, 0x3c0013, 0x2bf46,
+    0x2c20a, 0xa40003, 0x2bf8f, 0x2be8f, 0xa40004, 0xa4000e, 0xa40008, 0x2c1c6,
+    0xa40011, 0xe80002, 0xa4000f, 0x2c04a, 0x2c28f, 0x2bfcf, 0xa40013, 0x740015,
+    0x700007, 0xa40011, 0x2c2cf, 0xa40015, 0x2c30f, 0x740016, 0x3c0014, 0x3c0015,
+    0x2c34e, 0x3c000f, 0x74000d, 0x2c382, 0x2c482, 0x2c4d5, 0x700015, 0x2c3cf,
+    0x2c58f, 0xd80013, 0xa00002, 0x2c682, 0x2c615, 0x3c000d, 0x340003, 0x2c655,
+    0x3c0015, 0x2c713, 0x2c516, 0xdc0002, 0x2c455, 0x2c5cf, 0x2c544, 0xdc0006,
+    0x2c6d3, 0xec0000, 0x2c786, 0xdc000a, 0x2c895, 0xec0000, 0x2c914, 0x240000,
+    0x2c991, 0xdc0010, 0x2ca55, 0x2c80e, 0x2c760, 0xdc0014, 0x2c853, 0xdc0016,
+    0x240000, 0x2c7cf, 0x240000, 0x240000, 0x2cad5, 0xf0000d, 0xf4000d, 0x2c9c6,
+    0x2cc95, 0xdc0020, 0x2c8cf, 0x2ccd5, 0xf80004, 0x2c94f, 0x4c0004, 0xf80015,
+    0x4c0013, 0x2cd55, 0x2ca06, 0x5c000a, 0x2ca86, 0x2cb06, 0x2cb46, 0x2cbc6,
+    0x2cdc8, 0x2cfd5, 0x240000, 0x2ce02, 0x2cb8f, 0x2cd86, 0x2ce46, 0xf0000d,
+    0x240000, 0x2ce86, 0x2cc4f, 0xec0000, 0x2cecf, 0x240000, 0x240000, 0x2cf06,
+    0x240000, 0x2d055, 0xf0000d, 0x2cf4f, 0x140016, 0x2cf8f, 0x2d00f, 0x2cd0d,
+    0x2d146, 0x0, 0x2d282, 0x2d08f, 0x0, 0x2d2c6, 0x2d0cf, 0xec0000,
+    0x2d10f, 0xec0000, 0x2d18f, 0x2d1cf, 0x2d20f, 0x2d24f, 0x2d38a, 0x240000,
+    0x2d30f, 0x2d34f, 0xf0000d, 0x2d642, 0x2d844, 0x2d3cf, 0x240000, 0x240000,
+    0x2d455, 0x2d7cd, 0x2d686, 0x2d6c6, 0x2d78f, 0x2d815, 0xb80002, 0x2d8d5,
+    0x2d955, 0x2d986, 0xb80006, 0x2db15, 0x2d9c6, 0x4c0006, 0xb8000a, 0x2d915,
+    0x2db55, 0x2da05, 0x2da4d, 0x240000, 0x2d890, 0x3c0015, 0x2dc95, 0x2dacf,
+    0x2dc4d, 0x2db8f, 0xec0000, 0xec0000, 0x240000, 0xec0000, 0x2dcd5, 0x2da8f,
+    0x2dbcf, 0xec0000, 0x2de55, 0x2de95, 0x2ded5, 0x2dc0f, 0x2dd06, 0x2dd4f,
+    0xe80002, 0x2df15, 0x2df55, 0x2ddc6, 0x2e0d3, 0x2de06, 0x2df86, 0x2dfc6,
+    0x240000, 0x2e14f, 0x240000, 0xe80014, 0x100016, 0x2e042, 0x240000, 0x2e106,
+    0x2e015, 0x2e095, 0x2e1c2, 0x2e184, 0x240000, 0x2e2cf, 0xe80014, 0x2e286,
+    0x2e255, 0x2e315, 0x2e415, 0x2e386, 0x2e3ca, 0x2e451, 0x700011, 0x100006,
+    0x64000a, 0x8c0000, 0x2e34f, 0x0, 0x2e215, 0x2e882, 0xa00002, 0x700020,
+    0x0, 0x2e4cf, 0x0, 0x2e982, 0x2e495, 0x2e515, 0x3ee651, 0x2e7cd,
+    0x100015, 0x2e555, 0xd80013, 0x2e795, 0x2e60f, 0x2e595, 0x340003, 0x2eb47,
+    0x2e6c4, 0x3c000d, 0xe80004, 0x2e5d5, 0x3c0015, 0x2ea13, 0x2e696, 0xdc0002,
+    0x2e855, 0x2e713, 0x480000, 0xdc0006, 0x2e74f, 0x480000, 0x2eacf, 0xdc000a,
+    0x480000, 0x2e902, 0x2ec8e, 0xfc0002, 0x480000, 0xdc0010, 0x2eb15, 0xac000f,
+    0x2ec54, 0xdc0014, 0x740013, 0xdc0016, 0x740010, 0x2ed0a, 0x740013, 0x2ea4d,
+    0x400003, 0x400002, 0xac000d, 0x2ee15, 0x3c000a, 0xdc0020, 0x480000, 0xe80004,
+    0x2ed4a, 0x400013, 0x2ee8a, 0x2ee53, 0x2edd5, 0x2eb86, 0xa80002, 0xe0000e,
+    0x2ef15, 0x680006, 0x480000, 0x480000, 0xa40005, 0x2ecc4, 0x2ea94, 0x680010,
+    0x2ed82, 0xa80020, 0x2eed5, 0xd00002, 0x2ef8f, 0x3c0015, 0x3c000a, 0x2ef55,
+    0x100000f, 0x2efca, 0x3c0014, 0x480000, 0x3c0010, 0x3c000d, 0xe80004, 0x2f08a,
+    0x480000, 0x480000, 0x68001f, 0x3c000a, 0x0, 0x400003, 0x400002, 0x2f015,
+    0x2f055, 0x2f195, 0x400000, 0x2f0d5, 0x2f1d5, 0x2f10f, 0x2f206, 0x400013,
+    0x2f284, 0x400000, 0x2f255, 0x400000, 0x2f3d5, 0x2f14f, 0x2f2d3, 0x2f34e,
+    0x2f38a, 0x2f314, 0x400000, 0x480000, 0x2f495, 0x400000, 0x2f40f, 0x2f44f,
+    0x2f515, 0x2f4cf, 0x2f555, 0x2f58f, 0x2f5cf, 0x2f606, 0x2f64f, 0x480000,
+    0x2f6c8, 0x400000, 0x309d2, 0x2f715, 0x2cc10, 0x2f68f, 0x2f755, 0x0,
+    0x2f78f, 0x2f7cf, 0x0, 0x2f84f, 0x0, 0x0, 0x0, 0x0,
+    0x2f815, 0x480000, 0x2f8d5, 0x2f915, 0x2f88f, 0x2fa95, 0x2fdc8, 0x2fb55,
+    0x2fc15, 0x2fc55, 0x2f94f, 0x2fc95, 0x2fd55, 0x2fe15, 0x2fe55, 0x80015,
+    0x400000, 0x2fed5, 0x2ff15, 0x480000, 0x2ff95, 0x2fcc6, 0x3c000d, 0x2fd06,
+    0x54000a, 0x2facf, 0x2fb0f, 0x2fd86, 0x480000, 0x400000, 0x2fbca, 0x2ffc6,
+    0xb8000e, 0x30046, 0x480000, 0x480000, 0x30086, 0x2fe8f, 0x2ff4f, 0x5c0006,
+    0x30010, 0x400000, 0x480000, 0x480000, 0x480000, 0x480000, 0x31622, 0x30195,
+    0x480000, 0x0, 0x480000, 0x300cf, 0x301d5, 0x30215, 0x3010f, 0x3014f,
+    0x100005, 0x480000, 0x30255, 0x30346, 0x480000, 0x3028f, 0x302cf, 0x3038e,
+    0x400000, 0x0, 0x400000, 0x3030f, 0x400000, 0x480000, 0x480000, 0x480000,
+    0x0, 0x3040f, 0x303d3, 0x1040015, 0x1040014, 0x3044f, 0xb8000f, 0xa40006,
+    0x304d5, 0x30490, 0x30595, 0xb80014, 0x30506, 0x30546, 0xe80004, 0x3060f,
+    0x305d5, 0x400003, 0x400002, 0x3c000a, 0x1080000, 0x400013, 0x3068a, 0x30813,
+    0x306d5, 0xc40006, 0x30a15, 0x30646, 0x2d702, 0xfc0004, 0xac000d, 0x740003,
+    0x440000, 0x3c0002, 0x30905, 0x3c0002, 0x480000, 0x1080000, 0x30a44, 0x10c0015,
+    0x1080000, 0x1080000, 0x680014, 0x3c0005, 0xa00009, 0xfc000f, 0x1080000, 0x1080000,
+    0x1000015, 0x0, 0xc40006, 0x3c0002, 0xa00009, 0x3c0002, 0x100000f, 0x480000,
+    0x30786, 0x3c000f, 0x1080000, 0x307c6, 0x440000, 0x440000, 0x10000a, 0x3070f,
+    0x0, 0x0, 0x30b15, 0x0, 0x1080000, 0x1080000, 0x0, 0x0,
+    0x440000, 0x0, 0xa80014, 0x440000, 0x1080000, 0x30c15, 0x30c95, 0x3084f,
+    0x30cd5, 0x30d8e, 0x440000, 0x30d15, 0x30d55, 0x1080000, 0x30dd5, 0x30e15,
+    0x1080000, 0x1080000, 0x1080000, 0x30e55, 0x30e95, 0x1080000, 0x30ed5, 0x30f95,
+    0x1080000, 0x1080000, 0x30fd5, 0x1080000, 0x1080000, 0x30c46, 0x440000, 0x30f50,
+    0x31055, 0x31115, 0x30b4f, 0x30b8f, 0x31084, 0x30f0f, 0x440000, 0x440000,
+    0x1080000, 0x1080000, 0x0, 0x0, 0x0, 0x0, 0x3100f, 0x31155,
+    0x311cf, 0x3120f, 0x31195, 0x440000, 0x31306, 0x31446, 0x440000, 0x480000,
+    0x31295, 0x312d5, 0x31355, 0x310db, 0x3124f, 0x3c0002, 0xc40006, 0x31395,
+    0x313d5, 0x31415, 0x3c0002, 0x3154f, 0x3158f, 0x31495, 0x314d5, 0x31515,
+    0x480000, 0x110000f, 0x3c0006, 0x31642, 0xb80000, 0x3168f, 0x316cf, 0x315d6,
+    0xb80000, 0x317d5, 0xb80000, 0xb80000, 0xb80000, 0xb80000, 0x31895, 0xb80000,
+    0xb80000, 0xb80000, 0xb80000, 0xb80000, 0x31746, 0x31796, 0x6c0000, 0xb80000,
+    0x3170f, 0xb80000, 0x318d5, 0x31955, 0xb80000, 0xb80000, 0xb80000, 0x0,
+    0x31906, 0x31a06, 0xb80000, 0xc40000, 0x14000f, 0x6c0000, 0xc40000, 0xb80000,
+    0xb80000, 0x31995, 0xb80000, 0xb80000, 0x0, 0x319d5, 0x0, 0x0,
+    0x0, 0x0, 0x31a86, 0x3180f, 0x31a55, 0x31c95, 0x31d15, 0xc80000,
+    0x3184f, 0x31b8a, 0xf00000, 0xf00000, 0x31c06, 0xf00000, 0xf00000, 0xf00000,
+    0x0, 0xf00000, 0x31e15, 0x31e95, 0x31b0f, 0x31ad5, 0x3c0015, 0x31f15,
+    0x31f55, 0x32015, 0xf00000, 0x31b4f, 0xf00000, 0x320d5, 0x32155, 0x31bcf,
+    0xf00000, 0x31c4f, 0xf40000, 0x31ecd, 0x1140000, 0x1180000, 0x32053, 0x31d4f,
+    0x1180000, 0x32255, 0x322d5, 0x1180000, 0x32315, 0x1180000, 0x32355, 0x1180006,
+    0x3220d, 0x11c0000, 0x323d5, 0x1200000, 0x1200000, 0x1200000, 0x1240006, 0x1200000,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+};
+static const uint8_t HYPH_FR_VALUES[] = {
+    0, 0, 2, 2, 2, 0, 1, 1, 2, 1, 4, 0, 2, 1, 2, 1, 2, 1, 2, 0, 1, 2, 1, 1,
+    1, 3, 1, 4, 2, 1, 2, 0, 1, 4, 0, 3, 2, 0, 3, 2, 2, 1, 2, 3, 2, 1, 2, 4,
+    1, 4, 3, 2, 2, 3, 3, 1, 2, 4, 1, 2, 3, 1, 3, 2, 1, 1, 0, 2, 3, 2, 1, 2,
+    2, 3, 0, 2, 2, 3, 2, 2, 2, 3, 3, 1, 1, 4, 2, 1, 2, 3, 3, 2, 1, 2, 5, 1,
+    4, 3, 2, 2, 1, 3, 2, 3, 2, 2, 4, 3, 0, 3, 2, 1, 3, 2, 1, 2, 5, 1, 1, 4,
+    2, 4, 1, 4, 1, 1, 1, 1, 3, 1, 2, 3, 2, 0, 3, 3, 0, 2, 2, 3, 1, 2, 2, 2,
+    2, 3, 2, 4, 2, 2, 3, 3, 2, 3, 4, 5, 2, 1, 2, 3, 3, 3, 2, 3, 5, 2, 4, 3,
+    4, 3, 2, 1, 2, 5, 1, 3, 1, 2, 2, 1, 5, 1, 5, 5, 1, 2, 6, 1, 2, 1, 1, 2,
+    5, 2, 2, 3, 5, 2, 3, 2, 4, 2, 3, 4, 7, 1, 2, 6, 1, 1, 4, 2, 2, 1, 6, 2,
+    1, 2, 2, 1, 3, 6, 1, 3, 6, 1, 4, 4, 3, 2, 3, 2, 7, 2, 1, 2, 3, 2, 4, 5,
+    4, 2, 3, 2, 4, 1, 3, 7, 2, 3, 2, 4, 3, 2, 0, 3, 7, 1, 4, 7, 1, 3, 8, 1,
+    2, 8, 1, 3, 4, 4, 2, 0, 0, 3,
+};
+static const uint16_t HYPH_FR_VALUE_OFFSETS[] = {
+    0, 1, 5, 8, 11, 15, 19, 22, 25, 28, 31, 34, 39, 43, 47, 50,
+    54, 57, 60, 63, 66, 70, 74, 78, 82, 85, 89, 94, 97, 101, 105, 111,
+    116, 119, 123, 126, 129, 133, 138, 143, 147, 151, 155, 159, 164, 168, 173, 176,
+    180, 183, 186, 189, 192, 196, 200, 204, 207, 210, 214, 218, 221, 224, 227, 232,
+    236, 240, 244, 247, 251, 256, 259, 262, 265, 268,
+};
+
+// it: 384 patterns, 0 exceptions
+//
+// copyright: Copyright (C) 2008-2011 Claudio Beccari
+//
+// This file is available under the terms of the MIT licence.
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights to
+// use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is furnished to do
+// so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+static const uint16_t HYPH_IT_ALPHABET[] = {
+    0x27, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x2019,
+};
+static const uint32_t HYPH_IT_TRIE[] = {
+    0x360, 0x18001, 0x3e2, 0x86e3, 0x8a24, 0x8dc5, 0x326, 0x9107,
+    0x93c8, 0x9769, 0x2182, 0x87eb, 0x998c, 0x9c4d, 0x9fee, 0xa32f,
+    0x190, 0xa631, 0x89f2, 0xa9d3, 0x12d74, 0xb115, 0x180a, 0xadd7,
+    0x8ef8, 0xb4b9, 0x67a, 0xb5fb, 0x1801c, 0x702, 0x463, 0x20c04,
+    0x20505, 0x526, 0x247, 0xbea, 0x20009, 0x25b3, 0x2000b, 0x2000c,
+    0x86d, 0x124a, 0x10f, 0x8d0, 0x3731, 0x19ca, 0x773, 0xa74,
+    0x20a95, 0x30018, 0x1cea, 0xf18, 0xd15, 0xc56, 0x2001b, 0x28000,
+    0x28001, 0xe5a, 0x28003, 0x28004, 0x28005, 0x5800a, 0x28007, 0x28000,
+    0x28001, 0x27c6, 0x1f79, 0x1630, 0x3000d, 0x2800e, 0x2800f, 0x16cf,
+    0x28011, 0x1851, 0x30013, 0x28014, 0x28015, 0x1f4a, 0x28017, 0x28000,
+    0x28001, 0x28000, 0x28001, 0x2801c, 0x28003, 0x28004, 0x28005, 0x21f1,
+    0x28007, 0x2293, 0x32709, 0x2801c, 0x2909, 0x2800c, 0x3000d, 0x2800e,
+    0x2800f, 0x28012, 0x17c2, 0x28012, 0x30013, 0x28014, 0x28015, 0x2b93,
+    0x28000, 0x29b6, 0x1bea, 0x2801c, 0x2801b, 0x2801c, 0x28000, 0x28001,
+    0x1d30, 0x28003, 0x58010, 0x28005, 0x58002, 0x58016, 0x28008, 0x28000,
+    0x28001, 0x1602, 0x2c02, 0x2800d, 0x2800e, 0x2800f, 0x2ae6, 0x28011,
+    0x30009, 0x30013, 0x28014, 0x28015, 0x60015, 0x28017, 0x28018, 0x2bd1,
+    0x28000, 0x28001, 0x2801c, 0x28003, 0x28000, 0x28001, 0x28000, 0x28007,
+    0x28008, 0x5001a, 0x6800f, 0x2801c, 0x58002, 0x3000d, 0x2d26, 0x2800f,
+    0x58006, 0x2e6a, 0x2de7, 0x30013, 0x28014, 0x28015, 0x28000, 0x28001,
+    0x70006, 0x28003, 0x58010, 0x28005, 0x2801c, 0x28007, 0x28008, 0x30de9,
+    0x58016, 0x78014, 0x2801c, 0x3000d, 0x2800e, 0x3000f, 0x3800f, 0x28011,
+    0x8000e, 0x30013, 0x28014, 0x28015, 0x28000, 0x28017, 0x28018, 0x48000,
+    0x48001, 0x2801b, 0x2801c, 0x28000, 0x28001, 0x2e24, 0x28003, 0x48000,
+    0x28005, 0x68014, 0x58002, 0x20013, 0x28009, 0xeca, 0x58006, 0x58016,
+    0x3000d, 0x2800e, 0x2800f, 0x2e95, 0x28000, 0x28001, 0x28013, 0x2c91,
+    0x58010, 0x8800f, 0x28017, 0x28007, 0x28008, 0x30009, 0x58016, 0x2801c,
+    0x2800c, 0x3000d, 0x2800e, 0x4801c, 0x28000, 0x28001, 0x90010, 0x30013,
+    0x28014, 0x28015, 0x28000, 0x1181, 0x2800c, 0x28003, 0x28004, 0x28005,
+    0x2801c, 0x38007, 0x28008, 0x30009, 0x20014, 0x3000b, 0x2800c, 0x2800d,
+    0x2800e, 0x2800f, 0x2eb3, 0x28011, 0x28012, 0x28013, 0x28014, 0x28015,
+    0x2d0f, 0x28017, 0x28018, 0x2fd4, 0x28000, 0x2801b, 0x11dc, 0x28000,
+    0x28001, 0x2da6, 0x28003, 0x28004, 0x28000, 0x28001, 0x28007, 0x28000,
+    0x28001, 0x28000, 0x28001, 0x3011, 0x2800d, 0x2800e, 0x2800f, 0x32ed,
+    0x28011, 0x28012, 0x28013, 0x28014, 0x28015, 0x2800e, 0x28017, 0x28018,
+    0x2801c, 0x28000, 0x28001, 0x2801c, 0x28003, 0x28004, 0x28005, 0x3293,
+    0x28007, 0x29068, 0x1209, 0x2801c, 0x3155, 0x2800c, 0x2800d, 0x2800e,
+    0x2800f, 0x31d5, 0x28011, 0x28012, 0x28013, 0x29274, 0x28015, 0x2fe2,
+    0x28017, 0x28000, 0x28001, 0x31a6, 0x2801b, 0x2801c, 0x28005, 0x3053,
+    0x28000, 0x2e01, 0x30009, 0x28003, 0x28000, 0x28000, 0x3000d, 0x90006,
+    0x2934f, 0x28009, 0x28011, 0x9800d, 0x30013, 0x291f4, 0x28015, 0x2800f,
+    0x326a, 0x98013, 0x31e2, 0x20013, 0x2801b, 0x2801c, 0x28000, 0x28001,
+    0x33c3, 0x28003, 0x28004, 0x28005, 0x2edc, 0x28007, 0x28008, 0x30009,
+    0x2801c, 0x2801c, 0x2800c, 0x2800d, 0x2800e, 0x2800f, 0x3362, 0x28011,
+    0x28012, 0x28013, 0x28014, 0x292b5, 0x330d, 0x28017, 0x28018, 0x28019,
+    0x34c8, 0x2801b, 0x2801c, 0x48000, 0x16e1, 0x8800f, 0x28000, 0x2081,
+    0x28000, 0x36e1, 0x28004, 0x348a, 0x20e9, 0x3586, 0x28000, 0x70004,
+    0xa8014, 0x3624, 0x70009, 0x3000d, 0x13f1, 0x3655, 0xa374a, 0x41454,
+    0x3975, 0x30013, 0x38e4, 0xb0016, 0xa0002, 0x28017, 0x2801b, 0x17fc,
+    0x28000, 0x1b81, 0x279c, 0x28003, 0x28004, 0x28005, 0x390f, 0x28007,
+    0x28008, 0x31689, 0x371c, 0xb8006, 0x3a74, 0x3000d, 0x2800e, 0x2800f,
+    0x38c4, 0x28011, 0xa0010, 0x30013, 0x31734, 0x295b5, 0x3950, 0x28017,
+    0x28018, 0x398a, 0x3a33, 0x31b1b, 0x1f9c, 0x28000, 0x28001, 0x3a94,
+    0x28003, 0x28004, 0x3a0f, 0x39ad, 0x28007, 0xc8015, 0x28009, 0x28000,
+    0x2121, 0xc0013, 0x28003, 0x2800e, 0x28005, 0xc000f, 0x28011, 0x28000,
+    0x28000, 0x28015, 0x28015, 0x2482, 0x2800d, 0x28018, 0x2800f, 0x68013,
+    0x28011, 0x2801c, 0x26c9, 0x28014, 0x28015, 0x3ad3, 0x28017, 0x3af6,
+    0x39ee, 0x2050, 0x2801b, 0x27bc, 0x2733, 0x20014, 0x28003, 0x28004,
+    0x28005, 0x3a4a, 0x28007, 0x28008, 0xd000c, 0xd8002, 0xe0010, 0xf0006,
+    0x3aa4, 0x2800e, 0x2800f, 0xe8011, 0x28011, 0xe8011, 0xe800f, 0x28014,
+    0x28015, 0x3c2f, 0x28017, 0xc0016, 0x3cb4, 0xf800e, 0x100010, 0xc0006,
+    0x108013, 0xd0004, 0xd0005, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd000d, 0x0, 0xd000f, 0x0, 0xd0011, 0x0,
+    0xd0013, 0x0, 0xd0015, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+};
+static const uint8_t HYPH_IT_VALUES[] = {
+    0, 0, 1, 1, 0, 2, 1, 2, 0, 2, 2, 2, 2, 1, 2, 0, 1, 2, 1, 1, 2, 0, 3, 2,
+    3, 2, 0, 2, 2, 3, 0, 1, 4, 0, 2, 2, 1, 1, 1, 1, 0, 3, 2, 0, 2, 1, 2, 2,
+    3, 0, 2, 3, 2, 1, 3, 2, 2, 3, 1, 2, 4, 3, 2, 2, 3, 2, 4, 1, 1, 3, 1, 2,
+    5, 1, 1, 3, 2, 4, 3, 2, 2, 2, 1, 5, 1, 3, 3, 2, 2, 3, 4, 2, 2, 1, 5, 2,
+    2, 3, 3, 2, 3, 2, 6, 1, 1, 5, 2, 3, 2, 4, 3, 2, 0, 3, 6, 2, 2, 1, 7, 1,
+    1, 3, 2, 1, 2,
+};
+static const uint16_t HYPH_IT_VALUE_OFFSETS[] = {
+    0, 1, 4, 8, 12, 15, 18, 21, 26, 30, 33, 37, 40, 45, 49, 53,
+    58, 62, 66, 69, 72, 75, 79, 83, 86, 90, 94, 98, 102, 105, 109, 114,
+    118, 121,
+};
+
+// 246681 bytes of tables
+static const HyphenationPatterns HYPHENATION_PATTERNS[] = {
+    {"de-1996", HYPH_DE_1996_ALPHABET, 42, HYPH_DE_1996_TRIE, 33218, 6, 16, HYPH_DE_1996_VALUES, HYPH_DE_1996_VALUE_OFFSETS, 2, 2},
+    {"en-us", HYPH_EN_US_ALPHABET, 26, HYPH_EN_US_TRIE, 15891, 5, 14, HYPH_EN_US_VALUES, HYPH_EN_US_VALUE_OFFSETS, 2, 3},
+    {"es", HYPH_ES_ALPHABET, 32, HYPH_ES_TRIE, 5862, 6, 13, HYPH_ES_VALUES, HYPH_ES_VALUE_OFFSETS, 2, 2},
+    {"fr", HYPH_FR_ALPHABET, 39, HYPH_FR_TRIE, 3255, 6, 12, HYPH_FR_VALUES, HYPH_FR_VALUE_OFFSETS, 2, 3},
+    {"it", HYPH_IT_ALPHABET, 28, HYPH_IT_TRIE, 514, 5, 10, HYPH_IT_VALUES, HYPH_IT_VALUE_OFFSETS, 2, 2},
+};
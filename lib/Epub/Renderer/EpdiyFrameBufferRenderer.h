@@ -152,6 +152,26 @@ public:
     epd_get_text_bounds(get_font(bold, italic), text, &x, &y, &x1, &y1, &x2, &y2, &m_font_props);
     return x2 - x1;
   }
+  virtual uintptr_t get_font_id()
+  {
+#ifdef USE_FREETYPE
+    if (m_freetype_enabled && m_freetype_font && m_freetype_font->is_valid())
+    {
+      return reinterpret_cast<uintptr_t>(m_freetype_font);
+    }
+#endif
+    return reinterpret_cast<uintptr_t>(m_regular_font);
+  }
+  virtual int get_font_pixel_size()
+  {
+#ifdef USE_FREETYPE
+    if (m_freetype_enabled && m_freetype_font && m_freetype_font->is_valid())
+    {
+      return m_freetype_font->get_pixel_height();
+    }
+#endif
+    return m_regular_font ? m_regular_font->advance_y : 0;
+  }
   void draw_text(int x, int y, const char *text, bool bold = false, bool italic = false)
   {
     // if using antialised text then set to gray next flush
@@ -3,6 +3,7 @@
 #include <string>
 
 class Renderer;
+class ZipEntryStream;
 
 class ImageHelper
 {
@@ -10,4 +11,7 @@ public:
   virtual ~ImageHelper(){};
   virtual bool get_size(const uint8_t *data, size_t data_size, int *width, int *height) = 0;
   virtual bool render(const uint8_t *data, size_t data_size, Renderer *renderer, int x_pos, int y_pos, int width, int height) = 0;
+  // decode straight from an entry in the epub - the data is pulled in as the decoder needs it
+  virtual bool get_size(ZipEntryStream *stream, int *width, int *height) = 0;
+  virtual bool render(ZipEntryStream *stream, Renderer *renderer, int x_pos, int y_pos, int width, int height) = 0;
 };
@@ -12,9 +12,35 @@
 #include <algorithm>
 #include "JPEGHelper.h"
 #include "Renderer.h"
+#include "../ZipFile/ZipFile.h"
 
 static const char *TAG = "JPG";
 
+// JPEGDEC file callbacks for reading from a zip entry stream
+static int32_t stream_read(JPEGFILE *file, uint8_t *buffer, int32_t length)
+{
+  ZipEntryStream *stream = static_cast<ZipEntryStream *>(file->fHandle);
+  int32_t read = static_cast<int32_t>(stream->read(buffer, length));
+  file->iPos = static_cast<int32_t>(stream->position());
+  return read;
+}
+
+static int32_t stream_seek(JPEGFILE *file, int32_t position)
+{
+  ZipEntryStream *stream = static_cast<ZipEntryStream *>(file->fHandle);
+  if (position < 0 || !stream->seek(position))
+  {
+    return -1;
+  }
+  file->iPos = position;
+  return position;
+}
+
+static void stream_close(void *handle)
+{
+  // the stream belongs to the caller
+}
+
 static bool is_valid_jpeg_buffer(const uint8_t *data, size_t data_size)
 {
   if (!data || data_size == 0)
@@ -99,6 +125,55 @@ bool JPEGHelper::render(const uint8_t *data, size_t data_size, Renderer *rendere
     ESP_LOGE(TAG, "Invalid JPEG render params");
     return false;
   }
+  JPEGDEC jpeg;
+  if (!jpeg.openRAM(const_cast<uint8_t *>(data), static_cast<int>(data_size), JPEGHelper::draw_jpeg_function))
+  {
+    ESP_LOGE(TAG, "JPEG open failed (render) - %d", jpeg.getLastError());
+    return false;
+  }
+  return decode(jpeg, renderer, x_pos, y_pos, width, height);
+}
+
+bool JPEGHelper::get_size(ZipEntryStream *stream, int *width, int *height)
+{
+  if (!width || !height || !stream)
+  {
+    ESP_LOGE(TAG, "Invalid JPEG get_size params");
+    return false;
+  }
+  JPEGDEC jpeg;
+  if (!stream->seek(0) ||
+      !jpeg.open(stream, static_cast<int>(stream->size()), stream_close, stream_read, stream_seek, NULL))
+  {
+    ESP_LOGE(TAG, "JPEG open failed (get_size) - %d", jpeg.getLastError());
+    return false;
+  }
+  *width = jpeg.getWidth();
+  *height = jpeg.getHeight();
+  ESP_LOGI(TAG, "JPEG size read - %dx%d", *width, *height);
+  jpeg.close();
+  return *width > 0 && *height > 0;
+}
+
+bool JPEGHelper::render(ZipEntryStream *stream, Renderer *renderer, int x_pos, int y_pos, int width, int height)
+{
+  if (!stream || !renderer || width <= 0 || height <= 0)
+  {
+    ESP_LOGE(TAG, "Invalid JPEG render params");
+    return false;
+  }
+  JPEGDEC jpeg;
+  if (!stream->seek(0) ||
+      !jpeg.open(stream, static_cast<int>(stream->size()), stream_close, stream_read, stream_seek, JPEGHelper::draw_jpeg_function))
+  {
+    ESP_LOGE(TAG, "JPEG open failed (render) - %d", jpeg.getLastError());
+    return false;
+  }
+  return decode(jpeg, renderer, x_pos, y_pos, width, height);
+}
+
+bool JPEGHelper::decode(JPEGDEC &jpeg, Renderer *renderer, int x_pos, int y_pos, int width, int height)
+{
   this->renderer = renderer;
   this->y_pos = y_pos;
   this->x_pos = x_pos;
@@ -108,12 +183,6 @@ bool JPEGHelper::render(const uint8_t *data, size_t data_size, Renderer *rendere
   this->accum_y = -1;
   this->row_sum.clear();
   this->row_count.clear();
-  JPEGDEC jpeg;
-  if (!jpeg.openRAM(const_cast<uint8_t *>(data), static_cast<int>(data_size), JPEGHelper::draw_jpeg_function))
-  {
-    ESP_LOGE(TAG, "JPEG open failed (render) - %d", jpeg.getLastError());
-    return false;
-  }
   jpeg.setUserPointer(this);
   jpeg.setPixelType(RGB565_LITTLE_ENDIAN);
   const int img_w = jpeg.getWidth();
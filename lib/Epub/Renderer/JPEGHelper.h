@@ -22,8 +22,12 @@ private:
 
   static int draw_jpeg_function(JPEGDRAW *pDraw);
   void flush_downscale_row();
+  // scale and draw an image that has already been opened
+  bool decode(JPEGDEC &jpeg, Renderer *renderer, int x_pos, int y_pos, int width, int height);
 
 public:
   bool get_size(const uint8_t *data, size_t data_size, int *width, int *height);
   bool render(const uint8_t *data, size_t data_size, Renderer *renderer, int x_pos, int y_pos, int width, int height);
+  bool get_size(ZipEntryStream *stream, int *width, int *height);
+  bool render(ZipEntryStream *stream, Renderer *renderer, int x_pos, int y_pos, int width, int height);
 };
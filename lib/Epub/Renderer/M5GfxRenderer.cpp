@@ -340,3 +340,16 @@ bool M5GfxRenderer::get_image_size(const std::string &filename, const uint8_t *d
 {
     return Renderer::get_image_size(filename, data, data_size, width, height);
 }
+
+void M5GfxRenderer::draw_image(const std::string &filename, ZipEntryStream *stream, int x, int y, int width, int height)
+{
+    const bool prev_dither = dither_images;
+    dither_images = true;
+    Renderer::draw_image(filename, stream, x, y, width, height);
+    dither_images = prev_dither;
+}
+
+bool M5GfxRenderer::get_image_size(const std::string &filename, ZipEntryStream *stream, int *width, int *height)
+{
+    return Renderer::get_image_size(filename, stream, width, height);
+}
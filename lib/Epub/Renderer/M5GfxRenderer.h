@@ -49,4 +49,6 @@ public:
     // Use the shared image helpers to enforce 1-bit rendering.
     virtual void draw_image(const std::string &filename, const uint8_t *data, size_t data_size, int x, int y, int width, int height);
     virtual bool get_image_size(const std::string &filename, const uint8_t *data, size_t data_size, int *width, int *height);
+    virtual void draw_image(const std::string &filename, ZipEntryStream *stream, int x, int y, int width, int height);
+    virtual bool get_image_size(const std::string &filename, ZipEntryStream *stream, int *width, int *height);
 };
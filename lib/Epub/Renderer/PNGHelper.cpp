@@ -9,9 +9,11 @@
 #endif
 
 #include <algorithm>
+#include <string.h>
 
 #include "PNGHelper.h"
 #include "Renderer.h"
+#include "../ZipFile/ZipFile.h"
 
 static const char *TAG = "PNG";
 
@@ -232,6 +234,133 @@ bool PNGHelper::render(const uint8_t *data, size_t data_size, Renderer *renderer
   return true;
 }
 
+// pngle is a push decoder so we just feed it the entry a chunk at a time
+static bool feed_stream(pngle_t *png, ZipEntryStream *stream)
+{
+  if (!stream->seek(0))
+  {
+    return false;
+  }
+  uint8_t buffer[1024];
+  size_t pending = 0;
+  bool eof = stream->eof();
+  while (!eof || pending > 0)
+  {
+    if (!eof)
+    {
+      size_t read = stream->read(buffer + pending, sizeof(buffer) - pending);
+      if (read == 0)
+      {
+        return false;
+      }
+      pending += read;
+      eof = stream->eof();
+    }
+    int fed = pngle_feed(png, buffer, pending);
+    if (fed < 0)
+    {
+      ESP_LOGE(TAG, "pngle error: %s", pngle_error(png));
+      return false;
+    }
+    // nothing was consumed and nothing more is coming - either the file is
+    // cut short or pngle wants more than the whole buffer in one go
+    if (fed == 0 && (eof || pending == sizeof(buffer)))
+    {
+      ESP_LOGE(TAG, "pngle stopped with %zu bytes left", pending);
+      return false;
+    }
+    // keep anything pngle didn't consume for the next feed
+    memmove(buffer, buffer + fed, pending - fed);
+    pending -= fed;
+  }
+  return true;
+}
+
+bool PNGHelper::get_size(ZipEntryStream *stream, int *width, int *height)
+{
+  pngle_t *png = pngle_new();
+  if (!png)
+  {
+    ESP_LOGE(TAG, "pngle_new failed");
+    return false;
+  }
+  auto init_cb = [](pngle_t *p, uint32_t w, uint32_t h) {
+    PNGHelper *self = static_cast<PNGHelper *>(pngle_get_user_data(p));
+    if (!self)
+    {
+      return;
+    }
+    int *w_ptr = reinterpret_cast<int *>(&self->x_scale); // reuse storage
+    int *h_ptr = reinterpret_cast<int *>(&self->y_scale);
+    *w_ptr = static_cast<int>(w);
+    *h_ptr = static_cast<int>(h);
+  };
+  *reinterpret_cast<int *>(&x_scale) = 0;
+  *reinterpret_cast<int *>(&y_scale) = 0;
+  pngle_set_user_data(png, this);
+  pngle_set_init_callback(png, init_cb);
+  bool ok = feed_stream(png, stream);
+  int local_width = *reinterpret_cast<int *>(&x_scale);
+  int local_height = *reinterpret_cast<int *>(&y_scale);
+  pngle_destroy(png);
+  if (!ok || local_width <= 0 || local_height <= 0)
+  {
+    return false;
+  }
+  *width = local_width;
+  *height = local_height;
+  return true;
+}
+
+bool PNGHelper::render(ZipEntryStream *stream, Renderer *renderer, int x_pos, int y_pos, int width, int height)
+{
+  this->renderer = renderer;
+  this->y_pos = y_pos;
+  this->x_pos = x_pos;
+  this->target_width = width;
+  this->target_height = height;
+  this->last_y = -1;
+  this->x_scale = 1.0f;
+  this->y_scale = 1.0f;
+  this->downscale = false;
+  this->accum_y = -1;
+  this->row_sum.clear();
+  this->row_count.clear();
+
+  pngle_t *png = pngle_new();
+  if (!png)
+  {
+    ESP_LOGE(TAG, "pngle_new failed");
+    return false;
+  }
+  pngle_set_user_data(png, this);
+  pngle_set_init_callback(png, pngle_init_callback);
+  pngle_set_draw_callback(png, pngle_draw_callback);
+  if (!feed_stream(png, stream))
+  {
+    pngle_destroy(png);
+    return false;
+  }
+  if (downscale && accum_y >= 0)
+  {
+    for (int i = 0; i < target_width; ++i)
+    {
+      uint16_t count = row_count[static_cast<size_t>(i)];
+      if (count == 0)
+      {
+        continue;
+      }
+      uint32_t sum = row_sum[static_cast<size_t>(i)];
+      uint8_t gray = static_cast<uint8_t>((sum + (count / 2)) / count);
+      renderer->draw_pixel(x_pos + i, accum_y, renderer->map_image_gray(gray));
+      row_sum[static_cast<size_t>(i)] = 0;
+      row_count[static_cast<size_t>(i)] = 0;
+    }
+  }
+  pngle_destroy(png);
+  return true;
+}
+
 #else // USE_PNGLE
 
 #include <PNGdec.h>
@@ -262,11 +391,73 @@ bool PNGHelper::get_size(const uint8_t *data, size_t data_size, int *width, int
 }
 
 bool PNGHelper::render(const uint8_t *data, size_t data_size, Renderer *renderer, int x_pos, int y_pos, int width, int height)
+{
+  int rc = png.openRAM(const_cast<uint8_t *>(data), data_size, png_draw_callback);
+  return decode(rc, renderer, x_pos, y_pos, width, height);
+}
+
+// PNGdec file callbacks for reading from a zip entry stream - PNGdec has no
+// user pointer for opening so the stream is smuggled in as the "filename"
+static void *stream_open(const char *filename, int32_t *size)
+{
+  ZipEntryStream *stream = reinterpret_cast<ZipEntryStream *>(const_cast<char *>(filename));
+  if (!stream->seek(0))
+  {
+    return nullptr;
+  }
+  *size = static_cast<int32_t>(stream->size());
+  return stream;
+}
+
+static void stream_close(void *handle)
+{
+  // the stream belongs to the caller
+}
+
+static int32_t stream_read(PNGFILE *file, uint8_t *buffer, int32_t length)
+{
+  ZipEntryStream *stream = static_cast<ZipEntryStream *>(file->fHandle);
+  int32_t read = static_cast<int32_t>(stream->read(buffer, length));
+  file->iPos = static_cast<int32_t>(stream->position());
+  return read;
+}
+
+static int32_t stream_seek(PNGFILE *file, int32_t position)
+{
+  ZipEntryStream *stream = static_cast<ZipEntryStream *>(file->fHandle);
+  if (position < 0 || !stream->seek(position))
+  {
+    return -1;
+  }
+  file->iPos = position;
+  return position;
+}
+
+bool PNGHelper::get_size(ZipEntryStream *stream, int *width, int *height)
+{
+  int rc = png.open(reinterpret_cast<const char *>(stream), stream_open, stream_close, stream_read, stream_seek, NULL);
+  if (rc == PNG_SUCCESS)
+  {
+    *width = png.getWidth();
+    *height = png.getHeight();
+    png.close();
+    return true;
+  }
+  ESP_LOGE(TAG, "failed to open png %d", rc);
+  return false;
+}
+
+bool PNGHelper::render(ZipEntryStream *stream, Renderer *renderer, int x_pos, int y_pos, int width, int height)
+{
+  int rc = png.open(reinterpret_cast<const char *>(stream), stream_open, stream_close, stream_read, stream_seek, png_draw_callback);
+  return decode(rc, renderer, x_pos, y_pos, width, height);
+}
+
+bool PNGHelper::decode(int rc, Renderer *renderer, int x_pos, int y_pos, int width, int height)
 {
   this->renderer = renderer;
   this->y_pos = y_pos;
   this->x_pos = x_pos;
-  int rc = png.openRAM(const_cast<uint8_t *>(data), data_size, png_draw_callback);
   if (rc == PNG_SUCCESS)
   {
     int img_w = png.getWidth();
@@ -34,6 +34,8 @@ private:
   PNG png;
 
   friend int png_draw_callback(PNGDRAW *draw);
+  // scale and draw an image that has been opened - rc is the result of opening it
+  bool decode(int rc, Renderer *renderer, int x_pos, int y_pos, int width, int height);
 #else
   // Allow pngle callbacks defined in PNGHelper.cpp to access the
   // internal state (renderer, x_pos, y_pos, scales, etc.).
@@ -44,6 +46,8 @@ private:
 public:
   bool get_size(const uint8_t *data, size_t data_size, int *width, int *height);
   bool render(const uint8_t *data, size_t data_size, Renderer *renderer, int x_pos, int y_pos, int width, int height);
+  bool get_size(ZipEntryStream *stream, int *width, int *height);
+  bool render(ZipEntryStream *stream, Renderer *renderer, int x_pos, int y_pos, int width, int height);
 #ifndef USE_PNGLE
   void draw_callback(PNGDRAW *draw);
 #endif
@@ -1,6 +1,7 @@
 #include "Renderer.h"
 #include "JPEGHelper.h"
 #include "PNGHelper.h"
+#include "../ZipFile/ZipFile.h"
 #ifndef UNIT_TEST
 #include <esp_log.h>
 #else
@@ -101,6 +102,39 @@ bool Renderer::get_image_size(const std::string &filename, const uint8_t *data,
   return false;
 }
 
+ImageHelper *Renderer::get_image_helper(const std::string &filename, ZipEntryStream *stream)
+{
+  // sniff the magic bytes and then put the stream back for the decoder
+  uint8_t header[8] = {};
+  size_t header_size = stream->read(header, sizeof(header));
+  if (!stream->seek(0))
+  {
+    return nullptr;
+  }
+  return get_image_helper(filename, header, header_size);
+}
+
+void Renderer::draw_image(const std::string &filename, ZipEntryStream *stream, int x, int y, int width, int height)
+{
+  ImageHelper *helper = stream ? get_image_helper(filename, stream) : nullptr;
+  if (helper)
+  {
+    helper->render(stream, this, x, y, width, height);
+  }
+}
+
+bool Renderer::get_image_size(const std::string &filename, ZipEntryStream *stream, int *width, int *height)
+{
+  ImageHelper *helper = stream ? get_image_helper(filename, stream) : nullptr;
+  if (helper && helper->get_size(stream, width, height))
+  {
+    return true;
+  }
+  *width = std::min(get_page_width(), get_page_height());
+  *height = *width;
+  return false;
+}
+
 void Renderer::draw_text_box(const std::string &text, int x, int y, int width, int height, bool bold, bool italic)
 {
   int length = text.length();
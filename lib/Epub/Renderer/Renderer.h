@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include "WordWidthCache.h"
 
 class ImageHelper;
+class ZipEntryStream;
 
 #ifdef USE_FREETYPE
 class FreeTypeFont;
@@ -15,8 +17,10 @@ class Renderer
 private:
   ImageHelper *png_helper = nullptr;
   ImageHelper *jpeg_helper = nullptr;
+  WordWidthCache word_widths;
 
   ImageHelper *get_image_helper(const std::string &filename, const uint8_t *data, size_t data_size);
+  ImageHelper *get_image_helper(const std::string &filename, ZipEntryStream *stream);
 
 protected:
   int margin_top = 0;
@@ -51,12 +55,36 @@ public:
     line_spacing_percent = percent;
   }
   int get_line_spacing_percent() const { return line_spacing_percent; }
+  // the line height without the line spacing - layout uses it as an em so
+  // changing the spacing doesn't move the words around
+  int get_base_line_height() { return get_line_height() * 100 / line_spacing_percent; }
   // Map grayscale image pixels to display output. Override for 1-bit output.
   virtual uint8_t map_image_gray(uint8_t gray) { return gray; }
   virtual void draw_image(const std::string &filename, const uint8_t *data, size_t data_size, int x, int y, int width, int height);
   virtual bool get_image_size(const std::string &filename, const uint8_t *data, size_t data_size, int *width, int *height);
+  // decode directly from an entry in the epub without loading it into memory first
+  virtual void draw_image(const std::string &filename, ZipEntryStream *stream, int x, int y, int width, int height);
+  virtual bool get_image_size(const std::string &filename, ZipEntryStream *stream, int *width, int *height);
   virtual void draw_pixel(int x, int y, uint8_t color) = 0;
   virtual int get_text_width(const char *text, bool bold = false, bool italic = false) = 0;
+  // identifies the font get_text_width is currently measuring with - the
+  // word width cache is thrown away when either of these changes
+  virtual uintptr_t get_font_id() { return 0; }
+  virtual int get_font_pixel_size() { return 0; }
+  // get_text_width for a single word of body text - the result is cached
+  int get_word_width(const char *word, bool bold = false, bool italic = false)
+  {
+    word_widths.set_font(get_font_id(), get_font_pixel_size());
+    uint8_t style = (bold ? 1 : 0) | (italic ? 2 : 0);
+    uint16_t width;
+    if (!word_widths.lookup(word, style, width))
+    {
+      width = get_text_width(word, bold, italic);
+      word_widths.insert(word, style, width);
+    }
+    return width;
+  }
+  WordWidthCache &get_word_width_cache() { return word_widths; }
   virtual void draw_text(int x, int y, const char *text, bool bold = false, bool italic = false) = 0;
   virtual void draw_text_box(const std::string &text, int x, int y, int width, int height, bool bold = false, bool italic = false);
   virtual void draw_rect(int x, int y, int width, int height, uint8_t color = 0) = 0;
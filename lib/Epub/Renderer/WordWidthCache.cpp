@@ -0,0 +1,113 @@
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+#include <esp_heap_caps.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include "WordWidthCache.h"
+
+WordWidthCache::~WordWidthCache()
+{
+  free(m_entries);
+}
+
+static uint32_t hash_word(const char *word, size_t length, uint8_t style)
+{
+  uint32_t hash = 2166136261u ^ style;
+  for (size_t i = 0; i < length; i++)
+  {
+    hash = (hash ^ static_cast<uint8_t>(word[i])) * 16777619u;
+  }
+  return hash;
+}
+
+void WordWidthCache::set_font(uintptr_t font_id, int pixel_size)
+{
+  if (font_id != m_font_id || pixel_size != m_pixel_size)
+  {
+    clear();
+    m_font_id = font_id;
+    m_pixel_size = pixel_size;
+  }
+}
+
+void WordWidthCache::clear()
+{
+  if (m_entries)
+  {
+    memset(m_entries, 0, sizeof(Entry) * SET_COUNT * 2);
+  }
+}
+
+WordWidthCache::Entry *WordWidthCache::find(const char *word, size_t length, uint8_t style, uint32_t hash)
+{
+  Entry *set = m_entries + (hash % SET_COUNT) * 2;
+  for (int way = 0; way < 2; way++)
+  {
+    Entry &entry = set[way];
+    if (entry.hash == hash && entry.length == length && entry.style == style && memcmp(entry.word, word, length) == 0)
+    {
+      // keep the most recently used entry first so it's the one that survives
+      if (way == 1)
+      {
+        Entry tmp = set[0];
+        set[0] = set[1];
+        set[1] = tmp;
+      }
+      return set;
+    }
+  }
+  return nullptr;
+}
+
+bool WordWidthCache::lookup(const char *word, uint8_t style, uint16_t &width)
+{
+  size_t length = strlen(word);
+  Entry *entry = nullptr;
+  if (m_enabled && m_entries && length > 0 && length <= MAX_CACHED_LENGTH)
+  {
+    entry = find(word, length, style, hash_word(word, length, style));
+  }
+  if (!entry)
+  {
+    m_misses++;
+    return false;
+  }
+  m_hits++;
+  width = entry->width;
+  return true;
+}
+
+void WordWidthCache::insert(const char *word, uint8_t style, uint16_t width)
+{
+  size_t length = strlen(word);
+  if (!m_enabled || length == 0 || length > MAX_CACHED_LENGTH)
+  {
+    return;
+  }
+  if (!m_entries)
+  {
+    // only allocated once something is measured
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+    m_entries = static_cast<Entry *>(heap_caps_calloc(SET_COUNT * 2, sizeof(Entry), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+#else
+    m_entries = static_cast<Entry *>(calloc(SET_COUNT * 2, sizeof(Entry)));
+#endif
+    if (!m_entries)
+    {
+      return;
+    }
+  }
+  uint32_t hash = hash_word(word, length, style);
+  if (find(word, length, style, hash))
+  {
+    return;
+  }
+  // the least recently used entry in the set makes way
+  Entry *set = m_entries + (hash % SET_COUNT) * 2;
+  set[1] = set[0];
+  set[0].hash = hash;
+  set[0].width = width;
+  set[0].length = length;
+  set[0].style = style;
+  memcpy(set[0].word, word, length);
+}
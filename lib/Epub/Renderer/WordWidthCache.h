@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Remembers how wide words are so laying out a section doesn't have to
+// measure "the" thousands of times - with FreeType every measurement loads
+// every glyph in the word. The cache is a fixed size table that lives as
+// long as the renderer so it carries over between sections and re-layouts.
+// It's keyed on the word and its style, and emptied whenever the font or
+// the font size changes.
+class WordWidthCache
+{
+public:
+  // longer words aren't worth caching - they're rare and they'd make
+  // every entry bigger
+  static const size_t MAX_CACHED_LENGTH = 22;
+  // number of sets - each set holds two 32 byte entries
+#if defined(BOARD_HAS_PSRAM) || defined(UNIT_TEST)
+  static const size_t SET_COUNT = 4096;
+#else
+  static const size_t SET_COUNT = 256;
+#endif
+
+private:
+  struct Entry
+  {
+    uint32_t hash;
+    uint16_t width;
+    // zero for an empty entry
+    uint8_t length;
+    uint8_t style;
+    char word[MAX_CACHED_LENGTH];
+  };
+  Entry *m_entries = nullptr;
+  uintptr_t m_font_id = 0;
+  int m_pixel_size = 0;
+  uint32_t m_hits = 0;
+  uint32_t m_misses = 0;
+  bool m_enabled = true;
+
+  Entry *find(const char *word, size_t length, uint8_t style, uint32_t hash);
+
+public:
+  ~WordWidthCache();
+  // empties the cache if the font has changed since it was last used
+  void set_font(uintptr_t font_id, int pixel_size);
+  // returns true and sets width if we've seen this word before
+  bool lookup(const char *word, uint8_t style, uint16_t &width);
+  void insert(const char *word, uint8_t style, uint16_t width);
+  void clear();
+  // for measuring how much the cache saves
+  void set_enabled(bool enabled) { m_enabled = enabled; }
+
+  uint32_t get_hits() const { return m_hits; }
+  uint32_t get_misses() const { return m_misses; }
+  void reset_stats()
+  {
+    m_hits = 0;
+    m_misses = 0;
+  }
+};
@@ -0,0 +1,92 @@
+#include <string.h>
+#include "HtmlTags.h"
+#include "PerfectHash.h"
+#include "htmlTagHash.h"
+
+#define TAG(name, id, behaviour) {name, id, behaviour}
+
+// If you change this table you need to regenerate htmlTagHash.h with:
+//   python3 scripts/generate_perfect_hash.py lib/Epub/RubbishHtmlParser/HtmlTags.cpp TAG TAG_HASH --ignore-case --buckets 16 --slots 128 > lib/Epub/RubbishHtmlParser/htmlTagHash.h
+// (the build fails if you forget). Names have to be lower case.
+static constexpr HtmlTag TAGS[] = {
+    TAG("h1", TAG_H1, TAG_HEADER),
+    TAG("h2", TAG_H2, TAG_HEADER),
+    TAG("h3", TAG_H3, TAG_HEADER),
+    TAG("h4", TAG_H4, TAG_HEADER),
+    TAG("h5", TAG_H5, TAG_HEADER),
+    TAG("h6", TAG_H6, TAG_HEADER),
+    TAG("p", TAG_P, TAG_BLOCK),
+    TAG("li", TAG_LI, TAG_BLOCK),
+    TAG("div", TAG_DIV, TAG_BLOCK),
+    TAG("br", TAG_BR, TAG_BLOCK | TAG_VOID),
+    TAG("blockquote", TAG_BLOCKQUOTE, TAG_BLOCK),
+    TAG("section", TAG_SECTION, TAG_BLOCK),
+    TAG("pre", TAG_PRE, TAG_BLOCK),
+    TAG("b", TAG_B, TAG_BOLD),
+    TAG("strong", TAG_STRONG, TAG_BOLD),
+    TAG("i", TAG_I, TAG_ITALIC),
+    TAG("em", TAG_EM, TAG_ITALIC),
+    TAG("span", TAG_SPAN, 0),
+    TAG("sup", TAG_SUP, 0),
+    TAG("img", TAG_IMG, TAG_IMAGE_SOURCE | TAG_VOID),
+    // svg images
+    TAG("image", TAG_IMAGE, TAG_IMAGE_SOURCE),
+    TAG("head", TAG_HEAD, TAG_SKIP),
+    TAG("table", TAG_TABLE, TAG_SKIP),
+    TAG("area", TAG_AREA, TAG_VOID),
+    TAG("base", TAG_BASE, TAG_VOID),
+    TAG("col", TAG_COL, TAG_VOID),
+    TAG("embed", TAG_EMBED, TAG_VOID),
+    TAG("hr", TAG_HR, TAG_VOID),
+    TAG("input", TAG_INPUT, TAG_VOID),
+    TAG("link", TAG_LINK, TAG_VOID),
+    TAG("meta", TAG_META, TAG_VOID),
+    TAG("param", TAG_PARAM, TAG_VOID),
+    TAG("source", TAG_SOURCE, TAG_VOID),
+    TAG("track", TAG_TRACK, TAG_VOID),
+    TAG("wbr", TAG_WBR, TAG_VOID),
+};
+static constexpr int NUM_TAGS = sizeof(TAGS) / sizeof(TAGS[0]);
+
+static constexpr HtmlTag UNKNOWN_TAG = TAG("", TAG_UNKNOWN, 0);
+
+static constexpr size_t name_length(const char *name)
+{
+  return *name ? 1 + name_length(name + 1) : 0;
+}
+
+static constexpr uint32_t tag_slot(const char *name, size_t length)
+{
+  return perfect_hash_slot(TAG_HASH_SEEDS, TAG_HASH_BUCKETS, TAG_HASH_SLOTS, name, length, true);
+}
+
+// check every tag lands in its own slot
+static constexpr bool tags_hashed(int start, int end)
+{
+  return end - start == 1
+             ? TAG_HASH_SLOT_INDEX[tag_slot(TAGS[start].name, name_length(TAGS[start].name))] == start
+             : tags_hashed(start, (start + end) / 2) && tags_hashed((start + end) / 2, end);
+}
+
+static_assert(NUM_TAGS < TAG_HASH_EMPTY, "Too many tags for the hash slot index");
+static_assert(tags_hashed(0, NUM_TAGS), "htmlTagHash.h is out of date - regenerate it");
+
+const HtmlTag &classify_tag(const char *tag_name)
+{
+  size_t length = strlen(tag_name);
+  uint8_t index = TAG_HASH_SLOT_INDEX[tag_slot(tag_name, length)];
+  if (index == TAG_HASH_EMPTY)
+  {
+    return UNKNOWN_TAG;
+  }
+  const HtmlTag &tag = TAGS[index];
+  // the table is lower case so only need to lower case the name
+  for (size_t i = 0; i <= length; i++)
+  {
+    if (static_cast<char>(perfect_hash_char(tag_name[i], true)) != tag.name[i])
+    {
+      return UNKNOWN_TAG;
+    }
+  }
+  return tag;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdint.h>
+
+// the tags the parser knows about
+typedef enum
+{
+  TAG_UNKNOWN = 0,
+  TAG_H1,
+  TAG_H2,
+  TAG_H3,
+  TAG_H4,
+  TAG_H5,
+  TAG_H6,
+  TAG_P,
+  TAG_LI,
+  TAG_DIV,
+  TAG_BR,
+  TAG_BLOCKQUOTE,
+  TAG_SECTION,
+  TAG_PRE,
+  TAG_B,
+  TAG_STRONG,
+  TAG_I,
+  TAG_EM,
+  TAG_SPAN,
+  TAG_SUP,
+  TAG_IMG,
+  TAG_IMAGE,
+  TAG_HEAD,
+  TAG_TABLE,
+  TAG_AREA,
+  TAG_BASE,
+  TAG_COL,
+  TAG_EMBED,
+  TAG_HR,
+  TAG_INPUT,
+  TAG_LINK,
+  TAG_META,
+  TAG_PARAM,
+  TAG_SOURCE,
+  TAG_TRACK,
+  TAG_WBR,
+} HTML_TAG;
+
+// what the parser should do with a tag - a tag can have more than one
+typedef enum
+{
+  TAG_HEADER = 1,
+  TAG_BLOCK = 2,
+  TAG_BOLD = 4,
+  TAG_ITALIC = 8,
+  TAG_IMAGE_SOURCE = 16,
+  TAG_SKIP = 32,
+  // never has any contents or an end tag
+  TAG_VOID = 64,
+} TAG_BEHAVIOUR;
+
+typedef struct
+{
+  const char *name;
+  HTML_TAG id;
+  uint8_t behaviour;
+} HtmlTag;
+
+// case insensitive - unknown tags come back as TAG_UNKNOWN with no behaviour
+const HtmlTag &classify_tag(const char *tag_name);
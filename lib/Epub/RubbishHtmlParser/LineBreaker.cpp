@@ -0,0 +1,453 @@
+#include "LineBreaker.h"
+#ifndef UNIT_TEST
+#include <esp_log.h>
+#else
+#define ESP_LOGE(args...)
+#endif
+
+// as bad as a line can be without being too long
+static const int INFINITE_BADNESS = 10000;
+// what every line costs - so fewer lines are better
+static const int LINE_COST = 10;
+// two hyphens in a row
+static const int64_t FLAGGED_DEMERITS = 10000;
+// a tight line next to a loose one
+static const int64_t FITNESS_DEMERITS = 10000;
+// a line that's too long because nothing else fitted
+static const int64_t OVERFULL_DEMERITS = 100000000;
+// how bad a line can be on the first try - TeX's default. If there's no way
+// to break the paragraph without a worse line we try again with no limit.
+static const int TOLERANCE = 200;
+static const uint8_t DECENT_FIT = 1;
+static const int FITNESS_CLASSES = 4;
+
+// how bad a line is when its glue has to stretch or shrink by t and it can
+// take s - TeX's approximation of 100 * (t / s) ^ 3 without any floating point
+static int badness(int t, int s)
+{
+  if (t == 0)
+  {
+    return 0;
+  }
+  if (s <= 0)
+  {
+    return INFINITE_BADNESS;
+  }
+  int r;
+  if (t <= 7230584)
+  {
+    r = (t * 297) / s;
+  }
+  else if (s >= 1663497)
+  {
+    r = t / (s / 297);
+  }
+  else
+  {
+    r = t;
+  }
+  if (r > 1290)
+  {
+    return INFINITE_BADNESS;
+  }
+  return (r * r * r + 0x20000) >> 18;
+}
+
+void LineBreaker::start()
+{
+  m_items.resize(0);
+  m_breaks.resize(0);
+  m_out_of_memory = false;
+}
+
+bool LineBreaker::add_item(int type, int width, int stretch, int shrink, int penalty, bool flagged, uint32_t data)
+{
+  LineItem item = {width, static_cast<int16_t>(stretch), static_cast<int16_t>(shrink), static_cast<int16_t>(penalty), static_cast<uint8_t>(type), flagged, data};
+  if (!m_items.push_back(item))
+  {
+    m_out_of_memory = true;
+    return false;
+  }
+  return true;
+}
+
+void LineBreaker::remove_active(uint32_t index)
+{
+  // the order doesn't matter
+  m_active[index] = m_active[m_active.size() - 1];
+  m_active.resize(m_active.size() - 1);
+}
+
+// drop the breaks with the worst lines on average until the window is small
+// enough again - the start of the paragraph has no lines so it's never one
+void LineBreaker::limit_active()
+{
+  while (m_active.size() > MAX_ACTIVE_NODES)
+  {
+    int32_t worst = -1;
+    for (uint32_t a = 0; a < m_active.size(); a++)
+    {
+      const BreakNode &node = m_nodes[m_active[a]];
+      if (node.line == 0)
+      {
+        continue;
+      }
+      if (worst < 0 || node.demerits * m_nodes[m_active[worst]].line > m_nodes[m_active[worst]].demerits * node.line)
+      {
+        worst = a;
+      }
+    }
+    if (worst < 0)
+    {
+      return;
+    }
+    remove_active(worst);
+  }
+}
+
+bool LineBreaker::compact_nodes()
+{
+  if (!m_node_map.resize(m_nodes.size()))
+  {
+    m_out_of_memory = true;
+    return false;
+  }
+  for (uint32_t n = 0; n < m_nodes.size(); n++)
+  {
+    m_node_map[n] = -1;
+  }
+  // mark everything on the way back from each active node
+  for (uint32_t a = 0; a < m_active.size(); a++)
+  {
+    for (int32_t n = m_active[a]; n >= 0 && m_node_map[n] < 0; n = m_nodes[n].previous)
+    {
+      m_node_map[n] = 0;
+    }
+  }
+  // a node always comes after the one before it so the kept ones can be
+  // moved down in order
+  uint32_t kept = 0;
+  for (uint32_t n = 0; n < m_nodes.size(); n++)
+  {
+    if (m_node_map[n] < 0)
+    {
+      continue;
+    }
+    BreakNode node = m_nodes[n];
+    if (node.previous >= 0)
+    {
+      node.previous = m_node_map[node.previous];
+    }
+    m_node_map[n] = kept;
+    m_nodes[kept++] = node;
+  }
+  m_nodes.resize(kept);
+  for (uint32_t a = 0; a < m_active.size(); a++)
+  {
+    m_active[a] = m_node_map[m_active[a]];
+  }
+  // not worth carrying on if we'd be back here after a few more breaks
+  return kept <= MAX_NODES - MAX_NODES / 4;
+}
+
+void LineBreaker::next_line_start(uint32_t position, int32_t &total_width, int32_t &total_stretch, int32_t &total_shrink)
+{
+  // the next line starts after any glue following the break
+  total_width = m_width;
+  total_stretch = m_stretch;
+  total_shrink = m_shrink;
+  for (uint32_t i = position; i < m_items.size(); i++)
+  {
+    const LineItem &next = m_items[i];
+    if (next.type == LINE_BOX || (next.type == LINE_PENALTY && next.penalty <= -INFINITE_PENALTY && i > position))
+    {
+      break;
+    }
+    if (next.type == LINE_GLUE)
+    {
+      total_width += next.width;
+      total_stretch += next.stretch;
+      total_shrink += next.shrink;
+    }
+  }
+}
+
+void LineBreaker::try_break(uint32_t position, int line_width, int tolerance)
+{
+  if (m_nodes.size() + FITNESS_CLASSES > MAX_NODES && !compact_nodes())
+  {
+    m_too_many_nodes = true;
+    return;
+  }
+  const LineItem &item = m_items[position];
+  bool forced = item.type == LINE_PENALTY && item.penalty <= -INFINITE_PENALTY;
+  int break_width = item.type == LINE_PENALTY ? item.width : 0;
+  // the best way of getting here for each fitness class
+  int64_t best[FITNESS_CLASSES];
+  int32_t best_node[FITNESS_CLASSES];
+  for (int f = 0; f < FITNESS_CLASSES; f++)
+  {
+    best[f] = INT64_MAX;
+    best_node[f] = -1;
+  }
+  int64_t least = INT64_MAX;
+  // the break that would leave the shortest line that's too long
+  int32_t overfull = -1;
+  uint32_t a = 0;
+  while (a < m_active.size())
+  {
+    const BreakNode &node = m_nodes[m_active[a]];
+    int length = m_width - node.total_width + break_width;
+    bool fits = true;
+    int line_badness = 0;
+    uint8_t fitness = DECENT_FIT;
+    if (length < line_width && !forced)
+    {
+      // the last line doesn't have to be full
+      line_badness = badness(line_width - length, m_stretch - node.total_stretch);
+      fitness = line_badness > 99 ? 3 : line_badness > 12 ? 2 : DECENT_FIT;
+    }
+    else if (length > line_width)
+    {
+      int shrink = m_shrink - node.total_shrink;
+      fits = length - line_width <= shrink;
+      line_badness = fits ? badness(length - line_width, shrink) : INFINITE_BADNESS;
+      fitness = line_badness > 12 ? 0 : DECENT_FIT;
+    }
+    if (fits && line_badness <= tolerance)
+    {
+      int64_t demerits = LINE_COST + line_badness;
+      demerits *= demerits;
+      if (item.type == LINE_PENALTY && item.penalty > -INFINITE_PENALTY)
+      {
+        int64_t penalty = static_cast<int64_t>(item.penalty) * item.penalty;
+        demerits += item.penalty > 0 ? penalty : -penalty;
+      }
+      if (item.flagged && node.flagged)
+      {
+        demerits += FLAGGED_DEMERITS;
+      }
+      if ((fitness > node.fitness ? fitness - node.fitness : node.fitness - fitness) > 1)
+      {
+        demerits += FITNESS_DEMERITS;
+      }
+      demerits += node.demerits;
+      if (demerits < best[fitness])
+      {
+        best[fitness] = demerits;
+        best_node[fitness] = m_active[a];
+        least = demerits < least ? demerits : least;
+      }
+    }
+    else if (!fits && (overfull < 0 || node.position > m_nodes[overfull].position))
+    {
+      overfull = m_active[a];
+    }
+    // a line that's already too long only gets longer, and nothing can
+    // carry on past a forced break
+    if (!fits || forced)
+    {
+      remove_active(a);
+    }
+    else
+    {
+      a++;
+    }
+  }
+  if (least == INT64_MAX && m_active.size() == 0 && overfull >= 0 && tolerance >= INFINITE_BADNESS)
+  {
+    // nothing fits - let the line run over rather than lose the text
+    best[DECENT_FIT] = m_nodes[overfull].demerits + OVERFULL_DEMERITS;
+    best_node[DECENT_FIT] = overfull;
+    least = best[DECENT_FIT];
+  }
+  if (least == INT64_MAX)
+  {
+    return;
+  }
+  int32_t total_width, total_stretch, total_shrink;
+  next_line_start(position, total_width, total_stretch, total_shrink);
+  // keep a break for each fitness class that's close to the best, as a
+  // worse line here can mean better ones after it
+  for (int f = 0; f < FITNESS_CLASSES; f++)
+  {
+    if (best_node[f] < 0 || best[f] > least + FITNESS_DEMERITS)
+    {
+      continue;
+    }
+    BreakNode node = {position, best_node[f], total_width, total_stretch, total_shrink, best[f],
+                      static_cast<uint16_t>(m_nodes[best_node[f]].line + 1), static_cast<uint8_t>(f), item.flagged};
+    if (!m_nodes.push_back(node) || !m_active.push_back(m_nodes.size() - 1))
+    {
+      m_out_of_memory = true;
+      return;
+    }
+  }
+  limit_active();
+}
+
+bool LineBreaker::find_breaks(int line_width, int tolerance)
+{
+  m_nodes.resize(0);
+  m_active.resize(0);
+  m_too_many_nodes = false;
+  m_width = 0;
+  m_stretch = 0;
+  m_shrink = 0;
+  BreakNode start = {0, -1, 0, 0, 0, 0, 0, DECENT_FIT, false};
+  if (!m_nodes.push_back(start) || !m_active.push_back(0))
+  {
+    m_out_of_memory = true;
+    return false;
+  }
+  // once nothing is active there's no way of getting any further
+  for (uint32_t i = 0; i < m_items.size() && m_active.size() > 0 && !m_out_of_memory && !m_too_many_nodes; i++)
+  {
+    const LineItem &item = m_items[i];
+    if (item.type == LINE_BOX)
+    {
+      m_width += item.width;
+    }
+    else if (item.type == LINE_GLUE)
+    {
+      if (i > 0 && m_items[i - 1].type == LINE_BOX)
+      {
+        try_break(i, line_width, tolerance);
+      }
+      m_width += item.width;
+      m_stretch += item.stretch;
+      m_shrink += item.shrink;
+    }
+    else if (item.penalty < INFINITE_PENALTY)
+    {
+      try_break(i, line_width, tolerance);
+    }
+  }
+  if (m_out_of_memory || m_too_many_nodes)
+  {
+    return false;
+  }
+  // the best of the breaks at the end of the paragraph
+  int32_t best = -1;
+  for (int32_t n = m_nodes.size() - 1; n > 0 && m_nodes[n].position == m_items.size() - 1; n--)
+  {
+    if (best < 0 || m_nodes[n].demerits < m_nodes[best].demerits)
+    {
+      best = n;
+    }
+  }
+  if (best < 0)
+  {
+    return false;
+  }
+  if (!m_breaks.resize(m_nodes[best].line))
+  {
+    m_out_of_memory = true;
+    return false;
+  }
+  for (int32_t n = best; n > 0; n = m_nodes[n].previous)
+  {
+    m_breaks[m_nodes[n].line - 1] = m_nodes[n].position;
+  }
+  return true;
+}
+
+bool LineBreaker::greedy_breaks(int line_width)
+{
+  m_breaks.resize(0);
+  m_width = 0;
+  m_stretch = 0;
+  m_shrink = 0;
+  int32_t line_start = 0;
+  // the last place the line could end without being too long, and where the
+  // line after it would start
+  int32_t candidate = -1;
+  int32_t candidate_next = 0;
+  int32_t unused_stretch, unused_shrink;
+  for (uint32_t i = 0; i < m_items.size(); i++)
+  {
+    const LineItem &item = m_items[i];
+    bool can_break = item.type == LINE_GLUE ? i > 0 && m_items[i - 1].type == LINE_BOX
+                                            : item.type == LINE_PENALTY && item.penalty < INFINITE_PENALTY;
+    if (can_break)
+    {
+      int32_t break_width = item.type == LINE_PENALTY ? item.width : 0;
+      if (m_width - line_start + break_width > line_width && candidate >= 0)
+      {
+        if (!m_breaks.push_back(candidate))
+        {
+          m_out_of_memory = true;
+          return false;
+        }
+        line_start = candidate_next;
+        candidate = -1;
+      }
+      if (item.type == LINE_PENALTY && item.penalty <= -INFINITE_PENALTY)
+      {
+        if (!m_breaks.push_back(i))
+        {
+          m_out_of_memory = true;
+          return false;
+        }
+        next_line_start(i, line_start, unused_stretch, unused_shrink);
+        candidate = -1;
+      }
+      else if (m_width - line_start + break_width <= line_width || candidate < 0)
+      {
+        // a word that's wider than the line still has to go somewhere
+        candidate = i;
+        next_line_start(i, candidate_next, unused_stretch, unused_shrink);
+      }
+    }
+    if (item.type != LINE_PENALTY)
+    {
+      m_width += item.width;
+    }
+  }
+  return true;
+}
+
+bool LineBreaker::break_lines(int line_width)
+{
+  m_breaks.resize(0);
+  if (m_out_of_memory)
+  {
+    return false;
+  }
+  if (m_items.size() == 0)
+  {
+    return true;
+  }
+  const LineItem &last = m_items[m_items.size() - 1];
+  if ((last.type != LINE_PENALTY || last.penalty > -INFINITE_PENALTY) && !add_penalty(0, -INFINITE_PENALTY, false, last.data))
+  {
+    return false;
+  }
+  bool ok = find_breaks(line_width, TOLERANCE) ||
+            (!m_out_of_memory && !m_too_many_nodes && find_breaks(line_width, INFINITE_BADNESS));
+  if (!ok && m_too_many_nodes && !m_out_of_memory)
+  {
+    // too long a paragraph to keep track of every way of breaking it
+    ok = greedy_breaks(line_width);
+  }
+  if (!ok)
+  {
+    ESP_LOGE("LineBreaker", "Failed to break lines");
+    return false;
+  }
+  return true;
+}
+
+void LineBreaker::free_memory()
+{
+  m_items.resize(0);
+  m_nodes.resize(0);
+  m_active.resize(0);
+  m_node_map.resize(0);
+  m_breaks.resize(0);
+  m_items.shrink_to_fit();
+  m_nodes.shrink_to_fit();
+  m_active.shrink_to_fit();
+  m_node_map.shrink_to_fit();
+  m_breaks.shrink_to_fit();
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <stdint.h>
+#include "SectionWords.h"
+
+typedef enum
+{
+  LINE_BOX = 0,
+  LINE_GLUE = 1,
+  LINE_PENALTY = 2,
+} LINE_ITEM_TYPE;
+
+// One thing in a paragraph - a box is something that has to be drawn (a word
+// or a piece of one), glue is a space that can stretch or shrink and can be
+// broken at if it comes after a box, and a penalty is somewhere else the line
+// can break (like a hyphen) and what it costs to break there.
+struct LineItem
+{
+  int32_t width;
+  int16_t stretch;
+  int16_t shrink;
+  int16_t penalty;
+  uint8_t type;
+  // two flagged breaks in a row are worse than one - used for hyphens
+  bool flagged;
+  // for the caller to find what the line ended with
+  uint32_t data;
+};
+
+// Breaks a paragraph into lines with Knuth and Plass's total fit algorithm,
+// so the breaks are the ones that make the whole paragraph look best rather
+// than each line in turn. The arrays are kept from one paragraph to the next
+// so a section can be laid out without allocating for every block.
+class LineBreaker
+{
+public:
+  // a penalty this big never breaks and minus this always breaks
+  static const int INFINITE_PENALTY = 10000;
+  // the most breaks we keep looking back to - the least promising ones go
+  // first if a line has more places it could start than this
+  static const uint32_t MAX_ACTIVE_NODES = 64;
+  // the most breaks we keep at all - the ones no line can start from any more
+  // are thrown away first, and if that isn't enough the paragraph is just
+  // filled a line at a time
+  static const uint32_t MAX_NODES = 1024;
+
+private:
+  // a place we can break and the best way of getting there
+  struct BreakNode
+  {
+    uint32_t position;
+    // the break before it, or -1 at the start of the paragraph
+    int32_t previous;
+    // the sums of everything before the next line starts
+    int32_t total_width;
+    int32_t total_stretch;
+    int32_t total_shrink;
+    int64_t demerits;
+    uint16_t line;
+    // tight, decent, loose or very loose
+    uint8_t fitness;
+    bool flagged;
+  };
+
+  SectionArray<LineItem> m_items;
+  SectionArray<BreakNode> m_nodes;
+  // indexes of the nodes lines can still start from
+  SectionArray<uint32_t> m_active;
+  // where each node moves to when the unreachable ones are thrown away
+  SectionArray<int32_t> m_node_map;
+  // the item each line ends with
+  SectionArray<uint32_t> m_breaks;
+  bool m_out_of_memory = false;
+  bool m_too_many_nodes = false;
+  // the sums of all the items before the one we're looking at
+  int32_t m_width = 0;
+  int32_t m_stretch = 0;
+  int32_t m_shrink = 0;
+
+  bool add_item(int type, int width, int stretch, int shrink, int penalty, bool flagged, uint32_t data);
+  void try_break(uint32_t position, int line_width, int tolerance);
+  // one pass over the paragraph only making lines up to tolerance bad -
+  // false if that isn't possible
+  bool find_breaks(int line_width, int tolerance);
+  void remove_active(uint32_t index);
+  void limit_active();
+  // throw away the nodes that no active node leads back to - false if
+  // that doesn't leave plenty of room for more
+  bool compact_nodes();
+  // the sums at the start of the line after a break at position
+  void next_line_start(uint32_t position, int32_t &total_width, int32_t &total_stretch, int32_t &total_shrink);
+  // fill each line as full as it will go
+  bool greedy_breaks(int line_width);
+
+public:
+  // start a new paragraph
+  void start();
+  bool add_box(int width, uint32_t data)
+  {
+    return add_item(LINE_BOX, width, 0, 0, 0, false, data);
+  }
+  bool add_glue(int width, int stretch, int shrink, uint32_t data)
+  {
+    return add_item(LINE_GLUE, width, stretch, shrink, 0, false, data);
+  }
+  bool add_penalty(int width, int penalty, bool flagged, uint32_t data)
+  {
+    return add_item(LINE_PENALTY, width, 0, 0, penalty, flagged, data);
+  }
+  // finds the best breaks for lines line_width wide - the paragraph should
+  // end with a forced break. Returns false if we ran out of memory.
+  bool break_lines(int line_width);
+  int get_line_count() const
+  {
+    return m_breaks.size();
+  }
+  // the glue or penalty that a line ends at
+  const LineItem &get_line_end(int line) const
+  {
+    return m_items[m_breaks[line]];
+  }
+  // give back the memory once there's nothing left to lay out
+  void free_memory();
+};
@@ -1,71 +1,34 @@
 #pragma once
 
-#include "blocks/TextBlock.h"
-#include "blocks/ImageBlock.h"
+#include <stdint.h>
 
-// represents something that has been added to a page
-class PageElement
+// something that has been placed on a page - either a line from a text block
+// or an image block. Pages are just runs of these in one array.
+struct PageElement
 {
-public:
-  int y_pos;
-  PageElement(int y_pos) : y_pos(y_pos) {}
-  virtual ~PageElement() {}
-  virtual void render(Renderer *renderer, Epub *epub) = 0;
+  // index into the section's blocks
+  uint32_t block_index;
+  // the line within a text block - unused for images
+  uint16_t line_index;
+  int16_t y_pos;
 };
 
-// a line from a block element
-class PageLine : public PageElement
+// where a page starts in the section - enough to start laying out from that
+// page without laying out the ones before it
+struct PagePosition
 {
-public:
-  // the block the line comes from
-  TextBlock *block;
-  // the line break index
-  int line_break_index;
-
-  PageLine(TextBlock *block, int line_break_index, int y_pos)
-      : PageElement(y_pos), block(block), line_break_index(line_break_index)
-  {
-  }
-  void render(Renderer *renderer, Epub *epub)
-  {
-    block->render(renderer, line_break_index, 0, y_pos);
-  }
-};
-
-// an image
-class PageImage : public PageElement
-{
-public:
-  // the block the image comes from
-  ImageBlock *block;
-
-  PageImage(ImageBlock *block, int y_pos) : PageElement(y_pos), block(block)
-  {
-  }
-  void render(Renderer *renderer, Epub *epub)
-  {
-    block->render(renderer, epub, y_pos);
-  }
+  uint32_t block_index;
+  // the first line of the block on the page
+  uint16_t line_index;
+  // images seen before this block - only so many get laid out in a section
+  uint16_t images;
 };
 
-// a layed out page ready to be rendered
-class Page
+// where a page starts in terms of the text rather than the lines, so it can
+// be found again after the lines have been broken differently
+struct TextPosition
 {
-public:
-  // the list of block index and line numbers on this page
-  std::vector<PageElement *> elements;
-  void render(Renderer *renderer, Epub *epub)
-  {
-    for (auto element : elements)
-    {
-      element->render(renderer, epub);
-    }
-  }
-  ~Page()
-  {
-    for (auto element : elements)
-    {
-      delete element;
-    }
-  }
+  uint32_t block_index;
+  // the word the first line of the page starts with, or part way through
+  uint32_t word_index;
 };
@@ -0,0 +1,145 @@
+#ifndef UNIT_TEST
+#include <esp_log.h>
+#else
+#define ESP_LOGE(args...)
+#define ESP_LOGI(args...)
+#endif
+#include "PageCache.h"
+#include "../Renderer/Renderer.h"
+
+static const char *TAG = "PAGES";
+
+static const uint32_t PAGE_CACHE_MAGIC = 0x53474150; // 'PAGS'
+static const uint16_t PAGE_CACHE_VERSION = 3;
+static const char *PAGE_CACHE_EXTENSION = "PGS";
+// tables are only ever added so start again once the file gets this big
+static const size_t PAGE_CACHE_MAX_SIZE = 256 * 1024;
+
+// each table in the sidecar starts with one of these
+struct PageCacheRecord
+{
+  uint32_t key;
+  uint16_t section;
+  uint16_t reserved;
+  uint32_t page_count;
+};
+
+static uint32_t hash_int(uint32_t hash, int32_t value)
+{
+  const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+  for (size_t i = 0; i < sizeof(value); i++)
+  {
+    hash = (hash ^ bytes[i]) * 16777619u;
+  }
+  return hash;
+}
+
+uint32_t PageCache::layout_key(Renderer *renderer)
+{
+  // the font id is only good until we restart, so the font is identified by
+  // its size and how wide it draws some sample text in each style
+  static const char *SAMPLE = "Hamburgefonstiv";
+  uint32_t hash = 2166136261u;
+  hash = hash_int(hash, renderer->get_font_pixel_size());
+  hash = hash_int(hash, renderer->get_text_width(SAMPLE, false, false));
+  hash = hash_int(hash, renderer->get_text_width(SAMPLE, true, false));
+  hash = hash_int(hash, renderer->get_text_width(SAMPLE, false, true));
+  hash = hash_int(hash, renderer->get_space_width());
+  // includes the line spacing
+  hash = hash_int(hash, renderer->get_line_height());
+  hash = hash_int(hash, renderer->get_margin_top());
+  hash = hash_int(hash, renderer->get_margin_bottom());
+  hash = hash_int(hash, renderer->get_margin_left());
+  hash = hash_int(hash, renderer->get_margin_right());
+  hash = hash_int(hash, renderer->get_page_width());
+  hash = hash_int(hash, renderer->get_page_height());
+  return hash;
+}
+
+bool PageCache::load(uint16_t section, uint32_t key, std::vector<PagePosition> &pages)
+{
+  File fp = m_cache.open_read(PAGE_CACHE_EXTENSION, PAGE_CACHE_MAGIC, PAGE_CACHE_VERSION);
+  if (!fp)
+  {
+    return false;
+  }
+  size_t file_size = fp.size();
+  size_t offset = fp.position();
+  // tables are appended as they're made, so the last matching one wins
+  size_t found_offset = 0;
+  uint32_t found_count = 0;
+  bool damaged = false;
+  PageCacheRecord record;
+  while (offset < file_size)
+  {
+    if (offset + sizeof(record) > file_size ||
+        !fp.seek(offset) ||
+        fp.read((uint8_t *)&record, sizeof(record)) != sizeof(record) ||
+        record.page_count > (file_size - offset - sizeof(record)) / sizeof(PagePosition))
+    {
+      // most likely cut short by losing power part way through a save
+      damaged = true;
+      break;
+    }
+    size_t table_size = record.page_count * sizeof(PagePosition);
+    if (record.key == key && record.section == section)
+    {
+      found_offset = offset + sizeof(record);
+      found_count = record.page_count;
+    }
+    offset += sizeof(record) + table_size;
+  }
+  bool ok = false;
+  if (found_count > 0)
+  {
+    pages.resize(found_count);
+    size_t table_size = found_count * sizeof(PagePosition);
+    ok = fp.seek(found_offset) && fp.read((uint8_t *)pages.data(), table_size) == table_size;
+  }
+  fp.close();
+  if (!ok)
+  {
+    pages.clear();
+  }
+  if (damaged)
+  {
+    ESP_LOGI(TAG, "Discarding damaged page cache");
+    m_cache.remove(PAGE_CACHE_EXTENSION);
+  }
+  return ok;
+}
+
+bool PageCache::save(uint16_t section, uint32_t key, const std::vector<PagePosition> &pages)
+{
+  if (pages.empty())
+  {
+    return false;
+  }
+  File fp = m_cache.open_read(PAGE_CACHE_EXTENSION, PAGE_CACHE_MAGIC, PAGE_CACHE_VERSION);
+  if (fp)
+  {
+    size_t file_size = fp.size();
+    fp.close();
+    if (file_size > PAGE_CACHE_MAX_SIZE)
+    {
+      ESP_LOGI(TAG, "Page cache full - starting again");
+      m_cache.remove(PAGE_CACHE_EXTENSION);
+    }
+  }
+  fp = m_cache.open_append(PAGE_CACHE_EXTENSION, PAGE_CACHE_MAGIC, PAGE_CACHE_VERSION);
+  if (!fp)
+  {
+    return false;
+  }
+  PageCacheRecord record = {key, section, 0, static_cast<uint32_t>(pages.size())};
+  size_t table_size = pages.size() * sizeof(PagePosition);
+  bool ok = fp.write((const uint8_t *)&record, sizeof(record)) == sizeof(record) &&
+            fp.write((const uint8_t *)pages.data(), table_size) == table_size;
+  fp.close();
+  if (!ok)
+  {
+    ESP_LOGE(TAG, "Failed to save page table for section %d", section);
+    m_cache.remove(PAGE_CACHE_EXTENSION);
+  }
+  return ok;
+}
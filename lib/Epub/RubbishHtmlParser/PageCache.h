@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "../BookCache/BookCache.h"
+#include "Page.h"
+
+class Renderer;
+
+// Where every page of a section starts, saved in a sidecar so that opening
+// a section we've seen before can go straight to the page the reader was on
+// without laying out all the pages before it. Page tables only make sense
+// for the settings they were laid out with, so each one is saved against a
+// key made from everything that changes where the pages break.
+class PageCache
+{
+private:
+  BookCache m_cache;
+
+public:
+  PageCache(const BookCache &cache) : m_cache(cache) {}
+  // the font, its size, the line spacing, the margins and the page size all
+  // rolled into one number - justifying paragraphs doesn't move the page
+  // breaks so it isn't part of it
+  static uint32_t layout_key(Renderer *renderer);
+  bool load(uint16_t section, uint32_t key, std::vector<PagePosition> &pages);
+  bool save(uint16_t section, uint32_t key, const std::vector<PagePosition> &pages);
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// The hash used by the tables that scripts/generate_perfect_hash.py makes.
+// Everything is constexpr so the tables can be checked when compiling.
+
+constexpr uint32_t perfect_hash_char(char c, bool ignore_case)
+{
+  return ignore_case && c >= 'A' && c <= 'Z' ? static_cast<uint32_t>(c - 'A' + 'a') : static_cast<unsigned char>(c);
+}
+
+// FNV-1a - the seed picks one of a family of hash functions
+constexpr uint32_t perfect_hash(uint32_t hash, const char *name, size_t length, bool ignore_case)
+{
+  return length == 0 ? hash : perfect_hash((hash ^ perfect_hash_char(*name, ignore_case)) * 16777619u, name + 1, length - 1, ignore_case);
+}
+
+constexpr uint32_t perfect_hash_seed(uint32_t seed)
+{
+  return 2166136261u ^ (seed * 0x9E3779B9u);
+}
+
+// Two level perfect hash - the first hash picks a bucket and each bucket has
+// its own seed for the second hash which gives a slot that nothing else uses
+constexpr uint32_t perfect_hash_slot(const uint8_t *seeds, uint32_t buckets, uint32_t slots, const char *name, size_t length, bool ignore_case)
+{
+  return perfect_hash(perfect_hash_seed(seeds[perfect_hash(perfect_hash_seed(0), name, length, ignore_case) % buckets]), name, length, ignore_case) % slots;
+}
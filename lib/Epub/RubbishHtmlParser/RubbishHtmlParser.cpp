@@ -10,14 +10,17 @@
 #include <stdio.h>
 #include <string.h>
 #include <string>
-#include <list>
 #include <vector>
-#include <functional>
 #include <exception>
 #include <ctype.h>
+#include <limits.h>
+#include <algorithm>
 #include "../ZipFile/ZipFile.h"
 #include "../Renderer/Renderer.h"
 #include "htmlEntities.h"
+#include "HtmlTags.h"
+#include "../Css/CssParser.h"
+#include "../Css/CssStyleTable.h"
 #include "blocks/TextBlock.h"
 #include "blocks/ImageBlock.h"
 #include "Page.h"
@@ -26,230 +29,226 @@
 
 static const char *TAG = "HTML";
 
-const char *HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
-const int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
-
-const char *BLOCK_TAGS[] = {"p", "li", "div", "br"};
-const int NUM_BLOCK_TAGS = sizeof(BLOCK_TAGS) / sizeof(BLOCK_TAGS[0]);
-
-const char *BOLD_TAGS[] = {"b", "strong"};
-const int NUM_BOLD_TAGS = sizeof(BOLD_TAGS) / sizeof(BOLD_TAGS[0]);
-
-const char *ITALIC_TAGS[] = {"i", "em"};
-const int NUM_ITALIC_TAGS = sizeof(ITALIC_TAGS) / sizeof(ITALIC_TAGS[0]);
+RubbishHtmlParser::RubbishHtmlParser(const char *html, int length, const std::string &base_path, bool justify_paragraphs, const CssStyleTable *styles)
+    : m_styles(styles), m_justify_paragraphs(justify_paragraphs)
+{
+  m_base_path = base_path;
+  parse(html, length);
+}
 
-const char *IMAGE_TAGS[] = {"img", "image"};  // "image" for SVG
-const int NUM_IMAGE_TAGS = sizeof(IMAGE_TAGS) / sizeof(IMAGE_TAGS[0]);
+RubbishHtmlParser::RubbishHtmlParser(ZipEntryStream *stream, const std::string &base_path, bool justify_paragraphs, const CssStyleTable *styles)
+    : m_styles(styles), m_justify_paragraphs(justify_paragraphs)
+{
+  m_base_path = base_path;
+  parse(stream);
+}
 
-const char *SKIP_TAGS[] = {"head", "table"};
-const int NUM_SKIP_TAGS = sizeof(SKIP_TAGS) / sizeof(SKIP_TAGS[0]);
+RubbishHtmlParser::RubbishHtmlParser(const std::string &base_path, bool justify_paragraphs, const CssStyleTable *styles)
+    : m_styles(styles), m_justify_paragraphs(justify_paragraphs)
+{
+  m_base_path = base_path;
+}
 
-// given the start and end of a tag, check to see if it matches a known tag
-bool matches(const char *tag_name, const char *possible_tags[], int possible_tag_count)
+RubbishHtmlParser::~RubbishHtmlParser()
 {
-  for (int i = 0; i < possible_tag_count; i++)
+  // stopped part way through parsing
+  delete m_tokenizer;
+  delete m_parse_stream;
+  // the arena frees the memory but the blocks still have things to clean up
+  for (auto block : blocks)
   {
-    if (strcmp(tag_name, possible_tags[i]) == 0)
-    {
-      return true;
-    }
+    block->~Block();
   }
-  return false;
 }
 
-BLOCK_STYLE parse_text_align_from_style(const char *style_attr, BLOCK_STYLE default_style, bool treat_justify_as_justified)
+// paragraphs are justified or not depending on the reader's setting unless
+// the book asks for something else
+static bool follows_justification(int text_align)
 {
-  if (!style_attr)
-  {
-    return default_style;
-  }
-  std::string s(style_attr);
-  for (size_t i = 0; i < s.size(); i++)
-  {
-    s[i] = tolower(static_cast<unsigned char>(s[i]));
-  }
-  size_t pos = s.find("text-align");
-  if (pos == std::string::npos)
-  {
-    return default_style;
-  }
-  size_t colon = s.find(':', pos);
-  if (colon == std::string::npos)
-  {
-    return default_style;
-  }
-  size_t start = colon + 1;
-  while (start < s.size() && (s[start] == ' ' || s[start] == '\t'))
-  {
-    start++;
-  }
-  size_t end = start;
-  while (end < s.size() && s[end] != ';')
-  {
-    end++;
-  }
-  std::string value = s.substr(start, end - start);
-  while (!value.empty() && (value.back() == ' ' || value.back() == '\t'))
-  {
-    value.pop_back();
-  }
-  if (value == "left")
+  return text_align != CSS_ALIGN_RIGHT && text_align != CSS_ALIGN_CENTER && text_align != CSS_ALIGN_LEFT;
+}
+
+BLOCK_STYLE RubbishHtmlParser::block_style_for(int text_align)
+{
+  switch (text_align)
   {
+  case CSS_ALIGN_RIGHT:
+    return RIGHT_ALIGN;
+  case CSS_ALIGN_CENTER:
+    return CENTER_ALIGN;
+  case CSS_ALIGN_JUSTIFY:
+    // Map fully-justified paragraphs to left-align by default to
+    // avoid overly large gaps between words, unless the reader has
+    // explicitly requested justification.
+    return m_justify_paragraphs ? JUSTIFIED : LEFT_ALIGN;
+  case CSS_ALIGN_LEFT:
     return LEFT_ALIGN;
+  default:
+    // Default to either left-aligned or fully-justified paragraphs
+    // depending on the reader setting
+    return m_justify_paragraphs ? JUSTIFIED : LEFT_ALIGN;
   }
-  if (value == "center")
+}
+
+bool RubbishHtmlParser::enter_node(const char *tag_name, const XhtmlAttributes &attributes)
+{
+  const HtmlTag &tag = classify_tag(tag_name);
+  if (tag.behaviour & TAG_SKIP)
   {
-    return CENTER_ALIGN;
+    return false;
   }
-  if (value == "right")
+  // the stylesheet rules for the element then anything in its style attribute
+  CssStyle css;
+  if (m_styles)
   {
-    return RIGHT_ALIGN;
+    m_styles->resolve(tag_name, attributes.get("class"), css);
   }
-  if (value == "justify")
+  const char *style_attr = attributes.get("style");
+  if (style_attr[0])
   {
-    // Map fully-justified paragraphs to left-align by default to
-    // avoid overly large gaps between words, unless the caller has
-    // explicitly requested justification.
-    return treat_justify_as_justified ? JUSTIFIED : LEFT_ALIGN;
+    parse_css_declarations(style_attr, strlen(style_attr), css);
   }
-  return default_style;
-}
-
-RubbishHtmlParser::RubbishHtmlParser(const char *html, int length, const std::string &base_path, bool justify_paragraphs)
-    : m_justify_paragraphs(justify_paragraphs)
-{
-  m_base_path = base_path;
-  parse(html, length);
-}
-
-RubbishHtmlParser::~RubbishHtmlParser()
-{
-  for (auto block : blocks)
+  if (css.display_none)
   {
-    delete block;
+    return false;
   }
-}
-
-bool RubbishHtmlParser::enter_node(const pugi::xml_node &element)
-{
-  const char *tag_name = element.name();
-  // we only handle image tags
-  if (matches(tag_name, IMAGE_TAGS, NUM_IMAGE_TAGS))
+  InheritedStyle inherited = {is_bold, is_italic, m_text_align};
+  m_style_stack.push_back(inherited);
+  if (tag.behaviour & TAG_IMAGE_SOURCE)
   {
     // Try src first, then xlink:href (for SVG), then href
-    const char *src = element.attribute("src").value();
+    const char *src = attributes.get("src");
     if (!src || strlen(src) == 0)
     {
-      src = element.attribute("xlink:href").value();
+      src = attributes.get("xlink:href");
     }
     if (!src || strlen(src) == 0)
     {
-      src = element.attribute("href").value();
+      src = attributes.get("href");
     }
     if (src && strlen(src) > 0)
     {
-      // don't leave an empty text block in the list
-      BLOCK_STYLE style = currentTextBlock->get_style();
-      if (currentTextBlock->is_empty())
-      {
-        blocks.pop_back();
-        delete currentTextBlock;
-        currentTextBlock = nullptr;
-      }
       // Get alt text if available
-      const char *alt = element.attribute("alt").value();
+      const char *alt = attributes.get("alt");
       std::string alt_text = alt ? alt : "";
-      blocks.push_back(new ImageBlock(m_base_path + src, alt_text));
-      // start a new text block - with the same style as before
-      startNewTextBlock(style);
+      ImageBlock *image = m_arena.create<ImageBlock>(m_base_path + src, alt_text);
+      if (image)
+      {
+        if (currentTextBlock && currentTextBlock->is_empty() && blocks.back() == currentTextBlock)
+        {
+          // don't leave an empty text block before the image - it can go
+          // after it instead and carry on as the current block
+          blocks.insert(blocks.end() - 1, image);
+        }
+        else
+        {
+          blocks.push_back(image);
+          // start a new text block - with the same style as before
+          if (currentTextBlock)
+          {
+            startNewTextBlock(currentTextBlock->get_style(), currentTextBlock->follows_justification());
+          }
+          else
+          {
+            startNewTextBlock(m_justify_paragraphs ? JUSTIFIED : LEFT_ALIGN, true);
+          }
+        }
+      }
     }
     else
     {
       ESP_LOGE(TAG, "Could not find src/href attribute for image");
     }
   }
-  else if (matches(tag_name, SKIP_TAGS, NUM_SKIP_TAGS))
+  else if (tag.id == TAG_BR)
   {
-    return false;
-  }
-  else if (matches(tag_name, HEADER_TAGS, NUM_HEADER_TAGS))
-  {
-    is_bold = true;
-    startNewTextBlock(CENTER_ALIGN);
+    BLOCK_STYLE style = JUSTIFIED;
+    bool follows = false;
+    if (currentTextBlock)
+    {
+      style = currentTextBlock->get_style();
+      follows = currentTextBlock->follows_justification();
+    }
+    startNewTextBlock(style, follows);
   }
-  else if (matches(tag_name, BLOCK_TAGS, NUM_BLOCK_TAGS))
+  else if (tag.behaviour & (TAG_HEADER | TAG_BLOCK))
   {
-    if (strcmp(tag_name, "br") == 0)
+    // headers are centered unless the book says otherwise, paragraphs
+    // follow whatever they are inside
+    int text_align = css.has(CSS_TEXT_ALIGN) ? css.text_align : m_text_align;
+    if (tag.behaviour & TAG_HEADER)
     {
-      BLOCK_STYLE style = JUSTIFIED;
-      if (currentTextBlock)
+      is_bold = true;
+      if (css.has(CSS_TEXT_ALIGN))
+      {
+        startNewTextBlock(block_style_for(text_align), follows_justification(text_align));
+      }
+      else
       {
-        style = currentTextBlock->get_style();
+        startNewTextBlock(CENTER_ALIGN, false);
       }
-      startNewTextBlock(style);
     }
     else
     {
-      // Default to either left-aligned or fully-justified paragraphs
-      // depending on the reader setting, but still honour explicit
-      // CSS text-align where present.
-      BLOCK_STYLE default_style = m_justify_paragraphs ? JUSTIFIED : LEFT_ALIGN;
-      const char *style_attr = element.attribute("style").value();
-      BLOCK_STYLE style = parse_text_align_from_style(style_attr, default_style, m_justify_paragraphs);
-      startNewTextBlock(style);
+      startNewTextBlock(block_style_for(text_align), follows_justification(text_align));
     }
+    currentTextBlock->set_spacing(css);
   }
-  else if (matches(tag_name, BOLD_TAGS, NUM_BOLD_TAGS))
+  else if (tag.behaviour & TAG_BOLD)
   {
     is_bold = true;
   }
-  else if (matches(tag_name, ITALIC_TAGS, NUM_ITALIC_TAGS))
+  else if (tag.behaviour & TAG_ITALIC)
   {
     is_italic = true;
   }
-  return true;
-}
-/// Visit a text node.
-bool RubbishHtmlParser::visit_text(const pugi::xml_node &node)
-{
-  const char *value = node.value();
-  if (value && value[0] != '\0')
+  // these are inherited by everything inside the element
+  if (css.has(CSS_FONT_WEIGHT))
   {
-    addText(value, is_bold, is_italic);
+    is_bold = css.bold;
   }
-  return true;
-}
-bool RubbishHtmlParser::exit_node(const pugi::xml_node &element)
-{
-  const char *tag_name = element.name();
-  if (matches(tag_name, HEADER_TAGS, NUM_HEADER_TAGS))
+  if (css.has(CSS_FONT_STYLE))
   {
-    is_bold = false;
+    is_italic = css.italic;
   }
-  else if (matches(tag_name, BLOCK_TAGS, NUM_BLOCK_TAGS))
+  if (css.has(CSS_TEXT_ALIGN))
   {
-    // nothing to do
+    m_text_align = css.text_align;
   }
-  else if (matches(tag_name, BOLD_TAGS, NUM_BOLD_TAGS))
+  return true;
+}
+/// Visit a text node.
+void RubbishHtmlParser::visit_text(const char *text, size_t length)
+{
+  if (length > 0)
   {
-    is_bold = false;
+    addText(text, length, is_bold, is_italic);
   }
-  else if (matches(tag_name, ITALIC_TAGS, NUM_ITALIC_TAGS))
+}
+void RubbishHtmlParser::exit_node(const char *tag_name)
+{
+  // go back to the styles from before the element started
+  if (!m_style_stack.empty())
   {
-    is_italic = false;
+    const InheritedStyle &inherited = m_style_stack.back();
+    is_bold = inherited.is_bold;
+    is_italic = inherited.is_italic;
+    m_text_align = inherited.text_align;
+    m_style_stack.pop_back();
   }
-  return true;
 }
 
 // start a new text block if needed
-void RubbishHtmlParser::startNewTextBlock(BLOCK_STYLE style)
+void RubbishHtmlParser::startNewTextBlock(BLOCK_STYLE style, bool follows_justification)
 {
   if (currentTextBlock)
   {
-    // already have a text block running and it is empty - just reuse it
-    if (currentTextBlock->is_empty())
+    // already have a text block running and it is empty - just reuse it,
+    // unless an image has gone in after it
+    if (currentTextBlock->is_empty() && blocks.back() == currentTextBlock)
     {
       currentTextBlock->set_style(style);
+      currentTextBlock->set_follows_justification(follows_justification);
       return;
     }
     else
@@ -257,136 +256,408 @@ void RubbishHtmlParser::startNewTextBlock(BLOCK_STYLE style)
       currentTextBlock->finish();
     }
   }
-  currentTextBlock = new TextBlock(style);
+  TextBlock *block = m_arena.create<TextBlock>(style, &m_text, &m_words);
+  if (!block)
+  {
+    // keep adding to the block we've got
+    ESP_LOGE(TAG, "Out of memory for text blocks");
+    return;
+  }
+  block->set_follows_justification(follows_justification);
+  currentTextBlock = block;
   blocks.push_back(currentTextBlock);
 }
 
-void RubbishHtmlParser::parse(const char *html, int length)
+void RubbishHtmlParser::begin_parse()
 {
   // Default paragraph alignment is controlled by the reader setting.
-  startNewTextBlock(m_justify_paragraphs ? JUSTIFIED : LEFT_ALIGN);
-  pugi::xml_document doc;
-  // Preserve significant text while still collapsing some whitespace via
-  // our own addText() handling.
-  pugi::xml_parse_result result =
-      doc.load_buffer(html, length, pugi::parse_default | pugi::parse_ws_pcdata);
+  startNewTextBlock(m_justify_paragraphs ? JUSTIFIED : LEFT_ALIGN, true);
+  // the tokenizer's buffers are too big for some of the task stacks
+  m_tokenizer = new XhtmlTokenizer(*this);
+}
+
+void RubbishHtmlParser::end_parse()
+{
+  m_tokenizer->finish();
+  delete m_tokenizer;
+  m_tokenizer = nullptr;
+  currentTextBlock->finish();
+  m_text.shrink_to_fit();
+  m_words.shrink_to_fit();
+  m_style_stack.clear();
+  m_style_stack.shrink_to_fit();
+}
+
+void RubbishHtmlParser::parse(const char *html, int length)
+{
+  begin_parse();
+  m_tokenizer->feed(html, length);
+  end_parse();
+}
+
+// size of the chunks read from the zip entry
+static const size_t STREAM_CHUNK_SIZE = 1024;
+
+void RubbishHtmlParser::parse(ZipEntryStream *stream)
+{
+  begin_parse();
+  char *chunk = new char[STREAM_CHUNK_SIZE];
+  size_t read;
+  int chunks = 0;
+  while ((read = stream->read(reinterpret_cast<uint8_t *>(chunk), STREAM_CHUNK_SIZE)) > 0)
+  {
+    m_tokenizer->feed(chunk, read);
+    // feed the watchdog every so often
+    if (++chunks % 16 == 0)
+    {
+      vTaskDelay(1);
+    }
+  }
+  delete[] chunk;
+  end_parse();
+}
+
+void RubbishHtmlParser::start_parse(ZipEntryStream *stream)
+{
+  m_parse_stream = stream;
+  begin_parse();
+}
+
+bool RubbishHtmlParser::parse_more(int chunk_count)
+{
+  if (!m_parse_stream)
+  {
+    return true;
+  }
+  char *chunk = new char[STREAM_CHUNK_SIZE];
+  size_t read = 1;
+  for (int i = 0; i < chunk_count && read > 0; i++)
+  {
+    read = m_parse_stream->read(reinterpret_cast<uint8_t *>(chunk), STREAM_CHUNK_SIZE);
+    m_tokenizer->feed(chunk, read);
+  }
+  delete[] chunk;
+  if (read > 0)
+  {
+    return false;
+  }
+  delete m_parse_stream;
+  m_parse_stream = nullptr;
+  end_parse();
+  return true;
+}
 
-  if (!result)
+void RubbishHtmlParser::addText(const char *text, size_t length, bool is_bold, bool is_italic)
+{
+  // copy the text into the section once and decode it where it is
+  uint32_t offset;
+  char *copy = m_text.append(text, length, &offset);
+  if (!copy)
   {
-    // If parsing fails, just treat everything as a single text block.
-    addText(html, false, false);
+    ESP_LOGE(TAG, "Out of memory for section text");
     return;
   }
+  length = replace_html_entities(copy, length);
+  currentTextBlock->add_words(offset, length, is_bold, is_italic);
+}
 
-  pugi::xml_node root = doc.child("html");
-  pugi::xml_node body = root ? root.child("body") : pugi::xml_node();
-  pugi::xml_node start = body ? body : doc;
+static const int MAX_IMAGES_PER_SECTION = 8;
 
-  std::function<void(const pugi::xml_node &)> walk =
-      [&](const pugi::xml_node &node)
-      {
-        if (node.type() == pugi::node_element)
-        {
-          if (!enter_node(node))
-          {
-            return;
-          }
-          for (pugi::xml_node child : node.children())
-          {
-            walk(child);
-          }
-          exit_node(node);
-        }
-        else if (node.type() == pugi::node_pcdata || node.type() == pugi::node_cdata)
-        {
-          visit_text(node);
-        }
-      };
+void RubbishHtmlParser::start_layout()
+{
+  // laying out again starts the pages from scratch - the lines are kept
+  // unless prepare_layout finds they're out of date
+  m_page_elements.clear();
+  m_page_starts.clear();
+  m_page_starts.push_back(0);
+  m_page_positions.clear();
+  m_page_positions.push_back({0, 0, 0});
+  m_first_page = 0;
+  m_layout_block = 0;
+  m_layout_line = 0;
+  m_layout_y = 0;
+  m_layout_images = 0;
+}
 
-  for (pugi::xml_node child : start.children())
+bool RubbishHtmlParser::set_page_table(const std::vector<PagePosition> &pages)
+{
+  // make sure it could belong to this section
+  for (size_t i = 0; i < pages.size(); i++)
   {
-    walk(child);
+    if (pages[i].block_index >= blocks.size() || (i > 0 && pages[i].block_index < pages[i - 1].block_index))
+    {
+      return false;
+    }
   }
+  m_page_table = pages;
+  return !m_page_table.empty();
 }
 
-void RubbishHtmlParser::addText(const char *text, bool is_bold, bool is_italic)
+bool RubbishHtmlParser::get_page_table(std::vector<PagePosition> &pages)
 {
-  // Probably there is a more elegant way to do this
-  std::string parsetxt = replace_html_entities((string)text);
-  currentTextBlock->add_span(parsetxt.c_str(), is_bold, is_italic);
+  if (!is_layout_complete() || m_first_page != 0 || m_page_positions.empty())
+  {
+    return false;
+  }
+  pages = m_page_positions;
+  return true;
 }
 
-static const int MAX_IMAGES_PER_SECTION = 8;
+void RubbishHtmlParser::seek_layout(int page)
+{
+  if (m_page_table.empty() || page < 0 || page >= static_cast<int>(m_page_table.size()) ||
+      (!m_page_starts.empty() && page >= m_first_page && page <= get_pages_laid_out()))
+  {
+    return;
+  }
+  // start again from the page we want
+  const PagePosition &position = m_page_table[page];
+  m_page_elements.clear();
+  m_page_starts.clear();
+  m_page_starts.push_back(0);
+  m_page_positions.clear();
+  m_page_positions.push_back(position);
+  m_first_page = page;
+  m_layout_block = position.block_index;
+  m_layout_line = position.line_index;
+  m_layout_y = 0;
+  m_layout_images = position.images;
+}
 
-void RubbishHtmlParser::layout(Renderer *renderer, Epub *epub)
+// lay out the next block and put its lines onto pages
+void RubbishHtmlParser::layout_next_block(Renderer *renderer, Epub *epub)
 {
   const int line_height = renderer->get_line_height();
   const int page_height = renderer->get_page_height();
-  // first ask the blocks to work out where they should have
-  // line breaks based on the page width
-  int images_seen = 0;
+  uint32_t block_index = m_layout_block++;
+  uint16_t first_line = m_layout_line;
+  m_layout_line = 0;
+  // for the page table
+  PagePosition position = {block_index, 0, static_cast<uint16_t>(m_layout_images)};
+  Block *block = blocks[block_index];
+  if (block->getType() == BlockType::IMAGE_BLOCK)
+  {
+    ImageBlock *imageBlock = (ImageBlock *)block;
+    m_layout_images++;
+    if (m_layout_images > MAX_IMAGES_PER_SECTION)
+    {
+      imageBlock->width = 0;
+      imageBlock->height = 0;
+    }
+    else
+    {
+      imageBlock->layout(renderer, epub);
+    }
+    if (imageBlock->width <= 0 || imageBlock->height <= 0)
+    {
+      return;
+    }
+    if (m_layout_y + imageBlock->height > page_height)
+    {
+      m_page_starts.push_back(m_page_elements.size());
+      m_page_positions.push_back(position);
+      m_layout_y = 0;
+    }
+    PageElement image = {block_index, 0, static_cast<int16_t>(m_layout_y)};
+    m_page_elements.push_back(image);
+    m_layout_y += imageBlock->height;
+    return;
+  }
+  TextBlock *textBlock = (TextBlock *)block;
+  textBlock->layout(renderer, epub, -1, &m_line_breaker);
+  // no point in leaving a gap at the top of a page
+  if (m_layout_y > 0)
+  {
+    m_layout_y += textBlock->get_space_before(line_height);
+  }
+  for (int line_break_index = first_line; line_break_index < textBlock->get_line_count(); line_break_index++)
+  {
+    if (m_layout_y + line_height > page_height)
+    {
+      position.line_index = line_break_index;
+      m_page_starts.push_back(m_page_elements.size());
+      m_page_positions.push_back(position);
+      m_layout_y = 0;
+    }
+    PageElement line = {block_index, static_cast<uint16_t>(line_break_index), static_cast<int16_t>(m_layout_y)};
+    m_page_elements.push_back(line);
+    m_layout_y += line_height;
+  }
+  // add some extra space between blocks
+  m_layout_y += textBlock->get_space_after(line_height);
+}
+
+void RubbishHtmlParser::prepare_layout(Renderer *renderer)
+{
+  uintptr_t font_id = renderer->get_font_id();
+  int font_size = renderer->get_font_pixel_size();
+  int page_width = renderer->get_page_width();
+  int space_width = renderer->get_space_width();
+  int em = renderer->get_base_line_height();
+  bool new_font = font_id != m_font_id || font_size != m_font_size;
+  if (!new_font && page_width == m_page_width && space_width == m_space_width && em == m_em)
+  {
+    return;
+  }
+  // the lines need breaking again, and the words measuring again if the
+  // font has changed - laying out from the start
+  m_words.set_line_count(0);
+  if (new_font)
+  {
+    m_words.hyphens.resize(0);
+    m_words.hyphen_widths.resize(0);
+  }
   for (auto block : blocks)
   {
-    if (block->getType() == BlockType::IMAGE_BLOCK)
+    if (block->getType() == BlockType::TEXT_BLOCK)
     {
-      images_seen++;
-      if (images_seen > MAX_IMAGES_PER_SECTION)
+      TextBlock *text_block = static_cast<TextBlock *>(block);
+      if (new_font)
+      {
+        text_block->invalidate_widths();
+      }
+      else
       {
-        ImageBlock *imageBlock = (ImageBlock *)block;
-        imageBlock->width = 0;
-        imageBlock->height = 0;
-        // feed the watchdog even when skipping heavy images
-        vTaskDelay(1);
-        continue;
+        text_block->invalidate_lines();
       }
     }
+  }
+  m_font_id = font_id;
+  m_font_size = font_size;
+  m_page_width = page_width;
+  m_space_width = space_width;
+  m_em = em;
+  // any pages we've got were made from the old lines
+  if (!m_page_elements.empty())
+  {
+    start_layout();
+  }
+}
 
-    block->layout(renderer, epub);
-    // feed the watchdog
-    vTaskDelay(1);
+void RubbishHtmlParser::set_justified(bool justified)
+{
+  if (justified == m_justify_paragraphs)
+  {
+    return;
   }
-  // now we need to allocate the lines to pages
-  // we'll run through each block and the lines within each block and allocate
-  // them to pages. When we run out of space on a page we'll start a new page
-  // and continue
-  int y = 0;
-  pages.push_back(new Page());
+  m_justify_paragraphs = justified;
+  // the lines and pages stay the same - the words just move along the lines
   for (auto block : blocks)
   {
-    // feed the watchdog
-    vTaskDelay(1);
     if (block->getType() == BlockType::TEXT_BLOCK)
     {
-      TextBlock *textBlock = (TextBlock *)block;
-      for (int line_break_index = 0; line_break_index < textBlock->line_breaks.size(); line_break_index++)
+      TextBlock *text_block = static_cast<TextBlock *>(block);
+      if (text_block->follows_justification())
       {
-        if (y + line_height > page_height)
-        {
-          pages.push_back(new Page());
-          y = 0;
-        }
-        pages.back()->elements.push_back(new PageLine(textBlock, line_break_index, y));
-        y += line_height;
+        text_block->set_style(justified ? JUSTIFIED : LEFT_ALIGN);
+        text_block->position_words();
       }
-      // add some extra line between blocks
-      y += line_height * 0.5;
     }
-    if (block->getType() == BlockType::IMAGE_BLOCK)
+  }
+}
+
+bool RubbishHtmlParser::get_page_position(int page, PagePosition &position)
+{
+  if (page >= m_first_page && page < get_pages_laid_out())
+  {
+    position = m_page_positions[page - m_first_page];
+    return true;
+  }
+  if (page >= 0 && page < static_cast<int>(m_page_table.size()))
+  {
+    position = m_page_table[page];
+    return true;
+  }
+  return false;
+}
+
+static bool position_before(const PagePosition &a, const PagePosition &b)
+{
+  return a.block_index < b.block_index || (a.block_index == b.block_index && a.line_index < b.line_index);
+}
+
+int RubbishHtmlParser::find_page(Renderer *renderer, Epub *epub, const PagePosition &position)
+{
+  const std::vector<PagePosition> *pages = &m_page_table;
+  if (m_page_table.empty())
+  {
+    // lay out until we're past the position
+    layout_pages(renderer, epub, 0);
+    while (!is_layout_complete() && !position_before(position, m_page_positions.back()))
     {
-      ImageBlock *imageBlock = (ImageBlock *)block;
-      if (imageBlock->width <= 0 || imageBlock->height <= 0)
-      {
-        continue;
-      }
-      if (y + imageBlock->height > page_height)
-      {
-        pages.push_back(new Page());
-        y = 0;
-      }
-      pages.back()->elements.push_back(new PageImage(imageBlock, y));
-      y += imageBlock->height;
+      layout_pages(renderer, epub, get_pages_laid_out());
     }
+    pages = &m_page_positions;
+  }
+  // the last page that starts at or before the position
+  auto next = std::upper_bound(pages->begin(), pages->end(), position, position_before);
+  int page = next == pages->begin() ? 0 : (next - pages->begin()) - 1;
+  return pages == &m_page_table ? page : page + m_first_page;
+}
+
+bool RubbishHtmlParser::get_page_text_position(int page, TextPosition &position)
+{
+  PagePosition page_position;
+  if (!get_page_position(page, page_position))
+  {
+    return false;
   }
+  position.block_index = page_position.block_index;
+  position.word_index = 0;
+  Block *block = page_position.block_index < blocks.size() ? blocks[page_position.block_index] : nullptr;
+  if (block && block->getType() == BlockType::TEXT_BLOCK && static_cast<TextBlock *>(block)->has_lines())
+  {
+    position.word_index = static_cast<TextBlock *>(block)->get_line_start_word(page_position.line_index);
+  }
+  return true;
+}
+
+int RubbishHtmlParser::find_page(Renderer *renderer, Epub *epub, const TextPosition &position)
+{
+  PagePosition page_position = {position.block_index, 0, 0};
+  Block *block = position.block_index < blocks.size() ? blocks[position.block_index] : nullptr;
+  if (block && block->getType() == BlockType::TEXT_BLOCK)
+  {
+    // break the block's lines for the new settings to see which one the word
+    // is on now - laying out the pages gets the same lines
+    prepare_layout(renderer);
+    TextBlock *text_block = static_cast<TextBlock *>(block);
+    text_block->layout(renderer, epub, -1, &m_line_breaker);
+    page_position.line_index = text_block->find_line(position.word_index);
+  }
+  return find_page(renderer, epub, page_position);
+}
+
+bool RubbishHtmlParser::layout_pages(Renderer *renderer, Epub *epub, int page_count)
+{
+  prepare_layout(renderer);
+  if (m_page_starts.empty())
+  {
+    start_layout();
+  }
+  // a page is finished once the one after it has been started
+  while (!is_layout_complete() && get_pages_laid_out() <= page_count)
+  {
+    layout_next_block(renderer, epub);
+    // feed the watchdog
+    vTaskDelay(1);
+  }
+  if (is_layout_complete())
+  {
+    m_words.shrink_layout_to_fit();
+    m_line_breaker.free_memory();
+    m_page_elements.shrink_to_fit();
+    m_page_starts.shrink_to_fit();
+    m_page_positions.shrink_to_fit();
+    return true;
+  }
+  return false;
+}
+
+void RubbishHtmlParser::layout(Renderer *renderer, Epub *epub)
+{
+  start_layout();
+  layout_pages(renderer, epub, INT_MAX);
 }
 
 void RubbishHtmlParser::render_page(int page_index, Renderer *renderer, Epub *epub)
@@ -399,7 +670,9 @@ void RubbishHtmlParser::render_page(int page_index, Renderer *renderer, Epub *ep
     renderer->flush_display();
   }
 
-  if (page_index < 0 || page_index >= static_cast<int>(pages.size()))
+  // we might have skipped the pages before this one
+  page_index -= m_first_page;
+  if (page_index < 0 || page_index >= static_cast<int>(m_page_starts.size()))
   {
     ESP_LOGI(TAG, "render_page out of range");
     // This could be nicer. Notice that last word "button" is cut          v
@@ -410,5 +683,19 @@ void RubbishHtmlParser::render_page(int page_index, Renderer *renderer, Epub *ep
     return;
   }
 
-  pages[page_index]->render(renderer, epub);
+  uint32_t start = m_page_starts[page_index];
+  uint32_t end = page_index + 1 < static_cast<int>(m_page_starts.size()) ? m_page_starts[page_index + 1] : m_page_elements.size();
+  for (uint32_t i = start; i < end; i++)
+  {
+    const PageElement &element = m_page_elements[i];
+    Block *block = blocks[element.block_index];
+    if (block->getType() == BlockType::TEXT_BLOCK)
+    {
+      static_cast<TextBlock *>(block)->render(renderer, element.line_index, 0, element.y_pos);
+    }
+    else
+    {
+      static_cast<ImageBlock *>(block)->render(renderer, epub, element.y_pos);
+    }
+  }
 }
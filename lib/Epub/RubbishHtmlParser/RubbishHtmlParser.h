@@ -1,57 +1,180 @@
 #pragma once
 
 #include <string>
-#include <list>
 #include <vector>
-#include <pugixml.hpp>
 #include "blocks/TextBlock.h"
+#include "XhtmlTokenizer.h"
+#include "SectionText.h"
+#include "SectionWords.h"
+#include "SectionArena.h"
+#include "LineBreaker.h"
+#include "Page.h"
 
 using namespace std;
 
-class Page;
 class Renderer;
 class Epub;
+class ZipEntryStream;
+class CssStyleTable;
+struct CssStyle;
 
 // a very stupid xhtml parser - it will probably work for very simple cases
 // but will probably fail for complex ones
-class RubbishHtmlParser
+class RubbishHtmlParser : private XhtmlHandler
 {
 private:
   bool is_bold = false;
   bool is_italic = false;
+  // text-align set by a parent element, or -1 if there isn't one
+  int8_t m_text_align = -1;
 
-  std::list<Block *> blocks;
+  // what to go back to when each element we're inside ends
+  struct InheritedStyle
+  {
+    bool is_bold;
+    bool is_italic;
+    int8_t text_align;
+  };
+  std::vector<InheritedStyle> m_style_stack;
+
+  // the book's stylesheets - can be nullptr
+  const CssStyleTable *m_styles;
+
+  // all the text of the section - the text blocks point into this
+  SectionText m_text;
+  // and all the words - the text blocks each have a range of these
+  SectionWords m_words;
+  // the blocks are allocated from here and all freed together
+  SectionArena m_arena;
+  std::vector<Block *> blocks;
+  // scratch space for breaking the blocks into lines
+  LineBreaker m_line_breaker;
   TextBlock *currentTextBlock = nullptr;
-  std::vector<Page *> pages;
+  // everything on every page, with where each page starts
+  std::vector<PageElement> m_page_elements;
+  std::vector<uint32_t> m_page_starts;
+  // where each page we've laid out starts
+  std::vector<PagePosition> m_page_positions;
+  // the first page we've laid out - only not 0 when we've skipped ahead
+  // using a page table from the cache
+  int m_first_page = 0;
+  // every page in the section if we know them
+  std::vector<PagePosition> m_page_table;
+  // how far the layout has got - the next block to lay out and the first of
+  // its lines to place, how far down the last page we are and how many
+  // images we've seen
+  uint32_t m_layout_block = 0;
+  uint16_t m_layout_line = 0;
+  int m_layout_y = 0;
+  int m_layout_images = 0;
+  // what the lines were broken for - if any of these change the lines are
+  // worked out again, but only a new font means measuring the words again
+  uintptr_t m_font_id = 0;
+  int m_font_size = -1;
+  int m_page_width = -1;
+  int m_space_width = -1;
+  int m_em = -1;
 
   std::string m_base_path;
 
+  // a section being parsed a bit at a time - both are deleted once the
+  // stream has all been read
+  ZipEntryStream *m_parse_stream = nullptr;
+  XhtmlTokenizer *m_tokenizer = nullptr;
+
   // Whether new paragraph blocks should default to fully-justified
   // layout or remain left-aligned. This is driven by a user-facing
   // reader setting.
   bool m_justify_paragraphs = false;
 
   // start a new text block if needed
-  void startNewTextBlock(BLOCK_STYLE style);
+  void startNewTextBlock(BLOCK_STYLE style, bool follows_justification);
+  // the block style for a CSS text-align value
+  BLOCK_STYLE block_style_for(int text_align);
 
-  // PugiXML-based traversal helpers
-  bool enter_node(const pugi::xml_node &node);
-  bool visit_text(const pugi::xml_node &node);
-  bool exit_node(const pugi::xml_node &node);
+  void begin_parse();
+  void end_parse();
+
+  // called by the tokenizer as it works through the document
+  bool enter_node(const char *tag_name, const XhtmlAttributes &attributes) override;
+  void visit_text(const char *text, size_t length) override;
+  void exit_node(const char *tag_name) override;
+
+  // throw away any lines that don't fit the renderer's settings any more
+  void prepare_layout(Renderer *renderer);
+  void layout_next_block(Renderer *renderer, Epub *epub);
 
 public:
-  RubbishHtmlParser(const char *html, int length, const std::string &base_path, bool justify_paragraphs);
+  RubbishHtmlParser(const char *html, int length, const std::string &base_path, bool justify_paragraphs, const CssStyleTable *styles = nullptr);
+  // parse straight from the zip entry without reading the whole chapter into memory
+  RubbishHtmlParser(ZipEntryStream *stream, const std::string &base_path, bool justify_paragraphs, const CssStyleTable *styles = nullptr);
+  // or parse it a bit at a time with start_parse and parse_more
+  RubbishHtmlParser(const std::string &base_path, bool justify_paragraphs, const CssStyleTable *styles = nullptr);
   ~RubbishHtmlParser();
 
   void parse(const char *html, int length);
-  void addText(const char *text, bool is_bold, bool is_italic);
+  void parse(ZipEntryStream *stream);
+  // the parser keeps the stream and deletes it when it's done with it
+  void start_parse(ZipEntryStream *stream);
+  // parse up to chunk_count more chunks - returns true once it's all parsed
+  bool parse_more(int chunk_count);
+  bool is_parsed()
+  {
+    return !m_parse_stream;
+  }
+  void addText(const char *text, size_t length, bool is_bold, bool is_italic);
+  // lay out the whole section in one go
   void layout(Renderer *renderer, Epub *epub);
+  // or a bit at a time - start_layout and then layout_pages until it
+  // returns true. layout_pages stops as soon as the first page_count pages
+  // are finished so the first page can be shown without waiting for the
+  // rest of the section.
+  void start_layout();
+  bool layout_pages(Renderer *renderer, Epub *epub, int page_count);
+  bool is_layout_complete()
+  {
+    return m_layout_block >= blocks.size();
+  }
+  // pages [0, n) are laid out - or [first, n) after skipping ahead
+  int get_pages_laid_out()
+  {
+    return m_first_page + m_page_starts.size();
+  }
 
+  // a page table saved from an earlier layout with the same settings lets us
+  // lay out from any page without doing the pages before it
+  bool set_page_table(const std::vector<PagePosition> &pages);
+  // the page table once the whole section has been laid out from the start
+  bool get_page_table(std::vector<PagePosition> &pages);
+  bool has_page_table() { return !m_page_table.empty(); }
+  // the settings have changed so the page table doesn't apply any more
+  void clear_page_table() { m_page_table.clear(); }
+  // where page starts, if we know
+  bool get_page_position(int page, PagePosition &position);
+  // the page that has position on it - laying out as far as we need to
+  int find_page(Renderer *renderer, Epub *epub, const PagePosition &position);
+  // the same but in terms of the words, which stay put when the lines change -
+  // get the position before changing the settings and find it afterwards
+  bool get_page_text_position(int page, TextPosition &position);
+  int find_page(Renderer *renderer, Epub *epub, const TextPosition &position);
+  // switch paragraphs between justified and left aligned - the words move
+  // along their lines but the lines and pages don't change
+  void set_justified(bool justified);
+  // make sure the layout covers page - restarting it from the page table if
+  // page is before the pages we have or well past them
+  void seek_layout(int page);
+
+  // the number of pages in the section - until the section has been
+  // completely laid out, or we have a page table, it's the pages so far
   int get_page_count()
   {
-    return pages.size();
+    return m_page_table.empty() ? get_pages_laid_out() : m_page_table.size();
+  }
+  bool is_page_count_known()
+  {
+    return is_layout_complete() || !m_page_table.empty();
   }
-  const std::list<Block *> &get_blocks()
+  const std::vector<Block *> &get_blocks()
   {
     return blocks;
   }
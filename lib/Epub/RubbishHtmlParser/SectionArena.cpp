@@ -0,0 +1,59 @@
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+#include <esp_heap_caps.h>
+#endif
+#include <stdlib.h>
+#include "SectionArena.h"
+
+static void *arena_malloc(size_t size)
+{
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+  return heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+  return malloc(size);
+#endif
+}
+
+void SectionArena::release()
+{
+  while (m_chunks)
+  {
+    Chunk *next = m_chunks->next;
+    free(m_chunks);
+    m_chunks = next;
+  }
+  m_bytes_allocated = 0;
+}
+
+// where the next object can go in the chunk - malloc doesn't promise more
+// than 4 byte alignment on all our boards so line up the actual address
+static size_t padded_offset(uint8_t *data, size_t used, size_t alignment)
+{
+  uintptr_t address = reinterpret_cast<uintptr_t>(data + used);
+  return used + ((alignment - address % alignment) % alignment);
+}
+
+void *SectionArena::allocate(size_t size, size_t alignment)
+{
+  size_t start = m_chunks ? padded_offset(m_chunks->data(), m_chunks->used, alignment) : 0;
+  if (!m_chunks || start + size > m_chunks->size)
+  {
+    size_t chunk_size = m_bytes_allocated < MIN_CHUNK_SIZE ? MIN_CHUNK_SIZE : m_bytes_allocated;
+    chunk_size = chunk_size > MAX_CHUNK_SIZE ? MAX_CHUNK_SIZE : chunk_size;
+    // anything too big for a normal chunk gets one of its own - with room
+    // to line it up
+    chunk_size = size + alignment > chunk_size ? size + alignment : chunk_size;
+    Chunk *chunk = static_cast<Chunk *>(arena_malloc(sizeof(Chunk) + chunk_size));
+    if (!chunk)
+    {
+      return nullptr;
+    }
+    chunk->size = chunk_size;
+    chunk->used = 0;
+    chunk->next = m_chunks;
+    m_chunks = chunk;
+    m_bytes_allocated += sizeof(Chunk) + chunk_size;
+    start = padded_offset(chunk->data(), 0, alignment);
+  }
+  m_chunks->used = start + size;
+  return m_chunks->data() + start;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <utility>
+
+// Memory for the blocks of a section. Objects are carved out of large chunks
+// and all the memory is given back in one go when the section is freed, so
+// changing sections doesn't mean thousands of little frees or leave the heap
+// fragmented. The arena doesn't know what it holds - the owner has to call
+// the destructors before the arena is released.
+class SectionArena
+{
+private:
+  struct Chunk
+  {
+    Chunk *next;
+    size_t size;
+    size_t used;
+    uint8_t *data() { return reinterpret_cast<uint8_t *>(this + 1); }
+  };
+  // small sections only need a small chunk - each new chunk is as big as
+  // everything allocated so far, up to the maximum
+  static const size_t MIN_CHUNK_SIZE = 1024;
+  static const size_t MAX_CHUNK_SIZE = 16384;
+
+  Chunk *m_chunks = nullptr;
+  size_t m_bytes_allocated = 0;
+
+  SectionArena(const SectionArena &) = delete;
+  SectionArena &operator=(const SectionArena &) = delete;
+
+public:
+  SectionArena() {}
+  ~SectionArena() { release(); }
+  // returns nullptr if we've run out of memory
+  void *allocate(size_t size, size_t alignment);
+  // construct an object in the arena
+  template <typename T, typename... Args>
+  T *create(Args &&...args)
+  {
+    void *memory = allocate(sizeof(T), alignof(T));
+    return memory ? new (memory) T(std::forward<Args>(args)...) : nullptr;
+  }
+  // free everything at once
+  void release();
+  // memory used by the chunks
+  size_t get_bytes_allocated() const { return m_bytes_allocated; }
+};
@@ -0,0 +1,62 @@
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+#include <esp_heap_caps.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include "SectionText.h"
+
+static const uint32_t INITIAL_CAPACITY = 1024;
+
+void *section_realloc(void *ptr, size_t size)
+{
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+  return heap_caps_realloc(ptr, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+  return realloc(ptr, size);
+#endif
+}
+
+SectionText::~SectionText()
+{
+  free(m_data);
+}
+
+char *SectionText::append(const char *text, size_t length, uint32_t *offset)
+{
+  size_t needed = m_length + length + 1;
+  if (needed > m_capacity)
+  {
+    size_t capacity = m_capacity ? m_capacity : INITIAL_CAPACITY;
+    while (capacity < needed)
+    {
+      capacity *= 2;
+    }
+    char *data = static_cast<char *>(section_realloc(m_data, capacity));
+    if (!data)
+    {
+      return nullptr;
+    }
+    m_data = data;
+    m_capacity = capacity;
+  }
+  char *copy = m_data + m_length;
+  memcpy(copy, text, length);
+  copy[length] = '\0';
+  *offset = m_length;
+  m_length += length + 1;
+  return copy;
+}
+
+void SectionText::shrink_to_fit()
+{
+  if (m_length == m_capacity || m_length == 0)
+  {
+    return;
+  }
+  char *data = static_cast<char *>(section_realloc(m_data, m_length));
+  if (data)
+  {
+    m_data = data;
+    m_capacity = m_length;
+  }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// where the section's big buffers get their memory - PSRAM if we have it
+void *section_realloc(void *ptr, size_t size);
+
+// One buffer holding all the text of a section. Each span is copied in once,
+// decoded in place and split into words in place, and the text blocks just
+// keep offsets into it - so the buffer can move as it grows.
+class SectionText
+{
+private:
+  char *m_data = nullptr;
+  uint32_t m_length = 0;
+  uint32_t m_capacity = 0;
+
+  SectionText(const SectionText &) = delete;
+  SectionText &operator=(const SectionText &) = delete;
+
+public:
+  SectionText() {}
+  ~SectionText();
+  // copies the text onto the end of the buffer with a terminator and returns
+  // the copy - which is only valid until the next append. Returns nullptr if
+  // we've run out of memory.
+  char *append(const char *text, size_t length, uint32_t *offset);
+  // drop anything after the given length (e.g. after decoding entities)
+  void truncate(uint32_t length)
+  {
+    m_length = length;
+  }
+  // give back the spare capacity once the section has been parsed
+  void shrink_to_fit();
+  const char *get(uint32_t offset) const
+  {
+    return m_data + offset;
+  }
+  char *get(uint32_t offset)
+  {
+    return m_data + offset;
+  }
+  uint32_t get_length() const
+  {
+    return m_length;
+  }
+  uint32_t get_capacity() const
+  {
+    return m_capacity;
+  }
+};
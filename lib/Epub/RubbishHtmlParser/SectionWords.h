@@ -0,0 +1,183 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include "SectionText.h"
+
+// A growable array of plain values for the per-section word data. Like
+// SectionText the memory comes from section_realloc so it lands in PSRAM,
+// and the array can be trimmed once the section has been parsed.
+template <typename T>
+class SectionArray
+{
+private:
+  T *m_data = nullptr;
+  uint32_t m_size = 0;
+  uint32_t m_capacity = 0;
+
+  SectionArray(const SectionArray &) = delete;
+  SectionArray &operator=(const SectionArray &) = delete;
+
+  bool reallocate(uint32_t capacity)
+  {
+    T *data = static_cast<T *>(section_realloc(m_data, capacity * sizeof(T)));
+    if (!data)
+    {
+      return false;
+    }
+    m_data = data;
+    m_capacity = capacity;
+    return true;
+  }
+
+public:
+  SectionArray() {}
+  ~SectionArray() { free(m_data); }
+  // returns false if we've run out of memory
+  bool push_back(T value)
+  {
+    if (m_size == m_capacity && !reallocate(m_capacity ? m_capacity * 2 : 64))
+    {
+      return false;
+    }
+    m_data[m_size++] = value;
+    return true;
+  }
+  // new entries are left uninitialised
+  bool resize(uint32_t size)
+  {
+    if (size > m_capacity && !reallocate(size))
+    {
+      return false;
+    }
+    m_size = size;
+    return true;
+  }
+  void shrink_to_fit()
+  {
+    if (m_size == 0)
+    {
+      free(m_data);
+      m_data = nullptr;
+      m_capacity = 0;
+    }
+    else if (m_size < m_capacity)
+    {
+      reallocate(m_size);
+    }
+  }
+  // the raw pointer - nullptr while nothing has been allocated
+  T *data() { return m_data; }
+  const T *data() const { return m_data; }
+  T &operator[](uint32_t index) { return m_data[index]; }
+  const T &operator[](uint32_t index) const { return m_data[index]; }
+  uint32_t size() const { return m_size; }
+  uint32_t get_capacity() const { return m_capacity; }
+};
+
+// A line that ends part way through a hyphenated word - the head of the
+// word goes at the end of the line with a hyphen after it and the rest of
+// the word starts the next line at the word's xpos
+struct LineSplit
+{
+  uint16_t head_xpos;
+  // includes the hyphen
+  uint16_t head_width;
+  // the rest of the word after the split
+  uint16_t tail_width;
+};
+
+// The words of every text block in a section, kept as one array per field so
+// a block only needs to know which range of words and lines belong to it.
+class SectionWords
+{
+public:
+  // the style bits of each word are packed in below its offset
+  static const uint32_t STYLE_BITS = 2;
+  static const uint32_t STYLE_MASK = (1 << STYLE_BITS) - 1;
+  // line ends and hyphens have a byte offset into a word packed in below
+  // the word index
+  static const uint32_t SPLIT_BITS = 8;
+  static const uint32_t SPLIT_MASK = (1 << SPLIT_BITS) - 1;
+
+  // where each word starts in the section text and its SPAN_STYLE bits
+  SectionArray<uint32_t> words;
+  // filled in by layout
+  SectionArray<uint16_t> widths;
+  SectionArray<uint16_t> xpos;
+  // where the words can be hyphenated and how wide each word is up to
+  // there - the hyphens of each block are together
+  SectionArray<uint32_t> hyphens;
+  SectionArray<uint16_t> hyphen_widths;
+  // the word after the end of each line, or the word and offset the line
+  // was split at - the lines of each block are together in the order the
+  // blocks were laid out
+  SectionArray<uint32_t> line_ends;
+  // only used for the lines that end with a split
+  SectionArray<LineSplit> line_splits;
+
+  bool add(uint32_t offset, uint8_t style)
+  {
+    return words.push_back(offset << STYLE_BITS | (style & STYLE_MASK));
+  }
+  uint32_t get_offset(uint32_t index) const
+  {
+    return words[index] >> STYLE_BITS;
+  }
+  uint8_t get_style(uint32_t index) const
+  {
+    return words[index] & STYLE_MASK;
+  }
+  uint32_t get_count() const
+  {
+    return words.size();
+  }
+  bool add_hyphen(uint32_t word, uint8_t split, uint16_t width)
+  {
+    return hyphens.push_back(word << SPLIT_BITS | split) && hyphen_widths.push_back(width);
+  }
+  bool add_line(uint32_t end_word, uint8_t split, const LineSplit &line_split)
+  {
+    return line_ends.push_back(end_word << SPLIT_BITS | split) && line_splits.push_back(line_split);
+  }
+  void set_line_count(uint32_t count)
+  {
+    line_ends.resize(count);
+    line_splits.resize(count);
+  }
+  uint32_t get_line_end_word(uint32_t line) const
+  {
+    return line_ends[line] >> SPLIT_BITS;
+  }
+  uint8_t get_line_end_split(uint32_t line) const
+  {
+    return line_ends[line] & SPLIT_MASK;
+  }
+  // the arrays layout fills in
+  void shrink_layout_to_fit()
+  {
+    hyphens.shrink_to_fit();
+    hyphen_widths.shrink_to_fit();
+    line_ends.shrink_to_fit();
+    line_splits.shrink_to_fit();
+  }
+  void shrink_to_fit()
+  {
+    words.shrink_to_fit();
+    widths.shrink_to_fit();
+    xpos.shrink_to_fit();
+    shrink_layout_to_fit();
+  }
+  // memory used by all the arrays
+  size_t get_capacity_bytes() const
+  {
+    return words.get_capacity() * sizeof(uint32_t) +
+           widths.get_capacity() * sizeof(uint16_t) +
+           xpos.get_capacity() * sizeof(uint16_t) +
+           hyphens.get_capacity() * sizeof(uint32_t) +
+           hyphen_widths.get_capacity() * sizeof(uint16_t) +
+           line_ends.get_capacity() * sizeof(uint32_t) +
+           line_splits.get_capacity() * sizeof(LineSplit);
+  }
+};
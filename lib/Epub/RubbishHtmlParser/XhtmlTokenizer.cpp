@@ -0,0 +1,465 @@
+#include <string.h>
+#include "XhtmlTokenizer.h"
+#include "HtmlTags.h"
+
+// the entities that are decoded in attribute values
+static const char *XML_ENTITIES[][2] = {{"&amp;", "&"}, {"&lt;", "<"}, {"&gt;", ">"}, {"&quot;", "\""}, {"&apos;", "'"}};
+
+// elements that never have any contents - their end tags (if there are any)
+// are ignored as we've already called exit_node for them
+static bool is_void_tag(const char *tag_name)
+{
+  return classify_tag(tag_name).behaviour & TAG_VOID;
+}
+
+static bool is_space(char c)
+{
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static bool starts_with(const char *prefix, const char *str, size_t length)
+{
+  return strlen(prefix) >= length && strncmp(prefix, str, length) == 0;
+}
+
+const char *XhtmlAttributes::get(const char *name) const
+{
+  const char *pos = m_start;
+  while (pos < m_end)
+  {
+    const char *attribute_name = pos;
+    pos += strlen(pos) + 1;
+    if (pos >= m_end)
+    {
+      break;
+    }
+    const char *value = pos;
+    pos += strlen(pos) + 1;
+    if (strcmp(attribute_name, name) == 0)
+    {
+      return value;
+    }
+  }
+  return "";
+}
+
+void XhtmlTokenizer::tag_char(char c)
+{
+  // always leave room for the terminators of the current name and value
+  if (m_tag_length < (c ? TAG_BUFFER_SIZE - 3 : TAG_BUFFER_SIZE - 1))
+  {
+    m_tag[m_tag_length++] = c;
+  }
+}
+
+void XhtmlTokenizer::text_char(char c)
+{
+  m_text[m_text_length++] = c;
+  if (m_text_length == TEXT_BUFFER_SIZE)
+  {
+    flush_text(false);
+  }
+}
+
+void XhtmlTokenizer::flush_text(bool everything)
+{
+  if (m_text_length == 0)
+  {
+    return;
+  }
+  size_t length = m_text_length;
+  if (!everything)
+  {
+    // hang on to the last partial word so words are never split
+    size_t end = m_text_length;
+    while (end > 0 && !is_space(m_text[end - 1]))
+    {
+      end--;
+    }
+    if (end > 0)
+    {
+      length = end;
+    }
+  }
+  char saved = m_text[length];
+  m_text[length] = '\0';
+  m_handler.visit_text(m_text, length);
+  m_text[length] = saved;
+  memmove(m_text, m_text + length, m_text_length - length);
+  m_text_length -= length;
+}
+
+bool XhtmlTokenizer::recent_ends_with(const char *suffix) const
+{
+  size_t length = strlen(suffix);
+  return m_recent_length >= length && memcmp(m_recent + m_recent_length - length, suffix, length) == 0;
+}
+
+void XhtmlTokenizer::end_attribute_value()
+{
+  // decode the XML entities in place - the result is never longer
+  size_t read = m_value_start;
+  size_t write = m_value_start;
+  while (read < m_tag_length)
+  {
+    bool replaced = false;
+    if (m_tag[read] == '&')
+    {
+      for (auto &entity : XML_ENTITIES)
+      {
+        size_t entity_length = strlen(entity[0]);
+        if (m_tag_length - read >= entity_length && memcmp(m_tag + read, entity[0], entity_length) == 0)
+        {
+          m_tag[write++] = entity[1][0];
+          read += entity_length;
+          replaced = true;
+          break;
+        }
+      }
+    }
+    if (!replaced)
+    {
+      m_tag[write++] = m_tag[read++];
+    }
+  }
+  m_tag_length = write;
+  tag_char('\0');
+}
+
+void XhtmlTokenizer::finish_start_tag(bool self_closing)
+{
+  m_tag[m_tag_length] = '\0';
+  const char *tag_name = m_tag;
+  bool is_empty = self_closing || is_void_tag(tag_name);
+  if (m_skip_depth > 0)
+  {
+    if (!is_empty)
+    {
+      m_skip_depth++;
+    }
+    return;
+  }
+  XhtmlAttributes attributes(m_tag + strlen(tag_name) + 1, m_tag + m_tag_length);
+  bool entered = m_handler.enter_node(tag_name, attributes);
+  if (is_empty)
+  {
+    if (entered)
+    {
+      m_handler.exit_node(tag_name);
+    }
+  }
+  else if (!entered)
+  {
+    m_skip_depth = 1;
+  }
+}
+
+void XhtmlTokenizer::finish_end_tag()
+{
+  m_tag[m_tag_length] = '\0';
+  if (is_void_tag(m_tag))
+  {
+    return;
+  }
+  if (m_skip_depth > 0)
+  {
+    m_skip_depth--;
+    return;
+  }
+  m_handler.exit_node(m_tag);
+}
+
+void XhtmlTokenizer::feed(const char *data, size_t length)
+{
+  size_t i = 0;
+  while (i < length)
+  {
+    char c = data[i];
+    // cleared by states that want to look at the character again in a new state
+    bool consumed = true;
+    switch (m_state)
+    {
+    case STATE_TEXT:
+      if (c == '<')
+      {
+        m_state = STATE_TAG_OPEN;
+      }
+      else if (m_skip_depth == 0)
+      {
+        text_char(c);
+      }
+      break;
+    case STATE_TAG_OPEN:
+      if (c == '/' || c == '!' || c == '?' || (!is_space(c) && c != '>' && c != '<'))
+      {
+        flush_text(true);
+        m_tag_length = 0;
+        m_recent_length = 0;
+        if (c == '/')
+        {
+          m_state = STATE_END_TAG_NAME;
+        }
+        else if (c == '!')
+        {
+          m_state = STATE_MARKUP_DECLARATION;
+        }
+        else if (c == '?')
+        {
+          m_state = STATE_PROCESSING_INSTRUCTION;
+        }
+        else
+        {
+          tag_char(c);
+          m_state = STATE_START_TAG_NAME;
+        }
+      }
+      else
+      {
+        // not a tag after all - the '<' was just text
+        if (m_skip_depth == 0)
+        {
+          text_char('<');
+        }
+        m_state = STATE_TEXT;
+        consumed = false;
+      }
+      break;
+    case STATE_MARKUP_DECLARATION:
+      m_recent[m_recent_length++] = c;
+      if (m_recent_length == 2 && memcmp(m_recent, "--", 2) == 0)
+      {
+        m_recent_length = 0;
+        m_state = STATE_COMMENT;
+      }
+      else if (m_recent_length == 7 && memcmp(m_recent, "[CDATA[", 7) == 0)
+      {
+        m_recent_length = 0;
+        m_state = STATE_CDATA;
+      }
+      else if (!starts_with("--", m_recent, m_recent_length) && !starts_with("[CDATA[", m_recent, m_recent_length))
+      {
+        // a doctype or some other declaration we don't care about
+        m_doctype_depth = 0;
+        m_state = STATE_DOCTYPE;
+        consumed = false;
+      }
+      break;
+    case STATE_COMMENT:
+      if (c == '>' && recent_ends_with("--"))
+      {
+        m_state = STATE_TEXT;
+      }
+      else
+      {
+        // only the last two characters matter
+        if (m_recent_length == 2)
+        {
+          m_recent[0] = m_recent[1];
+          m_recent_length = 1;
+        }
+        m_recent[m_recent_length++] = c;
+      }
+      break;
+    case STATE_CDATA:
+      // the contents are text - hold back the last two characters in case
+      // they turn out to be the end of the section
+      if (c == '>' && recent_ends_with("]]"))
+      {
+        m_state = STATE_TEXT;
+      }
+      else
+      {
+        if (m_recent_length == 2)
+        {
+          if (m_skip_depth == 0)
+          {
+            text_char(m_recent[0]);
+          }
+          m_recent[0] = m_recent[1];
+          m_recent_length = 1;
+        }
+        m_recent[m_recent_length++] = c;
+      }
+      break;
+    case STATE_DOCTYPE:
+      if (c == '[')
+      {
+        m_doctype_depth++;
+      }
+      else if (c == ']')
+      {
+        m_doctype_depth--;
+      }
+      else if (c == '>' && m_doctype_depth <= 0)
+      {
+        m_state = STATE_TEXT;
+      }
+      break;
+    case STATE_PROCESSING_INSTRUCTION:
+      if (c == '>' && m_recent_length == 1 && m_recent[0] == '?')
+      {
+        m_state = STATE_TEXT;
+      }
+      m_recent[0] = c;
+      m_recent_length = 1;
+      break;
+    case STATE_START_TAG_NAME:
+      if (is_space(c) || c == '/' || c == '>')
+      {
+        tag_char('\0');
+        m_state = STATE_BEFORE_ATTRIBUTE;
+        consumed = false;
+      }
+      else
+      {
+        tag_char(c);
+      }
+      break;
+    case STATE_BEFORE_ATTRIBUTE:
+      if (c == '/')
+      {
+        m_state = STATE_SELF_CLOSING;
+      }
+      else if (c == '>')
+      {
+        m_state = STATE_TEXT;
+        finish_start_tag(false);
+      }
+      else if (!is_space(c))
+      {
+        tag_char(c);
+        m_state = STATE_ATTRIBUTE_NAME;
+      }
+      break;
+    case STATE_ATTRIBUTE_NAME:
+      if (c == '=')
+      {
+        tag_char('\0');
+        m_state = STATE_BEFORE_ATTRIBUTE_VALUE;
+      }
+      else if (is_space(c))
+      {
+        tag_char('\0');
+        m_state = STATE_AFTER_ATTRIBUTE_NAME;
+      }
+      else if (c == '/' || c == '>')
+      {
+        // an attribute with no value
+        tag_char('\0');
+        tag_char('\0');
+        m_state = STATE_BEFORE_ATTRIBUTE;
+        consumed = false;
+      }
+      else
+      {
+        tag_char(c);
+      }
+      break;
+    case STATE_AFTER_ATTRIBUTE_NAME:
+      if (c == '=')
+      {
+        m_state = STATE_BEFORE_ATTRIBUTE_VALUE;
+      }
+      else if (!is_space(c))
+      {
+        // the last attribute had no value
+        tag_char('\0');
+        m_state = STATE_BEFORE_ATTRIBUTE;
+        consumed = false;
+      }
+      break;
+    case STATE_BEFORE_ATTRIBUTE_VALUE:
+      if (c == '"' || c == '\'')
+      {
+        m_quote = c;
+        m_value_start = m_tag_length;
+        m_state = STATE_ATTRIBUTE_VALUE_QUOTED;
+      }
+      else if (c == '>')
+      {
+        tag_char('\0');
+        m_state = STATE_BEFORE_ATTRIBUTE;
+        consumed = false;
+      }
+      else if (!is_space(c))
+      {
+        m_value_start = m_tag_length;
+        tag_char(c);
+        m_state = STATE_ATTRIBUTE_VALUE_UNQUOTED;
+      }
+      break;
+    case STATE_ATTRIBUTE_VALUE_QUOTED:
+      if (c == m_quote)
+      {
+        end_attribute_value();
+        m_state = STATE_BEFORE_ATTRIBUTE;
+      }
+      else
+      {
+        tag_char(c);
+      }
+      break;
+    case STATE_ATTRIBUTE_VALUE_UNQUOTED:
+      if (is_space(c) || c == '>')
+      {
+        end_attribute_value();
+        m_state = STATE_BEFORE_ATTRIBUTE;
+        consumed = false;
+      }
+      else
+      {
+        tag_char(c);
+      }
+      break;
+    case STATE_SELF_CLOSING:
+      if (c == '>')
+      {
+        m_state = STATE_TEXT;
+        finish_start_tag(true);
+      }
+      else if (!is_space(c))
+      {
+        // a stray '/' in the middle of the tag
+        m_state = STATE_BEFORE_ATTRIBUTE;
+        consumed = false;
+      }
+      break;
+    case STATE_END_TAG_NAME:
+      if (c == '>')
+      {
+        m_state = STATE_TEXT;
+        finish_end_tag();
+      }
+      else if (is_space(c))
+      {
+        m_state = STATE_END_TAG_REST;
+      }
+      else
+      {
+        tag_char(c);
+      }
+      break;
+    case STATE_END_TAG_REST:
+      if (c == '>')
+      {
+        m_state = STATE_TEXT;
+        finish_end_tag();
+      }
+      break;
+    }
+    if (consumed)
+    {
+      i++;
+    }
+  }
+}
+
+void XhtmlTokenizer::finish()
+{
+  if (m_state == STATE_TAG_OPEN && m_skip_depth == 0)
+  {
+    text_char('<');
+  }
+  flush_text(true);
+  m_state = STATE_TEXT;
+}
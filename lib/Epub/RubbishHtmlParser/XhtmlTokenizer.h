@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// the attributes of the tag that has just been opened - only valid for the
+// duration of the enter_node call
+class XhtmlAttributes
+{
+private:
+  const char *m_start;
+  const char *m_end;
+
+public:
+  XhtmlAttributes(const char *start, const char *end) : m_start(start), m_end(end) {}
+  // returns "" if the attribute isn't there
+  const char *get(const char *name) const;
+};
+
+// receives the parts of the document as the tokenizer finds them
+class XhtmlHandler
+{
+public:
+  virtual ~XhtmlHandler() {}
+  // return false to skip everything inside the element
+  virtual bool enter_node(const char *tag_name, const XhtmlAttributes &attributes) = 0;
+  // text may arrive in more than one piece but is only ever split at whitespace
+  // (unless a single word fills the whole text buffer)
+  virtual void visit_text(const char *text, size_t length) = 0;
+  virtual void exit_node(const char *tag_name) = 0;
+};
+
+// A forgiving event driven XHTML tokenizer. Data can be fed in chunks of any
+// size and the handler is called as soon as each tag or run of text is
+// complete, so memory use is fixed no matter how large the document is or
+// how deeply it is nested. Comments, processing instructions and the doctype
+// are dropped. Entities in attribute values are decoded (just the XML ones)
+// but text is passed through as it is. Names and values that don't fit in
+// the tag buffer are truncated.
+class XhtmlTokenizer
+{
+public:
+  static const size_t TAG_BUFFER_SIZE = 1024;
+  static const size_t TEXT_BUFFER_SIZE = 1024;
+
+private:
+  typedef enum
+  {
+    STATE_TEXT,
+    STATE_TAG_OPEN,
+    STATE_MARKUP_DECLARATION,
+    STATE_COMMENT,
+    STATE_CDATA,
+    STATE_DOCTYPE,
+    STATE_PROCESSING_INSTRUCTION,
+    STATE_START_TAG_NAME,
+    STATE_END_TAG_NAME,
+    STATE_END_TAG_REST,
+    STATE_BEFORE_ATTRIBUTE,
+    STATE_ATTRIBUTE_NAME,
+    STATE_AFTER_ATTRIBUTE_NAME,
+    STATE_BEFORE_ATTRIBUTE_VALUE,
+    STATE_ATTRIBUTE_VALUE_QUOTED,
+    STATE_ATTRIBUTE_VALUE_UNQUOTED,
+    STATE_SELF_CLOSING,
+  } TOKENIZER_STATE;
+
+  XhtmlHandler &m_handler;
+  TOKENIZER_STATE m_state = STATE_TEXT;
+  // the tag name followed by name\0value\0 pairs for each attribute
+  char m_tag[TAG_BUFFER_SIZE];
+  size_t m_tag_length = 0;
+  // where the value of the attribute being read starts
+  size_t m_value_start = 0;
+  char m_quote = 0;
+  char m_text[TEXT_BUFFER_SIZE + 1];
+  size_t m_text_length = 0;
+  // the last few characters of a comment, cdata section or declaration
+  char m_recent[9];
+  size_t m_recent_length = 0;
+  int m_doctype_depth = 0;
+  // depth inside an element whose contents are being skipped
+  int m_skip_depth = 0;
+
+  void tag_char(char c);
+  void text_char(char c);
+  void flush_text(bool everything);
+  bool recent_ends_with(const char *suffix) const;
+  void end_attribute_value();
+  void finish_start_tag(bool self_closing);
+  void finish_end_tag();
+
+public:
+  XhtmlTokenizer(XhtmlHandler &handler) : m_handler(handler) {}
+  void feed(const char *data, size_t length);
+  // deliver any text that's still buffered at the end of the document
+  void finish();
+};
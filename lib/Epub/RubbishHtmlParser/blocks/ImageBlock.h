@@ -2,6 +2,7 @@
 #include "../../Renderer/Renderer.h"
 #include "Block.h"
 #include "../../EpubList/Epub.h"
+#include "../../ZipFile/ZipFile.h"
 #include <algorithm>
 #include <vector>
 #ifndef UNIT_TEST
@@ -95,8 +96,37 @@ public:
       return;
     }
 
-    size_t uncompressed_size = epub->get_item_uncompressed_size(m_src);
-    if (uncompressed_size > kMaxImageBytes)
+    // stored images (most jpegs and pngs) are decoded straight off the SD
+    // card so they never need a copy in memory, however big they are - the
+    // index says which they are so a deflated image doesn't open a stream
+    size_t uncompressed_size = 0;
+    bool stored = false;
+    if (!epub->get_item_info(m_src, &uncompressed_size, &stored))
+    {
+      draw_placeholder(renderer, y_pos);
+      return;
+    }
+    ZipEntryStream *stream = stored ? epub->open_item_stream(m_src) : nullptr;
+    if (stream)
+    {
+      if (src_width <= 0 || src_height <= 0)
+      {
+        int tmp_w = 0;
+        int tmp_h = 0;
+        if (renderer->get_image_size(m_src, stream, &tmp_w, &tmp_h))
+        {
+          src_width = tmp_w;
+          src_height = tmp_h;
+        }
+      }
+      int draw_x, draw_y, draw_w, draw_h;
+      get_draw_box(renderer, y_pos, &draw_x, &draw_y, &draw_w, &draw_h);
+      renderer->draw_image(m_src, stream, draw_x, draw_y, draw_w, draw_h);
+      stream->close();
+      delete stream;
+      return;
+    }
+    if (uncompressed_size == 0 || uncompressed_size > kMaxImageBytes)
     {
       draw_placeholder(renderer, y_pos);
       return;
@@ -115,42 +145,19 @@ public:
       return;
     }
 
-    int img_w = src_width;
-    int img_h = src_height;
-    if (img_w <= 0 || img_h <= 0)
+    if (src_width <= 0 || src_height <= 0)
     {
       int tmp_w = 0;
       int tmp_h = 0;
       if (renderer->get_image_size(m_src, data, data_size, &tmp_w, &tmp_h))
       {
-        img_w = tmp_w;
-        img_h = tmp_h;
-        src_width = img_w;
-        src_height = img_h;
+        src_width = tmp_w;
+        src_height = tmp_h;
       }
     }
 
-    int draw_w = width;
-    int draw_h = height;
-    int draw_x = x_pos;
-    int draw_y = y_pos;
-
-    if (img_w > 0 && img_h > 0)
-    {
-      float scale_w = static_cast<float>(width) / static_cast<float>(img_w);
-      float scale_h = static_cast<float>(height) / static_cast<float>(img_h);
-      float scale = std::min(scale_w, scale_h); // fit box, allow letterbox
-      draw_w = std::max(1, static_cast<int>(img_w * scale));
-      draw_h = std::max(1, static_cast<int>(img_h * scale));
-      draw_x = x_pos + (width - draw_w) / 2;
-      draw_y = y_pos + (height - draw_h) / 2;
-    }
-
-    if (renderer)
-    {
-      draw_x += renderer->get_margin_left();
-      draw_y += renderer->get_margin_top();
-    }
+    int draw_x, draw_y, draw_w, draw_h;
+    get_draw_box(renderer, y_pos, &draw_x, &draw_y, &draw_w, &draw_h);
     renderer->draw_image(m_src, data, data_size, draw_x, draw_y, draw_w, draw_h);
 
     if (!cached)
@@ -177,12 +184,32 @@ private:
     uint32_t last_used;
   };
 
+  // fit the image into our box keeping its aspect ratio
+  void get_draw_box(Renderer *renderer, int y_pos, int *draw_x, int *draw_y, int *draw_w, int *draw_h)
+  {
+    *draw_w = width;
+    *draw_h = height;
+    *draw_x = x_pos;
+    *draw_y = y_pos;
+    if (src_width > 0 && src_height > 0)
+    {
+      float scale_w = static_cast<float>(width) / static_cast<float>(src_width);
+      float scale_h = static_cast<float>(height) / static_cast<float>(src_height);
+      float scale = std::min(scale_w, scale_h); // fit box, allow letterbox
+      *draw_w = std::max(1, static_cast<int>(src_width * scale));
+      *draw_h = std::max(1, static_cast<int>(src_height * scale));
+      *draw_x = x_pos + (width - *draw_w) / 2;
+      *draw_y = y_pos + (height - *draw_h) / 2;
+    }
+    *draw_x += renderer->get_margin_left();
+    *draw_y += renderer->get_margin_top();
+  }
+
   void layout_placeholder(Renderer *renderer)
   {
     std::string display_text = get_display_name();
     int line_height = renderer->get_line_height();
     int page_width = renderer->get_page_width();
-    int page_height = renderer->get_page_height();
 
     width = (page_width * 80) / 100;
     height = std::max(100, line_height * 3);
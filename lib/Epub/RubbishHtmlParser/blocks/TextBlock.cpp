@@ -1,7 +1,9 @@
 #include <string.h>
 #include <stdlib.h>
-#include <limits.h>
+#include <algorithm>
 #include "TextBlock.h"
+#include "../LineBreaker.h"
+#include "../../EpubList/Epub.h"
 #ifndef UNIT_TEST
 #include <esp_log.h>
 #else
@@ -18,7 +20,7 @@ static bool is_whitespace(char c)
 }
 
 // move past anything that should be considered part of a work
-static int skip_word(const char *text, int index, int length)
+static size_t skip_word(const char *text, size_t index, size_t length)
 {
   while (index < length && !is_whitespace(text[index]))
   {
@@ -28,7 +30,7 @@ static int skip_word(const char *text, int index, int length)
 }
 
 // skip past any white space characters
-static int skip_whitespace(const char *html, int index, int length)
+static size_t skip_whitespace(const char *html, size_t index, size_t length)
 {
   while (index < length && is_whitespace(html[index]))
   {
@@ -39,221 +41,411 @@ static int skip_whitespace(const char *html, int index, int length)
 
 void TextBlock::add_span(const char *span, bool is_bold, bool is_italic)
 {
-  // adding a span to text block
-  // make a copy of the text as we'll modify it
-  int length = strlen(span);
-  char *text = new char[length + 1];
-  strcpy(text, span);
-  spans.push_back(text);
-  // work out where each word is in the span
-  int index = 0;
+  size_t length = strlen(span);
+  uint32_t offset;
+  if (m_text->append(span, length, &offset))
+  {
+    add_words(offset, length, is_bold, is_italic);
+  }
+}
+
+void TextBlock::add_words(uint32_t offset, size_t length, bool is_bold, bool is_italic)
+{
+  if (m_word_end != m_words->get_count())
+  {
+    ESP_LOGE("TextBlock", "Can only add words to the newest block");
+    return;
+  }
+  char *text = m_text->get(offset);
+  uint8_t style = (is_bold ? BOLD_SPAN : 0) | (is_italic ? ITALIC_SPAN : 0);
+  // work out where each word is in the span - the words are packed down to
+  // the start of the span as we go so no whitespace is kept
+  size_t index = 0;
+  size_t packed = 0;
   while (index < length)
   {
     // skip past any whitespace to the start of a word
-    index = skip_whitespace(span, index, length);
-    int word_start = index;
+    index = skip_whitespace(text, index, length);
+    size_t word_start = index;
     // find the end of the word
-    index = skip_word(span, index, length);
-    int word_length = index - word_start;
+    index = skip_word(text, index, length);
+    size_t word_length = index - word_start;
     if (word_length > 0)
     {
-      // null terminate the word
-      text[word_start + word_length] = '\0';
+      memmove(text + packed, text + word_start, word_length);
+      // null terminate the word - this may land on the whitespace we
+      // stopped at so step past it
+      text[packed + word_length] = '\0';
+      index++;
       // store the information about the word for later
-      words.push_back(text + word_start);
-      // store the style for the word
-      word_styles.push_back((is_bold ? BOLD_SPAN : 0) | (is_italic ? ITALIC_SPAN : 0));
+      if (!m_words->add(offset + packed, style))
+      {
+        ESP_LOGE("TextBlock", "Out of memory for words");
+        break;
+      }
+      m_word_end++;
+      packed += word_length + 1;
     }
   }
+  // give back the whitespace
+  m_text->truncate(offset + packed);
+}
+
+void TextBlock::set_spacing(const CssStyle &css)
+{
+  // we don't do negative margins
+  margin_top = !css.has(CSS_MARGIN_TOP) ? -1 : (css.margin_top > 0 ? css.margin_top : 0);
+  margin_bottom = !css.has(CSS_MARGIN_BOTTOM) ? -1 : (css.margin_bottom > 0 ? css.margin_bottom : 0);
+  margin_left = css.margin_left > 0 ? css.margin_left : 0;
+  margin_right = css.margin_right > 0 ? css.margin_right : 0;
+  text_indent = css.text_indent;
 }
+
+int TextBlock::get_space_before(int line_height)
+{
+  return margin_top > 0 ? margin_top * line_height / 100 : 0;
+}
+
+int TextBlock::get_space_after(int line_height)
+{
+  return margin_bottom >= 0 ? margin_bottom * line_height / 100 : line_height / 2;
+}
+
 // given a renderer works out where to break the words into lines
-void TextBlock::layout(Renderer *renderer, Epub *epub, int max_width)
+void TextBlock::layout(Renderer *renderer, Epub *epub, int max_width, LineBreaker *line_breaker)
 {
-  // measure each word
-  for (int i = 0; i < words.size(); i++)
+  if (!m_measured)
   {
-    // measure the word
-    int width = renderer->get_text_width(words[i], word_styles[i] & BOLD_SPAN, word_styles[i] & ITALIC_SPAN);
-    word_widths.push_back(width);
+    // headings and the like look odd hyphenated
+    const Hyphenator *hyphenator = epub && (style == JUSTIFIED || style == LEFT_ALIGN) ? epub->get_hyphenator() : nullptr;
+    measure(renderer, hyphenator);
+    if (!m_measured)
+    {
+      return;
+    }
   }
-
   int page_width = max_width != -1 ? max_width : renderer->get_page_width();
   int space_width = renderer->get_space_width();
+  // the margins and indent from the stylesheet - ignored if they would
+  // leave too little room for the text
+  int em = renderer->get_base_line_height();
+  int left = margin_left * em / 100;
+  int right = margin_right * em / 100;
+  if (left + right > page_width / 2)
+  {
+    left = 0;
+    right = 0;
+  }
+  page_width -= left + right;
+  int indent = text_indent * em / 100;
+  if (indent > page_width / 2 || indent < -left)
+  {
+    indent = 0;
+  }
+  // the words are the same width so the lines only change if the space does
+  if (!m_lines_valid || left != m_line_left || page_width != m_line_width || indent != m_line_indent || space_width != m_space_width)
+  {
+    break_lines(left, page_width, indent, space_width, line_breaker);
+  }
+}
 
-  // now apply the dynamic programming algorithm to find the best line breaks
-  int n = word_widths.size();
-  if (n <= 0)
+void TextBlock::measure(Renderer *renderer, const Hyphenator *hyphenator)
+{
+  m_lines_valid = false;
+  if (m_words->widths.size() < m_word_end && (!m_words->widths.resize(m_words->get_count()) || !m_words->xpos.resize(m_words->get_count())))
   {
+    ESP_LOGE("TextBlock", "Out of memory for word widths");
     return;
   }
-
-  // DP table in which dp[i] represents cost of line starting with word words[i]
-  std::vector<int> dp(static_cast<size_t>(n));
-
-  // Array in which ans[i] store index of last word in line starting with word word[i]
-  std::vector<size_t> ans(static_cast<size_t>(n));
-
-  // If only one word is present then only one line is required. Cost of last line is zero. Hence cost
-  // of this line is zero. Ending point is also n-1 as single word is present
-  dp[n - 1] = 0;
-  ans[n - 1] = n - 1;
-
-  // Make each word first word of line by iterating over each index in arr.
-  for (int i = n - 2; i >= 0; i--)
+  uint16_t *word_widths = m_words->widths.data();
+  for (uint32_t i = m_word_begin; i < m_word_end; i++)
   {
-    int currlen = -1;
-    dp[i] = INT_MAX;
-
-    // Variable to store possible minimum cost of line.
-    int cost;
-
-    // Keep on adding words in current line by iterating from starting word upto last word in arr.
-    for (int j = i; j < n; j++)
+    uint8_t word_style = m_words->get_style(i);
+    word_widths[i] = renderer->get_word_width(m_text->get(m_words->get_offset(i)), word_style & BOLD_SPAN, word_style & ITALIC_SPAN);
+  }
+  // measuring again replaces our hyphens if nothing has been measured
+  // since - otherwise the new ones go on the end
+  SectionArray<uint32_t> &hyphens = m_words->hyphens;
+  if (m_hyphen_end != hyphens.size() || m_hyphen_end == m_hyphen_begin)
+  {
+    m_hyphen_begin = hyphens.size();
+  }
+  hyphens.resize(m_hyphen_begin);
+  m_words->hyphen_widths.resize(m_hyphen_begin);
+  m_hyphen_end = m_hyphen_begin;
+  if (hyphenator)
+  {
+    size_t min_length = hyphenator->get_min_word_length();
+    uint8_t offsets[Hyphenator::MAX_WORD_LETTERS];
+    char head[256];
+    for (uint32_t i = m_word_begin; i < m_word_end; i++)
     {
-      // Update the width of the words in current line + the space between two words.
-      currlen += (word_widths[j] + space_width);
-
-      // If we're bigger than the current pagewidth then we can't add more words
-      if (currlen > page_width)
+      const char *word = m_text->get(m_words->get_offset(i));
+      if (strlen(word) < min_length)
+      {
+        continue;
+      }
+      int count = hyphenator->hyphenate(word, offsets, Hyphenator::MAX_WORD_LETTERS);
+      uint8_t word_style = m_words->get_style(i);
+      if (count > 0 && m_hyphen_widths[word_style] == 0)
       {
-        // If even a single word is wider than the page, place it on
-        // its own line rather than leaving ans[i] uninitialized.
-        if (j == i)
+        m_hyphen_widths[word_style] = renderer->get_word_width("-", word_style & BOLD_SPAN, word_style & ITALIC_SPAN);
+      }
+      // each piece of the word gets measured on its own
+      int previous_width = 0;
+      for (int h = 0; h < count; h++)
+      {
+        memcpy(head, word, offsets[h]);
+        head[offsets[h]] = '\0';
+        int width = renderer->get_word_width(head, word_style & BOLD_SPAN, word_style & ITALIC_SPAN);
+        width = std::min(std::max(width, previous_width), static_cast<int>(m_words->widths[i]));
+        previous_width = width;
+        if (!m_words->add_hyphen(i, offsets[h], width))
         {
-          // Treat this overlong word as a line by itself.
-          int cost;
-          if (j == n - 1)
-          {
-            cost = 0;
-          }
-          else
-          {
-            // No leftover space: clamp to page_width so the cost term
-            // is small but finite.
-            cost = dp[j + 1];
-          }
-          if (cost < dp[i])
-          {
-            dp[i] = cost;
-            ans[i] = j;
-          }
+          ESP_LOGE("TextBlock", "Out of memory for hyphens");
+          // leave the arrays the same size
+          hyphens.resize(m_hyphen_end);
+          m_words->hyphen_widths.resize(m_hyphen_end);
+          break;
         }
-        break;
+        m_hyphen_end++;
       }
+    }
+  }
+  m_measured = true;
+}
 
-      // if we've run out of words then this is last line and the cost should be 0
-      // Otherwise the cost is the sqaure of the left over space + the costs of all the previous lines
-      if (j == n - 1)
-        cost = 0;
-      else
-        cost = (page_width - currlen) * (page_width - currlen) + dp[j + 1];
+// what breaking at a hyphen costs - TeX's default
+static const int HYPHEN_PENALTY = 50;
 
-      // Check if this arrangement gives minimum cost for line starting with word words[i].
-      if (cost < dp[i])
-      {
-        dp[i] = cost;
-        ans[i] = j;
-      }
+void TextBlock::break_lines(int left, int page_width, int indent, int space_width, LineBreaker *line_breaker)
+{
+  // breaking again replaces our lines if nothing has been laid out since -
+  // otherwise the new lines go on the end
+  if (m_line_end != m_words->line_ends.size() || m_line_end == m_line_begin)
+  {
+    m_line_begin = m_words->line_ends.size();
+  }
+  m_words->set_line_count(m_line_begin);
+  m_line_end = m_line_begin;
+  m_line_left = left;
+  m_line_width = page_width;
+  m_line_indent = indent;
+  m_space_width = space_width;
+  m_lines_valid = true;
+  if (m_word_end == m_word_begin)
+  {
+    return;
+  }
+  const uint16_t *word_widths = m_words->widths.data();
+  LineBreaker own_breaker;
+  LineBreaker &breaker = line_breaker ? *line_breaker : own_breaker;
+  breaker.start();
+  // the indent takes up room on the first line
+  if (indent > 0)
+  {
+    breaker.add_box(indent, m_word_begin);
+  }
+  // the spaces can stretch by half and shrink by a third - the lines don't
+  // depend on the alignment so changing it only moves the words
+  int stretch = (space_width + 1) / 2;
+  int shrink = space_width / 3;
+  uint32_t hyphen = m_hyphen_begin;
+  for (uint32_t word = m_word_begin; word < m_word_end; word++)
+  {
+    // the pieces of the word between the places it can be hyphenated
+    int piece_left = 0;
+    while (hyphen < m_hyphen_end && (m_words->hyphens[hyphen] >> SectionWords::SPLIT_BITS) == word)
+    {
+      int piece_right = m_words->hyphen_widths[hyphen];
+      breaker.add_box(piece_right - piece_left, word);
+      breaker.add_penalty(m_hyphen_widths[m_words->get_style(word)], HYPHEN_PENALTY, true, hyphen);
+      piece_left = piece_right;
+      hyphen++;
     }
-
-    // As an additional safety net, if we somehow failed to assign a
-    // finite cost for this starting word, force it to advance by at
-    // least one word so that ans[i] is always within [i, n-1].
-    if (dp[i] == INT_MAX)
+    breaker.add_box(word_widths[word] - piece_left, word);
+    if (word + 1 < m_word_end)
     {
-      dp[i] = 0;
-      ans[i] = (i + 1 < n) ? static_cast<size_t>(i + 1) : static_cast<size_t>(n - 1);
+      breaker.add_glue(space_width, stretch, shrink, word);
     }
   }
-  // We can now iterate through the answer to find the line break positions
-  size_t i = 0;
-  while (i < n)
+  breaker.add_penalty(0, -LineBreaker::INFINITE_PENALTY, false, m_word_end - 1);
+  if (!breaker.break_lines(page_width))
   {
-    i = ans[i] + 1;
-    if (i > n)
+    ESP_LOGE("TextBlock", "Failed to break lines");
+    return;
+  }
+  // the lines end at a space after a word or at a hyphen part way through one
+  int split_word = -1;
+  int split_right = 0;
+  for (int line = 0; line < breaker.get_line_count(); line++)
+  {
+    const LineItem &end = breaker.get_line_end(line);
+    LineSplit split = {0, 0, 0};
+    bool added;
+    if (end.flagged)
     {
-      ESP_LOGI("TextBlock", "fallen off the end of the words");
-      dump();
-
-      for (int x = 0; x < n; x++)
-      {
-        ESP_LOGI("TextBlock", "line break %d=>%d", x, ans[x]);
-      }
-      break;
+      uint32_t word = m_words->hyphens[end.data] >> SectionWords::SPLIT_BITS;
+      int right = m_words->hyphen_widths[end.data];
+      // the head might have started on the line before
+      int head_left = split_word == static_cast<int>(word) ? split_right : 0;
+      split.head_width = right - head_left + m_hyphen_widths[m_words->get_style(word)];
+      split.tail_width = word_widths[word] - right;
+      added = m_words->add_line(word, m_words->hyphens[end.data] & SectionWords::SPLIT_MASK, split);
+      split_word = word;
+      split_right = right;
     }
-    line_breaks.push_back(i);
-    if (line_breaks.size() > 1000)
+    else
     {
-      ESP_LOGE("TextBlock", "too many line breaks");
-      dump();
-
-      for (int x = 0; x < n; x++)
-      {
-        ESP_LOGI("TextBlock", "line break %d=>%d", x, ans[x]);
-      }
+      added = m_words->add_line(end.data + 1, 0, split);
+      split_word = -1;
+    }
+    if (!added)
+    {
+      ESP_LOGE("TextBlock", "Out of memory for lines");
       break;
     }
+    m_line_end++;
   }
-  // With the page breaks calculated we can now position the words along the line
-  int start_word = 0;
-  for (int i = 0; i < line_breaks.size(); i++)
+  position_words();
+}
+
+// the positions depend on the alignment, so changing that only needs this
+void TextBlock::position_words()
+{
+  if (!m_lines_valid)
   {
-    int total_word_width = 0;
-    for (int word_index = start_word; word_index < line_breaks[i]; word_index++)
+    return;
+  }
+  const uint16_t *word_widths = m_words->widths.data();
+  uint16_t *word_xpos = m_words->xpos.data();
+  uint32_t start_word = m_word_begin;
+  // the rest of a word that was split at the end of the line before
+  int tail_width = -1;
+  for (uint32_t line = m_line_begin; line < m_line_end; line++)
+  {
+    uint32_t end_word = m_words->get_line_end_word(line);
+    bool has_head = m_words->get_line_end_split(line) != 0;
+    LineSplit &split = m_words->line_splits[line];
+    int line_indent = line == m_line_begin ? m_line_indent : 0;
+    int total_word_width = line_indent + (has_head ? split.head_width : 0);
+    for (uint32_t word_index = start_word; word_index < end_word; word_index++)
     {
-      total_word_width += word_widths[word_index];
+      total_word_width += word_index == start_word && tail_width >= 0 ? tail_width : word_widths[word_index];
     }
-    float spare_space = page_width - total_word_width;
-    float actual_spacing = space_width;
-    int number_words = line_breaks[i] - start_word;
-    // don't add space if we are on the last line and we are not justified text
-    if (i != line_breaks.size() - 1 && style == JUSTIFIED)
+    float spare_space = m_line_width - total_word_width;
+    float actual_spacing = m_space_width;
+    int number_words = end_word - start_word + (has_head ? 1 : 0);
+    // don't add space if we are on the last line and we are not justified
+    // text - but the line breaker can squeeze the spaces on any line
+    if (number_words > 1 && ((line != m_line_end - 1 && style == JUSTIFIED) || spare_space < (number_words - 1) * m_space_width))
     {
-      if (line_breaks[i] - start_word > 1)
-      {
-        actual_spacing = spare_space / float(number_words - 1);
-      }
+      actual_spacing = spare_space / float(number_words - 1);
     }
-    float xpos = 0;
+    float xpos = m_line_left + line_indent;
     if (style == RIGHT_ALIGN)
     {
-      xpos = spare_space - (number_words - 1) * space_width;
+      xpos = m_line_left + line_indent + spare_space - (number_words - 1) * actual_spacing;
     }
     if (style == CENTER_ALIGN)
     {
-      xpos = (spare_space - (number_words - 1) * space_width) / 2;
+      xpos = m_line_left + line_indent + (spare_space - (number_words - 1) * actual_spacing) / 2;
     }
-    word_xpos.resize(words.size());
-    for (int word_index = start_word; word_index < line_breaks[i]; word_index++)
+    for (uint32_t word_index = start_word; word_index < end_word; word_index++)
     {
       word_xpos[word_index] = xpos;
-      xpos += word_widths[word_index] + actual_spacing;
+      xpos += (word_index == start_word && tail_width >= 0 ? tail_width : word_widths[word_index]) + actual_spacing;
+    }
+    if (has_head)
+    {
+      split.head_xpos = xpos;
     }
-    start_word = line_breaks[i];
+    tail_width = has_head ? split.tail_width : -1;
+    start_word = end_word;
+  }
+}
+
+int TextBlock::get_line_start_word(int line_break_index)
+{
+  if (line_break_index <= 0 || line_break_index >= get_line_count())
+  {
+    return 0;
   }
-  spans.shrink_to_fit();
-  words.shrink_to_fit();
-  word_widths.shrink_to_fit();
-  word_xpos.shrink_to_fit();
-  word_styles.shrink_to_fit();
+  return m_words->get_line_end_word(m_line_begin + line_break_index - 1) - m_word_begin;
 }
+
+int TextBlock::find_line(int word_index)
+{
+  // the last line starting at or before the word
+  int line = 0;
+  while (line + 1 < get_line_count() && get_line_start_word(line + 1) <= word_index)
+  {
+    line++;
+  }
+  return line;
+}
+
+// copies the piece of a word before a split and puts a hyphen on the end
+static const char *hyphenated_head(const char *word, uint8_t start, uint8_t end, char *head)
+{
+  memcpy(head, word + start, end - start);
+  head[end - start] = '-';
+  head[end - start + 1] = '\0';
+  return head;
+}
+
 void TextBlock::render(Renderer *renderer, int line_break_index, int x_pos, int y_pos)
 {
-  int start = line_break_index == 0 ? 0 : line_breaks[line_break_index - 1];
-  int end = line_breaks[line_break_index];
-  for (int i = start; i < end; i++)
+  uint32_t line = m_line_begin + line_break_index;
+  uint32_t start = line_break_index == 0 ? m_word_begin : m_words->get_line_end_word(line - 1);
+  uint8_t start_split = line_break_index == 0 ? 0 : m_words->get_line_end_split(line - 1);
+  uint32_t end = m_words->get_line_end_word(line);
+  uint8_t end_split = m_words->get_line_end_split(line);
+  for (uint32_t i = start; i < end; i++)
   {
     // get the style
-    uint8_t style = word_styles[i];
-    // render the word
-    renderer->draw_text(x_pos + word_xpos[i], y_pos, words[i], style & BOLD_SPAN, style & ITALIC_SPAN);
+    uint8_t style = m_words->get_style(i);
+    // render the word - or what's left of it after the line before
+    const char *word = m_text->get(m_words->get_offset(i)) + (i == start ? start_split : 0);
+    renderer->draw_text(x_pos + m_words->xpos[i], y_pos, word, style & BOLD_SPAN, style & ITALIC_SPAN);
+  }
+  if (end_split)
+  {
+    uint8_t style = m_words->get_style(end);
+    char head[258];
+    const char *word = m_text->get(m_words->get_offset(end));
+    hyphenated_head(word, end == start ? start_split : 0, end_split, head);
+    renderer->draw_text(x_pos + m_words->line_splits[line].head_xpos, y_pos, head, style & BOLD_SPAN, style & ITALIC_SPAN);
   }
 }
+
+std::string TextBlock::get_line_text(int line_break_index)
+{
+  uint32_t line = m_line_begin + line_break_index;
+  uint32_t start = line_break_index == 0 ? m_word_begin : m_words->get_line_end_word(line - 1);
+  uint8_t start_split = line_break_index == 0 ? 0 : m_words->get_line_end_split(line - 1);
+  uint32_t end = m_words->get_line_end_word(line);
+  uint8_t end_split = m_words->get_line_end_split(line);
+  std::string text;
+  for (uint32_t i = start; i < end; i++)
+  {
+    text += text.empty() ? "" : " ";
+    text += m_text->get(m_words->get_offset(i)) + (i == start ? start_split : 0);
+  }
+  if (end_split)
+  {
+    char head[258];
+    text += text.empty() ? "" : " ";
+    text += hyphenated_head(m_text->get(m_words->get_offset(end)), end == start ? start_split : 0, end_split, head);
+  }
+  return text;
+}
+
 // debug helper - dumps out the contents of the block with line breaks
 void TextBlock::dump()
 {
-  for (int i = 0; i < words.size(); i++)
+  for (uint32_t i = m_word_begin; i < m_word_end; i++)
   {
-    printf("##%d#%s## ", word_widths[i], words[i]);
+    printf("##%d#%s## ", i < m_words->widths.size() ? m_words->widths[i] : 0, m_text->get(m_words->get_offset(i)));
   }
 }
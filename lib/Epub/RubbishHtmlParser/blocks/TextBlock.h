@@ -2,7 +2,14 @@
 
 #include "../../Renderer/Renderer.h"
 #include <vector>
+#include <string>
 #include "Block.h"
+#include "../SectionText.h"
+#include "../SectionWords.h"
+#include "../../Css/CssStyle.h"
+#include "../../Hyphenation/Hyphenator.h"
+
+class LineBreaker;
 
 typedef enum
 {
@@ -22,33 +29,68 @@ typedef enum
 class TextBlock : public Block
 {
 private:
-  // the spans of text in this block
-  std::vector<const char *> spans;
-  // pointer to each word
-  std::vector<const char *> words;
-  // width of each word
-  std::vector<uint16_t> word_widths;
-  // x position of each word
-  std::vector<uint16_t> word_xpos;
-  // the styles of each word
-  std::vector<uint8_t> word_styles;
+  // where the text and words live - shared with the rest of the section
+  SectionText *m_text;
+  SectionWords *m_words;
+  bool m_owns_section;
+  // the words and lines in m_words that belong to this block
+  uint32_t m_word_begin;
+  uint32_t m_word_end;
+  uint32_t m_line_begin = 0;
+  uint32_t m_line_end = 0;
+  // and the places its words can be hyphenated
+  uint32_t m_hyphen_begin = 0;
+  uint32_t m_hyphen_end = 0;
+  // how wide a hyphen is in each SPAN_STYLE
+  uint8_t m_hyphen_widths[4] = {0, 0, 0, 0};
 
   // the style of the block - left, center, right aligned
   BLOCK_STYLE style;
+  // paragraphs that don't ask for an alignment are justified or not
+  // depending on the reader's setting
+  bool m_follows_justification = false;
 
-public:
-  // where do we want to break the words into lines
-  std::vector<uint16_t> line_breaks;
+  // layout is done in phases - measuring the words, breaking them into lines
+  // and then positioning them along the lines - and each phase is only done
+  // again when something it depends on changes
+  bool m_measured = false;
+  bool m_lines_valid = false;
+  // the space the lines were broken to fit
+  int16_t m_line_left = 0;
+  int16_t m_line_width = 0;
+  int16_t m_line_indent = 0;
+  int16_t m_space_width = 0;
 
+  // spacing from the book's stylesheet in hundredths of an em - the space
+  // above and below is -1 if the stylesheet doesn't set it
+  css_length_t margin_top = -1;
+  css_length_t margin_bottom = -1;
+  css_length_t margin_left = 0;
+  css_length_t margin_right = 0;
+  css_length_t text_indent = 0;
+
+public:
   void add_span(const char *span, bool is_bold, bool is_italic);
-  TextBlock(BLOCK_STYLE style) : style(style)
+  // split the span that was just appended to the section text into words
+  void add_words(uint32_t offset, size_t length, bool is_bold, bool is_italic);
+  // blocks that aren't part of a section (e.g. titles) get their own text
+  // and words - otherwise pass in both. Only the newest block in a section
+  // can have words added to it.
+  TextBlock(BLOCK_STYLE style, SectionText *text = nullptr, SectionWords *words = nullptr)
+      : m_text(text ? text : new SectionText()),
+        m_words(words ? words : new SectionWords()),
+        m_owns_section(text == nullptr),
+        m_word_begin(m_words->get_count()),
+        m_word_end(m_word_begin),
+        style(style)
   {
   }
   ~TextBlock()
   {
-    for (auto span : spans)
+    if (m_owns_section)
     {
-      delete[] span;
+      delete m_text;
+      delete m_words;
     }
   }
   void set_style(BLOCK_STYLE style)
@@ -59,19 +101,102 @@ public:
   {
     return style;
   }
+  void set_follows_justification(bool follows)
+  {
+    m_follows_justification = follows;
+  }
+  bool follows_justification()
+  {
+    return m_follows_justification;
+  }
+  // take the margins and indent from the block's CSS
+  void set_spacing(const CssStyle &css);
+  // the gaps to leave above and below the block - we don't know how big
+  // the font is so the line height stands in for an em
+  int get_space_before(int line_height);
+  int get_space_after(int line_height);
   bool isEmpty()
   {
-    return spans.empty();
+    return m_word_end == m_word_begin;
+  }
+  // give back the spare word capacity once all the text has been added -
+  // the section does this for its blocks
+  void finish()
+  {
+    if (m_owns_section)
+    {
+      m_words->shrink_to_fit();
+    }
+  }
+  // given a renderer works out where to break the words into lines - the
+  // section passes in its line breaker so the scratch space is shared by
+  // all its blocks, otherwise the block makes its own
+  void layout(Renderer *renderer, Epub *epub, int max_width, LineBreaker *line_breaker);
+  void layout(Renderer *renderer, Epub *epub, int max_width = -1)
+  {
+    layout(renderer, epub, max_width, nullptr);
+  }
+  // the phases of layout - measure the words and the places they can be
+  // hyphenated, find the best line breaks for the space we've got and then
+  // work out where each word goes on its line
+  void measure(Renderer *renderer, const Hyphenator *hyphenator = nullptr);
+  void break_lines(int left, int page_width, int indent, int space_width, LineBreaker *line_breaker = nullptr);
+  void position_words();
+  // throw away the results of layout that depend on the font or the space
+  // available so they're worked out again - the section clears out all the
+  // lines when it does this
+  void invalidate_widths()
+  {
+    m_measured = false;
+    m_hyphen_begin = 0;
+    m_hyphen_end = 0;
+    invalidate_lines();
+  }
+  void invalidate_lines()
+  {
+    m_lines_valid = false;
+    m_line_begin = 0;
+    m_line_end = 0;
+  }
+  bool has_lines()
+  {
+    return m_lines_valid;
   }
-  // given a renderer works out where to break the words into lines
-  void layout(Renderer *renderer, Epub *epub, int max_width = -1);
   void render(Renderer *renderer, int line_break_index, int x_pos, int y_pos);
   // debug helper - dumps out the contents of the block with line breaks
   void dump();
   bool is_empty()
   {
-    return words.empty();
+    return m_word_end == m_word_begin;
+  }
+  int get_word_count()
+  {
+    return m_word_end - m_word_begin;
+  }
+  const char *get_word(int index)
+  {
+    return m_text->get(m_words->get_offset(m_word_begin + index));
+  }
+  uint8_t get_word_style(int index)
+  {
+    return m_words->get_style(m_word_begin + index);
+  }
+  // how many lines layout broke the words into
+  int get_line_count()
+  {
+    return m_line_end - m_line_begin;
+  }
+  // the word a line starts with, or starts part way through
+  int get_line_start_word(int line_break_index);
+  // the line that word starts on - or that the rest of it is on if it's split
+  int find_line(int word_index);
+  // how many places measuring found that words can be hyphenated
+  int get_hyphen_count()
+  {
+    return m_hyphen_end - m_hyphen_begin;
   }
+  // the text of a line as it's drawn - for debugging and tests
+  std::string get_line_text(int line_break_index);
   virtual BlockType getType()
   {
     return TEXT_BLOCK;
@@ -1,382 +1,450 @@
 #include "htmlEntities.h"
+#include "PerfectHash.h"
+#include "htmlEntityHash.h"
+#include <stdint.h>
+#include <string.h>
 #include <string>
-#include <unordered_map>
 
-const int MAX_ENTITY_LENGTH = 10;
+typedef struct
+{
+  const char *name;
+  uint8_t name_length;
+  const char *value;
+  uint8_t value_length;
+} HtmlEntity;
+
+#define ENTITY(name, value) {name, sizeof(name) - 1, value, sizeof(value) - 1}
 
 // Use book: entities_ww2.epub to test this (Page 7: Entities parser test)
-// Note the supported keys are only in lowercase
-// Store the mappings in a unordered hash map
-static std::unordered_map<std::string, std::string> entity_lookup(
-    {{"&quot;", "\""},
-     {"&frasl;", "⁄"},
-     {"&amp;", "&"},
-     {"&lt;", "<"},
-     {"&gt;", ">"},
-     {"&Agrave;", "À"},
-     {"&Aacute;", "Á"},
-     {"&Acirc;", "Â"},
-     {"&Atilde;", "Ã"},
-     {"&Auml;", "Ä"},
-     {"&Aring;", "Å"},
-     {"&AElig;", "Æ"},
-     {"&Ccedil;", "Ç"},
-     {"&Egrave;", "È"},
-     {"&Eacute;", "É"},
-     {"&Ecirc;", "Ê"},
-     {"&Euml;", "Ë"},
-     {"&Igrave;", "Ì"},
-     {"&Iacute;", "Í"},
-     {"&Icirc;", "Î"},
-     {"&Iuml;", "Ï"},
-     {"&ETH;", "Ð"},
-     {"&Ntilde;", "Ñ"},
-     {"&Ograve;", "Ò"},
-     {"&Oacute;", "Ó"},
-     {"&Ocirc;", "Ô"},
-     {"&Otilde;", "Õ"},
-     {"&Ouml;", "Ö"},
-     {"&Oslash;", "Ø"},
-     {"&Ugrave;", "Ù"},
-     {"&Uacute;", "Ú"},
-     {"&Ucirc;", "Û"},
-     {"&Uuml;", "Ü"},
-     {"&Yacute;", "Ý"},
-     {"&THORN;", "Þ"},
-     {"&szlig;", "ß"},
-     {"&agrave;", "à"},
-     {"&aacute;", "á"},
-     {"&acirc;", "â"},
-     {"&atilde;", "ã"},
-     {"&auml;", "ä"},
-     {"&aring;", "å"},
-     {"&aelig;", "æ"},
-     {"&ccedil;", "ç"},
-     {"&egrave;", "è"},
-     {"&eacute;", "é"},
-     {"&ecirc;", "ê"},
-     {"&euml;", "ë"},
-     {"&igrave;", "ì"},
-     {"&iacute;", "í"},
-     {"&icirc;", "î"},
-     {"&iuml;", "ï"},
-     {"&eth;", "ð"},
-     {"&ntilde;", "ñ"},
-     {"&ograve;", "ò"},
-     {"&oacute;", "ó"},
-     {"&ocirc;", "ô"},
-     {"&otilde;", "õ"},
-     {"&ouml;", "ö"},
-     {"&oslash;", "ø"},
-     {"&ugrave;", "ù"},
-     {"&uacute;", "ú"},
-     {"&ucirc;", "û"},
-     {"&uuml;", "ü"},
-     {"&yacute;", "ý"},
-     {"&thorn;", "þ"},
-     {"&yuml;", "ÿ"},
-     {"&nbsp;", " "},
-     {"&iexcl;", "¡"},
-     {"&cent;", "¢"},
-     {"&pound;", "£"},
-     {"&curren;", "¤"},
-     {"&yen;", "¥"},
-     {"&brvbar;", "¦"},
-     {"&sect;", "§"},
-     {"&uml;", "¨"},
-     {"&copy;", "©"},
-     {"&ordf;", "ª"},
-     {"&laquo;", "«"},
-     {"&not;", "¬"},
-     {"&shy;", "­"},
-     {"&reg;", "®"},
-     {"&macr;", "¯"},
-     {"&deg;", "°"},
-     {"&plusmn;", "±"},
-     {"&sup2;", "²"},
-     {"&sup3;", "³"},
-     {"&acute;", "´"},
-     {"&micro;", "µ"},
-     {"&para;", "¶"},
-     {"&cedil;", "¸"},
-     {"&sup1;", "¹"},
-     {"&ordm;", "º"},
-     {"&raquo;", "»"},
-     {"&frac14;", "¼"},
-     {"&frac12;", "½"},
-     {"&frac34;", "¾"},
-     {"&iquest;", "¿"},
-     {"&times;", "×"},
-     {"&divide;", "÷"},
-     {"&forall;", "∀"},
-     {"&part;", "∂"},
-     {"&exist;", "∃"},
-     {"&empty;", "∅"},
-     {"&nabla;", "∇"},
-     {"&isin;", "∈"},
-     {"&notin;", "∉"},
-     {"&ni;", "∋"},
-     {"&prod;", "∏"},
-     {"&sum;", "∑"},
-     {"&minus;", "−"},
-     {"&lowast;", "∗"},
-     {"&radic;", "√"},
-     {"&prop;", "∝"},
-     {"&infin;", "∞"},
-     {"&ang;", "∠"},
-     {"&and;", "∧"},
-     {"&or;", "∨"},
-     {"&cap;", "∩"},
-     {"&cup;", "∪"},
-     {"&int;", "∫"},
-     {"&there4;", "∴"},
-     {"&sim;", "∼"},
-     {"&cong;", "≅"},
-     {"&asymp;", "≈"},
-     {"&ne;", "≠"},
-     {"&equiv;", "≡"},
-     {"&le;", "≤"},
-     {"&ge;", "≥"},
-     {"&sub;", "⊂"},
-     {"&sup;", "⊃"},
-     {"&nsub;", "⊄"},
-     {"&sube;", "⊆"},
-     {"&supe;", "⊇"},
-     {"&oplus;", "⊕"},
-     {"&otimes;", "⊗"},
-     {"&perp;", "⊥"},
-     {"&sdot;", "⋅"},
-     {"&Alpha;", "Α"},
-     {"&Beta;", "Β"},
-     {"&Gamma;", "Γ"},
-     {"&Delta;", "Δ"},
-     {"&Epsilon;", "Ε"},
-     {"&Zeta;", "Ζ"},
-     {"&Eta;", "Η"},
-     {"&Theta;", "Θ"},
-     {"&Iota;", "Ι"},
-     {"&Kappa;", "Κ"},
-     {"&Lambda;", "Λ"},
-     {"&Mu;", "Μ"},
-     {"&Nu;", "Ν"},
-     {"&Xi;", "Ξ"},
-     {"&Omicron;", "Ο"},
-     {"&Pi;", "Π"},
-     {"&Rho;", "Ρ"},
-     {"&Sigma;", "Σ"},
-     {"&Tau;", "Τ"},
-     {"&Upsilon;", "Υ"},
-     {"&Phi;", "Φ"},
-     {"&Chi;", "Χ"},
-     {"&Psi;", "Ψ"},
-     {"&Omega;", "Ω"},
-     {"&alpha;", "α"},
-     {"&beta;", "β"},
-     {"&gamma;", "γ"},
-     {"&delta;", "δ"},
-     {"&epsilon;", "ε"},
-     {"&zeta;", "ζ"},
-     {"&eta;", "η"},
-     {"&theta;", "θ"},
-     {"&iota;", "ι"},
-     {"&kappa;", "κ"},
-     {"&lambda;", "λ"},
-     {"&mu;", "μ"},
-     {"&nu;", "ν"},
-     {"&xi;", "ξ"},
-     {"&omicron;", "ο"},
-     {"&pi;", "π"},
-     {"&rho;", "ρ"},
-     {"&sigmaf;", "ς"},
-     {"&sigma;", "σ"},
-     {"&tau;", "τ"},
-     {"&upsilon;", "υ"},
-     {"&phi;", "φ"},
-     {"&chi;", "χ"},
-     {"&psi;", "ψ"},
-     {"&omega;", "ω"},
-     {"&thetasym;", "ϑ"},
-     {"&upsih;", "ϒ"},
-     {"&piv;", "ϖ"},
-     {"&OElig;", "Œ"},
-     {"&oelig;", "œ"},
-     {"&Scaron;", "Š"},
-     {"&scaron;", "š"},
-     {"&Yuml;", "Ÿ"},
-     {"&fnof;", "ƒ"},
-     {"&circ;", "ˆ"},
-     {"&tilde;", "˜"},
-     {"&ensp;", ""},
-     {"&emsp;", ""},
-     {"&thinsp;", ""},
-     {"&zwnj;", "‌"},
-     {"&zwj;", "‍"},
-     {"&lrm;", "‎"},
-     {"&rlm;", "‏"},
-     {"&ndash;", "–"},
-     {"&mdash;", "—"},
-     {"&lsquo;", "‘"},
-     {"&rsquo;", "’"},
-     {"&sbquo;", "‚"},
-     {"&ldquo;", "“"},
-     {"&rdquo;", "”"},
-     {"&bdquo;", "„"},
-     {"&dagger;", "†"},
-     {"&Dagger;", "‡"},
-     {"&bull;", "•"},
-     {"&hellip;", "…"},
-     {"&permil;", "‰"},
-     {"&prime;", "′"},
-     {"&Prime;", "″"},
-     {"&lsaquo;", "‹"},
-     {"&rsaquo;", "›"},
-     {"&oline;", "‾"},
-     {"&euro;", "€"},
-     {"&trade;", "™"},
-     {"&larr;", "←"},
-     {"&uarr;", "↑"},
-     {"&rarr;", "→"},
-     {"&darr;", "↓"},
-     {"&harr;", "↔"},
-     {"&crarr;", "↵"},
-     {"&lceil;", "⌈"},
-     {"&rceil;", "⌉"},
-     {"&lfloor;", "⌊"},
-     {"&rfloor;", "⌋"},
-     {"&loz;", "◊"},
-     {"&spades;", "♠"},
-     {"&clubs;", "♣"},
-     {"&hearts;", "♥"},
-     {"&diams;", "♦"}});
+// Note the names are case sensitive. If you change this table you need to
+// regenerate the perfect hash in htmlEntityHash.h with:
+//   python3 scripts/generate_perfect_hash.py lib/Epub/RubbishHtmlParser/htmlEntities.cpp ENTITY ENTITY_HASH > lib/Epub/RubbishHtmlParser/htmlEntityHash.h
+// (the build fails if you forget)
+static constexpr HtmlEntity ENTITIES[] = {
+    ENTITY("AElig", "Æ"),
+    ENTITY("Aacute", "Á"),
+    ENTITY("Acirc", "Â"),
+    ENTITY("Agrave", "À"),
+    ENTITY("Alpha", "Α"),
+    ENTITY("Aring", "Å"),
+    ENTITY("Atilde", "Ã"),
+    ENTITY("Auml", "Ä"),
+    ENTITY("Beta", "Β"),
+    ENTITY("Ccedil", "Ç"),
+    ENTITY("Chi", "Χ"),
+    ENTITY("Dagger", "‡"),
+    ENTITY("Delta", "Δ"),
+    ENTITY("ETH", "Ð"),
+    ENTITY("Eacute", "É"),
+    ENTITY("Ecirc", "Ê"),
+    ENTITY("Egrave", "È"),
+    ENTITY("Epsilon", "Ε"),
+    ENTITY("Eta", "Η"),
+    ENTITY("Euml", "Ë"),
+    ENTITY("Gamma", "Γ"),
+    ENTITY("Iacute", "Í"),
+    ENTITY("Icirc", "Î"),
+    ENTITY("Igrave", "Ì"),
+    ENTITY("Iota", "Ι"),
+    ENTITY("Iuml", "Ï"),
+    ENTITY("Kappa", "Κ"),
+    ENTITY("Lambda", "Λ"),
+    ENTITY("Mu", "Μ"),
+    ENTITY("Ntilde", "Ñ"),
+    ENTITY("Nu", "Ν"),
+    ENTITY("OElig", "Œ"),
+    ENTITY("Oacute", "Ó"),
+    ENTITY("Ocirc", "Ô"),
+    ENTITY("Ograve", "Ò"),
+    ENTITY("Omega", "Ω"),
+    ENTITY("Omicron", "Ο"),
+    ENTITY("Oslash", "Ø"),
+    ENTITY("Otilde", "Õ"),
+    ENTITY("Ouml", "Ö"),
+    ENTITY("Phi", "Φ"),
+    ENTITY("Pi", "Π"),
+    ENTITY("Prime", "″"),
+    ENTITY("Psi", "Ψ"),
+    ENTITY("Rho", "Ρ"),
+    ENTITY("Scaron", "Š"),
+    ENTITY("Sigma", "Σ"),
+    ENTITY("THORN", "Þ"),
+    ENTITY("Tau", "Τ"),
+    ENTITY("Theta", "Θ"),
+    ENTITY("Uacute", "Ú"),
+    ENTITY("Ucirc", "Û"),
+    ENTITY("Ugrave", "Ù"),
+    ENTITY("Upsilon", "Υ"),
+    ENTITY("Uuml", "Ü"),
+    ENTITY("Xi", "Ξ"),
+    ENTITY("Yacute", "Ý"),
+    ENTITY("Yuml", "Ÿ"),
+    ENTITY("Zeta", "Ζ"),
+    ENTITY("aacute", "á"),
+    ENTITY("acirc", "â"),
+    ENTITY("acute", "´"),
+    ENTITY("aelig", "æ"),
+    ENTITY("agrave", "à"),
+    ENTITY("alpha", "α"),
+    ENTITY("amp", "&"),
+    ENTITY("and", "∧"),
+    ENTITY("ang", "∠"),
+    ENTITY("aring", "å"),
+    ENTITY("asymp", "≈"),
+    ENTITY("atilde", "ã"),
+    ENTITY("auml", "ä"),
+    ENTITY("bdquo", "„"),
+    ENTITY("beta", "β"),
+    ENTITY("brvbar", "¦"),
+    ENTITY("bull", "•"),
+    ENTITY("cap", "∩"),
+    ENTITY("ccedil", "ç"),
+    ENTITY("cedil", "¸"),
+    ENTITY("cent", "¢"),
+    ENTITY("chi", "χ"),
+    ENTITY("circ", "ˆ"),
+    ENTITY("clubs", "♣"),
+    ENTITY("cong", "≅"),
+    ENTITY("copy", "©"),
+    ENTITY("crarr", "↵"),
+    ENTITY("cup", "∪"),
+    ENTITY("curren", "¤"),
+    ENTITY("dagger", "†"),
+    ENTITY("darr", "↓"),
+    ENTITY("deg", "°"),
+    ENTITY("delta", "δ"),
+    ENTITY("diams", "♦"),
+    ENTITY("divide", "÷"),
+    ENTITY("eacute", "é"),
+    ENTITY("ecirc", "ê"),
+    ENTITY("egrave", "è"),
+    ENTITY("empty", "∅"),
+    ENTITY("emsp", ""),
+    ENTITY("ensp", ""),
+    ENTITY("epsilon", "ε"),
+    ENTITY("equiv", "≡"),
+    ENTITY("eta", "η"),
+    ENTITY("eth", "ð"),
+    ENTITY("euml", "ë"),
+    ENTITY("euro", "€"),
+    ENTITY("exist", "∃"),
+    ENTITY("fnof", "ƒ"),
+    ENTITY("forall", "∀"),
+    ENTITY("frac12", "½"),
+    ENTITY("frac14", "¼"),
+    ENTITY("frac34", "¾"),
+    ENTITY("frasl", "⁄"),
+    ENTITY("gamma", "γ"),
+    ENTITY("ge", "≥"),
+    ENTITY("gt", ">"),
+    ENTITY("harr", "↔"),
+    ENTITY("hearts", "♥"),
+    ENTITY("hellip", "…"),
+    ENTITY("iacute", "í"),
+    ENTITY("icirc", "î"),
+    ENTITY("iexcl", "¡"),
+    ENTITY("igrave", "ì"),
+    ENTITY("infin", "∞"),
+    ENTITY("int", "∫"),
+    ENTITY("iota", "ι"),
+    ENTITY("iquest", "¿"),
+    ENTITY("isin", "∈"),
+    ENTITY("iuml", "ï"),
+    ENTITY("kappa", "κ"),
+    ENTITY("lambda", "λ"),
+    ENTITY("laquo", "«"),
+    ENTITY("larr", "←"),
+    ENTITY("lceil", "⌈"),
+    ENTITY("ldquo", "“"),
+    ENTITY("le", "≤"),
+    ENTITY("lfloor", "⌊"),
+    ENTITY("lowast", "∗"),
+    ENTITY("loz", "◊"),
+    ENTITY("lrm", "‎"),
+    ENTITY("lsaquo", "‹"),
+    ENTITY("lsquo", "‘"),
+    ENTITY("lt", "<"),
+    ENTITY("macr", "¯"),
+    ENTITY("mdash", "—"),
+    ENTITY("micro", "µ"),
+    ENTITY("minus", "−"),
+    ENTITY("mu", "μ"),
+    ENTITY("nabla", "∇"),
+    ENTITY("nbsp", " "),
+    ENTITY("ndash", "–"),
+    ENTITY("ne", "≠"),
+    ENTITY("ni", "∋"),
+    ENTITY("not", "¬"),
+    ENTITY("notin", "∉"),
+    ENTITY("nsub", "⊄"),
+    ENTITY("ntilde", "ñ"),
+    ENTITY("nu", "ν"),
+    ENTITY("oacute", "ó"),
+    ENTITY("ocirc", "ô"),
+    ENTITY("oelig", "œ"),
+    ENTITY("ograve", "ò"),
+    ENTITY("oline", "‾"),
+    ENTITY("omega", "ω"),
+    ENTITY("omicron", "ο"),
+    ENTITY("oplus", "⊕"),
+    ENTITY("or", "∨"),
+    ENTITY("ordf", "ª"),
+    ENTITY("ordm", "º"),
+    ENTITY("oslash", "ø"),
+    ENTITY("otilde", "õ"),
+    ENTITY("otimes", "⊗"),
+    ENTITY("ouml", "ö"),
+    ENTITY("para", "¶"),
+    ENTITY("part", "∂"),
+    ENTITY("permil", "‰"),
+    ENTITY("perp", "⊥"),
+    ENTITY("phi", "φ"),
+    ENTITY("pi", "π"),
+    ENTITY("piv", "ϖ"),
+    ENTITY("plusmn", "±"),
+    ENTITY("pound", "£"),
+    ENTITY("prime", "′"),
+    ENTITY("prod", "∏"),
+    ENTITY("prop", "∝"),
+    ENTITY("psi", "ψ"),
+    ENTITY("quot", "\""),
+    ENTITY("radic", "√"),
+    ENTITY("raquo", "»"),
+    ENTITY("rarr", "→"),
+    ENTITY("rceil", "⌉"),
+    ENTITY("rdquo", "”"),
+    ENTITY("reg", "®"),
+    ENTITY("rfloor", "⌋"),
+    ENTITY("rho", "ρ"),
+    ENTITY("rlm", "‏"),
+    ENTITY("rsaquo", "›"),
+    ENTITY("rsquo", "’"),
+    ENTITY("sbquo", "‚"),
+    ENTITY("scaron", "š"),
+    ENTITY("sdot", "⋅"),
+    ENTITY("sect", "§"),
+    ENTITY("shy", "­"),
+    ENTITY("sigma", "σ"),
+    ENTITY("sigmaf", "ς"),
+    ENTITY("sim", "∼"),
+    ENTITY("spades", "♠"),
+    ENTITY("sub", "⊂"),
+    ENTITY("sube", "⊆"),
+    ENTITY("sum", "∑"),
+    ENTITY("sup", "⊃"),
+    ENTITY("sup1", "¹"),
+    ENTITY("sup2", "²"),
+    ENTITY("sup3", "³"),
+    ENTITY("supe", "⊇"),
+    ENTITY("szlig", "ß"),
+    ENTITY("tau", "τ"),
+    ENTITY("there4", "∴"),
+    ENTITY("theta", "θ"),
+    ENTITY("thetasym", "ϑ"),
+    ENTITY("thinsp", ""),
+    ENTITY("thorn", "þ"),
+    ENTITY("tilde", "˜"),
+    ENTITY("times", "×"),
+    ENTITY("trade", "™"),
+    ENTITY("uacute", "ú"),
+    ENTITY("uarr", "↑"),
+    ENTITY("ucirc", "û"),
+    ENTITY("ugrave", "ù"),
+    ENTITY("uml", "¨"),
+    ENTITY("upsih", "ϒ"),
+    ENTITY("upsilon", "υ"),
+    ENTITY("uuml", "ü"),
+    ENTITY("xi", "ξ"),
+    ENTITY("yacute", "ý"),
+    ENTITY("yen", "¥"),
+    ENTITY("yuml", "ÿ"),
+    ENTITY("zeta", "ζ"),
+    ENTITY("zwj", "‍"),
+    ENTITY("zwnj", "‌"),
+};
+static constexpr int NUM_ENTITIES = sizeof(ENTITIES) / sizeof(ENTITIES[0]);
+
+// anything longer than this can't be an entity we know about
+static const size_t MAX_ENTITY_LENGTH = 10;
 
-// converts from a unicode code point to the utf8 equivalent
-void convert_to_utf8(int code, std::string &res)
+static constexpr uint32_t entity_slot(const char *name, size_t length)
 {
-  // convert to a utf8 sequence
-  if (code < 0x80)
-  {
-    res += static_cast<char>(code);
-  }
-  else if (code < 0x800)
+  return perfect_hash_slot(ENTITY_HASH_SEEDS, ENTITY_HASH_BUCKETS, ENTITY_HASH_SLOTS, name, length, false);
+}
+
+// check every entity lands in its own slot - split in half each time to
+// keep the recursion shallow
+static constexpr bool entities_hashed(int start, int end)
+{
+  return end - start == 1
+             ? ENTITY_HASH_SLOT_INDEX[entity_slot(ENTITIES[start].name, ENTITIES[start].name_length)] == start
+             : entities_hashed(start, (start + end) / 2) && entities_hashed((start + end) / 2, end);
+}
+
+static_assert(NUM_ENTITIES < ENTITY_HASH_EMPTY, "Too many entities for the hash slot index");
+static_assert(entities_hashed(0, NUM_ENTITIES), "htmlEntityHash.h is out of date - regenerate it");
+
+// find a named entity - name isn't null terminated
+static const HtmlEntity *find_entity(const char *name, size_t length)
+{
+  uint8_t index = ENTITY_HASH_SLOT_INDEX[entity_slot(name, length)];
+  if (index == ENTITY_HASH_EMPTY)
   {
-    res += static_cast<char>(0xc0 | (code >> 6));
-    res += static_cast<char>(0x80 | (code & 0x3f));
+    return nullptr;
   }
-  else if (code < 0x10000)
+  const HtmlEntity *entity = &ENTITIES[index];
+  if (entity->name_length != length || memcmp(entity->name, name, length) != 0)
   {
-    res += static_cast<char>(0xe0 | (code >> 12));
-    res += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
-    res += static_cast<char>(0x80 | (code & 0x3f));
+    return nullptr;
   }
-  else if (code < 0x200000)
+  return entity;
+}
+
+// converts from a unicode code point to utf8 - returns the number of bytes
+static size_t convert_to_utf8(uint32_t code, char *res)
+{
+  if (code < 0x80)
   {
-    res += static_cast<char>(0xf0 | (code >> 18));
-    res += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
-    res += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
-    res += static_cast<char>(0x80 | (code & 0x3f));
+    res[0] = static_cast<char>(code);
+    return 1;
   }
-  else if (code < 0x4000000)
+  if (code < 0x800)
   {
-    res += static_cast<char>(0xf8 | (code >> 24));
-    res += static_cast<char>(0x80 | ((code >> 18) & 0x3f));
-    res += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
-    res += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
-    res += static_cast<char>(0x80 | (code & 0x3f));
+    res[0] = static_cast<char>(0xc0 | (code >> 6));
+    res[1] = static_cast<char>(0x80 | (code & 0x3f));
+    return 2;
   }
-  else if (code < 0x80000000)
+  if (code < 0x10000)
   {
-    res += static_cast<char>(0xfc | (code >> 30));
-    res += static_cast<char>(0x80 | ((code >> 24) & 0x3f));
-    res += static_cast<char>(0x80 | ((code >> 18) & 0x3f));
-    res += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
-    res += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+    res[0] = static_cast<char>(0xe0 | (code >> 12));
+    res[1] = static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+    res[2] = static_cast<char>(0x80 | (code & 0x3f));
+    return 3;
   }
+  res[0] = static_cast<char>(0xf0 | (code >> 18));
+  res[1] = static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+  res[2] = static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+  res[3] = static_cast<char>(0x80 | (code & 0x3f));
+  return 4;
 }
 
-// handles numeric entities - e.g. &#1234; or &#x1234;
-bool process_numeric_entity(const std::string &entity, std::string &res)
+// handles numeric entities - e.g. &#1234; or &#x1234; - digits doesn't
+// include the &# or the ;
+static size_t process_numeric_entity(const char *digits, size_t length, char *res)
 {
-  int code = 0;
+  uint32_t code = 0;
+  int base = 10;
   // is it hex?
-  if (entity[2] == 'x' || entity[2] == 'X')
+  if (length > 0 && (digits[0] == 'x' || digits[0] == 'X'))
   {
-    // parse the hex code
-    code = strtol(entity.substr(3, entity.size() - 3).c_str(), nullptr, 16);
+    base = 16;
+    digits++;
+    length--;
   }
-  else
+  if (length == 0)
   {
-    code = strtol(entity.substr(2, entity.size() - 3).c_str(), nullptr, 10);
+    return 0;
   }
-  if (code != 0)
+  for (size_t i = 0; i < length; i++)
   {
-    // special handling for nbsp
-    if (code == 0xA0)
+    char c = digits[i];
+    uint32_t digit;
+    if (c >= '0' && c <= '9')
     {
-      res += " ";
+      digit = c - '0';
+    }
+    else if (base == 16 && c >= 'a' && c <= 'f')
+    {
+      digit = c - 'a' + 10;
+    }
+    else if (base == 16 && c >= 'A' && c <= 'F')
+    {
+      digit = c - 'A' + 10;
     }
     else
     {
-      convert_to_utf8(code, res);
+      return 0;
     }
-    return true;
+    code = code * base + digit;
   }
-  return false;
-}
-
-// handles named entities - e.g. &amp;
-bool process_string_entity(const std::string &entity, std::string &res)
-{
-  // it's a named entity - find it in the lookup table
-  // find it in the map
-  auto it = entity_lookup.find(entity);
-  if (it != entity_lookup.end())
+  if (code == 0 || code > 0x10FFFF)
+  {
+    return 0;
+  }
+  // special handling for nbsp
+  if (code == 0xA0)
   {
-    res += it->second;
-    return true;
+    res[0] = ' ';
+    return 1;
   }
-  return false;
+  return convert_to_utf8(code, res);
 }
 
-// replace all the entities in the string
-std::string replace_html_entities(const std::string &text)
+// replace all the entities in the text in place - a decoded entity is never
+// longer than the entity itself so this can't overflow. Returns the new length.
+size_t replace_html_entities(char *text, size_t length)
 {
-  std::string res;
-  res.reserve(text.size());
-  for (int i = 0; i < text.size(); ++i)
+  size_t write = 0;
+  size_t i = 0;
+  while (i < length)
   {
-    bool flag = false;
-    // do we have a potential entity?
-    if (text[i] == '&')
+    // copy everything up to the next potential entity in one go
+    const char *next = static_cast<const char *>(memchr(text + i, '&', length - i));
+    size_t run_end = next ? next - text : length;
+    if (write != i)
+    {
+      memmove(text + write, text + i, run_end - i);
+    }
+    write += run_end - i;
+    i = run_end;
+    if (i == length)
     {
-      // find the end of the entity
-      int j = i + 1;
-      while (j < text.size() && text[j] != ';' && j - i < MAX_ENTITY_LENGTH)
+      break;
+    }
+    // find the end of the entity
+    size_t j = i + 1;
+    while (j < length && text[j] != ';' && j - i < MAX_ENTITY_LENGTH)
+    {
+      j++;
+    }
+    if (j < length && text[j] == ';' && j - i > 2)
+    {
+      char decoded[4];
+      size_t decoded_length = 0;
+      const char *value = nullptr;
+      // is it a numeric code?
+      if (text[i + 1] == '#')
       {
-        j++;
+        decoded_length = process_numeric_entity(text + i + 2, j - i - 2, decoded);
+        value = decoded;
       }
-      if (j - i > 2)
+      else
       {
-        std::string entity = text.substr(i, j - i + 1);
-        // is it a numeric code?
-        if (entity[1] == '#')
-        {
-          flag = process_numeric_entity(entity, res);
-        }
-        else
-        {
-          flag = process_string_entity(entity, res);
-        }
-        // skip past the entity if we successfully decoded it
-        if (flag)
+        const HtmlEntity *entity = find_entity(text + i + 1, j - i - 1);
+        if (entity)
         {
-          i = j;
+          value = entity->value;
+          decoded_length = entity->value_length;
         }
       }
+      // skip past the entity if we successfully decoded it
+      if (decoded_length > 0 && decoded_length <= j - i + 1)
+      {
+        memmove(text + write, value, decoded_length);
+        write += decoded_length;
+        i = j + 1;
+        continue;
+      }
     }
-    if (!flag)
-    {
-      res += text[i];
-    }
+    // not one we know - keep the & as it is
+    text[write++] = text[i++];
   }
+  return write;
+}
+
+std::string replace_html_entities(const std::string &text)
+{
+  std::string res(text);
+  res.resize(replace_html_entities(&res[0], res.size()));
   return res;
 }
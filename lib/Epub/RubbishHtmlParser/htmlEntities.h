@@ -1,4 +1,7 @@
 #pragma once
+#include <stddef.h>
 #include <string>
 
 std::string replace_html_entities(const std::string &text);
+// decodes the entities without making a copy - returns the new length
+size_t replace_html_entities(char *text, size_t length);
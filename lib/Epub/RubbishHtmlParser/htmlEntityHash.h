@@ -0,0 +1,53 @@
+#pragma once
+
+// generated by scripts/generate_perfect_hash.py - do not edit
+
+#include <stdint.h>
+
+static const uint32_t ENTITY_HASH_BUCKETS = 64;
+static const uint32_t ENTITY_HASH_SLOTS = 512;
+static const uint8_t ENTITY_HASH_EMPTY = 255;
+
+// seed for the second hash of each bucket
+static constexpr uint8_t ENTITY_HASH_SEEDS[ENTITY_HASH_BUCKETS] = {
+    5, 1, 1, 0, 6, 4, 1, 1, 1, 4, 1, 3, 1, 2, 1, 4,
+    3, 3, 5, 1, 1, 1, 3, 1, 1, 3, 2, 1, 1, 6, 1, 4,
+    2, 2, 1, 2, 1, 2, 5, 1, 2, 3, 3, 2, 5, 1, 2, 1,
+    5, 1, 1, 7, 1, 5, 1, 11, 1, 0, 1, 1, 6, 2, 2, 3,
+};
+
+// index into the table for each slot
+static constexpr uint8_t ENTITY_HASH_SLOT_INDEX[ENTITY_HASH_SLOTS] = {
+    145, 255, 255, 255, 255, 255, 34, 109, 255, 140, 255, 255, 142, 255, 255, 255,
+    169, 233, 159, 179, 120, 72, 255, 7, 127, 71, 137, 148, 82, 255, 255, 55,
+    218, 101, 255, 100, 146, 170, 176, 255, 255, 255, 255, 58, 255, 255, 9, 231,
+    255, 93, 255, 255, 255, 255, 255, 20, 216, 255, 42, 255, 255, 255, 37, 201,
+    255, 107, 22, 180, 255, 124, 255, 255, 222, 255, 255, 211, 160, 255, 8, 190,
+    255, 187, 255, 255, 198, 255, 255, 255, 255, 255, 255, 86, 214, 255, 255, 57,
+    255, 255, 28, 41, 255, 226, 255, 255, 255, 98, 255, 239, 255, 255, 255, 27,
+    255, 255, 255, 255, 255, 255, 255, 149, 255, 47, 255, 255, 255, 255, 163, 236,
+    49, 173, 255, 255, 255, 255, 151, 255, 255, 74, 255, 194, 255, 255, 255, 202,
+    92, 255, 210, 255, 193, 255, 255, 106, 255, 255, 255, 255, 224, 150, 255, 29,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 165, 255, 255, 255, 255, 53, 255,
+    255, 66, 166, 255, 69, 255, 255, 87, 255, 255, 83, 255, 217, 255, 99, 91,
+    54, 255, 255, 255, 97, 184, 255, 255, 255, 191, 255, 90, 31, 255, 255, 25,
+    255, 139, 255, 255, 158, 138, 255, 40, 255, 255, 255, 156, 255, 153, 255, 255,
+    235, 110, 255, 205, 255, 105, 223, 255, 255, 255, 134, 255, 255, 255, 255, 238,
+    199, 255, 255, 255, 123, 60, 188, 255, 255, 135, 255, 51, 255, 255, 255, 230,
+    255, 204, 255, 255, 255, 38, 2, 116, 62, 64, 12, 255, 255, 130, 52, 255,
+    255, 255, 255, 79, 237, 255, 255, 255, 255, 157, 255, 141, 255, 255, 255, 144,
+    255, 255, 209, 255, 255, 255, 161, 255, 228, 255, 255, 89, 255, 152, 192, 13,
+    85, 255, 255, 78, 3, 255, 255, 255, 143, 255, 255, 255, 255, 255, 14, 6,
+    125, 255, 255, 56, 255, 255, 255, 24, 0, 255, 114, 104, 255, 186, 77, 80,
+    111, 255, 118, 215, 185, 255, 4, 255, 206, 255, 255, 255, 76, 113, 75, 35,
+    65, 255, 131, 128, 255, 255, 255, 32, 219, 68, 15, 255, 81, 195, 73, 96,
+    122, 213, 26, 255, 45, 30, 255, 255, 255, 50, 255, 63, 255, 255, 177, 17,
+    255, 21, 255, 112, 255, 1, 255, 255, 212, 171, 255, 95, 255, 255, 255, 126,
+    255, 189, 255, 255, 102, 39, 255, 255, 121, 174, 255, 232, 175, 255, 255, 203,
+    227, 255, 255, 255, 255, 59, 181, 255, 255, 183, 255, 255, 23, 48, 207, 115,
+    168, 70, 255, 162, 43, 255, 154, 255, 255, 10, 84, 255, 255, 255, 255, 255,
+    255, 255, 36, 132, 255, 196, 119, 255, 255, 255, 255, 164, 255, 5, 220, 255,
+    255, 234, 11, 255, 255, 255, 255, 182, 16, 221, 197, 167, 147, 133, 103, 255,
+    136, 255, 155, 255, 67, 117, 255, 129, 61, 94, 255, 44, 255, 255, 255, 255,
+    19, 255, 88, 255, 18, 225, 172, 178, 33, 108, 229, 208, 255, 200, 255, 46,
+};
@@ -0,0 +1,26 @@
+#pragma once
+
+// generated by scripts/generate_perfect_hash.py - do not edit
+
+#include <stdint.h>
+
+static const uint32_t TAG_HASH_BUCKETS = 16;
+static const uint32_t TAG_HASH_SLOTS = 128;
+static const uint8_t TAG_HASH_EMPTY = 255;
+
+// seed for the second hash of each bucket
+static constexpr uint8_t TAG_HASH_SEEDS[TAG_HASH_BUCKETS] = {
+    0, 1, 1, 1, 1, 2, 1, 1, 1, 3, 1, 1, 2, 0, 1, 1,
+};
+
+// index into the table for each slot
+static constexpr uint8_t TAG_HASH_SLOT_INDEX[TAG_HASH_SLOTS] = {
+    255, 255, 16, 255, 255, 255, 29, 9, 255, 255, 27, 255, 255, 255, 255, 15,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 7, 255, 255, 21, 255,
+    255, 26, 255, 255, 255, 255, 255, 255, 255, 24, 255, 255, 255, 255, 255, 255,
+    28, 255, 3, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 31, 255, 255,
+    255, 255, 255, 255, 17, 12, 33, 10, 255, 30, 1, 255, 255, 255, 255, 13,
+    22, 255, 11, 255, 255, 255, 255, 255, 18, 255, 255, 255, 255, 255, 25, 8,
+    255, 34, 255, 14, 6, 255, 255, 255, 255, 32, 255, 4, 255, 23, 255, 255,
+    255, 255, 255, 19, 255, 255, 255, 255, 255, 20, 255, 255, 255, 255, 5, 255,
+};
@@ -0,0 +1,553 @@
+#include <string.h>
+#include "FastInflate.h"
+
+// Table entries are packed into 32 bits:
+//   bits 0-7   number of bits to consume
+//   bits 8-10  what the entry is
+//   bits 11-15 extra bits to read (or the size of the subtable)
+//   bits 16-31 literal(s), base value or subtable start
+enum EntryKind
+{
+  ENTRY_LITERAL = 0,
+  ENTRY_LITERAL_PAIR = 1,
+  ENTRY_LENGTH = 2,
+  ENTRY_END_OF_BLOCK = 3,
+  ENTRY_SUBTABLE = 4,
+  ENTRY_DISTANCE = 5,
+  ENTRY_INVALID = 6
+};
+
+static inline uint32_t make_entry(uint32_t bits, uint32_t kind, uint32_t extra, uint32_t value)
+{
+  return bits | (kind << 8) | (extra << 11) | (value << 16);
+}
+
+static inline uint32_t entry_bits(uint32_t entry) { return entry & 0xFF; }
+static inline uint32_t entry_kind(uint32_t entry) { return (entry >> 8) & 0x7; }
+static inline uint32_t entry_extra(uint32_t entry) { return (entry >> 11) & 0x1F; }
+static inline uint32_t entry_value(uint32_t entry) { return entry >> 16; }
+
+static const uint16_t LENGTH_BASE[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const uint8_t LENGTH_EXTRA[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const uint16_t DIST_BASE[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+static const uint8_t DIST_EXTRA[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+// the order the code length code lengths are sent in
+static const uint8_t PRECODE_ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+// what a symbol decodes to for each type of table
+static uint32_t symbol_entry(FastInflate::TableKind kind, int symbol, uint32_t bits)
+{
+  switch (kind)
+  {
+  case FastInflate::TABLE_PRECODE:
+    return make_entry(bits, ENTRY_LITERAL, 0, symbol);
+  case FastInflate::TABLE_LITLEN:
+    if (symbol < 256)
+    {
+      return make_entry(bits, ENTRY_LITERAL, 0, symbol);
+    }
+    if (symbol == 256)
+    {
+      return make_entry(bits, ENTRY_END_OF_BLOCK, 0, 0);
+    }
+    if (symbol < 286)
+    {
+      return make_entry(bits, ENTRY_LENGTH, LENGTH_EXTRA[symbol - 257], LENGTH_BASE[symbol - 257]);
+    }
+    break;
+  case FastInflate::TABLE_DIST:
+    if (symbol < 30)
+    {
+      return make_entry(bits, ENTRY_DISTANCE, DIST_EXTRA[symbol], DIST_BASE[symbol]);
+    }
+    break;
+  }
+  return make_entry(bits, ENTRY_INVALID, 0, 0);
+}
+
+static inline uint32_t reverse_bits(uint32_t code, int length)
+{
+  uint32_t reversed = 0;
+  for (int i = 0; i < length; i++)
+  {
+    reversed = (reversed << 1) | (code & 1);
+    code >>= 1;
+  }
+  return reversed;
+}
+
+// Build a lookup table for a canonical huffman code. Codes up to table_bits
+// long are looked up directly, longer ones go through a subtable hanging off
+// the primary entry for their first table_bits bits.
+bool FastInflate::build_table(uint32_t *table, size_t table_size, int table_bits, const uint8_t *lengths, int count, TableKind kind)
+{
+  uint16_t length_counts[16] = {};
+  int max_length = 0;
+  for (int symbol = 0; symbol < count; symbol++)
+  {
+    length_counts[lengths[symbol]]++;
+    if (lengths[symbol] > max_length)
+    {
+      max_length = lengths[symbol];
+    }
+  }
+  const uint32_t primary_size = 1u << table_bits;
+  const uint32_t invalid = make_entry(table_bits, ENTRY_INVALID, 0, 0);
+  if (max_length == 0)
+  {
+    // no codes at all - fine as long as nothing tries to use them
+    for (uint32_t i = 0; i < primary_size; i++)
+    {
+      table[i] = invalid;
+    }
+    return true;
+  }
+  // check the code isn't over-subscribed, and only allow an incomplete code
+  // for the single code case, as zlib does
+  int left = 1;
+  for (int length = 1; length < 16; length++)
+  {
+    left = (left << 1) - length_counts[length];
+    if (left < 0)
+    {
+      return false;
+    }
+  }
+  if (left > 0 && (kind == TABLE_PRECODE || max_length != 1))
+  {
+    return false;
+  }
+  if (left > 0)
+  {
+    // a single one bit code - half the table is left unused. A complete code
+    // fills every slot by itself so this is the only case that needs it.
+    for (uint32_t i = 0; i < primary_size; i++)
+    {
+      table[i] = invalid;
+    }
+  }
+  // assign the canonical codes (bit reversed, as deflate sends them)
+  uint16_t next_code[16];
+  uint32_t code = 0;
+  length_counts[0] = 0;
+  for (int length = 1; length < 16; length++)
+  {
+    code = (code + length_counts[length - 1]) << 1;
+    next_code[length] = code;
+  }
+  for (int symbol = 0; symbol < count; symbol++)
+  {
+    int length = lengths[symbol];
+    if (length)
+    {
+      m_codes[symbol] = reverse_bits(next_code[length]++, length);
+    }
+  }
+  // work out how big each subtable needs to be and where it goes
+  uint32_t table_end = primary_size;
+  if (max_length > table_bits)
+  {
+    memset(m_subtable_bits, 0, primary_size);
+    for (int symbol = 0; symbol < count; symbol++)
+    {
+      int length = lengths[symbol];
+      if (length > table_bits)
+      {
+        uint32_t prefix = m_codes[symbol] & (primary_size - 1);
+        if (length - table_bits > m_subtable_bits[prefix])
+        {
+          m_subtable_bits[prefix] = length - table_bits;
+        }
+      }
+    }
+    for (uint32_t prefix = 0; prefix < primary_size; prefix++)
+    {
+      if (m_subtable_bits[prefix])
+      {
+        m_subtable_start[prefix] = table_end;
+        table[prefix] = make_entry(table_bits, ENTRY_SUBTABLE, m_subtable_bits[prefix], table_end);
+        table_end += 1u << m_subtable_bits[prefix];
+        if (table_end > table_size)
+        {
+          return false;
+        }
+      }
+    }
+  }
+  // fill in every slot whose low bits match each code
+  for (int symbol = 0; symbol < count; symbol++)
+  {
+    int length = lengths[symbol];
+    if (!length)
+    {
+      continue;
+    }
+    uint32_t reversed = m_codes[symbol];
+    if (length <= table_bits)
+    {
+      uint32_t entry = symbol_entry(kind, symbol, length);
+      for (uint32_t i = reversed; i < primary_size; i += 1u << length)
+      {
+        table[i] = entry;
+      }
+    }
+    else
+    {
+      uint32_t prefix = reversed & (primary_size - 1);
+      int sub_length = length - table_bits;
+      uint32_t sub_size = 1u << m_subtable_bits[prefix];
+      uint32_t *subtable = table + m_subtable_start[prefix];
+      uint32_t entry = symbol_entry(kind, symbol, sub_length);
+      for (uint32_t i = reversed >> table_bits; i < sub_size; i += 1u << sub_length)
+      {
+        subtable[i] = entry;
+      }
+    }
+  }
+  return true;
+}
+
+// Where a short literal code is followed by room for another short literal
+// in the same primary table index, decode both in one go. Work downwards so
+// we always pair with an entry that hasn't been paired itself yet.
+void FastInflate::pair_literals()
+{
+  for (int i = (1 << LITLEN_TABLE_BITS) - 1; i >= 0; i--)
+  {
+    uint32_t first = m_litlen_table[i];
+    uint32_t first_bits = entry_bits(first);
+    if (entry_kind(first) != ENTRY_LITERAL || first_bits >= (uint32_t)LITLEN_TABLE_BITS)
+    {
+      continue;
+    }
+    uint32_t second = m_litlen_table[i >> first_bits];
+    uint32_t second_bits = entry_bits(second);
+    if (entry_kind(second) == ENTRY_LITERAL && first_bits + second_bits <= (uint32_t)LITLEN_TABLE_BITS)
+    {
+      m_litlen_table[i] = make_entry(first_bits + second_bits, ENTRY_LITERAL_PAIR, 0,
+                                     entry_value(first) | (entry_value(second) << 8));
+    }
+  }
+}
+
+// little endian load that doesn't care about alignment
+static inline uint64_t load_le64(const uint8_t *p)
+{
+  uint64_t value;
+  memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  value = __builtin_bswap64(value);
+#endif
+  return value;
+}
+
+bool FastInflate::inflate(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_size)
+{
+  const uint8_t *in_end = in + in_size;
+  uint8_t *const out_start = out;
+  uint8_t *const out_end = out + out_size;
+  uint64_t bit_buffer = 0;
+  int bit_count = 0;
+  // zero bytes we've had to make up past the end of the input
+  int overread = 0;
+
+  // top the bit buffer up to at least 56 bits. Bits above bit_count may hold
+  // part of the next input byte - they are always the right bits so OR-ing
+  // them in again is harmless
+  auto refill = [&]() {
+    if (in_end - in >= 8)
+    {
+      bit_buffer |= load_le64(in) << bit_count;
+      int bytes = (63 - bit_count) >> 3;
+      in += bytes;
+      bit_count += bytes << 3;
+    }
+    else
+    {
+      while (bit_count <= 56)
+      {
+        if (in < in_end)
+        {
+          bit_buffer |= (uint64_t)(*in++) << bit_count;
+        }
+        else
+        {
+          overread++;
+        }
+        bit_count += 8;
+      }
+    }
+  };
+  auto bits = [&](int count) -> uint32_t {
+    return (uint32_t)(bit_buffer & ((1ull << count) - 1));
+  };
+  auto consume = [&](int count) {
+    bit_buffer >>= count;
+    bit_count -= count;
+  };
+
+  bool final_block = false;
+  while (!final_block)
+  {
+    refill();
+    final_block = bits(1);
+    int block_type = bits(3) >> 1;
+    consume(3);
+    if (block_type == 0)
+    {
+      // stored - go back to byte alignment and copy it across
+      consume(bit_count & 7);
+      uint32_t length = bits(16);
+      uint32_t check = (bits(32) >> 16);
+      consume(32);
+      if ((length ^ 0xFFFF) != check)
+      {
+        return false;
+      }
+      // hand back the whole bytes still sitting in the bit buffer
+      int buffered = (bit_count >> 3) - overread;
+      if (buffered < 0)
+      {
+        return false;
+      }
+      in -= buffered;
+      bit_buffer = 0;
+      bit_count = 0;
+      overread = 0;
+      if ((size_t)(in_end - in) < length || (size_t)(out_end - out) < length)
+      {
+        return false;
+      }
+      memcpy(out, in, length);
+      in += length;
+      out += length;
+      continue;
+    }
+    if (block_type == 1)
+    {
+      // fixed huffman codes - small entries are often a single fixed block
+      // so keep the tables around until a dynamic block replaces them
+      if (!m_have_fixed_tables)
+      {
+        memset(m_lengths, 8, 144);
+        memset(m_lengths + 144, 9, 112);
+        memset(m_lengths + 256, 7, 24);
+        memset(m_lengths + 280, 8, 8);
+        memset(m_lengths + 288, 5, 32);
+        if (!build_table(m_litlen_table, LITLEN_TABLE_SIZE, LITLEN_TABLE_BITS, m_lengths, 288, TABLE_LITLEN) ||
+            !build_table(m_dist_table, DIST_TABLE_SIZE, DIST_TABLE_BITS, m_lengths + 288, 32, TABLE_DIST))
+        {
+          return false;
+        }
+        pair_literals();
+        m_have_fixed_tables = true;
+      }
+    }
+    else if (block_type == 2)
+    {
+      // dynamic huffman codes - first the code for the code lengths
+      int litlen_count = bits(5) + 257;
+      int dist_count = (bits(10) >> 5) + 1;
+      int precode_count = (bits(14) >> 10) + 4;
+      consume(14);
+      if (litlen_count > 286 || dist_count > 30)
+      {
+        return false;
+      }
+      m_have_fixed_tables = false;
+      uint8_t precode_lengths[19] = {};
+      for (int i = 0; i < precode_count; i++)
+      {
+        if (bit_count < 3)
+        {
+          refill();
+        }
+        precode_lengths[PRECODE_ORDER[i]] = bits(3);
+        consume(3);
+      }
+      // the precode is at most 7 bits long so its table fits in the distance table
+      if (!build_table(m_dist_table, DIST_TABLE_SIZE, 7, precode_lengths, 19, TABLE_PRECODE))
+      {
+        return false;
+      }
+      // then the code lengths themselves
+      int total = litlen_count + dist_count;
+      int i = 0;
+      while (i < total)
+      {
+        if (bit_count < 16)
+        {
+          refill();
+        }
+        uint32_t entry = m_dist_table[bits(7)];
+        if (entry_kind(entry) != ENTRY_LITERAL)
+        {
+          return false;
+        }
+        consume(entry_bits(entry));
+        uint32_t symbol = entry_value(entry);
+        if (symbol < 16)
+        {
+          m_lengths[i++] = symbol;
+          continue;
+        }
+        uint8_t value = 0;
+        int repeat;
+        if (symbol == 16)
+        {
+          if (i == 0)
+          {
+            return false;
+          }
+          value = m_lengths[i - 1];
+          repeat = 3 + bits(2);
+          consume(2);
+        }
+        else if (symbol == 17)
+        {
+          repeat = 3 + bits(3);
+          consume(3);
+        }
+        else
+        {
+          repeat = 11 + bits(7);
+          consume(7);
+        }
+        if (i + repeat > total)
+        {
+          return false;
+        }
+        memset(m_lengths + i, value, repeat);
+        i += repeat;
+      }
+      if (m_lengths[256] == 0)
+      {
+        return false;
+      }
+      // the distance lengths have to be contiguous for build_table so
+      // shuffle them up out of the way of the literal/length lengths
+      memmove(m_lengths + 288, m_lengths + litlen_count, dist_count);
+      if (!build_table(m_litlen_table, LITLEN_TABLE_SIZE, LITLEN_TABLE_BITS, m_lengths, litlen_count, TABLE_LITLEN) ||
+          !build_table(m_dist_table, DIST_TABLE_SIZE, DIST_TABLE_BITS, m_lengths + 288, dist_count, TABLE_DIST))
+      {
+        return false;
+      }
+      pair_literals();
+    }
+    else
+    {
+      return false;
+    }
+
+    // decode the block - one refill always covers the longest
+    // length + distance pair (15 + 5 + 15 + 13 bits)
+    for (;;)
+    {
+      if (bit_count < 48)
+      {
+        refill();
+        if (overread > 16)
+        {
+          // we're decoding padding - the data must be truncated
+          return false;
+        }
+      }
+      uint32_t entry = m_litlen_table[bits(LITLEN_TABLE_BITS)];
+      if (entry_kind(entry) == ENTRY_SUBTABLE)
+      {
+        consume(LITLEN_TABLE_BITS);
+        entry = m_litlen_table[entry_value(entry) + bits(entry_extra(entry))];
+      }
+      consume(entry_bits(entry));
+      uint32_t kind = entry_kind(entry);
+      if (kind == ENTRY_LITERAL_PAIR)
+      {
+        if (out_end - out < 2)
+        {
+          return false;
+        }
+        out[0] = entry_value(entry) & 0xFF;
+        out[1] = entry_value(entry) >> 8;
+        out += 2;
+        continue;
+      }
+      if (kind == ENTRY_LITERAL)
+      {
+        if (out == out_end)
+        {
+          return false;
+        }
+        *out++ = entry_value(entry);
+        continue;
+      }
+      if (kind == ENTRY_END_OF_BLOCK)
+      {
+        break;
+      }
+      if (kind != ENTRY_LENGTH)
+      {
+        return false;
+      }
+      uint32_t length = entry_value(entry) + bits(entry_extra(entry));
+      consume(entry_extra(entry));
+      entry = m_dist_table[bits(DIST_TABLE_BITS)];
+      if (entry_kind(entry) == ENTRY_SUBTABLE)
+      {
+        consume(DIST_TABLE_BITS);
+        entry = m_dist_table[entry_value(entry) + bits(entry_extra(entry))];
+      }
+      consume(entry_bits(entry));
+      if (entry_kind(entry) != ENTRY_DISTANCE)
+      {
+        return false;
+      }
+      uint32_t distance = entry_value(entry) + bits(entry_extra(entry));
+      consume(entry_extra(entry));
+      if (distance > (size_t)(out - out_start) || length > (size_t)(out_end - out))
+      {
+        return false;
+      }
+      const uint8_t *src = out - distance;
+      uint8_t *end = out + length;
+      if (distance >= 8 && out_end - end >= 8)
+      {
+        // copy 8 bytes at a time - this can run a few bytes past the end of
+        // the match, but we've checked there's room and the bytes will be
+        // overwritten by whatever comes next
+        do
+        {
+          memcpy(out, src, 8);
+          out += 8;
+          src += 8;
+        } while (out < end);
+        out = end;
+      }
+      else if (distance == 1)
+      {
+        memset(out, out[-1], length);
+        out = end;
+      }
+      else
+      {
+        while (out < end)
+        {
+          *out++ = *src++;
+        }
+      }
+    }
+  }
+  // make sure we didn't decode any of the padding we made up
+  if (overread > (bit_count >> 3))
+  {
+    return false;
+  }
+  return out == out_end;
+}
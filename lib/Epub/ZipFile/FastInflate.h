@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Inflate for when the whole compressed entry and the whole output fit in
+// memory. Knowing that up front lets us skip all the bookkeeping tinfl needs
+// to be resumable: bits are pulled in 64 at a time, the literal/length table
+// can decode two literals in one lookup and matches are copied 8 bytes at a
+// time straight into the destination buffer.
+//
+// The decode tables are big enough that this should live on the heap, and
+// are reused between calls.
+class FastInflate
+{
+public:
+  static const int LITLEN_TABLE_BITS = 9;
+  static const int DIST_TABLE_BITS = 8;
+  enum TableKind
+  {
+    TABLE_PRECODE,
+    TABLE_LITLEN,
+    TABLE_DIST
+  };
+
+private:
+  // primary tables plus room for the subtables of the longer codes
+  static const size_t LITLEN_TABLE_SIZE = (1 << LITLEN_TABLE_BITS) + 1024;
+  static const size_t DIST_TABLE_SIZE = (1 << DIST_TABLE_BITS) + 512;
+
+  uint32_t m_litlen_table[LITLEN_TABLE_SIZE];
+  uint32_t m_dist_table[DIST_TABLE_SIZE];
+  // scratch space for building the tables
+  uint8_t m_lengths[288 + 32];
+  uint16_t m_codes[288];
+  uint8_t m_subtable_bits[1 << LITLEN_TABLE_BITS];
+  uint16_t m_subtable_start[1 << LITLEN_TABLE_BITS];
+  // the tables currently hold the fixed huffman codes
+  bool m_have_fixed_tables = false;
+
+  bool build_table(uint32_t *table, size_t table_size, int table_bits, const uint8_t *lengths, int count, TableKind kind);
+  void pair_literals();
+
+public:
+  // inflate a raw deflate stream - fails if the data is corrupt or doesn't
+  // exactly fill the output buffer
+  bool inflate(const uint8_t *in, size_t in_size, uint8_t *out, size_t out_size);
+};
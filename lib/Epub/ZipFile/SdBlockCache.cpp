@@ -0,0 +1,114 @@
+#ifndef UNIT_TEST
+#include <esp_log.h>
+#if defined(BOARD_HAS_PSRAM)
+#include <esp_heap_caps.h>
+#endif
+#else
+#define ESP_LOGE(args...)
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "SdBlockCache.h"
+#include "ZipFile.h"
+
+static const char *TAG = "SDCACHE";
+
+SdBlockCache::SdBlockCache(File *file, ZipStats *stats) : m_file(file), m_stats(stats)
+{
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+  m_buffer = (uint8_t *)heap_caps_malloc(BLOCK_SIZE * BLOCK_COUNT, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+  m_buffer = (uint8_t *)malloc(BLOCK_SIZE * BLOCK_COUNT);
+#endif
+  if (!m_buffer)
+  {
+    // we can still work, every read will just go to the card
+    ESP_LOGE(TAG, "Failed to allocate block cache");
+    return;
+  }
+  for (int i = 0; i < BLOCK_COUNT; i++)
+  {
+    m_blocks[i].data = m_buffer + i * BLOCK_SIZE;
+  }
+}
+
+SdBlockCache::~SdBlockCache()
+{
+  free(m_buffer);
+}
+
+void SdBlockCache::clear()
+{
+  for (int i = 0; i < BLOCK_COUNT; i++)
+  {
+    m_blocks[i].length = 0;
+  }
+}
+
+size_t SdBlockCache::read_from_card(uint32_t offset, uint8_t *buffer, size_t size)
+{
+  if (!m_file->seek(offset))
+  {
+    return 0;
+  }
+  size_t read = m_file->read(buffer, size);
+  m_stats->read_calls++;
+  m_stats->bytes_read += read;
+  return read;
+}
+
+// find the block holding offset, loading it over the least recently used one if needed
+SdBlockCache::Block *SdBlockCache::get_block(uint32_t offset)
+{
+  uint32_t block_offset = offset - (offset % BLOCK_SIZE);
+  Block *victim = &m_blocks[0];
+  for (int i = 0; i < BLOCK_COUNT; i++)
+  {
+    Block *block = &m_blocks[i];
+    if (block->length > 0 && block->offset == block_offset)
+    {
+      m_stats->cache_hits++;
+      block->last_used = ++m_clock;
+      return block;
+    }
+    if (block->length == 0 || (victim->length > 0 && block->last_used < victim->last_used))
+    {
+      victim = block;
+    }
+  }
+  m_stats->cache_misses++;
+  victim->offset = block_offset;
+  victim->length = read_from_card(block_offset, victim->data, BLOCK_SIZE);
+  victim->last_used = ++m_clock;
+  return victim->length > 0 ? victim : nullptr;
+}
+
+size_t SdBlockCache::read(uint32_t offset, uint8_t *buffer, size_t size)
+{
+  if (!m_buffer || size >= BLOCK_SIZE)
+  {
+    // big reads gain nothing from going through the cache
+    m_stats->cache_misses++;
+    return read_from_card(offset, buffer, size);
+  }
+  size_t copied = 0;
+  while (copied < size)
+  {
+    Block *block = get_block(offset + copied);
+    if (!block)
+    {
+      break;
+    }
+    uint32_t block_pos = offset + copied - block->offset;
+    if (block_pos >= block->length)
+    {
+      // past the end of the file
+      break;
+    }
+    size_t chunk = std::min(size - copied, static_cast<size_t>(block->length - block_pos));
+    memcpy(buffer + copied, block->data + block_pos, chunk);
+    copied += chunk;
+  }
+  return copied;
+}
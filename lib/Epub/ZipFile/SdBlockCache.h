@@ -0,0 +1,47 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <SD.h>
+
+struct ZipStats;
+
+// Read-through cache of aligned blocks from a file on the SD card. Inflate
+// and the zip headers make lots of small reads that are close together, so
+// we read a whole block at a time and keep the most recently used ones in
+// RAM. Reads of a block or more go straight to the card.
+class SdBlockCache
+{
+public:
+  static const size_t BLOCK_SIZE = 8 * 1024;
+  static const int BLOCK_COUNT = 4;
+
+private:
+  struct Block
+  {
+    uint32_t offset;
+    // number of valid bytes - short at the end of the file, 0 if unused
+    uint32_t length;
+    uint32_t last_used;
+    uint8_t *data;
+  };
+  File *m_file;
+  ZipStats *m_stats;
+  uint8_t *m_buffer = nullptr;
+  Block m_blocks[BLOCK_COUNT] = {};
+  uint32_t m_clock = 0;
+
+  size_t read_from_card(uint32_t offset, uint8_t *buffer, size_t size);
+  Block *get_block(uint32_t offset);
+
+  SdBlockCache(const SdBlockCache &) = delete;
+  SdBlockCache &operator=(const SdBlockCache &) = delete;
+
+public:
+  SdBlockCache(File *file, ZipStats *stats);
+  ~SdBlockCache();
+  // read size bytes starting at offset - returns the number of bytes read
+  size_t read(uint32_t offset, uint8_t *buffer, size_t size);
+  // forget everything we've cached
+  void clear();
+};
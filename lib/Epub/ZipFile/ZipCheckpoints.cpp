@@ -0,0 +1,139 @@
+#ifndef UNIT_TEST
+#include <esp_log.h>
+#else
+#define ESP_LOGE(args...)
+#define ESP_LOGI(args...)
+#endif
+#include "ZipCheckpoints.h"
+
+static const char *TAG = "ZIPCP";
+
+static const uint32_t ZIP_CHECKPOINT_MAGIC = 0x50435A49; // 'IZCP'
+static const uint16_t ZIP_CHECKPOINT_VERSION = 1;
+static const char *ZIP_CHECKPOINT_EXTENSION = "ZCP";
+
+// read through the sidecar and remember where each checkpoint lives
+void ZipCheckpoints::load()
+{
+  m_loaded = true;
+  m_locations.clear();
+  File fp = m_cache.open_read(ZIP_CHECKPOINT_EXTENSION, ZIP_CHECKPOINT_MAGIC, ZIP_CHECKPOINT_VERSION);
+  if (!fp)
+  {
+    return;
+  }
+  size_t file_size = fp.size();
+  size_t offset = fp.position();
+  const size_t record_size = sizeof(ZipCheckpoint) + m_state_size + WINDOW_SIZE;
+  bool ok = true;
+  while (ok && offset < file_size)
+  {
+    Location location;
+    ok = offset + record_size <= file_size &&
+         fp.seek(offset) &&
+         fp.read((uint8_t *)&location.checkpoint, sizeof(ZipCheckpoint)) == sizeof(ZipCheckpoint) &&
+         location.checkpoint.state_size == m_state_size;
+    if (ok)
+    {
+      location.file_offset = offset + sizeof(ZipCheckpoint);
+      m_locations.push_back(location);
+      offset += record_size;
+    }
+  }
+  fp.close();
+  if (!ok)
+  {
+    // most likely we lost power while adding a checkpoint - they're easy
+    // enough to rebuild so just start again
+    ESP_LOGI(TAG, "Discarding damaged checkpoint file");
+    m_locations.clear();
+    m_cache.remove(ZIP_CHECKPOINT_EXTENSION);
+  }
+}
+
+const ZipCheckpoint *ZipCheckpoints::find(uint32_t local_header_offset, uint32_t position)
+{
+  if (!m_loaded)
+  {
+    load();
+  }
+  const ZipCheckpoint *best = nullptr;
+  for (const Location &location : m_locations)
+  {
+    const ZipCheckpoint &checkpoint = location.checkpoint;
+    if (checkpoint.local_header_offset == local_header_offset && checkpoint.out_offset <= position &&
+        (!best || checkpoint.out_offset > best->out_offset))
+    {
+      best = &checkpoint;
+    }
+  }
+  return best;
+}
+
+uint32_t ZipCheckpoints::get_last_offset(uint32_t local_header_offset)
+{
+  const ZipCheckpoint *last = find(local_header_offset, UINT32_MAX);
+  return last ? last->out_offset : 0;
+}
+
+bool ZipCheckpoints::restore(const ZipCheckpoint *checkpoint, void *state, uint8_t *window)
+{
+  // find uses our own list of locations so the checkpoint is one of them
+  const Location *location = nullptr;
+  for (const Location &candidate : m_locations)
+  {
+    if (&candidate.checkpoint == checkpoint)
+    {
+      location = &candidate;
+      break;
+    }
+  }
+  if (!location)
+  {
+    return false;
+  }
+  File fp = m_cache.open_read(ZIP_CHECKPOINT_EXTENSION, ZIP_CHECKPOINT_MAGIC, ZIP_CHECKPOINT_VERSION);
+  if (!fp)
+  {
+    return false;
+  }
+  bool ok = fp.seek(location->file_offset) &&
+            fp.read((uint8_t *)state, m_state_size) == m_state_size &&
+            fp.read(window, WINDOW_SIZE) == WINDOW_SIZE;
+  fp.close();
+  if (!ok)
+  {
+    ESP_LOGE(TAG, "Failed to read checkpoint at %u", checkpoint->out_offset);
+  }
+  return ok;
+}
+
+bool ZipCheckpoints::add(const ZipCheckpoint &checkpoint, const void *state, const uint8_t *window)
+{
+  if (!m_loaded)
+  {
+    load();
+  }
+  File fp = m_cache.open_append(ZIP_CHECKPOINT_EXTENSION, ZIP_CHECKPOINT_MAGIC, ZIP_CHECKPOINT_VERSION);
+  if (!fp)
+  {
+    return false;
+  }
+  Location location;
+  location.checkpoint = checkpoint;
+  location.checkpoint.state_size = m_state_size;
+  location.file_offset = fp.size() + sizeof(ZipCheckpoint);
+  bool ok = fp.write((const uint8_t *)&location.checkpoint, sizeof(ZipCheckpoint)) == sizeof(ZipCheckpoint) &&
+            fp.write((const uint8_t *)state, m_state_size) == m_state_size &&
+            fp.write(window, WINDOW_SIZE) == WINDOW_SIZE;
+  fp.close();
+  if (!ok)
+  {
+    ESP_LOGE(TAG, "Failed to save checkpoint");
+    m_locations.clear();
+    m_cache.remove(ZIP_CHECKPOINT_EXTENSION);
+    return false;
+  }
+  m_locations.push_back(location);
+  return true;
+}
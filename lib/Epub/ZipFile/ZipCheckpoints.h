@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+#include "../BookCache/BookCache.h"
+
+// A point part way through a compressed entry that inflate can be restarted
+// from. The inflate state and its 32K window follow it in the sidecar file.
+struct ZipCheckpoint
+{
+  // the entry this belongs to
+  uint32_t local_header_offset;
+  // uncompressed offset in the entry
+  uint32_t out_offset;
+  // file offset of the next compressed byte to feed to inflate
+  uint32_t in_offset;
+  // where inflate was writing to in its window
+  uint32_t window_offset;
+  // inflate status when the checkpoint was taken
+  int32_t status;
+  uint32_t state_size;
+};
+
+// Inflate checkpoints for the large entries in a book, like zlib's zran
+// example. They are recorded every so often as entries are inflated and
+// appended to a sidecar file so that a later seek into the middle of an
+// entry only has to inflate from the closest checkpoint instead of from
+// the start of the entry.
+class ZipCheckpoints
+{
+public:
+  static const size_t WINDOW_SIZE = 32768;
+
+private:
+  struct Location
+  {
+    ZipCheckpoint checkpoint;
+    // where the inflate state for the checkpoint starts in the file
+    uint32_t file_offset;
+  };
+  BookCache m_cache;
+  size_t m_state_size;
+  std::vector<Location> m_locations;
+  bool m_loaded = false;
+
+  void load();
+
+public:
+  // state_size is the size of the inflate state being saved - checkpoints
+  // from a build with a different inflate state are thrown away
+  ZipCheckpoints(const BookCache &cache, size_t state_size) : m_cache(cache), m_state_size(state_size) {}
+  // the closest checkpoint at or before position in the entry, or nullptr
+  const ZipCheckpoint *find(uint32_t local_header_offset, uint32_t position);
+  // uncompressed offset of the last checkpoint we have for an entry, 0 if there are none
+  uint32_t get_last_offset(uint32_t local_header_offset);
+  // read back the inflate state and window saved with a checkpoint
+  bool restore(const ZipCheckpoint *checkpoint, void *state, uint8_t *window);
+  // save a new checkpoint - they must be added in order for each entry
+  bool add(const ZipCheckpoint &checkpoint, const void *state, const uint8_t *window);
+};
@@ -12,6 +12,11 @@
 #define ESP_LOGI(args...)
 #endif
 #include "ZipFile.h"
+#include "ZipIndex.h"
+#include "SdBlockCache.h"
+#include "ZipCheckpoints.h"
+#include "FastInflate.h"
+#include "../BookCache/BookCache.h"
 
 #define MINIZ_NO_STDIO
 #define MINIZ_NO_TIME
@@ -21,105 +26,389 @@
 
 #define TAG "ZIP"
 
+// size of the chunks used when copying a file out of the archive
+static const size_t STREAM_CHUNK_BYTES = 4 * 1024;
+// size of the compressed data reads for whole-file extraction
+static const size_t READ_BUFFER_BYTES = 16 * 1024;
+// size of the compressed data reads for streams
+static const size_t STREAM_INPUT_BYTES = 4 * 1024;
+// below this the FastInflate table setup costs more than it saves so tinfl
+// is used whichever engine is selected
+static const size_t FAST_INFLATE_MIN_BYTES = 4 * 1024;
+
+struct ZipSession
+{
+  File file;
+  ZipStats *stats;
+  // all reads from the file go through here
+  SdBlockCache *cache;
+  // restart points for large compressed entries
+  ZipCheckpoints *checkpoints;
+  size_t checkpoint_interval;
+  // name -> entry lookup, loaded from the sidecar file or built from the central directory
+  ZipIndex index;
+  // inflate state and input buffer reused by every whole-file extraction
+  tinfl_decompressor inflator;
+  uint8_t *read_buffer;
+  ZIP_INFLATE_ENGINE inflate_engine;
+  // created the first time it's needed
+  FastInflate *fast_inflate;
+};
+
+struct ZipStreamState
+{
+  ZipSession *session;
+  ZipIndexEntry entry;
+  // where the entry's data starts in the zip file
+  uint32_t data_offset;
+  // next compressed byte to read from the SD card
+  uint32_t file_offset;
+  uint32_t comp_remaining;
+  tinfl_decompressor inflator;
+  tinfl_status status;
+  // the 32K inflate window - decoded bytes are handed out straight from here
+  uint8_t *window;
+  size_t window_ofs;
+  size_t window_read_ofs;
+  size_t window_avail;
+  uint8_t input[STREAM_INPUT_BYTES];
+  size_t input_ofs;
+  size_t input_avail;
+  mz_uint32 crc;
+  // we can only check the crc if the entry was read from start to end without seeking
+  bool check_crc;
+  // uncompressed offset to save the next checkpoint at, 0 if we're not saving them
+  size_t next_checkpoint;
+  bool failed;
+};
+
+static size_t read_at(ZipSession *session, uint32_t offset, uint8_t *buffer, size_t size)
+{
+  return session->cache->read(offset, buffer, size);
+}
+
 static size_t sd_read_callback(void *opaque, mz_uint64 file_ofs, void *pBuf, size_t n)
 {
   if (!opaque || !pBuf || n == 0)
   {
     return 0;
   }
-  File *fp = static_cast<File *>(opaque);
-  if (!fp->seek(file_ofs))
+  return read_at(static_cast<ZipSession *>(opaque), file_ofs, static_cast<uint8_t *>(pBuf), n);
+}
+
+// parse the central directory with miniz and turn it into our index
+static bool build_index(ZipSession *session)
+{
+  mz_zip_archive *zip_archive = (mz_zip_archive *)calloc(1, sizeof(mz_zip_archive));
+  if (!zip_archive)
   {
-    return 0;
+    ESP_LOGE(TAG, "Failed to allocate zip archive");
+    return false;
   }
-  return fp->read(static_cast<uint8_t *>(pBuf), n);
+  zip_archive->m_pRead = sd_read_callback;
+  zip_archive->m_pIO_opaque = session;
+  // we only look entries up by name through the index, so don't bother sorting
+  if (!mz_zip_reader_init(zip_archive, session->file.size(), MZ_ZIP_FLAG_DO_NOT_SORT_CENTRAL_DIRECTORY))
+  {
+    ESP_LOGE(TAG, "mz_zip_reader_init() failed!\n");
+    ESP_LOGE(TAG, "Error %s\n", mz_zip_get_error_string(zip_archive->m_last_error));
+    free(zip_archive);
+    return false;
+  }
+  mz_uint file_count = mz_zip_reader_get_num_files(zip_archive);
+  size_t name_pool_size = 0;
+  for (mz_uint i = 0; i < file_count; i++)
+  {
+    name_pool_size += mz_zip_reader_get_filename(zip_archive, i, nullptr, 0);
+  }
+  bool ok = session->index.begin_build(file_count, name_pool_size);
+  for (mz_uint i = 0; ok && i < file_count; i++)
+  {
+    mz_zip_archive_file_stat file_stat;
+    if (!mz_zip_reader_file_stat(zip_archive, i, &file_stat))
+    {
+      ESP_LOGE(TAG, "mz_zip_reader_file_stat() failed!\n");
+      ESP_LOGE(TAG, "Error %s\n", mz_zip_get_error_string(zip_archive->m_last_error));
+      ok = false;
+      break;
+    }
+    ZipIndexEntry entry = {};
+    entry.local_header_offset = file_stat.m_local_header_ofs;
+    entry.compressed_size = file_stat.m_comp_size;
+    entry.uncompressed_size = file_stat.m_uncomp_size;
+    entry.crc32 = file_stat.m_crc32;
+    entry.method = file_stat.m_is_encrypted ? 0xFFFF : file_stat.m_method;
+    session->index.add(i, file_stat.m_filename, entry);
+  }
+  mz_zip_reader_end(zip_archive);
+  free(zip_archive);
+  if (!ok)
+  {
+    session->index.clear();
+  }
+  return ok;
 }
 
-struct ZipExtractContext
+// work out where the data for an entry starts from its local header
+static bool get_data_offset(ZipSession *session, const ZipIndexEntry &entry, uint32_t *offset)
 {
-  uint8_t *buffer;
-  size_t size;
-  size_t yield_bytes;
-};
+  uint8_t header[MZ_ZIP_LOCAL_DIR_HEADER_SIZE];
+  if (read_at(session, entry.local_header_offset, header, sizeof(header)) != sizeof(header) ||
+      MZ_READ_LE32(header) != MZ_ZIP_LOCAL_DIR_HEADER_SIG)
+  {
+    ESP_LOGE(TAG, "Invalid local header at %u", entry.local_header_offset);
+    return false;
+  }
+  *offset = entry.local_header_offset + MZ_ZIP_LOCAL_DIR_HEADER_SIZE +
+            MZ_READ_LE16(header + MZ_ZIP_LDH_FILENAME_LEN_OFS) +
+            MZ_READ_LE16(header + MZ_ZIP_LDH_EXTRA_LEN_OFS);
+  return true;
+}
 
-static size_t zip_extract_callback(void *opaque, mz_uint64 file_ofs, const void *pBuf, size_t n)
+static bool is_supported(const ZipIndexEntry &entry)
 {
-  if (!opaque || !pBuf || n == 0)
+  if (entry.method == 0)
   {
-    return 0;
+    return entry.compressed_size == entry.uncompressed_size;
   }
-  ZipExtractContext *ctx = static_cast<ZipExtractContext *>(opaque);
-  if (!ctx->buffer || file_ofs >= ctx->size)
+  return entry.method == MZ_DEFLATED;
+}
+
+// copy a block of the zip file into memory a chunk at a time
+static bool read_to_buffer(ZipSession *session, uint32_t file_offset, uint8_t *dest, size_t size)
+{
+  size_t copied = 0;
+  while (copied < size)
   {
-    return 0;
-  }
-  size_t remaining = ctx->size - static_cast<size_t>(file_ofs);
-  size_t to_copy = n > remaining ? remaining : n;
-  memcpy(ctx->buffer + file_ofs, pBuf, to_copy);
-  ctx->yield_bytes += to_copy;
+    size_t chunk = std::min(READ_BUFFER_BYTES, size - copied);
+    if (read_at(session, file_offset + copied, dest + copied, chunk) != chunk)
+    {
+      return false;
+    }
+    copied += chunk;
 #ifndef UNIT_TEST
-  if (ctx->yield_bytes >= (16 * 1024))
+    vTaskDelay(1);
+#endif
+  }
+  return true;
+}
+
+// inflate with tinfl, feeding it the compressed data a chunk at a time
+static bool inflate_with_miniz(ZipSession *session, const ZipIndexEntry &entry, uint32_t file_offset, uint8_t *dest)
+{
+  // the destination holds the whole file so it can be used as the inflate window
+  tinfl_decompressor *inflator = &session->inflator;
+  tinfl_init(inflator);
+  uint32_t comp_remaining = entry.compressed_size;
+  size_t in_ofs = 0;
+  size_t in_avail = 0;
+  size_t out_ofs = 0;
+  tinfl_status status;
+  do
   {
-    ctx->yield_bytes = 0;
+    if (in_avail == 0 && comp_remaining > 0)
+    {
+      size_t chunk = std::min(READ_BUFFER_BYTES, static_cast<size_t>(comp_remaining));
+      if (read_at(session, file_offset, session->read_buffer, chunk) != chunk)
+      {
+        return false;
+      }
+      file_offset += chunk;
+      comp_remaining -= chunk;
+      in_ofs = 0;
+      in_avail = chunk;
+    }
+    size_t in_bytes = in_avail;
+    size_t out_bytes = entry.uncompressed_size - out_ofs;
+    mz_uint32 flags = TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF | (comp_remaining > 0 ? TINFL_FLAG_HAS_MORE_INPUT : 0);
+    status = tinfl_decompress(inflator, session->read_buffer + in_ofs, &in_bytes, dest, dest + out_ofs, &out_bytes, flags);
+    in_ofs += in_bytes;
+    in_avail -= in_bytes;
+    out_ofs += out_bytes;
+#ifndef UNIT_TEST
     vTaskDelay(1);
+#endif
+  } while (status == TINFL_STATUS_NEEDS_MORE_INPUT);
+  if (status != TINFL_STATUS_DONE || out_ofs != entry.uncompressed_size)
+  {
+    ESP_LOGE(TAG, "Inflate failed with status %d", status);
+    return false;
+  }
+  return true;
+}
+
+// pull all the compressed data into memory and inflate it in one go
+static bool inflate_with_fast_inflate(ZipSession *session, const ZipIndexEntry &entry, uint32_t file_offset, uint8_t *dest)
+{
+  if (!session->fast_inflate)
+  {
+    session->fast_inflate = new FastInflate();
   }
+  uint8_t *compressed;
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+  compressed = (uint8_t *)heap_caps_malloc(entry.compressed_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+  compressed = (uint8_t *)malloc(entry.compressed_size);
 #endif
-  return to_copy;
+  if (!compressed)
+  {
+    // not enough memory for both copies - let tinfl stream it instead
+    session->stats->inflate_fallbacks++;
+    return inflate_with_miniz(session, entry, file_offset, dest);
+  }
+  bool ok = read_to_buffer(session, file_offset, compressed, entry.compressed_size);
+  if (ok && !session->fast_inflate->inflate(compressed, entry.compressed_size, dest, entry.uncompressed_size))
+  {
+    ESP_LOGE(TAG, "Fast inflate failed, trying miniz");
+    session->stats->inflate_fallbacks++;
+    ok = inflate_with_miniz(session, entry, file_offset, dest);
+  }
+  free(compressed);
+  return ok;
 }
 
-// read a file from the zip file allocating the required memory for the data
-uint8_t *ZipFile::read_file_to_memory(const char *filename, size_t *size)
+// extract a whole entry straight into the destination buffer
+static bool extract_entry(ZipSession *session, const ZipIndexEntry &entry, uint8_t *dest)
+{
+  uint32_t file_offset = 0;
+  if (!is_supported(entry) || !get_data_offset(session, entry, &file_offset))
+  {
+    return false;
+  }
+  bool ok;
+  if (entry.method == 0)
+  {
+    // stored - just copy it off the card
+    ok = read_to_buffer(session, file_offset, dest, entry.uncompressed_size);
+  }
+  else if (session->inflate_engine == ZIP_INFLATE_FAST && entry.uncompressed_size >= FAST_INFLATE_MIN_BYTES)
+  {
+    ok = inflate_with_fast_inflate(session, entry, file_offset, dest);
+  }
+  else
+  {
+    ok = inflate_with_miniz(session, entry, file_offset, dest);
+  }
+  if (!ok)
+  {
+    return false;
+  }
+  if (mz_crc32(MZ_CRC32_INIT, dest, entry.uncompressed_size) != entry.crc32)
+  {
+    ESP_LOGE(TAG, "CRC check failed");
+    return false;
+  }
+  return true;
+}
+
+ZipFile::~ZipFile()
 {
-  File fp = SD.open(m_filename.c_str(), FILE_READ);
-  if (!fp)
+  close();
+}
+
+bool ZipFile::open()
+{
+  if (m_session)
+  {
+    return true;
+  }
+  ZipSession *session = new ZipSession();
+  session->file = SD.open(m_filename.c_str(), FILE_READ);
+  if (!session->file)
   {
     ESP_LOGE(TAG, "Failed to open zip file %s", m_filename.c_str());
-    return nullptr;
+    delete session;
+    return false;
+  }
+  m_stats.archive_opens++;
+  session->stats = &m_stats;
+  session->cache = new SdBlockCache(&session->file, &m_stats);
+  session->read_buffer = (uint8_t *)malloc(READ_BUFFER_BYTES);
+  if (!session->read_buffer)
+  {
+    ESP_LOGE(TAG, "Failed to allocate zip read buffer");
+    delete session->cache;
+    session->file.close();
+    delete session;
+    return false;
+  }
+  // use the sidecar index if we have a valid one for this version of the
+  // file, otherwise parse the central directory and save a new one
+  BookCache cache(m_filename, session->file.size(), session->file.getLastWrite());
+  if (!session->index.load(cache))
+  {
+    if (!build_index(session))
+    {
+      free(session->read_buffer);
+      delete session->cache;
+      session->file.close();
+      delete session;
+      return false;
+    }
+    m_stats.directory_scans++;
+    session->index.save(cache);
   }
-  size_t file_size = fp.size();
+  session->checkpoints = new ZipCheckpoints(cache, sizeof(tinfl_decompressor));
+  session->checkpoint_interval = m_checkpoint_interval;
+  session->inflate_engine = m_inflate_engine;
+  session->fast_inflate = nullptr;
+  m_session = session;
+  return true;
+}
 
-  // open up the epub file using miniz
-  mz_zip_archive *zip_archive = (mz_zip_archive *)calloc(1, sizeof(mz_zip_archive));
-  if (!zip_archive)
+void ZipFile::close()
+{
+  if (!m_session)
   {
-    ESP_LOGE(TAG, "Failed to allocate zip archive");
-    fp.close();
-    return nullptr;
+    return;
   }
-  zip_archive->m_pRead = sd_read_callback;
-  zip_archive->m_pIO_opaque = &fp;
-  bool status = mz_zip_reader_init(zip_archive, file_size, 0);
-  if (!status)
+  free(m_session->read_buffer);
+  delete m_session->checkpoints;
+  delete m_session->fast_inflate;
+  delete m_session->cache;
+  m_session->file.close();
+  delete m_session;
+  m_session = nullptr;
+}
+
+void ZipFile::set_checkpoint_interval(size_t interval)
+{
+  m_checkpoint_interval = interval;
+  if (m_session)
   {
-    ESP_LOGE(TAG, "mz_zip_reader_init_mem() failed!\n");
-    ESP_LOGE(TAG, "Error %s\n", mz_zip_get_error_string(zip_archive->m_last_error));
-    free(zip_archive);
-    fp.close();
-    return nullptr;
+    m_session->checkpoint_interval = interval;
   }
-  // find the file
-  mz_uint32 file_index = 0;
-  if (!mz_zip_reader_locate_file_v2(zip_archive, filename, nullptr, 0, &file_index))
+}
+
+void ZipFile::set_inflate_engine(ZIP_INFLATE_ENGINE engine)
+{
+  m_inflate_engine = engine;
+  if (m_session)
+  {
+    m_session->inflate_engine = engine;
+  }
+}
+
+const ZipIndexEntry *ZipFile::find_entry(const char *filename)
+{
+  if (!open())
   {
-    ESP_LOGE(TAG, "Could not find file %s", filename);
-    mz_zip_reader_end(zip_archive);
-    free(zip_archive);
-    fp.close();
     return nullptr;
   }
-  // get the file size - we do this all manually so we can add a null terminator to any strings
-  mz_zip_archive_file_stat file_stat;
-  if (!mz_zip_reader_file_stat(zip_archive, file_index, &file_stat))
+  return m_session->index.find(filename);
+}
+
+// read a file from the zip file allocating the required memory for the data
+uint8_t *ZipFile::read_file_to_memory(const char *filename, size_t *size)
+{
+  const ZipIndexEntry *entry = find_entry(filename);
+  if (!entry)
   {
-    ESP_LOGE(TAG, "mz_zip_reader_file_stat() failed!\n");
-    ESP_LOGE(TAG, "Error %s\n", mz_zip_get_error_string(zip_archive->m_last_error));
-    mz_zip_reader_end(zip_archive);
-    free(zip_archive);
-    fp.close();
+    ESP_LOGE(TAG, "Could not find file %s", filename);
     return nullptr;
   }
-  // allocate memory for the file (optionally in PSRAM)
-  size_t uncomp_size = file_stat.m_uncomp_size;
+  // allocate memory for the file (optionally in PSRAM) - with space for a null terminator for strings
+  size_t uncomp_size = entry->uncompressed_size;
   uint8_t *file_data;
 #if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
   file_data = (uint8_t *)heap_caps_calloc(uncomp_size + 1, 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
@@ -128,31 +417,15 @@ uint8_t *ZipFile::read_file_to_memory(const char *filename, size_t *size)
 #endif
   if (!file_data)
   {
-    ESP_LOGE(TAG, "Failed to allocate memory for %s\n", file_stat.m_filename);
-    mz_zip_reader_end(zip_archive);
-    fp.close();
+    ESP_LOGE(TAG, "Failed to allocate memory for %s\n", filename);
     return nullptr;
   }
-  ZipExtractContext ctx = {
-      .buffer = file_data,
-      .size = uncomp_size,
-      .yield_bytes = 0,
-  };
-  status = mz_zip_reader_extract_to_callback(zip_archive, file_index, zip_extract_callback, &ctx, 0);
-  if (!status)
+  if (!extract_entry(m_session, *entry, file_data))
   {
-    ESP_LOGE(TAG, "mz_zip_reader_extract_to_callback() failed!\n");
-    ESP_LOGE(TAG, "Error %s\n", mz_zip_get_error_string(zip_archive->m_last_error));
+    ESP_LOGE(TAG, "Failed to extract %s\n", filename);
     free(file_data);
-    mz_zip_reader_end(zip_archive);
-    free(zip_archive);
-    fp.close();
     return nullptr;
   }
-  // Close the archive, freeing any resources it was using
-  mz_zip_reader_end(zip_archive);
-  free(zip_archive);
-  fp.close();
   // return the size if required
   if (size)
   {
@@ -163,142 +436,316 @@ uint8_t *ZipFile::read_file_to_memory(const char *filename, size_t *size)
 
 bool ZipFile::get_file_uncompressed_size(const char *filename, size_t *size)
 {
-  if (!size)
+  bool stored;
+  return get_file_info(filename, size, &stored);
+}
+
+bool ZipFile::get_file_info(const char *filename, size_t *size, bool *stored)
+{
+  if (!size || !stored)
   {
     return false;
   }
   *size = 0;
-  File fp = SD.open(m_filename.c_str(), FILE_READ);
-  if (!fp)
+  *stored = false;
+  const ZipIndexEntry *entry = find_entry(filename);
+  if (!entry)
   {
-    ESP_LOGE(TAG, "Failed to open zip file %s", m_filename.c_str());
     return false;
   }
-  size_t file_size = fp.size();
+  *size = entry->uncompressed_size;
+  *stored = entry->method == 0;
+  return true;
+}
 
-  mz_zip_archive *zip_archive = (mz_zip_archive *)calloc(1, sizeof(mz_zip_archive));
-  if (!zip_archive)
+bool ZipFile::read_file_to_file(const char *filename, const char *dest)
+{
+  ZipEntryStream *stream = open_stream(filename);
+  if (!stream)
   {
-    ESP_LOGE(TAG, "Failed to allocate zip archive");
-    fp.close();
     return false;
   }
-  zip_archive->m_pRead = sd_read_callback;
-  zip_archive->m_pIO_opaque = &fp;
-  bool status = mz_zip_reader_init(zip_archive, file_size, 0);
-  if (!status)
+  ESP_LOGI(TAG, "Extracting %s\n", filename);
+  File dest_fp = SD.open(dest, FILE_WRITE);
+  if (!dest_fp)
   {
-    ESP_LOGE(TAG, "mz_zip_reader_init_mem() failed!\n");
-    ESP_LOGE(TAG, "Error %s\n", mz_zip_get_error_string(zip_archive->m_last_error));
-    free(zip_archive);
-    fp.close();
+    ESP_LOGE(TAG, "Failed to open destination file %s", dest);
+    delete stream;
     return false;
   }
-
-  mz_uint32 file_index = 0;
-  if (!mz_zip_reader_locate_file_v2(zip_archive, filename, nullptr, 0, &file_index))
+  // copy the file across a chunk at a time so we never hold all of it in memory
+  uint8_t *buffer = (uint8_t *)malloc(STREAM_CHUNK_BYTES);
+  bool ok = buffer != nullptr;
+  while (ok && !stream->eof())
   {
-    mz_zip_reader_end(zip_archive);
-    free(zip_archive);
-    fp.close();
-    return false;
+    size_t read = stream->read(buffer, STREAM_CHUNK_BYTES);
+    if (read == 0 || dest_fp.write(buffer, read) != read)
+    {
+      ok = false;
+    }
+#ifndef UNIT_TEST
+    vTaskDelay(1);
+#endif
   }
-
-  mz_zip_archive_file_stat file_stat;
-  if (!mz_zip_reader_file_stat(zip_archive, file_index, &file_stat))
+  free(buffer);
+  dest_fp.close();
+  if (!stream->close())
   {
-    ESP_LOGE(TAG, "mz_zip_reader_file_stat() failed!\n");
-    ESP_LOGE(TAG, "Error %s\n", mz_zip_get_error_string(zip_archive->m_last_error));
-    mz_zip_reader_end(zip_archive);
-    free(zip_archive);
-    fp.close();
-    return false;
+    ok = false;
   }
+  delete stream;
+  if (!ok)
+  {
+    ESP_LOGE(TAG, "Failed to extract %s to %s", filename, dest);
+    SD.remove(dest);
+  }
+  return ok;
+}
 
-  *size = file_stat.m_uncomp_size;
-  mz_zip_reader_end(zip_archive);
-  free(zip_archive);
-  fp.close();
-  return true;
+// go back to the start of the entry
+static void rewind_stream(ZipStreamState *state)
+{
+  state->file_offset = state->data_offset;
+  state->comp_remaining = state->entry.compressed_size;
+  state->status = TINFL_STATUS_NEEDS_MORE_INPUT;
+  state->window_ofs = 0;
+  state->window_read_ofs = 0;
+  state->window_avail = 0;
+  state->input_ofs = 0;
+  state->input_avail = 0;
+  state->crc = MZ_CRC32_INIT;
+  tinfl_init(&state->inflator);
 }
 
-bool ZipFile::read_file_to_file(const char *filename, const char *dest)
+ZipEntryStream *ZipFile::open_stream(const char *filename)
 {
-  File fp = SD.open(m_filename.c_str(), FILE_READ);
-  if (!fp)
+  const ZipIndexEntry *entry = find_entry(filename);
+  if (!entry)
   {
-    ESP_LOGE(TAG, "Failed to open zip file %s", m_filename.c_str());
-    return false;
+    ESP_LOGE(TAG, "Could not find file %s", filename);
+    return nullptr;
   }
-  size_t file_size = fp.size();
-
-  mz_zip_archive *zip_archive = (mz_zip_archive *)calloc(1, sizeof(mz_zip_archive));
-  if (!zip_archive)
+  uint32_t file_offset = 0;
+  if (!is_supported(*entry) || !get_data_offset(m_session, *entry, &file_offset))
   {
-    ESP_LOGE(TAG, "Failed to allocate zip archive");
-    fp.close();
-    return false;
+    ESP_LOGE(TAG, "Can't stream %s", filename);
+    return nullptr;
   }
-  zip_archive->m_pRead = sd_read_callback;
-  zip_archive->m_pIO_opaque = &fp;
-  bool status = mz_zip_reader_init(zip_archive, file_size, 0);
-  if (!status)
+  ZipStreamState *state = new ZipStreamState();
+  state->session = m_session;
+  state->entry = *entry;
+  state->data_offset = file_offset;
+  state->window = nullptr;
+  state->check_crc = true;
+  state->next_checkpoint = 0;
+  state->failed = false;
+  rewind_stream(state);
+  // only entries that take a while to inflate are worth checkpointing
+  size_t interval = m_session->checkpoint_interval;
+  if (entry->method == MZ_DEFLATED && interval > 0 && entry->uncompressed_size >= 2 * interval)
   {
-    ESP_LOGE(TAG, "mz_zip_reader_init_mem() failed!\n");
-    ESP_LOGE(TAG, "Error %s\n", mz_zip_get_error_string(zip_archive->m_last_error));
-    free(zip_archive);
-    fp.close();
-    return false;
+    state->next_checkpoint = m_session->checkpoints->get_last_offset(entry->local_header_offset) + interval;
   }
-  // Run through the archive and find the requiested file
-  for (int i = 0; i < (int)mz_zip_reader_get_num_files(zip_archive); i++)
+  if (entry->method == MZ_DEFLATED)
   {
-    mz_zip_archive_file_stat file_stat;
-    if (!mz_zip_reader_file_stat(zip_archive, i, &file_stat))
+    state->window = (uint8_t *)malloc(TINFL_LZ_DICT_SIZE);
+    if (!state->window)
     {
-      ESP_LOGE(TAG, "mz_zip_reader_file_stat() failed!\n");
-      ESP_LOGE(TAG, "Error %s\n", mz_zip_get_error_string(zip_archive->m_last_error));
-      mz_zip_reader_end(zip_archive);
-      free(zip_archive);
-      fp.close();
-      return false;
+      ESP_LOGE(TAG, "Failed to allocate inflate window");
+      delete state;
+      return nullptr;
     }
-    // is this the file we're looking for?
-    if (strcmp(filename, file_stat.m_filename) == 0)
+  }
+  return new ZipEntryStream(state, entry->uncompressed_size);
+}
+
+// save where we've got to so a later seek can start inflating from here
+static void add_checkpoint(ZipStreamState *state, size_t position)
+{
+  ZipCheckpoint checkpoint = {};
+  checkpoint.local_header_offset = state->entry.local_header_offset;
+  checkpoint.out_offset = position;
+  checkpoint.in_offset = state->file_offset - state->input_avail;
+  checkpoint.window_offset = state->window_ofs;
+  checkpoint.status = state->status;
+  if (state->session->checkpoints->add(checkpoint, &state->inflator, state->window))
+  {
+    state->next_checkpoint = position + state->session->checkpoint_interval;
+  }
+  else
+  {
+    state->next_checkpoint = 0;
+  }
+}
+
+// carry on inflating from a checkpoint
+static bool restore_checkpoint(ZipStreamState *state, const ZipCheckpoint *checkpoint)
+{
+  if (!state->session->checkpoints->restore(checkpoint, &state->inflator, state->window))
+  {
+    // the inflate state may be half overwritten so start again from scratch
+    rewind_stream(state);
+    return false;
+  }
+  state->file_offset = checkpoint->in_offset;
+  state->comp_remaining = state->entry.compressed_size - (checkpoint->in_offset - state->data_offset);
+  state->status = static_cast<tinfl_status>(checkpoint->status);
+  state->window_ofs = checkpoint->window_offset;
+  state->window_read_ofs = checkpoint->window_offset;
+  state->window_avail = 0;
+  state->input_ofs = 0;
+  state->input_avail = 0;
+  state->session->stats->checkpoint_restores++;
+  return true;
+}
+
+// inflate the next lot of data into the window - position is the
+// uncompressed offset of the start of the new data
+static bool fill_window(ZipStreamState *state, size_t position)
+{
+  if (state->next_checkpoint > 0 && position >= state->next_checkpoint)
+  {
+    add_checkpoint(state, position);
+  }
+  while (state->status == TINFL_STATUS_NEEDS_MORE_INPUT || state->status == TINFL_STATUS_HAS_MORE_OUTPUT)
+  {
+    if (state->input_avail == 0 && state->comp_remaining > 0)
     {
-      ESP_LOGI(TAG, "Extracting %s\n", file_stat.m_filename);
-      // since we are using the memory based reader, we need to extract to memory first
-      size_t uncomp_size;
-      void *p = mz_zip_reader_extract_to_heap(zip_archive, i, &uncomp_size, 0);
-      if (!p)
-      {
-        ESP_LOGE(TAG, "mz_zip_reader_extract_to_heap() failed\n");
-        mz_zip_reader_end(zip_archive);
-        free(zip_archive);
-        fp.close();
-        return false;
-      }
-      File dest_fp = SD.open(dest, FILE_WRITE);
-      if (!dest_fp)
+      size_t chunk = std::min(STREAM_INPUT_BYTES, static_cast<size_t>(state->comp_remaining));
+      if (read_at(state->session, state->file_offset, state->input, chunk) != chunk)
       {
-        ESP_LOGE(TAG, "Failed to open destination file %s", dest);
-        mz_free(p);
-        mz_zip_reader_end(zip_archive);
-        free(zip_archive);
-        fp.close();
         return false;
       }
-      dest_fp.write((uint8_t *)p, uncomp_size);
-      dest_fp.close();
-      mz_free(p);
-      mz_zip_reader_end(zip_archive);
-      free(zip_archive);
-      fp.close();
+      state->file_offset += chunk;
+      state->comp_remaining -= chunk;
+      state->input_ofs = 0;
+      state->input_avail = chunk;
+    }
+    size_t in_bytes = state->input_avail;
+    size_t out_bytes = TINFL_LZ_DICT_SIZE - state->window_ofs;
+    mz_uint32 flags = state->comp_remaining > 0 ? TINFL_FLAG_HAS_MORE_INPUT : 0;
+    state->status = tinfl_decompress(&state->inflator, state->input + state->input_ofs, &in_bytes,
+                                     state->window, state->window + state->window_ofs, &out_bytes, flags);
+    state->input_ofs += in_bytes;
+    state->input_avail -= in_bytes;
+    if (state->status < TINFL_STATUS_DONE)
+    {
+      ESP_LOGE(TAG, "Inflate failed with status %d", state->status);
+      return false;
+    }
+    if (out_bytes > 0)
+    {
+      state->window_read_ofs = state->window_ofs;
+      state->window_avail = out_bytes;
+      state->window_ofs = (state->window_ofs + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
       return true;
     }
   }
-  mz_zip_reader_end(zip_archive);
-  free(zip_archive);
-  fp.close();
+  // finished but still expecting data
   return false;
 }
+
+size_t ZipEntryStream::read(uint8_t *buffer, size_t size)
+{
+  if (!m_state || m_state->failed || !buffer || size == 0 || eof())
+  {
+    return 0;
+  }
+  size = std::min(size, m_size - m_position);
+  size_t copied = 0;
+  if (m_state->entry.method == 0)
+  {
+    copied = read_at(m_state->session, m_state->file_offset, buffer, size);
+    m_state->file_offset += copied;
+  }
+  else
+  {
+    while (copied < size)
+    {
+      if (m_state->window_avail == 0 && !fill_window(m_state, m_position + copied))
+      {
+        break;
+      }
+      size_t chunk = std::min(size - copied, m_state->window_avail);
+      memcpy(buffer + copied, m_state->window + m_state->window_read_ofs, chunk);
+      m_state->window_read_ofs += chunk;
+      m_state->window_avail -= chunk;
+      copied += chunk;
+    }
+  }
+  if (copied < size)
+  {
+    m_state->failed = true;
+  }
+  m_state->crc = mz_crc32(m_state->crc, buffer, copied);
+  m_position += copied;
+  return copied;
+}
+
+bool ZipEntryStream::is_stored() const
+{
+  return m_state && m_state->entry.method == 0;
+}
+
+bool ZipEntryStream::seek(size_t position)
+{
+  if (!m_state || m_state->failed || position > m_size)
+  {
+    return false;
+  }
+  if (position == m_position)
+  {
+    return true;
+  }
+  m_state->check_crc = false;
+  if (m_state->entry.method == 0)
+  {
+    // stored data maps straight onto the file
+    m_state->file_offset = m_state->data_offset + position;
+    m_position = position;
+    return true;
+  }
+  // jump to the closest checkpoint if that gets us nearer than where we are
+  const ZipCheckpoint *checkpoint = m_state->session->checkpoints->find(m_state->entry.local_header_offset, position);
+  if (checkpoint && (position < m_position || checkpoint->out_offset > m_position))
+  {
+    m_position = restore_checkpoint(m_state, checkpoint) ? checkpoint->out_offset : 0;
+  }
+  else if (position < m_position)
+  {
+    rewind_stream(m_state);
+    m_position = 0;
+  }
+  // inflate forwards to the new position, throwing away what we don't need
+  while (m_position < position)
+  {
+    if (m_state->window_avail == 0 && !fill_window(m_state, m_position))
+    {
+      m_state->failed = true;
+      return false;
+    }
+    size_t skip = std::min(position - m_position, m_state->window_avail);
+    m_state->window_read_ofs += skip;
+    m_state->window_avail -= skip;
+    m_position += skip;
+  }
+  return true;
+}
+
+bool ZipEntryStream::close()
+{
+  if (!m_state)
+  {
+    return true;
+  }
+  // a stream that was not read to the end can't be checked so don't treat that as an error
+  bool ok = !m_state->failed && (!eof() || !m_state->check_crc || m_state->crc == m_state->entry.crc32);
+  if (!ok)
+  {
+    ESP_LOGE(TAG, "Stream failed to decompress or CRC check failed");
+  }
+  free(m_state->window);
+  delete m_state;
+  m_state = nullptr;
+  return ok;
+}
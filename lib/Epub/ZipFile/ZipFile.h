@@ -1,21 +1,132 @@
 #pragma once
 
 #include <string>
+#include <stdint.h>
+#include <stddef.h>
 
+// counters describing how much work the zip session has done - used to
+// check that we are not re-opening and re-scanning the archive
+struct ZipStats
+{
+  // number of times the zip file has been opened on the SD card
+  uint32_t archive_opens;
+  // number of times the central directory has been parsed
+  uint32_t directory_scans;
+  // number of read requests issued to the SD card
+  uint32_t read_calls;
+  // total bytes read from the SD card
+  uint32_t bytes_read;
+  // reads served from the block cache
+  uint32_t cache_hits;
+  // reads that had to go to the SD card
+  uint32_t cache_misses;
+  // number of seeks that started inflating from a saved checkpoint
+  uint32_t checkpoint_restores;
+  // entries the fast inflate engine handed back to tinfl, either because it
+  // failed or there wasn't room for the compressed copy
+  uint32_t inflate_fallbacks;
+};
+
+// how whole files are inflated by read_file_to_memory
+typedef enum
+{
+  // tinfl, streaming the compressed data through a small buffer
+  ZIP_INFLATE_MINIZ = 0,
+  // FastInflate, with the compressed data read into memory first - small
+  // entries, or ones there isn't room for, still go through tinfl
+  ZIP_INFLATE_FAST = 1,
+} ZIP_INFLATE_ENGINE;
+
+// state for an open archive - defined in ZipFile.cpp so that the SD and
+// miniz headers don't leak into everything that includes this file
+struct ZipSession;
+struct ZipStreamState;
+struct ZipIndexEntry;
+
+// Pull-style reader for a single entry in the archive. Data is inflated
+// through a fixed size window as it is read, so memory use does not depend
+// on the size of the entry. The ZipFile it came from must stay open while
+// the stream is in use.
+class ZipEntryStream
+{
+private:
+  ZipStreamState *m_state;
+  size_t m_size;
+  size_t m_position = 0;
+
+  friend class ZipFile;
+  ZipEntryStream(ZipStreamState *state, size_t size) : m_state(state), m_size(size) {}
+
+  ZipEntryStream(const ZipEntryStream &) = delete;
+  ZipEntryStream &operator=(const ZipEntryStream &) = delete;
+
+public:
+  ~ZipEntryStream() { close(); }
+  // uncompressed size of the entry
+  size_t size() const { return m_size; }
+  // number of uncompressed bytes read so far
+  size_t position() const { return m_position; }
+  bool eof() const { return m_position >= m_size; }
+  // stored entries are read straight from the SD card with no inflate
+  // window, so seeking around them is cheap
+  bool is_stored() const;
+  // read up to size bytes - returns 0 at the end of the entry or on error
+  size_t read(uint8_t *buffer, size_t size);
+  // move to an uncompressed offset - compressed entries have to inflate
+  // their way there (from the start if seeking backwards)
+  bool seek(size_t position);
+  // finish with the entry - returns false if it failed to decompress
+  // or didn't match its checksum
+  bool close();
+};
+
+// A zip archive on the SD card. The archive is opened lazily on first use
+// and then kept open (file handle, entry index and the inflate buffers)
+// until close() is called or the object is destroyed. The central directory
+// is only parsed the first time a book is opened - after that the entry
+// index is loaded from a sidecar file in the cache folder.
 class ZipFile
 {
 private:
   std::string m_filename;
+  ZipSession *m_session = nullptr;
+  ZipStats m_stats = {};
+  size_t m_checkpoint_interval = 0;
+  ZIP_INFLATE_ENGINE m_inflate_engine = ZIP_INFLATE_MINIZ;
+
+  // open the archive and load or build the entry index if we haven't already
+  bool open();
+  const ZipIndexEntry *find_entry(const char *filename);
+
+  ZipFile(const ZipFile &) = delete;
+  ZipFile &operator=(const ZipFile &) = delete;
 
 public:
   ZipFile(const char *filename)
   {
     m_filename = filename;
   }
-  ~ZipFile() {}
+  ~ZipFile();
+  // release the file handle, entry index and inflate buffers
+  void close();
+  bool is_open() const { return m_session != nullptr; }
+  const ZipStats &get_stats() const { return m_stats; }
+  // save inflate checkpoints every interval uncompressed bytes as large
+  // entries are streamed, so that seeking into them later is quick - 0 turns
+  // this off (the default)
+  void set_checkpoint_interval(size_t interval);
+  // tinfl by default - the fast engine needs room for a copy of each entry's
+  // compressed data and is only 5-30% quicker on the fixture books
+  void set_inflate_engine(ZIP_INFLATE_ENGINE engine);
   // read a file from the zip file allocating the required memory for the data
   uint8_t *read_file_to_memory(const char *filename, size_t *size = nullptr);
   // read the uncompressed size of a file without extracting it
   bool get_file_uncompressed_size(const char *filename, size_t *size);
+  // the same and whether the file is stored rather than deflated - both come
+  // from the index so nothing is opened or allocated
+  bool get_file_info(const char *filename, size_t *size, bool *stored);
   bool read_file_to_file(const char *filename, const char *dest);
+  // open a file in the zip for streaming - returns nullptr if the file can't
+  // be found, the caller is responsible for deleting the stream
+  ZipEntryStream *open_stream(const char *filename);
 };
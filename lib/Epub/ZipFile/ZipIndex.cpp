@@ -0,0 +1,234 @@
+#ifndef UNIT_TEST
+#include <esp_log.h>
+#if defined(BOARD_HAS_PSRAM)
+#include <esp_heap_caps.h>
+#endif
+#else
+#define ESP_LOGE(args...)
+#define ESP_LOGI(args...)
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include "ZipIndex.h"
+#include "../BookCache/BookCache.h"
+
+static const char *TAG = "ZIPIDX";
+
+static const uint32_t ZIP_INDEX_MAGIC = 0x5844495A; // 'ZIDX'
+static const uint16_t ZIP_INDEX_VERSION = 1;
+static const char *ZIP_INDEX_EXTENSION = "ZIX";
+static const size_t ZIP_INDEX_HEADER_SIZE = 3 * sizeof(uint32_t);
+
+static inline char lower_ascii(char c)
+{
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+// FNV-1a of the name with ASCII letters folded to lower case
+static uint32_t hash_name(const char *name, size_t *length)
+{
+  uint32_t hash = 2166136261u;
+  const char *p = name;
+  for (; *p; ++p)
+  {
+    hash ^= static_cast<unsigned char>(lower_ascii(*p));
+    hash *= 16777619u;
+  }
+  *length = p - name;
+  return hash;
+}
+
+static size_t index_size(uint32_t entry_count, uint32_t bucket_count, size_t name_pool_size)
+{
+  return ZIP_INDEX_HEADER_SIZE + entry_count * sizeof(ZipIndexEntry) + bucket_count * sizeof(uint32_t) + name_pool_size;
+}
+
+void ZipIndex::clear()
+{
+  free(m_data);
+  m_data = nullptr;
+  m_entries = nullptr;
+  m_buckets = nullptr;
+  m_names = nullptr;
+  m_entry_count = 0;
+  m_bucket_count = 0;
+  m_size = 0;
+}
+
+// point the tables into a block of index data, checking that it all hangs together
+bool ZipIndex::attach(uint8_t *data, size_t size)
+{
+  if (size < ZIP_INDEX_HEADER_SIZE)
+  {
+    return false;
+  }
+  uint32_t header[3];
+  memcpy(header, data, sizeof(header));
+  uint32_t entry_count = header[0];
+  uint32_t bucket_count = header[1];
+  uint32_t name_pool_size = header[2];
+  // the bucket count must be a power of two larger than the number of entries,
+  // and neither count can be so big that working out the size overflows
+  if (bucket_count <= entry_count || (bucket_count & (bucket_count - 1)) != 0 ||
+      entry_count > size / sizeof(ZipIndexEntry) || bucket_count > size / sizeof(uint32_t) ||
+      index_size(entry_count, bucket_count, name_pool_size) != size)
+  {
+    return false;
+  }
+  ZipIndexEntry *entries = reinterpret_cast<ZipIndexEntry *>(data + ZIP_INDEX_HEADER_SIZE);
+  uint32_t *buckets = reinterpret_cast<uint32_t *>(data + ZIP_INDEX_HEADER_SIZE + entry_count * sizeof(ZipIndexEntry));
+  const char *names = reinterpret_cast<const char *>(buckets + bucket_count);
+  for (uint32_t i = 0; i < entry_count; i++)
+  {
+    if (entries[i].name_offset >= name_pool_size || entries[i].name_length >= name_pool_size - entries[i].name_offset ||
+        names[entries[i].name_offset + entries[i].name_length] != '\0')
+    {
+      return false;
+    }
+  }
+  // every entry has to be in exactly one bucket - with more buckets than
+  // entries that leaves at least one empty bucket to stop a lookup
+  uint8_t *seen = static_cast<uint8_t *>(calloc((entry_count + 7) / 8 + 1, 1));
+  if (!seen)
+  {
+    return false;
+  }
+  uint32_t used = 0;
+  bool valid = true;
+  for (uint32_t i = 0; i < bucket_count && valid; i++)
+  {
+    uint32_t slot = buckets[i];
+    if (slot == 0)
+    {
+      continue;
+    }
+    uint32_t entry = slot - 1;
+    if (slot > entry_count || (seen[entry / 8] & (1 << (entry % 8))))
+    {
+      valid = false;
+    }
+    else
+    {
+      seen[entry / 8] |= 1 << (entry % 8);
+      used++;
+    }
+  }
+  free(seen);
+  if (!valid || used != entry_count)
+  {
+    return false;
+  }
+  m_data = data;
+  m_size = size;
+  m_entry_count = entry_count;
+  m_bucket_count = bucket_count;
+  m_entries = entries;
+  m_buckets = buckets;
+  m_names = names;
+  return true;
+}
+
+const ZipIndexEntry *ZipIndex::find(const char *name) const
+{
+  if (!m_data || !name)
+  {
+    return nullptr;
+  }
+  size_t length = 0;
+  uint32_t mask = m_bucket_count - 1;
+  uint32_t bucket = hash_name(name, &length) & mask;
+  // there's always an empty bucket, but don't rely on it
+  for (uint32_t probes = 0; probes < m_bucket_count; probes++, bucket = (bucket + 1) & mask)
+  {
+    uint32_t slot = m_buckets[bucket];
+    if (slot == 0)
+    {
+      return nullptr;
+    }
+    const ZipIndexEntry &entry = m_entries[slot - 1];
+    if (entry.name_length == length && strncasecmp(m_names + entry.name_offset, name, length) == 0)
+    {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+bool ZipIndex::begin_build(uint32_t entry_count, size_t name_pool_size)
+{
+  clear();
+  // keep the table at most half full so probe sequences stay short
+  uint32_t bucket_count = 16;
+  while (bucket_count < entry_count * 2)
+  {
+    bucket_count <<= 1;
+  }
+  size_t size = index_size(entry_count, bucket_count, name_pool_size);
+  uint8_t *data;
+#if !defined(UNIT_TEST) && defined(BOARD_HAS_PSRAM)
+  data = (uint8_t *)heap_caps_calloc(size, 1, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+#else
+  data = (uint8_t *)calloc(size, 1);
+#endif
+  if (!data)
+  {
+    ESP_LOGE(TAG, "Failed to allocate %u bytes for zip index", size);
+    return false;
+  }
+  uint32_t header[3] = {entry_count, bucket_count, static_cast<uint32_t>(name_pool_size)};
+  memcpy(data, header, sizeof(header));
+  m_data = data;
+  m_size = size;
+  m_entry_count = entry_count;
+  m_bucket_count = bucket_count;
+  m_entries = reinterpret_cast<ZipIndexEntry *>(data + ZIP_INDEX_HEADER_SIZE);
+  m_buckets = reinterpret_cast<uint32_t *>(data + ZIP_INDEX_HEADER_SIZE + entry_count * sizeof(ZipIndexEntry));
+  m_names = reinterpret_cast<const char *>(m_buckets + bucket_count);
+  return true;
+}
+
+void ZipIndex::add(uint32_t index, const char *name, const ZipIndexEntry &entry)
+{
+  // names are packed back to back (with terminators) in the order they are added
+  uint32_t name_offset = index == 0 ? 0 : m_entries[index - 1].name_offset + m_entries[index - 1].name_length + 1;
+  size_t length = 0;
+  uint32_t mask = m_bucket_count - 1;
+  uint32_t bucket = hash_name(name, &length) & mask;
+  memcpy(const_cast<char *>(m_names) + name_offset, name, length + 1);
+  m_entries[index] = entry;
+  m_entries[index].name_offset = name_offset;
+  m_entries[index].name_length = static_cast<uint16_t>(length);
+  while (m_buckets[bucket] != 0)
+  {
+    bucket = (bucket + 1) & mask;
+  }
+  m_buckets[bucket] = index + 1;
+}
+
+bool ZipIndex::load(BookCache &cache)
+{
+  clear();
+  size_t size = 0;
+  uint8_t *data = cache.read(ZIP_INDEX_EXTENSION, ZIP_INDEX_MAGIC, ZIP_INDEX_VERSION, &size);
+  if (!data)
+  {
+    return false;
+  }
+  if (!attach(data, size))
+  {
+    ESP_LOGE(TAG, "Zip index failed validation - rebuilding");
+    free(data);
+    cache.remove(ZIP_INDEX_EXTENSION);
+    return false;
+  }
+  return true;
+}
+
+bool ZipIndex::save(BookCache &cache)
+{
+  if (!m_data)
+  {
+    return false;
+  }
+  return cache.write(ZIP_INDEX_EXTENSION, ZIP_INDEX_MAGIC, ZIP_INDEX_VERSION, m_data, m_size);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+class BookCache;
+
+// everything we need to pull an entry out of the archive without going
+// anywhere near the central directory
+struct ZipIndexEntry
+{
+  // where the entry's name lives in the name pool
+  uint32_t name_offset;
+  uint32_t local_header_offset;
+  uint32_t compressed_size;
+  uint32_t uncompressed_size;
+  uint32_t crc32;
+  uint16_t name_length;
+  // 0 = stored, 8 = deflated
+  uint16_t method;
+};
+
+// A hash table of entry name -> ZipIndexEntry. It is built from the central
+// directory the first time a book is opened and then saved next to the book
+// so that later opens can load it with a single read.
+//
+// Layout (also the layout of the sidecar file after the BookCache header):
+//   uint32_t entry_count, bucket_count, name_pool_size
+//   ZipIndexEntry entries[entry_count]
+//   uint32_t buckets[bucket_count]   - entry index + 1, 0 for empty
+//   char names[name_pool_size]
+class ZipIndex
+{
+private:
+  uint8_t *m_data = nullptr;
+  uint32_t m_entry_count = 0;
+  uint32_t m_bucket_count = 0;
+  ZipIndexEntry *m_entries = nullptr;
+  uint32_t *m_buckets = nullptr;
+  const char *m_names = nullptr;
+  size_t m_size = 0;
+
+  bool attach(uint8_t *data, size_t size);
+
+public:
+  ~ZipIndex() { clear(); }
+  void clear();
+  bool is_loaded() const { return m_data != nullptr; }
+  uint32_t get_entry_count() const { return m_entry_count; }
+  const ZipIndexEntry &get_entry(uint32_t index) const { return m_entries[index]; }
+  const char *get_name(const ZipIndexEntry &entry) const { return m_names + entry.name_offset; }
+  // find an entry - names are compared ignoring case to match miniz
+  const ZipIndexEntry *find(const char *name) const;
+  // start building a new index with room for the given entries and names
+  bool begin_build(uint32_t entry_count, size_t name_pool_size);
+  // add an entry - entries must be added in order
+  void add(uint32_t index, const char *name, const ZipIndexEntry &entry);
+  // load from / save to the sidecar file
+  bool load(BookCache &cache);
+  bool save(BookCache &cache);
+};
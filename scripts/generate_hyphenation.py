@@ -0,0 +1,242 @@
+import argparse
+import collections
+import glob
+import os
+import re
+
+# Compiles TeX hyphenation patterns (the hyph-utf8 .pat.txt and .hyp.txt
+# files) into packed tries that live in flash, so nothing has to be parsed
+# when the reader starts. Prints the header.
+#
+#   python3 scripts/generate_hyphenation.py scripts/hyphenation > lib/Epub/Hyphenation/hyphenationTries.h
+#
+# Every hyph-<language>.pat.txt in the directory becomes one trie, along with
+# the exception words from hyph-<language>.hyp.txt if there is one. Each
+# language needs its hyph-<language>.lic.txt too, which is copied into the
+# header next to its tables. The trie layout has to match the lookup in
+# Hyphenator.cpp.
+
+# the shortest start and end of a word that can be split off - from the
+# hyph-utf8 metadata for each language
+MINIMUMS = {
+    "de-1996": (2, 2),
+    "en-us": (2, 3),
+    "es": (2, 2),
+    "fr": (2, 3),
+    "it": (2, 2),
+}
+DEFAULT_MINIMUMS = (2, 3)
+
+# exception words become patterns covering the whole word with values that
+# beat anything a pattern can say - odd where the word can be hyphenated
+EXCEPTION_HYPHEN = 11
+EXCEPTION_NO_HYPHEN = 10
+
+parser = argparse.ArgumentParser(description="Generate packed hyphenation tries from TeX patterns")
+parser.add_argument("directory", help="The directory containing the hyph-*.pat.txt files")
+args = parser.parse_args()
+
+
+def read_lines(path):
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            # hyph-utf8 files have % comments
+            line = line.split("%")[0].strip()
+            if line:
+                yield line
+
+
+def parse_pattern(pattern):
+    # "a1b2c" becomes "abc" and the value before and after each letter
+    letters = ""
+    values = [0]
+    for c in pattern:
+        if c.isdigit():
+            values[-1] = int(c)
+        else:
+            letters += c.lower()
+            values.append(0)
+    return letters, values
+
+
+def parse_exception(word):
+    letters = word.replace("-", "").lower()
+    hyphens = set()
+    for part in word.split("-")[:-1]:
+        hyphens.add(len(part) + (max(hyphens) if hyphens else 0))
+    # a value before each letter but the first, nothing next to the dots
+    values = [0, 0]
+    values += [EXCEPTION_HYPHEN if i in hyphens else EXCEPTION_NO_HYPHEN for i in range(1, len(letters))]
+    values += [0, 0]
+    return "." + letters + ".", values
+
+
+class Node:
+    def __init__(self):
+        self.children = {}
+        self.values = None
+        self.base = 0
+
+
+def bits_for(value):
+    return max(1, value.bit_length())
+
+
+def compile_language(name, patterns, exceptions):
+    alphabet = sorted(set(c for letters, _ in patterns + exceptions for c in letters if c != "."))
+    codes = {c: i + 1 for i, c in enumerate(alphabet)}
+    codes["."] = 0
+    root = Node()
+    for letters, values in patterns + exceptions:
+        node = root
+        for c in letters:
+            node = node.children.setdefault(codes[c], Node())
+        if node.values:
+            # an exception wins over a pattern for the same letters
+            values = [max(a, b) for a, b in zip(node.values, values)]
+        node.values = values
+
+    # each distinct set of values is stored once as the first slot with a
+    # value, the number of values and then the values
+    value_data = [0]
+    value_index = {}
+    value_offsets = [0]
+
+    def store_values(values):
+        start = next(i for i, v in enumerate(values) if v)
+        end = max(i for i, v in enumerate(values) if v) + 1
+        key = (start, tuple(values[start:end]))
+        if key not in value_index:
+            value_index[key] = len(value_offsets)
+            value_offsets.append(len(value_data))
+            value_data.extend([start, end - start] + values[start:end])
+        return value_index[key]
+
+    # pack the nodes so each one's children are at its base plus their code,
+    # with the "." that ends a word as code 0. The transition into a node
+    # holds its values, so nodes without children don't need a base at all.
+    # Transitions only record their letter, so every base has to be
+    # different to stop one node seeing another's children.
+    nodes = []
+    queue = collections.deque([root])
+    while queue:
+        node = queue.popleft()
+        nodes.append(node)
+        queue.extend(node.children[c] for c in sorted(node.children))
+    used = bytearray(len(nodes) * 2 + len(alphabet) + 1)
+    used_bases = bytearray(len(used))
+    first_free = 0
+    for node in nodes:
+        if not node.children:
+            continue
+        while used[first_free]:
+            first_free += 1
+        base = max(0, first_free - min(node.children))
+        while used_bases[base] or any(used[base + c] for c in node.children):
+            base += 1
+        node.base = base
+        used_bases[base] = 1
+        for c in node.children:
+            used[base + c] = 1
+    size = max(node.base for node in nodes) + len(alphabet) + 1
+
+    char_bits = bits_for(len(alphabet))
+    link_bits = bits_for(size)
+    value_bits = 32 - char_bits - link_bits
+    trie = [0] * size
+    for node in nodes:
+        for c, child in node.children.items():
+            values = store_values(child.values) if child.values and any(child.values) else 0
+            trie[node.base + c] = values << (char_bits + link_bits) | child.base << char_bits | c
+    if len(value_offsets) >= (1 << value_bits):
+        raise SystemExit("{}: too many values for a 32 bit trie entry".format(name))
+    if len(value_data) >= (1 << 16):
+        raise SystemExit("{}: too many values for 16 bit offsets".format(name))
+    left_min, right_min = MINIMUMS.get(name, DEFAULT_MINIMUMS)
+    return {
+        "name": name,
+        "alphabet": [ord(c) for c in alphabet],
+        "trie": trie,
+        "char_bits": char_bits,
+        "link_bits": link_bits,
+        "values": value_data,
+        "value_offsets": value_offsets,
+        "left_min": left_min,
+        "right_min": right_min,
+        "pattern_count": len(patterns),
+        "exception_count": len(exceptions),
+    }
+
+
+def format_table(values, per_line=12):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(values[i : i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+languages = []
+for path in sorted(glob.glob(os.path.join(args.directory, "hyph-*.pat.txt"))):
+    name = os.path.basename(path)[len("hyph-") : -len(".pat.txt")]
+    patterns = [parse_pattern(p) for p in read_lines(path)]
+    exceptions_path = path[: -len(".pat.txt")] + ".hyp.txt"
+    exceptions = []
+    if os.path.exists(exceptions_path):
+        exceptions = [parse_exception(w) for w in read_lines(exceptions_path)]
+    licence_path = path[: -len(".pat.txt")] + ".lic.txt"
+    if not os.path.exists(licence_path):
+        raise SystemExit("{}: no licence file {}".format(name, licence_path))
+    language = compile_language(name, patterns, exceptions)
+    with open(licence_path, encoding="utf-8") as f:
+        language["licence"] = f.read().rstrip().split("\n")
+    languages.append(language)
+
+print("#pragma once")
+print("")
+print("// generated by scripts/generate_hyphenation.py - do not edit")
+print("")
+print("#include <stdint.h>")
+print('#include "Hyphenator.h"')
+total = 0
+for language in languages:
+    prefix = "HYPH_" + re.sub(r"[^A-Z0-9]", "_", language["name"].upper())
+    total += len(language["trie"]) * 4 + len(language["values"]) + len(language["value_offsets"]) * 2 + len(language["alphabet"]) * 2
+    print("")
+    print("// {}: {} patterns, {} exceptions".format(language["name"], language["pattern_count"], language["exception_count"]))
+    print("//")
+    for line in language["licence"]:
+        print("// {}".format(line.lstrip("% ")).rstrip())
+    print("static const uint16_t {}_ALPHABET[] = {{".format(prefix))
+    print(format_table(["0x{:x}".format(c) for c in language["alphabet"]]))
+    print("};")
+    print("static const uint32_t {}_TRIE[] = {{".format(prefix))
+    print(format_table(["0x{:x}".format(e) for e in language["trie"]], 8))
+    print("};")
+    print("static const uint8_t {}_VALUES[] = {{".format(prefix))
+    print(format_table([str(v) for v in language["values"]], 24))
+    print("};")
+    print("static const uint16_t {}_VALUE_OFFSETS[] = {{".format(prefix))
+    print(format_table([str(v) for v in language["value_offsets"]], 16))
+    print("};")
+    language["prefix"] = prefix
+print("")
+print("// {} bytes of tables".format(total))
+print("static const HyphenationPatterns HYPHENATION_PATTERNS[] = {")
+for language in languages:
+    prefix = language["prefix"]
+    print(
+        '    {{"{}", {}_ALPHABET, {}, {}_TRIE, {}, {}, {}, {}_VALUES, {}_VALUE_OFFSETS, {}, {}}},'.format(
+            language["name"],
+            prefix,
+            len(language["alphabet"]),
+            prefix,
+            len(language["trie"]),
+            language["char_bits"],
+            language["link_bits"],
+            prefix,
+            prefix,
+            language["left_min"],
+            language["right_min"],
+        )
+    )
+print("};")
@@ -0,0 +1,93 @@
+import argparse
+import re
+
+# Generates perfect hash tables for a fixed set of names - e.g. the named
+# HTML entities or the tags the parser knows about. Reads the names from the
+# NAME("...", ...) table in a source file and prints the header.
+#
+#   python3 scripts/generate_perfect_hash.py lib/Epub/RubbishHtmlParser/htmlEntities.cpp ENTITY ENTITY_HASH > lib/Epub/RubbishHtmlParser/htmlEntityHash.h
+#   python3 scripts/generate_perfect_hash.py lib/Epub/RubbishHtmlParser/HtmlTags.cpp TAG TAG_HASH --ignore-case > lib/Epub/RubbishHtmlParser/htmlTagHash.h
+#
+# The hash functions here have to match the ones in PerfectHash.h - the C++
+# build checks the tables against them.
+
+EMPTY = 255
+MASK = 0xFFFFFFFF
+
+parser = argparse.ArgumentParser(description="Generate a perfect hash for a table of names")
+parser.add_argument("source", help="The source file containing the table")
+parser.add_argument("macro", help="The macro used for each entry in the table")
+parser.add_argument("prefix", help="Prefix for the generated names")
+parser.add_argument("--buckets", type=int, default=64, help="Number of first level buckets")
+parser.add_argument("--slots", type=int, default=512, help="Number of slots")
+parser.add_argument("--ignore-case", action="store_true", help="Hash ASCII letters case insensitively")
+args = parser.parse_args()
+
+with open(args.source, encoding="utf-8") as f:
+    names = re.findall(r'^\s*' + args.macro + r'\("([^"]+)"', f.read(), re.MULTILINE)
+
+if len(names) >= EMPTY:
+    raise SystemExit("Too many names for 8 bit slot indexes")
+if args.ignore_case:
+    names = [name.lower() for name in names]
+
+
+def perfect_hash_seed(seed):
+    return (2166136261 ^ (seed * 0x9E3779B9)) & MASK
+
+
+def perfect_hash(hash, name):
+    for c in name.encode("utf-8"):
+        hash = ((hash ^ c) * 16777619) & MASK
+    return hash
+
+
+# put each name in a bucket, then starting with the fullest bucket find a
+# seed that puts everything in the bucket into free slots
+buckets = [[] for _ in range(args.buckets)]
+for index, name in enumerate(names):
+    buckets[perfect_hash(perfect_hash_seed(0), name) % args.buckets].append(index)
+
+seeds = [0] * args.buckets
+slot_index = [EMPTY] * args.slots
+for bucket in sorted(range(args.buckets), key=lambda b: -len(buckets[b])):
+    if not buckets[bucket]:
+        continue
+    for seed in range(1, 256):
+        slots = [perfect_hash(perfect_hash_seed(seed), names[i]) % args.slots for i in buckets[bucket]]
+        if len(set(slots)) == len(slots) and all(slot_index[s] == EMPTY for s in slots):
+            break
+    else:
+        raise SystemExit("Could not find a seed for bucket {} - try more slots".format(bucket))
+    seeds[bucket] = seed
+    for i, s in zip(buckets[bucket], slots):
+        slot_index[s] = i
+
+
+def format_table(values):
+    lines = []
+    for i in range(0, len(values), 16):
+        lines.append("    " + ", ".join(str(v) for v in values[i : i + 16]) + ",")
+    return "\n".join(lines)
+
+
+prefix = args.prefix
+print("#pragma once")
+print("")
+print("// generated by scripts/generate_perfect_hash.py - do not edit")
+print("")
+print("#include <stdint.h>")
+print("")
+print("static const uint32_t {}_BUCKETS = {};".format(prefix, args.buckets))
+print("static const uint32_t {}_SLOTS = {};".format(prefix, args.slots))
+print("static const uint8_t {}_EMPTY = {};".format(prefix, EMPTY))
+print("")
+print("// seed for the second hash of each bucket")
+print("static constexpr uint8_t {0}_SEEDS[{0}_BUCKETS] = {{".format(prefix))
+print(format_table(seeds))
+print("};")
+print("")
+print("// index into the table for each slot")
+print("static constexpr uint8_t {0}_SLOT_INDEX[{0}_SLOTS] = {{".format(prefix))
+print(format_table(slot_index))
+print("};")
@@ -316,6 +316,16 @@ void loop()
       renderer->flush_display();
     }
   }
+  else if (ui_state == READING_EPUB && reader)
+  {
+    // nothing to do so carry on laying out the rest of the section and
+    // then count the pages in the rest of the book - a bit at a time so
+    // we get back to the buttons quickly
+    if (!reader->continue_layout())
+    {
+      reader->paginate_book();
+    }
+  }
 }
 // All the other functions from the original main.cpp go here
 static int find_last_open_book_index()
@@ -1304,7 +1314,37 @@ void draw_battery_level(Renderer *renderer, float voltage, float percentage)
     if (item.pages_in_current_section > 0)
     {
       char page_str[32];
-      if (item.bookmark_set)
+      int book_page = 0;
+      int book_pages = 0;
+      int percent = 0;
+      int pages_left = 0;
+      if (reader && reader->get_book_position(book_page, book_pages))
+      {
+        // every section has been counted so we can show where we are in the book
+        snprintf(page_str, sizeof(page_str), "%d/%d  %d%%%s",
+                 book_page + 1,
+                 book_pages,
+                 (book_page + 1) * 100 / book_pages,
+                 item.bookmark_set ? " [B]" : "");
+      }
+      else if (reader && reader->get_progress_estimate(percent, pages_left))
+      {
+        // still counting - guess from the size of the sections
+        snprintf(page_str, sizeof(page_str), "S%d  %d left  ~%d%%%s",
+                 item.current_section + 1,
+                 pages_left,
+                 percent,
+                 item.bookmark_set ? " [B]" : "");
+      }
+      else if (reader && !reader->is_page_count_known())
+      {
+        // the section is still being laid out so we don't know how many pages it has yet
+        snprintf(page_str, sizeof(page_str), "S%d  %d/?%s",
+                 item.current_section + 1,
+                 item.current_page + 1,
+                 item.bookmark_set ? " [B]" : "");
+      }
+      else if (item.bookmark_set)
       {
         snprintf(page_str, sizeof(page_str), "S%d  %d/%d [B]",
                  item.current_section + 1,
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <unity.h>
+#include <chrono>
+#include <EpubList/Epub.h>
+
+// helpers for the benchmarks that run over each of the fixture books and
+// report what they found with TEST_MESSAGE
+
+typedef std::chrono::steady_clock::time_point benchmark_time_t;
+
+inline benchmark_time_t benchmark_now()
+{
+  return std::chrono::steady_clock::now();
+}
+
+// seconds since start
+inline double benchmark_seconds(benchmark_time_t start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// load each of the fixture books and run the benchmark on it
+inline void benchmark_fixtures(void (*benchmark)(Epub *epub, const char *path))
+{
+  static const char *FIXTURES[] = {
+      "fixtures/relative_paths.epub",
+      "fixtures/oebps.epub",
+      "fixtures/no_oebps.epub",
+  };
+  for (const char *path : FIXTURES)
+  {
+    Epub *epub = new Epub(path);
+    TEST_ASSERT_TRUE_MESSAGE(epub->load(), "Epub load failed");
+    benchmark(epub, path);
+    delete epub;
+  }
+}
@@ -3,9 +3,13 @@
 #include <RubbishHtmlParser/blocks/Block.h>
 #include <RubbishHtmlParser/RubbishHtmlParser.h>
 #include <RubbishHtmlParser/blocks/ImageBlock.h>
+#include <RubbishHtmlParser/PageCache.h>
+#include <BookCache/BookCache.h>
 #include <Renderer/Renderer.h>
 #include <EpubList/Epub.h>
 #include <iterator>
+#include <string>
+#include <vector>
 
 class TestRenderer : public Renderer
 {
@@ -54,7 +58,7 @@ void test_parser(void)
       "</body>"
       "</html>";
   {
-    RubbishHtmlParser parser(html, strlen(html), "");
+    RubbishHtmlParser parser(html, strlen(html), "", false);
     parser.layout(new TestRenderer(), new Epub("test"));
     TEST_ASSERT_EQUAL(7, parser.get_blocks().size());
     auto iterator = parser.get_blocks().begin();
@@ -64,7 +68,7 @@ void test_parser(void)
     TEST_ASSERT_EQUAL_STRING("test.png", reinterpret_cast<ImageBlock *>(img_block)->m_src.c_str());
   }
   {
-    RubbishHtmlParser parser(html, strlen(html), "HTML/");
+    RubbishHtmlParser parser(html, strlen(html), "HTML/", false);
     parser.layout(new TestRenderer(), new Epub("test"));
     TEST_ASSERT_EQUAL(7, parser.get_blocks().size());
     auto iterator = parser.get_blocks().begin();
@@ -74,3 +78,359 @@ void test_parser(void)
     TEST_ASSERT_EQUAL_STRING("HTML/test.png", reinterpret_cast<ImageBlock *>(img_block)->m_src.c_str());
   }
 }
+
+void test_parser_images(void)
+{
+  const char *html =
+      "<html><body>"
+      "<img src=\"a.png\" />"
+      "<p>before<img src=\"b.png\" />after</p>"
+      "<img src=\"c.png\" /><img src=\"d.png\" />"
+      "<p>end</p>"
+      "</body></html>";
+  RubbishHtmlParser parser(html, strlen(html), "", false);
+  // the images go in order with no empty text blocks between them
+  const BlockType expected[] = {BlockType::IMAGE_BLOCK, BlockType::TEXT_BLOCK, BlockType::IMAGE_BLOCK, BlockType::TEXT_BLOCK,
+                                BlockType::IMAGE_BLOCK, BlockType::IMAGE_BLOCK, BlockType::TEXT_BLOCK};
+  const char *sources[] = {"a.png", "b.png", "c.png", "d.png"};
+  const std::vector<Block *> &blocks = parser.get_blocks();
+  TEST_ASSERT_EQUAL(7, blocks.size());
+  int image = 0;
+  for (size_t i = 0; i < blocks.size(); i++)
+  {
+    TEST_ASSERT_EQUAL(expected[i], blocks[i]->getType());
+    if (blocks[i]->getType() == BlockType::IMAGE_BLOCK)
+    {
+      TEST_ASSERT_EQUAL_STRING(sources[image++], reinterpret_cast<ImageBlock *>(blocks[i])->m_src.c_str());
+    }
+  }
+  TEST_ASSERT_EQUAL_STRING("before", reinterpret_cast<TextBlock *>(blocks[1])->get_word(0));
+  TEST_ASSERT_EQUAL_STRING("after", reinterpret_cast<TextBlock *>(blocks[3])->get_word(0));
+  TEST_ASSERT_EQUAL_STRING("end", reinterpret_cast<TextBlock *>(blocks[6])->get_word(0));
+}
+
+void test_parser_section_text(void)
+{
+  // enough text that the section buffer has to grow a few times
+  std::string html = "<html><body><p>caf&eacute; &amp; cr&#232;me</p>";
+  for (int i = 0; i < 500; i++)
+  {
+    html += "<p>word" + std::to_string(i) + " <b>bold</b></p>";
+  }
+  html += "</body></html>";
+  RubbishHtmlParser parser(html.c_str(), html.size(), "", false);
+  TextBlock *first = reinterpret_cast<TextBlock *>(parser.get_blocks().front());
+  TEST_ASSERT_EQUAL(3, first->get_word_count());
+  TEST_ASSERT_EQUAL_STRING("café", first->get_word(0));
+  TEST_ASSERT_EQUAL_STRING("&", first->get_word(1));
+  TEST_ASSERT_EQUAL_STRING("crème", first->get_word(2));
+  TextBlock *last = reinterpret_cast<TextBlock *>(parser.get_blocks().back());
+  TEST_ASSERT_EQUAL(2, last->get_word_count());
+  TEST_ASSERT_EQUAL_STRING("word499", last->get_word(0));
+  TEST_ASSERT_EQUAL_STRING("bold", last->get_word(1));
+}
+
+// counts the words drawn so we can check every line ends up on a page
+class CountingRenderer : public TestRenderer
+{
+public:
+  int words_drawn = 0;
+  int max_y = 0;
+  virtual void draw_text(int x, int y, const char *text, bool bold = false, bool italic = false)
+  {
+    words_drawn++;
+    max_y = y > max_y ? y : max_y;
+  }
+};
+
+void test_parser_pages(void)
+{
+  std::string html = "<html><body>";
+  int words = 0;
+  for (int i = 0; i < 300; i++)
+  {
+    html += "<p>paragraph " + std::to_string(i) + " has a few words that need to be wrapped onto more than one line</p>";
+    words += 16;
+  }
+  html += "</body></html>";
+  RubbishHtmlParser parser(html.c_str(), html.size(), "", false);
+  TEST_ASSERT_EQUAL(300, parser.get_blocks().size());
+  CountingRenderer renderer;
+  Epub epub("test");
+  parser.layout(&renderer, &epub);
+  TEST_ASSERT_TRUE(parser.get_page_count() > 1);
+  for (int page = 0; page < parser.get_page_count(); page++)
+  {
+    parser.render_page(page, &renderer, &epub);
+  }
+  TEST_ASSERT_EQUAL(words, renderer.words_drawn);
+  TEST_ASSERT_TRUE(renderer.max_y < renderer.get_page_height());
+  // past the end just shows a message
+  parser.render_page(parser.get_page_count(), &renderer, &epub);
+  TEST_ASSERT_EQUAL(words, renderer.words_drawn);
+}
+
+void test_parser_incremental_layout(void)
+{
+  std::string html = "<html><body>";
+  for (int i = 0; i < 1000; i++)
+  {
+    html += "<p>paragraph " + std::to_string(i) + " has a few words that need to be wrapped onto more than one line</p>";
+  }
+  html += "</body></html>";
+  CountingRenderer renderer;
+  Epub epub("test");
+  RubbishHtmlParser full(html.c_str(), html.size(), "", false);
+  full.layout(&renderer, &epub);
+  TEST_ASSERT_TRUE(full.is_layout_complete());
+
+  // just enough for the first page and the one after it
+  RubbishHtmlParser incremental(html.c_str(), html.size(), "", false);
+  TEST_ASSERT_FALSE(incremental.layout_pages(&renderer, &epub, 2));
+  TEST_ASSERT_FALSE(incremental.is_layout_complete());
+  TEST_ASSERT_EQUAL(3, incremental.get_page_count());
+  // then the rest a page at a time
+  int steps = 0;
+  while (!incremental.layout_pages(&renderer, &epub, incremental.get_page_count()))
+  {
+    steps++;
+  }
+  TEST_ASSERT_TRUE(steps > 1);
+  TEST_ASSERT_EQUAL(full.get_page_count(), incremental.get_page_count());
+  for (int page = 0; page < full.get_page_count(); page++)
+  {
+    CountingRenderer full_page;
+    CountingRenderer incremental_page;
+    full.render_page(page, &full_page, &epub);
+    incremental.render_page(page, &incremental_page, &epub);
+    TEST_ASSERT_EQUAL(full_page.words_drawn, incremental_page.words_drawn);
+    TEST_ASSERT_EQUAL(full_page.max_y, incremental_page.max_y);
+  }
+  // laying out again starts over
+  incremental.start_layout();
+  TEST_ASSERT_FALSE(incremental.layout_pages(&renderer, &epub, 1));
+  incremental.layout(&renderer, &epub);
+  TEST_ASSERT_EQUAL(full.get_page_count(), incremental.get_page_count());
+}
+
+void test_parser_page_table(void)
+{
+  std::string html = "<html><body>";
+  for (int i = 0; i < 1000; i++)
+  {
+    html += "<p>paragraph " + std::to_string(i) + " has a few words that need to be wrapped onto more than one line</p>";
+  }
+  html += "</body></html>";
+  CountingRenderer renderer;
+  Epub epub("test");
+  RubbishHtmlParser full(html.c_str(), html.size(), "", false);
+  full.layout(&renderer, &epub);
+  std::vector<PagePosition> pages;
+  TEST_ASSERT_TRUE(full.get_page_table(pages));
+  TEST_ASSERT_EQUAL(full.get_page_count(), pages.size());
+
+  // the page table survives a trip through the cache
+  const char *path = "fixtures/oebps.epub";
+  BookCache cache(path);
+  cache.remove("PGS");
+  PageCache page_cache(cache);
+  uint32_t key = PageCache::layout_key(&renderer);
+  renderer.set_margin_left(10);
+  TEST_ASSERT_TRUE(key != PageCache::layout_key(&renderer));
+  renderer.set_margin_left(0);
+  std::vector<PagePosition> other(3, PagePosition{0, 0, 0});
+  TEST_ASSERT_TRUE(page_cache.save(1, key, other));
+  TEST_ASSERT_TRUE(page_cache.save(2, key, pages));
+  std::vector<PagePosition> loaded;
+  TEST_ASSERT_FALSE(page_cache.load(2, key + 1, loaded));
+  TEST_ASSERT_TRUE(page_cache.load(2, key, loaded));
+  TEST_ASSERT_EQUAL(pages.size(), loaded.size());
+  TEST_ASSERT_EQUAL_MEMORY(pages.data(), loaded.data(), pages.size() * sizeof(PagePosition));
+  TEST_ASSERT_TRUE(page_cache.load(1, key, loaded));
+  TEST_ASSERT_EQUAL(3, loaded.size());
+  // a table claiming more pages than the file could hold is damage, not a
+  // size to multiply out
+  File file = SD.open(cache.get_path("PGS").c_str(), FILE_READ);
+  TEST_ASSERT_TRUE(file);
+  std::vector<uint8_t> sidecar(file.size());
+  TEST_ASSERT_EQUAL(sidecar.size(), file.read(sidecar.data(), sidecar.size()));
+  file.close();
+  uint32_t record[3] = {key, 3, 0x40000000};
+  sidecar.insert(sidecar.end(), (uint8_t *)record, (uint8_t *)record + sizeof(record));
+  file = SD.open(cache.get_path("PGS").c_str(), FILE_WRITE);
+  TEST_ASSERT_TRUE(file);
+  file.write(sidecar.data(), sidecar.size());
+  file.close();
+  TEST_ASSERT_FALSE(page_cache.load(3, key, loaded));
+  TEST_ASSERT_FALSE(page_cache.load(1, key, loaded));
+  TEST_ASSERT_TRUE(page_cache.save(2, key, pages));
+
+  // with the page table we can start at any page
+  RubbishHtmlParser cached(html.c_str(), html.size(), "", false);
+  TEST_ASSERT_TRUE(cached.set_page_table(pages));
+  TEST_ASSERT_TRUE(cached.is_page_count_known());
+  TEST_ASSERT_EQUAL(full.get_page_count(), cached.get_page_count());
+  int last = full.get_page_count() - 1;
+  for (int page = last; page >= 0; page -= 3)
+  {
+    cached.seek_layout(page);
+    cached.layout_pages(&renderer, &epub, page + 1);
+    if (page > 0)
+    {
+      // nothing before the page has been laid out
+      TEST_ASSERT_EQUAL(page, cached.get_pages_laid_out() - (cached.is_layout_complete() ? 1 : 2));
+    }
+    CountingRenderer full_page;
+    CountingRenderer cached_page;
+    full.render_page(page, &full_page, &epub);
+    cached.render_page(page, &cached_page, &epub);
+    TEST_ASSERT_EQUAL(full_page.words_drawn, cached_page.words_drawn);
+    TEST_ASSERT_EQUAL(full_page.max_y, cached_page.max_y);
+  }
+  // a table that can't belong to the section is ignored
+  RubbishHtmlParser small("<p>hello</p>", 12, "", false);
+  TEST_ASSERT_FALSE(small.set_page_table(pages));
+  cache.remove("PGS");
+}
+
+// a renderer with settings that can be changed like the reader menu does
+class SettingsRenderer : public CountingRenderer
+{
+public:
+  int measured = 0;
+  int font_size = 20;
+  std::vector<int> word_x;
+  virtual int get_text_width(const char *text, bool bold = false, bool italic = false)
+  {
+    measured++;
+    return strlen(text) * font_size / 2;
+  }
+  virtual void draw_text(int x, int y, const char *text, bool bold = false, bool italic = false)
+  {
+    CountingRenderer::draw_text(x, y, text, bold, italic);
+    word_x.push_back(x);
+  }
+  virtual int get_font_pixel_size() { return font_size; }
+  virtual int get_page_width() { return 540 - margin_left - margin_right; }
+  virtual int get_page_height() { return 900 - margin_top - margin_bottom; }
+  virtual int get_space_width() { return font_size / 3; }
+  virtual int get_line_height() { return apply_line_spacing(font_size); }
+};
+
+// where every word on every page is drawn
+static std::vector<int> render_word_x(RubbishHtmlParser &parser, SettingsRenderer &renderer, Epub &epub)
+{
+  renderer.word_x.clear();
+  for (int page = 0; page < parser.get_page_count(); page++)
+  {
+    parser.render_page(page, &renderer, &epub);
+  }
+  return renderer.word_x;
+}
+
+void test_parser_relayout_phases(void)
+{
+  std::string html = "<html><body>";
+  for (int i = 0; i < 300; i++)
+  {
+    html += "<p>paragraph " + std::to_string(i) + " has a few words that need to be wrapped onto more than one line</p>";
+    if (i % 50 == 0)
+    {
+      html += "<h2>a heading that stays in the middle</h2>";
+    }
+    if (i % 7 == 0)
+    {
+      // so that not every page starts with a new paragraph
+      html += "<p>a longer paragraph that runs on for a while, taking up a good few lines of the page and pushing the ones after it along, "
+              "so that some pages start part way through a paragraph rather than at the start of one</p>";
+    }
+  }
+  html += "</body></html>";
+  SettingsRenderer renderer;
+  // count every measurement
+  renderer.get_word_width_cache().set_enabled(false);
+  Epub epub("test");
+  RubbishHtmlParser parser(html.c_str(), html.size(), "", false);
+  parser.layout(&renderer, &epub);
+  int pages = parser.get_page_count();
+  TEST_ASSERT_TRUE(renderer.measured > 0);
+  std::vector<int> left_x = render_word_x(parser, renderer, epub);
+
+  // justifying only moves the words along their lines
+  renderer.measured = 0;
+  parser.set_justified(true);
+  TEST_ASSERT_EQUAL(0, renderer.measured);
+  TEST_ASSERT_EQUAL(pages, parser.get_page_count());
+  std::vector<int> justified_x = render_word_x(parser, renderer, epub);
+  TEST_ASSERT_EQUAL(left_x.size(), justified_x.size());
+  TEST_ASSERT_TRUE(left_x != justified_x);
+  RubbishHtmlParser justified(html.c_str(), html.size(), "", true);
+  justified.layout(&renderer, &epub);
+  TEST_ASSERT_TRUE(justified_x == render_word_x(justified, renderer, epub));
+  parser.set_justified(false);
+  TEST_ASSERT_TRUE(left_x == render_word_x(parser, renderer, epub));
+
+  // line spacing changes the pages but not the lines
+  PagePosition position;
+  TEST_ASSERT_TRUE(parser.get_page_position(pages / 2, position));
+  renderer.measured = 0;
+  renderer.set_line_spacing_percent(140);
+  parser.start_layout();
+  int page = parser.find_page(&renderer, &epub, position);
+  TEST_ASSERT_FALSE(parser.is_layout_complete());
+  parser.layout(&renderer, &epub);
+  TEST_ASSERT_EQUAL(0, renderer.measured);
+  TEST_ASSERT_TRUE(parser.get_page_count() > pages);
+  TEST_ASSERT_TRUE(left_x == render_word_x(parser, renderer, epub));
+  // the text that was at the top of the page is still on the page we found
+  PagePosition start;
+  PagePosition end;
+  TEST_ASSERT_TRUE(parser.get_page_position(page, start) && parser.get_page_position(page + 1, end));
+  TEST_ASSERT_TRUE(start.block_index < position.block_index ||
+                   (start.block_index == position.block_index && start.line_index <= position.line_index));
+  TEST_ASSERT_TRUE(position.block_index < end.block_index ||
+                   (position.block_index == end.block_index && position.line_index < end.line_index));
+
+  // wider margins break the lines again without measuring the words
+  // from a page that starts part way through a paragraph
+  PagePosition line_position = {0, 0, 0};
+  for (page = pages / 2; page < parser.get_page_count() && line_position.line_index == 0; page++)
+  {
+    TEST_ASSERT_TRUE(parser.get_page_position(page, line_position));
+  }
+  page--;
+  TEST_ASSERT_TRUE(line_position.line_index > 0);
+  TextPosition text_position;
+  TEST_ASSERT_TRUE(parser.get_page_text_position(page, text_position));
+  TEST_ASSERT_TRUE(text_position.word_index > 0);
+  renderer.set_margin_left(60);
+  renderer.set_margin_right(60);
+  renderer.measured = 0;
+  parser.start_layout();
+  page = parser.find_page(&renderer, &epub, text_position);
+  parser.layout(&renderer, &epub);
+  TEST_ASSERT_EQUAL(0, renderer.measured);
+  RubbishHtmlParser narrow(html.c_str(), html.size(), "", false);
+  narrow.layout(&renderer, &epub);
+  TEST_ASSERT_EQUAL(narrow.get_page_count(), parser.get_page_count());
+  TEST_ASSERT_TRUE(render_word_x(narrow, renderer, epub) == render_word_x(parser, renderer, epub));
+  // the word that was at the top of the page is on the page we found, even
+  // though the lines are different
+  TextPosition text_start;
+  TextPosition text_end;
+  TEST_ASSERT_TRUE(parser.get_page_text_position(page, text_start) && parser.get_page_text_position(page + 1, text_end));
+  TEST_ASSERT_TRUE(text_start.block_index < text_position.block_index ||
+                   (text_start.block_index == text_position.block_index && text_start.word_index <= text_position.word_index));
+  TEST_ASSERT_TRUE(text_position.block_index < text_end.block_index ||
+                   (text_position.block_index == text_end.block_index && text_position.word_index < text_end.word_index));
+
+  // a new font size means measuring again
+  renderer.font_size = 24;
+  renderer.measured = 0;
+  parser.layout(&renderer, &epub);
+  TEST_ASSERT_TRUE(renderer.measured > 0);
+  RubbishHtmlParser bigger(html.c_str(), html.size(), "", false);
+  bigger.layout(&renderer, &epub);
+  TEST_ASSERT_EQUAL(bigger.get_page_count(), parser.get_page_count());
+  TEST_ASSERT_TRUE(render_word_x(bigger, renderer, epub) == render_word_x(parser, renderer, epub));
+}
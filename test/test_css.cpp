@@ -0,0 +1,171 @@
+#include <unity.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <EpubList/Epub.h>
+#include <ZipFile/ZipFile.h>
+#include <BookCache/BookCache.h>
+#include <Css/CssParser.h>
+#include <Css/CssStyleTable.h>
+#include <RubbishHtmlParser/RubbishHtmlParser.h>
+
+static CssStyle parse_style(const char *text)
+{
+  CssStyle style;
+  parse_css_declarations(text, strlen(text), style);
+  return style;
+}
+
+void test_css_declarations(void)
+{
+  CssStyle style = parse_style(" TEXT-ALIGN : Center ; font-weight:700;font-style: italic !important");
+  TEST_ASSERT_EQUAL(CSS_TEXT_ALIGN | CSS_FONT_WEIGHT | CSS_FONT_STYLE, style.set);
+  TEST_ASSERT_EQUAL(CSS_ALIGN_CENTER, style.text_align);
+  TEST_ASSERT_TRUE(style.bold);
+  TEST_ASSERT_TRUE(style.italic);
+
+  style = parse_style("margin: 0 0 8pt; text-indent: 1.5em; display: none");
+  TEST_ASSERT_EQUAL(0, style.margin_top);
+  TEST_ASSERT_EQUAL(0, style.margin_right);
+  TEST_ASSERT_EQUAL(66, style.margin_bottom);
+  TEST_ASSERT_EQUAL(0, style.margin_left);
+  TEST_ASSERT_EQUAL(150, style.text_indent);
+  TEST_ASSERT_TRUE(style.display_none);
+
+  style = parse_style("margin: 1em 2em; margin-left: 16px");
+  TEST_ASSERT_EQUAL(100, style.margin_top);
+  TEST_ASSERT_EQUAL(200, style.margin_right);
+  TEST_ASSERT_EQUAL(100, style.margin_bottom);
+  TEST_ASSERT_EQUAL(100, style.margin_left);
+
+  // things we can't handle are left unset
+  style = parse_style("text-align: inherit; text-indent: 5%; margin: 1em calc(2px); font-family: \"a;b\"; color: red");
+  TEST_ASSERT_EQUAL(0, style.set);
+}
+
+static const char *STYLESHEET =
+    "@charset \"utf-8\";\n"
+    "/* p { text-align: right } */\n"
+    "p { text-align: justify; text-indent: 1em }\n"
+    "H1, .center, p.title { text-align: center }\n"
+    ".hidden { display: none }\n"
+    "@media print { p { display: none } .center { text-align: left } }\n"
+    "div p, p > span, #id, a:hover, .a.b, * { font-weight: bold }\n"
+    ".bold { font-weight: bold; }\n"
+    ".center { font-style: italic }\n"
+    "@font-face { font-family: x; src: url(\"x}.ttf\") }\n"
+    "p.title { text-indent: 0 }\n";
+
+void test_css_style_table(void)
+{
+  CssStyleTable table;
+  std::string css = STYLESHEET;
+  parse_css_stylesheet(&css[0], css.size(), table);
+  TEST_ASSERT_EQUAL(6, table.size());
+  const CssStyle *p = table.lookup("p", nullptr);
+  TEST_ASSERT_NOT_NULL(p);
+  TEST_ASSERT_EQUAL(CSS_TEXT_ALIGN | CSS_TEXT_INDENT, p->set);
+  TEST_ASSERT_EQUAL(CSS_ALIGN_JUSTIFY, p->text_align);
+  // element names are lower cased, class names aren't
+  TEST_ASSERT_NOT_NULL(table.lookup("h1", nullptr));
+  TEST_ASSERT_NOT_NULL(table.lookup("H1", nullptr));
+  TEST_ASSERT_NULL(table.lookup(nullptr, "CENTER"));
+  // later rules for the same selector are merged in
+  const CssStyle *center = table.lookup(nullptr, "center");
+  TEST_ASSERT_NOT_NULL(center);
+  TEST_ASSERT_EQUAL(CSS_TEXT_ALIGN | CSS_FONT_STYLE, center->set);
+  TEST_ASSERT_EQUAL(CSS_ALIGN_CENTER, center->text_align);
+  TEST_ASSERT_NULL(table.lookup("div", nullptr));
+  TEST_ASSERT_NULL(table.lookup("span", nullptr));
+
+  // element, then class, then element.class
+  CssStyle style;
+  table.resolve("p", " title  bold ", style);
+  TEST_ASSERT_EQUAL(CSS_ALIGN_CENTER, style.text_align);
+  TEST_ASSERT_EQUAL(0, style.text_indent);
+  TEST_ASSERT_TRUE(style.bold);
+  TEST_ASSERT_FALSE(style.italic);
+
+  // the table survives a trip through the metadata cache
+  std::vector<uint8_t> data;
+  table.serialize(data);
+  CssStyleTable loaded;
+  TEST_ASSERT_TRUE(loaded.deserialize(data.data(), data.size()));
+  TEST_ASSERT_EQUAL(table.size(), loaded.size());
+  CssStyle loaded_style;
+  loaded.resolve("p", "title bold", loaded_style);
+  TEST_ASSERT_EQUAL(style.set, loaded_style.set);
+  TEST_ASSERT_EQUAL(style.text_align, loaded_style.text_align);
+  TEST_ASSERT_EQUAL(style.bold, loaded_style.bold);
+  TEST_ASSERT_EQUAL(style.italic, loaded_style.italic);
+  TEST_ASSERT_EQUAL(style.display_none, loaded_style.display_none);
+  TEST_ASSERT_EQUAL(style.margin_top, loaded_style.margin_top);
+  TEST_ASSERT_EQUAL(style.margin_right, loaded_style.margin_right);
+  TEST_ASSERT_EQUAL(style.margin_bottom, loaded_style.margin_bottom);
+  TEST_ASSERT_EQUAL(style.margin_left, loaded_style.margin_left);
+  TEST_ASSERT_EQUAL(style.text_indent, loaded_style.text_indent);
+  // and comes out byte for byte the same
+  std::vector<uint8_t> again;
+  loaded.serialize(again);
+  TEST_ASSERT_EQUAL(data.size(), again.size());
+  TEST_ASSERT_EQUAL_MEMORY(data.data(), again.data(), data.size());
+  TEST_ASSERT_FALSE(loaded.deserialize(data.data(), data.size() - 1));
+  TEST_ASSERT_TRUE(loaded.empty());
+}
+
+void test_parser_applies_stylesheet(void)
+{
+  CssStyleTable table;
+  std::string css = STYLESHEET;
+  parse_css_stylesheet(&css[0], css.size(), table);
+  const char *html =
+      "<html><body>"
+      "<p>Justified</p>"
+      "<p class=\"hidden\">Hidden <b>text</b></p>"
+      "<blockquote class=\"center\"><div>Inherited</div><h2 style=\"text-align: right\">Header</h2></blockquote>"
+      "<p><span class=\"bold\">Bold</span> normal <i class=\"x\">italic</i></p>"
+      "</body></html>";
+  RubbishHtmlParser parser(html, strlen(html), "", true, &table);
+  std::vector<TextBlock *> blocks;
+  for (auto block : parser.get_blocks())
+  {
+    blocks.push_back(static_cast<TextBlock *>(block));
+  }
+  TEST_ASSERT_EQUAL(4, blocks.size());
+  TEST_ASSERT_EQUAL(JUSTIFIED, blocks[0]->get_style());
+  TEST_ASSERT_EQUAL_STRING("Justified", blocks[0]->get_word(0));
+  // the hidden paragraph is dropped and the div's alignment is inherited
+  TEST_ASSERT_EQUAL(CENTER_ALIGN, blocks[1]->get_style());
+  TEST_ASSERT_EQUAL_STRING("Inherited", blocks[1]->get_word(0));
+  TEST_ASSERT_EQUAL(RIGHT_ALIGN, blocks[2]->get_style());
+  TEST_ASSERT_EQUAL(3, blocks[3]->get_word_count());
+  TEST_ASSERT_EQUAL(BOLD_SPAN, blocks[3]->get_word_style(0));
+  TEST_ASSERT_EQUAL(0, blocks[3]->get_word_style(1));
+  TEST_ASSERT_EQUAL(ITALIC_SPAN, blocks[3]->get_word_style(2));
+  // without the stylesheet the reader setting is used
+  RubbishHtmlParser plain(html, strlen(html), "", false);
+  TEST_ASSERT_EQUAL(LEFT_ALIGN, static_cast<TextBlock *>(plain.get_blocks().front())->get_style());
+}
+
+void test_epub_stylesheets_cached(void)
+{
+  const char *path = "fixtures/no_oebps.epub";
+  BookCache cache(path);
+  cache.remove("MET");
+  Epub *parsed = new Epub(path);
+  TEST_ASSERT_TRUE_MESSAGE(parsed->load(), "Epub load failed");
+  const CssStyle *block = parsed->get_styles().lookup(nullptr, "block_3");
+  TEST_ASSERT_NOT_NULL(block);
+  TEST_ASSERT_TRUE(block->bold);
+  TEST_ASSERT_EQUAL(CSS_ALIGN_CENTER, block->text_align);
+  // the styles come back from the metadata sidecar
+  Epub *cached = new Epub(path);
+  TEST_ASSERT_TRUE_MESSAGE(cached->load(), "Cached epub load failed");
+  TEST_ASSERT_FALSE(cached->get_zip().is_open());
+  TEST_ASSERT_EQUAL(parsed->get_styles().size(), cached->get_styles().size());
+  block = cached->get_styles().lookup(nullptr, "block_3");
+  TEST_ASSERT_NOT_NULL(block);
+  TEST_ASSERT_TRUE(block->bold);
+  delete parsed;
+  delete cached;
+}
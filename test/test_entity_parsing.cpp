@@ -1,4 +1,9 @@
 #include <unity.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <chrono>
 #include <RubbishHtmlParser/htmlEntities.h>
 
 void test_html_entity_replacement(void)
@@ -12,3 +17,52 @@ void test_html_entity_replacement(void)
   TEST_ASSERT_EQUAL_STRING("This is a nonbreaking space and numeric space", replace_html_entities("This is a nonbreaking&nbsp;space and numeric&#xA0;space").c_str());
   TEST_ASSERT_EQUAL_STRING("frasl ⁄ test", replace_html_entities("frasl &frasl; test").c_str());
 }
+
+void test_html_entity_replacement_in_place(void)
+{
+  char text[] = "caf&eacute; &amp; cr&#232;me &bogus; end&amp";
+  size_t length = replace_html_entities(text, strlen(text));
+  text[length] = '\0';
+  TEST_ASSERT_EQUAL_STRING("café & crème &bogus; end&amp", text);
+}
+
+// the sort of thing found in entities_ww2.epub - mostly plain text with the
+// odd named or numeric entity
+static const char *BENCHMARK_TEXT =
+    "&ldquo;We shall fight on the beaches,&rdquo; he said &mdash; and the crowd "
+    "cheered. The caf&eacute; on the Rue de la Paix served cr&egrave;me br&ucirc;l&eacute;e "
+    "for 5&nbsp;francs &amp; a glass of wine for 3&frac12;. Temperatures fell to &minus;12&deg;C "
+    "that winter&hellip; &copy; 1944 &#8212; page &#x37;&#55; of &lt;unknown&gt; &bogus; ";
+
+void test_html_entity_benchmark(void)
+{
+  const int repeats = 2000;
+  std::string text;
+  for (int i = 0; i < repeats; i++)
+  {
+    text += BENCHMARK_TEXT;
+  }
+  char *buffer = static_cast<char *>(malloc(text.size()));
+  const int passes = 20;
+  size_t decoded_length = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; pass++)
+  {
+    memcpy(buffer, text.data(), text.size());
+    decoded_length = replace_html_entities(buffer, text.size());
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  // the decoded text should match a single copy decoded on its own
+  std::string single = replace_html_entities(std::string(BENCHMARK_TEXT));
+  TEST_ASSERT_EQUAL(single.size() * repeats, decoded_length);
+  TEST_ASSERT_EQUAL_MEMORY(single.data(), buffer, single.size());
+  TEST_ASSERT_EQUAL_STRING("“We shall fight on the beaches,” he said — and the crowd "
+                           "cheered. The café on the Rue de la Paix served crème brûlée "
+                           "for 5 francs & a glass of wine for 3½. Temperatures fell to −12°C "
+                           "that winter… © 1944 — page 77 of <unknown> &bogus; ",
+                           single.c_str());
+  free(buffer);
+  char message[100];
+  snprintf(message, sizeof(message), "entity decoding: %.1f MB/s", text.size() * passes / seconds / 1e6);
+  TEST_MESSAGE(message);
+}
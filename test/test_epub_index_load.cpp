@@ -18,4 +18,6 @@ void test_epub_toc_load(void)
   TEST_ASSERT_EQUAL_STRING("HENRY JEKYLL\xE2\x80\x99S FULL STATEMENT OF THE CASE", epub->get_toc_item(11).title.c_str());
   TEST_ASSERT_EQUAL_STRING("OEBPS/@public@vhost@g@gutenberg@html@files@43@43-h@43-h-10.htm.html", epub->get_toc_item(11).href.c_str());
   TEST_ASSERT_EQUAL_STRING("pgepubid00011", epub->get_toc_item(11).anchor.c_str());
+  TEST_ASSERT_EQUAL_STRING("", epub->get_toc_item(12).href.c_str());
+  TEST_ASSERT_EQUAL_STRING("", epub->get_toc_item(-1).href.c_str());
 }
@@ -1,5 +1,11 @@
 #include <unity.h>
 #include <EpubList/Epub.h>
+#include <ZipFile/ZipFile.h>
+#include <BookCache/BookCache.h>
+#include <EpubList/BookPages.h>
+#include <string.h>
+#include <stdio.h>
+#include <chrono>
 
 void test_epub_no_oebps_load(void)
 {
@@ -40,3 +46,225 @@ void test_epub_load(void)
   TEST_ASSERT_EQUAL_STRING("OEBPS/@public@vhost@g@gutenberg@html@files@43@43-h@images@cover.jpg", epub->get_cover_image_item().c_str());
   TEST_ASSERT_NOT_NULL(epub->get_item_contents(epub->get_cover_image_item()));
 }
+
+void test_epub_zip_session_reuse(void)
+{
+  Epub *epub = new Epub("fixtures/relative_paths.epub");
+  TEST_ASSERT_TRUE_MESSAGE(epub->load(), "Epub load failed");
+  for (int i = 0; i < epub->get_spine_items_count(); i++)
+  {
+    size_t size = 0;
+    uint8_t *contents = epub->get_item_contents(epub->get_spine_item(i), &size);
+    TEST_ASSERT_NOT_NULL_MESSAGE(contents, "No content for chapter");
+    TEST_ASSERT_EQUAL(size, epub->get_item_uncompressed_size(epub->get_spine_item(i)));
+    free(contents);
+  }
+  // the whole book should have been read from a single archive session
+  const ZipStats &stats = epub->get_zip().get_stats();
+  TEST_ASSERT_EQUAL(1, stats.archive_opens);
+  TEST_ASSERT_LESS_OR_EQUAL(1, stats.directory_scans);
+  delete epub;
+}
+
+void test_epub_metadata_cache_reused(void)
+{
+  const char *path = "fixtures/oebps.epub";
+  BookCache cache(path);
+  cache.remove("MET");
+  Epub *parsed = new Epub(path);
+  TEST_ASSERT_TRUE_MESSAGE(parsed->load(), "Epub load failed");
+  TEST_ASSERT_TRUE(parsed->get_zip().is_open());
+  // the second load should come from the sidecar without touching the archive
+  Epub *cached = new Epub(path);
+  TEST_ASSERT_TRUE_MESSAGE(cached->load(), "Cached epub load failed");
+  TEST_ASSERT_FALSE(cached->get_zip().is_open());
+  TEST_ASSERT_EQUAL(0, cached->get_zip().get_stats().archive_opens);
+  TEST_ASSERT_EQUAL_STRING(parsed->get_title().c_str(), cached->get_title().c_str());
+  TEST_ASSERT_EQUAL_STRING(parsed->get_cover_image_item().c_str(), cached->get_cover_image_item().c_str());
+  TEST_ASSERT_EQUAL_STRING(parsed->get_base_path().c_str(), cached->get_base_path().c_str());
+  TEST_ASSERT_EQUAL(parsed->get_spine_items_count(), cached->get_spine_items_count());
+  for (int i = 0; i < parsed->get_spine_items_count(); i++)
+  {
+    TEST_ASSERT_EQUAL_STRING(parsed->get_spine_item(i).c_str(), cached->get_spine_item(i).c_str());
+  }
+  TEST_ASSERT_EQUAL(parsed->get_toc_items_count(), cached->get_toc_items_count());
+  for (int i = 0; i < parsed->get_toc_items_count(); i++)
+  {
+    TEST_ASSERT_EQUAL_STRING(parsed->get_toc_item(i).title.c_str(), cached->get_toc_item(i).title.c_str());
+    TEST_ASSERT_EQUAL_STRING(parsed->get_toc_item(i).href.c_str(), cached->get_toc_item(i).href.c_str());
+    TEST_ASSERT_EQUAL_STRING(parsed->get_toc_item(i).anchor.c_str(), cached->get_toc_item(i).anchor.c_str());
+  }
+  delete cached;
+  // a damaged sidecar is ignored and the book parsed again
+  File file = SD.open(cache.get_path("MET").c_str(), FILE_WRITE);
+  TEST_ASSERT_TRUE(file);
+  uint8_t junk[64];
+  memset(junk, 0xA5, sizeof(junk));
+  file.write(junk, sizeof(junk));
+  file.close();
+  Epub *reparsed = new Epub(path);
+  TEST_ASSERT_TRUE_MESSAGE(reparsed->load(), "Epub reload failed");
+  TEST_ASSERT_TRUE(reparsed->get_zip().is_open());
+  TEST_ASSERT_EQUAL_STRING(parsed->get_title().c_str(), reparsed->get_title().c_str());
+  TEST_ASSERT_EQUAL(parsed->get_spine_items_count(), reparsed->get_spine_items_count());
+  delete reparsed;
+  delete parsed;
+}
+
+void test_epub_metadata_only_load(void)
+{
+  const char *paths[] = {"fixtures/oebps.epub", "fixtures/relative_paths.epub", "fixtures/no_oebps.epub"};
+  for (const char *path : paths)
+  {
+    BookCache cache(path);
+    cache.remove("MET");
+    Epub *scanned = new Epub(path);
+    TEST_ASSERT_TRUE_MESSAGE(scanned->load_metadata(), "Metadata load failed");
+    // nothing past the cover should have been parsed
+    TEST_ASSERT_EQUAL(0, scanned->get_spine_items_count());
+    TEST_ASSERT_EQUAL(0, scanned->get_toc_items_count());
+    Epub *full = new Epub(path);
+    TEST_ASSERT_TRUE_MESSAGE(full->load(), "Epub load failed");
+    TEST_ASSERT_EQUAL_STRING(full->get_title().c_str(), scanned->get_title().c_str());
+    TEST_ASSERT_EQUAL_STRING(full->get_cover_image_item().c_str(), scanned->get_cover_image_item().c_str());
+    TEST_ASSERT_TRUE(scanned->get_zip().get_stats().bytes_read <= full->get_zip().get_stats().bytes_read);
+    delete full;
+    delete scanned;
+  }
+}
+
+void test_epub_string_arena(void)
+{
+  const char *path = "fixtures/relative_paths.epub";
+  BookCache cache(path);
+  cache.remove("MET");
+  Epub *epub = new Epub(path);
+  auto start = std::chrono::steady_clock::now();
+  TEST_ASSERT_TRUE_MESSAGE(epub->load(), "Epub load failed");
+  auto end = std::chrono::steady_clock::now();
+  TEST_ASSERT_EQUAL(373, epub->get_spine_items_count());
+  TEST_ASSERT_TRUE(epub->get_toc_items_count() > 0);
+  // every toc entry should have been matched up with its spine item
+  for (int i = 0; i < epub->get_toc_items_count(); i++)
+  {
+    int spine_index = epub->get_spine_index_for_toc_index(i);
+    TEST_ASSERT_EQUAL_STRING(epub->get_toc_item(i).href.c_str(), epub->get_spine_item(spine_index).c_str());
+  }
+  char message[120];
+  snprintf(message, sizeof(message), "%s: parsed in %.2f ms, %u bytes of spine and toc strings",
+           path,
+           std::chrono::duration<double, std::milli>(end - start).count(),
+           (unsigned)epub->get_string_bytes());
+  TEST_MESSAGE(message);
+  delete epub;
+}
+
+void test_book_pages(void)
+{
+  BookCache cache("fixtures/oebps.epub");
+  cache.remove("PGC");
+  BookPages pages(cache, 4);
+  pages.set_layout_key(1234);
+  TEST_ASSERT_EQUAL(0, pages.get_next_unknown_section());
+  TEST_ASSERT_EQUAL(-1, pages.get_page_number(0, 0));
+  pages.set_section_pages(0, 3);
+  pages.set_section_pages(2, 0);
+  pages.set_section_pages(3, 5);
+  TEST_ASSERT_FALSE(pages.is_complete());
+  TEST_ASSERT_EQUAL(1, pages.get_next_unknown_section());
+  TEST_ASSERT_EQUAL(-1, pages.get_total_pages());
+
+  // the counts come back from the sidecar for the same settings
+  BookPages loaded(cache, 4);
+  loaded.set_layout_key(1234);
+  TEST_ASSERT_EQUAL(3, loaded.get_section_pages(0));
+  TEST_ASSERT_EQUAL(-1, loaded.get_section_pages(1));
+  TEST_ASSERT_EQUAL(0, loaded.get_section_pages(2));
+  loaded.set_section_pages(1, 2);
+  TEST_ASSERT_TRUE(loaded.is_complete());
+  TEST_ASSERT_EQUAL(-1, loaded.get_next_unknown_section());
+  TEST_ASSERT_EQUAL(10, loaded.get_total_pages());
+  TEST_ASSERT_EQUAL(0, loaded.get_page_number(0, 0));
+  TEST_ASSERT_EQUAL(4, loaded.get_page_number(1, 1));
+  TEST_ASSERT_EQUAL(9, loaded.get_page_number(3, 4));
+  int section = -1;
+  int page = -1;
+  TEST_ASSERT_TRUE(loaded.find_page(4, section, page));
+  TEST_ASSERT_EQUAL(1, section);
+  TEST_ASSERT_EQUAL(1, page);
+  // the empty section is skipped over
+  TEST_ASSERT_TRUE(loaded.find_page(5, section, page));
+  TEST_ASSERT_EQUAL(3, section);
+  TEST_ASSERT_EQUAL(0, page);
+  TEST_ASSERT_FALSE(loaded.find_page(10, section, page));
+
+  // different settings mean different page counts
+  loaded.set_layout_key(5678);
+  TEST_ASSERT_FALSE(loaded.is_complete());
+  TEST_ASSERT_EQUAL(-1, loaded.get_section_pages(0));
+  // and a book with a different number of sections ignores the sidecar
+  BookPages other(cache, 5);
+  other.set_layout_key(5678);
+  TEST_ASSERT_EQUAL(0, other.get_next_unknown_section());
+  cache.remove("PGC");
+}
+
+void test_book_pages_estimate(void)
+{
+  BookCache cache("fixtures/oebps.epub");
+  cache.remove("PGC");
+  BookPages pages(cache, 4);
+  int page_number = -1;
+  int total_pages = -1;
+  TEST_ASSERT_FALSE(pages.estimate_position(0, 0, page_number, total_pages));
+  pages.set_section_size(0, 1000);
+  pages.set_section_size(1, 20000);
+  pages.set_section_size(2, 10000);
+  pages.set_section_size(3, 40000);
+  // nothing counted yet so it's a guess from the sizes
+  TEST_ASSERT_EQUAL(1, pages.estimate_section_pages(0));
+  TEST_ASSERT_EQUAL(8, pages.estimate_section_pages(1));
+  TEST_ASSERT_TRUE(pages.estimate_position(2, 1, page_number, total_pages));
+  TEST_ASSERT_EQUAL(10, page_number);
+  TEST_ASSERT_EQUAL(29, total_pages);
+  // the sections we've laid out tell us how much fits on a page
+  pages.set_layout_key(1234);
+  pages.set_section_pages(1, 10);
+  TEST_ASSERT_EQUAL(2000, pages.get_bytes_per_page());
+  TEST_ASSERT_EQUAL(5, pages.estimate_section_pages(2));
+  TEST_ASSERT_TRUE(pages.estimate_position(3, 0, page_number, total_pages));
+  TEST_ASSERT_EQUAL(16, page_number);
+  TEST_ASSERT_EQUAL(36, total_pages);
+  // we're never past the end of a section we've guessed too small
+  TEST_ASSERT_TRUE(pages.estimate_position(2, 7, page_number, total_pages));
+  TEST_ASSERT_EQUAL(18, page_number);
+  TEST_ASSERT_EQUAL(39, total_pages);
+  // once everything is counted the estimate is the real thing
+  pages.set_section_pages(0, 1);
+  pages.set_section_pages(2, 4);
+  pages.set_section_pages(3, 25);
+  TEST_ASSERT_TRUE(pages.estimate_position(3, 0, page_number, total_pages));
+  TEST_ASSERT_EQUAL(15, page_number);
+  TEST_ASSERT_EQUAL(40, total_pages);
+  cache.remove("PGC");
+
+  // the section sizes come from the zip index and are kept in the metadata cache
+  const char *path = "fixtures/relative_paths.epub";
+  BookCache epub_cache(path);
+  epub_cache.remove("MET");
+  Epub *parsed = new Epub(path);
+  TEST_ASSERT_TRUE_MESSAGE(parsed->load(), "Epub load failed");
+  Epub *cached = new Epub(path);
+  TEST_ASSERT_TRUE_MESSAGE(cached->load(), "Cached epub load failed");
+  TEST_ASSERT_EQUAL(parsed->get_spine_items_count(), cached->get_spine_items_count());
+  for (int i = 0; i < parsed->get_spine_items_count(); i++)
+  {
+    size_t size = parsed->get_item_uncompressed_size(parsed->get_spine_item(i));
+    TEST_ASSERT_TRUE(size > 0);
+    TEST_ASSERT_EQUAL(size, parsed->get_spine_item_size(i));
+    TEST_ASSERT_EQUAL(size, cached->get_spine_item_size(i));
+  }
+  TEST_ASSERT_FALSE(cached->get_zip().is_open());
+  delete parsed;
+  delete cached;
+}
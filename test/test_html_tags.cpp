@@ -0,0 +1,43 @@
+#include <unity.h>
+#include <string.h>
+#include <RubbishHtmlParser/HtmlTags.h>
+#include <RubbishHtmlParser/RubbishHtmlParser.h>
+
+void test_html_tag_classifier(void)
+{
+  TEST_ASSERT_EQUAL(TAG_P, classify_tag("p").id);
+  TEST_ASSERT_EQUAL(TAG_BLOCK, classify_tag("p").behaviour);
+  TEST_ASSERT_EQUAL(TAG_H3, classify_tag("h3").id);
+  TEST_ASSERT_EQUAL(TAG_HEADER, classify_tag("h3").behaviour);
+  TEST_ASSERT_EQUAL(TAG_BLOCK | TAG_VOID, classify_tag("br").behaviour);
+  TEST_ASSERT_EQUAL(TAG_IMAGE_SOURCE | TAG_VOID, classify_tag("img").behaviour);
+  TEST_ASSERT_EQUAL(TAG_IMAGE_SOURCE, classify_tag("image").behaviour);
+  TEST_ASSERT_EQUAL(TAG_BLOCKQUOTE, classify_tag("blockquote").id);
+  TEST_ASSERT_EQUAL(TAG_SPAN, classify_tag("span").id);
+  TEST_ASSERT_EQUAL(0, classify_tag("span").behaviour);
+  TEST_ASSERT_EQUAL(TAG_VOID, classify_tag("meta").behaviour);
+  // case doesn't matter
+  TEST_ASSERT_EQUAL(TAG_STRONG, classify_tag("STRONG").id);
+  TEST_ASSERT_EQUAL(TAG_SECTION, classify_tag("SeCtIoN").id);
+  // near misses aren't matched
+  TEST_ASSERT_EQUAL(TAG_UNKNOWN, classify_tag("").id);
+  TEST_ASSERT_EQUAL(TAG_UNKNOWN, classify_tag("h").id);
+  TEST_ASSERT_EQUAL(TAG_UNKNOWN, classify_tag("h7").id);
+  TEST_ASSERT_EQUAL(TAG_UNKNOWN, classify_tag("spa").id);
+  TEST_ASSERT_EQUAL(TAG_UNKNOWN, classify_tag("spans").id);
+  TEST_ASSERT_EQUAL(TAG_UNKNOWN, classify_tag("svg:image").id);
+  TEST_ASSERT_EQUAL(0, classify_tag("nav").behaviour);
+}
+
+void test_parser_new_block_tags(void)
+{
+  const char *html =
+      "<html><body>"
+      "<P>First</P>"
+      "<blockquote>Quoted</blockquote>"
+      "<section>Section <span>with a span</span><sup>1</sup></section>"
+      "<pre>Preformatted</pre>"
+      "</body></html>";
+  RubbishHtmlParser parser(html, strlen(html), "", false);
+  TEST_ASSERT_EQUAL(4, parser.get_blocks().size());
+}
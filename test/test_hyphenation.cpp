@@ -0,0 +1,207 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <EpubList/Epub.h>
+#include <Hyphenation/Hyphenator.h>
+#include <Renderer/Renderer.h>
+#include <RubbishHtmlParser/RubbishHtmlParser.h>
+
+// every byte is the same width so the lines are easy to reason about
+class MonospaceRenderer : public Renderer
+{
+public:
+  virtual int get_text_width(const char *text, bool bold = false, bool italic = false)
+  {
+    return strlen(text) * 10;
+  }
+  virtual void draw_pixel(int x, int y, uint8_t color) {}
+  virtual void draw_text(int x, int y, const char *text, bool bold = false, bool italic = false) {}
+  virtual void draw_text_box(const std::string &text, int x, int y, int width, int height, bool bold = false, bool italic = false) {}
+  virtual void draw_rect(int x, int y, int width, int height, uint8_t color = 0) {}
+  virtual void draw_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color) {}
+  virtual void draw_circle(int x, int y, int r, uint8_t color = 0) {}
+  virtual void fill_rect(int x, int y, int width, int height, uint8_t color = 0) {}
+  virtual void fill_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color) {}
+  virtual void fill_circle(int x, int y, int r, uint8_t color = 0) {}
+  virtual void show_busy() {}
+  virtual void clear_screen() {}
+  virtual int get_page_width() { return 200; }
+  virtual int get_page_height() { return 400; }
+  virtual int get_space_width() { return 10; }
+  virtual int get_line_height() { return 20; }
+  virtual void needs_gray(uint8_t color) {}
+  virtual bool has_gray() { return false; }
+  virtual void show_img(int x, int y, int width, int height, const uint8_t *img_buffer) {}
+};
+
+// the word with a - everywhere it can be hyphenated
+static std::string hyphenate(const Hyphenator &hyphenator, const char *word)
+{
+  uint8_t offsets[Hyphenator::MAX_WORD_LETTERS];
+  int count = hyphenator.hyphenate(word, offsets, Hyphenator::MAX_WORD_LETTERS);
+  std::string result;
+  for (int i = 0, h = 0; word[i]; i++)
+  {
+    if (h < count && offsets[h] == i)
+    {
+      result += '-';
+      h++;
+    }
+    result += word[i];
+  }
+  return result;
+}
+
+void test_hyphenation_patterns(void)
+{
+  Hyphenator hyphenator;
+  TEST_ASSERT_FALSE(hyphenator.is_enabled());
+  TEST_ASSERT_EQUAL_STRING("computer", hyphenate(hyphenator, "computer").c_str());
+  TEST_ASSERT_TRUE(hyphenator.set_language("en-US"));
+  TEST_ASSERT_EQUAL_STRING("en-us", hyphenator.get_language());
+  TEST_ASSERT_EQUAL_STRING("al-go-rithm", hyphenate(hyphenator, "algorithm").c_str());
+  TEST_ASSERT_EQUAL_STRING("ty-pog-ra-phy", hyphenate(hyphenator, "typography").c_str());
+  // from the exception list
+  TEST_ASSERT_EQUAL_STRING("hy-phen-a-tion", hyphenate(hyphenator, "hyphenation").c_str());
+  // capitals and punctuation around the word
+  TEST_ASSERT_EQUAL_STRING("(Pag-i-na-tion,", hyphenate(hyphenator, "(Pagination,").c_str());
+  // as close to the ends as English allows - two letters before and three after
+  TEST_ASSERT_EQUAL_STRING("ta-ble", hyphenate(hyphenator, "table").c_str());
+  TEST_ASSERT_EQUAL_STRING("tank", hyphenate(hyphenator, "tank").c_str());
+  // words with anything else in them are left alone
+  TEST_ASSERT_EQUAL_STRING("don't", hyphenate(hyphenator, "don't").c_str());
+  TEST_ASSERT_EQUAL_STRING("well-known", hyphenate(hyphenator, "well-known").c_str());
+  TEST_ASSERT_EQUAL_STRING("1980s", hyphenate(hyphenator, "1980s").c_str());
+  // languages fall back to the patterns we have for them
+  TEST_ASSERT_TRUE(hyphenator.set_language("en_GB"));
+  TEST_ASSERT_EQUAL_STRING("en-us", hyphenator.get_language());
+  TEST_ASSERT_TRUE(hyphenator.set_language("de-DE"));
+  TEST_ASSERT_EQUAL_STRING("Do-nau-dampf-schiff-fahrt", hyphenate(hyphenator, "Donaudampfschifffahrt").c_str());
+  TEST_ASSERT_EQUAL_STRING("Über-mä-ßig", hyphenate(hyphenator, "Übermäßig").c_str());
+  TEST_ASSERT_TRUE(hyphenator.set_language("es"));
+  TEST_ASSERT_EQUAL_STRING("mur-cié-la-go", hyphenate(hyphenator, "murciélago").c_str());
+  TEST_ASSERT_TRUE(hyphenator.set_language("fr"));
+  TEST_ASSERT_EQUAL_STRING("dé-ve-lop-pe-ment", hyphenate(hyphenator, "développement").c_str());
+  TEST_ASSERT_FALSE(hyphenator.set_language("x-klingon"));
+  TEST_ASSERT_FALSE(hyphenator.set_language("e"));
+  TEST_ASSERT_FALSE(hyphenator.is_enabled());
+}
+
+void test_hyphenated_line_breaks(void)
+{
+  Hyphenator hyphenator;
+  TEST_ASSERT_TRUE(hyphenator.set_language("en-us"));
+  MonospaceRenderer renderer;
+  const char *text = "Typography demonstrates hyphenation beautifully in paragraphs containing extraordinarily long words";
+  TextBlock plain(JUSTIFIED);
+  plain.add_span(text, false, false);
+  plain.measure(&renderer);
+  plain.break_lines(0, 200, 0, 10);
+  TextBlock hyphenated(JUSTIFIED);
+  hyphenated.add_span(text, false, false);
+  hyphenated.measure(&renderer, &hyphenator);
+  TEST_ASSERT_TRUE(hyphenated.get_hyphen_count() > 10);
+  hyphenated.break_lines(0, 200, 0, 10);
+  // the long words make big gaps without hyphens, so with them the lines
+  // fill up and there are fewer of them
+  TEST_ASSERT_TRUE(hyphenated.get_line_count() < plain.get_line_count());
+  std::string joined;
+  bool found_hyphen = false;
+  for (int line = 0; line < hyphenated.get_line_count(); line++)
+  {
+    std::string line_text = hyphenated.get_line_text(line);
+    // every byte is 10 wide so the text has to fit in 20 of them
+    TEST_ASSERT_TRUE(line_text.size() <= 20);
+    if (line_text[line_text.size() - 1] == '-')
+    {
+      found_hyphen = true;
+      joined += line_text.substr(0, line_text.size() - 1);
+    }
+    else
+    {
+      joined += line_text + " ";
+    }
+  }
+  TEST_ASSERT_TRUE(found_hyphen);
+  // the hyphens come out and the text is all there
+  TEST_ASSERT_EQUAL_STRING((std::string(text) + " ").c_str(), joined.c_str());
+  // breaking again for a different width gives back the words without any splits
+  hyphenated.break_lines(0, 2000, 0, 10);
+  TEST_ASSERT_EQUAL(1, hyphenated.get_line_count());
+  TEST_ASSERT_EQUAL_STRING(text, hyphenated.get_line_text(0).c_str());
+  // a word too long for any line is split over as many as it needs
+  TextBlock long_word(LEFT_ALIGN);
+  long_word.add_span("supercalifragilisticexpialidocious", false, false);
+  long_word.measure(&renderer, &hyphenator);
+  long_word.break_lines(0, 100, 0, 10);
+  TEST_ASSERT_TRUE(long_word.get_line_count() >= 4);
+  joined.clear();
+  for (int line = 0; line < long_word.get_line_count(); line++)
+  {
+    std::string line_text = long_word.get_line_text(line);
+    TEST_ASSERT_TRUE(line_text.size() <= 10);
+    TEST_ASSERT_EQUAL(line == long_word.get_line_count() - 1, line_text[line_text.size() - 1] != '-');
+    joined += line_text.substr(0, line_text.size() - (line_text[line_text.size() - 1] == '-' ? 1 : 0));
+  }
+  TEST_ASSERT_EQUAL_STRING("supercalifragilisticexpialidocious", joined.c_str());
+}
+
+// how long it takes to find the hyphens in every word of a book
+static void benchmark_hyphenation(const char *path)
+{
+  Epub *epub = new Epub(path);
+  TEST_ASSERT_TRUE_MESSAGE(epub->load(), "Epub load failed");
+  const Hyphenator *hyphenator = epub->get_hyphenator();
+  TEST_ASSERT_NOT_NULL(hyphenator);
+  std::vector<std::string> words;
+  for (int i = 0; i < epub->get_spine_items_count(); i++)
+  {
+    size_t size = 0;
+    char *html = reinterpret_cast<char *>(epub->get_item_contents(epub->get_spine_item(i), &size));
+    TEST_ASSERT_NOT_NULL(html);
+    RubbishHtmlParser parser(html, size, "", false);
+    free(html);
+    for (auto block : parser.get_blocks())
+    {
+      if (block->getType() == BlockType::TEXT_BLOCK)
+      {
+        TextBlock *text_block = static_cast<TextBlock *>(block);
+        for (int w = 0; w < text_block->get_word_count(); w++)
+        {
+          words.push_back(text_block->get_word(w));
+        }
+      }
+    }
+  }
+  TEST_ASSERT_TRUE(words.size() > 0);
+  uint8_t offsets[Hyphenator::MAX_WORD_LETTERS];
+  size_t min_length = hyphenator->get_min_word_length();
+  int hyphens = 0;
+  int looked_up = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (const std::string &word : words)
+  {
+    // layout skips the short words too
+    if (word.size() >= min_length)
+    {
+      looked_up++;
+      hyphens += hyphenator->hyphenate(word.c_str(), offsets, Hyphenator::MAX_WORD_LETTERS);
+    }
+  }
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  char message[256];
+  snprintf(message, sizeof(message), "%s (%s): %d of %d words looked up in %.1f ms, %.0f ns per word, %d hyphens",
+           path, hyphenator->get_language(), looked_up, static_cast<int>(words.size()), elapsed * 1000, elapsed * 1e9 / looked_up, hyphens);
+  TEST_MESSAGE(message);
+  delete epub;
+}
+
+void test_hyphenation_benchmark(void)
+{
+  benchmark_hyphenation("fixtures/oebps.epub");
+  benchmark_hyphenation("fixtures/no_oebps.epub");
+}
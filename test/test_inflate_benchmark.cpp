@@ -0,0 +1,70 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <EpubList/Epub.h>
+#include <ZipFile/ZipFile.h>
+#include "benchmark.h"
+
+// read every spine item with the given engine, recording the time taken in
+// seconds and the number of bytes inflated
+static void time_spine_reads(Epub *epub, ZIP_INFLATE_ENGINE engine, int passes, double *seconds, size_t *total_bytes)
+{
+  epub->get_zip().set_inflate_engine(engine);
+  *total_bytes = 0;
+  benchmark_time_t start = benchmark_now();
+  for (int pass = 0; pass < passes; pass++)
+  {
+    for (int i = 0; i < epub->get_spine_items_count(); i++)
+    {
+      size_t size = 0;
+      uint8_t *data = epub->get_item_contents(epub->get_spine_item(i), &size);
+      TEST_ASSERT_NOT_NULL(data);
+      *total_bytes += size;
+      free(data);
+    }
+  }
+  *seconds = benchmark_seconds(start);
+}
+
+static void benchmark_inflate(Epub *epub, const char *path)
+{
+  // both engines have to produce exactly the same output
+  for (int i = 0; i < epub->get_spine_items_count(); i++)
+  {
+    size_t miniz_size = 0;
+    size_t fast_size = 0;
+    epub->get_zip().set_inflate_engine(ZIP_INFLATE_MINIZ);
+    uint8_t *miniz_data = epub->get_item_contents(epub->get_spine_item(i), &miniz_size);
+    epub->get_zip().set_inflate_engine(ZIP_INFLATE_FAST);
+    uint8_t *fast_data = epub->get_item_contents(epub->get_spine_item(i), &fast_size);
+    TEST_ASSERT_NOT_NULL(miniz_data);
+    TEST_ASSERT_NOT_NULL(fast_data);
+    TEST_ASSERT_EQUAL(miniz_size, fast_size);
+    TEST_ASSERT_EQUAL_MEMORY(miniz_data, fast_data, miniz_size);
+    free(miniz_data);
+    free(fast_data);
+  }
+  const int passes = 5;
+  size_t miniz_bytes = 0;
+  size_t fast_bytes = 0;
+  double miniz_time = 0;
+  double fast_time = 0;
+  time_spine_reads(epub, ZIP_INFLATE_MINIZ, passes, &miniz_time, &miniz_bytes);
+  time_spine_reads(epub, ZIP_INFLATE_FAST, passes, &fast_time, &fast_bytes);
+  TEST_ASSERT_EQUAL(miniz_bytes, fast_bytes);
+  // every entry should have gone through the fast engine
+  TEST_ASSERT_EQUAL(0, epub->get_zip().get_stats().inflate_fallbacks);
+  char message[200];
+  snprintf(message, sizeof(message), "%s: miniz %.1f MB/s, fast %.1f MB/s (%u bytes x %d)",
+           path,
+           miniz_bytes / miniz_time / 1e6,
+           fast_bytes / fast_time / 1e6,
+           (unsigned)(fast_bytes / passes), passes);
+  TEST_MESSAGE(message);
+}
+
+void test_inflate_benchmark(void)
+{
+  benchmark_fixtures(benchmark_inflate);
+}
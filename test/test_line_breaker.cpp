@@ -0,0 +1,271 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <EpubList/Epub.h>
+#include <Renderer/Renderer.h>
+#include <RubbishHtmlParser/LineBreaker.h>
+#include <RubbishHtmlParser/RubbishHtmlParser.h>
+#include "benchmark.h"
+
+// words with spaces between them that can stretch and shrink - the data of
+// each item is the word it comes after
+static void add_words(LineBreaker &breaker, const std::vector<int> &widths, int space, int stretch, int shrink)
+{
+  breaker.start();
+  for (size_t i = 0; i < widths.size(); i++)
+  {
+    breaker.add_box(widths[i], i);
+    if (i + 1 < widths.size())
+    {
+      breaker.add_glue(space, stretch, shrink, i);
+    }
+  }
+  breaker.add_penalty(0, -LineBreaker::INFINITE_PENALTY, false, widths.size() - 1);
+}
+
+// how wide each line is with plain spaces, from the words the lines end with
+static std::vector<int> line_widths(const LineBreaker &breaker, const std::vector<int> &widths, int space)
+{
+  std::vector<int> result;
+  size_t start = 0;
+  for (int line = 0; line < breaker.get_line_count(); line++)
+  {
+    size_t end = breaker.get_line_end(line).data;
+    int width = 0;
+    for (size_t i = start; i <= end; i++)
+    {
+      width += widths[i] + (i > start ? space : 0);
+    }
+    result.push_back(width);
+    start = end + 1;
+  }
+  return result;
+}
+
+// the sum of the squares of the gaps at the ends of all but the last line
+static int raggedness(const std::vector<int> &lines, int line_width)
+{
+  int total = 0;
+  for (size_t i = 0; i + 1 < lines.size(); i++)
+  {
+    total += (line_width - lines[i]) * (line_width - lines[i]);
+  }
+  return total;
+}
+
+void test_line_breaker(void)
+{
+  LineBreaker breaker;
+  // the spaces can shrink enough for all four words to fit on one line
+  std::vector<int> widths = {20, 20, 20, 20};
+  add_words(breaker, widths, 10, 5, 4);
+  TEST_ASSERT_TRUE(breaker.break_lines(100));
+  TEST_ASSERT_EQUAL(1, breaker.get_line_count());
+  add_words(breaker, widths, 10, 5, 0);
+  TEST_ASSERT_TRUE(breaker.break_lines(100));
+  TEST_ASSERT_EQUAL(2, breaker.get_line_count());
+  // a word wider than the line gets a line of its own
+  widths = {30, 150, 30};
+  add_words(breaker, widths, 10, 5, 3);
+  TEST_ASSERT_TRUE(breaker.break_lines(100));
+  TEST_ASSERT_EQUAL(3, breaker.get_line_count());
+  TEST_ASSERT_EQUAL(1, breaker.get_line_end(1).data);
+  // breaking at a hyphen fills the first line exactly and its width counts
+  breaker.start();
+  breaker.add_box(60, 0);
+  breaker.add_glue(10, 5, 3, 0);
+  breaker.add_box(25, 1);
+  breaker.add_penalty(5, 50, true, 1);
+  breaker.add_box(25, 1);
+  TEST_ASSERT_TRUE(breaker.break_lines(100));
+  TEST_ASSERT_EQUAL(2, breaker.get_line_count());
+  TEST_ASSERT_EQUAL(LINE_PENALTY, breaker.get_line_end(0).type);
+  TEST_ASSERT_TRUE(breaker.get_line_end(0).flagged);
+  // but not if the hyphen would make the line too long even with the space
+  // squeezed up
+  TEST_ASSERT_TRUE(breaker.break_lines(96));
+  TEST_ASSERT_EQUAL(LINE_GLUE, breaker.get_line_end(0).type);
+  // looking at the whole paragraph evens out the lines compared to filling
+  // each one in turn
+  widths.clear();
+  srand(1234);
+  for (int i = 0; i < 400; i++)
+  {
+    widths.push_back(10 + rand() % 60);
+  }
+  add_words(breaker, widths, 10, 5, 3);
+  TEST_ASSERT_TRUE(breaker.break_lines(300));
+  std::vector<int> total_fit = line_widths(breaker, widths, 10);
+  std::vector<int> first_fit;
+  int width = -10;
+  for (size_t i = 0; i < widths.size(); i++)
+  {
+    if (width + 10 + widths[i] > 300)
+    {
+      first_fit.push_back(width);
+      width = -10;
+    }
+    width += 10 + widths[i];
+  }
+  first_fit.push_back(width);
+  for (size_t i = 0; i < total_fit.size(); i++)
+  {
+    // the spaces can shrink by 3 each
+    size_t start = i == 0 ? 0 : breaker.get_line_end(i - 1).data + 1;
+    int gaps = breaker.get_line_end(i).data - start;
+    TEST_ASSERT_TRUE(total_fit[i] - gaps * 3 <= 300);
+  }
+  TEST_ASSERT_TRUE(raggedness(total_fit, 300) < raggedness(first_fit, 300));
+  // a paragraph long enough that the unreachable breaks have to be thrown
+  // away as it goes still gets the whole paragraph looked at
+  widths.clear();
+  for (int i = 0; i < 3000; i++)
+  {
+    widths.push_back(10 + rand() % 60);
+  }
+  add_words(breaker, widths, 10, 5, 3);
+  TEST_ASSERT_TRUE(breaker.break_lines(300));
+  total_fit = line_widths(breaker, widths, 10);
+  TEST_ASSERT_TRUE(total_fit.size() < LineBreaker::MAX_NODES);
+  first_fit.clear();
+  width = -10;
+  for (size_t i = 0; i < widths.size(); i++)
+  {
+    if (width + 10 + widths[i] > 300)
+    {
+      first_fit.push_back(width);
+      width = -10;
+    }
+    width += 10 + widths[i];
+  }
+  first_fit.push_back(width);
+  TEST_ASSERT_TRUE(raggedness(total_fit, 300) < raggedness(first_fit, 300));
+  // and one with more lines than there's room to keep breaks for is just
+  // filled a line at a time
+  for (int i = 0; i < 6000; i++)
+  {
+    widths.push_back(10 + rand() % 60);
+  }
+  widths.push_back(400);
+  add_words(breaker, widths, 10, 5, 3);
+  TEST_ASSERT_TRUE(breaker.break_lines(300));
+  TEST_ASSERT_TRUE(breaker.get_line_count() > (int)LineBreaker::MAX_NODES);
+  TEST_ASSERT_EQUAL(widths.size() - 1, breaker.get_line_end(breaker.get_line_count() - 1).data);
+  first_fit.clear();
+  width = -10;
+  for (size_t i = 0; i < widths.size(); i++)
+  {
+    if (width + 10 + widths[i] > 300 && width >= 0)
+    {
+      first_fit.push_back(width);
+      width = -10;
+    }
+    width += 10 + widths[i];
+  }
+  first_fit.push_back(width);
+  total_fit = line_widths(breaker, widths, 10);
+  TEST_ASSERT_EQUAL(first_fit.size(), total_fit.size());
+  for (size_t i = 0; i < total_fit.size(); i++)
+  {
+    TEST_ASSERT_EQUAL(first_fit[i], total_fit[i]);
+  }
+  // the memory comes back once we're done
+  breaker.free_memory();
+  TEST_ASSERT_EQUAL(0, breaker.get_line_count());
+}
+
+// text that's a bit more like a real font - narrow and wide letters
+class ProportionalRenderer : public Renderer
+{
+public:
+  virtual int get_text_width(const char *text, bool bold = false, bool italic = false)
+  {
+    int width = 0;
+    for (const char *p = text; *p; p++)
+    {
+      width += 5 + static_cast<uint8_t>(*p) % 7 + (bold ? 1 : 0);
+    }
+    return width;
+  }
+  virtual void draw_pixel(int x, int y, uint8_t color) {}
+  virtual void draw_text(int x, int y, const char *text, bool bold = false, bool italic = false) {}
+  virtual void draw_text_box(const std::string &text, int x, int y, int width, int height, bool bold = false, bool italic = false) {}
+  virtual void draw_rect(int x, int y, int width, int height, uint8_t color = 0) {}
+  virtual void draw_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color) {}
+  virtual void draw_circle(int x, int y, int r, uint8_t color = 0) {}
+  virtual void fill_rect(int x, int y, int width, int height, uint8_t color = 0) {}
+  virtual void fill_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color) {}
+  virtual void fill_circle(int x, int y, int r, uint8_t color = 0) {}
+  virtual void show_busy() {}
+  virtual void clear_screen() {}
+  virtual int get_page_width() { return 540; }
+  virtual int get_page_height() { return 900; }
+  virtual int get_space_width() { return 6; }
+  virtual int get_line_height() { return 28; }
+  virtual void needs_gray(uint8_t color) {}
+  virtual bool has_gray() { return false; }
+  virtual void show_img(int x, int y, int width, int height, const uint8_t *img_buffer) {}
+};
+
+// how many words a second the line breaker gets through for every
+// paragraph of a book at a few different widths
+static void benchmark_line_breaker(Epub *epub, const char *path)
+{
+  ProportionalRenderer renderer;
+  std::vector<RubbishHtmlParser *> sections;
+  std::vector<TextBlock *> blocks;
+  for (int i = 0; i < epub->get_spine_items_count(); i++)
+  {
+    size_t size = 0;
+    char *html = reinterpret_cast<char *>(epub->get_item_contents(epub->get_spine_item(i), &size));
+    TEST_ASSERT_NOT_NULL(html);
+    RubbishHtmlParser *parser = new RubbishHtmlParser(html, size, "", true, &epub->get_styles());
+    free(html);
+    sections.push_back(parser);
+    for (auto block : parser->get_blocks())
+    {
+      if (block->getType() == BlockType::TEXT_BLOCK && !block->isEmpty())
+      {
+        TextBlock *text_block = static_cast<TextBlock *>(block);
+        text_block->measure(&renderer, epub->get_hyphenator());
+        blocks.push_back(text_block);
+      }
+    }
+  }
+  TEST_ASSERT_TRUE(blocks.size() > 0);
+  LineBreaker breaker;
+  const int page_widths[] = {540, 460, 380, 300};
+  long words = 0;
+  long lines = 0;
+  int hyphens = 0;
+  benchmark_time_t start = benchmark_now();
+  for (int width : page_widths)
+  {
+    for (TextBlock *block : blocks)
+    {
+      block->break_lines(0, width, 0, renderer.get_space_width(), &breaker);
+      words += block->get_word_count();
+      lines += block->get_line_count();
+    }
+  }
+  double elapsed = benchmark_seconds(start);
+  for (TextBlock *block : blocks)
+  {
+    hyphens += block->get_hyphen_count();
+  }
+  char message[256];
+  snprintf(message, sizeof(message), "%s: %ld words into %ld lines in %.1f ms, %.0f words per second, %d hyphenation points",
+           path, words, lines, elapsed * 1000, words / elapsed, hyphens);
+  TEST_MESSAGE(message);
+  for (auto section : sections)
+  {
+    delete section;
+  }
+}
+
+void test_line_breaker_benchmark(void)
+{
+  benchmark_fixtures(benchmark_line_breaker);
+}
@@ -0,0 +1,86 @@
+#include <unity.h>
+#include <string.h>
+#include <RubbishHtmlParser/SectionText.h>
+#include <RubbishHtmlParser/SectionWords.h>
+#include <RubbishHtmlParser/blocks/TextBlock.h>
+
+// copy a span into the section and split it into the block's words - what
+// the parser does for each piece of text
+static void add_span(SectionText &text, TextBlock *block, const char *span, bool is_bold, bool is_italic)
+{
+  uint32_t offset;
+  TEST_ASSERT_NOT_NULL(text.append(span, strlen(span), &offset));
+  block->add_words(offset, strlen(span), is_bold, is_italic);
+}
+
+static void check_words(TextBlock *block, const char **expected, const uint8_t *styles, int count)
+{
+  TEST_ASSERT_EQUAL(count, block->get_word_count());
+  for (int i = 0; i < count; i++)
+  {
+    TEST_ASSERT_EQUAL_STRING(expected[i], block->get_word(i));
+    TEST_ASSERT_EQUAL(styles[i], block->get_word_style(i));
+  }
+}
+
+void test_section_words(void)
+{
+  SectionText text;
+  SectionWords words;
+  TextBlock *first = new TextBlock(LEFT_ALIGN, &text, &words);
+  add_span(text, first, "  The quick\r\nbrown  ", false, false);
+  add_span(text, first, "fox\njumps", true, false);
+  TextBlock *second = new TextBlock(JUSTIFIED, &text, &words);
+  add_span(text, second, "over the", false, true);
+  add_span(text, second, " lazy ", true, true);
+  // only the newest block can have words added
+  add_span(text, first, "dog", false, false);
+  TextBlock *empty = new TextBlock(LEFT_ALIGN, &text, &words);
+  add_span(text, empty, " \r\n ", false, false);
+  TextBlock *third = new TextBlock(LEFT_ALIGN, &text, &words);
+  add_span(text, third, "dog", false, false);
+
+  const char *first_words[] = {"The", "quick", "brown", "fox", "jumps"};
+  const uint8_t first_styles[] = {0, 0, 0, BOLD_SPAN, BOLD_SPAN};
+  const char *second_words[] = {"over", "the", "lazy"};
+  const uint8_t second_styles[] = {ITALIC_SPAN, ITALIC_SPAN, BOLD_SPAN | ITALIC_SPAN};
+  const char *third_words[] = {"dog"};
+  const uint8_t third_styles[] = {0};
+  check_words(first, first_words, first_styles, 5);
+  check_words(second, second_words, second_styles, 3);
+  TEST_ASSERT_TRUE(empty->is_empty());
+  check_words(third, third_words, third_styles, 1);
+
+  // the words are packed down with just their terminators between them and
+  // the whitespace is given back - apart from the span the first block
+  // turned away, which is still in the text before the last word
+  TEST_ASSERT_EQUAL(9, words.get_count());
+  TEST_ASSERT_EQUAL(0, words.get_offset(0));
+  for (uint32_t i = 1; i < words.get_count(); i++)
+  {
+    uint32_t gap = i == 8 ? strlen("dog") + 1 : 0;
+    TEST_ASSERT_EQUAL(words.get_offset(i - 1) + strlen(text.get(words.get_offset(i - 1))) + 1 + gap, words.get_offset(i));
+  }
+  TEST_ASSERT_EQUAL(words.get_offset(8) + 4, text.get_length());
+  TEST_ASSERT_EQUAL(BOLD_SPAN | ITALIC_SPAN, words.get_style(7));
+
+  // the section trims its arrays, not the blocks in it
+  first->finish();
+  TEST_ASSERT_EQUAL(64, words.words.get_capacity());
+  // trimming moves the buffers but the blocks only have offsets into them
+  text.shrink_to_fit();
+  words.shrink_to_fit();
+  TEST_ASSERT_EQUAL(text.get_length(), text.get_capacity());
+  TEST_ASSERT_EQUAL(9, words.words.get_capacity());
+  TEST_ASSERT_EQUAL(0, words.widths.get_capacity());
+  TEST_ASSERT_EQUAL(0, words.line_ends.get_capacity());
+  TEST_ASSERT_EQUAL(9 * sizeof(uint32_t), words.get_capacity_bytes());
+  check_words(first, first_words, first_styles, 5);
+  check_words(second, second_words, second_styles, 3);
+  check_words(third, third_words, third_styles, 1);
+
+  delete first;
+  delete second;
+  delete empty;
+  delete third;
+}
@@ -0,0 +1,174 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <EpubList/Epub.h>
+#include <Renderer/Renderer.h>
+#include <RubbishHtmlParser/RubbishHtmlParser.h>
+#include "benchmark.h"
+
+// a renderer where measuring text costs something per glyph, a bit like
+// FreeType loading every glyph to get its advance
+class GlyphLoadingRenderer : public Renderer
+{
+public:
+  uintptr_t font_id = 1;
+  int pixel_size = 24;
+  int glyph_work = 0;
+  int measure_calls = 0;
+  // the glyph work ends up here so the compiler can't throw it away
+  uint32_t outlines = 0;
+
+  virtual int get_text_width(const char *text, bool bold = false, bool italic = false)
+  {
+    measure_calls++;
+    int width = 0;
+    uint32_t outline = 0;
+    for (const char *p = text; *p; p++)
+    {
+      for (int i = 0; i < glyph_work; i++)
+      {
+        outline = outline * 31 + static_cast<uint8_t>(*p) + i;
+      }
+      width += 5 + static_cast<uint8_t>(*p) % 7 + (bold ? 1 : 0);
+    }
+    outlines += outline;
+    return width * pixel_size / 24;
+  }
+  virtual uintptr_t get_font_id() { return font_id; }
+  virtual int get_font_pixel_size() { return pixel_size; }
+  virtual void draw_pixel(int x, int y, uint8_t color) {}
+  virtual void draw_text(int x, int y, const char *text, bool bold = false, bool italic = false) {}
+  virtual void draw_text_box(const std::string &text, int x, int y, int width, int height, bool bold = false, bool italic = false) {}
+  virtual void draw_rect(int x, int y, int width, int height, uint8_t color = 0) {}
+  virtual void draw_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color) {}
+  virtual void draw_circle(int x, int y, int r, uint8_t color = 0) {}
+  virtual void fill_rect(int x, int y, int width, int height, uint8_t color = 0) {}
+  virtual void fill_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color) {}
+  virtual void fill_circle(int x, int y, int r, uint8_t color = 0) {}
+  virtual void show_busy() {}
+  virtual void clear_screen() {}
+  virtual int get_page_width() { return 540 - margin_left - margin_right; }
+  virtual int get_page_height() { return 900; }
+  virtual int get_space_width() { return 6; }
+  virtual int get_line_height() { return 28; }
+  virtual void needs_gray(uint8_t color) {}
+  virtual bool has_gray() { return false; }
+  virtual void show_img(int x, int y, int width, int height, const uint8_t *img_buffer) {}
+};
+
+void test_word_width_cache(void)
+{
+  GlyphLoadingRenderer renderer;
+  WordWidthCache &cache = renderer.get_word_width_cache();
+  int width = renderer.get_word_width("hello");
+  TEST_ASSERT_EQUAL(renderer.get_text_width("hello"), width);
+  renderer.measure_calls = 0;
+  TEST_ASSERT_EQUAL(width, renderer.get_word_width("hello"));
+  TEST_ASSERT_EQUAL(0, renderer.measure_calls);
+  TEST_ASSERT_EQUAL(1, cache.get_hits());
+  TEST_ASSERT_EQUAL(1, cache.get_misses());
+  // the style is part of the key
+  TEST_ASSERT_EQUAL(renderer.get_text_width("hello", true), renderer.get_word_width("hello", true));
+  TEST_ASSERT_EQUAL(2, renderer.measure_calls);
+  // words too long to cache are measured every time
+  const char *long_word = "incomprehensibilities-and-more";
+  renderer.get_word_width(long_word);
+  renderer.get_word_width(long_word);
+  TEST_ASSERT_EQUAL(4, renderer.measure_calls);
+  // a new font size throws away everything we know
+  renderer.pixel_size = 48;
+  renderer.measure_calls = 0;
+  TEST_ASSERT_EQUAL(width * 2, renderer.get_word_width("hello"));
+  TEST_ASSERT_EQUAL(1, renderer.measure_calls);
+  renderer.font_id = 2;
+  renderer.get_word_width("hello");
+  TEST_ASSERT_EQUAL(2, renderer.measure_calls);
+  // words that land in the same set push out the least recently used one
+  for (int i = 0; i < 10000; i++)
+  {
+    char word[16];
+    snprintf(word, sizeof(word), "w%d", i);
+    TEST_ASSERT_EQUAL(renderer.get_text_width(word), renderer.get_word_width(word));
+    TEST_ASSERT_EQUAL(renderer.get_text_width("hello"), renderer.get_word_width("hello"));
+  }
+}
+
+// lay out every section of the book, returning the time taken in seconds
+static double layout_book(Epub *epub, const std::vector<RubbishHtmlParser *> &sections, Renderer *renderer, int *pages)
+{
+  *pages = 0;
+  benchmark_time_t start = benchmark_now();
+  for (auto section : sections)
+  {
+    section->layout(renderer, epub);
+    *pages += section->get_page_count();
+  }
+  return benchmark_seconds(start);
+}
+
+static void parse_book(Epub *epub, std::vector<RubbishHtmlParser *> &sections)
+{
+  for (int i = 0; i < epub->get_spine_items_count(); i++)
+  {
+    size_t size = 0;
+    char *html = reinterpret_cast<char *>(epub->get_item_contents(epub->get_spine_item(i), &size));
+    TEST_ASSERT_NOT_NULL(html);
+    sections.push_back(new RubbishHtmlParser(html, size, "", false, &epub->get_styles()));
+    free(html);
+  }
+}
+
+static void free_book(std::vector<RubbishHtmlParser *> &sections)
+{
+  for (auto section : sections)
+  {
+    delete section;
+  }
+  sections.clear();
+}
+
+static void benchmark_layout(Epub *epub, const char *path)
+{
+  GlyphLoadingRenderer renderer;
+  renderer.glyph_work = 200;
+  WordWidthCache &cache = renderer.get_word_width_cache();
+  int uncached_pages = 0;
+  int cached_pages = 0;
+  int relayout_pages = 0;
+  // a fresh parse each time so every word has to be measured
+  std::vector<RubbishHtmlParser *> sections;
+  parse_book(epub, sections);
+  cache.set_enabled(false);
+  double uncached_time = layout_book(epub, sections, &renderer, &uncached_pages);
+  free_book(sections);
+  parse_book(epub, sections);
+  cache.set_enabled(true);
+  cache.reset_stats();
+  double cached_time = layout_book(epub, sections, &renderer, &cached_pages);
+  uint32_t hits = cache.get_hits();
+  uint32_t misses = cache.get_misses();
+  TEST_ASSERT_EQUAL(uncached_pages, cached_pages);
+  // laying out again after the margins change only breaks the lines again
+  renderer.set_margin_left(20);
+  renderer.set_margin_right(20);
+  renderer.measure_calls = 0;
+  double relayout_time = layout_book(epub, sections, &renderer, &relayout_pages);
+  TEST_ASSERT_EQUAL(0, renderer.measure_calls);
+  TEST_ASSERT_TRUE(relayout_pages >= cached_pages);
+  char message[256];
+  snprintf(message, sizeof(message), "%s: layout uncached %.1f ms, cached %.1f ms (%.1f%% hits), relayout after a margin change %.1f ms",
+           path,
+           uncached_time * 1000,
+           cached_time * 1000,
+           100.0 * hits / (hits + misses),
+           relayout_time * 1000);
+  TEST_MESSAGE(message);
+  free_book(sections);
+}
+
+void test_layout_benchmark(void)
+{
+  benchmark_fixtures(benchmark_layout);
+}
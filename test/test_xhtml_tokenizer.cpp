@@ -0,0 +1,264 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <pugixml.hpp>
+#include <EpubList/Epub.h>
+#include <ZipFile/ZipFile.h>
+#include <RubbishHtmlParser/RubbishHtmlParser.h>
+#include <RubbishHtmlParser/XhtmlTokenizer.h>
+#include "benchmark.h"
+
+// writes each event out as a string so whole documents can be compared
+class RecordingHandler : public XhtmlHandler
+{
+public:
+  std::string events;
+  std::string skip_tag;
+  bool enter_node(const char *tag_name, const XhtmlAttributes &attributes) override
+  {
+    events += "<";
+    events += tag_name;
+    const char *href = attributes.get("href");
+    if (href[0])
+    {
+      events += " href=";
+      events += href;
+    }
+    events += ">";
+    return skip_tag != tag_name;
+  }
+  void visit_text(const char *text, size_t length) override
+  {
+    events += "[";
+    events.append(text, length);
+    events += "]";
+  }
+  void exit_node(const char *tag_name) override
+  {
+    events += "</";
+    events += tag_name;
+    events += ">";
+  }
+};
+
+// just counts things so the benchmark measures the tokenizer and not the handler
+class CountingHandler : public XhtmlHandler
+{
+public:
+  size_t elements = 0;
+  size_t text_bytes = 0;
+  bool enter_node(const char *tag_name, const XhtmlAttributes &attributes) override
+  {
+    elements++;
+    return true;
+  }
+  void visit_text(const char *text, size_t length) override
+  {
+    text_bytes += length;
+  }
+  void exit_node(const char *tag_name) override {}
+};
+
+static const char *TEST_DOCUMENT =
+    "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+    "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.1//EN\" \"http://www.w3.org/TR/xhtml11/DTD/xhtml11.dtd\">"
+    "<html><head><title>Skipped</title></head>"
+    "<body><!-- a comment with <tags> in it -->"
+    "<p>Hello <b>bold</b> world<br>next line</p>"
+    "<a href='one&amp;two.html'>link</a><img src=\"x.png\"/>"
+    "<p><![CDATA[1 < 2 ]]></p>"
+    "</body></html>";
+
+// there's no exit for the skipped head element
+static const char *EXPECTED_EVENTS =
+    "[\n]<html><head>"
+    "<body><p>[Hello ]<b>[bold]</b>[ world]<br></br>[next line]</p>"
+    "<a href=one&two.html>[link]</a><img></img>"
+    "<p>[1 < 2 ]</p>"
+    "</body></html>";
+
+void test_xhtml_tokenizer_events(void)
+{
+  RecordingHandler handler;
+  handler.skip_tag = "head";
+  XhtmlTokenizer *tokenizer = new XhtmlTokenizer(handler);
+  tokenizer->feed(TEST_DOCUMENT, strlen(TEST_DOCUMENT));
+  tokenizer->finish();
+  delete tokenizer;
+  TEST_ASSERT_EQUAL_STRING(EXPECTED_EVENTS, handler.events.c_str());
+}
+
+void test_xhtml_tokenizer_chunked(void)
+{
+  // feeding a byte at a time has to give exactly the same events
+  RecordingHandler handler;
+  handler.skip_tag = "head";
+  XhtmlTokenizer *tokenizer = new XhtmlTokenizer(handler);
+  size_t length = strlen(TEST_DOCUMENT);
+  for (size_t i = 0; i < length; i++)
+  {
+    tokenizer->feed(TEST_DOCUMENT + i, 1);
+  }
+  tokenizer->finish();
+  delete tokenizer;
+  TEST_ASSERT_EQUAL_STRING(EXPECTED_EVENTS, handler.events.c_str());
+}
+
+static void check_stream_parse_matches(const char *path)
+{
+  Epub *epub = new Epub(path);
+  TEST_ASSERT_TRUE_MESSAGE(epub->load(), "Epub load failed");
+  for (int i = 0; i < epub->get_spine_items_count(); i++)
+  {
+    std::string item = epub->get_spine_item(i);
+    size_t size = 0;
+    char *html = reinterpret_cast<char *>(epub->get_item_contents(item, &size));
+    TEST_ASSERT_NOT_NULL(html);
+    RubbishHtmlParser *from_buffer = new RubbishHtmlParser(html, size, epub->get_base_path(), false);
+    free(html);
+    ZipEntryStream *stream = epub->open_item_stream(item);
+    TEST_ASSERT_NOT_NULL(stream);
+    RubbishHtmlParser *from_stream = new RubbishHtmlParser(stream, epub->get_base_path(), false);
+    delete stream;
+    // and a chunk at a time like the background pagination does
+    RubbishHtmlParser *in_steps = new RubbishHtmlParser(epub->get_base_path(), false);
+    in_steps->start_parse(epub->open_item_stream(item));
+    int steps = 0;
+    while (!in_steps->parse_more(1))
+    {
+      TEST_ASSERT_FALSE(in_steps->is_parsed());
+      steps++;
+    }
+    TEST_ASSERT_TRUE(in_steps->is_parsed());
+    TEST_ASSERT_EQUAL((int)((size + 1023) / 1024), steps);
+    TEST_ASSERT_EQUAL(from_buffer->get_blocks().size(), from_stream->get_blocks().size());
+    TEST_ASSERT_EQUAL(from_buffer->get_blocks().size(), in_steps->get_blocks().size());
+    auto buffer_block = from_buffer->get_blocks().begin();
+    auto step_block = in_steps->get_blocks().begin();
+    for (auto stream_block : from_stream->get_blocks())
+    {
+      TEST_ASSERT_EQUAL((*buffer_block)->getType(), stream_block->getType());
+      TEST_ASSERT_EQUAL((*step_block)->getType(), stream_block->getType());
+      buffer_block++;
+      step_block++;
+    }
+    delete from_buffer;
+    delete from_stream;
+    delete in_steps;
+  }
+  delete epub;
+}
+
+void test_xhtml_tokenizer_stream_parse(void)
+{
+  check_stream_parse_matches("fixtures/relative_paths.epub");
+  check_stream_parse_matches("fixtures/oebps.epub");
+}
+
+// track how much heap pugixml is holding on to at any one time
+static size_t pugi_current_bytes = 0;
+static size_t pugi_peak_bytes = 0;
+
+static void *tracking_allocate(size_t size)
+{
+  size_t *block = static_cast<size_t *>(malloc(size + sizeof(size_t) * 2));
+  if (!block)
+  {
+    return nullptr;
+  }
+  block[0] = size;
+  pugi_current_bytes += size;
+  if (pugi_current_bytes > pugi_peak_bytes)
+  {
+    pugi_peak_bytes = pugi_current_bytes;
+  }
+  return block + 2;
+}
+
+static void tracking_deallocate(void *ptr)
+{
+  if (ptr)
+  {
+    size_t *block = static_cast<size_t *>(ptr) - 2;
+    pugi_current_bytes -= block[0];
+    free(block);
+  }
+}
+
+// what the old parser did - build the whole DOM then walk it
+static void walk_dom(pugi::xml_node node, CountingHandler *handler)
+{
+  for (pugi::xml_node child = node.first_child(); child; child = child.next_sibling())
+  {
+    if (child.type() == pugi::node_element)
+    {
+      handler->elements++;
+      walk_dom(child, handler);
+    }
+    else if (child.type() == pugi::node_pcdata || child.type() == pugi::node_cdata)
+    {
+      handler->text_bytes += strlen(child.value());
+    }
+  }
+}
+
+static void benchmark_tokenizer(Epub *epub, const char *path)
+{
+  const int passes = 5;
+  size_t total_bytes = 0;
+  size_t largest_item = 0;
+  double tokenizer_time = 0;
+  double pugi_time = 0;
+  pugi_peak_bytes = 0;
+  pugi::set_memory_management_functions(tracking_allocate, tracking_deallocate);
+  for (int i = 0; i < epub->get_spine_items_count(); i++)
+  {
+    size_t size = 0;
+    char *html = reinterpret_cast<char *>(epub->get_item_contents(epub->get_spine_item(i), &size));
+    TEST_ASSERT_NOT_NULL(html);
+    total_bytes += size * passes;
+    if (size > largest_item)
+    {
+      largest_item = size;
+    }
+    CountingHandler tokenizer_counts;
+    benchmark_time_t start = benchmark_now();
+    for (int pass = 0; pass < passes; pass++)
+    {
+      XhtmlTokenizer *tokenizer = new XhtmlTokenizer(tokenizer_counts);
+      tokenizer->feed(html, size);
+      tokenizer->finish();
+      delete tokenizer;
+    }
+    tokenizer_time += benchmark_seconds(start);
+    CountingHandler pugi_counts;
+    start = benchmark_now();
+    for (int pass = 0; pass < passes; pass++)
+    {
+      pugi::xml_document doc;
+      doc.load_buffer(html, size, pugi::parse_default | pugi::parse_ws_pcdata);
+      walk_dom(doc, &pugi_counts);
+    }
+    pugi_time += benchmark_seconds(start);
+    // both should see the same elements
+    TEST_ASSERT_EQUAL(pugi_counts.elements, tokenizer_counts.elements);
+    free(html);
+  }
+  pugi::set_memory_management_functions(malloc, free);
+  char message[256];
+  snprintf(message, sizeof(message), "%s: tokenizer %.1f MB/s (%u bytes fixed), pugixml %.1f MB/s (%u bytes peak heap), largest item %u bytes",
+           path,
+           total_bytes / tokenizer_time / 1e6,
+           (unsigned)sizeof(XhtmlTokenizer),
+           total_bytes / pugi_time / 1e6,
+           (unsigned)pugi_peak_bytes,
+           (unsigned)largest_item);
+  TEST_MESSAGE(message);
+}
+
+void test_xhtml_tokenizer_benchmark(void)
+{
+  benchmark_fixtures(benchmark_tokenizer);
+}
@@ -0,0 +1,238 @@
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include <EpubList/Epub.h>
+#include <ZipFile/ZipFile.h>
+#include <ZipFile/ZipIndex.h>
+#include <BookCache/BookCache.h>
+
+void test_zip_stream_matches_memory_read(void)
+{
+  Epub *epub = new Epub("fixtures/relative_paths.epub");
+  TEST_ASSERT_TRUE_MESSAGE(epub->load(), "Epub load failed");
+  const int chunk_size = 1000;
+  uint8_t chunk[chunk_size];
+  for (int i = 0; i < epub->get_spine_items_count(); i += 37)
+  {
+    size_t size = 0;
+    uint8_t *expected = epub->get_item_contents(epub->get_spine_item(i), &size);
+    TEST_ASSERT_NOT_NULL(expected);
+    ZipEntryStream *stream = epub->open_item_stream(epub->get_spine_item(i));
+    TEST_ASSERT_NOT_NULL(stream);
+    TEST_ASSERT_EQUAL(size, stream->size());
+    size_t offset = 0;
+    while (!stream->eof())
+    {
+      size_t read = stream->read(chunk, chunk_size);
+      TEST_ASSERT_TRUE(read > 0 && offset + read <= size);
+      TEST_ASSERT_EQUAL_MEMORY(expected + offset, chunk, read);
+      offset += read;
+    }
+    TEST_ASSERT_EQUAL(size, offset);
+    TEST_ASSERT_TRUE(stream->close());
+    delete stream;
+    free(expected);
+  }
+  TEST_ASSERT_NULL(epub->open_item_stream("OEBPS/missing.xhtml"));
+  delete epub;
+}
+
+void test_zip_index_sidecar_reused(void)
+{
+  const char *item = "OEBPS/Text/autor.xhtml";
+  ZipFile *first = new ZipFile("fixtures/relative_paths.epub");
+  size_t expected_size = 0;
+  TEST_ASSERT_TRUE(first->get_file_uncompressed_size(item, &expected_size));
+  delete first;
+  // the second open should come straight from the sidecar index
+  ZipFile *second = new ZipFile("fixtures/relative_paths.epub");
+  size_t size = 0;
+  uint8_t *contents = second->read_file_to_memory(item, &size);
+  TEST_ASSERT_NOT_NULL(contents);
+  TEST_ASSERT_EQUAL(expected_size, size);
+  TEST_ASSERT_EQUAL(0, second->get_stats().directory_scans);
+  free(contents);
+  delete second;
+}
+
+void test_zip_index_sidecar_corrupt(void)
+{
+  const char *item = "OEBPS/Text/autor.xhtml";
+  ZipFile *zip = new ZipFile("fixtures/relative_paths.epub");
+  size_t expected_size = 0;
+  uint8_t *expected = zip->read_file_to_memory(item, &expected_size);
+  TEST_ASSERT_NOT_NULL(expected);
+  delete zip;
+  // scribble over the sidecar - it should be thrown away and rebuilt
+  BookCache cache("fixtures/relative_paths.epub");
+  File file = SD.open(cache.get_path("ZIX").c_str(), FILE_WRITE);
+  TEST_ASSERT_TRUE(file);
+  uint8_t junk[64];
+  memset(junk, 0xA5, sizeof(junk));
+  file.write(junk, sizeof(junk));
+  file.close();
+  zip = new ZipFile("fixtures/relative_paths.epub");
+  size_t size = 0;
+  uint8_t *contents = zip->read_file_to_memory(item, &size);
+  TEST_ASSERT_NOT_NULL(contents);
+  TEST_ASSERT_EQUAL(expected_size, size);
+  TEST_ASSERT_EQUAL_MEMORY(expected, contents, size);
+  TEST_ASSERT_EQUAL(1, zip->get_stats().directory_scans);
+  free(contents);
+  delete zip;
+  // a table where every bucket points at the same entry has no empty bucket
+  // to stop a lookup - it has to be rejected rather than hang the reader
+  file = SD.open(cache.get_path("ZIX").c_str(), FILE_READ);
+  TEST_ASSERT_TRUE(file);
+  std::vector<uint8_t> sidecar(file.size());
+  TEST_ASSERT_EQUAL(sidecar.size(), file.read(sidecar.data(), sidecar.size()));
+  file.close();
+  uint32_t counts[2];
+  memcpy(counts, sidecar.data() + sizeof(BookCacheHeader), sizeof(counts));
+  size_t buckets = sizeof(BookCacheHeader) + 3 * sizeof(uint32_t) + counts[0] * sizeof(ZipIndexEntry);
+  for (uint32_t i = 0; i < counts[1]; i++)
+  {
+    uint32_t slot = 1;
+    memcpy(sidecar.data() + buckets + i * sizeof(uint32_t), &slot, sizeof(slot));
+  }
+  file = SD.open(cache.get_path("ZIX").c_str(), FILE_WRITE);
+  TEST_ASSERT_TRUE(file);
+  file.write(sidecar.data(), sidecar.size());
+  file.close();
+  zip = new ZipFile("fixtures/relative_paths.epub");
+  TEST_ASSERT_NULL(zip->read_file_to_memory("OEBPS/missing.xhtml", &size));
+  contents = zip->read_file_to_memory(item, &size);
+  TEST_ASSERT_NOT_NULL(contents);
+  TEST_ASSERT_EQUAL_MEMORY(expected, contents, size);
+  TEST_ASSERT_EQUAL(1, zip->get_stats().directory_scans);
+  free(contents);
+  free(expected);
+  delete zip;
+}
+
+void test_zip_block_cache_small_reads(void)
+{
+  ZipFile *zip = new ZipFile("fixtures/relative_paths.epub");
+  size_t expected_size = 0;
+  uint8_t *expected = zip->read_file_to_memory("OEBPS/content.opf", &expected_size);
+  TEST_ASSERT_NOT_NULL(expected);
+  ZipStats before = zip->get_stats();
+  // lots of tiny reads should be served from a handful of card reads
+  ZipEntryStream *stream = zip->open_stream("OEBPS/content.opf");
+  TEST_ASSERT_NOT_NULL(stream);
+  uint8_t chunk[100];
+  size_t offset = 0;
+  int reads = 0;
+  while (!stream->eof())
+  {
+    size_t read = stream->read(chunk, sizeof(chunk));
+    TEST_ASSERT_TRUE(read > 0);
+    TEST_ASSERT_EQUAL_MEMORY(expected + offset, chunk, read);
+    offset += read;
+    reads++;
+  }
+  TEST_ASSERT_TRUE(stream->close());
+  delete stream;
+  const ZipStats &after = zip->get_stats();
+  TEST_ASSERT_TRUE(after.cache_hits > before.cache_hits);
+  TEST_ASSERT_TRUE(after.read_calls - before.read_calls < 10);
+  TEST_ASSERT_TRUE(reads > 100);
+  free(expected);
+  delete zip;
+}
+
+void test_zip_stored_entry_random_access(void)
+{
+  const char *cover = "OEBPS/@public@vhost@g@gutenberg@html@files@43@43-h@images@cover.jpg";
+  ZipFile *zip = new ZipFile("fixtures/oebps.epub");
+  size_t size = 0;
+  uint8_t *expected = zip->read_file_to_memory(cover, &size);
+  TEST_ASSERT_NOT_NULL(expected);
+  ZipEntryStream *stream = zip->open_stream(cover);
+  TEST_ASSERT_NOT_NULL(stream);
+  TEST_ASSERT_TRUE(stream->is_stored());
+  TEST_ASSERT_EQUAL(size, stream->size());
+  // jump around the entry like an image decoder would
+  const size_t offsets[] = {size - 100, 0, size / 2, 12345, size - 1};
+  uint8_t chunk[100];
+  for (size_t offset : offsets)
+  {
+    TEST_ASSERT_TRUE(stream->seek(offset));
+    size_t read = stream->read(chunk, sizeof(chunk));
+    TEST_ASSERT_EQUAL(std::min(sizeof(chunk), size - offset), read);
+    TEST_ASSERT_EQUAL_MEMORY(expected + offset, chunk, read);
+  }
+  TEST_ASSERT_FALSE(stream->seek(size + 1));
+  TEST_ASSERT_TRUE(stream->close());
+  delete stream;
+  free(expected);
+  delete zip;
+}
+
+void test_zip_compressed_entry_seek(void)
+{
+  ZipFile *zip = new ZipFile("fixtures/relative_paths.epub");
+  size_t size = 0;
+  uint8_t *expected = zip->read_file_to_memory("OEBPS/content.opf", &size);
+  TEST_ASSERT_NOT_NULL(expected);
+  ZipEntryStream *stream = zip->open_stream("OEBPS/content.opf");
+  TEST_ASSERT_NOT_NULL(stream);
+  TEST_ASSERT_FALSE(stream->is_stored());
+  // forwards, then backwards which has to start inflating again
+  const size_t offsets[] = {40000, 100, 59000};
+  uint8_t chunk[500];
+  for (size_t offset : offsets)
+  {
+    TEST_ASSERT_TRUE(stream->seek(offset));
+    size_t read = stream->read(chunk, sizeof(chunk));
+    TEST_ASSERT_EQUAL(sizeof(chunk), read);
+    TEST_ASSERT_EQUAL_MEMORY(expected + offset, chunk, read);
+  }
+  TEST_ASSERT_TRUE(stream->close());
+  delete stream;
+  free(expected);
+  delete zip;
+}
+
+void test_zip_checkpoint_seek(void)
+{
+  const char *item = "OEBPS/content.opf";
+  ZipFile *zip = new ZipFile("fixtures/relative_paths.epub");
+  size_t size = 0;
+  uint8_t *expected = zip->read_file_to_memory(item, &size);
+  TEST_ASSERT_NOT_NULL(expected);
+  BookCache cache("fixtures/relative_paths.epub");
+  cache.remove("ZCP");
+  // stream the entry once to record the checkpoints
+  zip->set_checkpoint_interval(8 * 1024);
+  ZipEntryStream *stream = zip->open_stream(item);
+  TEST_ASSERT_NOT_NULL(stream);
+  uint8_t chunk[500];
+  while (!stream->eof())
+  {
+    TEST_ASSERT_TRUE(stream->read(chunk, sizeof(chunk)) > 0);
+  }
+  TEST_ASSERT_TRUE(stream->close());
+  delete stream;
+  delete zip;
+  // a fresh session should be able to jump into the middle using them
+  zip = new ZipFile("fixtures/relative_paths.epub");
+  zip->set_checkpoint_interval(8 * 1024);
+  stream = zip->open_stream(item);
+  TEST_ASSERT_NOT_NULL(stream);
+  const size_t offsets[] = {size - 1000, 20000, 100, 41000};
+  for (size_t offset : offsets)
+  {
+    TEST_ASSERT_TRUE(stream->seek(offset));
+    size_t read = stream->read(chunk, sizeof(chunk));
+    TEST_ASSERT_EQUAL(sizeof(chunk), read);
+    TEST_ASSERT_EQUAL_MEMORY(expected + offset, chunk, read);
+  }
+  TEST_ASSERT_TRUE(zip->get_stats().checkpoint_restores >= 2);
+  TEST_ASSERT_TRUE(stream->close());
+  delete stream;
+  free(expected);
+  delete zip;
+}
@@ -2,22 +2,102 @@
 
 void test_xml_parser(void);
 void test_parser(void);
+void test_parser_images(void);
+void test_parser_section_text(void);
+void test_section_words(void);
 void test_epub_no_oebps_load(void);
 void test_epub_load(void);
 void test_epub_relative_image_paths(void);
 void test_html_entity_replacement(void);
+void test_html_entity_replacement_in_place(void);
+void test_html_entity_benchmark(void);
 void test_epub_toc_load(void);
+void test_epub_zip_session_reuse(void);
+void test_zip_stream_matches_memory_read(void);
+void test_zip_index_sidecar_reused(void);
+void test_zip_index_sidecar_corrupt(void);
+void test_zip_block_cache_small_reads(void);
+void test_zip_stored_entry_random_access(void);
+void test_zip_compressed_entry_seek(void);
+void test_zip_checkpoint_seek(void);
+void test_inflate_benchmark(void);
+void test_epub_metadata_cache_reused(void);
+void test_epub_metadata_only_load(void);
+void test_epub_string_arena(void);
+void test_xhtml_tokenizer_events(void);
+void test_xhtml_tokenizer_chunked(void);
+void test_xhtml_tokenizer_stream_parse(void);
+void test_xhtml_tokenizer_benchmark(void);
+void test_html_tag_classifier(void);
+void test_parser_new_block_tags(void);
+void test_css_declarations(void);
+void test_css_style_table(void);
+void test_parser_applies_stylesheet(void);
+void test_epub_stylesheets_cached(void);
+void test_parser_pages(void);
+void test_parser_incremental_layout(void);
+void test_parser_page_table(void);
+void test_parser_relayout_phases(void);
+void test_word_width_cache(void);
+void test_book_pages(void);
+void test_book_pages_estimate(void);
+void test_hyphenation_patterns(void);
+void test_hyphenated_line_breaks(void);
+void test_hyphenation_benchmark(void);
+void test_line_breaker(void);
+void test_line_breaker_benchmark(void);
+void test_layout_benchmark(void);
 
 int main(int argc, char **argv)
 {
   UNITY_BEGIN();
   RUN_TEST(test_xml_parser);
   RUN_TEST(test_parser);
+  RUN_TEST(test_parser_images);
+  RUN_TEST(test_parser_section_text);
+  RUN_TEST(test_section_words);
   RUN_TEST(test_epub_no_oebps_load);
   RUN_TEST(test_epub_load);
   RUN_TEST(test_epub_relative_image_paths);
   RUN_TEST(test_html_entity_replacement);
+  RUN_TEST(test_html_entity_replacement_in_place);
+  RUN_TEST(test_html_entity_benchmark);
   RUN_TEST(test_epub_toc_load);
+  RUN_TEST(test_epub_zip_session_reuse);
+  RUN_TEST(test_zip_stream_matches_memory_read);
+  RUN_TEST(test_zip_index_sidecar_reused);
+  RUN_TEST(test_zip_index_sidecar_corrupt);
+  RUN_TEST(test_zip_block_cache_small_reads);
+  RUN_TEST(test_zip_stored_entry_random_access);
+  RUN_TEST(test_zip_compressed_entry_seek);
+  RUN_TEST(test_zip_checkpoint_seek);
+  RUN_TEST(test_inflate_benchmark);
+  RUN_TEST(test_epub_metadata_cache_reused);
+  RUN_TEST(test_epub_metadata_only_load);
+  RUN_TEST(test_epub_string_arena);
+  RUN_TEST(test_xhtml_tokenizer_events);
+  RUN_TEST(test_xhtml_tokenizer_chunked);
+  RUN_TEST(test_xhtml_tokenizer_stream_parse);
+  RUN_TEST(test_xhtml_tokenizer_benchmark);
+  RUN_TEST(test_html_tag_classifier);
+  RUN_TEST(test_parser_new_block_tags);
+  RUN_TEST(test_css_declarations);
+  RUN_TEST(test_css_style_table);
+  RUN_TEST(test_parser_applies_stylesheet);
+  RUN_TEST(test_epub_stylesheets_cached);
+  RUN_TEST(test_parser_pages);
+  RUN_TEST(test_parser_incremental_layout);
+  RUN_TEST(test_parser_page_table);
+  RUN_TEST(test_parser_relayout_phases);
+  RUN_TEST(test_word_width_cache);
+  RUN_TEST(test_book_pages);
+  RUN_TEST(test_book_pages_estimate);
+  RUN_TEST(test_hyphenation_patterns);
+  RUN_TEST(test_hyphenated_line_breaks);
+  RUN_TEST(test_hyphenation_benchmark);
+  RUN_TEST(test_line_breaker);
+  RUN_TEST(test_line_breaker_benchmark);
+  RUN_TEST(test_layout_benchmark);
   UNITY_END();
 
   return 0;